@@ -0,0 +1,67 @@
+//
+// Created by root on 17.10.26.
+//
+
+// AMD audio of 1k calls through AudioRing: messages and time per second of audio
+// for the amd_ai_aggregate_ms windows
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include "amd_client.h"
+
+#define BENCH_STREAMS 1000
+#define BENCH_AUDIO_SEC 10
+// 20 ms of 8k L16
+#define BENCH_FRAME_BYTES 320
+#define BENCH_FRAME_MS 20
+#define BENCH_BUFFER_FRAMES 50
+
+static void bench(int aggregate_ms) {
+    // as AMDClient sizes the ring and Bind the window
+    size_t frames = BENCH_BUFFER_FRAMES;
+    if (frames < static_cast<size_t>(2 * (aggregate_ms / BENCH_FRAME_MS + 1))) {
+        frames = static_cast<size_t>(2 * (aggregate_ms / BENCH_FRAME_MS + 1));
+    }
+    const size_t min_bytes = static_cast<size_t>(aggregate_ms) * 8000 * 2 / 1000;
+
+    std::vector<std::unique_ptr<AudioRing>> rings;
+    for (int i = 0; i < BENCH_STREAMS; i++) {
+        rings.emplace_back(new AudioRing(frames));
+    }
+
+    uint8_t frame[BENCH_FRAME_BYTES];
+    for (size_t i = 0; i < sizeof(frame); i++) {
+        frame[i] = static_cast<uint8_t>(i * 31);
+    }
+
+    ::amd::StreamPCMRequest msg;
+    size_t messages = 0, wire = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < BENCH_AUDIO_SEC * 1000 / BENCH_FRAME_MS; tick++) {
+        // media bug threads, then the completion queue thread drains what the window allows
+        for (auto &ring : rings) {
+            ring->push(frame, sizeof(frame), tick % 3 ? 1 : 0, 0);
+        }
+        for (auto &ring : rings) {
+            while (ring->pop(&msg, min_bytes, false)) {
+                messages++;
+                wire += msg.ByteSizeLong();
+            }
+        }
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+    double audio_sec = static_cast<double>(BENCH_STREAMS) * BENCH_AUDIO_SEC;
+    printf("aggregate %3d ms: %8.1f msg/s per call %8.0f bytes/msg %8.1f us per second of call audio\n",
+           aggregate_ms, messages / audio_sec, messages ? (double) wire / messages : 0.0, ns / 1000.0 / audio_sec);
+}
+
+int main() {
+    printf("%d calls, %d sec of audio each\n", BENCH_STREAMS, BENCH_AUDIO_SEC);
+    for (int ms : {0, 60, 100, 200}) {
+        bench(ms);
+    }
+    return 0;
+}
@@ -0,0 +1,144 @@
+//
+// Created by root on 17.10.26.
+//
+
+// AMD audio of 1k calls through AMDClient and the completion queue threads to an in-process
+// amd::Api server: messages and CPU (client and server) per second of call audio for the
+// amd_ai_aggregate_ms windows. Audio is written in real time, 20 ms frames.
+
+#include <sys/resource.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "amd_client.h"
+
+#define BENCH_STREAMS 1000
+#define BENCH_AUDIO_SEC 5
+// 20 ms of 8k L16
+#define BENCH_FRAME_BYTES 320
+#define BENCH_FRAME_MS 20
+#define BENCH_BUFFER_FRAMES 50
+#define BENCH_CQ_THREADS 2
+#define BENCH_CHANNELS 2
+
+static std::atomic<uint64_t> server_messages(0);
+static std::atomic<uint64_t> server_bytes(0);
+
+// reads the stream to the end and answers once
+class CountingReactor : public grpc::ServerBidiReactor<::amd::StreamPCMRequest, ::amd::StreamPCMResponse> {
+public:
+    CountingReactor() {
+        StartRead(&req_);
+    }
+
+    void OnReadDone(bool ok) override {
+        if (ok) {
+            if (!req_.has_metadata()) {
+                server_messages++;
+                server_bytes += req_.ByteSizeLong();
+            }
+            StartRead(&req_);
+            return;
+        }
+        resp_.set_result("HUMAN");
+        resp_.set_confidence(0.9f);
+        StartWriteAndFinish(&resp_, grpc::WriteOptions(), grpc::Status::OK);
+    }
+
+    void OnDone() override {
+        delete this;
+    }
+
+private:
+    ::amd::StreamPCMRequest req_;
+    ::amd::StreamPCMResponse resp_;
+};
+
+class CountingService final : public ::amd::Api::CallbackService {
+    grpc::ServerBidiReactor<::amd::StreamPCMRequest, ::amd::StreamPCMResponse> *StreamPCM(
+            grpc::CallbackServerContext *context) override {
+        return new CountingReactor;
+    }
+};
+
+static double cpu_us() {
+    struct rusage u;
+    getrusage(RUSAGE_SELF, &u);
+    return (u.ru_utime.tv_sec + u.ru_stime.tv_sec) * 1e6 + u.ru_utime.tv_usec + u.ru_stime.tv_usec;
+}
+
+static void bench(const std::string &address, int aggregate_ms) {
+    AMDClient client(address.c_str(), BENCH_CHANNELS, 0, BENCH_CQ_THREADS, BENCH_BUFFER_FRAMES, false, aggregate_ms, 0);
+
+    std::vector<AsyncClientCall *> calls;
+    for (int i = 0; i < BENCH_STREAMS; i++) {
+        char uuid[64];
+        snprintf(uuid, sizeof(uuid), "bench-%d", i);
+        auto call = client.Stream(1, uuid, "bench", 8000, "audio/l16", 2, false);
+        if (!call) {
+            fprintf(stderr, "stream %d is not opened\n", i);
+            break;
+        }
+        calls.push_back(call);
+    }
+
+    uint8_t frame[BENCH_FRAME_BYTES];
+    for (size_t i = 0; i < sizeof(frame); i++) {
+        frame[i] = static_cast<uint8_t>(i * 31);
+    }
+
+    server_messages = 0;
+    server_bytes = 0;
+    auto cpu = cpu_us();
+    auto next = std::chrono::steady_clock::now();
+    for (int tick = 0; tick < BENCH_AUDIO_SEC * 1000 / BENCH_FRAME_MS; tick++) {
+        // media bug threads of all calls in one
+        for (auto call : calls) {
+            call->Write(frame, sizeof(frame), tick % 3 ? SWITCH_VAD_STATE_TALKING : SWITCH_VAD_STATE_NONE);
+        }
+        next += std::chrono::milliseconds(BENCH_FRAME_MS);
+        std::this_thread::sleep_until(next);
+    }
+
+    uint64_t frames = 0, dropped = 0;
+    size_t failed = 0;
+    for (auto call : calls) {
+        failed += !call->Finish();
+        frames += call->Frames();
+        dropped += call->Dropped();
+        delete call;
+    }
+    cpu = cpu_us() - cpu;
+
+    double audio_sec = static_cast<double>(calls.size()) * BENCH_AUDIO_SEC;
+    printf("aggregate %3d ms: %8.1f msg/s per call %8.0f bytes/msg %8.1f us CPU per second of call audio, "
+           "frames %lu dropped %lu failed %zu\n",
+           aggregate_ms, server_messages / audio_sec, server_messages ? (double) server_bytes / server_messages : 0.0,
+           cpu / audio_sec, (unsigned long) frames, (unsigned long) dropped, failed);
+}
+
+int main() {
+    CountingService service;
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&service);
+    auto server = builder.BuildAndStart();
+    if (!server || !port) {
+        fprintf(stderr, "server is not started\n");
+        return 1;
+    }
+    auto address = "127.0.0.1:" + std::to_string(port);
+
+    printf("%d calls, %d sec of audio each, %d completion queue threads, %d channels\n", BENCH_STREAMS,
+           BENCH_AUDIO_SEC, BENCH_CQ_THREADS, BENCH_CHANNELS);
+    for (int ms : {0, 60, 100, 200}) {
+        bench(address, ms);
+    }
+
+    server->Shutdown();
+    return 0;
+}
@@ -0,0 +1,154 @@
+//
+// Created by root on 17.10.26.
+//
+
+// WEBITEL_CALL body of a realistic hangup event: JSON writer against CallEventPayload,
+// EventIndex against switch_event_get_header for the headers the hangup builder reads
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include "Call.h"
+
+#define BENCH_ITERATIONS 20000
+#define BENCH_EXTRA_VARIABLES 216
+
+template <CallActions A> class Probe : public CallEvent<A> {
+public:
+    explicit Probe(switch_event_t *e) : CallEvent<A>(e) {}
+
+    size_t json() {
+        return strlen(this->body_->finish());
+    }
+
+    size_t payload() {
+        std::string raw;
+        this->payload_->SerializeToString(&raw);
+        return raw.size();
+    }
+};
+
+static void add(switch_event_t *e, const char *name, const char *val) {
+    switch_event_add_header_string(e, SWITCH_STACK_BOTTOM, name, val);
+}
+
+// about 300 headers, as CHANNEL_HANGUP_COMPLETE of a bridged webitel call
+static switch_event_t *hangupEvent() {
+    switch_event_t *e;
+    switch_event_create(&e, SWITCH_EVENT_CHANNEL_HANGUP_COMPLETE);
+    const char *channel[][2] = {
+            {"Event-Name", "CHANNEL_HANGUP_COMPLETE"}, {"Core-UUID", "0b2e6e2c-61a1-4c8f-9e0a-4a5e1f0f6f11"},
+            {"FreeSWITCH-Hostname", "fs-1"}, {"FreeSWITCH-Switchname", "node-1"}, {"FreeSWITCH-IPv4", "10.0.0.5"},
+            {"FreeSWITCH-IPv6", "::1"}, {"Event-Date-Local", "2026-10-17 06:00:00"}, {"Event-Date-GMT", "Sat, 17 Oct 2026 06:00:00 GMT"},
+            {"Event-Date-Timestamp", "1792216800000000"}, {"Event-Calling-File", "switch_core_state_machine.c"},
+            {"Event-Calling-Function", "switch_core_session_reporting_state"}, {"Event-Calling-Line-Number", "949"},
+            {"Event-Sequence", "123456"}, {"Hangup-Cause", "NORMAL_CLEARING"}, {"Channel-State", "CS_REPORTING"},
+            {"Channel-Call-State", "HANGUP"}, {"Channel-State-Number", "11"}, {"Channel-Name", "sofia/sip/1001@webitel.lo"},
+            {"Unique-ID", "2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10"}, {"Call-Direction", "outbound"},
+            {"Presence-Call-Direction", "outbound"}, {"Channel-HIT-Dialplan", "false"}, {"Channel-Call-UUID", "2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10"},
+            {"Answer-State", "hangup"}, {"Channel-Read-Codec-Name", "PCMA"},
+            {"Channel-Read-Codec-Rate", "8000"}, {"Channel-Write-Codec-Name", "PCMA"}, {"Channel-Write-Codec-Rate", "8000"},
+            {"Caller-Direction", "outbound"}, {"Caller-Logical-Direction", "outbound"}, {"Caller-Username", "1001"},
+            {"Caller-Dialplan", "XML"}, {"Caller-Caller-ID-Name", "Oleh Kovalenko"}, {"Caller-Caller-ID-Number", "1001"},
+            {"Caller-Orig-Caller-ID-Name", "Oleh Kovalenko"}, {"Caller-Orig-Caller-ID-Number", "1001"},
+            {"Caller-Callee-ID-Name", "Outbound Call"}, {"Caller-Callee-ID-Number", "+380441234567"},
+            {"Caller-Network-Addr", "10.0.0.7"}, {"Caller-ANI", "1001"}, {"Caller-Destination-Number", "+380441234567"},
+            {"Caller-Unique-ID", "2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10"}, {"Caller-Source", "mod_sofia"},
+            {"Caller-Context", "default"}, {"Caller-Channel-Name", "sofia/sip/1001@webitel.lo"},
+            {"Caller-Profile-Index", "1"}, {"Caller-Profile-Created-Time", "1792216780000000"},
+            {"Caller-Channel-Created-Time", "1792216780000000"}, {"Caller-Channel-Answered-Time", "1792216785000000"},
+            {"Caller-Channel-Hangup-Time", "1792216800000000"}, {"Other-Type", "originatee"},
+            {"Other-Leg-Unique-ID", "9a1c2e4f-0000-4000-8000-000000000001"}, {"Other-Leg-Caller-ID-Number", "1001"},
+            {"variable_direction", "outbound"}, {"variable_uuid", "2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10"},
+            {"variable_sip_h_X-Webitel-Domain-Id", "1"}, {"variable_sip_h_X-Webitel-User-Id", "42"},
+            {"variable_sip_h_X-Webitel-Direction", "outbound"}, {"variable_sip_h_X-Webitel-Uuid", "sip-4b8f"},
+            {"variable_wbt_parent_id", "1e3f8a6c-1111-4222-8333-944455556666"}, {"variable_hangup_cause", "NORMAL_CLEARING"},
+            {"variable_proto_specific_hangup_cause", "sip:200"}, {"variable_sip_hangup_disposition", "recv_bye"},
+            {"variable_sip_term_status", "200"}, {"variable_bridge_epoch", "1792216785"}, {"variable_last_app", "bridge"},
+            {"variable_record_seconds", "15"}, {"variable_wbt_start_record", "1792216785"}, {"variable_wbt_stop_record", "1792216800"},
+            {"variable_wbt_talk_sec", "15"}, {"variable_cc_app_id", "cc-1"}, {"variable_cc_reporting_at", "1792216800123"},
+            {"variable_cc_queue_id", "5"}, {"variable_cc_queue_name", "Sales"}, {"variable_cc_attempt_id", "123456789"},
+            {"variable_cc_member_id", "987"}, {"variable_usr_client", "ACME \"Ltd\""}, {"variable_usr_order", "A-1001"},
+            {"variable_usr_note", "called back\nvip"}, {"variable_wbt_tags", "ARRAY::vip|:callback|:sales"},
+            {"variable_wbt_schema_ids", "ARRAY::1|:22|:333"}, {"variable_wbt_amd_ai", "HUMAN"},
+            {"variable_wbt_amd_ai_positive", "true"}, {"variable_wbt_amd_ai_log", "ARRAY::human|:human"},
+    };
+    for (auto &h : channel) {
+        add(e, h[0], h[1]);
+    }
+    for (int i = 0; i < BENCH_EXTRA_VARIABLES; i++) {
+        char name[64], val[64];
+        snprintf(name, sizeof(name), "variable_rtp_audio_stat_%d", i);
+        snprintf(val, sizeof(val), "%d", i * 7919);
+        add(e, name, val);
+    }
+    return e;
+}
+
+// read by CallEvent<Hangup> and BaseCallEvent, a few of them are missing in the event
+static const EventHeader hangup_headers[] = {
+        IDX_VAR_WBT_PARENT_ID, IDX_UNIQUE_ID, IDX_FREESWITCH_SWITCHNAME, IDX_VAR_SIP_H_X_WEBITEL_DOMAIN_ID,
+        IDX_VAR_SIP_H_X_WEBITEL_USER_ID, IDX_VAR_CC_APP_ID, IDX_VAR_HANGUP_CAUSE, IDX_VAR_PROTO_SPECIFIC_HANGUP_CAUSE,
+        IDX_VAR_CC_REPORTING_AT, IDX_VAR_SIP_HANGUP_DISPOSITION, IDX_VAR_WBT_TRANSFER_TO, IDX_VAR_WBT_TRANSFER_FROM,
+        IDX_VAR_WBT_TRANSFER_TO_AGENT, IDX_VAR_WBT_TRANSFER_FROM_ATTEMPT, IDX_VAR_WBT_TRANSFER_TO_ATTEMPT,
+        IDX_VAR_WBT_TALK_SEC, IDX_VAR_WBT_AMD_AI, IDX_VAR_PROCESS_CDR, IDX_VAR_SIP_HANGUP_PHRASE,
+        IDX_VAR_WBT_EAVESDROP_TYPE, IDX_VAR_WBT_NOTIFICATION_HANGUP, IDX_VAR_AMD_RESULT, IDX_VAR_AMD_CAUSE,
+        IDX_VAR_WBT_HIDE_CONTACT, IDX_VAR_WBT_CONTACT_ID, IDX_VAR_RECORD_SECONDS, IDX_VAR_WBT_START_RECORD,
+        IDX_VAR_MEDIA_BUG_ANSWER_REQ, IDX_VAR_BRIDGE_EPOCH, IDX_VAR_WBT_STOP_RECORD, IDX_VAR_GRPC_SEND_HANGUP,
+        IDX_VAR_LAST_APP, IDX_VAR_GRPC_ORIGINATE_SUCCESS, IDX_VAR_WBT_TAGS, IDX_VAR_WBT_SCHEMA_IDS,
+        IDX_VAR_WBT_AMD_AI_POSITIVE, IDX_VAR_WBT_AMD_AI_LOG,
+};
+
+static void bench(const char *name, const std::function<size_t()> &fn) {
+    auto bytes = fn();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        bytes = fn();
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    // bytes of the body, found headers for the lookups
+    printf("%-32s %10.0f ns/op %6zu\n", name, (double) ns / BENCH_ITERATIONS, bytes);
+}
+
+int main() {
+    auto e = hangupEvent();
+    size_t headers = 0;
+    for (auto hp = e->headers; hp; hp = hp->next) {
+        headers++;
+    }
+    printf("hangup event: %zu headers, %d iterations\n", headers, BENCH_ITERATIONS);
+
+    bench("switch_event_get_header", [e] {
+        size_t found = 0;
+        for (auto h : hangup_headers) {
+            found += switch_event_get_header(e, mod_grpc::EventIndex::name(h)) != nullptr;
+        }
+        return found;
+    });
+
+    bench("EventIndex", [e] {
+        mod_grpc::EventIndex index(e);
+        size_t found = 0;
+        for (auto h : hangup_headers) {
+            found += index.get(h) != nullptr;
+        }
+        return found;
+    });
+
+    BaseCallEvent::setProtobufFormat(false);
+    bench("hangup json", [e] {
+        Probe<Hangup> ev(e);
+        return ev.json();
+    });
+
+    BaseCallEvent::setProtobufFormat(true);
+    bench("hangup payload", [e] {
+        Probe<Hangup> ev(e);
+        return ev.payload();
+    });
+    BaseCallEvent::setProtobufFormat(false);
+
+    switch_event_destroy(&e);
+    return 0;
+}
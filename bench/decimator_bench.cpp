@@ -0,0 +1,91 @@
+//
+// Created by root on 17.10.26.
+//
+
+// Down sampling of 20 ms frames to 8k: the Decimator kernels (scalar, SSE2, AVX2) and the speex
+// resampler of libfreeswitch it replaced, time per frame and per second of call audio
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "resampler.h"
+
+extern "C" {
+#include <switch.h>
+}
+
+#define OUT_RATE 8000
+#define FRAME_MS 20
+#define BENCH_SECONDS 60
+
+static std::vector<int16_t> input(int rate) {
+    std::vector<int16_t> in(static_cast<size_t>(rate * BENCH_SECONDS));
+    for (size_t i = 0; i < in.size(); i++) {
+        double t = static_cast<double>(i) / rate;
+        in[i] = static_cast<int16_t>(lrint(6000 * sin(2 * M_PI * 700 * t) + 3000 * sin(2 * M_PI * 6100 * t)));
+    }
+    return in;
+}
+
+// fn processes one frame and returns the output samples
+static void bench(const char *name, int rate, const std::vector<int16_t> &in,
+                  const std::function<size_t(const int16_t *, size_t)> &fn) {
+    const size_t frame = static_cast<size_t>(rate * FRAME_MS / 1000);
+    size_t frames = 0, samples = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t pos = 0; pos + frame <= in.size(); pos += frame) {
+        samples += fn(in.data() + pos, frame);
+        frames++;
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    printf("%5d -> %d %-8s %8.0f ns/frame %8.1f us per second of audio %8zu samples\n", rate, OUT_RATE, name,
+           (double) ns / frames, ns / 1000.0 / BENCH_SECONDS, samples);
+}
+
+static void benchRate(int rate) {
+    auto in = input(rate);
+    std::vector<int16_t> out(in.size() / (rate / OUT_RATE) + 1);
+
+    struct {
+        const char *name;
+        mod_grpc::Decimator::Kernel kernel;
+    } kernels[] = {{"scalar", mod_grpc::Decimator::KERNEL_SCALAR},
+                   {"sse2", mod_grpc::Decimator::KERNEL_SSE2},
+                   {"avx2", mod_grpc::Decimator::KERNEL_AVX2}};
+
+    for (auto &k : kernels) {
+        std::unique_ptr<mod_grpc::Decimator> d(mod_grpc::Decimator::create(rate, OUT_RATE, k.kernel));
+        if (!d) {
+            printf("%5d -> %d %-8s is not supported\n", rate, OUT_RATE, k.name);
+            continue;
+        }
+        bench(k.name, rate, in, [&](const int16_t *data, size_t len) {
+            return d->process(data, len, out.data());
+        });
+    }
+
+    switch_audio_resampler_t *r = nullptr;
+    const size_t frame = static_cast<size_t>(rate * FRAME_MS / 1000);
+    if (switch_resample_create(&r, rate, OUT_RATE, static_cast<uint32_t>(frame), SWITCH_RESAMPLE_QUALITY, 1) != SWITCH_STATUS_SUCCESS || !r) {
+        printf("%5d -> %d %-8s is not available\n", rate, OUT_RATE, "speex");
+        return;
+    }
+    // speex works in place, as the media bug calls it
+    std::vector<int16_t> buf(frame);
+    bench("speex", rate, in, [&](const int16_t *data, size_t len) {
+        buf.assign(data, data + len);
+        switch_resample_process(r, buf.data(), static_cast<uint32_t>(len));
+        return static_cast<size_t>(r->to_len);
+    });
+    switch_resample_destroy(&r);
+}
+
+int main() {
+    printf("%d sec of audio in %d ms frames\n", BENCH_SECONDS, FRAME_MS);
+    benchRate(16000);
+    benchRate(48000);
+    return 0;
+}
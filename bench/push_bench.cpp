@@ -0,0 +1,90 @@
+//
+// Created by root on 17.10.26.
+//
+
+// Push bodies: PushTemplate::Render against the string concatenation it replaced
+// (which did not escape the fields), FCM with a few devices and APN
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include "PushTemplate.h"
+
+#define BENCH_ITERATIONS 200000
+#define BENCH_TTL 4
+
+using mod_grpc::PushData;
+using mod_grpc::PushTemplate;
+
+static const char *devices = "fcm-token-0123456789abcdef0123456789abcdef::fcm-token-fedcba9876543210fedcba9876543210"
+                             "::fcm-token-00112233445566778899aabbccddeeff";
+
+// the bodies before the templates
+static std::string toJson(const PushData *data) {
+    return "{\"type\":\"call\", \"call_id\":\"" + data->call_id + "\",\"from_number\":\"" + data->from_number + "\",\"from_name\":\"" + data->from_name +
+           "\",\"direction\":\"" + data->direction + "\",\"auto_answer\":" + std::to_string(data->auto_answer) + "}";
+}
+
+static std::string ReplaceAll(std::string str, const std::string &from, const std::string &to) {
+    size_t start_pos = 0;
+    while ((start_pos = str.find(from, start_pos)) != std::string::npos) {
+        str.replace(start_pos, from.length(), to);
+        start_pos += to.length();
+    }
+    return str;
+}
+
+static void bench(const char *name, const std::function<size_t()> &fn) {
+    auto bytes = fn();
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        bytes = fn();
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    printf("%-24s %8.0f ns/op %6zu bytes\n", name, (double) ns / BENCH_ITERATIONS, bytes);
+}
+
+int main() {
+    PushData data;
+    data.call_id = "2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10";
+    data.from_number = "+380441234567";
+    data.from_name = "Oleh Kovalenko";
+    data.direction = "inbound";
+    data.auto_answer = 0;
+    data.delay = 0;
+
+    PushTemplate fcm(PUSH_FCM_TEMPLATE, BENCH_TTL);
+    PushTemplate apn(PUSH_APN_TEMPLATE, BENCH_TTL);
+    std::string body;
+
+    printf("%d iterations, 3 FCM devices\n", BENCH_ITERATIONS);
+
+    bench("fcm concatenation", [&] {
+        body = "{"
+               "\"time_to_live\":" + std::to_string(BENCH_TTL) + ","
+               "\"data\":" + toJson(&data) + ","
+               "\"registration_ids\":[\"" + ReplaceAll(devices, "::", "\",\"") + "\"],"
+               "\"priority\":10}";
+        return body.size();
+    });
+
+    bench("fcm template", [&] {
+        fcm.Render(&data, devices, body);
+        return body.size();
+    });
+
+    bench("apn concatenation", [&] {
+        body = "{"
+               "\"aps\":" + toJson(&data) + ","
+               "\"priority\":10}";
+        return body.size();
+    });
+
+    bench("apn template", [&] {
+        apn.Render(&data, devices, body);
+        return body.size();
+    });
+
+    return 0;
+}
@@ -4,3 +4,23 @@
 
 #include "Call.h"
 
+bool BaseCallEvent::protobuf_ = false;
+
+void BaseCallEvent::firePayload() {
+    std::string raw;
+    if (!payload_->SerializeToString(&raw)) {
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_ERROR, "Couldn't serialize payload of %s\n", uuid_.c_str());
+        return;
+    }
+
+    if (raw.empty()) {
+        return;
+    }
+
+    switch_size_t len = ((raw.size() + 2) / 3) * 4 + 1;
+    auto b64 = (unsigned char *) malloc(len);
+    switch_b64_encode((unsigned char *) raw.data(), raw.size(), b64, len);
+    switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_DATA_FORMAT, DATA_FORMAT_PROTOBUF);
+    switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_DATA, (const char *) b64);
+    free(b64);
+}
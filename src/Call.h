@@ -11,6 +11,9 @@
 #include <ctime>
 #include <iostream>
 #include "utils.h"
+#include "CallEventStream.h"
+#include "EventIndex.h"
+#include "JsonWriter.h"
 
 extern "C" {
 #include <switch.h>
@@ -29,6 +32,8 @@ extern "C" {
 #define HEADER_NAME_TIMESTAMP "timestamp"
 #define HEADER_NAME_CC_NODE "cc_app_id"
 #define HEADER_NAME_DATA "data"
+#define HEADER_NAME_DATA_FORMAT "data_format"
+#define DATA_FORMAT_PROTOBUF "protobuf"
 
 #define CALL_MANAGER_NAME "CALL_MANAGER"
 #define VALET_PARK_NAME "valet_parking::info"
@@ -42,11 +47,19 @@ extern "C" {
 #define WBT_AMD_AI_LOG  "wbt_amd_ai_log"
 #define WBT_AMD_AI_ERROR  "wbt_amd_ai_error"
 #define WBT_AMD_AI_POSITIVE  "wbt_amd_ai_positive"
+#define WBT_AMD_AI_FRAMES  "wbt_amd_ai_frames"
+#define WBT_AMD_AI_DROPPED  "wbt_amd_ai_dropped"
+#define WBT_AMD_AI_LOCAL  "wbt_amd_ai_local"
+#define WBT_AMD_AI_PARTIAL  "wbt_amd_ai_partial"
+#define WBT_AMD_AI_CONFIDENCE  "wbt_amd_ai_confidence"
+#define WBT_AMD_AI_ELAPSED_MS  "wbt_amd_ai_elapsed_ms"
 #define WBT_EAVESDROP_STATE  "wbt_eavesdrop_state"
 
 #define get_str(c) c ? std::string(c) : std::string()
 
-enum CallActions { Ringing, Active, Bridge, Hold, DTMF, Voice, Silence, Execute, Update, JoinQueue, LeavingQueue, AMD, Hangup, Eavesdrop, Heartbeat };
+using mod_grpc::StrView;
+
+enum CallActions { Ringing, Active, Bridge, Hold, DTMF, Voice, Silence, Execute, Update, JoinQueue, LeavingQueue, AMD, Hangup, Eavesdrop, Heartbeat, HeartbeatBatch };
 
 //TODO
 static const char* callEventStr(CallActions e) {
@@ -81,6 +94,8 @@ static const char* callEventStr(CallActions e) {
             return "eavesdrop";
         case Heartbeat:
             return "heartbeat";
+        case HeartbeatBatch:
+            return "heartbeat_batch";
         default:
             return "unknown";
     }
@@ -88,96 +103,152 @@ static const char* callEventStr(CallActions e) {
 
 class CallEndpoint {
 public:
-    std::string type;
-    std::string id;
-    std::string name;
-    std::string number;
+    StrView type;
+    StrView id;
+    StrView name;
+    StrView number;
 };
 
 class BaseCallEvent {
 public:
-    std::string uuid_;
-    std::string node_;
-    std::string domain_id_;
-    std::string user_id_;
-    std::string cc_node_;
+    typedef fs::CallEventPayload Payload;
+
+    // views into the source event, valid while it lives
+    StrView uuid_;
+    StrView node_;
+    StrView domain_id_;
+    StrView user_id_;
+    StrView cc_node_;
 
-    explicit BaseCallEvent(CallActions action, switch_event_t *e) {
+    explicit BaseCallEvent(CallActions action, switch_event_t *e) : action_(action), index_(e) {
         if (switch_event_create_subclass(&out, SWITCH_EVENT_CLONE, EVENT_NAME) != SWITCH_STATUS_SUCCESS) {
             throw std::overflow_error("Couldn't create event\n");
         }
-        event_ = new Event(e);
+        event_ = new Event(&index_);
         e_ = e;
-        body_ = cJSON_CreateObject();
-        parent_ = switch_event_get_header(e_, "variable_wbt_parent_id");
+        // stream subscribers always get the typed payload
+        if (protobuf_ || mod_grpc::CallEventStream::HasSubscribers()) {
+            payload_ = new fs::CallEventPayload;
+        }
+        if (!protobuf_) {
+            body_ = &json_;
+        }
+        parent_ = index_.get(IDX_VAR_WBT_PARENT_ID);
 
-        uuid_ = get_str(switch_event_get_header(e, "Unique-ID"));
-        node_ = get_str(switch_event_get_header(e, "FreeSWITCH-Switchname"));
-        domain_id_ = get_str(switch_event_get_header(e, "variable_sip_h_X-Webitel-Domain-Id"));
-        user_id_ = get_str(switch_event_get_header(e, "variable_sip_h_X-Webitel-User-Id"));
-        cc_node_ = get_str(switch_event_get_header(e, "variable_cc_app_id"));
+        uuid_ = index_.get(IDX_UNIQUE_ID);
+        node_ = index_.get(IDX_FREESWITCH_SWITCHNAME);
+        domain_id_ = index_.get(IDX_VAR_SIP_H_X_WEBITEL_DOMAIN_ID);
+        user_id_ = index_.get(IDX_VAR_SIP_H_X_WEBITEL_USER_ID);
+        cc_node_ = index_.get(IDX_VAR_CC_APP_ID);
+
+        // e is only the first call of the batch
+        if (action == HeartbeatBatch) {
+            uuid_ = StrView();
+            user_id_ = StrView();
+            cc_node_ = StrView();
+        }
 
         if (!cc_node_.empty()) {
             switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_CC_NODE, cc_node_.c_str());
         }
 
         switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_EVENT, callEventStr(action));
-        switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_ID, uuid_.c_str());
+        if (action != HeartbeatBatch) {
+            switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_ID, uuid_.c_str());
+        }
         switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_NODE_NAME, node_.c_str());
         switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_DOMAIN_ID, domain_id_.c_str());
-        switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_TIMESTAMP, std::to_string(mod_grpc::unixTimestamp()).c_str());
+        timestamp_ = mod_grpc::unixTimestamp();
+        switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_TIMESTAMP, std::to_string(timestamp_).c_str());
 
         if (!user_id_.empty()) {
             switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_USER_ID, user_id_.c_str());
-            addAttribute(HEADER_NAME_USER_ID, static_cast<double>(std::stoi(user_id_)));
+            addAttribute(HEADER_NAME_USER_ID, static_cast<double>(atoi(user_id_.c_str())), &Payload::set_user_id);
         }
     }
 
     ~BaseCallEvent() {
         e_ = nullptr;
-        cJSON_Delete(body_);
+        delete payload_;
         switch_event_destroy(&out);
         delete event_;
     }
 
-    void addAttribute(const char *header, const std::string &val) {
-        cJSON_AddItemToObject(body_, header, cJSON_CreateString(val.c_str()));
+    // WEBITEL_CALL data is a base64 CallEventPayload instead of JSON
+    static void setProtobufFormat(bool enabled) {
+        protobuf_ = enabled;
     }
 
-    void addAttribute(const char *header, const char *val) {
-        cJSON_AddItemToObject(body_, header, cJSON_CreateString(val));
+    // JSON attribute, or the typed field of the payload: mutable_<name> of strings, set_<name> of scalars
+    void addAttribute(const char *header, const StrView &val, std::string *(Payload::*field)()) {
+        if (payload_) {
+            (payload_->*field)()->assign(val.data(), val.size());
+        }
+        if (body_) {
+            body_->addString(header, val.c_str());
+        }
     }
 
-    void addAttribute(const char *header, const bool &val) {
-        cJSON_AddItemToObject(body_, header, cJSON_CreateBool(val));
+    void addAttribute(const char *header, bool val, void (Payload::*field)(bool)) {
+        if (payload_) {
+            (payload_->*field)(val);
+        }
+        if (body_) {
+            body_->addBool(header, val);
+        }
     }
 
-    void addAttribute(const char *header, const double &number) {
-        cJSON_AddItemToObject(body_, header, cJSON_CreateNumber(number));
+    template <typename T>
+    void addAttribute(const char *header, double number, void (Payload::*field)(T)) {
+        if (payload_) {
+            (payload_->*field)(static_cast<T>(number));
+        }
+        if (body_) {
+            body_->addNumber(header, number);
+        }
     }
 
-    void addAttribute(const char *header, const int &number) {
-        cJSON_AddItemToObject(body_, header, cJSON_CreateNumber(number));
+    void addEndpoint(const char *header, CallEndpoint *e) {
+        if (payload_) {
+            auto ep = strcmp(header, "to") == 0 ? payload_->mutable_to() : payload_->mutable_from();
+            ep->set_type(e->type.c_str());
+            ep->set_number(e->number.c_str());
+            ep->set_name(e->name.c_str());
+            ep->set_id(e->id.c_str());
+        }
+        if (body_) {
+            toJson(body_, header, e);
+        }
     }
 
-    void addAttribute(const char *header, cJSON *attr) {
-        cJSON_AddItemToObject(body_, header, attr);
+    void addArrayValue(switch_event_header_t *e, const char *var_name,
+                       google::protobuf::RepeatedPtrField<std::string> *(Payload::*field)()) {
+        if (payload_) {
+            auto values = (payload_->*field)();
+            eachValue(e, [&](const char *val) { values->Add(val); });
+        }
+        if (body_) {
+            body_->beginArray(var_name);
+            eachValue(e, [&](const char *val) { body_->addString(nullptr, val); });
+            body_->endArray();
+        }
     }
 
-    void addArrayValue(switch_event_header_t *e, const char *var_name, bool number) {
-        cJSON *arr = cJSON_CreateArray();
-        if (e->idx) {
-            for (int i = 0; i < e->idx; i++) {
-                cJSON_AddItemToArray(arr, number ? cJSON_CreateNumber(std::atof(e->array[i])) : cJSON_CreateString(e->array[i]));
-            }
-        } else if (e->value) {
-            cJSON_AddItemToArray(arr, number ? cJSON_CreateNumber(std::atof(e->value)) : cJSON_CreateString(e->value));
+    void addArrayValue(switch_event_header_t *e, const char *var_name,
+                       google::protobuf::RepeatedField<int64_t> *(Payload::*field)()) {
+        if (payload_) {
+            auto values = (payload_->*field)();
+            eachValue(e, [&](const char *val) { values->Add(strtoll(val, nullptr, 10)); });
+        }
+        if (body_) {
+            body_->beginArray(var_name);
+            eachValue(e, [&](const char *val) { body_->addNumber(nullptr, std::atof(val)); });
+            body_->endArray();
         }
-        addAttribute(var_name, arr);
     }
 
-    void notifyEavesdropPartner(const std::string& type) {
-        auto agentCallId = event_->getVar("variable_wbt_eavesdrop_agent_id");
+    void notifyEavesdropPartner(const StrView &type) {
+        auto agentCallId = event_->getVar(IDX_VAR_WBT_EAVESDROP_AGENT_ID);
         if (!agentCallId.empty()) {
             switch_core_session_t *other_session;
             other_session = switch_core_session_locate(agentCallId.c_str());
@@ -199,37 +270,65 @@ public:
     }
 
     void fire() {
-        char *b = nullptr;
-        if (body_->child) {
-            b = cJSON_PrintUnformatted(body_);
+        const char *b = nullptr;
+        if (!body_) {
+            firePayload();
+        } else if (!body_->empty()) {
+            b = body_->finish();
             switch_event_add_header_string(out, SWITCH_STACK_BOTTOM, HEADER_NAME_DATA, b);
         }
+        if (payload_ && mod_grpc::CallEventStream::HasSubscribers()) {
+            publish(b);
+        }
 //        DUMP_EVENT(out)
         switch_event_fire(&out);
-        if (b) {
-            cJSON_free(b);
-        }
+    }
+
+    void publish(const char *data) {
+        fs::CallEvent msg;
+        msg.set_event(callEventStr(action_));
+        msg.set_id(uuid_.data(), uuid_.size());
+        msg.set_app_id(node_.data(), node_.size());
+        msg.set_domain_id(strtoll(domain_id_.c_str(), nullptr, 10));
+        msg.set_user_id(strtoll(user_id_.c_str(), nullptr, 10));
+        msg.set_cc_app_id(cc_node_.data(), cc_node_.size());
+        msg.set_timestamp(timestamp_);
+        if (data) {
+            msg.set_data(data);
+        }
+        if (payload_) {
+            *msg.mutable_payload() = *payload_;
+        }
+        mod_grpc::CallEventStream::Publish(msg);
     }
 
 protected:
     class Event {
     public:
-        explicit Event(switch_event_t *e) {
-            e_ = e;
+        explicit Event(mod_grpc::EventIndex *index) {
+            index_ = index;
         }
         ~Event() {
-            e_ = nullptr;
+            index_ = nullptr;
         }
-        inline std::string getVar(const char *name) {
-            return get_str(switch_event_get_header(e_, name));
+        inline StrView getVar(EventHeader h) {
+            return index_->get(h);
         }
 
     private:
-        switch_event_t *e_ = nullptr;
+        mod_grpc::EventIndex *index_ = nullptr;
     };
 
+    static bool protobuf_;
+
+    CallActions action_;
+    mod_grpc::EventIndex index_;
+    long int timestamp_ = 0;
     switch_event_t *out = nullptr;
-    cJSON *body_ = nullptr;
+    mod_grpc::JsonWriter json_;
+    mod_grpc::JsonWriter *body_ = nullptr;
+    fs::CallEventPayload *payload_ = nullptr;
+    std::vector<switch_event_header_t *> prefix_headers_;
     switch_event_t *e_ = nullptr;
     Event *event_ = nullptr;
     const char *parent_ = nullptr;
@@ -237,84 +336,122 @@ protected:
     struct Info {
         CallEndpoint *from = nullptr;
         CallEndpoint *to = nullptr;
-        std::string parent_id;
-        std::string direction;
+        StrView parent_id;
+        StrView direction;
         std::string destination;
     };
 
     struct OutboundCallParameters {
         bool Video;
         bool Screen;
-        std::string AutoAnswer;
+        StrView AutoAnswer;
         bool DisableStun;
     };
 
-    static cJSON* toJson(CallEndpoint *e) {
-        auto j = cJSON_CreateObject();
-        cJSON_AddItemToObject(j, "type", cJSON_CreateString(e->type.c_str()));
-        cJSON_AddItemToObject(j, "number", cJSON_CreateString(e->number.c_str()));
-        cJSON_AddItemToObject(j, "name", cJSON_CreateString(e->name.c_str()));
-        cJSON_AddItemToObject(j, "id", cJSON_CreateString(e->id.c_str()));
-        return j;
+    static void toJson(mod_grpc::JsonWriter *j, const char *key, CallEndpoint *e) {
+        j->beginObject(key);
+        j->addString("type", e->type.c_str());
+        j->addString("number", e->number.c_str());
+        j->addString("name", e->name.c_str());
+        j->addString("id", e->id.c_str());
+        j->endObject();
     }
 
-    static cJSON* toJson(OutboundCallParameters *e) {
-        auto j = cJSON_CreateObject();
-        cJSON_AddItemToObject(j, "video", e->Video ? cJSON_CreateTrue() : cJSON_CreateFalse());
-        cJSON_AddItemToObject(j, "screen", e->Screen ? cJSON_CreateTrue() : cJSON_CreateFalse());
+    static void toJson(mod_grpc::JsonWriter *j, const char *key, OutboundCallParameters *e) {
+        j->beginObject(key);
+        j->addBool("video", e->Video);
+        j->addBool("screen", e->Screen);
         if (!e->AutoAnswer.empty()) {
-            cJSON_AddItemToObject(j, "autoAnswer", cJSON_CreateString(e->AutoAnswer.c_str()));
+            j->addString("autoAnswer", e->AutoAnswer.c_str());
         }
-        cJSON_AddItemToObject(j, "disableStun", e->DisableStun ? cJSON_CreateTrue() : cJSON_CreateFalse());
-        return j;
+        j->addBool("disableStun", e->DisableStun);
+        j->endObject();
     }
 
-    static void setBodyCallInfo(cJSON *j, Info *info) {
-        cJSON_AddItemToObject(j, "direction", cJSON_CreateString(info->direction.c_str()));
-        cJSON_AddItemToObject(j, "destination", cJSON_CreateString(info->destination.c_str()));
+    void firePayload();
+
+    // items of an array header, or its value
+    template <typename F>
+    static void eachValue(switch_event_header_t *e, F fn) {
+        if (e->idx) {
+            for (int i = 0; i < e->idx; i++) {
+                fn(e->array[i]);
+            }
+        } else if (e->value) {
+            fn(e->value);
+        }
+    }
+
+    void setBodyCallInfo(mod_grpc::JsonWriter *j, Info *info) {
+        if (payload_) {
+            payload_->set_direction(info->direction.c_str());
+            payload_->set_destination(info->destination);
+            payload_->set_parent_id(info->parent_id.c_str());
+            if (info->from) {
+                addEndpoint("from", info->from);
+            }
+            if (info->to) {
+                addEndpoint("to", info->to);
+            }
+        }
+        if (!j) {
+            return;
+        }
+        j->addString("direction", info->direction.c_str());
+        j->addString("destination", info->destination.c_str());
         if (!info->parent_id.empty()) {
-            cJSON_AddItemToObject(j, "parent_id", cJSON_CreateString(info->parent_id.c_str()));
+            j->addString("parent_id", info->parent_id.c_str());
         }
         if (info->from) {
-            cJSON_AddItemToObject(j, "from", toJson(info->from));
+            toJson(j, "from", info->from);
         }
         if (info->to) {
-            cJSON_AddItemToObject(j, "to", toJson(info->to));
+            toJson(j, "to", info->to);
         }
     }
 
-    inline std::string eavesdropStateName() {
-        std::string tmp = event_->getVar("variable_" WBT_EAVESDROP_STATE);
+    inline StrView eavesdropStateName() {
+        auto tmp = event_->getVar(IDX_VAR_WBT_EAVESDROP_STATE);
         if (tmp.empty()) {
             tmp = "none";
         }
 
-        return std::move(tmp);
+        return tmp;
     }
 
-    void setEavesdrop(std::string &type) {
-        cJSON *cj;
-        cj = cJSON_CreateObject();
-        cJSON_AddItemToObject(cj, "type", cJSON_CreateString(type.c_str()));
+    void setEavesdrop(const StrView &type) {
+        if (payload_) {
+            auto ev = payload_->mutable_eavesdrop();
+            ev->set_type(type.c_str());
+            ev->set_name(event_->getVar(IDX_VAR_WBT_EAVESDROP_NAME).c_str());
+            ev->set_number(event_->getVar(IDX_VAR_WBT_EAVESDROP_NUMBER).c_str());
+            ev->set_duration(atoi(event_->getVar(IDX_VAR_WBT_EAVESDROP_DURATION).c_str()));
+            ev->set_state(eavesdropStateName().c_str());
+        }
+        if (!body_) {
+            return;
+        }
+        body_->beginObject("eavesdrop");
+        body_->addString("type", type.c_str());
 
-        auto tmp = event_->getVar("variable_wbt_eavesdrop_name");
+        auto tmp = event_->getVar(IDX_VAR_WBT_EAVESDROP_NAME);
         if (!tmp.empty()) {
-            cJSON_AddItemToObject(cj, "name", cJSON_CreateString(tmp.c_str()));
+            body_->addString("name", tmp.c_str());
         }
 
-        tmp = event_->getVar("variable_wbt_eavesdrop_number");
+        tmp = event_->getVar(IDX_VAR_WBT_EAVESDROP_NUMBER);
         if (!tmp.empty()) {
-            cJSON_AddItemToObject(cj, "number", cJSON_CreateString(tmp.c_str()));
+            body_->addString("number", tmp.c_str());
         }
 
-        tmp = event_->getVar("variable_wbt_eavesdrop_duration");
+        tmp = event_->getVar(IDX_VAR_WBT_EAVESDROP_DURATION);
         if (!tmp.empty()) {
-            cJSON_AddItemToObject(cj, "duration", cJSON_CreateNumber(std::stoi(tmp)));
+            body_->addNumber("duration", atoi(tmp.c_str()));
         }
 
         tmp = eavesdropStateName();
-        cJSON_AddItemToObject(cj, "state", cJSON_CreateString(tmp.c_str()));
-        addAttribute("eavesdrop", cj);
+        body_->addString("state", tmp.c_str());
+        body_->endObject();
         /*
          {
           "id": "85b9366a-4c2f-45b0-bcea-06a38fe4be37",
@@ -325,158 +462,166 @@ protected:
          */
     }
 
-    static void setCallParameters(cJSON *j, OutboundCallParameters *params) {
-        cJSON_AddItemToObject(j, "params", toJson(params));
+    void setCallParameters(mod_grpc::JsonWriter *j, OutboundCallParameters *params) {
+        if (payload_) {
+            auto p = payload_->mutable_params();
+            p->set_video(params->Video);
+            p->set_screen(params->Screen);
+            p->set_autoanswer(params->AutoAnswer.c_str());
+            p->set_disablestun(params->DisableStun);
+        }
+        if (j) {
+            toJson(j, "params", params);
+        }
     }
 
-    inline std::string getDestination() {
-        std::string res = event_->getVar("Channel-Destination-Number");
+    inline StrView getDestination() {
+        auto res = event_->getVar(IDX_CHANNEL_DESTINATION_NUMBER);
         if (!res.empty()) {
             return res;
         }
 
-        res = event_->getVar("Caller-Destination-Number");
+        res = event_->getVar(IDX_CALLER_DESTINATION_NUMBER);
         if (!res.empty()) {
             return res;
         }
 
-        res = event_->getVar("variable_destination_number");
+        res = event_->getVar(IDX_VAR_DESTINATION_NUMBER);
         return res;
     }
 
     OutboundCallParameters getCallParams() {
         auto params = OutboundCallParameters();
-        params.Video = event_->getVar("variable_wbt_video") == "true";
-        params.Screen = event_->getVar("variable_wbt_screen") == "true";
-        params.AutoAnswer = event_->getVar("variable_wbt_auto_answer");
-        params.DisableStun = event_->getVar("variable_wbt_disable_stun") == "true";
+        params.Video = event_->getVar(IDX_VAR_WBT_VIDEO) == "true";
+        params.Screen = event_->getVar(IDX_VAR_WBT_SCREEN) == "true";
+        params.AutoAnswer = event_->getVar(IDX_VAR_WBT_AUTO_ANSWER);
+        params.DisableStun = event_->getVar(IDX_VAR_WBT_DISABLE_STUN) == "true";
         return params;
     }
 
     bool isOriginateRequest() {
-        return !event_->getVar("variable_sip_h_X-Webitel-Display-Direction").empty();
+        return !event_->getVar(IDX_VAR_SIP_H_X_WEBITEL_DISPLAY_DIRECTION).empty();
     }
 
     void initContact() {
-        if (event_->getVar("variable_wbt_hide_contact") == "true") {
-            addAttribute("hide_contact", true);
+        if (event_->getVar(IDX_VAR_WBT_HIDE_CONTACT) == "true") {
+            addAttribute("hide_contact", true, &Payload::set_hide_contact);
         }
 
-        auto contact = event_->getVar("variable_wbt_contact_id");
+        auto contact = event_->getVar(IDX_VAR_WBT_CONTACT_ID);
         if (!contact.empty()){
-            addAttribute("contact_id", std::stoi( contact ));
+            addAttribute("contact_id", atoi(contact.c_str()), &Payload::set_contact_id);
         }
     }
 
     Info getCallInfo() {
         auto info = Info();
         if (parent_) {
-            info.parent_id = std::string(parent_);
+            info.parent_id = parent_;
         }
 
-        info.direction = event_->getVar("variable_sip_h_X-Webitel-Direction");
-        auto logicalDirection = event_->getVar("Call-Direction");
+        info.direction = event_->getVar(IDX_VAR_SIP_H_X_WEBITEL_DIRECTION);
+        auto logicalDirection = event_->getVar(IDX_CALL_DIRECTION);
         auto isOriginate = isOriginateRequest();
 
         if (info.direction == "internal" ){
             info.direction = logicalDirection == "outbound" && !isOriginate ? "inbound" : "outbound";
         }
 
-        char *destination = nullptr;
         if (isOriginate) {
-            destination = strdup(event_->getVar("variable_effective_callee_id_number").data());
+            info.destination = event_->getVar(IDX_VAR_EFFECTIVE_CALLEE_ID_NUMBER).str();
         } else {
-            destination = strdup(getDestination().data());
+            info.destination = getDestination().str();
         }
-        switch_url_decode(destination);
-        info.destination = std::string(destination);
-        delete destination;
+        // decode in place, the result is never longer; switch_url_decode returns the end, not the start
+        switch_url_decode(&info.destination[0]);
+        info.destination.resize(strlen(info.destination.c_str()));
 
-        auto gateway = event_->getVar("variable_sip_h_X-Webitel-Gateway-Id");
-        auto user = event_->getVar("variable_sip_h_X-Webitel-User-Id");
+        auto gateway = event_->getVar(IDX_VAR_SIP_H_X_WEBITEL_GATEWAY_ID);
+        auto user = event_->getVar(IDX_VAR_SIP_H_X_WEBITEL_USER_ID);
         info.from = new CallEndpoint;
 
         if (!cc_node_.empty()) {
-            info.from->id = event_->getVar("variable_wbt_from_id");
-            info.from->number = event_->getVar("variable_wbt_from_number");
-            info.from->name = event_->getVar("variable_wbt_from_name");
-            info.from->type = event_->getVar("variable_wbt_from_type");
+            info.from->id = event_->getVar(IDX_VAR_WBT_FROM_ID);
+            info.from->number = event_->getVar(IDX_VAR_WBT_FROM_NUMBER);
+            info.from->name = event_->getVar(IDX_VAR_WBT_FROM_NAME);
+            info.from->type = event_->getVar(IDX_VAR_WBT_FROM_TYPE);
 
             if (!gateway.empty()) {
-                addAttribute(HEADER_NAME_GATEWAY_ID, static_cast<double>(std::stoi(gateway)));
+                addAttribute(HEADER_NAME_GATEWAY_ID, static_cast<double>(atoi(gateway.c_str())), &Payload::set_gateway_id);
             }
 
-            auto toType = event_->getVar("variable_wbt_to_type");
+            auto toType = event_->getVar(IDX_VAR_WBT_TO_TYPE);
             if (!toType.empty()) {
                 info.to = new CallEndpoint;
-                info.to->id = event_->getVar("variable_wbt_to_id");
-                info.to->name = event_->getVar("variable_wbt_to_name");
-                info.to->number = event_->getVar("variable_wbt_to_number");
+                info.to->id = event_->getVar(IDX_VAR_WBT_TO_ID);
+                info.to->name = event_->getVar(IDX_VAR_WBT_TO_NAME);
+                info.to->number = event_->getVar(IDX_VAR_WBT_TO_NUMBER);
                 info.to->type = toType;
             }
         } else if ( !gateway.empty() && user.empty()) {
-            addAttribute(HEADER_NAME_GATEWAY_ID, static_cast<double>(std::stoi(gateway)));
+            addAttribute(HEADER_NAME_GATEWAY_ID, static_cast<double>(atoi(gateway.c_str())), &Payload::set_gateway_id);
             if (info.direction == "inbound") {
                 info.from->type = "dest";
-                info.from->name = event_->getVar("Caller-Caller-ID-Name");
-                info.from->number = event_->getVar("Caller-Caller-ID-Number");
+                info.from->name = event_->getVar(IDX_CALLER_CALLER_ID_NAME);
+                info.from->number = event_->getVar(IDX_CALLER_CALLER_ID_NUMBER);
 
 //                info.to = new CallEndpoint;
 //                info.to->type = "gateway";
 //                info.to->id = gateway;
-//                info.to->name = event_->getVar("variable_sip_h_X-Webitel-Gateway");
-//                info.to->number = event_->getVar("Caller-Caller-ID-Number");
+//                info.to->name = event_->getVar(IDX_VAR_SIP_H_X_WEBITEL_GATEWAY);
+//                info.to->number = event_->getVar(IDX_CALLER_CALLER_ID_NUMBER);
             } else {
-                info.from->id = event_->getVar("variable_wbt_from_id");
-                info.from->number = event_->getVar("variable_wbt_from_number");
-                info.from->name = event_->getVar("variable_wbt_from_name");
-                info.from->type = event_->getVar("variable_wbt_from_type");
+                info.from->id = event_->getVar(IDX_VAR_WBT_FROM_ID);
+                info.from->number = event_->getVar(IDX_VAR_WBT_FROM_NUMBER);
+                info.from->name = event_->getVar(IDX_VAR_WBT_FROM_NAME);
+                info.from->type = event_->getVar(IDX_VAR_WBT_FROM_TYPE);
 
-                auto toType = event_->getVar("variable_wbt_to_type");
+                auto toType = event_->getVar(IDX_VAR_WBT_TO_TYPE);
                 if (!toType.empty()) {
                     info.to = new CallEndpoint;
-                    info.to->id = event_->getVar("variable_wbt_to_id");
-                    info.to->name = event_->getVar("variable_wbt_to_name");
-                    info.to->number = event_->getVar("variable_wbt_to_number");
+                    info.to->id = event_->getVar(IDX_VAR_WBT_TO_ID);
+                    info.to->name = event_->getVar(IDX_VAR_WBT_TO_NAME);
+                    info.to->number = event_->getVar(IDX_VAR_WBT_TO_NUMBER);
                     info.to->type = toType;
                 }
             }
         } else if (!user.empty()) {
             if (info.direction == "inbound") {
-                info.destination = event_->getVar("variable_wbt_destination");
-                info.from->type = event_->getVar("variable_wbt_from_type");
-                info.from->id = event_->getVar("variable_wbt_from_id");
-                info.from->number = event_->getVar("Other-Leg-Caller-ID-Number");
-                info.from->name = event_->getVar("Other-Leg-Caller-ID-Name");
+                info.destination = event_->getVar(IDX_VAR_WBT_DESTINATION).str();
+                info.from->type = event_->getVar(IDX_VAR_WBT_FROM_TYPE);
+                info.from->id = event_->getVar(IDX_VAR_WBT_FROM_ID);
+                info.from->number = event_->getVar(IDX_OTHER_LEG_CALLER_ID_NUMBER);
+                info.from->name = event_->getVar(IDX_OTHER_LEG_CALLER_ID_NAME);
                 if (info.from->number.empty()) {
-                    info.from->number = event_->getVar("variable_wbt_from_number");
+                    info.from->number = event_->getVar(IDX_VAR_WBT_FROM_NUMBER);
                 }
                 if (info.from->name.empty()) {
-                    info.from->name = event_->getVar("variable_wbt_from_name");
+                    info.from->name = event_->getVar(IDX_VAR_WBT_FROM_NAME);
                 }
 
                 info.to = new CallEndpoint;
                 info.to->type = "user";
                 info.to->id = user;
-                info.to->name = event_->getVar("variable_wbt_to_name");
-                info.to->number = event_->getVar("variable_wbt_to_number");
+                info.to->name = event_->getVar(IDX_VAR_WBT_TO_NAME);
+                info.to->number = event_->getVar(IDX_VAR_WBT_TO_NUMBER);
             } else {
                 info.from->type = "user";
                 info.from->id = user;
                 if (isOriginate) {
-                    info.from->number = event_->getVar("variable_effective_caller_id_number");
-                    info.from->name = event_->getVar("variable_effective_caller_id_name");
+                    info.from->number = event_->getVar(IDX_VAR_EFFECTIVE_CALLER_ID_NUMBER);
+                    info.from->name = event_->getVar(IDX_VAR_EFFECTIVE_CALLER_ID_NAME);
                 } else {
-                    info.from->number = event_->getVar("Caller-Caller-ID-Number");
-                    info.from->name = event_->getVar("Caller-Caller-ID-Name");
+                    info.from->number = event_->getVar(IDX_CALLER_CALLER_ID_NUMBER);
+                    info.from->name = event_->getVar(IDX_CALLER_CALLER_ID_NAME);
                 }
 
-                auto toType = event_->getVar("variable_wbt_to_type");
+                auto toType = event_->getVar(IDX_VAR_WBT_TO_TYPE);
                 if (!toType.empty()) {
                     info.to = new CallEndpoint;
-                    info.to->id = event_->getVar("variable_wbt_to_id");
-                    info.to->name = event_->getVar("variable_wbt_to_name");
-                    info.to->number = event_->getVar("variable_wbt_to_number");
+                    info.to->id = event_->getVar(IDX_VAR_WBT_TO_ID);
+                    info.to->name = event_->getVar(IDX_VAR_WBT_TO_NAME);
+                    info.to->number = event_->getVar(IDX_VAR_WBT_TO_NUMBER);
                     info.to->type = toType;
                 }
             }
@@ -484,25 +629,43 @@ protected:
             // TODO from site
             info.from->type = "";
             info.from->id = "";
-            info.from->number = event_->getVar("Caller-Caller-ID-Number");
-            info.from->name = event_->getVar("Caller-Caller-ID-Name");
+            info.from->number = event_->getVar(IDX_CALLER_CALLER_ID_NUMBER);
+            info.from->name = event_->getVar(IDX_CALLER_CALLER_ID_NAME);
         }
 
         return info;
     }
 
     void setOnCreateAttr() {
-        addIfExists(body_, "sip_id", "variable_sip_h_X-Webitel-Uuid");
-        auto grantee = get_str(switch_event_get_header(e_, "variable_wbt_grantee_id"));
-        if (!grantee.empty()) {
-            addAttribute("grantee_id", std::stoi( grantee ));
+        addIfExists(body_, "sip_id", IDX_VAR_SIP_H_X_WEBITEL_UUID, &Payload::mutable_sip_id);
+        auto grantee = index_.get(IDX_VAR_WBT_GRANTEE_ID);
+        if (!zstr(grantee)) {
+            addAttribute("grantee_id", atoi(grantee), &Payload::set_grantee_id);
         }
     }
 
-    void addIfExists(cJSON *cj, const char *name, const char *varName ) {
-        auto tmp = get_str(switch_event_get_header(e_, varName));
-        if (!tmp.empty()) {
-            cJSON_AddItemToObject(cj, name, cJSON_CreateString(tmp.c_str()));
+    void addIfExists(mod_grpc::JsonWriter *j, const char *name, EventHeader var, std::string *(Payload::*field)()) {
+        auto tmp = index_.get(var);
+        if (!zstr(tmp)) {
+            if (payload_) {
+                (payload_->*field)()->assign(tmp);
+            }
+            if (j) {
+                j->addString(name, tmp);
+            }
+        }
+    }
+
+    // a string in JSON, switch_true of it in the payload
+    void addIfExists(mod_grpc::JsonWriter *j, const char *name, EventHeader var, void (Payload::*field)(bool)) {
+        auto tmp = index_.get(var);
+        if (!zstr(tmp)) {
+            if (payload_) {
+                (payload_->*field)(switch_true(tmp));
+            }
+            if (j) {
+                j->addString(name, tmp);
+            }
         }
     }
 
@@ -511,82 +674,76 @@ protected:
     }
 
     void set_queue_data(switch_event_t *event) {
-        switch_event_header_t *hp;
-        cJSON *cj;
-        bool found(false);
-
-        cj = cJSON_CreateObject();
+        if (payload_) {
+            setPayloadVariables("variable_cc_", payload_->mutable_queue(), event);
+        }
+        if (body_) {
+            writeVariables("variable_cc_", "queue", event);
+        }
+    }
 
-        for (hp = event->headers; hp; hp = hp->next) {
+    // object of the prefix headers without the prefix, nothing if there are no headers
+    void writeVariables(const char *pref, const char *fieldName, switch_event_t *event) {
+        const size_t len = strlen(pref);
+        bool found(false);
 
-            if (!prefix("variable_cc_", hp->name) ) {
-                continue;
+        for (auto hp : headersByPrefix(pref, event)) {
+            if (!found) {
+                body_->beginObject(fieldName);
+                found = true;
             }
-            found = true;
 
-            auto name = std::string(hp->name);
-            name = name.substr(12, name.length());
+            auto name = hp->name + len;
 
             if (hp->idx) {
-                cJSON *a = cJSON_CreateArray();
                 int i;
 
+                body_->beginArray(name);
                 for(i = 0; i < hp->idx; i++) {
-                    cJSON_AddItemToArray(a, cJSON_CreateString(hp->array[i]));
+                    body_->addString(nullptr, hp->array[i]);
                 }
-
-                cJSON_AddItemToObject(cj, name.c_str(), a);
+                body_->endArray();
 
             } else {
-                cJSON_AddItemToObject(cj, name.c_str(), cJSON_CreateString(hp->value));
+                body_->addString(name, hp->value);
             }
         }
 
         if (found) {
-            addAttribute("queue", cj);
+            body_->endObject();
         }
     }
 
-    void setVariables (const char *pref, const char *fieldName, switch_event_t *event) {
-        switch_event_header_t *hp;
-        cJSON *cj;
+    void setPayloadVariables(const char *pref, google::protobuf::Map<std::string, std::string> *m, switch_event_t *event) {
         const size_t len = strlen(pref);
-        bool found(false);
-
-        cj = cJSON_CreateObject();
-
-        for (hp = event->headers; hp; hp = hp->next) {
-
-            if (!prefix(pref, hp->name) ) {
-                continue;
-            }
-            found = true;
-
-            auto name = std::string(hp->name);
-            name = name.substr(len, name.length());
-
-            if (hp->idx) {
-                cJSON *a = cJSON_CreateArray();
-                int i;
-
-                for(i = 0; i < hp->idx; i++) {
-                    cJSON_AddItemToArray(a, cJSON_CreateString(hp->array[i]));
-                }
+        for (auto hp : headersByPrefix(pref, event)) {
+            (*m)[hp->name + len] = hp->value ? hp->value : "";
+        }
+    }
 
-                cJSON_AddItemToObject(cj, name.c_str(), a);
+    // headers of the prefix: from the index for the source event, otherwise a walk of the list
+    const std::vector<switch_event_header_t *> &headersByPrefix(const char *pref, switch_event_t *event) {
+        auto group = event == e_ ? index_.group(pref) : nullptr;
+        if (group) {
+            return *group;
+        }
 
-            } else {
-                cJSON_AddItemToObject(cj, name.c_str(), cJSON_CreateString(hp->value));
+        prefix_headers_.clear();
+        for (auto hp = event->headers; hp; hp = hp->next) {
+            if (prefix(pref, hp->name)) {
+                prefix_headers_.push_back(hp);
             }
         }
+        return prefix_headers_;
+    }
 
-        if (found) {
-            addAttribute(fieldName, cj);
-            cj = nullptr;
-        } else {
-            cJSON_Delete(cj);
+    void setVariables (const char *pref, const char *fieldName, switch_event_t *event) {
+        if (payload_) {
+            setPayloadVariables(pref, strcmp(fieldName, "queue") == 0 ? payload_->mutable_queue() : payload_->mutable_payload(), event);
+        }
+        if (body_) {
+            writeVariables(pref, fieldName, event);
         }
-
     }
 };
 
@@ -600,23 +757,23 @@ template <> class CallEvent<Ringing> : public BaseCallEvent {
 public:
     explicit CallEvent(switch_event_t *e) : BaseCallEvent(Ringing, e) {
         setOnCreateAttr();
-        if (event_->getVar("variable_wbt_hide_number") == "true") {
-            addAttribute("hideNumber", true);
+        if (event_->getVar(IDX_VAR_WBT_HIDE_NUMBER) == "true") {
+            addAttribute("hideNumber", true, &Payload::set_hidenumber);
         }
-        if (event_->getVar("variable_wbt_originate") == "true") {
-            addAttribute("originate", true);
+        if (event_->getVar(IDX_VAR_WBT_ORIGINATE) == "true") {
+            addAttribute("originate", true, &Payload::set_originate);
         }
 
-        auto wbt_heartbeat = event_->getVar("variable_wbt_heartbeat");
+        auto wbt_heartbeat = event_->getVar(IDX_VAR_WBT_HEARTBEAT);
         if (!wbt_heartbeat.empty()) {
             int sec = 0;
             sscanf( wbt_heartbeat.c_str(), "%d", &sec );
             if (sec) {
-                addAttribute("heartbeat", sec);
+                addAttribute("heartbeat", sec, &Payload::set_heartbeat);
             }
         }
         auto info = getCallInfo();
-        auto eavesdrop = event_->getVar("variable_wbt_eavesdrop_type");
+        auto eavesdrop = event_->getVar(IDX_VAR_WBT_EAVESDROP_TYPE);
         if (!eavesdrop.empty()) {
             setEavesdrop(eavesdrop);
         }
@@ -629,10 +786,19 @@ public:
 
         setVariables("variable_usr_", "payload", e_);
 
-        if ( auto t = switch_event_get_header(e, "variable_usr_wbt_ivr_log")) {
-            auto j = cJSON_Parse(t);
-            if (j) {
-                cJSON_AddItemToObject(body_, "ivr", j);
+        if ( auto t = index_.get(IDX_VAR_USR_WBT_IVR_LOG)) {
+            if (payload_) {
+                payload_->set_ivr(t);
+            }
+            cJSON *j = nullptr;
+            if (body_ && (j = cJSON_Parse(t))) {
+                // reprint to keep the log normalized as before
+                auto ivr = cJSON_PrintUnformatted(j);
+                if (ivr) {
+                    body_->addRaw("ivr", ivr);
+                    cJSON_free(ivr);
+                }
+                cJSON_Delete(j);
             }
         }
 
@@ -652,7 +818,7 @@ public:
 template <> class CallEvent<Active> : public BaseCallEvent {
 public:
     explicit CallEvent(switch_event_t *e) : BaseCallEvent(Active, e) {
-        auto eavesdrop = event_->getVar("variable_wbt_eavesdrop_type");
+        auto eavesdrop = event_->getVar(IDX_VAR_WBT_EAVESDROP_TYPE);
         if (!eavesdrop.empty()) {
             notifyEavesdropPartner("joined");
         }
@@ -662,11 +828,11 @@ public:
 template <> class CallEvent<Bridge> : public BaseCallEvent {
 public:
     explicit CallEvent(switch_event_t *e) : BaseCallEvent(Bridge, e) {
-        auto direction = event_->getVar("variable_sip_h_X-Webitel-Direction");
-        auto logicalDirection = event_->getVar("Call-Direction");
-        auto signalBond = event_->getVar("variable_signal_bond");
+        auto direction = event_->getVar(IDX_VAR_SIP_H_X_WEBITEL_DIRECTION);
+        auto logicalDirection = event_->getVar(IDX_CALL_DIRECTION);
+        auto signalBond = event_->getVar(IDX_VAR_SIGNAL_BOND);
         if (signalBond.empty()) {
-            signalBond = event_->getVar("Other-Leg-Unique-ID");
+            signalBond = event_->getVar(IDX_OTHER_LEG_UNIQUE_ID);
         }
 
         if (direction == "internal" ){
@@ -680,28 +846,28 @@ public:
 //        DUMP_EVENT(e);
 
 //        auto to = new CallEndpoint;
-//        to->number = event_->getVar("Caller-Callee-ID-Number");
-//        to->name = event_->getVar("Caller-Callee-ID-Name");
+//        to->number = event_->getVar(IDX_CALLER_CALLEE_ID_NUMBER);
+//        to->name = event_->getVar(IDX_CALLER_CALLEE_ID_NAME);
         auto to = new CallEndpoint;
         if (signalBond == uuid_ ) {
-            to->number = event_->getVar("Caller-Caller-ID-Number");
-            to->name = event_->getVar("Caller-Caller-ID-Name");
+            to->number = event_->getVar(IDX_CALLER_CALLER_ID_NUMBER);
+            to->name = event_->getVar(IDX_CALLER_CALLER_ID_NAME);
         } else {
-            to->number = event_->getVar("Caller-Callee-ID-Number");
-            to->name = event_->getVar("Caller-Callee-ID-Name");
+            to->number = event_->getVar(IDX_CALLER_CALLEE_ID_NUMBER);
+            to->name = event_->getVar(IDX_CALLER_CALLEE_ID_NAME);
         }
 
-        if (event_->getVar("variable_wbt_hide_number") == "true") {
-            addAttribute("hideNumber", true);
+        if (event_->getVar(IDX_VAR_WBT_HIDE_NUMBER) == "true") {
+            addAttribute("hideNumber", true, &Payload::set_hidenumber);
         }
 
-        addAttribute("to", toJson(to));
+        addEndpoint("to", to);
         //todo
         delete to;
-        addAttribute("direction", direction.c_str());
+        addAttribute("direction", direction, &Payload::mutable_direction);
 
         if (!signalBond.empty()) {
-            addAttribute("bridged_id", signalBond);
+            addAttribute("bridged_id", signalBond, &Payload::mutable_bridged_id);
         }
     };
 };
@@ -730,120 +896,120 @@ public:
 template <> class CallEvent<DTMF> : public BaseCallEvent {
 public:
     explicit CallEvent(switch_event_t *e) : BaseCallEvent(DTMF, e) {
-        auto digit =  get_str(switch_event_get_header(e, "DTMF-Digit"));
-        addAttribute(HEADER_NAME_DTMF_DIGIT, digit);
+        StrView digit = index_.get(IDX_DTMF_DIGIT);
+        addAttribute(HEADER_NAME_DTMF_DIGIT, digit, &Payload::mutable_digit);
     };
 };
 
 template <> class CallEvent<Update> : public BaseCallEvent {
 public:
     explicit CallEvent(switch_event_t *e) : BaseCallEvent(Update, e) {
-        std::cout << "Update" << this->uuid_ << std::endl;
+        std::cout << "Update" << this->uuid_.c_str() << std::endl;
     };
 };
 
 template <> class CallEvent<Hangup> : public BaseCallEvent {
 public:
     explicit CallEvent(switch_event_t *e) : BaseCallEvent(Hangup, e) {
-        auto cause_ = get_str(switch_event_get_header(e, "variable_hangup_cause"));
-        auto sip_code_ = get_str(switch_event_get_header(e, "variable_proto_specific_hangup_cause"));
-        auto cc_reporting_at_ = switch_event_get_header(e, "variable_cc_reporting_at");
-        auto hangup_by = get_str(switch_event_get_header(e, "variable_sip_hangup_disposition"));
-        auto wbt_transfer_to = get_str(switch_event_get_header(e, "variable_wbt_transfer_to"));
-        auto wbt_transfer_from = get_str(switch_event_get_header(e, "variable_wbt_transfer_from"));
-        auto wbt_transfer_to_agent = get_str(switch_event_get_header(e, "variable_wbt_transfer_to_agent"));
-        auto wbt_transfer_from_attempt = get_str(switch_event_get_header(e, "variable_wbt_transfer_from_attempt"));
-        auto wbt_transfer_to_attempt = get_str(switch_event_get_header(e, "variable_wbt_transfer_to_attempt"));
-        auto wbt_talk_sec = get_str(switch_event_get_header(e, "variable_wbt_talk_sec"));
-        auto wbt_amd = get_str(switch_event_get_header(e, "variable_"  WBT_AMD_AI));
-        auto skip_cdr = switch_false(switch_event_get_header(e, "variable_" SKIP_EVENT_VARIABLE));
-        auto sip_hangup_phrase = get_str(switch_event_get_header(e, "variable_sip_hangup_phrase"));
+        StrView cause_ = index_.get(IDX_VAR_HANGUP_CAUSE);
+        StrView sip_code_ = index_.get(IDX_VAR_PROTO_SPECIFIC_HANGUP_CAUSE);
+        auto cc_reporting_at_ = index_.get(IDX_VAR_CC_REPORTING_AT);
+        StrView hangup_by = index_.get(IDX_VAR_SIP_HANGUP_DISPOSITION);
+        StrView wbt_transfer_to = index_.get(IDX_VAR_WBT_TRANSFER_TO);
+        StrView wbt_transfer_from = index_.get(IDX_VAR_WBT_TRANSFER_FROM);
+        StrView wbt_transfer_to_agent = index_.get(IDX_VAR_WBT_TRANSFER_TO_AGENT);
+        StrView wbt_transfer_from_attempt = index_.get(IDX_VAR_WBT_TRANSFER_FROM_ATTEMPT);
+        StrView wbt_transfer_to_attempt = index_.get(IDX_VAR_WBT_TRANSFER_TO_ATTEMPT);
+        StrView wbt_talk_sec = index_.get(IDX_VAR_WBT_TALK_SEC);
+        StrView wbt_amd = index_.get(IDX_VAR_WBT_AMD_AI);
+        auto skip_cdr = switch_false(index_.get(IDX_VAR_PROCESS_CDR));
+        StrView sip_hangup_phrase = index_.get(IDX_VAR_SIP_HANGUP_PHRASE);
         if (sip_hangup_phrase.empty()) {
-            sip_hangup_phrase = get_str(switch_event_get_header(e, "variable_sip_invite_failure_phrase"));
+            sip_hangup_phrase = index_.get(IDX_VAR_SIP_INVITE_FAILURE_PHRASE);
         }
 
-        auto eavesdrop = event_->getVar("variable_wbt_eavesdrop_type");
+        auto eavesdrop = event_->getVar(IDX_VAR_WBT_EAVESDROP_TYPE);
         if (!eavesdrop.empty()) {
             notifyEavesdropPartner("leave");
         }
 
 //        DUMP_EVENT(e);
         if (skip_cdr) {
-            addAttribute("cdr", false);
+            addAttribute("cdr", false, &Payload::set_cdr);
         }
 
-        if (event_->getVar("variable_wbt_notification_hangup") == "true") {
-            addAttribute("notification_hangup", true);
+        if (event_->getVar(IDX_VAR_WBT_NOTIFICATION_HANGUP) == "true") {
+            addAttribute("notification_hangup", true, &Payload::set_notification_hangup);
         }
 
-        addIfExists(body_, "amd_result", "variable_amd_result");
-        addIfExists(body_, "amd_cause", "variable_amd_cause");
+        addIfExists(body_, "amd_result", IDX_VAR_AMD_RESULT, &Payload::mutable_amd_result);
+        addIfExists(body_, "amd_cause", IDX_VAR_AMD_CAUSE, &Payload::mutable_amd_cause);
         initContact();
 
-        auto record_seconds = get_str(switch_event_get_header(e, "variable_record_seconds"));
+        StrView record_seconds = index_.get(IDX_VAR_RECORD_SECONDS);
         if (!record_seconds.empty() && record_seconds != "0") {
-            auto record_start = get_str(switch_event_get_header(e, "variable_wbt_start_record"));
+            StrView record_start = index_.get(IDX_VAR_WBT_START_RECORD);
             if (!record_start.empty()) {
-                if (switch_true(switch_event_get_header(e, "variable_media_bug_answer_req"))) {
-                    auto br = get_str(switch_event_get_header(e, "variable_bridge_epoch"));
+                if (switch_true(index_.get(IDX_VAR_MEDIA_BUG_ANSWER_REQ))) {
+                    StrView br = index_.get(IDX_VAR_BRIDGE_EPOCH);
                     if (!br.empty()) {
-                        addAttribute("record_start", br + "000");
+                        addAttribute("record_start", br.str() + "000", &Payload::mutable_record_start);
                     }
                 } else {
-                    addIfExists(body_, "record_start", "variable_wbt_start_record");
+                    addIfExists(body_, "record_start", IDX_VAR_WBT_START_RECORD, &Payload::mutable_record_start);
                 }
-                addIfExists(body_, "record_stop", "variable_wbt_stop_record");
+                addIfExists(body_, "record_stop", IDX_VAR_WBT_STOP_RECORD, &Payload::mutable_record_stop);
             }
         }
 
         if (!wbt_transfer_to.empty()) {
-            addAttribute("transfer_to", wbt_transfer_to);
+            addAttribute("transfer_to", wbt_transfer_to, &Payload::mutable_transfer_to);
         }
         if (!wbt_transfer_from.empty()) {
-            addAttribute("transfer_from", wbt_transfer_from);
+            addAttribute("transfer_from", wbt_transfer_from, &Payload::mutable_transfer_from);
         }
         if (!wbt_transfer_to_agent.empty()) {
-            addAttribute("transfer_to_agent", wbt_transfer_to_agent);
+            addAttribute("transfer_to_agent", wbt_transfer_to_agent, &Payload::mutable_transfer_to_agent);
         }
         if (!wbt_transfer_from_attempt.empty()) {
-            addAttribute("transfer_from_attempt", wbt_transfer_from_attempt);
+            addAttribute("transfer_from_attempt", wbt_transfer_from_attempt, &Payload::mutable_transfer_from_attempt);
         }
         if (!wbt_transfer_to_attempt.empty()) {
-            addAttribute("transfer_to_attempt", wbt_transfer_to_attempt);
+            addAttribute("transfer_to_attempt", wbt_transfer_to_attempt, &Payload::mutable_transfer_to_attempt);
         }
         if (!wbt_talk_sec.empty()) {
-            addAttribute("talk_sec", wbt_talk_sec);
+            addAttribute("talk_sec", wbt_talk_sec, &Payload::mutable_talk_sec);
         }
 
-        if (switch_event_get_header(e, "variable_grpc_send_hangup") != nullptr || hangup_by == "recv_bye" ||
+        if (index_.get(IDX_VAR_GRPC_SEND_HANGUP) != nullptr || hangup_by == "recv_bye" ||
             hangup_by == "recv_refuse" || hangup_by == "recv_cancel" || (hangup_by == "send_refuse" && parent_)) {
-            addAttribute("hangup_by", parent_ ? "B" : "A");
-        } else if ((get_str(switch_event_get_header(e, "variable_last_app"))) == "hangup") {
-            addAttribute("hangup_by", "F");
+            addAttribute("hangup_by", parent_ ? "B" : "A", &Payload::mutable_hangup_by);
+        } else if (StrView(index_.get(IDX_VAR_LAST_APP)) == "hangup") {
+            addAttribute("hangup_by", "F", &Payload::mutable_hangup_by);
         } else {
-            addAttribute("hangup_by", parent_ ? "A" : "B");
+            addAttribute("hangup_by", parent_ ? "A" : "B", &Payload::mutable_hangup_by);
         }
 
 //        DUMP_EVENT(e)
 
         if (cc_reporting_at_) {
-            addAttribute("reporting_at", cc_reporting_at_);
+            addAttribute("reporting_at", cc_reporting_at_, &Payload::mutable_reporting_at);
         }
 
         setVariables("variable_usr_", "payload", e_);
 
-        addAttribute(HEADER_NAME_HANGUP_CAUSE, cause_);
+        addAttribute(HEADER_NAME_HANGUP_CAUSE, cause_, &Payload::mutable_cause);
         addAttribute("originate_success",
-                     switch_event_get_header(e, "variable_grpc_originate_success") != nullptr);
+                     index_.get(IDX_VAR_GRPC_ORIGINATE_SUCCESS) != nullptr, &Payload::set_originate_success);
 
         int num = 0;
 
         if (!sip_code_.empty()) {
             sscanf( sip_code_.c_str(), "sip:%d", &num );
         } else {
-            sip_code_ = get_str(switch_event_get_header(e, "variable_sip_invite_failure_status"));
+            sip_code_ = index_.get(IDX_VAR_SIP_INVITE_FAILURE_STATUS);
             if (sip_code_.empty()) {
-                sip_code_ = get_str(switch_event_get_header(e, "variable_sip_term_status"));
+                sip_code_ = index_.get(IDX_VAR_SIP_TERM_STATUS);
             }
 
             if (!sip_code_.empty()) {
@@ -852,33 +1018,33 @@ public:
         }
 
         if (num == 0) {
-            addAttribute("sip", cause_ == "ORIGINATOR_CANCEL" ? 487 : 200);
+            addAttribute("sip", cause_ == "ORIGINATOR_CANCEL" ? 487 : 200, &Payload::set_sip);
         } else {
-            addAttribute("sip", num);
+            addAttribute("sip", num, &Payload::set_sip);
         }
 
-        auto hp = switch_event_get_header_ptr(e, "variable_wbt_tags");
+        auto hp = index_.ptr(IDX_VAR_WBT_TAGS);
         if (hp) {
-            addArrayValue(hp, "tags", false);
+            addArrayValue(hp, "tags", &Payload::mutable_tags);
         }
 
-        auto sids = switch_event_get_header_ptr(e, "variable_wbt_schema_ids");
+        auto sids = index_.ptr(IDX_VAR_WBT_SCHEMA_IDS);
         if (sids) {
-            addArrayValue(sids, "schema_ids", true);
+            addArrayValue(sids, "schema_ids", &Payload::mutable_schema_ids);
         }
 
         if (!wbt_amd.empty()) {
-            auto positive = get_str(switch_event_get_header(e, "variable_" WBT_AMD_AI_POSITIVE));
-            addAttribute("amd_ai_result", wbt_amd);
-            addAttribute( "amd_ai_positive", positive == "true");
-            hp = switch_event_get_header_ptr(e, "variable_" WBT_AMD_AI_LOG);
+            StrView positive = index_.get(IDX_VAR_WBT_AMD_AI_POSITIVE);
+            addAttribute("amd_ai_result", wbt_amd, &Payload::mutable_amd_ai_result);
+            addAttribute("amd_ai_positive", positive == "true", &Payload::set_amd_ai_positive);
+            hp = index_.ptr(IDX_VAR_WBT_AMD_AI_LOG);
             if (hp) {
-                addArrayValue(hp, "amd_ai_logs", false);
+                addArrayValue(hp, "amd_ai_logs", &Payload::mutable_amd_ai_logs);
             }
         }
 
         if (!sip_hangup_phrase.empty()) {
-            addAttribute("hangup_phrase", sip_hangup_phrase);
+            addAttribute("hangup_phrase", sip_hangup_phrase, &Payload::mutable_hangup_phrase);
         }
     };
 };
@@ -886,8 +1052,8 @@ public:
 template <> class CallEvent<Execute> : public BaseCallEvent {
 public:
     explicit CallEvent(switch_event_t *e) : BaseCallEvent(Execute, e) {
-        auto app_ = get_str(switch_event_get_header(e, "Application"));
-        addAttribute("application", app_);
+        StrView app_ = index_.get(IDX_APPLICATION);
+        addAttribute("application", app_, &Payload::mutable_application);
     };
 };
 
@@ -908,10 +1074,20 @@ public:
 template <> class CallEvent<AMD> : public BaseCallEvent {
 public:
     explicit CallEvent(switch_event_t *e) : BaseCallEvent(AMD, e) {
-        addIfExists(body_, "ai_result", "variable_"  WBT_AMD_AI);
-        addIfExists(body_, "ai_error", "variable_"  WBT_AMD_AI_ERROR);
-        addIfExists(body_, "result", "variable_amd_result");
-        addIfExists(body_, "cause", "variable_amd_cause");
+        addIfExists(body_, "ai_result", IDX_VAR_WBT_AMD_AI, &Payload::mutable_ai_result);
+        addIfExists(body_, "ai_error", IDX_VAR_WBT_AMD_AI_ERROR, &Payload::mutable_ai_error);
+        addIfExists(body_, "ai_local", IDX_VAR_WBT_AMD_AI_LOCAL, &Payload::set_ai_local);
+        addIfExists(body_, "ai_partial", IDX_VAR_WBT_AMD_AI_PARTIAL, &Payload::set_ai_partial);
+        auto tmp = index_.get(IDX_VAR_WBT_AMD_AI_CONFIDENCE);
+        if (!zstr(tmp)) {
+            addAttribute("ai_confidence", atof(tmp), &Payload::set_ai_confidence);
+        }
+        tmp = index_.get(IDX_VAR_WBT_AMD_AI_ELAPSED_MS);
+        if (!zstr(tmp)) {
+            addAttribute("ai_elapsed_ms", atoi(tmp), &Payload::set_ai_elapsed_ms);
+        }
+        addIfExists(body_, "result", IDX_VAR_AMD_RESULT, &Payload::mutable_result);
+        addIfExists(body_, "cause", IDX_VAR_AMD_CAUSE, &Payload::mutable_cause);
     };
 };
 
@@ -919,8 +1095,8 @@ template <> class CallEvent<Eavesdrop> : public BaseCallEvent {
 public:
     explicit CallEvent(switch_event_t *e) : BaseCallEvent(Eavesdrop, e) {
         auto state = eavesdropStateName();
-        addAttribute("state", state);
-        addIfExists(body_, "type", "variable_wbt_eavesdrop_type");
+        addAttribute("state", state, &Payload::mutable_state);
+        addIfExists(body_, "type", IDX_VAR_WBT_EAVESDROP_TYPE, &Payload::mutable_type);
         notifyEavesdropPartner(state);
     };
 };
@@ -932,5 +1108,41 @@ public:
     };
 };
 
+// heartbeats of one domain, calls[0] is the source of the common headers
+template <> class CallEvent<HeartbeatBatch> : public BaseCallEvent {
+public:
+    explicit CallEvent(const std::vector<switch_event_t *> &calls) : BaseCallEvent(HeartbeatBatch, calls.front()) {
+        if (body_) {
+            body_->beginArray("calls");
+        }
+        for (auto call : calls) {
+            StrView id = switch_event_get_header(call, "Unique-ID");
+            StrView user_id = switch_event_get_header(call, "variable_sip_h_X-Webitel-User-Id");
+            StrView cc_app_id = switch_event_get_header(call, "variable_cc_app_id");
+            if (payload_) {
+                auto c = payload_->add_calls();
+                c->set_id(id.c_str());
+                c->set_user_id(strtoll(user_id.c_str(), nullptr, 10));
+                c->set_cc_app_id(cc_app_id.c_str());
+            }
+            if (!body_) {
+                continue;
+            }
+            body_->beginObject();
+            body_->addString("id", id.c_str());
+            if (!user_id.empty()) {
+                body_->addNumber(HEADER_NAME_USER_ID, atoi(user_id.c_str()));
+            }
+            if (!cc_app_id.empty()) {
+                body_->addString(HEADER_NAME_CC_NODE, cc_app_id.c_str());
+            }
+            body_->endObject();
+        }
+        if (body_) {
+            body_->endArray();
+        }
+    };
+};
+
 
 #endif //MOD_GRPC_CALL_H
@@ -0,0 +1,93 @@
+//
+// Created by root on 17.10.26.
+//
+
+#include "CallEventStream.h"
+
+namespace mod_grpc {
+
+    std::mutex CallEventStream::mutex_;
+    std::list<CallEventStream *> CallEventStream::streams_;
+    std::atomic<int> CallEventStream::subscribers_(0);
+    bool CallEventStream::closed_ = false;
+
+    CallEventStream::CallEventStream(fs::Api::AsyncService *service, grpc::ServerCompletionQueue *cq)
+            : ServerStreamCall(service, cq, &fs::Api::AsyncService::RequestSubscribeCallEvents), domain_id_(0) {
+    }
+
+    void CallEventStream::Spawn() {
+        (new CallEventStream(service_, cq_))->Arm();
+    }
+
+    void CallEventStream::OnRequest() {
+        for (const auto &name : req_.events()) {
+            events_.insert(name);
+        }
+        domain_id_ = req_.domain_id();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_) {
+            Close(grpc::Status(grpc::StatusCode::UNAVAILABLE, "server shutdown"));
+            return;
+        }
+        if (Finishing()) {
+            // the client is already gone
+            return;
+        }
+        streams_.push_back(this);
+        subscribers_ = static_cast<int>(streams_.size());
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "Call events subscriber %s (domain %ld)\n",
+                          ctx_.peer().c_str(), (long) domain_id_);
+    }
+
+    void CallEventStream::OnDone() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        streams_.remove(this);
+        subscribers_ = static_cast<int>(streams_.size());
+    }
+
+    bool CallEventStream::match(const fs::CallEvent &event) const {
+        if (domain_id_ && domain_id_ != event.domain_id()) {
+            return false;
+        }
+
+        return events_.empty() || events_.find(event.event()) != events_.end();
+    }
+
+    void CallEventStream::Publish(const fs::CallEvent &event) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = streams_.begin();
+        while (it != streams_.end()) {
+            auto stream = *it;
+            if (!stream->match(event)) {
+                ++it;
+                continue;
+            }
+
+            if (stream->Pending() >= CALL_EVENT_STREAM_MAX_PENDING) {
+                switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING, "Call events subscriber %s is slow, skip %s\n",
+                                  stream->ctx_.peer().c_str(), event.id().c_str());
+                ++it;
+                continue;
+            }
+
+            if (stream->Send(event)) {
+                ++it;
+            } else {
+                it = streams_.erase(it);
+                stream->Close(grpc::Status::CANCELLED);
+            }
+        }
+        subscribers_ = static_cast<int>(streams_.size());
+    }
+
+    void CallEventStream::CloseAll() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        for (auto stream : streams_) {
+            stream->Close(grpc::Status(grpc::StatusCode::UNAVAILABLE, "server shutdown"));
+        }
+        streams_.clear();
+        subscribers_ = 0;
+    }
+}
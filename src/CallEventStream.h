@@ -0,0 +1,56 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_CALLEVENTSTREAM_H
+#define MOD_GRPC_CALLEVENTSTREAM_H
+
+extern "C" {
+#include <switch.h>
+}
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include "async_server.h"
+#include "generated/fs.pb.h"
+
+#define CALL_EVENT_STREAM_MAX_PENDING 1000
+
+namespace mod_grpc {
+
+    // SubscribeCallEvents: streams WEBITEL_CALL events, filtered by event name and domain
+    class CallEventStream final : public ServerStreamCall<fs::SubscribeCallEventsRequest, fs::CallEvent> {
+    public:
+        CallEventStream(fs::Api::AsyncService *service, grpc::ServerCompletionQueue *cq);
+
+        static inline bool HasSubscribers() {
+            return subscribers_ > 0;
+        }
+
+        static void Publish(const fs::CallEvent &event);
+        static void CloseAll();
+
+    protected:
+        void Spawn() override;
+        void OnRequest() override;
+        void OnDone() override;
+
+    private:
+        bool match(const fs::CallEvent &event) const;
+
+        static std::mutex mutex_;
+        static std::list<CallEventStream *> streams_;
+        static std::atomic<int> subscribers_;
+        // CloseAll is done, new subscribers are refused
+        static bool closed_;
+
+        std::set<std::string> events_;
+        int64_t domain_id_;
+    };
+}
+
+#endif //MOD_GRPC_CALLEVENTSTREAM_H
@@ -4,29 +4,349 @@
 
 #include "CallManager.h"
 
-mod_grpc::CallManager::CallManager() {
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_CREATE, nullptr, CallManager::handle_call_event, nullptr);
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_ANSWER, nullptr, CallManager::handle_call_event, nullptr);
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_HOLD, nullptr, CallManager::handle_call_event, nullptr);
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_UNHOLD, nullptr, CallManager::handle_call_event, nullptr);
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_DTMF, nullptr, CallManager::handle_call_event, nullptr);
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_BRIDGE, nullptr, CallManager::handle_call_event, nullptr);
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_HANGUP_COMPLETE, nullptr, CallManager::handle_call_event, nullptr);
-//    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_TALK, nullptr, CallManager::handle_call_event, nullptr);
-//    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_NOTALK, nullptr, CallManager::handle_call_event, nullptr);
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_RECORD_START, nullptr, CallManager::handle_call_event, nullptr);
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_RECORD_STOP, nullptr, CallManager::handle_call_event, nullptr);
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_SESSION_HEARTBEAT, nullptr, CallManager::handle_call_event, nullptr);
-
-//    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_EXECUTE, nullptr, CallManager::handle_call_event, nullptr);
-
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CUSTOM, AMD_EVENT_NAME, CallManager::handle_call_event, nullptr);
-    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CUSTOM, EAVESDROP_EVENT_NAME, CallManager::handle_call_event, nullptr);
-//    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CUSTOM, VALET_PARK_NAME, CallManager::handle_call_event, nullptr);
+mod_grpc::CallManager::CallManager(int workers, int queue_size, int heartbeat_batch_ms, int dtmf_window_ms)
+        : shard_size_(0), stopped_(false), heartbeat_batch_(0), dtmf_window_(0) {
+    switch_event_callback_t callback = CallManager::handle_call_event;
+    void *user_data = nullptr;
+
+    if (workers > 0) {
+        heartbeat_batch_ = std::chrono::milliseconds(heartbeat_batch_ms > 0 ? heartbeat_batch_ms : 0);
+        dtmf_window_ = std::chrono::milliseconds(dtmf_window_ms > 0 ? dtmf_window_ms : 0);
+        shard_size_ = static_cast<size_t>(queue_size > workers ? queue_size / workers : 1);
+        for (int i = 0; i < workers; ++i) {
+            auto shard = new Shard;
+            shards_.emplace_back(shard);
+            shard->thread = std::thread(&CallManager::work, this, shard);
+        }
+        callback = CallManager::enqueue_call_event;
+        user_data = this;
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "Call events workers: %d, queue: %d, heartbeat batch: %dms, dtmf window: %dms\n",
+                          workers, queue_size, (int) heartbeat_batch_.count(), (int) dtmf_window_.count());
+    } else if (heartbeat_batch_ms > 0 || dtmf_window_ms > 0) {
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING, "Call events batching requires event_workers, disabled\n");
+    }
+
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_CREATE, nullptr, callback, user_data);
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_ANSWER, nullptr, callback, user_data);
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_HOLD, nullptr, callback, user_data);
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_UNHOLD, nullptr, callback, user_data);
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_DTMF, nullptr, callback, user_data);
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_BRIDGE, nullptr, callback, user_data);
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_HANGUP_COMPLETE, nullptr, callback, user_data);
+//    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_TALK, nullptr, callback, user_data);
+//    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_NOTALK, nullptr, callback, user_data);
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_RECORD_START, nullptr, callback, user_data);
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_RECORD_STOP, nullptr, callback, user_data);
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_SESSION_HEARTBEAT, nullptr, callback, user_data);
+
+//    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CHANNEL_EXECUTE, nullptr, callback, user_data);
+
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CUSTOM, AMD_EVENT_NAME, callback, user_data);
+    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CUSTOM, EAVESDROP_EVENT_NAME, callback, user_data);
+//    switch_event_bind(CALL_MANAGER_NAME, SWITCH_EVENT_CUSTOM, VALET_PARK_NAME, callback, user_data);
 }
 
 mod_grpc::CallManager::~CallManager() {
     switch_event_unbind_callback(CallManager::handle_call_event);
+    switch_event_unbind_callback(CallManager::enqueue_call_event);
+
+    stopped_ = true;
+    for (auto &shard : shards_) {
+        {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+        }
+        shard->not_empty.notify_all();
+        shard->not_full.notify_all();
+        if (shard->thread.joinable()) {
+            shard->thread.join();
+        }
+    }
+}
+
+void mod_grpc::CallManager::enqueue_call_event(switch_event_t *event) {
+    auto cm = static_cast<CallManager *>(event->bind_user_data);
+    // the record times must be on the channel before its hangup is built
+    if (event->event_id == SWITCH_EVENT_RECORD_START || event->event_id == SWITCH_EVENT_RECORD_STOP) {
+        handle_call_event(event);
+        return;
+    }
+    if (event->event_id != SWITCH_EVENT_CHANNEL_HANGUP_COMPLETE && switch_false(switch_event_get_header(event, "variable_" SKIP_EVENT_VARIABLE))) {
+        return;
+    }
+    cm->push(event);
+}
+
+// the headers the builders read, arrays stay arrays as in switch_event_dup
+switch_event_t *mod_grpc::CallManager::copy_event(switch_event_t *event) {
+    switch_event_t *clone = nullptr;
+    if (switch_event_create_subclass(&clone, event->event_id, event->subclass_name) != SWITCH_STATUS_SUCCESS) {
+        return nullptr;
+    }
+
+    for (auto hp = event->headers; hp; hp = hp->next) {
+        if (!EventIndex::wanted(hp)) {
+            continue;
+        }
+        if (hp->idx) {
+            for (int i = 0; i < hp->idx; i++) {
+                switch_event_add_header_string(clone, SWITCH_STACK_PUSH, hp->name, hp->array[i]);
+            }
+        } else {
+            switch_event_add_header_string(clone, SWITCH_STACK_BOTTOM, hp->name, hp->value);
+        }
+    }
+    return clone;
+}
+
+void mod_grpc::CallManager::push(switch_event_t *event) {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (auto p = switch_event_get_header(event, "Unique-ID"); p && *p; ++p) {
+        hash = (hash ^ static_cast<uint8_t>(*p)) * 16777619u;
+    }
+
+    auto clone = copy_event(event);
+    if (!clone) {
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_ERROR, "Couldn't copy event %s\n", switch_event_name(event->event_id));
+        return;
+    }
+
+    auto shard = shards_[hash % shards_.size()].get();
+    std::unique_lock<std::mutex> lock(shard->mutex);
+    if (shard->events.size() >= shard_size_ && !make_room(shard, event->event_id)) {
+        shard->dropped++;
+        lock.unlock();
+        switch_event_destroy(&clone);
+        return;
+    }
+    if (shard->events.size() >= 2 * shard_size_) {
+        if (!shard->blocked) {
+            shard->blocked = true;
+            switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_ERROR, "Call events queue is over %lu, event dispatch waits for the worker\n",
+                              (unsigned long) (2 * shard_size_));
+        }
+        shard->not_full.wait(lock, [&] { return stopped_ || shard->events.size() < 2 * shard_size_; });
+    }
+    shard->events.push_back(clone);
+    lock.unlock();
+    shard->not_empty.notify_one();
+}
+
+static inline bool droppable(switch_event_types_t id) {
+    return id == SWITCH_EVENT_SESSION_HEARTBEAT || id == SWITCH_EVENT_DTMF;
+}
+
+// shard mutex is held, false if the new event is dropped; call state events are never dropped
+bool mod_grpc::CallManager::make_room(Shard *shard, switch_event_types_t id) {
+    if (!shard->overflow) {
+        shard->overflow = true;
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING, "Call events queue is full (%lu), dropping heartbeat and dtmf\n",
+                          (unsigned long) shard_size_);
+    }
+    if (droppable(id)) {
+        return false;
+    }
+
+    for (auto it = shard->events.begin(); it != shard->events.end(); ++it) {
+        if (droppable((*it)->event_id)) {
+            switch_event_destroy(&(*it));
+            shard->events.erase(it);
+            shard->dropped++;
+            return true;
+        }
+    }
+
+    return true;
+}
+
+void mod_grpc::CallManager::work(Shard *shard) {
+    std::unique_lock<std::mutex> lock(shard->mutex);
+    while (true) {
+        Clock::time_point deadline;
+        auto ready = [&] { return stopped_ || !shard->events.empty(); };
+        if (next_deadline(shard, &deadline)) {
+            shard->not_empty.wait_until(lock, deadline, ready);
+        } else {
+            shard->not_empty.wait(lock, ready);
+        }
+
+        if (shard->events.empty()) {
+            if (stopped_) {
+                break;
+            }
+            lock.unlock();
+            flush(shard, false);
+            lock.lock();
+            continue;
+        }
+
+        auto event = shard->events.front();
+        shard->events.pop_front();
+        uint64_t dropped = 0;
+        if (shard->overflow && shard->events.size() < shard_size_ / 2) {
+            dropped = shard->dropped;
+            shard->overflow = false;
+            shard->blocked = false;
+            shard->dropped = 0;
+        }
+        bool wake = shard->events.size() < 2 * shard_size_;
+        lock.unlock();
+        if (wake) {
+            shard->not_full.notify_one();
+        }
+        if (dropped) {
+            switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING, "Call events queue recovered, dropped %lu events\n",
+                              (unsigned long) dropped);
+        }
+
+        process(shard, event);
+        flush(shard, false);
+        lock.lock();
+    }
+    lock.unlock();
+    flush(shard, true);
+}
+
+void mod_grpc::CallManager::process(Shard *shard, switch_event_t *event) {
+    auto uuid = switch_event_get_header(event, "Unique-ID");
+    if (!uuid) {
+        handle_call_event(event);
+        switch_event_destroy(&event);
+        return;
+    }
+
+    if (dtmf_window_.count() && event->event_id == SWITCH_EVENT_DTMF) {
+        auto digit = switch_event_get_header(event, "DTMF-Digit");
+        auto it = shard->dtmf.find(uuid);
+        if (it == shard->dtmf.end()) {
+            set_dtmf_ids(event);
+            shard->dtmf.emplace(std::string(uuid), PendingDtmf{event, std::string(digit ? digit : ""), Clock::now() + dtmf_window_});
+            return;
+        }
+
+        if (digit) {
+            it->second.digits += digit;
+        }
+        switch_event_destroy(&event);
+        if (it->second.digits.size() >= DTMF_COALESCE_MAX_DIGITS) {
+            flush_dtmf(&it->second);
+            shard->dtmf.erase(it);
+        }
+        return;
+    }
+
+    if (heartbeat_batch_.count() && event->event_id == SWITCH_EVENT_SESSION_HEARTBEAT) {
+        if (shard->heartbeats.empty()) {
+            shard->heartbeat_deadline = Clock::now() + heartbeat_batch_;
+        }
+        auto &last = shard->heartbeats[uuid];
+        if (last) {
+            switch_event_destroy(&last);
+        }
+        last = event;
+        return;
+    }
+
+    // everything pending of the call goes before its next event
+    auto dtmf = shard->dtmf.find(uuid);
+    if (dtmf != shard->dtmf.end()) {
+        flush_dtmf(&dtmf->second);
+        shard->dtmf.erase(dtmf);
+    }
+
+    if (event->event_id == SWITCH_EVENT_CHANNEL_HANGUP_COMPLETE) {
+        auto hb = shard->heartbeats.find(uuid);
+        if (hb != shard->heartbeats.end()) {
+            handle_call_event(hb->second);
+            switch_event_destroy(&hb->second);
+            shard->heartbeats.erase(hb);
+        }
+    }
+
+    handle_call_event(event);
+    switch_event_destroy(&event);
+}
+
+bool mod_grpc::CallManager::next_deadline(Shard *shard, Clock::time_point *deadline) {
+    bool found(false);
+    for (auto &d : shard->dtmf) {
+        if (!found || d.second.deadline < *deadline) {
+            *deadline = d.second.deadline;
+            found = true;
+        }
+    }
+    if (!shard->heartbeats.empty() && (!found || shard->heartbeat_deadline < *deadline)) {
+        *deadline = shard->heartbeat_deadline;
+        found = true;
+    }
+    return found;
+}
+
+void mod_grpc::CallManager::flush(Shard *shard, bool all) {
+    auto now = Clock::now();
+    for (auto it = shard->dtmf.begin(); it != shard->dtmf.end();) {
+        if (all || it->second.deadline <= now) {
+            flush_dtmf(&it->second);
+            it = shard->dtmf.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    if (!shard->heartbeats.empty() && (all || shard->heartbeat_deadline <= now)) {
+        flush_heartbeats(shard);
+    }
+}
+
+void mod_grpc::CallManager::flush_dtmf(PendingDtmf *pending) {
+    switch_event_del_header(pending->event, "DTMF-Digit");
+    switch_event_add_header_string(pending->event, SWITCH_STACK_BOTTOM, "DTMF-Digit", pending->digits.c_str());
+    handle_call_event(pending->event);
+    switch_event_destroy(&pending->event);
+}
+
+// one batch event per domain, routing of WEBITEL_CALL is by domain_id
+void mod_grpc::CallManager::flush_heartbeats(Shard *shard) {
+    std::unordered_map<std::string, std::vector<switch_event_t *>> domains;
+    for (auto &hb : shard->heartbeats) {
+        auto domain = switch_event_get_header(hb.second, "variable_sip_h_X-Webitel-Domain-Id");
+        domains[domain ? domain : ""].push_back(hb.second);
+    }
+
+    for (auto &d : domains) {
+        try {
+            CallEvent<HeartbeatBatch>(d.second).fire();
+        } catch (std::exception& e) {
+            switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_CRIT, "Event %s\n", e.what());
+        }
+    }
+
+    for (auto &hb : shard->heartbeats) {
+        switch_event_destroy(&hb.second);
+    }
+    shard->heartbeats.clear();
+}
+
+// domain and user of the call if the event has no channel variables
+void mod_grpc::CallManager::set_dtmf_ids(switch_event_t *event) {
+    if (switch_event_get_header(event, "variable_sip_h_X-Webitel-Domain-Id")) {
+        return;
+    }
+
+    auto uuid_ = get_str(switch_event_get_header(event, "Unique-ID"));
+    auto session = switch_core_session_locate(uuid_.c_str());
+    if (session) {
+        auto channel = switch_core_session_get_channel(session);
+        auto domain_id_ = switch_channel_get_variable(channel, "sip_h_X-Webitel-Domain-Id");
+        auto user_id_ = switch_channel_get_variable(channel, "sip_h_X-Webitel-User-Id");
+        switch_core_session_rwunlock(session);
+        if (domain_id_) {
+            switch_event_add_header_string(event, SWITCH_STACK_BOTTOM, "variable_sip_h_X-Webitel-Domain-Id", domain_id_);
+        }
+        if (user_id_) {
+            switch_event_add_header_string(event, SWITCH_STACK_BOTTOM, "variable_sip_h_X-Webitel-User-Id", user_id_);
+        }
+    }
 }
 
 void mod_grpc::CallManager::handle_call_event(switch_event_t *event) {
@@ -64,20 +384,7 @@ void mod_grpc::CallManager::handle_call_event(switch_event_t *event) {
                 break;
 
             case SWITCH_EVENT_DTMF: {
-                auto uuid_ = get_str(switch_event_get_header(event, "Unique-ID"));
-                auto session = switch_core_session_locate(uuid_.c_str());
-                if (session) {
-                    auto channel = switch_core_session_get_channel(session);
-                    auto domain_id_ = switch_channel_get_variable(channel, "sip_h_X-Webitel-Domain-Id");
-                    auto user_id_ = switch_channel_get_variable(channel, "sip_h_X-Webitel-User-Id");
-                    switch_core_session_rwunlock(session);
-                    if (domain_id_) {
-                        switch_event_add_header_string(event, SWITCH_STACK_BOTTOM, "variable_sip_h_X-Webitel-Domain-Id", domain_id_);
-                    }
-                    if (user_id_) {
-                        switch_event_add_header_string(event, SWITCH_STACK_BOTTOM, "variable_sip_h_X-Webitel-User-Id", user_id_);
-                    }
-                }
+                set_dtmf_ids(event);
                 CallEvent<DTMF>(event).fire();
                 break;
             }
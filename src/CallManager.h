@@ -10,17 +10,81 @@ extern "C" {
 #include <switch_event.h>
 }
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
 #include "Call.h"
 
+#define DTMF_COALESCE_MAX_DIGITS 32
+
 namespace mod_grpc {
 
+    // Events are copied in the dispatch thread (only the headers the builders read) and built by workers.
+    // Worker is selected by hash of Unique-ID to keep the order of one call.
+    // A full queue drops heartbeats and DTMF. Call state events are never dropped: they may take up to
+    // twice the queue size, past it the dispatch thread waits for the worker.
+    // Record start/stop only set channel variables and stay in the dispatch thread.
+    // Optionally a worker joins heartbeats into batch events and DTMF bursts into one digit string,
+    // both are flushed before the Hangup of the call.
     class CallManager {
     public:
-        explicit CallManager();
+        explicit CallManager(int workers, int queue_size, int heartbeat_batch_ms, int dtmf_window_ms);
         ~CallManager();
 
     protected:
         static void handle_call_event(switch_event_t *event);
+
+    private:
+        typedef std::chrono::steady_clock Clock;
+
+        struct PendingDtmf {
+            switch_event_t *event;
+            std::string digits;
+            Clock::time_point deadline;
+        };
+
+        struct Shard {
+            std::mutex mutex;
+            std::condition_variable not_empty;
+            std::condition_variable not_full;
+            std::deque<switch_event_t *> events;
+            std::thread thread;
+            // since the queue was full
+            bool overflow = false;
+            bool blocked = false;
+            uint64_t dropped = 0;
+
+            // owned by the worker thread
+            std::unordered_map<std::string, PendingDtmf> dtmf;
+            std::unordered_map<std::string, switch_event_t *> heartbeats;
+            Clock::time_point heartbeat_deadline;
+        };
+
+        static void enqueue_call_event(switch_event_t *event);
+        static switch_event_t *copy_event(switch_event_t *event);
+        static void set_dtmf_ids(switch_event_t *event);
+        void push(switch_event_t *event);
+        bool make_room(Shard *shard, switch_event_types_t id);
+        void work(Shard *shard);
+        void process(Shard *shard, switch_event_t *event);
+        bool next_deadline(Shard *shard, Clock::time_point *deadline);
+        void flush(Shard *shard, bool all);
+        void flush_dtmf(PendingDtmf *pending);
+        void flush_heartbeats(Shard *shard);
+
+        std::vector<std::unique_ptr<Shard>> shards_;
+        size_t shard_size_;
+        std::atomic<bool> stopped_;
+        std::chrono::milliseconds heartbeat_batch_;
+        std::chrono::milliseconds dtmf_window_;
     };
 }
 
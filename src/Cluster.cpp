@@ -51,12 +51,14 @@ namespace mod_grpc {
         stop();
     }
 
-    Cluster::Cluster(const std::string &server, const std::string &address, const int &port, const int &ttl, const int &deregister_ttl) : address_(address), port_(port) {
+    Cluster::Cluster(const std::string &server, const std::string &address, const int &port, const int &ttl, const int &deregister_ttl,
+                     const int &event_workers, const int &event_queue_size, const int &event_heartbeat_batch_ms,
+                     const int &event_dtmf_window_ms) : address_(address), port_(port) {
 
         timer_ = new Timer();
         id_ = std::string(switch_core_get_switchname());
 
-        cm = new CallManager();
+        cm = new CallManager(event_workers, event_queue_size, event_heartbeat_batch_ms, event_dtmf_window_ms);
 
         register_uri =  server + REGISTER_PATH;
         deregister_uri =  server + UN_REGISTER_PATH;
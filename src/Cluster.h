@@ -51,7 +51,9 @@ namespace mod_grpc {
 
         CallManager *cm;
     public:
-        explicit Cluster(const std::string &server, const std::string &address, const int &port, const int &ttl, const int &deregister_ttl);
+        explicit Cluster(const std::string &server, const std::string &address, const int &port, const int &ttl, const int &deregister_ttl,
+                         const int &event_workers, const int &event_queue_size, const int &event_heartbeat_batch_ms,
+                         const int &event_dtmf_window_ms);
         ~Cluster();
     };
 
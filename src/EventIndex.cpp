@@ -0,0 +1,106 @@
+//
+// Created by root on 17.10.26.
+//
+
+#include "EventIndex.h"
+
+#define EVENT_INDEX_TABLE_SIZE 256
+
+namespace mod_grpc {
+
+#define EVENT_INDEX_NAME(id, name) name,
+    static const char *known_headers[] = {
+            EVENT_INDEX_KNOWN_HEADERS(EVENT_INDEX_NAME)
+    };
+#undef EVENT_INDEX_NAME
+
+    // Open addressing hash -> slot, uses the same hash as switch_event headers
+    class KnownHeaders {
+    public:
+        KnownHeaders() {
+            for (auto &e : table_) {
+                e.slot = -1;
+            }
+
+            for (int i = 0; i < EVENT_INDEX_SLOTS; ++i) {
+                auto h = hash(known_headers[i]);
+                auto pos = h % EVENT_INDEX_TABLE_SIZE;
+                while (table_[pos].slot != -1) {
+                    pos = (pos + 1) % EVENT_INDEX_TABLE_SIZE;
+                }
+                table_[pos].hash = h;
+                table_[pos].slot = i;
+            }
+        }
+
+        static unsigned long hash(const char *name) {
+            switch_ssize_t len = -1;
+            return switch_ci_hashfunc_default(name, &len);
+        }
+
+        // -1 if the name is not known
+        int find(unsigned long h, const char *name) const {
+            auto pos = h % EVENT_INDEX_TABLE_SIZE;
+            while (table_[pos].slot != -1) {
+                if (table_[pos].hash == h && !strcasecmp(known_headers[table_[pos].slot], name)) {
+                    return table_[pos].slot;
+                }
+                pos = (pos + 1) % EVENT_INDEX_TABLE_SIZE;
+            }
+            return -1;
+        }
+
+    private:
+        struct Entry {
+            unsigned long hash;
+            int slot;
+        };
+        Entry table_[EVENT_INDEX_TABLE_SIZE];
+    };
+
+    static const KnownHeaders &knownHeaders() {
+        static KnownHeaders known;
+        return known;
+    }
+
+    EventIndex::EventIndex(switch_event_t *e) : e_(e), slots_() {
+        const auto &known = knownHeaders();
+
+        for (auto hp = e->headers; hp; hp = hp->next) {
+            auto slot = known.find(hp->hash ? hp->hash : KnownHeaders::hash(hp->name), hp->name);
+            if (slot != -1 && !slots_[slot]) {
+                slots_[slot] = hp;
+            }
+
+            if (!strncmp(hp->name, EVENT_INDEX_USR_PREFIX, sizeof(EVENT_INDEX_USR_PREFIX) - 1)) {
+                usr_.push_back(hp);
+            } else if (!strncmp(hp->name, EVENT_INDEX_CC_PREFIX, sizeof(EVENT_INDEX_CC_PREFIX) - 1)) {
+                cc_.push_back(hp);
+            }
+        }
+    }
+
+    switch_event_header_t *EventIndex::ptr(const char *name) const {
+        return switch_event_get_header_ptr(e_, name);
+    }
+
+    const char *EventIndex::name(EventHeader h) {
+        return known_headers[h];
+    }
+
+    bool EventIndex::wanted(const switch_event_header_t *hp) {
+        return knownHeaders().find(hp->hash ? hp->hash : KnownHeaders::hash(hp->name), hp->name) != -1 ||
+               !strncmp(hp->name, EVENT_INDEX_USR_PREFIX, sizeof(EVENT_INDEX_USR_PREFIX) - 1) ||
+               !strncmp(hp->name, EVENT_INDEX_CC_PREFIX, sizeof(EVENT_INDEX_CC_PREFIX) - 1);
+    }
+
+    const std::vector<switch_event_header_t *> *EventIndex::group(const char *prefix) const {
+        if (!strcmp(prefix, EVENT_INDEX_USR_PREFIX)) {
+            return &usr_;
+        } else if (!strcmp(prefix, EVENT_INDEX_CC_PREFIX)) {
+            return &cc_;
+        }
+
+        return nullptr;
+    }
+}
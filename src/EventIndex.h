@@ -0,0 +1,159 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_EVENTINDEX_H
+#define MOD_GRPC_EVENTINDEX_H
+
+extern "C" {
+#include <switch.h>
+}
+
+#include <vector>
+
+#define EVENT_INDEX_USR_PREFIX "variable_usr_"
+#define EVENT_INDEX_CC_PREFIX "variable_cc_"
+
+// headers read by the call event builders, the id is the slot of the header in EventIndex
+#define EVENT_INDEX_KNOWN_HEADERS(X) \
+    X(IDX_UNIQUE_ID, "Unique-ID") \
+    X(IDX_FREESWITCH_SWITCHNAME, "FreeSWITCH-Switchname") \
+    X(IDX_CALL_DIRECTION, "Call-Direction") \
+    X(IDX_APPLICATION, "Application") \
+    X(IDX_ACTION, "Action") \
+    X(IDX_DTMF_DIGIT, "DTMF-Digit") \
+    X(IDX_CALLER_CALLER_ID_NUMBER, "Caller-Caller-ID-Number") \
+    X(IDX_CALLER_CALLER_ID_NAME, "Caller-Caller-ID-Name") \
+    X(IDX_CALLER_CALLEE_ID_NUMBER, "Caller-Callee-ID-Number") \
+    X(IDX_CALLER_CALLEE_ID_NAME, "Caller-Callee-ID-Name") \
+    X(IDX_CALLER_DESTINATION_NUMBER, "Caller-Destination-Number") \
+    X(IDX_CHANNEL_DESTINATION_NUMBER, "Channel-Destination-Number") \
+    X(IDX_OTHER_LEG_UNIQUE_ID, "Other-Leg-Unique-ID") \
+    X(IDX_OTHER_LEG_CALLER_ID_NUMBER, "Other-Leg-Caller-ID-Number") \
+    X(IDX_OTHER_LEG_CALLER_ID_NAME, "Other-Leg-Caller-ID-Name") \
+    X(IDX_VAR_PROCESS_CDR, "variable_process_cdr") \
+    X(IDX_VAR_HANGUP_CAUSE, "variable_hangup_cause") \
+    X(IDX_VAR_PROTO_SPECIFIC_HANGUP_CAUSE, "variable_proto_specific_hangup_cause") \
+    X(IDX_VAR_SIP_HANGUP_DISPOSITION, "variable_sip_hangup_disposition") \
+    X(IDX_VAR_SIP_HANGUP_PHRASE, "variable_sip_hangup_phrase") \
+    X(IDX_VAR_SIP_INVITE_FAILURE_PHRASE, "variable_sip_invite_failure_phrase") \
+    X(IDX_VAR_SIP_INVITE_FAILURE_STATUS, "variable_sip_invite_failure_status") \
+    X(IDX_VAR_SIP_TERM_STATUS, "variable_sip_term_status") \
+    X(IDX_VAR_SIP_H_X_WEBITEL_DOMAIN_ID, "variable_sip_h_X-Webitel-Domain-Id") \
+    X(IDX_VAR_SIP_H_X_WEBITEL_USER_ID, "variable_sip_h_X-Webitel-User-Id") \
+    X(IDX_VAR_SIP_H_X_WEBITEL_DIRECTION, "variable_sip_h_X-Webitel-Direction") \
+    X(IDX_VAR_SIP_H_X_WEBITEL_DISPLAY_DIRECTION, "variable_sip_h_X-Webitel-Display-Direction") \
+    X(IDX_VAR_SIP_H_X_WEBITEL_GATEWAY_ID, "variable_sip_h_X-Webitel-Gateway-Id") \
+    X(IDX_VAR_SIP_H_X_WEBITEL_GATEWAY, "variable_sip_h_X-Webitel-Gateway") \
+    X(IDX_VAR_SIP_H_X_WEBITEL_UUID, "variable_sip_h_X-Webitel-Uuid") \
+    X(IDX_VAR_SIGNAL_BOND, "variable_signal_bond") \
+    X(IDX_VAR_RECORD_SECONDS, "variable_record_seconds") \
+    X(IDX_VAR_MEDIA_BUG_ANSWER_REQ, "variable_media_bug_answer_req") \
+    X(IDX_VAR_BRIDGE_EPOCH, "variable_bridge_epoch") \
+    X(IDX_VAR_LAST_APP, "variable_last_app") \
+    X(IDX_VAR_DESTINATION_NUMBER, "variable_destination_number") \
+    X(IDX_VAR_EFFECTIVE_CALLER_ID_NUMBER, "variable_effective_caller_id_number") \
+    X(IDX_VAR_EFFECTIVE_CALLER_ID_NAME, "variable_effective_caller_id_name") \
+    X(IDX_VAR_EFFECTIVE_CALLEE_ID_NUMBER, "variable_effective_callee_id_number") \
+    X(IDX_VAR_GRPC_SEND_HANGUP, "variable_grpc_send_hangup") \
+    X(IDX_VAR_GRPC_ORIGINATE_SUCCESS, "variable_grpc_originate_success") \
+    X(IDX_VAR_CC_APP_ID, "variable_cc_app_id") \
+    X(IDX_VAR_CC_REPORTING_AT, "variable_cc_reporting_at") \
+    X(IDX_VAR_AMD_RESULT, "variable_amd_result") \
+    X(IDX_VAR_AMD_CAUSE, "variable_amd_cause") \
+    X(IDX_VAR_USR_WBT_IVR_LOG, "variable_usr_wbt_ivr_log") \
+    X(IDX_VAR_WBT_PARENT_ID, "variable_wbt_parent_id") \
+    X(IDX_VAR_WBT_FROM_ID, "variable_wbt_from_id") \
+    X(IDX_VAR_WBT_FROM_TYPE, "variable_wbt_from_type") \
+    X(IDX_VAR_WBT_FROM_NAME, "variable_wbt_from_name") \
+    X(IDX_VAR_WBT_FROM_NUMBER, "variable_wbt_from_number") \
+    X(IDX_VAR_WBT_TO_ID, "variable_wbt_to_id") \
+    X(IDX_VAR_WBT_TO_TYPE, "variable_wbt_to_type") \
+    X(IDX_VAR_WBT_TO_NAME, "variable_wbt_to_name") \
+    X(IDX_VAR_WBT_TO_NUMBER, "variable_wbt_to_number") \
+    X(IDX_VAR_WBT_DESTINATION, "variable_wbt_destination") \
+    X(IDX_VAR_WBT_HIDE_NUMBER, "variable_wbt_hide_number") \
+    X(IDX_VAR_WBT_HIDE_CONTACT, "variable_wbt_hide_contact") \
+    X(IDX_VAR_WBT_CONTACT_ID, "variable_wbt_contact_id") \
+    X(IDX_VAR_WBT_GRANTEE_ID, "variable_wbt_grantee_id") \
+    X(IDX_VAR_WBT_ORIGINATE, "variable_wbt_originate") \
+    X(IDX_VAR_WBT_HEARTBEAT, "variable_wbt_heartbeat") \
+    X(IDX_VAR_WBT_VIDEO, "variable_wbt_video") \
+    X(IDX_VAR_WBT_SCREEN, "variable_wbt_screen") \
+    X(IDX_VAR_WBT_AUTO_ANSWER, "variable_wbt_auto_answer") \
+    X(IDX_VAR_WBT_DISABLE_STUN, "variable_wbt_disable_stun") \
+    X(IDX_VAR_WBT_EAVESDROP_TYPE, "variable_wbt_eavesdrop_type") \
+    X(IDX_VAR_WBT_EAVESDROP_NAME, "variable_wbt_eavesdrop_name") \
+    X(IDX_VAR_WBT_EAVESDROP_NUMBER, "variable_wbt_eavesdrop_number") \
+    X(IDX_VAR_WBT_EAVESDROP_DURATION, "variable_wbt_eavesdrop_duration") \
+    X(IDX_VAR_WBT_EAVESDROP_AGENT_ID, "variable_wbt_eavesdrop_agent_id") \
+    X(IDX_VAR_WBT_EAVESDROP_STATE, "variable_wbt_eavesdrop_state") \
+    X(IDX_VAR_WBT_START_RECORD, "variable_wbt_start_record") \
+    X(IDX_VAR_WBT_STOP_RECORD, "variable_wbt_stop_record") \
+    X(IDX_VAR_WBT_NOTIFICATION_HANGUP, "variable_wbt_notification_hangup") \
+    X(IDX_VAR_WBT_TRANSFER_TO, "variable_wbt_transfer_to") \
+    X(IDX_VAR_WBT_TRANSFER_FROM, "variable_wbt_transfer_from") \
+    X(IDX_VAR_WBT_TRANSFER_TO_AGENT, "variable_wbt_transfer_to_agent") \
+    X(IDX_VAR_WBT_TRANSFER_FROM_ATTEMPT, "variable_wbt_transfer_from_attempt") \
+    X(IDX_VAR_WBT_TRANSFER_TO_ATTEMPT, "variable_wbt_transfer_to_attempt") \
+    X(IDX_VAR_WBT_TALK_SEC, "variable_wbt_talk_sec") \
+    X(IDX_VAR_WBT_TAGS, "variable_wbt_tags") \
+    X(IDX_VAR_WBT_SCHEMA_IDS, "variable_wbt_schema_ids") \
+    X(IDX_VAR_WBT_AMD_AI, "variable_wbt_amd_ai") \
+    X(IDX_VAR_WBT_AMD_AI_LOG, "variable_wbt_amd_ai_log") \
+    X(IDX_VAR_WBT_AMD_AI_ERROR, "variable_wbt_amd_ai_error") \
+    X(IDX_VAR_WBT_AMD_AI_POSITIVE, "variable_wbt_amd_ai_positive") \
+    X(IDX_VAR_WBT_AMD_AI_LOCAL, "variable_wbt_amd_ai_local") \
+    X(IDX_VAR_WBT_AMD_AI_PARTIAL, "variable_wbt_amd_ai_partial") \
+    X(IDX_VAR_WBT_AMD_AI_CONFIDENCE, "variable_wbt_amd_ai_confidence") \
+    X(IDX_VAR_WBT_AMD_AI_ELAPSED_MS, "variable_wbt_amd_ai_elapsed_ms")
+
+#define EVENT_INDEX_ENUM(id, name) id,
+enum EventHeader {
+    EVENT_INDEX_KNOWN_HEADERS(EVENT_INDEX_ENUM)
+    EVENT_INDEX_SLOTS
+};
+#undef EVENT_INDEX_ENUM
+
+namespace mod_grpc {
+
+    // Walks event headers once and keeps the known ones (EventIndex.cpp) in a slot table,
+    // variable_usr_ and variable_cc_ headers are collected in the same pass.
+    class EventIndex {
+    public:
+        explicit EventIndex(switch_event_t *e);
+
+        inline switch_event_header_t *ptr(EventHeader h) const {
+            return slots_[h];
+        }
+
+        inline const char *get(EventHeader h) const {
+            auto hp = slots_[h];
+            return hp ? hp->value : nullptr;
+        }
+
+        // not known headers
+        switch_event_header_t *ptr(const char *name) const;
+
+        inline const char *get(const char *name) const {
+            auto hp = ptr(name);
+            return hp ? hp->value : nullptr;
+        }
+
+        static const char *name(EventHeader h);
+
+        // nullptr if the prefix is not collected
+        const std::vector<switch_event_header_t *> *group(const char *prefix) const;
+
+        // header is read by the call event builders
+        static bool wanted(const switch_event_header_t *hp);
+
+    private:
+        switch_event_t *e_;
+        switch_event_header_t *slots_[EVENT_INDEX_SLOTS];
+        std::vector<switch_event_header_t *> usr_;
+        std::vector<switch_event_header_t *> cc_;
+    };
+}
+
+#endif //MOD_GRPC_EVENTINDEX_H
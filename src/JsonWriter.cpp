@@ -0,0 +1,172 @@
+//
+// Created by root on 17.10.26.
+//
+
+#include "JsonWriter.h"
+
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace mod_grpc {
+
+    static thread_local std::string local_buf;
+    static thread_local bool local_busy = false;
+
+    JsonWriter::JsonWriter() : first_(true), members_(0) {
+        if (local_busy) {
+            buf_ = &own_;
+        } else {
+            local_busy = true;
+            buf_ = &local_buf;
+            buf_->clear();
+        }
+        buf_->push_back('{');
+        closers_.push_back('}');
+    }
+
+    JsonWriter::~JsonWriter() {
+        if (buf_ == &local_buf) {
+            if (local_buf.capacity() > JSON_WRITER_KEEP_CAPACITY) {
+                std::string().swap(local_buf);
+            }
+            local_busy = false;
+        }
+    }
+
+    void JsonWriter::beginObject(const char *key) {
+        next(key);
+        buf_->push_back('{');
+        closers_.push_back('}');
+        first_ = true;
+    }
+
+    void JsonWriter::endObject() {
+        buf_->push_back(closers_.back());
+        closers_.pop_back();
+        first_ = false;
+    }
+
+    void JsonWriter::beginArray(const char *key) {
+        next(key);
+        buf_->push_back('[');
+        closers_.push_back(']');
+        first_ = true;
+    }
+
+    void JsonWriter::endArray() {
+        buf_->push_back(closers_.back());
+        closers_.pop_back();
+        first_ = false;
+    }
+
+    void JsonWriter::addString(const char *key, const char *val) {
+        next(key);
+        escape(val);
+    }
+
+    // print_number of cJSON
+    void JsonWriter::addNumber(const char *key, double val) {
+        char tmp[64];
+        next(key);
+        if (val <= INT_MAX && val >= INT_MIN && fabs(((double) (int) val) - val) <= DBL_EPSILON) {
+            snprintf(tmp, sizeof(tmp), "%d", (int) val);
+        } else if (fabs(floor(val) - val) <= DBL_EPSILON && fabs(val) < 1.0e60) {
+            snprintf(tmp, sizeof(tmp), "%.0f", val);
+        } else if (fabs(val) < 1.0e-6 || fabs(val) > 1.0e9) {
+            snprintf(tmp, sizeof(tmp), "%e", val);
+        } else {
+            snprintf(tmp, sizeof(tmp), "%f", val);
+        }
+        buf_->append(tmp);
+    }
+
+    void JsonWriter::addBool(const char *key, bool val) {
+        next(key);
+        buf_->append(val ? "true" : "false");
+    }
+
+    void JsonWriter::addRaw(const char *key, const char *val) {
+        next(key);
+        buf_->append(val);
+    }
+
+    const char *JsonWriter::finish() {
+        while (!closers_.empty()) {
+            buf_->push_back(closers_.back());
+            closers_.pop_back();
+        }
+        return buf_->c_str();
+    }
+
+    void JsonWriter::next(const char *key) {
+        if (!first_) {
+            buf_->push_back(',');
+        }
+        first_ = false;
+        if (closers_.size() == 1) {
+            members_++;
+        }
+        if (key) {
+            escape(key);
+            buf_->push_back(':');
+        }
+    }
+
+    void JsonWriter::escape(const char *val) {
+        json_escape(*buf_, val);
+    }
+
+    void json_escape(std::string &out, const char *val) {
+        json_escape(out, val, val ? strlen(val) : 0);
+    }
+
+    // print_string_ptr of cJSON
+    void json_escape(std::string &out, const char *val, size_t len) {
+        out.push_back('"');
+        if (val) {
+            const char *start = val;
+            const char *end = val + len;
+            for (; val != end; val++) {
+                auto c = (unsigned char) *val;
+                if (c > 31 && c != '"' && c != '\\') {
+                    continue;
+                }
+                out.append(start, val - start);
+                start = val + 1;
+                switch (c) {
+                    case '"':
+                        out.append("\\\"");
+                        break;
+                    case '\\':
+                        out.append("\\\\");
+                        break;
+                    case '\b':
+                        out.append("\\b");
+                        break;
+                    case '\f':
+                        out.append("\\f");
+                        break;
+                    case '\n':
+                        out.append("\\n");
+                        break;
+                    case '\r':
+                        out.append("\\r");
+                        break;
+                    case '\t':
+                        out.append("\\t");
+                        break;
+                    default:
+                        char tmp[8];
+                        snprintf(tmp, sizeof(tmp), "\\u%04x", c);
+                        out.append(tmp);
+                        break;
+                }
+            }
+            out.append(start, val - start);
+        }
+        out.push_back('"');
+    }
+}
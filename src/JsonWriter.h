@@ -0,0 +1,63 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_JSONWRITER_H
+#define MOD_GRPC_JSONWRITER_H
+
+#include <string>
+#include <cstddef>
+
+#define JSON_WRITER_KEEP_CAPACITY (64 * 1024)
+
+namespace mod_grpc {
+
+    // quoted json string of val as cJSON prints it, nullptr is ""
+    void json_escape(std::string &out, const char *val);
+    // len bytes of val, it may have no NUL
+    void json_escape(std::string &out, const char *val, size_t len);
+
+    // Append only writer of one JSON object, the output is the same as cJSON_PrintUnformatted
+    // of the equal cJSON tree. Uses a thread local buffer unless the thread already has a writer.
+    // key is nullptr for array items.
+    class JsonWriter {
+    public:
+        JsonWriter();
+        ~JsonWriter();
+        JsonWriter(const JsonWriter &) = delete;
+        JsonWriter &operator=(const JsonWriter &) = delete;
+
+        void beginObject(const char *key = nullptr);
+        void endObject();
+        void beginArray(const char *key = nullptr);
+        void endArray();
+
+        void addString(const char *key, const char *val);
+        void addNumber(const char *key, double val);
+        void addBool(const char *key, bool val);
+        // val must be a valid unformatted json
+        void addRaw(const char *key, const char *val);
+
+        // root object has no members
+        inline bool empty() const {
+            return members_ == 0;
+        }
+
+        // closes the root object, valid until the writer is destroyed
+        const char *finish();
+
+    private:
+        void next(const char *key);
+        void escape(const char *val);
+
+        std::string own_;
+        std::string *buf_;
+        // closing chars of the open containers, no allocation up to the SSO size
+        std::string closers_;
+        // innermost container has no member yet
+        bool first_;
+        size_t members_;
+    };
+}
+
+#endif //MOD_GRPC_JSONWRITER_H
@@ -0,0 +1,317 @@
+//
+// Created by root on 17.10.26.
+//
+
+#include "PushDispatcher.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace mod_grpc {
+
+    PushWait::PushWait() : pending_(0), success_(0) {
+    }
+
+    void PushWait::Add() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_++;
+    }
+
+    void PushWait::Done(long code) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_--;
+        if (code == 200) {
+            success_++;
+        }
+        cond_.notify_all();
+    }
+
+    bool PushWait::Wait(int timeout_ms) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait_for(lock, std::chrono::milliseconds(timeout_ms > 0 ? timeout_ms : 0),
+                       [this] { return success_ > 0 || pending_ <= 0; });
+        return success_ > 0;
+    }
+
+    std::shared_ptr<PushCallbacks::Waiter> PushCallbacks::Add(const std::string &uuid) {
+        auto waiter = std::make_shared<Waiter>();
+        std::lock_guard<std::mutex> lock(mutex_);
+        waiters_[uuid] = waiter;
+        return waiter;
+    }
+
+    void PushCallbacks::Remove(const std::string &uuid, const std::shared_ptr<Waiter> &waiter) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = waiters_.find(uuid);
+        if (it != waiters_.end() && it->second == waiter) {
+            waiters_.erase(it);
+        }
+    }
+
+    bool PushCallbacks::Confirm(const std::string &uuid) {
+        std::shared_ptr<Waiter> waiter;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = waiters_.find(uuid);
+            if (it == waiters_.end()) {
+                return false;
+            }
+            waiter = it->second;
+        }
+        {
+            std::lock_guard<std::mutex> lock(waiter->mutex);
+            waiter->confirmed = true;
+        }
+        waiter->cond.notify_all();
+        return true;
+    }
+
+    void PushCallbacks::Hangup(const std::string &uuid) {
+        std::shared_ptr<Waiter> waiter;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = waiters_.find(uuid);
+            if (it == waiters_.end()) {
+                return;
+            }
+            waiter = it->second;
+        }
+        {
+            std::lock_guard<std::mutex> lock(waiter->mutex);
+            waiter->hangup = true;
+        }
+        waiter->cond.notify_all();
+    }
+
+    bool PushCallbacks::Wait(const std::shared_ptr<Waiter> &waiter, int timeout_ms) {
+        std::unique_lock<std::mutex> lock(waiter->mutex);
+        return waiter->cond.wait_for(lock, std::chrono::milliseconds(timeout_ms > 0 ? timeout_ms : 0),
+                                     [&waiter] { return waiter->confirmed || waiter->hangup; }) && waiter->confirmed;
+    }
+
+    static int64_t now_ms() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    PushRequest::PushRequest() : easy(nullptr), headers(nullptr), provider(-1), probe(false) {
+    }
+
+    PushRequest::~PushRequest() {
+        if (easy) {
+            switch_curl_easy_cleanup(easy);
+        }
+        if (headers) {
+            switch_curl_slist_free_all(headers);
+        }
+    }
+
+    PushDispatcher::PushDispatcher(int max_connections, int keepalive_sec)
+            : multi_(curl_multi_init()), keepalive_ms_((keepalive_sec > 0 ? keepalive_sec : 0) * 1000), running_(false) {
+        curl_multi_setopt(multi_, CURLMOPT_PIPELINING, (long) CURLPIPE_MULTIPLEX);
+        curl_multi_setopt(multi_, CURLMOPT_MAX_HOST_CONNECTIONS, (long) (max_connections > 0 ? max_connections : 1));
+    }
+
+    int PushDispatcher::AddProvider(const std::string &name, const std::string &probe_url,
+                                    std::function<void(CURL *)> setup) {
+        // connect at start
+        providers_.push_back({name, probe_url, std::move(setup), 0, 0, false});
+        return static_cast<int>(providers_.size() - 1);
+    }
+
+    void PushDispatcher::Start() {
+        running_ = true;
+        thread_ = std::thread(&PushDispatcher::Run, this);
+    }
+
+    PushDispatcher::~PushDispatcher() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            running_ = false;
+        }
+#if LIBCURL_VERSION_NUM >= 0x074400
+        curl_multi_wakeup(multi_);
+#endif
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        curl_multi_cleanup(multi_);
+    }
+
+    void PushDispatcher::Send(PushRequest *req) {
+        if (req->wait) {
+            req->wait->Add();
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (running_) {
+                queue_.push_back(req);
+                req = nullptr;
+            }
+        }
+        if (req) {
+            if (req->wait) {
+                req->wait->Done(-1);
+            }
+            delete req;
+            return;
+        }
+#if LIBCURL_VERSION_NUM >= 0x074400
+        curl_multi_wakeup(multi_);
+#endif
+    }
+
+    // HEAD of the provider uri opens the connection or keeps it in use
+    void PushDispatcher::Probe(int provider, int64_t now) {
+        auto &p = providers_[provider];
+        auto cli = switch_curl_easy_init();
+        if (!cli) {
+            p.next_probe_ms = now + PUSH_RECONNECT_MAX_MS;
+            return;
+        }
+
+        auto req = new PushRequest;
+        req->easy = cli;
+        req->name = p.name + " keepalive";
+        req->provider = provider;
+        req->probe = true;
+        p.setup(cli);
+        switch_curl_easy_setopt(cli, CURLOPT_URL, p.probe_url.c_str());
+        switch_curl_easy_setopt(cli, CURLOPT_NOBODY, 1L);
+        switch_curl_easy_setopt(cli, CURLOPT_TIMEOUT_MS, (long) PUSH_PROBE_TIMEOUT_MS);
+        curl_easy_setopt(cli, CURLOPT_PRIVATE, req);
+        if (curl_multi_add_handle(multi_, cli) != CURLM_OK) {
+            delete req;
+            p.next_probe_ms = now + PUSH_RECONNECT_MAX_MS;
+            return;
+        }
+        p.probing = true;
+        active_.insert(req);
+    }
+
+    // any http answer means the connection is alive
+    void PushDispatcher::Complete(PushRequest *req, CURLcode result, int64_t now) {
+        if (req->provider < 0) {
+            return;
+        }
+        auto &p = providers_[req->provider];
+        if (req->probe) {
+            p.probing = false;
+        }
+
+        if (result == CURLE_OK) {
+            if (req->probe && p.backoff_ms) {
+                switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_NOTICE, "push %s connected\n", p.name.c_str());
+            }
+            p.backoff_ms = 0;
+            if (!p.probing) {
+                p.next_probe_ms = keepalive_ms_ ? now + keepalive_ms_ : INT64_MAX;
+            }
+            return;
+        }
+
+        if (p.probing) {
+            return;
+        }
+        p.backoff_ms = p.backoff_ms ? std::min(p.backoff_ms * 2, PUSH_RECONNECT_MAX_MS) : PUSH_RECONNECT_MIN_MS;
+        p.next_probe_ms = now + p.backoff_ms;
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING, "push %s: %s, reconnect in %d ms\n", p.name.c_str(),
+                          curl_easy_strerror(result), p.backoff_ms);
+    }
+
+    void PushDispatcher::Run() {
+        std::vector<PushRequest *> queue;
+        while (running_) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queue.swap(queue_);
+            }
+            for (auto req : queue) {
+                curl_easy_setopt(req->easy, CURLOPT_PRIVATE, req);
+                // wait for a stream of the open connection instead of a new one
+                curl_easy_setopt(req->easy, CURLOPT_PIPEWAIT, 1L);
+                if (curl_multi_add_handle(multi_, req->easy) != CURLM_OK) {
+                    switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_ERROR, "push %s: can't add request\n", req->name.c_str());
+                    if (req->wait) {
+                        req->wait->Done(-1);
+                    }
+                    delete req;
+                    continue;
+                }
+                active_.insert(req);
+            }
+            queue.clear();
+
+            auto now = now_ms();
+            int timeout = PUSH_DISPATCHER_POLL_MS;
+            for (size_t i = 0; i < providers_.size(); i++) {
+                auto &p = providers_[i];
+                if (p.probing) {
+                    continue;
+                }
+                if (p.next_probe_ms <= now) {
+                    Probe(static_cast<int>(i), now);
+                } else if (p.next_probe_ms - now < timeout) {
+                    timeout = static_cast<int>(p.next_probe_ms - now);
+                }
+            }
+
+            int running = 0;
+            curl_multi_perform(multi_, &running);
+
+            CURLMsg *msg;
+            int left;
+            while ((msg = curl_multi_info_read(multi_, &left))) {
+                if (msg->msg != CURLMSG_DONE) {
+                    continue;
+                }
+                PushRequest *req = nullptr;
+                long code = -1;
+                curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &req);
+                if (msg->data.result == CURLE_OK) {
+                    curl_easy_getinfo(msg->easy_handle, CURLINFO_RESPONSE_CODE, &code);
+                } else if (!req->probe) {
+                    switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING, "push %s: %s\n", req->name.c_str(),
+                                      curl_easy_strerror(msg->data.result));
+                }
+                if (!req->probe) {
+                    switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "stop push %s [%ld]\n", req->name.c_str(), code);
+                }
+
+                curl_multi_remove_handle(multi_, msg->easy_handle);
+                active_.erase(req);
+                Complete(req, msg->data.result, now_ms());
+                if (req->done) {
+                    req->done(req, code);
+                }
+                if (req->wait) {
+                    req->wait->Done(code);
+                }
+                delete req;
+            }
+
+#if LIBCURL_VERSION_NUM >= 0x074400
+            curl_multi_poll(multi_, nullptr, 0, timeout > 0 ? timeout : 1, nullptr);
+#else
+            curl_multi_wait(multi_, nullptr, 0, std::min(timeout > 0 ? timeout : 1, PUSH_DISPATCHER_WAIT_MS), nullptr);
+#endif
+        }
+
+        // shutdown
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue.swap(queue_);
+        }
+        for (auto req : active_) {
+            curl_multi_remove_handle(multi_, req->easy);
+            queue.push_back(req);
+        }
+        active_.clear();
+        for (auto req : queue) {
+            if (req->wait) {
+                req->wait->Done(-1);
+            }
+            delete req;
+        }
+    }
+}
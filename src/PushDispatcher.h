@@ -0,0 +1,139 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_PUSHDISPATCHER_H
+#define MOD_GRPC_PUSHDISPATCHER_H
+
+extern "C" {
+#include <switch.h>
+}
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "switch_curl.h"
+
+#define PUSH_DISPATCHER_POLL_MS 1000
+#define PUSH_RECONNECT_MIN_MS 500
+#define PUSH_RECONNECT_MAX_MS 60000
+#define PUSH_PROBE_TIMEOUT_MS 5000
+// libcurl < 7.68 has no curl_multi_wakeup, the queue is checked at least this often
+#define PUSH_DISPATCHER_WAIT_MS 10
+
+namespace mod_grpc {
+
+    // Pushes of one call, the channel thread waits on it
+    class PushWait {
+    public:
+        PushWait();
+
+        void Add();
+        void Done(long code);
+        // waits for the first accepted push, the last answer or timeout_ms; true if a push is accepted
+        bool Wait(int timeout_ms);
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cond_;
+        int pending_;
+        int success_;
+    };
+
+    // Calls of wbt_send_hook waiting for the device, ConfirmPush or the hangup wakes the call at once
+    class PushCallbacks {
+    public:
+        struct Waiter {
+            std::mutex mutex;
+            std::condition_variable cond;
+            bool confirmed = false;
+            bool hangup = false;
+        };
+
+        // before the push is sent, the confirm may come before Wait
+        std::shared_ptr<Waiter> Add(const std::string &uuid);
+        void Remove(const std::string &uuid, const std::shared_ptr<Waiter> &waiter);
+        // false if the call doesn't wait
+        bool Confirm(const std::string &uuid);
+        void Hangup(const std::string &uuid);
+        // true if confirmed
+        static bool Wait(const std::shared_ptr<Waiter> &waiter, int timeout_ms);
+
+    private:
+        std::mutex mutex_;
+        std::unordered_map<std::string, std::shared_ptr<Waiter>> waiters_;
+    };
+
+    struct PushRequest {
+        PushRequest();
+        ~PushRequest();
+
+        CURL *easy;
+        switch_curl_slist_t *headers;
+        std::string body;
+        // provider and device for the log
+        std::string name;
+        std::shared_ptr<PushWait> wait;
+        // index of AddProvider or -1
+        int provider;
+        bool probe;
+        // answer body, if the request writes to it
+        std::string response;
+        // device tokens in the order of the body
+        std::vector<std::string> devices;
+        // dispatcher thread, before the wait is done; code -1 if there is no answer
+        std::function<void(const PushRequest *req, long code)> done;
+    };
+
+    // Push service with a kept connection: an idle connection is probed every keepalive_sec,
+    // a broken one is reconnected with a backoff
+    struct PushProvider {
+        std::string name;
+        std::string probe_url;
+        // options of the connection, the same for the requests and the probes
+        std::function<void(CURL *)> setup;
+        int64_t next_probe_ms;
+        int backoff_ms;
+        bool probing;
+    };
+
+    // All pushes run concurrently on one curl_multi thread, requests to a provider are
+    // multiplexed over max_connections HTTP/2 connections
+    class PushDispatcher {
+    public:
+        PushDispatcher(int max_connections, int keepalive_sec);
+        ~PushDispatcher();
+
+        // before Start, returns the provider of PushRequest
+        int AddProvider(const std::string &name, const std::string &probe_url, std::function<void(CURL *)> setup);
+        void Start();
+
+        // takes the request, its easy handle must be ready to perform
+        void Send(PushRequest *req);
+
+    private:
+        void Run();
+        void Probe(int provider, int64_t now);
+        void Complete(PushRequest *req, CURLcode result, int64_t now);
+
+        CURLM *multi_;
+        const int keepalive_ms_;
+        // dispatcher thread after Start
+        std::vector<PushProvider> providers_;
+        std::atomic<bool> running_;
+        std::mutex mutex_;
+        std::vector<PushRequest *> queue_;
+        // dispatcher thread
+        std::unordered_set<PushRequest *> active_;
+        std::thread thread_;
+    };
+}
+
+#endif //MOD_GRPC_PUSHDISPATCHER_H
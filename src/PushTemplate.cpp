@@ -0,0 +1,107 @@
+//
+// Created by root on 17.10.26.
+//
+
+#include "PushTemplate.h"
+#include "JsonWriter.h"
+
+#include <cstring>
+
+namespace mod_grpc {
+
+    PushTemplate::PushTemplate(const char *tpl, int ttl) : size_(0) {
+        static const struct {
+            const char *name;
+            Field field;
+        } names[] = {{"call_id",     CALL_ID},
+                     {"from_number", FROM_NUMBER},
+                     {"from_name",   FROM_NAME},
+                     {"direction",   DIRECTION},
+                     {"auto_answer", AUTO_ANSWER},
+                     {"devices",     DEVICES}};
+
+        std::string text;
+        const char *p = tpl;
+        while (*p) {
+            const char *end;
+            if (p[0] != '$' || p[1] != '{' || !(end = strchr(p + 2, '}'))) {
+                text.push_back(*p++);
+                continue;
+            }
+
+            std::string name(p + 2, end - p - 2);
+            p = end + 1;
+            if (name == "ttl") {
+                text.append(std::to_string(ttl));
+                continue;
+            }
+
+            auto field = NONE;
+            for (auto &n : names) {
+                if (name == n.name) {
+                    field = n.field;
+                    break;
+                }
+            }
+            if (field == NONE) {
+                text.append("${").append(name).append("}");
+                continue;
+            }
+            size_ += text.size();
+            parts_.push_back({std::move(text), field});
+            text.clear();
+        }
+        size_ += text.size();
+        parts_.push_back({std::move(text), NONE});
+    }
+
+    void PushTemplate::Render(const PushData *data, const char *devices, std::string &out) const {
+        out.clear();
+        out.reserve(size_ + data->call_id.size() + data->from_number.size() + data->from_name.size() +
+                    data->direction.size() + (devices ? strlen(devices) : 0) + 64);
+
+        for (auto &part : parts_) {
+            out.append(part.text);
+            switch (part.field) {
+                case CALL_ID:
+                    json_escape(out, data->call_id.c_str());
+                    break;
+                case FROM_NUMBER:
+                    json_escape(out, data->from_number.c_str());
+                    break;
+                case FROM_NAME:
+                    json_escape(out, data->from_name.c_str());
+                    break;
+                case DIRECTION:
+                    json_escape(out, data->direction.c_str());
+                    break;
+                case AUTO_ANSWER:
+                    out.append(std::to_string(data->auto_answer));
+                    break;
+                case DEVICES: {
+                    const char *d = devices ? devices : "";
+                    bool first = true;
+                    while (true) {
+                        auto sep = strstr(d, "::");
+                        auto len = sep ? static_cast<size_t>(sep - d) : strlen(d);
+                        // "a::::b::" has no empty tokens
+                        if (len) {
+                            if (!first) {
+                                out.push_back(',');
+                            }
+                            first = false;
+                            json_escape(out, d, len);
+                        }
+                        if (!sep) {
+                            break;
+                        }
+                        d = sep + 2;
+                    }
+                    break;
+                }
+                case NONE:
+                    break;
+            }
+        }
+    }
+}
@@ -0,0 +1,53 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_PUSHTEMPLATE_H
+#define MOD_GRPC_PUSHTEMPLATE_H
+
+#include <string>
+#include <vector>
+
+// payload of the call push, string fields are quoted and escaped
+#define PUSH_CALL_TEMPLATE "{\"type\":\"call\", \"call_id\":${call_id},\"from_number\":${from_number}," \
+    "\"from_name\":${from_name},\"direction\":${direction},\"auto_answer\":${auto_answer}}"
+// ${devices}: "token1","token2" of the :: separated list, empty tokens are skipped
+#define PUSH_FCM_TEMPLATE "{\"time_to_live\":${ttl},\"data\":" PUSH_CALL_TEMPLATE \
+    ",\"registration_ids\":[${devices}],\"priority\":10}"
+#define PUSH_APN_TEMPLATE "{\"aps\":" PUSH_CALL_TEMPLATE ",\"priority\":10}"
+
+namespace mod_grpc {
+
+    struct PushData {
+        std::string call_id;
+        std::string from_number;
+        std::string from_name;
+        std::string direction;
+        int auto_answer;
+        int delay;
+    };
+
+    // Body of a push, the template is split into literals and fields once at the config load
+    class PushTemplate {
+    public:
+        // ttl is fixed for the module
+        PushTemplate(const char *tpl, int ttl);
+
+        void Render(const PushData *data, const char *devices, std::string &out) const;
+
+    private:
+        enum Field {
+            NONE, CALL_ID, FROM_NUMBER, FROM_NAME, DIRECTION, AUTO_ANSWER, DEVICES
+        };
+
+        struct Part {
+            std::string text;
+            Field field;
+        };
+
+        std::vector<Part> parts_;
+        size_t size_;
+    };
+}
+
+#endif //MOD_GRPC_PUSHTEMPLATE_H
@@ -0,0 +1,64 @@
+//
+// Created by root on 17.10.26.
+//
+
+#include "PushTokenCache.h"
+
+#include <chrono>
+
+namespace mod_grpc {
+
+    static int64_t now_ms() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    PushTokenCache::PushTokenCache(size_t capacity, int ttl_sec)
+            : capacity_(capacity), ttl_ms_((int64_t) (ttl_sec > 0 ? ttl_sec : 0) * 1000) {
+    }
+
+    bool PushTokenCache::Add(const std::string &token) {
+        if (!capacity_ || token.empty()) {
+            return false;
+        }
+        auto expire = now_ms() + ttl_ms_;
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(token);
+        if (it != index_.end()) {
+            auto fresh = it->second->expire_ms > expire - ttl_ms_;
+            it->second->expire_ms = expire;
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return !fresh;
+        }
+        if (lru_.size() >= capacity_) {
+            index_.erase(lru_.back().token);
+            lru_.pop_back();
+        }
+        lru_.push_front({token, expire});
+        index_[token] = lru_.begin();
+        return true;
+    }
+
+    bool PushTokenCache::Dead(const std::string &token) {
+        if (!capacity_) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(token);
+        if (it == index_.end()) {
+            return false;
+        }
+        if (it->second->expire_ms <= now_ms()) {
+            lru_.erase(it->second);
+            index_.erase(it);
+            return false;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return true;
+    }
+
+    size_t PushTokenCache::Size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return lru_.size();
+    }
+}
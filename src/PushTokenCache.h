@@ -0,0 +1,44 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_PUSHTOKENCACHE_H
+#define MOD_GRPC_PUSHTOKENCACHE_H
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace mod_grpc {
+
+    // Device tokens rejected by a push provider. The oldest token goes out when the cache is full,
+    // a token is tried again after ttl_sec.
+    class PushTokenCache {
+    public:
+        // capacity 0 disables the cache
+        PushTokenCache(size_t capacity, int ttl_sec);
+
+        // false if the token is already known
+        bool Add(const std::string &token);
+        bool Dead(const std::string &token);
+
+        size_t Size();
+
+    private:
+        struct Entry {
+            std::string token;
+            int64_t expire_ms;
+        };
+
+        const size_t capacity_;
+        const int64_t ttl_ms_;
+        std::mutex mutex_;
+        // most recent first
+        std::list<Entry> lru_;
+        std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    };
+}
+
+#endif //MOD_GRPC_PUSHTOKENCACHE_H
@@ -3,3 +3,640 @@
 //
 
 #include "amd_client.h"
+
+int64_t steady_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const int LatencyHistogram::bounds_[AMD_LATENCY_BUCKETS] = {10, 20, 50, 100, 200, 500, 1000, 2000, 5000};
+
+LatencyHistogram::LatencyHistogram() : sum_ms_(0) {
+    for (auto &c : counts_) {
+        c = 0;
+    }
+}
+
+void LatencyHistogram::Record(int64_t ms) {
+    int i = 0;
+    while (i < AMD_LATENCY_BUCKETS && ms > bounds_[i]) {
+        i++;
+    }
+    counts_[i]++;
+    sum_ms_ += static_cast<uint64_t>(ms > 0 ? ms : 0);
+}
+
+void LatencyHistogram::Print(std::string &out) const {
+    char line[64];
+    uint64_t total = 0;
+    for (int i = 0; i <= AMD_LATENCY_BUCKETS; i++) {
+        auto c = counts_[i].load();
+        total += c;
+        if (i < AMD_LATENCY_BUCKETS) {
+            snprintf(line, sizeof(line), "<= %dms: %lu\n", bounds_[i], (unsigned long) c);
+        } else {
+            snprintf(line, sizeof(line), "> %dms: %lu\n", bounds_[i - 1], (unsigned long) c);
+        }
+        out.append(line);
+    }
+    snprintf(line, sizeof(line), "count: %lu, avg: %lums\n", (unsigned long) total,
+             (unsigned long) (total ? sum_ms_ / total : 0));
+    out.append(line);
+}
+
+AMDEndpoint::AMDEndpoint(std::string address, int eject_sec) : address(std::move(address)),
+                                                              eject_ms_((eject_sec > 0 ? eject_sec : 0) * 1000),
+                                                              ejected_until_(0) {
+}
+
+void AMDEndpoint::Fail() {
+    if (!eject_ms_) {
+        return;
+    }
+    ejected_until_ = steady_ms() + eject_ms_;
+    switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING, "AMD endpoint %s ejected for %d sec\n", address.c_str(),
+                      eject_ms_ / 1000);
+}
+
+AudioRing::AudioRing(size_t capacity) : head_(0), tail_(0) {
+    size_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    slots_.reset(new Slot[size]);
+    mask_ = size - 1;
+}
+
+void AudioRing::push(const uint8_t *data, size_t len, int32_t vad, int32_t energy) {
+    auto head = head_.load(std::memory_order_relaxed);
+    auto &slot = slots_[head & mask_];
+    slot.len = static_cast<uint32_t>(len);
+    slot.vad = vad;
+    slot.energy = energy;
+    memcpy(slot.data, data, len);
+    head_.store(head + 1, std::memory_order_release);
+}
+
+bool AudioRing::dropOldest() {
+    auto tail = tail_.load(std::memory_order_acquire);
+    return tail != head_.load(std::memory_order_relaxed) &&
+           tail_.compare_exchange_strong(tail, tail + 1, std::memory_order_acq_rel);
+}
+
+bool AudioRing::pop(::amd::StreamPCMRequest *msg, size_t min_bytes, bool flush) {
+    while (true) {
+        auto tail = tail_.load(std::memory_order_acquire);
+        auto head = head_.load(std::memory_order_acquire);
+        if (tail == head) {
+            return false;
+        }
+
+        size_t bytes = 0;
+        auto end = tail;
+        while (end != head && (bytes < min_bytes || end == tail)) {
+            auto len = slots_[end & mask_].len;
+            bytes += len < AMD_RING_SLOT_BYTES ? len : AMD_RING_SLOT_BYTES;
+            end++;
+        }
+        if (bytes < min_bytes && !flush) {
+            return false;
+        }
+
+        auto chunk = msg->mutable_chunk();
+        chunk->clear();
+        msg->clear_vads();
+        msg->clear_energies();
+        bool energy = false;
+        for (auto i = tail; i != end; i++) {
+            auto &slot = slots_[i & mask_];
+            auto len = slot.len;
+            chunk->append(reinterpret_cast<const char *>(slot.data), len < AMD_RING_SLOT_BYTES ? len : AMD_RING_SLOT_BYTES);
+            msg->add_vads(slot.vad);
+            msg->set_vad(slot.vad);
+            msg->add_energies(slot.energy);
+            msg->set_energy(slot.energy);
+            energy |= slot.energy != 0;
+        }
+        if (end - tail == 1 || !energy) {
+            msg->clear_energies();
+        }
+        if (end - tail == 1) {
+            msg->clear_vads();
+        }
+        // a slot was dropped and may be overwritten, the copy is not used
+        if (tail_.compare_exchange_strong(tail, end, std::memory_order_acq_rel)) {
+            return true;
+        }
+    }
+}
+
+AsyncClientCall::AsyncClientCall(size_t buffer_frames, bool abort_on_overflow)
+        : reply_elapsed_ms(0), dataReady(false), sub_(nullptr), latency_(nullptr), created_ms_(steady_ms()), start_ms_(0),
+          ring_(buffer_frames), abort_on_overflow_(abort_on_overflow), aggregate_bytes_(0), started_(false),
+          bound_(false), continuous_(false), ready_(false), failed_(false), closing_(false), aborted_(false),
+          abandoned_(false), writing_(false), pending_(0),
+          frames_(0), dropped_(0), metadata_sent_(false), audio_written_(false), first_acked_(false), start_tag_{this, START}, write_tag_{this, WRITE},
+          read_tag_{this, READ}, writes_done_tag_{this, WRITES_DONE}, finish_tag_{this, FINISH},
+          writes_done_(false), finishing_(false), finished_(false) {
+}
+
+AsyncClientCall::~AsyncClientCall() {
+    if (sub_) {
+        sub_->in_flight--;
+    }
+    switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "Destroy AsyncClientCall\n");
+}
+
+void AsyncClientCall::Start() {
+    pending_++;
+    rw->StartCall(&start_tag_);
+}
+
+void AsyncClientCall::Bind(const ::amd::StreamPCMRequest &metadata, size_t aggregate_bytes, bool continuous) {
+    metadata_ = metadata;
+    aggregate_bytes_ = aggregate_bytes;
+    continuous_ = continuous;
+    bound_ = true;
+    Kick();
+}
+
+bool AsyncClientCall::WaitStarted() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto done = cond_.wait_for(lock, std::chrono::milliseconds(AMD_CALL_START_TIMEOUT_MS),
+                               [this] { return failed_ || ready_; });
+    return done && !failed_;
+}
+
+// media bug thread
+bool AsyncClientCall::Write(const void *data, size_t len, switch_vad_state_t vad, int32_t energy) {
+    if (failed_ || closing_ || aborted_) {
+        return false;
+    }
+
+    auto p = static_cast<const uint8_t *>(data);
+    while (len > 0) {
+        auto n = len > AMD_RING_SLOT_BYTES ? AMD_RING_SLOT_BYTES : len;
+        if (ring_.full()) {
+            if (abort_on_overflow_) {
+                aborted_ = true;
+                dataReady = true;
+                return false;
+            }
+            if (ring_.dropOldest()) {
+                dropped_++;
+            }
+        }
+        ring_.push(p, n, vad, energy);
+        frames_++;
+        p += n;
+        len -= n;
+    }
+
+    Kick();
+    return true;
+}
+
+// Takes the write turn and starts the next write, the turn is kept until its completion
+void AsyncClientCall::Kick() {
+    while (started_ && bound_ && !failed_) {
+        bool expected = false;
+        if (!writing_.compare_exchange_strong(expected, true)) {
+            return;
+        }
+
+        if (!metadata_sent_) {
+            metadata_sent_ = true;
+            pending_++;
+            rw->Write(metadata_, &write_tag_);
+            return;
+        }
+
+        if (ring_.pop(&write_msg_, aggregate_bytes_, closing_)) {
+            audio_written_ = true;
+            pending_++;
+            rw->Write(write_msg_, &write_tag_);
+            return;
+        }
+
+        writing_ = false;
+        // a frame pushed after the pop must not be left behind
+        if (ring_.empty() || (!closing_ && aggregate_bytes_ > AMD_RING_SLOT_BYTES)) {
+            return;
+        }
+    }
+}
+
+bool AsyncClientCall::Finish() {
+    closing_ = true;
+    if (aborted_) {
+        context.TryCancel();
+    } else {
+        // the rest of the aggregation window
+        Kick();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    CloseLocked();
+    auto done = [this] { return finished_ && pending_ == 0; };
+    if (!cond_.wait_for(lock, std::chrono::milliseconds(AMD_CALL_FINISH_TIMEOUT_MS), done)) {
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING, "AsyncClientCall::Finish timeout, cancel\n");
+        context.TryCancel();
+        cond_.wait(lock, done);
+    }
+    switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "AsyncClientCall::Finish frames: %lu, dropped: %lu\n",
+                      (unsigned long) frames_, (unsigned long) dropped_);
+
+    // our cancel is not a failure of the endpoint
+    switch (status_.error_code()) {
+        case grpc::StatusCode::UNAVAILABLE:
+        case grpc::StatusCode::DEADLINE_EXCEEDED:
+        case grpc::StatusCode::RESOURCE_EXHAUSTED:
+            if (sub_) {
+                sub_->endpoint->Fail();
+            }
+            break;
+        default:
+            break;
+    }
+    return status_.ok();
+}
+
+// mutex_ is held; after the ring is written sends WritesDone and Finish
+void AsyncClientCall::CloseLocked() {
+    if (!closing_ || finishing_ || writing_ || (!started_ && !failed_)) {
+        return;
+    }
+
+    if (!failed_ && !ring_.empty()) {
+        return;
+    }
+
+    // started_ is set before the completion queue thread kicks the metadata write
+    if (!failed_ && bound_ && !metadata_sent_) {
+        return;
+    }
+
+    if (!failed_ && !writes_done_) {
+        writes_done_ = true;
+        pending_++;
+        rw->WritesDone(&writes_done_tag_);
+        return;
+    }
+
+    finishing_ = true;
+    pending_++;
+    rw->Finish(&status_, &finish_tag_);
+}
+
+void AsyncClientCall::Abandon() {
+    context.TryCancel();
+
+    // whoever sees the last completion of the abandoned call under the lock deletes it
+    std::unique_lock<std::mutex> lock(mutex_);
+    closing_ = true;
+    abandoned_ = true;
+    CloseLocked();
+    if (finished_ && pending_ == 0) {
+        lock.unlock();
+        delete this;
+    }
+}
+
+void AsyncClientCall::TakePartials(std::vector<AMDPartial> &out) {
+    out.clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    out.swap(partials_);
+}
+
+void AsyncClientCall::Proceed(Op op, bool ok) {
+    switch (op) {
+        case START:
+            if (ok) {
+                started_ = true;
+                pending_++;
+                rw->Read(&read_msg_, &read_tag_);
+            } else {
+                failed_ = true;
+                dataReady = true;
+            }
+            Kick();
+            break;
+        case WRITE:
+            if (ok) {
+                ready_ = true;
+                if (audio_written_ && !first_acked_) {
+                    first_acked_ = true;
+                    if (latency_) {
+                        latency_->Record(steady_ms() - start_ms_);
+                    }
+                }
+            } else {
+                failed_ = true;
+                dataReady = true;
+            }
+            writing_ = false;
+            Kick();
+            break;
+        case READ:
+            if (ok) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                // a trailing message without a result does not replace the last label
+                if (!read_msg_.result().empty() || reply.result().empty()) {
+                    reply = read_msg_;
+                    reply_elapsed_ms = steady_ms() - start_ms_;
+                }
+                if (!read_msg_.result().empty()) {
+                    partials_.push_back({read_msg_.result(), read_msg_.confidence(), reply_elapsed_ms});
+                }
+            }
+            // all messages are read before the status
+            if (ok && continuous_) {
+                pending_++;
+                rw->Read(&read_msg_, &read_tag_);
+                break;
+            }
+            dataReady = true;
+            break;
+        case WRITES_DONE:
+        case FINISH:
+            break;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (op == FINISH) {
+        finished_ = true;
+    }
+    pending_--;
+    CloseLocked();
+    if (abandoned_ && finished_ && pending_ == 0) {
+        lock.unlock();
+        delete this;
+        return;
+    }
+    // the call may be deleted by Finish as soon as the lock is released
+    cond_.notify_all();
+}
+
+AMDClient::AMDClient(const char *addresses, int channels, int eject_sec, int threads, int buffer_frames,
+                     bool abort_on_overflow, int aggregate_ms, int warm_streams)
+        : next_channel_(0), next_cq_(0),
+          buffer_frames_(static_cast<size_t>(buffer_frames > 0 ? buffer_frames : 1)), abort_on_overflow_(abort_on_overflow),
+          aggregate_ms_(aggregate_ms > 0 ? aggregate_ms : 0),
+          warm_size_(static_cast<size_t>(warm_streams > 0 ? warm_streams : 0)), stopping_(false),
+          recycle_tag_{nullptr, AsyncClientCall::START} {
+    // the buffer must hold two windows of 20ms frames
+    if (buffer_frames_ < static_cast<size_t>(2 * (aggregate_ms_ / 20 + 1))) {
+        buffer_frames_ = static_cast<size_t>(2 * (aggregate_ms_ / 20 + 1));
+    }
+
+    std::string list(addresses ? addresses : "");
+    size_t pos = 0;
+    while (pos <= list.size()) {
+        auto end = list.find(',', pos);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        auto b = list.find_first_not_of(" \t", pos);
+        auto e = list.find_last_not_of(" \t", end - 1);
+        if (b != std::string::npos && b < end && e >= b) {
+            endpoints_.emplace_back(new AMDEndpoint(list.substr(b, e - b + 1), eject_sec));
+        }
+        pos = end + 1;
+    }
+
+    if (channels < 1) {
+        channels = 1;
+    }
+    for (auto &endpoint : endpoints_) {
+        for (int i = 0; i < channels; ++i) {
+            grpc::ChannelArguments args;
+            // own connection and flow control window of each sub channel
+            args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+            auto sub = new AMDSubChannel;
+            sub->endpoint = endpoint.get();
+            sub->stub = ::amd::Api::NewStub(
+                    grpc::CreateCustomChannel(endpoint->address, grpc::InsecureChannelCredentials(), args));
+            sub->in_flight = 0;
+            channels_.emplace_back(sub);
+        }
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_NOTICE, "AMD endpoint %s, channels %d\n",
+                          endpoint->address.c_str(), channels);
+    }
+
+    if (threads < 1) {
+        threads = 1;
+    }
+    for (int i = 0; i < threads; ++i) {
+        cqs_.emplace_back(new grpc::CompletionQueue);
+    }
+    for (auto &cq : cqs_) {
+        threads_.emplace_back(&AMDClient::Poll, this, cq.get());
+    }
+
+    if (!channels_.empty() && warm_size_) {
+        Refill();
+        std::lock_guard<std::mutex> lock(warm_mutex_);
+        recycle_alarm_.Set(cqs_[0].get(), std::chrono::system_clock::now() + std::chrono::milliseconds(AMD_WARM_CHECK_MS),
+                           &recycle_tag_);
+    }
+}
+
+AMDClient::~AMDClient() {
+    std::deque<AsyncClientCall *> warm;
+    {
+        std::lock_guard<std::mutex> lock(warm_mutex_);
+        warm_size_ = 0;
+        stopping_ = true;
+        warm.swap(warm_);
+    }
+    recycle_alarm_.Cancel();
+    for (auto call : warm) {
+        Discard(call);
+    }
+
+    for (auto &cq : cqs_) {
+        cq->Shutdown();
+    }
+    for (auto &t : threads_) {
+        if (t.joinable()) {
+            t.join();
+        }
+    }
+    channels_.clear();
+    switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "Destroy AMDClient\n");
+}
+
+void AMDClient::Poll(grpc::CompletionQueue *cq) {
+    void *tag;
+    bool ok;
+    while (cq->Next(&tag, &ok)) {
+        auto t = static_cast<AsyncClientCall::Tag *>(tag);
+        if (t->call) {
+            t->call->Proceed(t->op, ok);
+        } else {
+            Recycle(ok);
+        }
+    }
+}
+
+// least loaded of the healthy sub channels, of all when every endpoint is ejected
+AMDSubChannel *AMDClient::Pick() {
+    auto now = steady_ms();
+    auto start = next_channel_++;
+    AMDSubChannel *best = nullptr;
+    bool best_healthy = false;
+    for (size_t i = 0; i < channels_.size(); i++) {
+        auto ch = channels_[(start + i) % channels_.size()].get();
+        auto healthy = ch->endpoint->Healthy(now);
+        if (!best || (healthy && !best_healthy) || (healthy == best_healthy && ch->in_flight < best->in_flight)) {
+            best = ch;
+            best_healthy = healthy;
+        }
+    }
+    best->in_flight++;
+    return best;
+}
+
+AsyncClientCall *AMDClient::Open() {
+    auto *call = new AsyncClientCall(buffer_frames_, abort_on_overflow_);
+    call->sub_ = Pick();
+    call->latency_ = &latency_;
+
+    auto cq = cqs_[next_cq_++ % cqs_.size()].get();
+    call->rw = call->sub_->stub->PrepareAsyncStreamPCM(&call->context, cq);
+    call->Start();
+    return call;
+}
+
+void AMDClient::Refill() {
+    std::lock_guard<std::mutex> lock(warm_mutex_);
+    while (warm_.size() < warm_size_) {
+        warm_.push_back(Open());
+    }
+}
+
+// does not wait, an idle close of the warm stream by a proxy or the server is expected
+void AMDClient::Discard(AsyncClientCall *call) {
+    if (call->StartFailed()) {
+        call->sub_->endpoint->Fail();
+    }
+    call->Abandon();
+}
+
+// oldest usable warm stream, the broken and stale ones are closed
+AsyncClientCall *AMDClient::TakeWarm() {
+    auto now = steady_ms();
+    while (true) {
+        AsyncClientCall *call;
+        {
+            std::lock_guard<std::mutex> lock(warm_mutex_);
+            if (warm_.empty()) {
+                return nullptr;
+            }
+            call = warm_.front();
+            warm_.pop_front();
+        }
+
+        if (!call->failed_ && !call->dataReady && now - call->created_ms_ < AMD_WARM_MAX_AGE_SEC * 1000) {
+            return call;
+        }
+        Discard(call);
+    }
+}
+
+// streams are reopened before the calls need them
+void AMDClient::Recycle(bool ok) {
+    if (!ok) {
+        return;
+    }
+
+    std::vector<AsyncClientCall *> old;
+    auto now = steady_ms();
+    {
+        std::lock_guard<std::mutex> lock(warm_mutex_);
+        if (stopping_) {
+            return;
+        }
+        auto it = warm_.begin();
+        while (it != warm_.end()) {
+            auto call = *it;
+            if (call->failed_ || call->dataReady || now - call->created_ms_ >= AMD_WARM_MAX_AGE_SEC * 1000) {
+                old.push_back(call);
+                it = warm_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    for (auto call : old) {
+        Discard(call);
+    }
+    Refill();
+
+    std::lock_guard<std::mutex> lock(warm_mutex_);
+    if (!stopping_) {
+        recycle_alarm_.Set(cqs_[0].get(), std::chrono::system_clock::now() + std::chrono::milliseconds(AMD_WARM_CHECK_MS),
+                           &recycle_tag_);
+    }
+}
+
+AsyncClientCall *AMDClient::Stream(int64_t domain_id, const char *uuid, const char *name, int32_t rate,
+                                   const char *mime_type, int sample_bytes, bool continuous) {
+    if (channels_.empty()) {
+        return nullptr;
+    }
+
+    auto start_ms = steady_ms();
+    auto *call = warm_size_ ? TakeWarm() : nullptr;
+    auto warm = call != nullptr;
+    if (warm_size_) {
+        Refill();
+    }
+    if (!call) {
+        call = Open();
+    }
+    call->start_ms_ = start_ms;
+
+    ::amd::StreamPCMRequest msg;
+    auto metadata = msg.mutable_metadata();
+    metadata->set_uuid(uuid);
+    metadata->set_name(name);
+    metadata->set_domain_id(domain_id);
+    metadata->set_mime_type(mime_type);
+    metadata->set_sample_rate(rate);
+    call->Bind(msg, static_cast<size_t>(aggregate_ms_) * rate * sample_bytes / 1000, continuous);
+
+    // the warm stream is already open, audio waits in the ring for the metadata
+    if (!warm && !call->WaitStarted()) {
+        call->sub_->endpoint->Fail();
+        call->context.TryCancel();
+        call->Finish();
+        delete call;
+        return nullptr;
+    }
+
+    return call;
+}
+
+void AMDClient::Stats(std::string &out) {
+    char line[256];
+    auto now = steady_ms();
+    for (auto &endpoint : endpoints_) {
+        int in_flight = 0;
+        for (auto &ch : channels_) {
+            if (ch->endpoint == endpoint.get()) {
+                in_flight += ch->in_flight;
+            }
+        }
+        snprintf(line, sizeof(line), "endpoint %s: %s, streams %d\n", endpoint->address.c_str(),
+                 endpoint->Healthy(now) ? "up" : "ejected", in_flight);
+        out.append(line);
+    }
+    {
+        std::lock_guard<std::mutex> lock(warm_mutex_);
+        snprintf(line, sizeof(line), "warm streams: %lu/%lu\n", (unsigned long) warm_.size(), (unsigned long) warm_size_);
+    }
+    out.append(line);
+    out.append("first audio ack:\n");
+    latency_.Print(out);
+}
@@ -9,110 +9,279 @@ extern "C" {
 #include <switch.h>
 }
 
+#include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <memory>
 #include <thread>
-#include <queue>
+#include <vector>
 #include <grpcpp/grpcpp.h>
+#include <grpcpp/alarm.h>
 #include <grpc/support/log.h>
 
 #include <mutex>
-#include <shared_mutex>
+#include <string>
 
 #include "generated/fs.grpc.pb.h"
 #include "generated/stream.grpc.pb.h"
 
+#define AMD_CALL_START_TIMEOUT_MS 5000
+#define AMD_CALL_FINISH_TIMEOUT_MS 5000
+#define AMD_RING_SLOT_BYTES 640
+#define AMD_ENDPOINT_EJECT_SEC 30
+// idle warm streams are reopened, proxies close them anyway
+#define AMD_WARM_MAX_AGE_SEC 60
+// the pool is checked for stale and broken streams on a completion queue thread
+#define AMD_WARM_CHECK_MS 5000
+#define AMD_LATENCY_BUCKETS 9
+
+// Lock free audio queue of one call: the media bug thread is the only producer and the
+// completion queue thread the only consumer. The producer may drop the oldest frame, in that
+// case a concurrent pop of the same slot fails on tail and is retried.
+class AudioRing {
+public:
+    explicit AudioRing(size_t capacity);
+
+    // producer
+    bool full() const {
+        return head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_acquire) > mask_;
+    }
+    void push(const uint8_t *data, size_t len, int32_t vad, int32_t energy);
+    bool dropOldest();
+
+    // consumer: joins frames until min_bytes, nothing is taken if there are less (unless flush)
+    bool pop(::amd::StreamPCMRequest *msg, size_t min_bytes, bool flush);
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Slot {
+        uint32_t len;
+        int32_t vad;
+        int32_t energy;
+        uint8_t data[AMD_RING_SLOT_BYTES];
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    std::atomic<uint64_t> head_;
+    std::atomic<uint64_t> tail_;
+};
+
+int64_t steady_ms();
+
+// Time from wbt_amd to the ack of the first audio message
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    void Record(int64_t ms);
+    void Print(std::string &out) const;
+
+private:
+    static const int bounds_[AMD_LATENCY_BUCKETS];
+    std::atomic<uint64_t> counts_[AMD_LATENCY_BUCKETS + 1];
+    std::atomic<uint64_t> sum_ms_;
+};
+
+// Response of the model, the label may change while the stream goes on
+struct AMDPartial {
+    std::string label;
+    float confidence;
+    int64_t elapsed_ms;
+};
+
+// Model server of amd_ai_address, it is skipped for eject_sec after a failed stream
+class AMDEndpoint {
+public:
+    AMDEndpoint(std::string address, int eject_sec);
+
+    void Fail();
+    bool Healthy(int64_t now_ms) const {
+        return ejected_until_ <= now_ms;
+    }
+
+    const std::string address;
+
+private:
+    const int eject_ms_;
+    std::atomic<int64_t> ejected_until_;
+};
+
+// One connection to an endpoint
+struct AMDSubChannel {
+    AMDEndpoint *endpoint;
+    std::unique_ptr<::amd::Api::Stub> stub;
+    std::atomic<int> in_flight;
+};
+
+// StreamPCM call driven by the completion queue threads of AMDClient.
+// Write never waits on the network: frames go to the ring, the ring is written one message
+// at a time by whichever thread takes the write turn.
 class AsyncClientCall {
 public:
-    void Listen() {
-        rt = std::thread([this] {
-            rw->Read(&this->reply);
-            // mutex ?
-            dataReady = true;
-        });
+    enum Op {
+        START, WRITE, READ, WRITES_DONE, FINISH
+    };
 
+    // completion queue tag, call is nullptr for the warm pool timer
+    struct Tag {
+        AsyncClientCall *call;
+        Op op;
     };
 
+    AsyncClientCall(size_t buffer_frames, bool abort_on_overflow);
+    ~AsyncClientCall();
+
+    // reply is read (the stream is closed by the server if continuous) or the stream is broken
     bool Finished() const {
         return dataReady;
     }
 
-    bool Finish() {
-        rw->WritesDone();
-        rw->Finish();
-        if (rt.joinable()) {
-            rt.join();
-        }
-        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "AsyncClientCall::Finish\n");
-        return true;
+    // ring was full with the abort policy
+    bool Aborted() const {
+        return aborted_;
     }
 
-    inline bool Write(void *data, size_t len, switch_vad_state_t vad) const {
-        ::amd::StreamPCMRequest msg;
-        msg.set_chunk(data, len);
-        msg.set_vad(vad);
-        return rw->Write(msg);
+    uint64_t Frames() const {
+        return frames_;
     }
 
-    inline bool Write(uint8_t *data, size_t len, switch_vad_state_t vad) const {
-        ::amd::StreamPCMRequest msg;
-        msg.set_chunk(data, len);
-        msg.set_vad(vad);
-        return rw->Write(msg);
+    uint64_t Dropped() const {
+        return dropped_;
     }
 
-    ~AsyncClientCall() {
-        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "Destroy AsyncClientCall\n");
-    }
+    // Closes the stream and waits for all operations, after it the call can be deleted
+    bool Finish();
+
+    // energy: RMS of the frame, 0 if unknown
+    bool Write(const void *data, size_t len, switch_vad_state_t vad, int32_t energy = 0);
+
+    void Proceed(Op op, bool ok);
 
+    // responses since the last call
+    void TakePartials(std::vector<AMDPartial> &out);
+
+    // last response with a result (or the last one if none has), valid after Finish
     ::amd::StreamPCMResponse reply;
+    // of the reply since wbt_amd
+    int64_t reply_elapsed_ms;
 
     // Context for the client. It could be used to convey extra information to
     // the server and/or tweak certain RPC behaviors.
     grpc::ClientContext context;
-    std::thread rt;
 
-    bool dataReady = false;
-    std::unique_ptr<::grpc::ClientReaderWriter<::amd::StreamPCMRequest, amd::StreamPCMResponse>> rw;
-};
+    std::atomic<bool> dataReady;
+    std::unique_ptr<::grpc::ClientAsyncReaderWriter<::amd::StreamPCMRequest, amd::StreamPCMResponse>> rw;
 
-class AMDClient {
-public:
-    explicit AMDClient(std::shared_ptr<grpc::Channel> channel)
-            : stub_(::amd::Api::NewStub(channel)) {
-    }
+private:
+    friend class AMDClient;
 
-    ~AMDClient() {
-        stub_.reset();
-        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "Destroy AMDClient\n");
+    void Start();
+    // binds the opened stream to a call, metadata is the first message
+    void Bind(const ::amd::StreamPCMRequest &metadata, size_t aggregate_bytes, bool continuous);
+    bool WaitStarted();
+    void Kick();
+    void CloseLocked();
+    // cancels an unbound call without waiting, the completion queue deletes it
+    void Abandon();
+    // the stream could not be opened, not an idle close of the server
+    bool StartFailed() const {
+        return failed_ && !started_;
     }
 
+    AMDSubChannel *sub_;
+    LatencyHistogram *latency_;
+    int64_t created_ms_;
+    int64_t start_ms_;
+    AudioRing ring_;
+    const bool abort_on_overflow_;
+    size_t aggregate_bytes_;
+    ::amd::StreamPCMRequest metadata_;
+    ::amd::StreamPCMRequest write_msg_;
+    ::amd::StreamPCMResponse read_msg_;
+    std::vector<AMDPartial> partials_;
 
-    AsyncClientCall *Stream(int64_t domain_id, const char *uuid, const char *name, int32_t rate) {
-        //todo
-        auto *call = new AsyncClientCall();
+    std::atomic<bool> started_;
+    std::atomic<bool> bound_;
+    std::atomic<bool> continuous_;
+    std::atomic<bool> ready_;
+    std::atomic<bool> failed_;
+    std::atomic<bool> closing_;
+    std::atomic<bool> aborted_;
+    std::atomic<bool> abandoned_;
+    std::atomic<bool> writing_;
+    std::atomic<int> pending_;
+    std::atomic<uint64_t> frames_;
+    std::atomic<uint64_t> dropped_;
+    // read by CloseLocked, the write turn may be on another thread
+    std::atomic<bool> metadata_sent_;
+    // write turn
+    bool audio_written_;
+    bool first_acked_;
 
-        ::amd::StreamPCMRequest msg;
-        auto metadata = msg.mutable_metadata();
-        metadata->set_uuid(uuid);
-        metadata->set_name(name);
-        metadata->set_domain_id(domain_id);
-        metadata->set_mime_type("audio/pcma");
-        metadata->set_sample_rate(rate);
-
-        call->rw = stub_->StreamPCM(&call->context);
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    Tag start_tag_;
+    Tag write_tag_;
+    Tag read_tag_;
+    Tag writes_done_tag_;
+    Tag finish_tag_;
+    grpc::Status status_;
+    bool writes_done_;
+    bool finishing_;
+    bool finished_;
+};
 
-        if (!call->rw->Write(msg)) {
-            delete call;
-            return nullptr;
-        };
+// All StreamPCM calls are multiplexed on a fixed number of completion queue threads.
+// A call goes to the least loaded sub channel of a healthy endpoint. With warm_streams the calls
+// are opened in advance and only bound to a channel by wbt_amd.
+class AMDClient {
+public:
+    // addresses: comma separated endpoints, channels: connections of each endpoint
+    AMDClient(const char *addresses, int channels, int eject_sec, int threads, int buffer_frames, bool abort_on_overflow,
+              int aggregate_ms, int warm_streams);
+    ~AMDClient();
 
-        call->Listen();
+    // sample_bytes: 2 for 16 bit linear, 1 for G.711
+    // continuous: read all responses until the server closes the stream, otherwise the first one
+    AsyncClientCall *Stream(int64_t domain_id, const char *uuid, const char *name, int32_t rate, const char *mime_type,
+                            int sample_bytes, bool continuous);
 
-        return call;
+    size_t Endpoints() const {
+        return endpoints_.size();
     }
 
+    void Stats(std::string &out);
+
 private:
-    std::unique_ptr<::amd::Api::Stub> stub_;
+    void Poll(grpc::CompletionQueue *cq);
+    AMDSubChannel *Pick();
+    AsyncClientCall *Open();
+    AsyncClientCall *TakeWarm();
+    void Refill();
+    void Discard(AsyncClientCall *call);
+    // completion queue thread, every AMD_WARM_CHECK_MS
+    void Recycle(bool ok);
+
+    std::vector<std::unique_ptr<AMDEndpoint>> endpoints_;
+    std::vector<std::unique_ptr<AMDSubChannel>> channels_;
+    std::atomic<unsigned int> next_channel_;
+    std::vector<std::unique_ptr<grpc::CompletionQueue>> cqs_;
+    std::vector<std::thread> threads_;
+    std::atomic<unsigned int> next_cq_;
+    size_t buffer_frames_;
+    bool abort_on_overflow_;
+    int aggregate_ms_;
+    size_t warm_size_;
+    std::mutex warm_mutex_;
+    std::deque<AsyncClientCall *> warm_;
+    bool stopping_;
+    grpc::Alarm recycle_alarm_;
+    AsyncClientCall::Tag recycle_tag_;
+    LatencyHistogram latency_;
 };
 
 
@@ -0,0 +1,105 @@
+//
+// Created by root on 17.10.26.
+//
+
+#include "amd_prefilter.h"
+#include "vad.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace mod_grpc {
+
+    static inline float goertzel_coeff(int hz) {
+        return static_cast<float>(2.0 * cos(2.0 * M_PI * hz / AMD_LOCAL_RATE));
+    }
+
+    // |X(f)|^2
+    static float goertzel(const int16_t *data, size_t samples, float coeff) {
+        float s1 = 0, s2 = 0;
+        for (size_t i = 0; i < samples; i++) {
+            float s0 = data[i] + coeff * s1 - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+        return s1 * s1 + s2 * s2 - coeff * s1 * s2;
+    }
+
+    AmdPrefilter::AmdPrefilter(int threshold, int silence_ms, bool fax, int beep_ms)
+            : threshold_(static_cast<uint32_t>(threshold > 0 ? threshold : AMD_LOCAL_DEFAULT_THRESHOLD)),
+              silence_ms_(silence_ms > 0 ? silence_ms : 0), fax_(fax), beep_ms_(beep_ms > 0 ? beep_ms : 0),
+              elapsed_ms_(0), voice_ms_(0), voice_seen_(false), fax_ms_(0), tone_bin_(-1), tone_ms_(0) {
+        for (int i = 0; i < AMD_LOCAL_BEEP_BINS; i++) {
+            beep_coeffs_[i] = goertzel_coeff(AMD_LOCAL_BEEP_MIN_HZ + i * AMD_LOCAL_BEEP_STEP_HZ);
+        }
+    }
+
+    const char *AmdPrefilter::process(const int16_t *data, size_t samples) {
+        if (!samples) {
+            return nullptr;
+        }
+
+        uint32_t rms, crossings;
+        frame_stats(data, samples, &rms, &crossings);
+        auto frame_ms = static_cast<int>(samples * 1000 / AMD_LOCAL_RATE);
+        elapsed_ms_ += frame_ms;
+
+        if (!voice_seen_) {
+            voice_ms_ = rms >= threshold_ ? voice_ms_ + frame_ms : 0;
+            voice_seen_ = voice_ms_ >= AMD_LOCAL_VOICE_MS;
+            if (!voice_seen_ && silence_ms_ && elapsed_ms_ >= silence_ms_) {
+                return AMD_LOCAL_SILENCE;
+            }
+        }
+
+        if ((!fax_ && !beep_ms_) || rms < threshold_) {
+            fax_ms_ = 0;
+            tone_bin_ = -1;
+            tone_ms_ = 0;
+            return nullptr;
+        }
+
+        // a pure tone on the bin gives 1
+        auto norm = 2.0f / (static_cast<float>(samples) * static_cast<float>(samples) * rms * rms);
+
+        if (fax_) {
+            auto ced = goertzel(data, samples, goertzel_coeff(2100)) * norm;
+            auto cng = goertzel(data, samples, goertzel_coeff(1100)) * norm;
+            if (ced >= AMD_LOCAL_TONE_PURITY || cng >= AMD_LOCAL_TONE_PURITY) {
+                fax_ms_ += frame_ms;
+                tone_bin_ = -1;
+                tone_ms_ = 0;
+                return fax_ms_ >= AMD_LOCAL_FAX_MS ? AMD_LOCAL_FAX : nullptr;
+            }
+            fax_ms_ = 0;
+        }
+
+        if (beep_ms_) {
+            int bin = -1;
+            float best = 0;
+            for (int i = 0; i < AMD_LOCAL_BEEP_BINS; i++) {
+                auto p = goertzel(data, samples, beep_coeffs_[i]);
+                if (p > best) {
+                    best = p;
+                    bin = i;
+                }
+            }
+
+            if (best * norm < AMD_LOCAL_TONE_PURITY) {
+                tone_bin_ = -1;
+                tone_ms_ = 0;
+            } else if (tone_bin_ >= 0 && abs(bin - tone_bin_) <= 1) {
+                tone_ms_ += frame_ms;
+            } else {
+                tone_bin_ = bin;
+                tone_ms_ = frame_ms;
+            }
+
+            if (tone_ms_ >= beep_ms_) {
+                return AMD_LOCAL_BEEP;
+            }
+        }
+
+        return nullptr;
+    }
+}
@@ -0,0 +1,56 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_AMD_PREFILTER_H
+#define MOD_GRPC_AMD_PREFILTER_H
+
+#include <cstddef>
+#include <cstdint>
+
+#define AMD_LOCAL_SILENCE "silence"
+#define AMD_LOCAL_FAX "fax"
+#define AMD_LOCAL_BEEP "beep"
+
+#define AMD_LOCAL_RATE 8000
+#define AMD_LOCAL_DEFAULT_THRESHOLD 100
+// voice that ends the initial silence
+#define AMD_LOCAL_VOICE_MS 60
+// CED 2100 Hz lasts 2.6 - 4 s, CNG 1100 Hz 0.5 s
+#define AMD_LOCAL_FAX_MS 500
+// part of the frame energy in one tone
+#define AMD_LOCAL_TONE_PURITY 0.6
+#define AMD_LOCAL_BEEP_MIN_HZ 300
+#define AMD_LOCAL_BEEP_MAX_HZ 2000
+#define AMD_LOCAL_BEEP_STEP_HZ 25
+#define AMD_LOCAL_BEEP_BINS ((AMD_LOCAL_BEEP_MAX_HZ - AMD_LOCAL_BEEP_MIN_HZ) / AMD_LOCAL_BEEP_STEP_HZ + 1)
+
+namespace mod_grpc {
+
+    // Decides the obvious AMD cases without the model: a long silence after the answer,
+    // a fax / modem tone and a continuous beep. Works on the 8 kHz frames sent to the model.
+    class AmdPrefilter {
+    public:
+        // silence_ms, beep_ms: 0 disables the detector
+        AmdPrefilter(int threshold, int silence_ms, bool fax, int beep_ms);
+
+        // label of the decision or nullptr
+        const char *process(const int16_t *data, size_t samples);
+
+    private:
+        uint32_t threshold_;
+        int silence_ms_;
+        bool fax_;
+        int beep_ms_;
+
+        int elapsed_ms_;
+        int voice_ms_;
+        bool voice_seen_;
+        int fax_ms_;
+        int tone_bin_;
+        int tone_ms_;
+        float beep_coeffs_[AMD_LOCAL_BEEP_BINS];
+    };
+}
+
+#endif //MOD_GRPC_AMD_PREFILTER_H
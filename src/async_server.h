@@ -0,0 +1,277 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_ASYNC_SERVER_H
+#define MOD_GRPC_ASYNC_SERVER_H
+
+extern "C" {
+#include <switch.h>
+}
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <grpcpp/grpcpp.h>
+
+#include "generated/fs.grpc.pb.h"
+
+namespace mod_grpc {
+
+    class ApiServiceImpl;
+
+    // Tag placed on a server completion queue
+    class CallData {
+    public:
+        virtual ~CallData() = default;
+        virtual void Proceed(bool ok) = 0;
+    };
+
+    // One pending unary call of fs::Api. The call re-arms itself as soon as a request arrives,
+    // then runs the handler either on the poller thread or on a FreeSWITCH pool thread (detached).
+    template<class Req, class Resp>
+    class UnaryCall final : public CallData {
+    public:
+        typedef void (fs::Api::AsyncService::*RequestMethod)(grpc::ServerContext *, Req *,
+                                                             grpc::ServerAsyncResponseWriter<Resp> *,
+                                                             grpc::CompletionQueue *, grpc::ServerCompletionQueue *,
+                                                             void *);
+        typedef grpc::Status (ApiServiceImpl::*Handler)(grpc::ServerContext *, const Req *, Resp *);
+
+        UnaryCall(fs::Api::AsyncService *service, grpc::ServerCompletionQueue *cq, ApiServiceImpl *api,
+                  RequestMethod request, Handler handler, std::atomic<int> *detached)
+                : service_(service), cq_(cq), api_(api), request_(request), handler_(handler),
+                  detached_(detached), responder_(&ctx_), finished_(false) {
+            (service_->*request_)(&ctx_, &req_, &responder_, cq_, cq_, this);
+        }
+
+        void Proceed(bool ok) override {
+            if (!ok || finished_) {
+                delete this;
+                return;
+            }
+
+            new UnaryCall(service_, cq_, api_, request_, handler_, detached_);
+            finished_ = true;
+
+            if (detached_) {
+                auto td = (switch_thread_data_t *) calloc(1, sizeof(switch_thread_data_t));
+                ++(*detached_);
+                td->func = UnaryCall::run;
+                td->obj = this;
+                td->alloc = 1;
+                switch_thread_pool_launch_thread(&td);
+            } else {
+                Process();
+            }
+        }
+
+    private:
+        static void *SWITCH_THREAD_FUNC run(switch_thread_t *thread, void *obj) {
+            auto call = static_cast<UnaryCall *>(obj);
+            auto detached = call->detached_;
+            call->Process();
+            // call may already be deleted by the poller
+            --(*detached);
+            return nullptr;
+        }
+
+        void Process() {
+            auto status = (api_->*handler_)(&ctx_, &req_, &reply_);
+            responder_.Finish(reply_, status, this);
+        }
+
+        fs::Api::AsyncService *service_;
+        grpc::ServerCompletionQueue *cq_;
+        ApiServiceImpl *api_;
+        RequestMethod request_;
+        Handler handler_;
+        std::atomic<int> *detached_;
+
+        grpc::ServerContext ctx_;
+        Req req_;
+        Resp reply_;
+        grpc::ServerAsyncResponseWriter<Resp> responder_;
+        bool finished_;
+    };
+
+    // Pending server streaming call of fs::Api. Send and Close are thread safe: messages are queued
+    // and written one at a time from the completion queue. A client that goes away is seen by the
+    // done tag, the object deletes itself after both Finish and the done tag.
+    template<class Req, class Resp>
+    class ServerStreamCall : public CallData {
+    public:
+        typedef void (fs::Api::AsyncService::*RequestMethod)(grpc::ServerContext *, Req *,
+                                                             grpc::ServerAsyncWriter<Resp> *,
+                                                             grpc::CompletionQueue *, grpc::ServerCompletionQueue *,
+                                                             void *);
+
+        ServerStreamCall(fs::Api::AsyncService *service, grpc::ServerCompletionQueue *cq, RequestMethod request)
+                : service_(service), cq_(cq), request_(request), writer_(&ctx_), done_tag_(this), state_(CREATE),
+                  writing_(false), finishing_(false), cancelled_(false), finished_(false), done_(false) {
+        }
+
+        // Must be called once the derived object is constructed
+        void Arm() {
+            // the done tag comes only for a started call
+            ctx_.AsyncNotifyWhenDone(&done_tag_);
+            (service_->*request_)(&ctx_, &req_, &writer_, cq_, cq_, this);
+        }
+
+        void Proceed(bool ok) override {
+            std::unique_lock<std::mutex> lock(mutex_);
+            switch (state_) {
+                case CREATE:
+                    if (!ok) {
+                        lock.unlock();
+                        delete this;
+                        return;
+                    }
+                    state_ = STREAM;
+                    if (finishing_) {
+                        // the client is gone before the request was handled
+                        state_ = FINISH;
+                        writer_.Finish(status_, this);
+                        lock.unlock();
+                        Spawn();
+                        return;
+                    }
+                    lock.unlock();
+                    Spawn();
+                    OnRequest();
+                    return;
+
+                case STREAM:
+                    writing_ = false;
+                    queue_.pop_front();
+                    if (!ok) {
+                        cancelled_ = true;
+                        queue_.clear();
+                    }
+                    if (!queue_.empty()) {
+                        writing_ = true;
+                        writer_.Write(queue_.front(), this);
+                    } else if (finishing_) {
+                        state_ = FINISH;
+                        writer_.Finish(status_, this);
+                    }
+                    return;
+
+                case FINISH:
+                    finished_ = true;
+                    if (done_) {
+                        lock.unlock();
+                        delete this;
+                    }
+                    return;
+            }
+        }
+
+        bool Send(const Resp &msg) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (state_ != STREAM || finishing_ || cancelled_) {
+                return false;
+            }
+            queue_.push_back(msg);
+            if (!writing_) {
+                writing_ = true;
+                writer_.Write(queue_.front(), this);
+            }
+            return true;
+        }
+
+        // The caller must not touch the call after Close
+        void Close(const grpc::Status &status) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (finishing_) {
+                return;
+            }
+            finishing_ = true;
+            status_ = status;
+            if (state_ == STREAM && !writing_) {
+                state_ = FINISH;
+                writer_.Finish(status_, this);
+            }
+        }
+
+        // closed or done, Send fails
+        bool Finishing() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return finishing_ || cancelled_;
+        }
+
+        bool Cancelled() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return cancelled_;
+        }
+
+        size_t Pending() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return queue_.size();
+        }
+
+    protected:
+        // Put a new pending call on the queue
+        virtual void Spawn() = 0;
+        // Request is read, start to produce messages
+        virtual void OnRequest() = 0;
+        // The call is finished or cancelled by the client, stop sending to it
+        virtual void OnDone() {
+        }
+
+        fs::Api::AsyncService *service_;
+        grpc::ServerCompletionQueue *cq_;
+        grpc::ServerContext ctx_;
+        Req req_;
+
+    private:
+        enum State {
+            CREATE, STREAM, FINISH
+        };
+
+        class DoneTag final : public CallData {
+        public:
+            explicit DoneTag(ServerStreamCall *call) : call_(call) {
+            }
+
+            void Proceed(bool ok) override {
+                call_->Done();
+            }
+
+        private:
+            ServerStreamCall *call_;
+        };
+
+        // Close goes first: a concurrent OnRequest sees Finishing and OnDone sees the registered call
+        void Done() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                cancelled_ = cancelled_ || ctx_.IsCancelled();
+            }
+            Close(grpc::Status::CANCELLED);
+            OnDone();
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_ = true;
+            if (finished_) {
+                lock.unlock();
+                delete this;
+            }
+        }
+
+        RequestMethod request_;
+        grpc::ServerAsyncWriter<Resp> writer_;
+        DoneTag done_tag_;
+        std::mutex mutex_;
+        std::deque<Resp> queue_;
+        grpc::Status status_;
+        State state_;
+        bool writing_;
+        bool finishing_;
+        bool cancelled_;
+        bool finished_;
+        bool done_;
+    };
+}
+
+#endif //MOD_GRPC_ASYNC_SERVER_H
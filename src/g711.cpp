@@ -0,0 +1,54 @@
+//
+// Created by root on 17.10.26.
+//
+
+#include "g711.h"
+
+#include <cstring>
+#include <strings.h>
+
+namespace mod_grpc {
+
+    // No table and no data dependent branches: the segment is the top bit of the magnitude (clz)
+
+    static inline int top_bit(uint32_t v) {
+        return 31 - __builtin_clz(v);
+    }
+
+    void alaw_encode(const int16_t *in, uint8_t *out, size_t samples) {
+        for (size_t i = 0; i < samples; i++) {
+            int32_t sign = in[i] >> 15;
+            // -x - 1 for negative
+            auto linear = static_cast<uint32_t>(in[i] ^ sign);
+            int32_t mask = 0x55 | (~sign & 0x80);
+            int seg = top_bit(linear | 0xFF) - 7;
+            int shift = seg + 3 + (seg == 0);
+            out[i] = static_cast<uint8_t>(((seg << 4) | ((linear >> shift) & 0x0F)) ^ mask);
+        }
+    }
+
+    void ulaw_encode(const int16_t *in, uint8_t *out, size_t samples) {
+        for (size_t i = 0; i < samples; i++) {
+            int32_t sign = in[i] >> 15;
+            auto linear = static_cast<uint32_t>((in[i] ^ sign) + 0x84);
+            // clip, the top segment gives 0x7F as in spandsp
+            linear = linear > 0x7FFF ? 0x7FFF : linear;
+            int32_t mask = 0x7F | (~sign & 0x80);
+            int seg = top_bit(linear | 0xFF) - 7;
+            out[i] = static_cast<uint8_t>(((seg << 4) | ((linear >> (seg + 3)) & 0x0F)) ^ mask);
+        }
+    }
+
+    g711_encode_t g711_encoder(const char *name) {
+        if (!name) {
+            return nullptr;
+        }
+        if (!strcasecmp(name, "pcma")) {
+            return alaw_encode;
+        }
+        if (!strcasecmp(name, "pcmu")) {
+            return ulaw_encode;
+        }
+        return nullptr;
+    }
+}
@@ -0,0 +1,26 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_G711_H
+#define MOD_GRPC_G711_H
+
+#include <cstddef>
+#include <cstdint>
+
+#define G711_MIME_PCMA "audio/pcma"
+#define G711_MIME_PCMU "audio/pcmu"
+
+namespace mod_grpc {
+
+    // Encodes 16 bit linear samples, out holds one byte per sample (ITU-T G.711, same output as spandsp)
+    typedef void (*g711_encode_t)(const int16_t *in, uint8_t *out, size_t samples);
+
+    void alaw_encode(const int16_t *in, uint8_t *out, size_t samples);
+    void ulaw_encode(const int16_t *in, uint8_t *out, size_t samples);
+
+    // pcma, pcmu; nullptr for anything else
+    g711_encode_t g711_encoder(const char *name);
+}
+
+#endif //MOD_GRPC_G711_H
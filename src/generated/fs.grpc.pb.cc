@@ -40,6 +40,9 @@ static const char* Api_method_names[] = {
   "/fs.Api/SetEavesdropState",
   "/fs.Api/BlindTransfer",
   "/fs.Api/BreakPark",
+  "/fs.Api/OriginateAsync",
+  "/fs.Api/OriginateBatch",
+  "/fs.Api/SubscribeCallEvents",
 };
 
 std::unique_ptr< Api::Stub> Api::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -67,6 +70,9 @@ Api::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const
   , rpcmethod_SetEavesdropState_(Api_method_names[15], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_BlindTransfer_(Api_method_names[16], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_BreakPark_(Api_method_names[17], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_OriginateAsync_(Api_method_names[18], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_OriginateBatch_(Api_method_names[19], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_SubscribeCallEvents_(Api_method_names[20], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   {}
 
 ::grpc::Status Api::Stub::Originate(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::fs::OriginateResponse* response) {
@@ -483,6 +489,54 @@ void Api::Stub::async::BreakPark(::grpc::ClientContext* context, const ::fs::Bre
   return result;
 }
 
+::grpc::ClientReader< ::fs::OriginateAsyncResponse>* Api::Stub::OriginateAsyncRaw(::grpc::ClientContext* context, const ::fs::OriginateRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::fs::OriginateAsyncResponse>::Create(channel_.get(), rpcmethod_OriginateAsync_, context, request);
+}
+
+void Api::Stub::async::OriginateAsync(::grpc::ClientContext* context, const ::fs::OriginateRequest* request, ::grpc::ClientReadReactor< ::fs::OriginateAsyncResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::fs::OriginateAsyncResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_OriginateAsync_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::fs::OriginateAsyncResponse>* Api::Stub::AsyncOriginateAsyncRaw(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fs::OriginateAsyncResponse>::Create(channel_.get(), cq, rpcmethod_OriginateAsync_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::fs::OriginateAsyncResponse>* Api::Stub::PrepareAsyncOriginateAsyncRaw(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fs::OriginateAsyncResponse>::Create(channel_.get(), cq, rpcmethod_OriginateAsync_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::fs::OriginateBatchResponse>* Api::Stub::OriginateBatchRaw(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::fs::OriginateBatchResponse>::Create(channel_.get(), rpcmethod_OriginateBatch_, context, request);
+}
+
+void Api::Stub::async::OriginateBatch(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest* request, ::grpc::ClientReadReactor< ::fs::OriginateBatchResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::fs::OriginateBatchResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_OriginateBatch_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::fs::OriginateBatchResponse>* Api::Stub::AsyncOriginateBatchRaw(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fs::OriginateBatchResponse>::Create(channel_.get(), cq, rpcmethod_OriginateBatch_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::fs::OriginateBatchResponse>* Api::Stub::PrepareAsyncOriginateBatchRaw(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fs::OriginateBatchResponse>::Create(channel_.get(), cq, rpcmethod_OriginateBatch_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::fs::CallEvent>* Api::Stub::SubscribeCallEventsRaw(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::fs::CallEvent>::Create(channel_.get(), rpcmethod_SubscribeCallEvents_, context, request);
+}
+
+void Api::Stub::async::SubscribeCallEvents(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest* request, ::grpc::ClientReadReactor< ::fs::CallEvent>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::fs::CallEvent>::Create(stub_->channel_.get(), stub_->rpcmethod_SubscribeCallEvents_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::fs::CallEvent>* Api::Stub::AsyncSubscribeCallEventsRaw(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fs::CallEvent>::Create(channel_.get(), cq, rpcmethod_SubscribeCallEvents_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::fs::CallEvent>* Api::Stub::PrepareAsyncSubscribeCallEventsRaw(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::fs::CallEvent>::Create(channel_.get(), cq, rpcmethod_SubscribeCallEvents_, context, request, false, nullptr);
+}
+
 Api::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       Api_method_names[0],
@@ -664,6 +718,36 @@ Api::Service::Service() {
              ::fs::BreakParkResponse* resp) {
                return service->BreakPark(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Api_method_names[18],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< Api::Service, ::fs::OriginateRequest, ::fs::OriginateAsyncResponse>(
+          [](Api::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::fs::OriginateRequest* req,
+             ::grpc::ServerWriter<::fs::OriginateAsyncResponse>* writer) {
+               return service->OriginateAsync(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Api_method_names[19],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< Api::Service, ::fs::OriginateBatchRequest, ::fs::OriginateBatchResponse>(
+          [](Api::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::fs::OriginateBatchRequest* req,
+             ::grpc::ServerWriter<::fs::OriginateBatchResponse>* writer) {
+               return service->OriginateBatch(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      Api_method_names[20],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< Api::Service, ::fs::SubscribeCallEventsRequest, ::fs::CallEvent>(
+          [](Api::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::fs::SubscribeCallEventsRequest* req,
+             ::grpc::ServerWriter<::fs::CallEvent>* writer) {
+               return service->SubscribeCallEvents(ctx, req, writer);
+             }, this)));
 }
 
 Api::Service::~Service() {
@@ -795,6 +879,27 @@ Api::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status Api::Service::OriginateAsync(::grpc::ServerContext* context, const ::fs::OriginateRequest* request, ::grpc::ServerWriter< ::fs::OriginateAsyncResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Api::Service::OriginateBatch(::grpc::ServerContext* context, const ::fs::OriginateBatchRequest* request, ::grpc::ServerWriter< ::fs::OriginateBatchResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status Api::Service::SubscribeCallEvents(::grpc::ServerContext* context, const ::fs::SubscribeCallEventsRequest* request, ::grpc::ServerWriter< ::fs::CallEvent>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace fs
 
@@ -161,6 +161,33 @@ class Api final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::BreakParkResponse>> PrepareAsyncBreakPark(::grpc::ClientContext* context, const ::fs::BreakParkRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::fs::BreakParkResponse>>(PrepareAsyncBreakParkRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::fs::OriginateAsyncResponse>> OriginateAsync(::grpc::ClientContext* context, const ::fs::OriginateRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::fs::OriginateAsyncResponse>>(OriginateAsyncRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::OriginateAsyncResponse>> AsyncOriginateAsync(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::OriginateAsyncResponse>>(AsyncOriginateAsyncRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::OriginateAsyncResponse>> PrepareAsyncOriginateAsync(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::OriginateAsyncResponse>>(PrepareAsyncOriginateAsyncRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::fs::OriginateBatchResponse>> OriginateBatch(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::fs::OriginateBatchResponse>>(OriginateBatchRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::OriginateBatchResponse>> AsyncOriginateBatch(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::OriginateBatchResponse>>(AsyncOriginateBatchRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::OriginateBatchResponse>> PrepareAsyncOriginateBatch(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::OriginateBatchResponse>>(PrepareAsyncOriginateBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::fs::CallEvent>> SubscribeCallEvents(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::fs::CallEvent>>(SubscribeCallEventsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::CallEvent>> AsyncSubscribeCallEvents(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::CallEvent>>(AsyncSubscribeCallEventsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::CallEvent>> PrepareAsyncSubscribeCallEvents(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::fs::CallEvent>>(PrepareAsyncSubscribeCallEventsRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -200,6 +227,9 @@ class Api final {
       virtual void BlindTransfer(::grpc::ClientContext* context, const ::fs::BlindTransferRequest* request, ::fs::BlindTransferResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void BreakPark(::grpc::ClientContext* context, const ::fs::BreakParkRequest* request, ::fs::BreakParkResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void BreakPark(::grpc::ClientContext* context, const ::fs::BreakParkRequest* request, ::fs::BreakParkResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void OriginateAsync(::grpc::ClientContext* context, const ::fs::OriginateRequest* request, ::grpc::ClientReadReactor< ::fs::OriginateAsyncResponse>* reactor) = 0;
+      virtual void OriginateBatch(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest* request, ::grpc::ClientReadReactor< ::fs::OriginateBatchResponse>* reactor) = 0;
+      virtual void SubscribeCallEvents(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest* request, ::grpc::ClientReadReactor< ::fs::CallEvent>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -241,6 +271,15 @@ class Api final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::BlindTransferResponse>* PrepareAsyncBlindTransferRaw(::grpc::ClientContext* context, const ::fs::BlindTransferRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::BreakParkResponse>* AsyncBreakParkRaw(::grpc::ClientContext* context, const ::fs::BreakParkRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::fs::BreakParkResponse>* PrepareAsyncBreakParkRaw(::grpc::ClientContext* context, const ::fs::BreakParkRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::fs::OriginateAsyncResponse>* OriginateAsyncRaw(::grpc::ClientContext* context, const ::fs::OriginateRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fs::OriginateAsyncResponse>* AsyncOriginateAsyncRaw(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fs::OriginateAsyncResponse>* PrepareAsyncOriginateAsyncRaw(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::fs::OriginateBatchResponse>* OriginateBatchRaw(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fs::OriginateBatchResponse>* AsyncOriginateBatchRaw(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fs::OriginateBatchResponse>* PrepareAsyncOriginateBatchRaw(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::fs::CallEvent>* SubscribeCallEventsRaw(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fs::CallEvent>* AsyncSubscribeCallEventsRaw(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::fs::CallEvent>* PrepareAsyncSubscribeCallEventsRaw(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -371,6 +410,33 @@ class Api final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::BreakParkResponse>> PrepareAsyncBreakPark(::grpc::ClientContext* context, const ::fs::BreakParkRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::fs::BreakParkResponse>>(PrepareAsyncBreakParkRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::fs::OriginateAsyncResponse>> OriginateAsync(::grpc::ClientContext* context, const ::fs::OriginateRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::fs::OriginateAsyncResponse>>(OriginateAsyncRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::OriginateAsyncResponse>> AsyncOriginateAsync(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::OriginateAsyncResponse>>(AsyncOriginateAsyncRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::OriginateAsyncResponse>> PrepareAsyncOriginateAsync(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::OriginateAsyncResponse>>(PrepareAsyncOriginateAsyncRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::fs::OriginateBatchResponse>> OriginateBatch(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::fs::OriginateBatchResponse>>(OriginateBatchRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::OriginateBatchResponse>> AsyncOriginateBatch(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::OriginateBatchResponse>>(AsyncOriginateBatchRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::OriginateBatchResponse>> PrepareAsyncOriginateBatch(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::OriginateBatchResponse>>(PrepareAsyncOriginateBatchRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::fs::CallEvent>> SubscribeCallEvents(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::fs::CallEvent>>(SubscribeCallEventsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::CallEvent>> AsyncSubscribeCallEvents(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::CallEvent>>(AsyncSubscribeCallEventsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::CallEvent>> PrepareAsyncSubscribeCallEvents(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::fs::CallEvent>>(PrepareAsyncSubscribeCallEventsRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -410,6 +476,9 @@ class Api final {
       void BlindTransfer(::grpc::ClientContext* context, const ::fs::BlindTransferRequest* request, ::fs::BlindTransferResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void BreakPark(::grpc::ClientContext* context, const ::fs::BreakParkRequest* request, ::fs::BreakParkResponse* response, std::function<void(::grpc::Status)>) override;
       void BreakPark(::grpc::ClientContext* context, const ::fs::BreakParkRequest* request, ::fs::BreakParkResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void OriginateAsync(::grpc::ClientContext* context, const ::fs::OriginateRequest* request, ::grpc::ClientReadReactor< ::fs::OriginateAsyncResponse>* reactor) override;
+      void OriginateBatch(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest* request, ::grpc::ClientReadReactor< ::fs::OriginateBatchResponse>* reactor) override;
+      void SubscribeCallEvents(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest* request, ::grpc::ClientReadReactor< ::fs::CallEvent>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -457,6 +526,15 @@ class Api final {
     ::grpc::ClientAsyncResponseReader< ::fs::BlindTransferResponse>* PrepareAsyncBlindTransferRaw(::grpc::ClientContext* context, const ::fs::BlindTransferRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::fs::BreakParkResponse>* AsyncBreakParkRaw(::grpc::ClientContext* context, const ::fs::BreakParkRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::fs::BreakParkResponse>* PrepareAsyncBreakParkRaw(::grpc::ClientContext* context, const ::fs::BreakParkRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::fs::OriginateAsyncResponse>* OriginateAsyncRaw(::grpc::ClientContext* context, const ::fs::OriginateRequest& request) override;
+    ::grpc::ClientAsyncReader< ::fs::OriginateAsyncResponse>* AsyncOriginateAsyncRaw(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::fs::OriginateAsyncResponse>* PrepareAsyncOriginateAsyncRaw(::grpc::ClientContext* context, const ::fs::OriginateRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::fs::OriginateBatchResponse>* OriginateBatchRaw(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request) override;
+    ::grpc::ClientAsyncReader< ::fs::OriginateBatchResponse>* AsyncOriginateBatchRaw(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::fs::OriginateBatchResponse>* PrepareAsyncOriginateBatchRaw(::grpc::ClientContext* context, const ::fs::OriginateBatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::fs::CallEvent>* SubscribeCallEventsRaw(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request) override;
+    ::grpc::ClientAsyncReader< ::fs::CallEvent>* AsyncSubscribeCallEventsRaw(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::fs::CallEvent>* PrepareAsyncSubscribeCallEventsRaw(::grpc::ClientContext* context, const ::fs::SubscribeCallEventsRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_Originate_;
     const ::grpc::internal::RpcMethod rpcmethod_Execute_;
     const ::grpc::internal::RpcMethod rpcmethod_SetVariables_;
@@ -475,6 +553,9 @@ class Api final {
     const ::grpc::internal::RpcMethod rpcmethod_SetEavesdropState_;
     const ::grpc::internal::RpcMethod rpcmethod_BlindTransfer_;
     const ::grpc::internal::RpcMethod rpcmethod_BreakPark_;
+    const ::grpc::internal::RpcMethod rpcmethod_OriginateAsync_;
+    const ::grpc::internal::RpcMethod rpcmethod_OriginateBatch_;
+    const ::grpc::internal::RpcMethod rpcmethod_SubscribeCallEvents_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -500,6 +581,9 @@ class Api final {
     virtual ::grpc::Status SetEavesdropState(::grpc::ServerContext* context, const ::fs::SetEavesdropStateRequest* request, ::fs::SetEavesdropStateResponse* response);
     virtual ::grpc::Status BlindTransfer(::grpc::ServerContext* context, const ::fs::BlindTransferRequest* request, ::fs::BlindTransferResponse* response);
     virtual ::grpc::Status BreakPark(::grpc::ServerContext* context, const ::fs::BreakParkRequest* request, ::fs::BreakParkResponse* response);
+    virtual ::grpc::Status OriginateAsync(::grpc::ServerContext* context, const ::fs::OriginateRequest* request, ::grpc::ServerWriter< ::fs::OriginateAsyncResponse>* writer);
+    virtual ::grpc::Status OriginateBatch(::grpc::ServerContext* context, const ::fs::OriginateBatchRequest* request, ::grpc::ServerWriter< ::fs::OriginateBatchResponse>* writer);
+    virtual ::grpc::Status SubscribeCallEvents(::grpc::ServerContext* context, const ::fs::SubscribeCallEventsRequest* request, ::grpc::ServerWriter< ::fs::CallEvent>* writer);
   };
   template <class BaseClass>
   class WithAsyncMethod_Originate : public BaseClass {
@@ -861,7 +945,67 @@ class Api final {
       ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_Originate<WithAsyncMethod_Execute<WithAsyncMethod_SetVariables<WithAsyncMethod_Bridge<WithAsyncMethod_BridgeCall<WithAsyncMethod_StopPlayback<WithAsyncMethod_Hangup<WithAsyncMethod_HangupMatchingVars<WithAsyncMethod_Queue<WithAsyncMethod_HangupMany<WithAsyncMethod_Hold<WithAsyncMethod_UnHold<WithAsyncMethod_SetProfileVar<WithAsyncMethod_ConfirmPush<WithAsyncMethod_Broadcast<WithAsyncMethod_SetEavesdropState<WithAsyncMethod_BlindTransfer<WithAsyncMethod_BreakPark<Service > > > > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_OriginateAsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_OriginateAsync() {
+      ::grpc::Service::MarkMethodAsync(18);
+    }
+    ~WithAsyncMethod_OriginateAsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status OriginateAsync(::grpc::ServerContext* /*context*/, const ::fs::OriginateRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateAsyncResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestOriginateAsync(::grpc::ServerContext* context, ::fs::OriginateRequest* request, ::grpc::ServerAsyncWriter< ::fs::OriginateAsyncResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(18, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_OriginateBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_OriginateBatch() {
+      ::grpc::Service::MarkMethodAsync(19);
+    }
+    ~WithAsyncMethod_OriginateBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status OriginateBatch(::grpc::ServerContext* /*context*/, const ::fs::OriginateBatchRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestOriginateBatch(::grpc::ServerContext* context, ::fs::OriginateBatchRequest* request, ::grpc::ServerAsyncWriter< ::fs::OriginateBatchResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(19, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SubscribeCallEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SubscribeCallEvents() {
+      ::grpc::Service::MarkMethodAsync(20);
+    }
+    ~WithAsyncMethod_SubscribeCallEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeCallEvents(::grpc::ServerContext* /*context*/, const ::fs::SubscribeCallEventsRequest* /*request*/, ::grpc::ServerWriter< ::fs::CallEvent>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribeCallEvents(::grpc::ServerContext* context, ::fs::SubscribeCallEventsRequest* request, ::grpc::ServerAsyncWriter< ::fs::CallEvent>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(20, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_Originate<WithAsyncMethod_Execute<WithAsyncMethod_SetVariables<WithAsyncMethod_Bridge<WithAsyncMethod_BridgeCall<WithAsyncMethod_StopPlayback<WithAsyncMethod_Hangup<WithAsyncMethod_HangupMatchingVars<WithAsyncMethod_Queue<WithAsyncMethod_HangupMany<WithAsyncMethod_Hold<WithAsyncMethod_UnHold<WithAsyncMethod_SetProfileVar<WithAsyncMethod_ConfirmPush<WithAsyncMethod_Broadcast<WithAsyncMethod_SetEavesdropState<WithAsyncMethod_BlindTransfer<WithAsyncMethod_BreakPark<WithAsyncMethod_OriginateAsync<WithAsyncMethod_OriginateBatch<WithAsyncMethod_SubscribeCallEvents<Service > > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_Originate : public BaseClass {
    private:
@@ -1348,7 +1492,73 @@ class Api final {
     virtual ::grpc::ServerUnaryReactor* BreakPark(
       ::grpc::CallbackServerContext* /*context*/, const ::fs::BreakParkRequest* /*request*/, ::fs::BreakParkResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_Originate<WithCallbackMethod_Execute<WithCallbackMethod_SetVariables<WithCallbackMethod_Bridge<WithCallbackMethod_BridgeCall<WithCallbackMethod_StopPlayback<WithCallbackMethod_Hangup<WithCallbackMethod_HangupMatchingVars<WithCallbackMethod_Queue<WithCallbackMethod_HangupMany<WithCallbackMethod_Hold<WithCallbackMethod_UnHold<WithCallbackMethod_SetProfileVar<WithCallbackMethod_ConfirmPush<WithCallbackMethod_Broadcast<WithCallbackMethod_SetEavesdropState<WithCallbackMethod_BlindTransfer<WithCallbackMethod_BreakPark<Service > > > > > > > > > > > > > > > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_OriginateAsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_OriginateAsync() {
+      ::grpc::Service::MarkMethodCallback(18,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::fs::OriginateRequest, ::fs::OriginateAsyncResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::fs::OriginateRequest* request) { return this->OriginateAsync(context, request); }));
+    }
+    ~WithCallbackMethod_OriginateAsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status OriginateAsync(::grpc::ServerContext* /*context*/, const ::fs::OriginateRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateAsyncResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::fs::OriginateAsyncResponse>* OriginateAsync(
+      ::grpc::CallbackServerContext* /*context*/, const ::fs::OriginateRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_OriginateBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_OriginateBatch() {
+      ::grpc::Service::MarkMethodCallback(19,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::fs::OriginateBatchRequest, ::fs::OriginateBatchResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::fs::OriginateBatchRequest* request) { return this->OriginateBatch(context, request); }));
+    }
+    ~WithCallbackMethod_OriginateBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status OriginateBatch(::grpc::ServerContext* /*context*/, const ::fs::OriginateBatchRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::fs::OriginateBatchResponse>* OriginateBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::fs::OriginateBatchRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SubscribeCallEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SubscribeCallEvents() {
+      ::grpc::Service::MarkMethodCallback(20,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::fs::SubscribeCallEventsRequest, ::fs::CallEvent>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::fs::SubscribeCallEventsRequest* request) { return this->SubscribeCallEvents(context, request); }));
+    }
+    ~WithCallbackMethod_SubscribeCallEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeCallEvents(::grpc::ServerContext* /*context*/, const ::fs::SubscribeCallEventsRequest* /*request*/, ::grpc::ServerWriter< ::fs::CallEvent>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::fs::CallEvent>* SubscribeCallEvents(
+      ::grpc::CallbackServerContext* /*context*/, const ::fs::SubscribeCallEventsRequest* /*request*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_Originate<WithCallbackMethod_Execute<WithCallbackMethod_SetVariables<WithCallbackMethod_Bridge<WithCallbackMethod_BridgeCall<WithCallbackMethod_StopPlayback<WithCallbackMethod_Hangup<WithCallbackMethod_HangupMatchingVars<WithCallbackMethod_Queue<WithCallbackMethod_HangupMany<WithCallbackMethod_Hold<WithCallbackMethod_UnHold<WithCallbackMethod_SetProfileVar<WithCallbackMethod_ConfirmPush<WithCallbackMethod_Broadcast<WithCallbackMethod_SetEavesdropState<WithCallbackMethod_BlindTransfer<WithCallbackMethod_BreakPark<WithCallbackMethod_OriginateAsync<WithCallbackMethod_OriginateBatch<WithCallbackMethod_SubscribeCallEvents<Service > > > > > > > > > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_Originate : public BaseClass {
@@ -1657,6 +1867,57 @@ class Api final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_OriginateAsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_OriginateAsync() {
+      ::grpc::Service::MarkMethodGeneric(18);
+    }
+    ~WithGenericMethod_OriginateAsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status OriginateAsync(::grpc::ServerContext* /*context*/, const ::fs::OriginateRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateAsyncResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_OriginateBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_OriginateBatch() {
+      ::grpc::Service::MarkMethodGeneric(19);
+    }
+    ~WithGenericMethod_OriginateBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status OriginateBatch(::grpc::ServerContext* /*context*/, const ::fs::OriginateBatchRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SubscribeCallEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SubscribeCallEvents() {
+      ::grpc::Service::MarkMethodGeneric(20);
+    }
+    ~WithGenericMethod_SubscribeCallEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeCallEvents(::grpc::ServerContext* /*context*/, const ::fs::SubscribeCallEventsRequest* /*request*/, ::grpc::ServerWriter< ::fs::CallEvent>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_Originate : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2017,6 +2278,66 @@ class Api final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_OriginateAsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_OriginateAsync() {
+      ::grpc::Service::MarkMethodRaw(18);
+    }
+    ~WithRawMethod_OriginateAsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status OriginateAsync(::grpc::ServerContext* /*context*/, const ::fs::OriginateRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateAsyncResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestOriginateAsync(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(18, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_OriginateBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_OriginateBatch() {
+      ::grpc::Service::MarkMethodRaw(19);
+    }
+    ~WithRawMethod_OriginateBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status OriginateBatch(::grpc::ServerContext* /*context*/, const ::fs::OriginateBatchRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestOriginateBatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(19, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SubscribeCallEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SubscribeCallEvents() {
+      ::grpc::Service::MarkMethodRaw(20);
+    }
+    ~WithRawMethod_SubscribeCallEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeCallEvents(::grpc::ServerContext* /*context*/, const ::fs::SubscribeCallEventsRequest* /*request*/, ::grpc::ServerWriter< ::fs::CallEvent>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribeCallEvents(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(20, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_Originate : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2413,6 +2734,72 @@ class Api final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_OriginateAsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_OriginateAsync() {
+      ::grpc::Service::MarkMethodRawCallback(18,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->OriginateAsync(context, request); }));
+    }
+    ~WithRawCallbackMethod_OriginateAsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status OriginateAsync(::grpc::ServerContext* /*context*/, const ::fs::OriginateRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateAsyncResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* OriginateAsync(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_OriginateBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_OriginateBatch() {
+      ::grpc::Service::MarkMethodRawCallback(19,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->OriginateBatch(context, request); }));
+    }
+    ~WithRawCallbackMethod_OriginateBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status OriginateBatch(::grpc::ServerContext* /*context*/, const ::fs::OriginateBatchRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* OriginateBatch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SubscribeCallEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SubscribeCallEvents() {
+      ::grpc::Service::MarkMethodRawCallback(20,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request) { return this->SubscribeCallEvents(context, request); }));
+    }
+    ~WithRawCallbackMethod_SubscribeCallEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeCallEvents(::grpc::ServerContext* /*context*/, const ::fs::SubscribeCallEventsRequest* /*request*/, ::grpc::ServerWriter< ::fs::CallEvent>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* SubscribeCallEvents(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_Originate : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2899,8 +3286,89 @@ class Api final {
     virtual ::grpc::Status StreamedBreakPark(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::fs::BreakParkRequest,::fs::BreakParkResponse>* server_unary_streamer) = 0;
   };
   typedef WithStreamedUnaryMethod_Originate<WithStreamedUnaryMethod_Execute<WithStreamedUnaryMethod_SetVariables<WithStreamedUnaryMethod_Bridge<WithStreamedUnaryMethod_BridgeCall<WithStreamedUnaryMethod_StopPlayback<WithStreamedUnaryMethod_Hangup<WithStreamedUnaryMethod_HangupMatchingVars<WithStreamedUnaryMethod_Queue<WithStreamedUnaryMethod_HangupMany<WithStreamedUnaryMethod_Hold<WithStreamedUnaryMethod_UnHold<WithStreamedUnaryMethod_SetProfileVar<WithStreamedUnaryMethod_ConfirmPush<WithStreamedUnaryMethod_Broadcast<WithStreamedUnaryMethod_SetEavesdropState<WithStreamedUnaryMethod_BlindTransfer<WithStreamedUnaryMethod_BreakPark<Service > > > > > > > > > > > > > > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Originate<WithStreamedUnaryMethod_Execute<WithStreamedUnaryMethod_SetVariables<WithStreamedUnaryMethod_Bridge<WithStreamedUnaryMethod_BridgeCall<WithStreamedUnaryMethod_StopPlayback<WithStreamedUnaryMethod_Hangup<WithStreamedUnaryMethod_HangupMatchingVars<WithStreamedUnaryMethod_Queue<WithStreamedUnaryMethod_HangupMany<WithStreamedUnaryMethod_Hold<WithStreamedUnaryMethod_UnHold<WithStreamedUnaryMethod_SetProfileVar<WithStreamedUnaryMethod_ConfirmPush<WithStreamedUnaryMethod_Broadcast<WithStreamedUnaryMethod_SetEavesdropState<WithStreamedUnaryMethod_BlindTransfer<WithStreamedUnaryMethod_BreakPark<Service > > > > > > > > > > > > > > > > > > StreamedService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_OriginateAsync : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_OriginateAsync() {
+      ::grpc::Service::MarkMethodStreamed(18,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::fs::OriginateRequest, ::fs::OriginateAsyncResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::fs::OriginateRequest, ::fs::OriginateAsyncResponse>* streamer) {
+                       return this->StreamedOriginateAsync(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_OriginateAsync() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status OriginateAsync(::grpc::ServerContext* /*context*/, const ::fs::OriginateRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateAsyncResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedOriginateAsync(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::fs::OriginateRequest,::fs::OriginateAsyncResponse>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_OriginateBatch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_OriginateBatch() {
+      ::grpc::Service::MarkMethodStreamed(19,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::fs::OriginateBatchRequest, ::fs::OriginateBatchResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::fs::OriginateBatchRequest, ::fs::OriginateBatchResponse>* streamer) {
+                       return this->StreamedOriginateBatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_OriginateBatch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status OriginateBatch(::grpc::ServerContext* /*context*/, const ::fs::OriginateBatchRequest* /*request*/, ::grpc::ServerWriter< ::fs::OriginateBatchResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedOriginateBatch(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::fs::OriginateBatchRequest,::fs::OriginateBatchResponse>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_SubscribeCallEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_SubscribeCallEvents() {
+      ::grpc::Service::MarkMethodStreamed(20,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::fs::SubscribeCallEventsRequest, ::fs::CallEvent>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::fs::SubscribeCallEventsRequest, ::fs::CallEvent>* streamer) {
+                       return this->StreamedSubscribeCallEvents(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_SubscribeCallEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SubscribeCallEvents(::grpc::ServerContext* /*context*/, const ::fs::SubscribeCallEventsRequest* /*request*/, ::grpc::ServerWriter< ::fs::CallEvent>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedSubscribeCallEvents(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::fs::SubscribeCallEventsRequest,::fs::CallEvent>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_OriginateAsync<WithSplitStreamingMethod_OriginateBatch<WithSplitStreamingMethod_SubscribeCallEvents<Service > > > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_Originate<WithStreamedUnaryMethod_Execute<WithStreamedUnaryMethod_SetVariables<WithStreamedUnaryMethod_Bridge<WithStreamedUnaryMethod_BridgeCall<WithStreamedUnaryMethod_StopPlayback<WithStreamedUnaryMethod_Hangup<WithStreamedUnaryMethod_HangupMatchingVars<WithStreamedUnaryMethod_Queue<WithStreamedUnaryMethod_HangupMany<WithStreamedUnaryMethod_Hold<WithStreamedUnaryMethod_UnHold<WithStreamedUnaryMethod_SetProfileVar<WithStreamedUnaryMethod_ConfirmPush<WithStreamedUnaryMethod_Broadcast<WithStreamedUnaryMethod_SetEavesdropState<WithStreamedUnaryMethod_BlindTransfer<WithStreamedUnaryMethod_BreakPark<WithSplitStreamingMethod_OriginateAsync<WithSplitStreamingMethod_OriginateBatch<WithSplitStreamingMethod_SubscribeCallEvents<Service > > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace fs
@@ -21,6 +21,196 @@ namespace _pb = ::PROTOBUF_NAMESPACE_ID;
 namespace _pbi = _pb::internal;
 
 namespace fs {
+PROTOBUF_CONSTEXPR SubscribeCallEventsRequest::SubscribeCallEventsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.domain_id_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SubscribeCallEventsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubscribeCallEventsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubscribeCallEventsRequestDefaultTypeInternal() {}
+  union {
+    SubscribeCallEventsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubscribeCallEventsRequestDefaultTypeInternal _SubscribeCallEventsRequest_default_instance_;
+PROTOBUF_CONSTEXPR CallEvent::CallEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.event_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.app_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cc_app_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.payload_)*/nullptr
+  , /*decltype(_impl_.domain_id_)*/int64_t{0}
+  , /*decltype(_impl_.user_id_)*/int64_t{0}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CallEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CallEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CallEventDefaultTypeInternal() {}
+  union {
+    CallEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CallEventDefaultTypeInternal _CallEvent_default_instance_;
+PROTOBUF_CONSTEXPR CallEventPayload_Endpoint::CallEventPayload_Endpoint(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.number_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CallEventPayload_EndpointDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CallEventPayload_EndpointDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CallEventPayload_EndpointDefaultTypeInternal() {}
+  union {
+    CallEventPayload_Endpoint _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CallEventPayload_EndpointDefaultTypeInternal _CallEventPayload_Endpoint_default_instance_;
+PROTOBUF_CONSTEXPR CallEventPayload_Parameters::CallEventPayload_Parameters(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.autoanswer_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.video_)*/false
+  , /*decltype(_impl_.screen_)*/false
+  , /*decltype(_impl_.disablestun_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CallEventPayload_ParametersDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CallEventPayload_ParametersDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CallEventPayload_ParametersDefaultTypeInternal() {}
+  union {
+    CallEventPayload_Parameters _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CallEventPayload_ParametersDefaultTypeInternal _CallEventPayload_Parameters_default_instance_;
+PROTOBUF_CONSTEXPR CallEventPayload_Eavesdrop::CallEventPayload_Eavesdrop(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.number_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.state_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.duration_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CallEventPayload_EavesdropDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CallEventPayload_EavesdropDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CallEventPayload_EavesdropDefaultTypeInternal() {}
+  union {
+    CallEventPayload_Eavesdrop _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CallEventPayload_EavesdropDefaultTypeInternal _CallEventPayload_Eavesdrop_default_instance_;
+PROTOBUF_CONSTEXPR CallEventPayload_Call::CallEventPayload_Call(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cc_app_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CallEventPayload_CallDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CallEventPayload_CallDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CallEventPayload_CallDefaultTypeInternal() {}
+  union {
+    CallEventPayload_Call _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CallEventPayload_CallDefaultTypeInternal _CallEventPayload_Call_default_instance_;
+PROTOBUF_CONSTEXPR CallEventPayload_PayloadEntry_DoNotUse::CallEventPayload_PayloadEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct CallEventPayload_PayloadEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CallEventPayload_PayloadEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CallEventPayload_PayloadEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    CallEventPayload_PayloadEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CallEventPayload_PayloadEntry_DoNotUseDefaultTypeInternal _CallEventPayload_PayloadEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR CallEventPayload_QueueEntry_DoNotUse::CallEventPayload_QueueEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct CallEventPayload_QueueEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CallEventPayload_QueueEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CallEventPayload_QueueEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    CallEventPayload_QueueEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CallEventPayload_QueueEntry_DoNotUseDefaultTypeInternal _CallEventPayload_QueueEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR CallEventPayload::CallEventPayload(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.payload_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.queue_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.tags_)*/{}
+  , /*decltype(_impl_.schema_ids_)*/{}
+  , /*decltype(_impl_._schema_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.amd_ai_logs_)*/{}
+  , /*decltype(_impl_.calls_)*/{}
+  , /*decltype(_impl_.direction_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.destination_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.parent_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sip_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ivr_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.bridged_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.digit_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.application_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.state_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ai_result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ai_error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cause_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.amd_result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.amd_cause_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.record_start_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.record_stop_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transfer_to_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transfer_from_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transfer_to_agent_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transfer_from_attempt_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transfer_to_attempt_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.talk_sec_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hangup_by_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.reporting_at_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.amd_ai_result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hangup_phrase_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.from_)*/nullptr
+  , /*decltype(_impl_.to_)*/nullptr
+  , /*decltype(_impl_.params_)*/nullptr
+  , /*decltype(_impl_.eavesdrop_)*/nullptr
+  , /*decltype(_impl_.user_id_)*/int64_t{0}
+  , /*decltype(_impl_.gateway_id_)*/int64_t{0}
+  , /*decltype(_impl_.contact_id_)*/int64_t{0}
+  , /*decltype(_impl_.hide_contact_)*/false
+  , /*decltype(_impl_.hidenumber_)*/false
+  , /*decltype(_impl_.originate_)*/false
+  , /*decltype(_impl_.cdr_)*/false
+  , /*decltype(_impl_.heartbeat_)*/0
+  , /*decltype(_impl_.grantee_id_)*/int64_t{0}
+  , /*decltype(_impl_.notification_hangup_)*/false
+  , /*decltype(_impl_.originate_success_)*/false
+  , /*decltype(_impl_.amd_ai_positive_)*/false
+  , /*decltype(_impl_.ai_local_)*/false
+  , /*decltype(_impl_.sip_)*/0
+  , /*decltype(_impl_.ai_partial_)*/false
+  , /*decltype(_impl_.ai_confidence_)*/0
+  , /*decltype(_impl_.ai_elapsed_ms_)*/int64_t{0}} {}
+struct CallEventPayloadDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CallEventPayloadDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CallEventPayloadDefaultTypeInternal() {}
+  union {
+    CallEventPayload _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CallEventPayloadDefaultTypeInternal _CallEventPayload_default_instance_;
 PROTOBUF_CONSTEXPR BreakParkRequest_VariablesEntry_DoNotUse::BreakParkRequest_VariablesEntry_DoNotUse(
     ::_pbi::ConstantInitialized) {}
 struct BreakParkRequest_VariablesEntry_DoNotUseDefaultTypeInternal {
@@ -547,6 +737,51 @@ struct OriginateResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OriginateResponseDefaultTypeInternal _OriginateResponse_default_instance_;
+PROTOBUF_CONSTEXPR OriginateAsyncResponse::OriginateAsyncResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_)*/nullptr
+  , /*decltype(_impl_.state_)*/0
+  , /*decltype(_impl_.error_code_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OriginateAsyncResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OriginateAsyncResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OriginateAsyncResponseDefaultTypeInternal() {}
+  union {
+    OriginateAsyncResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OriginateAsyncResponseDefaultTypeInternal _OriginateAsyncResponse_default_instance_;
+PROTOBUF_CONSTEXPR OriginateBatchRequest::OriginateBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.requests_)*/{}
+  , /*decltype(_impl_.concurrency_)*/0
+  , /*decltype(_impl_.rate_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OriginateBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OriginateBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OriginateBatchRequestDefaultTypeInternal() {}
+  union {
+    OriginateBatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OriginateBatchRequestDefaultTypeInternal _OriginateBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR OriginateBatchResponse::OriginateBatchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.result_)*/nullptr
+  , /*decltype(_impl_.index_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OriginateBatchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OriginateBatchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OriginateBatchResponseDefaultTypeInternal() {}
+  union {
+    OriginateBatchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OriginateBatchResponseDefaultTypeInternal _OriginateBatchResponse_default_instance_;
 PROTOBUF_CONSTEXPR BridgeRequest::BridgeRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.leg_a_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
@@ -653,11 +888,210 @@ struct HangupMatchingVarsResponseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HangupMatchingVarsResponseDefaultTypeInternal _HangupMatchingVarsResponse_default_instance_;
 }  // namespace fs
-static ::_pb::Metadata file_level_metadata_fs_2eproto[47];
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_fs_2eproto[2];
+static ::_pb::Metadata file_level_metadata_fs_2eproto[59];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_fs_2eproto[3];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_fs_2eproto = nullptr;
 
 const uint32_t TableStruct_fs_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::SubscribeCallEventsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::SubscribeCallEventsRequest, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::fs::SubscribeCallEventsRequest, _impl_.domain_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEvent, _impl_.event_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEvent, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEvent, _impl_.app_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEvent, _impl_.domain_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEvent, _impl_.user_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEvent, _impl_.cc_app_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEvent, _impl_.data_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEvent, _impl_.payload_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Endpoint, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Endpoint, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Endpoint, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Endpoint, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Endpoint, _impl_.number_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Parameters, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Parameters, _impl_.video_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Parameters, _impl_.screen_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Parameters, _impl_.autoanswer_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Parameters, _impl_.disablestun_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Eavesdrop, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Eavesdrop, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Eavesdrop, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Eavesdrop, _impl_.number_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Eavesdrop, _impl_.duration_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Eavesdrop, _impl_.state_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Call, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Call, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Call, _impl_.user_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_Call, _impl_.cc_app_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_PayloadEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_PayloadEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_PayloadEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_PayloadEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_QueueEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_QueueEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_QueueEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload_QueueEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.user_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.gateway_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.contact_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.hide_contact_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.hidenumber_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.payload_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.direction_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.destination_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.parent_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.to_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.originate_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.heartbeat_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.sip_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.grantee_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.ivr_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.queue_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.params_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.eavesdrop_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.bridged_id_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.digit_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.application_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.ai_result_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.ai_error_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.result_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.cause_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.cdr_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.notification_hangup_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.amd_result_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.amd_cause_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.record_start_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.record_stop_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.transfer_to_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.transfer_from_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.transfer_to_agent_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.transfer_from_attempt_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.transfer_to_attempt_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.talk_sec_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.hangup_by_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.reporting_at_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.originate_success_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.sip_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.tags_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.schema_ids_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.amd_ai_result_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.amd_ai_positive_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.amd_ai_logs_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.hangup_phrase_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.calls_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.ai_local_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.ai_partial_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.ai_confidence_),
+  PROTOBUF_FIELD_OFFSET(::fs::CallEventPayload, _impl_.ai_elapsed_ms_),
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::fs::BreakParkRequest_VariablesEntry_DoNotUse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::fs::BreakParkRequest_VariablesEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -988,6 +1422,33 @@ const uint32_t TableStruct_fs_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(proto
   PROTOBUF_FIELD_OFFSET(::fs::OriginateResponse, _impl_.error_),
   PROTOBUF_FIELD_OFFSET(::fs::OriginateResponse, _impl_.error_code_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateAsyncResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateAsyncResponse, _impl_.uuid_),
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateAsyncResponse, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateAsyncResponse, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateAsyncResponse, _impl_.error_code_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateBatchRequest, _impl_.requests_),
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateBatchRequest, _impl_.concurrency_),
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateBatchRequest, _impl_.rate_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateBatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateBatchResponse, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::fs::OriginateBatchResponse, _impl_.result_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::fs::BridgeRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -1056,56 +1517,77 @@ const uint32_t TableStruct_fs_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(proto
   PROTOBUF_FIELD_OFFSET(::fs::HangupMatchingVarsResponse, _impl_.count_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, 8, -1, sizeof(::fs::BreakParkRequest_VariablesEntry_DoNotUse)},
-  { 10, -1, -1, sizeof(::fs::BreakParkRequest)},
-  { 18, -1, -1, sizeof(::fs::BreakParkResponse)},
-  { 25, 33, -1, sizeof(::fs::BlindTransferRequest_VariablesEntry_DoNotUse)},
-  { 35, -1, -1, sizeof(::fs::BlindTransferRequest)},
-  { 46, -1, -1, sizeof(::fs::BlindTransferResponse)},
-  { 53, -1, -1, sizeof(::fs::SetEavesdropStateRequest)},
-  { 61, -1, -1, sizeof(::fs::SetEavesdropStateResponse)},
-  { 68, -1, -1, sizeof(::fs::BroadcastRequest)},
-  { 78, -1, -1, sizeof(::fs::BroadcastResponse)},
-  { 86, -1, -1, sizeof(::fs::ConfirmPushRequest)},
-  { 93, -1, -1, sizeof(::fs::ConfirmPushResponse)},
-  { 100, 108, -1, sizeof(::fs::SetProfileVarRequest_VariablesEntry_DoNotUse)},
-  { 110, -1, -1, sizeof(::fs::SetProfileVarRequest)},
-  { 118, -1, -1, sizeof(::fs::SetProfileVarResponse)},
-  { 124, -1, -1, sizeof(::fs::StopPlaybackRequest)},
-  { 131, -1, -1, sizeof(::fs::StopPlaybackResponse)},
-  { 137, 145, -1, sizeof(::fs::BridgeCallRequest_VariablesEntry_DoNotUse)},
-  { 147, -1, -1, sizeof(::fs::BridgeCallRequest)},
-  { 156, -1, -1, sizeof(::fs::BridgeCallResponse)},
-  { 164, -1, -1, sizeof(::fs::HoldRequest)},
-  { 171, -1, -1, sizeof(::fs::HoldResponse)},
-  { 178, -1, -1, sizeof(::fs::UnHoldRequest)},
-  { 185, -1, -1, sizeof(::fs::UnHoldResponse)},
-  { 192, -1, -1, sizeof(::fs::HangupManyRequest)},
-  { 200, -1, -1, sizeof(::fs::HangupManyResponse)},
-  { 207, 215, -1, sizeof(::fs::QueueRequest_VariablesEntry_DoNotUse)},
-  { 217, -1, -1, sizeof(::fs::QueueRequest)},
-  { 227, -1, -1, sizeof(::fs::QueueResponse)},
-  { 234, -1, -1, sizeof(::fs::ErrorExecute)},
-  { 242, -1, -1, sizeof(::fs::ExecuteRequest)},
-  { 250, -1, -1, sizeof(::fs::ExecuteResponse)},
-  { 258, 266, -1, sizeof(::fs::HangupRequest_VariablesEntry_DoNotUse)},
-  { 268, -1, -1, sizeof(::fs::HangupRequest)},
-  { 278, -1, -1, sizeof(::fs::HangupResponse)},
-  { 285, -1, -1, sizeof(::fs::OriginateRequest_Extension)},
-  { 293, 301, -1, sizeof(::fs::OriginateRequest_VariablesEntry_DoNotUse)},
-  { 303, -1, -1, sizeof(::fs::OriginateRequest)},
-  { 320, -1, -1, sizeof(::fs::OriginateResponse)},
-  { 329, -1, -1, sizeof(::fs::BridgeRequest)},
-  { 338, -1, -1, sizeof(::fs::BridgeResponse)},
-  { 346, 354, -1, sizeof(::fs::SetVariablesRequest_VariablesEntry_DoNotUse)},
-  { 356, -1, -1, sizeof(::fs::SetVariablesRequest)},
-  { 364, -1, -1, sizeof(::fs::SetVariablesResponse)},
-  { 371, 379, -1, sizeof(::fs::HangupMatchingVarsReqeust_VariablesEntry_DoNotUse)},
-  { 381, -1, -1, sizeof(::fs::HangupMatchingVarsReqeust)},
-  { 389, -1, -1, sizeof(::fs::HangupMatchingVarsResponse)},
+  { 0, -1, -1, sizeof(::fs::SubscribeCallEventsRequest)},
+  { 8, -1, -1, sizeof(::fs::CallEvent)},
+  { 23, -1, -1, sizeof(::fs::CallEventPayload_Endpoint)},
+  { 33, -1, -1, sizeof(::fs::CallEventPayload_Parameters)},
+  { 43, -1, -1, sizeof(::fs::CallEventPayload_Eavesdrop)},
+  { 54, -1, -1, sizeof(::fs::CallEventPayload_Call)},
+  { 63, 71, -1, sizeof(::fs::CallEventPayload_PayloadEntry_DoNotUse)},
+  { 73, 81, -1, sizeof(::fs::CallEventPayload_QueueEntry_DoNotUse)},
+  { 83, 144, -1, sizeof(::fs::CallEventPayload)},
+  { 199, 207, -1, sizeof(::fs::BreakParkRequest_VariablesEntry_DoNotUse)},
+  { 209, -1, -1, sizeof(::fs::BreakParkRequest)},
+  { 217, -1, -1, sizeof(::fs::BreakParkResponse)},
+  { 224, 232, -1, sizeof(::fs::BlindTransferRequest_VariablesEntry_DoNotUse)},
+  { 234, -1, -1, sizeof(::fs::BlindTransferRequest)},
+  { 245, -1, -1, sizeof(::fs::BlindTransferResponse)},
+  { 252, -1, -1, sizeof(::fs::SetEavesdropStateRequest)},
+  { 260, -1, -1, sizeof(::fs::SetEavesdropStateResponse)},
+  { 267, -1, -1, sizeof(::fs::BroadcastRequest)},
+  { 277, -1, -1, sizeof(::fs::BroadcastResponse)},
+  { 285, -1, -1, sizeof(::fs::ConfirmPushRequest)},
+  { 292, -1, -1, sizeof(::fs::ConfirmPushResponse)},
+  { 299, 307, -1, sizeof(::fs::SetProfileVarRequest_VariablesEntry_DoNotUse)},
+  { 309, -1, -1, sizeof(::fs::SetProfileVarRequest)},
+  { 317, -1, -1, sizeof(::fs::SetProfileVarResponse)},
+  { 323, -1, -1, sizeof(::fs::StopPlaybackRequest)},
+  { 330, -1, -1, sizeof(::fs::StopPlaybackResponse)},
+  { 336, 344, -1, sizeof(::fs::BridgeCallRequest_VariablesEntry_DoNotUse)},
+  { 346, -1, -1, sizeof(::fs::BridgeCallRequest)},
+  { 355, -1, -1, sizeof(::fs::BridgeCallResponse)},
+  { 363, -1, -1, sizeof(::fs::HoldRequest)},
+  { 370, -1, -1, sizeof(::fs::HoldResponse)},
+  { 377, -1, -1, sizeof(::fs::UnHoldRequest)},
+  { 384, -1, -1, sizeof(::fs::UnHoldResponse)},
+  { 391, -1, -1, sizeof(::fs::HangupManyRequest)},
+  { 399, -1, -1, sizeof(::fs::HangupManyResponse)},
+  { 406, 414, -1, sizeof(::fs::QueueRequest_VariablesEntry_DoNotUse)},
+  { 416, -1, -1, sizeof(::fs::QueueRequest)},
+  { 426, -1, -1, sizeof(::fs::QueueResponse)},
+  { 433, -1, -1, sizeof(::fs::ErrorExecute)},
+  { 441, -1, -1, sizeof(::fs::ExecuteRequest)},
+  { 449, -1, -1, sizeof(::fs::ExecuteResponse)},
+  { 457, 465, -1, sizeof(::fs::HangupRequest_VariablesEntry_DoNotUse)},
+  { 467, -1, -1, sizeof(::fs::HangupRequest)},
+  { 477, -1, -1, sizeof(::fs::HangupResponse)},
+  { 484, -1, -1, sizeof(::fs::OriginateRequest_Extension)},
+  { 492, 500, -1, sizeof(::fs::OriginateRequest_VariablesEntry_DoNotUse)},
+  { 502, -1, -1, sizeof(::fs::OriginateRequest)},
+  { 519, -1, -1, sizeof(::fs::OriginateResponse)},
+  { 528, -1, -1, sizeof(::fs::OriginateAsyncResponse)},
+  { 538, -1, -1, sizeof(::fs::OriginateBatchRequest)},
+  { 547, -1, -1, sizeof(::fs::OriginateBatchResponse)},
+  { 555, -1, -1, sizeof(::fs::BridgeRequest)},
+  { 564, -1, -1, sizeof(::fs::BridgeResponse)},
+  { 572, 580, -1, sizeof(::fs::SetVariablesRequest_VariablesEntry_DoNotUse)},
+  { 582, -1, -1, sizeof(::fs::SetVariablesRequest)},
+  { 590, -1, -1, sizeof(::fs::SetVariablesResponse)},
+  { 597, 605, -1, sizeof(::fs::HangupMatchingVarsReqeust_VariablesEntry_DoNotUse)},
+  { 607, -1, -1, sizeof(::fs::HangupMatchingVarsReqeust)},
+  { 615, -1, -1, sizeof(::fs::HangupMatchingVarsResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
+  &::fs::_SubscribeCallEventsRequest_default_instance_._instance,
+  &::fs::_CallEvent_default_instance_._instance,
+  &::fs::_CallEventPayload_Endpoint_default_instance_._instance,
+  &::fs::_CallEventPayload_Parameters_default_instance_._instance,
+  &::fs::_CallEventPayload_Eavesdrop_default_instance_._instance,
+  &::fs::_CallEventPayload_Call_default_instance_._instance,
+  &::fs::_CallEventPayload_PayloadEntry_DoNotUse_default_instance_._instance,
+  &::fs::_CallEventPayload_QueueEntry_DoNotUse_default_instance_._instance,
+  &::fs::_CallEventPayload_default_instance_._instance,
   &::fs::_BreakParkRequest_VariablesEntry_DoNotUse_default_instance_._instance,
   &::fs::_BreakParkRequest_default_instance_._instance,
   &::fs::_BreakParkResponse_default_instance_._instance,
@@ -1145,6 +1627,9 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::fs::_OriginateRequest_VariablesEntry_DoNotUse_default_instance_._instance,
   &::fs::_OriginateRequest_default_instance_._instance,
   &::fs::_OriginateResponse_default_instance_._instance,
+  &::fs::_OriginateAsyncResponse_default_instance_._instance,
+  &::fs::_OriginateBatchRequest_default_instance_._instance,
+  &::fs::_OriginateBatchResponse_default_instance_._instance,
   &::fs::_BridgeRequest_default_instance_._instance,
   &::fs::_BridgeResponse_default_instance_._instance,
   &::fs::_SetVariablesRequest_VariablesEntry_DoNotUse_default_instance_._instance,
@@ -1156,122 +1641,187 @@ static const ::_pb::Message* const file_default_instances[] = {
 };
 
 const char descriptor_table_protodef_fs_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\010fs.proto\022\002fs\"\210\001\n\020BreakParkRequest\022\n\n\002i"
-  "d\030\001 \001(\t\0226\n\tvariables\030\002 \003(\0132#.fs.BreakPar"
-  "kRequest.VariablesEntry\0320\n\016VariablesEntr"
-  "y\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"\037\n\021Bre"
-  "akParkResponse\022\n\n\002ok\030\001 \001(\010\"\310\001\n\024BlindTran"
-  "sferRequest\022\n\n\002id\030\001 \001(\t\022\023\n\013destination\030\002"
-  " \001(\t\022:\n\tvariables\030\003 \003(\0132\'.fs.BlindTransf"
-  "erRequest.VariablesEntry\022\020\n\010dialplan\030\004 \001"
-  "(\t\022\017\n\007context\030\005 \001(\t\0320\n\016VariablesEntry\022\013\n"
-  "\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"8\n\025BlindTr"
-  "ansferResponse\022\037\n\005error\030\001 \001(\0132\020.fs.Error"
-  "Execute\"5\n\030SetEavesdropStateRequest\022\n\n\002i"
-  "d\030\001 \001(\t\022\r\n\005state\030\002 \001(\t\"<\n\031SetEavesdropSt"
-  "ateResponse\022\037\n\005error\030\001 \001(\0132\020.fs.ErrorExe"
-  "cute\"R\n\020BroadcastRequest\022\n\n\002id\030\001 \001(\t\022\014\n\004"
-  "args\030\002 \001(\t\022\027\n\017wait_for_answer\030\003 \001(\010\022\013\n\003l"
-  "eg\030\004 \001(\t\"B\n\021BroadcastResponse\022\014\n\004data\030\001 "
-  "\001(\t\022\037\n\005error\030\002 \001(\0132\020.fs.ErrorExecute\" \n\022"
-  "ConfirmPushRequest\022\n\n\002id\030\001 \001(\t\"6\n\023Confir"
-  "mPushResponse\022\037\n\005error\030\001 \001(\0132\020.fs.ErrorE"
-  "xecute\"\220\001\n\024SetProfileVarRequest\022\n\n\002id\030\001 "
-  "\001(\t\022:\n\tvariables\030\002 \003(\0132\'.fs.SetProfileVa"
-  "rRequest.VariablesEntry\0320\n\016VariablesEntr"
-  "y\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"\027\n\025Set"
-  "ProfileVarResponse\"!\n\023StopPlaybackReques"
-  "t\022\n\n\002id\030\001 \001(\t\"\026\n\024StopPlaybackResponse\"\242\001"
-  "\n\021BridgeCallRequest\022\020\n\010leg_a_id\030\001 \001(\t\022\020\n"
-  "\010leg_b_id\030\002 \001(\t\0227\n\tvariables\030\003 \003(\0132$.fs."
-  "BridgeCallRequest.VariablesEntry\0320\n\016Vari"
+  "\n\010fs.proto\022\002fs\"\?\n\032SubscribeCallEventsReq"
+  "uest\022\016\n\006events\030\001 \003(\t\022\021\n\tdomain_id\030\002 \001(\003\""
+  "\265\001\n\tCallEvent\022\r\n\005event\030\001 \001(\t\022\n\n\002id\030\002 \001(\t"
+  "\022\016\n\006app_id\030\003 \001(\t\022\021\n\tdomain_id\030\004 \001(\003\022\017\n\007u"
+  "ser_id\030\005 \001(\003\022\021\n\tcc_app_id\030\006 \001(\t\022\021\n\ttimes"
+  "tamp\030\007 \001(\003\022\014\n\004data\030\010 \001(\t\022%\n\007payload\030\t \001("
+  "\0132\024.fs.CallEventPayload\"\265\r\n\020CallEventPay"
+  "load\022\017\n\007user_id\030\001 \001(\003\022\022\n\ngateway_id\030\002 \001("
+  "\003\022\022\n\ncontact_id\030\003 \001(\003\022\024\n\014hide_contact\030\004 "
+  "\001(\010\022\022\n\nhideNumber\030\005 \001(\010\0222\n\007payload\030\006 \003(\013"
+  "2!.fs.CallEventPayload.PayloadEntry\022\021\n\td"
+  "irection\030\007 \001(\t\022\023\n\013destination\030\010 \001(\t\022\021\n\tp"
+  "arent_id\030\t \001(\t\022+\n\004from\030\n \001(\0132\035.fs.CallEv"
+  "entPayload.Endpoint\022)\n\002to\030\013 \001(\0132\035.fs.Cal"
+  "lEventPayload.Endpoint\022\021\n\toriginate\030\014 \001("
+  "\010\022\021\n\theartbeat\030\r \001(\005\022\016\n\006sip_id\030\016 \001(\t\022\022\n\n"
+  "grantee_id\030\017 \001(\003\022\013\n\003ivr\030\020 \001(\t\022.\n\005queue\030\021"
+  " \003(\0132\037.fs.CallEventPayload.QueueEntry\022/\n"
+  "\006params\030\022 \001(\0132\037.fs.CallEventPayload.Para"
+  "meters\0221\n\teavesdrop\030\023 \001(\0132\036.fs.CallEvent"
+  "Payload.Eavesdrop\022\022\n\nbridged_id\030\024 \001(\t\022\r\n"
+  "\005digit\030\025 \001(\t\022\023\n\013application\030\026 \001(\t\022\r\n\005sta"
+  "te\030\027 \001(\t\022\014\n\004type\030\030 \001(\t\022\021\n\tai_result\030\031 \001("
+  "\t\022\020\n\010ai_error\030\032 \001(\t\022\016\n\006result\030\033 \001(\t\022\r\n\005c"
+  "ause\030\034 \001(\t\022\020\n\003cdr\030\035 \001(\010H\000\210\001\001\022\033\n\023notifica"
+  "tion_hangup\030\036 \001(\010\022\022\n\namd_result\030\037 \001(\t\022\021\n"
+  "\tamd_cause\030  \001(\t\022\024\n\014record_start\030! \001(\t\022\023"
+  "\n\013record_stop\030\" \001(\t\022\023\n\013transfer_to\030# \001(\t"
+  "\022\025\n\rtransfer_from\030$ \001(\t\022\031\n\021transfer_to_a"
+  "gent\030% \001(\t\022\035\n\025transfer_from_attempt\030& \001("
+  "\t\022\033\n\023transfer_to_attempt\030\' \001(\t\022\020\n\010talk_s"
+  "ec\030( \001(\t\022\021\n\thangup_by\030) \001(\t\022\024\n\014reporting"
+  "_at\030* \001(\t\022\031\n\021originate_success\030+ \001(\010\022\013\n\003"
+  "sip\030, \001(\005\022\014\n\004tags\030- \003(\t\022\022\n\nschema_ids\030. "
+  "\003(\003\022\025\n\ramd_ai_result\030/ \001(\t\022\027\n\017amd_ai_pos"
+  "itive\0300 \001(\010\022\023\n\013amd_ai_logs\0301 \003(\t\022\025\n\rhang"
+  "up_phrase\0302 \001(\t\022(\n\005calls\0303 \003(\0132\031.fs.Call"
+  "EventPayload.Call\022\020\n\010ai_local\0304 \001(\010\022\022\n\na"
+  "i_partial\0305 \001(\010\022\025\n\rai_confidence\0306 \001(\002\022\025"
+  "\n\rai_elapsed_ms\0307 \001(\003\032B\n\010Endpoint\022\014\n\004typ"
+  "e\030\001 \001(\t\022\n\n\002id\030\002 \001(\t\022\014\n\004name\030\003 \001(\t\022\016\n\006num"
+  "ber\030\004 \001(\t\032T\n\nParameters\022\r\n\005video\030\001 \001(\010\022\016"
+  "\n\006screen\030\002 \001(\010\022\022\n\nautoAnswer\030\003 \001(\t\022\023\n\013di"
+  "sableStun\030\004 \001(\010\032X\n\tEavesdrop\022\014\n\004type\030\001 \001"
+  "(\t\022\014\n\004name\030\002 \001(\t\022\016\n\006number\030\003 \001(\t\022\020\n\010dura"
+  "tion\030\004 \001(\005\022\r\n\005state\030\005 \001(\t\0326\n\004Call\022\n\n\002id\030"
+  "\001 \001(\t\022\017\n\007user_id\030\002 \001(\003\022\021\n\tcc_app_id\030\003 \001("
+  "\t\032.\n\014PayloadEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030"
+  "\002 \001(\t:\0028\001\032,\n\nQueueEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005"
+  "value\030\002 \001(\t:\0028\001B\006\n\004_cdr\"\210\001\n\020BreakParkReq"
+  "uest\022\n\n\002id\030\001 \001(\t\0226\n\tvariables\030\002 \003(\0132#.fs"
+  ".BreakParkRequest.VariablesEntry\0320\n\016Vari"
+  "ablesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\002"
+  "8\001\"\037\n\021BreakParkResponse\022\n\n\002ok\030\001 \001(\010\"\310\001\n\024"
+  "BlindTransferRequest\022\n\n\002id\030\001 \001(\t\022\023\n\013dest"
+  "ination\030\002 \001(\t\022:\n\tvariables\030\003 \003(\0132\'.fs.Bl"
+  "indTransferRequest.VariablesEntry\022\020\n\010dia"
+  "lplan\030\004 \001(\t\022\017\n\007context\030\005 \001(\t\0320\n\016Variable"
+  "sEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"8"
+  "\n\025BlindTransferResponse\022\037\n\005error\030\001 \001(\0132\020"
+  ".fs.ErrorExecute\"5\n\030SetEavesdropStateReq"
+  "uest\022\n\n\002id\030\001 \001(\t\022\r\n\005state\030\002 \001(\t\"<\n\031SetEa"
+  "vesdropStateResponse\022\037\n\005error\030\001 \001(\0132\020.fs"
+  ".ErrorExecute\"R\n\020BroadcastRequest\022\n\n\002id\030"
+  "\001 \001(\t\022\014\n\004args\030\002 \001(\t\022\027\n\017wait_for_answer\030\003"
+  " \001(\010\022\013\n\003leg\030\004 \001(\t\"B\n\021BroadcastResponse\022\014"
+  "\n\004data\030\001 \001(\t\022\037\n\005error\030\002 \001(\0132\020.fs.ErrorEx"
+  "ecute\" \n\022ConfirmPushRequest\022\n\n\002id\030\001 \001(\t\""
+  "6\n\023ConfirmPushResponse\022\037\n\005error\030\001 \001(\0132\020."
+  "fs.ErrorExecute\"\220\001\n\024SetProfileVarRequest"
+  "\022\n\n\002id\030\001 \001(\t\022:\n\tvariables\030\002 \003(\0132\'.fs.Set"
+  "ProfileVarRequest.VariablesEntry\0320\n\016Vari"
   "ablesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\002"
-  "8\001\"C\n\022BridgeCallResponse\022\014\n\004uuid\030\001 \001(\t\022\037"
-  "\n\005error\030\002 \001(\0132\020.fs.ErrorExecute\"\031\n\013HoldR"
-  "equest\022\n\n\002id\030\001 \003(\t\"\032\n\014HoldResponse\022\n\n\002id"
-  "\030\001 \003(\t\"\033\n\rUnHoldRequest\022\n\n\002id\030\001 \003(\t\"\034\n\016U"
-  "nHoldResponse\022\n\n\002id\030\001 \003(\t\".\n\021HangupManyR"
-  "equest\022\n\n\002id\030\001 \003(\t\022\r\n\005cause\030\002 \001(\t\" \n\022Han"
-  "gupManyResponse\022\n\n\002id\030\001 \003(\t\"\256\001\n\014QueueReq"
-  "uest\022\n\n\002id\030\001 \001(\t\0222\n\tvariables\030\002 \003(\0132\037.fs"
-  ".QueueRequest.VariablesEntry\022\025\n\rplayback"
-  "_file\030\003 \001(\t\022\025\n\rplayback_args\030\004 \001(\005\0320\n\016Va"
-  "riablesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t"
-  ":\0028\001\"0\n\rQueueResponse\022\037\n\005error\030\001 \001(\0132\020.f"
-  "s.ErrorExecute\"b\n\014ErrorExecute\022\017\n\007messag"
-  "e\030\001 \001(\t\022#\n\004type\030\002 \001(\0162\025.fs.ErrorExecute."
-  "Type\"\034\n\004Type\022\t\n\005ERROR\020\000\022\t\n\005USAGE\020\001\"/\n\016Ex"
-  "ecuteRequest\022\017\n\007command\030\001 \001(\t\022\014\n\004args\030\002 "
-  "\001(\t\"@\n\017ExecuteResponse\022\014\n\004data\030\001 \001(\t\022\037\n\005"
-  "error\030\002 \001(\0132\020.fs.ErrorExecute\"\246\001\n\rHangup"
-  "Request\022\014\n\004uuid\030\001 \001(\t\022\r\n\005cause\030\002 \001(\t\022\021\n\t"
-  "reporting\030\003 \001(\010\0223\n\tvariables\030\004 \003(\0132 .fs."
-  "HangupRequest.VariablesEntry\0320\n\016Variable"
-  "sEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"1"
-  "\n\016HangupResponse\022\037\n\005error\030\001 \001(\0132\020.fs.Err"
-  "orExecute\"\315\003\n\020OriginateRequest\0226\n\tvariab"
-  "les\030\001 \003(\0132#.fs.OriginateRequest.Variable"
-  "sEntry\022\021\n\tendpoints\030\002 \003(\t\022/\n\010strategy\030\003 "
-  "\001(\0162\035.fs.OriginateRequest.Strategy\022\023\n\013de"
-  "stination\030\004 \001(\t\022\017\n\007timeout\030\005 \001(\005\022\024\n\014call"
-  "erNumber\030\006 \001(\t\022\022\n\ncallerName\030\007 \001(\t\022\017\n\007co"
-  "ntext\030\010 \001(\t\022\020\n\010dialplan\030\t \001(\t\0222\n\nextensi"
-  "ons\030\n \003(\0132\036.fs.OriginateRequest.Extensio"
-  "n\022\020\n\010check_id\030\013 \001(\t\032*\n\tExtension\022\017\n\007appN"
-  "ame\030\001 \001(\t\022\014\n\004args\030\002 \001(\t\0320\n\016VariablesEntr"
-  "y\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"&\n\010Str"
-  "ategy\022\014\n\010FAILOVER\020\000\022\014\n\010MULTIPLE\020\001\"V\n\021Ori"
-  "ginateResponse\022\014\n\004uuid\030\001 \001(\t\022\037\n\005error\030\002 "
-  "\001(\0132\020.fs.ErrorExecute\022\022\n\nerror_code\030\003 \001("
-  "\005\"M\n\rBridgeRequest\022\020\n\010leg_a_id\030\001 \001(\t\022\020\n\010"
-  "leg_b_id\030\002 \001(\t\022\030\n\020leg_b_reserve_id\030\003 \001(\t"
-  "\"\?\n\016BridgeResponse\022\014\n\004uuid\030\001 \001(\t\022\037\n\005erro"
-  "r\030\002 \001(\0132\020.fs.ErrorExecute\"\220\001\n\023SetVariabl"
-  "esRequest\022\014\n\004uuid\030\001 \001(\t\0229\n\tvariables\030\002 \003"
-  "(\0132&.fs.SetVariablesRequest.VariablesEnt"
-  "ry\0320\n\016VariablesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005val"
-  "ue\030\002 \001(\t:\0028\001\"7\n\024SetVariablesResponse\022\037\n\005"
-  "error\030\001 \001(\0132\020.fs.ErrorExecute\"\235\001\n\031Hangup"
-  "MatchingVarsReqeust\022\r\n\005cause\030\001 \001(\t\022\?\n\tva"
-  "riables\030\002 \003(\0132,.fs.HangupMatchingVarsReq"
-  "eust.VariablesEntry\0320\n\016VariablesEntry\022\013\n"
-  "\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"+\n\032HangupM"
-  "atchingVarsResponse\022\r\n\005count\030\001 \001(\0052\352\010\n\003A"
-  "pi\022:\n\tOriginate\022\024.fs.OriginateRequest\032\025."
-  "fs.OriginateResponse\"\000\0224\n\007Execute\022\022.fs.E"
-  "xecuteRequest\032\023.fs.ExecuteResponse\"\000\022C\n\014"
-  "SetVariables\022\027.fs.SetVariablesRequest\032\030."
-  "fs.SetVariablesResponse\"\000\0221\n\006Bridge\022\021.fs"
-  ".BridgeRequest\032\022.fs.BridgeResponse\"\000\022=\n\n"
-  "BridgeCall\022\025.fs.BridgeCallRequest\032\026.fs.B"
-  "ridgeCallResponse\"\000\022C\n\014StopPlayback\022\027.fs"
-  ".StopPlaybackRequest\032\030.fs.StopPlaybackRe"
-  "sponse\"\000\0221\n\006Hangup\022\021.fs.HangupRequest\032\022."
-  "fs.HangupResponse\"\000\022U\n\022HangupMatchingVar"
-  "s\022\035.fs.HangupMatchingVarsReqeust\032\036.fs.Ha"
-  "ngupMatchingVarsResponse\"\000\022.\n\005Queue\022\020.fs"
-  ".QueueRequest\032\021.fs.QueueResponse\"\000\022=\n\nHa"
-  "ngupMany\022\025.fs.HangupManyRequest\032\026.fs.Han"
-  "gupManyResponse\"\000\022+\n\004Hold\022\017.fs.HoldReque"
-  "st\032\020.fs.HoldResponse\"\000\0221\n\006UnHold\022\021.fs.Un"
-  "HoldRequest\032\022.fs.UnHoldResponse\"\000\022F\n\rSet"
-  "ProfileVar\022\030.fs.SetProfileVarRequest\032\031.f"
-  "s.SetProfileVarResponse\"\000\022@\n\013ConfirmPush"
-  "\022\026.fs.ConfirmPushRequest\032\027.fs.ConfirmPus"
-  "hResponse\"\000\022:\n\tBroadcast\022\024.fs.BroadcastR"
-  "equest\032\025.fs.BroadcastResponse\"\000\022R\n\021SetEa"
-  "vesdropState\022\034.fs.SetEavesdropStateReque"
-  "st\032\035.fs.SetEavesdropStateResponse\"\000\022F\n\rB"
-  "lindTransfer\022\030.fs.BlindTransferRequest\032\031"
-  ".fs.BlindTransferResponse\"\000\022:\n\tBreakPark"
-  "\022\024.fs.BreakParkRequest\032\025.fs.BreakParkRes"
-  "ponse\"\000b\006proto3"
+  "8\001\"\027\n\025SetProfileVarResponse\"!\n\023StopPlayb"
+  "ackRequest\022\n\n\002id\030\001 \001(\t\"\026\n\024StopPlaybackRe"
+  "sponse\"\242\001\n\021BridgeCallRequest\022\020\n\010leg_a_id"
+  "\030\001 \001(\t\022\020\n\010leg_b_id\030\002 \001(\t\0227\n\tvariables\030\003 "
+  "\003(\0132$.fs.BridgeCallRequest.VariablesEntr"
+  "y\0320\n\016VariablesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005valu"
+  "e\030\002 \001(\t:\0028\001\"C\n\022BridgeCallResponse\022\014\n\004uui"
+  "d\030\001 \001(\t\022\037\n\005error\030\002 \001(\0132\020.fs.ErrorExecute"
+  "\"\031\n\013HoldRequest\022\n\n\002id\030\001 \003(\t\"\032\n\014HoldRespo"
+  "nse\022\n\n\002id\030\001 \003(\t\"\033\n\rUnHoldRequest\022\n\n\002id\030\001"
+  " \003(\t\"\034\n\016UnHoldResponse\022\n\n\002id\030\001 \003(\t\".\n\021Ha"
+  "ngupManyRequest\022\n\n\002id\030\001 \003(\t\022\r\n\005cause\030\002 \001"
+  "(\t\" \n\022HangupManyResponse\022\n\n\002id\030\001 \003(\t\"\256\001\n"
+  "\014QueueRequest\022\n\n\002id\030\001 \001(\t\0222\n\tvariables\030\002"
+  " \003(\0132\037.fs.QueueRequest.VariablesEntry\022\025\n"
+  "\rplayback_file\030\003 \001(\t\022\025\n\rplayback_args\030\004 "
+  "\001(\005\0320\n\016VariablesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005va"
+  "lue\030\002 \001(\t:\0028\001\"0\n\rQueueResponse\022\037\n\005error\030"
+  "\001 \001(\0132\020.fs.ErrorExecute\"b\n\014ErrorExecute\022"
+  "\017\n\007message\030\001 \001(\t\022#\n\004type\030\002 \001(\0162\025.fs.Erro"
+  "rExecute.Type\"\034\n\004Type\022\t\n\005ERROR\020\000\022\t\n\005USAG"
+  "E\020\001\"/\n\016ExecuteRequest\022\017\n\007command\030\001 \001(\t\022\014"
+  "\n\004args\030\002 \001(\t\"@\n\017ExecuteResponse\022\014\n\004data\030"
+  "\001 \001(\t\022\037\n\005error\030\002 \001(\0132\020.fs.ErrorExecute\"\246"
+  "\001\n\rHangupRequest\022\014\n\004uuid\030\001 \001(\t\022\r\n\005cause\030"
+  "\002 \001(\t\022\021\n\treporting\030\003 \001(\010\0223\n\tvariables\030\004 "
+  "\003(\0132 .fs.HangupRequest.VariablesEntry\0320\n"
+  "\016VariablesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 "
+  "\001(\t:\0028\001\"1\n\016HangupResponse\022\037\n\005error\030\001 \001(\013"
+  "2\020.fs.ErrorExecute\"\315\003\n\020OriginateRequest\022"
+  "6\n\tvariables\030\001 \003(\0132#.fs.OriginateRequest"
+  ".VariablesEntry\022\021\n\tendpoints\030\002 \003(\t\022/\n\010st"
+  "rategy\030\003 \001(\0162\035.fs.OriginateRequest.Strat"
+  "egy\022\023\n\013destination\030\004 \001(\t\022\017\n\007timeout\030\005 \001("
+  "\005\022\024\n\014callerNumber\030\006 \001(\t\022\022\n\ncallerName\030\007 "
+  "\001(\t\022\017\n\007context\030\010 \001(\t\022\020\n\010dialplan\030\t \001(\t\0222"
+  "\n\nextensions\030\n \003(\0132\036.fs.OriginateRequest"
+  ".Extension\022\020\n\010check_id\030\013 \001(\t\032*\n\tExtensio"
+  "n\022\017\n\007appName\030\001 \001(\t\022\014\n\004args\030\002 \001(\t\0320\n\016Vari"
+  "ablesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\002"
+  "8\001\"&\n\010Strategy\022\014\n\010FAILOVER\020\000\022\014\n\010MULTIPLE"
+  "\020\001\"V\n\021OriginateResponse\022\014\n\004uuid\030\001 \001(\t\022\037\n"
+  "\005error\030\002 \001(\0132\020.fs.ErrorExecute\022\022\n\nerror_"
+  "code\030\003 \001(\005\"\332\001\n\026OriginateAsyncResponse\022\014\n"
+  "\004uuid\030\001 \001(\t\022/\n\005state\030\002 \001(\0162 .fs.Originat"
+  "eAsyncResponse.State\022\037\n\005error\030\003 \001(\0132\020.fs"
+  ".ErrorExecute\022\022\n\nerror_code\030\004 \001(\005\"L\n\005Sta"
+  "te\022\013\n\007CREATED\020\000\022\013\n\007RINGING\020\001\022\017\n\013EARLY_ME"
+  "DIA\020\002\022\014\n\010ANSWERED\020\003\022\n\n\006FAILED\020\004\"b\n\025Origi"
+  "nateBatchRequest\022&\n\010requests\030\001 \003(\0132\024.fs."
+  "OriginateRequest\022\023\n\013concurrency\030\002 \001(\005\022\014\n"
+  "\004rate\030\003 \001(\005\"N\n\026OriginateBatchResponse\022\r\n"
+  "\005index\030\001 \001(\005\022%\n\006result\030\002 \001(\0132\025.fs.Origin"
+  "ateResponse\"M\n\rBridgeRequest\022\020\n\010leg_a_id"
+  "\030\001 \001(\t\022\020\n\010leg_b_id\030\002 \001(\t\022\030\n\020leg_b_reserv"
+  "e_id\030\003 \001(\t\"\?\n\016BridgeResponse\022\014\n\004uuid\030\001 \001"
+  "(\t\022\037\n\005error\030\002 \001(\0132\020.fs.ErrorExecute\"\220\001\n\023"
+  "SetVariablesRequest\022\014\n\004uuid\030\001 \001(\t\0229\n\tvar"
+  "iables\030\002 \003(\0132&.fs.SetVariablesRequest.Va"
+  "riablesEntry\0320\n\016VariablesEntry\022\013\n\003key\030\001 "
+  "\001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"7\n\024SetVariablesRe"
+  "sponse\022\037\n\005error\030\001 \001(\0132\020.fs.ErrorExecute\""
+  "\235\001\n\031HangupMatchingVarsReqeust\022\r\n\005cause\030\001"
+  " \001(\t\022\?\n\tvariables\030\002 \003(\0132,.fs.HangupMatch"
+  "ingVarsReqeust.VariablesEntry\0320\n\016Variabl"
+  "esEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\""
+  "+\n\032HangupMatchingVarsResponse\022\r\n\005count\030\001"
+  " \001(\0052\311\n\n\003Api\022:\n\tOriginate\022\024.fs.Originate"
+  "Request\032\025.fs.OriginateResponse\"\000\0224\n\007Exec"
+  "ute\022\022.fs.ExecuteRequest\032\023.fs.ExecuteResp"
+  "onse\"\000\022C\n\014SetVariables\022\027.fs.SetVariables"
+  "Request\032\030.fs.SetVariablesResponse\"\000\0221\n\006B"
+  "ridge\022\021.fs.BridgeRequest\032\022.fs.BridgeResp"
+  "onse\"\000\022=\n\nBridgeCall\022\025.fs.BridgeCallRequ"
+  "est\032\026.fs.BridgeCallResponse\"\000\022C\n\014StopPla"
+  "yback\022\027.fs.StopPlaybackRequest\032\030.fs.Stop"
+  "PlaybackResponse\"\000\0221\n\006Hangup\022\021.fs.Hangup"
+  "Request\032\022.fs.HangupResponse\"\000\022U\n\022HangupM"
+  "atchingVars\022\035.fs.HangupMatchingVarsReqeu"
+  "st\032\036.fs.HangupMatchingVarsResponse\"\000\022.\n\005"
+  "Queue\022\020.fs.QueueRequest\032\021.fs.QueueRespon"
+  "se\"\000\022=\n\nHangupMany\022\025.fs.HangupManyReques"
+  "t\032\026.fs.HangupManyResponse\"\000\022+\n\004Hold\022\017.fs"
+  ".HoldRequest\032\020.fs.HoldResponse\"\000\0221\n\006UnHo"
+  "ld\022\021.fs.UnHoldRequest\032\022.fs.UnHoldRespons"
+  "e\"\000\022F\n\rSetProfileVar\022\030.fs.SetProfileVarR"
+  "equest\032\031.fs.SetProfileVarResponse\"\000\022@\n\013C"
+  "onfirmPush\022\026.fs.ConfirmPushRequest\032\027.fs."
+  "ConfirmPushResponse\"\000\022:\n\tBroadcast\022\024.fs."
+  "BroadcastRequest\032\025.fs.BroadcastResponse\""
+  "\000\022R\n\021SetEavesdropState\022\034.fs.SetEavesdrop"
+  "StateRequest\032\035.fs.SetEavesdropStateRespo"
+  "nse\"\000\022F\n\rBlindTransfer\022\030.fs.BlindTransfe"
+  "rRequest\032\031.fs.BlindTransferResponse\"\000\022:\n"
+  "\tBreakPark\022\024.fs.BreakParkRequest\032\025.fs.Br"
+  "eakParkResponse\"\000\022F\n\016OriginateAsync\022\024.fs"
+  ".OriginateRequest\032\032.fs.OriginateAsyncRes"
+  "ponse\"\0000\001\022K\n\016OriginateBatch\022\031.fs.Origina"
+  "teBatchRequest\032\032.fs.OriginateBatchRespon"
+  "se\"\0000\001\022H\n\023SubscribeCallEvents\022\036.fs.Subsc"
+  "ribeCallEventsRequest\032\r.fs.CallEvent\"\0000\001"
+  "b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_fs_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_fs_2eproto = {
-    false, false, 4375, descriptor_table_protodef_fs_2eproto,
+    false, false, 6968, descriptor_table_protodef_fs_2eproto,
     "fs.proto",
-    &descriptor_table_fs_2eproto_once, nullptr, 0, 47,
+    &descriptor_table_fs_2eproto_once, nullptr, 0, 59,
     schemas, file_default_instances, TableStruct_fs_2eproto::offsets,
     file_level_metadata_fs_2eproto, file_level_enum_descriptors_fs_2eproto,
     file_level_service_descriptors_fs_2eproto,
@@ -1325,134 +1875,125 @@ constexpr OriginateRequest_Strategy OriginateRequest::Strategy_MIN;
 constexpr OriginateRequest_Strategy OriginateRequest::Strategy_MAX;
 constexpr int OriginateRequest::Strategy_ARRAYSIZE;
 #endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
-
-// ===================================================================
-
-BreakParkRequest_VariablesEntry_DoNotUse::BreakParkRequest_VariablesEntry_DoNotUse() {}
-BreakParkRequest_VariablesEntry_DoNotUse::BreakParkRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void BreakParkRequest_VariablesEntry_DoNotUse::MergeFrom(const BreakParkRequest_VariablesEntry_DoNotUse& other) {
-  MergeFromInternal(other);
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* OriginateAsyncResponse_State_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_fs_2eproto);
+  return file_level_enum_descriptors_fs_2eproto[2];
 }
-::PROTOBUF_NAMESPACE_ID::Metadata BreakParkRequest_VariablesEntry_DoNotUse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[0]);
+bool OriginateAsyncResponse_State_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
 }
 
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr OriginateAsyncResponse_State OriginateAsyncResponse::CREATED;
+constexpr OriginateAsyncResponse_State OriginateAsyncResponse::RINGING;
+constexpr OriginateAsyncResponse_State OriginateAsyncResponse::EARLY_MEDIA;
+constexpr OriginateAsyncResponse_State OriginateAsyncResponse::ANSWERED;
+constexpr OriginateAsyncResponse_State OriginateAsyncResponse::FAILED;
+constexpr OriginateAsyncResponse_State OriginateAsyncResponse::State_MIN;
+constexpr OriginateAsyncResponse_State OriginateAsyncResponse::State_MAX;
+constexpr int OriginateAsyncResponse::State_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+
 // ===================================================================
 
-class BreakParkRequest::_Internal {
+class SubscribeCallEventsRequest::_Internal {
  public:
 };
 
-BreakParkRequest::BreakParkRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SubscribeCallEventsRequest::SubscribeCallEventsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  if (arena != nullptr && !is_message_owned) {
-    arena->OwnCustomDestructor(this, &BreakParkRequest::ArenaDtor);
-  }
-  // @@protoc_insertion_point(arena_constructor:fs.BreakParkRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.SubscribeCallEventsRequest)
 }
-BreakParkRequest::BreakParkRequest(const BreakParkRequest& from)
+SubscribeCallEventsRequest::SubscribeCallEventsRequest(const SubscribeCallEventsRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  BreakParkRequest* const _this = this; (void)_this;
+  SubscribeCallEventsRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{}
-    , decltype(_impl_.id_){}
+      decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.domain_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  _impl_.id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_id().empty()) {
-    _this->_impl_.id_.Set(from._internal_id(), 
-      _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:fs.BreakParkRequest)
+  _this->_impl_.domain_id_ = from._impl_.domain_id_;
+  // @@protoc_insertion_point(copy_constructor:fs.SubscribeCallEventsRequest)
 }
 
-inline void BreakParkRequest::SharedCtor(
+inline void SubscribeCallEventsRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
-    , decltype(_impl_.id_){}
+      decltype(_impl_.events_){arena}
+    , decltype(_impl_.domain_id_){int64_t{0}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-BreakParkRequest::~BreakParkRequest() {
-  // @@protoc_insertion_point(destructor:fs.BreakParkRequest)
+SubscribeCallEventsRequest::~SubscribeCallEventsRequest() {
+  // @@protoc_insertion_point(destructor:fs.SubscribeCallEventsRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
-    ArenaDtor(this);
     return;
   }
   SharedDtor();
 }
 
-inline void BreakParkRequest::SharedDtor() {
+inline void SubscribeCallEventsRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.variables_.Destruct();
-  _impl_.variables_.~MapField();
-  _impl_.id_.Destroy();
+  _impl_.events_.~RepeatedPtrField();
 }
 
-void BreakParkRequest::ArenaDtor(void* object) {
-  BreakParkRequest* _this = reinterpret_cast< BreakParkRequest* >(object);
-  _this->_impl_.variables_.Destruct();
-}
-void BreakParkRequest::SetCachedSize(int size) const {
+void SubscribeCallEventsRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void BreakParkRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.BreakParkRequest)
+void SubscribeCallEventsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.SubscribeCallEventsRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.variables_.Clear();
-  _impl_.id_.ClearToEmpty();
+  _impl_.events_.Clear();
+  _impl_.domain_id_ = int64_t{0};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BreakParkRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SubscribeCallEventsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string id = 1;
+      // repeated string events = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BreakParkRequest.id"));
-        } else
-          goto handle_unusual;
-        continue;
-      // map<string, string> variables = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
+            auto str = _internal_add_events();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "fs.SubscribeCallEventsRequest.events"));
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 domain_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.domain_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -1479,174 +2020,228 @@ failure:
 #undef CHK_
 }
 
-uint8_t* BreakParkRequest::_InternalSerialize(
+uint8_t* SubscribeCallEventsRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.BreakParkRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.SubscribeCallEventsRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
+  // repeated string events = 1;
+  for (int i = 0, n = this->_internal_events_size(); i < n; i++) {
+    const auto& s = this->_internal_events(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BreakParkRequest.id");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_id(), target);
+      "fs.SubscribeCallEventsRequest.events");
+    target = stream->WriteString(1, s, target);
   }
 
-  // map<string, string> variables = 2;
-  if (!this->_internal_variables().empty()) {
-    using MapType = ::_pb::Map<std::string, std::string>;
-    using WireHelper = BreakParkRequest_VariablesEntry_DoNotUse::Funcs;
-    const auto& map_field = this->_internal_variables();
-    auto check_utf8 = [](const MapType::value_type& entry) {
-      (void)entry;
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.first.data(), static_cast<int>(entry.first.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.BreakParkRequest.VariablesEntry.key");
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.second.data(), static_cast<int>(entry.second.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.BreakParkRequest.VariablesEntry.value");
-    };
-
-    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
-      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
-        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    } else {
-      for (const auto& entry : map_field) {
-        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    }
+  // int64 domain_id = 2;
+  if (this->_internal_domain_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_domain_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.BreakParkRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.SubscribeCallEventsRequest)
   return target;
 }
 
-size_t BreakParkRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.BreakParkRequest)
+size_t SubscribeCallEventsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.SubscribeCallEventsRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // map<string, string> variables = 2;
+  // repeated string events = 1;
   total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
-      it = this->_internal_variables().begin();
-      it != this->_internal_variables().end(); ++it) {
-    total_size += BreakParkRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.events_.size());
+  for (int i = 0, n = _impl_.events_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.events_.Get(i));
   }
 
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_id());
+  // int64 domain_id = 2;
+  if (this->_internal_domain_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_domain_id());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BreakParkRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SubscribeCallEventsRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    BreakParkRequest::MergeImpl
+    SubscribeCallEventsRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BreakParkRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SubscribeCallEventsRequest::GetClassData() const { return &_class_data_; }
 
 
-void BreakParkRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<BreakParkRequest*>(&to_msg);
-  auto& from = static_cast<const BreakParkRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BreakParkRequest)
+void SubscribeCallEventsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SubscribeCallEventsRequest*>(&to_msg);
+  auto& from = static_cast<const SubscribeCallEventsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.SubscribeCallEventsRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  if (!from._internal_id().empty()) {
-    _this->_internal_set_id(from._internal_id());
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  if (from._internal_domain_id() != 0) {
+    _this->_internal_set_domain_id(from._internal_domain_id());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BreakParkRequest::CopyFrom(const BreakParkRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.BreakParkRequest)
+void SubscribeCallEventsRequest::CopyFrom(const SubscribeCallEventsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.SubscribeCallEventsRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BreakParkRequest::IsInitialized() const {
+bool SubscribeCallEventsRequest::IsInitialized() const {
   return true;
 }
 
-void BreakParkRequest::InternalSwap(BreakParkRequest* other) {
+void SubscribeCallEventsRequest::InternalSwap(SubscribeCallEventsRequest* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.id_, lhs_arena,
-      &other->_impl_.id_, rhs_arena
-  );
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  swap(_impl_.domain_id_, other->_impl_.domain_id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BreakParkRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SubscribeCallEventsRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[1]);
+      file_level_metadata_fs_2eproto[0]);
 }
 
 // ===================================================================
 
-class BreakParkResponse::_Internal {
+class CallEvent::_Internal {
  public:
+  static const ::fs::CallEventPayload& payload(const CallEvent* msg);
 };
 
-BreakParkResponse::BreakParkResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::fs::CallEventPayload&
+CallEvent::_Internal::payload(const CallEvent* msg) {
+  return *msg->_impl_.payload_;
+}
+CallEvent::CallEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.BreakParkResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.CallEvent)
 }
-BreakParkResponse::BreakParkResponse(const BreakParkResponse& from)
+CallEvent::CallEvent(const CallEvent& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  BreakParkResponse* const _this = this; (void)_this;
+  CallEvent* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.ok_){}
+      decltype(_impl_.event_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.app_id_){}
+    , decltype(_impl_.cc_app_id_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.payload_){nullptr}
+    , decltype(_impl_.domain_id_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.timestamp_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.ok_ = from._impl_.ok_;
-  // @@protoc_insertion_point(copy_constructor:fs.BreakParkResponse)
+  _impl_.event_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_event().empty()) {
+    _this->_impl_.event_.Set(from._internal_event(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.app_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.app_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_app_id().empty()) {
+    _this->_impl_.app_id_.Set(from._internal_app_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cc_app_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cc_app_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cc_app_id().empty()) {
+    _this->_impl_.cc_app_id_.Set(from._internal_cc_app_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_payload()) {
+    _this->_impl_.payload_ = new ::fs::CallEventPayload(*from._impl_.payload_);
+  }
+  ::memcpy(&_impl_.domain_id_, &from._impl_.domain_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timestamp_) -
+    reinterpret_cast<char*>(&_impl_.domain_id_)) + sizeof(_impl_.timestamp_));
+  // @@protoc_insertion_point(copy_constructor:fs.CallEvent)
 }
 
-inline void BreakParkResponse::SharedCtor(
+inline void CallEvent::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.ok_){false}
+      decltype(_impl_.event_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.app_id_){}
+    , decltype(_impl_.cc_app_id_){}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.payload_){nullptr}
+    , decltype(_impl_.domain_id_){int64_t{0}}
+    , decltype(_impl_.user_id_){int64_t{0}}
+    , decltype(_impl_.timestamp_){int64_t{0}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.event_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.app_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.app_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cc_app_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cc_app_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-BreakParkResponse::~BreakParkResponse() {
-  // @@protoc_insertion_point(destructor:fs.BreakParkResponse)
+CallEvent::~CallEvent() {
+  // @@protoc_insertion_point(destructor:fs.CallEvent)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1654,34 +2249,125 @@ BreakParkResponse::~BreakParkResponse() {
   SharedDtor();
 }
 
-inline void BreakParkResponse::SharedDtor() {
+inline void CallEvent::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.event_.Destroy();
+  _impl_.id_.Destroy();
+  _impl_.app_id_.Destroy();
+  _impl_.cc_app_id_.Destroy();
+  _impl_.data_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.payload_;
 }
 
-void BreakParkResponse::SetCachedSize(int size) const {
+void CallEvent::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void BreakParkResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.BreakParkResponse)
+void CallEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.CallEvent)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.ok_ = false;
+  _impl_.event_.ClearToEmpty();
+  _impl_.id_.ClearToEmpty();
+  _impl_.app_id_.ClearToEmpty();
+  _impl_.cc_app_id_.ClearToEmpty();
+  _impl_.data_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.payload_ != nullptr) {
+    delete _impl_.payload_;
+  }
+  _impl_.payload_ = nullptr;
+  ::memset(&_impl_.domain_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.timestamp_) -
+      reinterpret_cast<char*>(&_impl_.domain_id_)) + sizeof(_impl_.timestamp_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BreakParkResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CallEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // bool ok = 1;
+      // string event = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.ok_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_event();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEvent.event"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEvent.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string app_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_app_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEvent.app_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 domain_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.domain_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 user_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.user_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string cc_app_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_cc_app_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEvent.cc_app_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 timestamp = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string data = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEvent.data"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .fs.CallEventPayload payload = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_payload(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1709,291 +2395,423 @@ failure:
 #undef CHK_
 }
 
-uint8_t* BreakParkResponse::_InternalSerialize(
+uint8_t* CallEvent::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.BreakParkResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.CallEvent)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // bool ok = 1;
-  if (this->_internal_ok() != 0) {
+  // string event = 1;
+  if (!this->_internal_event().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_event().data(), static_cast<int>(this->_internal_event().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEvent.event");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_event(), target);
+  }
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEvent.id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_id(), target);
+  }
+
+  // string app_id = 3;
+  if (!this->_internal_app_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_app_id().data(), static_cast<int>(this->_internal_app_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEvent.app_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_app_id(), target);
+  }
+
+  // int64 domain_id = 4;
+  if (this->_internal_domain_id() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_ok(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_domain_id(), target);
+  }
+
+  // int64 user_id = 5;
+  if (this->_internal_user_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_user_id(), target);
+  }
+
+  // string cc_app_id = 6;
+  if (!this->_internal_cc_app_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cc_app_id().data(), static_cast<int>(this->_internal_cc_app_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEvent.cc_app_id");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_cc_app_id(), target);
+  }
+
+  // int64 timestamp = 7;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_timestamp(), target);
+  }
+
+  // string data = 8;
+  if (!this->_internal_data().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_data().data(), static_cast<int>(this->_internal_data().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEvent.data");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_data(), target);
+  }
+
+  // .fs.CallEventPayload payload = 9;
+  if (this->_internal_has_payload()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::payload(this),
+        _Internal::payload(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.BreakParkResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.CallEvent)
   return target;
 }
 
-size_t BreakParkResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.BreakParkResponse)
+size_t CallEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.CallEvent)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // bool ok = 1;
-  if (this->_internal_ok() != 0) {
-    total_size += 1 + 1;
+  // string event = 1;
+  if (!this->_internal_event().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_event());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BreakParkResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    BreakParkResponse::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BreakParkResponse::GetClassData() const { return &_class_data_; }
+  // string app_id = 3;
+  if (!this->_internal_app_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_app_id());
+  }
 
+  // string cc_app_id = 6;
+  if (!this->_internal_cc_app_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cc_app_id());
+  }
 
-void BreakParkResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<BreakParkResponse*>(&to_msg);
-  auto& from = static_cast<const BreakParkResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BreakParkResponse)
-  GOOGLE_DCHECK_NE(&from, _this);
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
+  // string data = 8;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_data());
+  }
 
-  if (from._internal_ok() != 0) {
-    _this->_internal_set_ok(from._internal_ok());
+  // .fs.CallEventPayload payload = 9;
+  if (this->_internal_has_payload()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.payload_);
+  }
+
+  // int64 domain_id = 4;
+  if (this->_internal_domain_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_domain_id());
+  }
+
+  // int64 user_id = 5;
+  if (this->_internal_user_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_user_id());
+  }
+
+  // int64 timestamp = 7;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CallEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CallEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CallEvent::GetClassData() const { return &_class_data_; }
+
+
+void CallEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CallEvent*>(&to_msg);
+  auto& from = static_cast<const CallEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.CallEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_event().empty()) {
+    _this->_internal_set_event(from._internal_event());
+  }
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_app_id().empty()) {
+    _this->_internal_set_app_id(from._internal_app_id());
+  }
+  if (!from._internal_cc_app_id().empty()) {
+    _this->_internal_set_cc_app_id(from._internal_cc_app_id());
+  }
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_has_payload()) {
+    _this->_internal_mutable_payload()->::fs::CallEventPayload::MergeFrom(
+        from._internal_payload());
+  }
+  if (from._internal_domain_id() != 0) {
+    _this->_internal_set_domain_id(from._internal_domain_id());
+  }
+  if (from._internal_user_id() != 0) {
+    _this->_internal_set_user_id(from._internal_user_id());
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BreakParkResponse::CopyFrom(const BreakParkResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.BreakParkResponse)
+void CallEvent::CopyFrom(const CallEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.CallEvent)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BreakParkResponse::IsInitialized() const {
+bool CallEvent::IsInitialized() const {
   return true;
 }
 
-void BreakParkResponse::InternalSwap(BreakParkResponse* other) {
+void CallEvent::InternalSwap(CallEvent* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.ok_, other->_impl_.ok_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata BreakParkResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[2]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.event_, lhs_arena,
+      &other->_impl_.event_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.app_id_, lhs_arena,
+      &other->_impl_.app_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cc_app_id_, lhs_arena,
+      &other->_impl_.cc_app_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CallEvent, _impl_.timestamp_)
+      + sizeof(CallEvent::_impl_.timestamp_)
+      - PROTOBUF_FIELD_OFFSET(CallEvent, _impl_.payload_)>(
+          reinterpret_cast<char*>(&_impl_.payload_),
+          reinterpret_cast<char*>(&other->_impl_.payload_));
 }
 
-// ===================================================================
-
-BlindTransferRequest_VariablesEntry_DoNotUse::BlindTransferRequest_VariablesEntry_DoNotUse() {}
-BlindTransferRequest_VariablesEntry_DoNotUse::BlindTransferRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void BlindTransferRequest_VariablesEntry_DoNotUse::MergeFrom(const BlindTransferRequest_VariablesEntry_DoNotUse& other) {
-  MergeFromInternal(other);
-}
-::PROTOBUF_NAMESPACE_ID::Metadata BlindTransferRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CallEvent::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[3]);
+      file_level_metadata_fs_2eproto[1]);
 }
 
 // ===================================================================
 
-class BlindTransferRequest::_Internal {
+class CallEventPayload_Endpoint::_Internal {
  public:
 };
 
-BlindTransferRequest::BlindTransferRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CallEventPayload_Endpoint::CallEventPayload_Endpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  if (arena != nullptr && !is_message_owned) {
-    arena->OwnCustomDestructor(this, &BlindTransferRequest::ArenaDtor);
-  }
-  // @@protoc_insertion_point(arena_constructor:fs.BlindTransferRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.CallEventPayload.Endpoint)
 }
-BlindTransferRequest::BlindTransferRequest(const BlindTransferRequest& from)
+CallEventPayload_Endpoint::CallEventPayload_Endpoint(const CallEventPayload_Endpoint& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  BlindTransferRequest* const _this = this; (void)_this;
+  CallEventPayload_Endpoint* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{}
+      decltype(_impl_.type_){}
     , decltype(_impl_.id_){}
-    , decltype(_impl_.destination_){}
-    , decltype(_impl_.dialplan_){}
-    , decltype(_impl_.context_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.number_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  _impl_.id_.InitDefault();
+  _impl_.type_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
+    _impl_.type_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_id().empty()) {
-    _this->_impl_.id_.Set(from._internal_id(), 
+  if (!from._internal_type().empty()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.destination_.InitDefault();
+  _impl_.id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.destination_.Set("", GetArenaForAllocation());
+    _impl_.id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_destination().empty()) {
-    _this->_impl_.destination_.Set(from._internal_destination(), 
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.dialplan_.InitDefault();
+  _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.dialplan_.Set("", GetArenaForAllocation());
+    _impl_.name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_dialplan().empty()) {
-    _this->_impl_.dialplan_.Set(from._internal_dialplan(), 
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.context_.InitDefault();
+  _impl_.number_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.context_.Set("", GetArenaForAllocation());
+    _impl_.number_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_context().empty()) {
-    _this->_impl_.context_.Set(from._internal_context(), 
+  if (!from._internal_number().empty()) {
+    _this->_impl_.number_.Set(from._internal_number(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.BlindTransferRequest)
+  // @@protoc_insertion_point(copy_constructor:fs.CallEventPayload.Endpoint)
 }
 
-inline void BlindTransferRequest::SharedCtor(
+inline void CallEventPayload_Endpoint::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
+      decltype(_impl_.type_){}
     , decltype(_impl_.id_){}
-    , decltype(_impl_.destination_){}
-    , decltype(_impl_.dialplan_){}
-    , decltype(_impl_.context_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.number_){}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.id_.InitDefault();
+  _impl_.type_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
+    _impl_.type_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.destination_.InitDefault();
+  _impl_.id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.destination_.Set("", GetArenaForAllocation());
+    _impl_.id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.dialplan_.InitDefault();
+  _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.dialplan_.Set("", GetArenaForAllocation());
+    _impl_.name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.context_.InitDefault();
+  _impl_.number_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.context_.Set("", GetArenaForAllocation());
+    _impl_.number_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-BlindTransferRequest::~BlindTransferRequest() {
-  // @@protoc_insertion_point(destructor:fs.BlindTransferRequest)
+CallEventPayload_Endpoint::~CallEventPayload_Endpoint() {
+  // @@protoc_insertion_point(destructor:fs.CallEventPayload.Endpoint)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
-    ArenaDtor(this);
     return;
   }
   SharedDtor();
 }
 
-inline void BlindTransferRequest::SharedDtor() {
+inline void CallEventPayload_Endpoint::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.variables_.Destruct();
-  _impl_.variables_.~MapField();
+  _impl_.type_.Destroy();
   _impl_.id_.Destroy();
-  _impl_.destination_.Destroy();
-  _impl_.dialplan_.Destroy();
-  _impl_.context_.Destroy();
+  _impl_.name_.Destroy();
+  _impl_.number_.Destroy();
 }
 
-void BlindTransferRequest::ArenaDtor(void* object) {
-  BlindTransferRequest* _this = reinterpret_cast< BlindTransferRequest* >(object);
-  _this->_impl_.variables_.Destruct();
-}
-void BlindTransferRequest::SetCachedSize(int size) const {
+void CallEventPayload_Endpoint::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void BlindTransferRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.BlindTransferRequest)
+void CallEventPayload_Endpoint::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.CallEventPayload.Endpoint)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.variables_.Clear();
+  _impl_.type_.ClearToEmpty();
   _impl_.id_.ClearToEmpty();
-  _impl_.destination_.ClearToEmpty();
-  _impl_.dialplan_.ClearToEmpty();
-  _impl_.context_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  _impl_.number_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BlindTransferRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CallEventPayload_Endpoint::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string id = 1;
+      // string type = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_id();
+          auto str = _internal_mutable_type();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BlindTransferRequest.id"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Endpoint.type"));
         } else
           goto handle_unusual;
         continue;
-      // string destination = 2;
+      // string id = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_destination();
+          auto str = _internal_mutable_id();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BlindTransferRequest.destination"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Endpoint.id"));
         } else
           goto handle_unusual;
         continue;
-      // map<string, string> variables = 3;
+      // string name = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
-      // string dialplan = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_dialplan();
+          auto str = _internal_mutable_name();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BlindTransferRequest.dialplan"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Endpoint.name"));
         } else
           goto handle_unusual;
         continue;
-      // string context = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          auto str = _internal_mutable_context();
+      // string number = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_number();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BlindTransferRequest.context"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Endpoint.number"));
         } else
           goto handle_unusual;
         continue;
@@ -2020,253 +2838,225 @@ failure:
 #undef CHK_
 }
 
-uint8_t* BlindTransferRequest::_InternalSerialize(
+uint8_t* CallEventPayload_Endpoint::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.BlindTransferRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.CallEventPayload.Endpoint)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
+  // string type = 1;
+  if (!this->_internal_type().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BlindTransferRequest.id");
+      "fs.CallEventPayload.Endpoint.type");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_id(), target);
+        1, this->_internal_type(), target);
   }
 
-  // string destination = 2;
-  if (!this->_internal_destination().empty()) {
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_destination().data(), static_cast<int>(this->_internal_destination().length()),
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BlindTransferRequest.destination");
+      "fs.CallEventPayload.Endpoint.id");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_destination(), target);
-  }
-
-  // map<string, string> variables = 3;
-  if (!this->_internal_variables().empty()) {
-    using MapType = ::_pb::Map<std::string, std::string>;
-    using WireHelper = BlindTransferRequest_VariablesEntry_DoNotUse::Funcs;
-    const auto& map_field = this->_internal_variables();
-    auto check_utf8 = [](const MapType::value_type& entry) {
-      (void)entry;
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.first.data(), static_cast<int>(entry.first.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.BlindTransferRequest.VariablesEntry.key");
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.second.data(), static_cast<int>(entry.second.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.BlindTransferRequest.VariablesEntry.value");
-    };
-
-    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
-      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
-        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    } else {
-      for (const auto& entry : map_field) {
-        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    }
+        2, this->_internal_id(), target);
   }
 
-  // string dialplan = 4;
-  if (!this->_internal_dialplan().empty()) {
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_dialplan().data(), static_cast<int>(this->_internal_dialplan().length()),
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BlindTransferRequest.dialplan");
+      "fs.CallEventPayload.Endpoint.name");
     target = stream->WriteStringMaybeAliased(
-        4, this->_internal_dialplan(), target);
+        3, this->_internal_name(), target);
   }
 
-  // string context = 5;
-  if (!this->_internal_context().empty()) {
+  // string number = 4;
+  if (!this->_internal_number().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_context().data(), static_cast<int>(this->_internal_context().length()),
+      this->_internal_number().data(), static_cast<int>(this->_internal_number().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BlindTransferRequest.context");
+      "fs.CallEventPayload.Endpoint.number");
     target = stream->WriteStringMaybeAliased(
-        5, this->_internal_context(), target);
+        4, this->_internal_number(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.BlindTransferRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.CallEventPayload.Endpoint)
   return target;
 }
 
-size_t BlindTransferRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.BlindTransferRequest)
+size_t CallEventPayload_Endpoint::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.CallEventPayload.Endpoint)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // map<string, string> variables = 3;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
-      it = this->_internal_variables().begin();
-      it != this->_internal_variables().end(); ++it) {
-    total_size += BlindTransferRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  // string type = 1;
+  if (!this->_internal_type().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
   }
 
-  // string id = 1;
+  // string id = 2;
   if (!this->_internal_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_id());
   }
 
-  // string destination = 2;
-  if (!this->_internal_destination().empty()) {
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_destination());
+        this->_internal_name());
   }
 
-  // string dialplan = 4;
-  if (!this->_internal_dialplan().empty()) {
+  // string number = 4;
+  if (!this->_internal_number().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_dialplan());
-  }
-
-  // string context = 5;
-  if (!this->_internal_context().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_context());
+        this->_internal_number());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlindTransferRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CallEventPayload_Endpoint::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    BlindTransferRequest::MergeImpl
+    CallEventPayload_Endpoint::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlindTransferRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CallEventPayload_Endpoint::GetClassData() const { return &_class_data_; }
 
 
-void BlindTransferRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<BlindTransferRequest*>(&to_msg);
-  auto& from = static_cast<const BlindTransferRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BlindTransferRequest)
+void CallEventPayload_Endpoint::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CallEventPayload_Endpoint*>(&to_msg);
+  auto& from = static_cast<const CallEventPayload_Endpoint&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.CallEventPayload.Endpoint)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  if (!from._internal_type().empty()) {
+    _this->_internal_set_type(from._internal_type());
+  }
   if (!from._internal_id().empty()) {
     _this->_internal_set_id(from._internal_id());
   }
-  if (!from._internal_destination().empty()) {
-    _this->_internal_set_destination(from._internal_destination());
-  }
-  if (!from._internal_dialplan().empty()) {
-    _this->_internal_set_dialplan(from._internal_dialplan());
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
   }
-  if (!from._internal_context().empty()) {
-    _this->_internal_set_context(from._internal_context());
+  if (!from._internal_number().empty()) {
+    _this->_internal_set_number(from._internal_number());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BlindTransferRequest::CopyFrom(const BlindTransferRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.BlindTransferRequest)
+void CallEventPayload_Endpoint::CopyFrom(const CallEventPayload_Endpoint& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.CallEventPayload.Endpoint)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BlindTransferRequest::IsInitialized() const {
+bool CallEventPayload_Endpoint::IsInitialized() const {
   return true;
 }
 
-void BlindTransferRequest::InternalSwap(BlindTransferRequest* other) {
+void CallEventPayload_Endpoint::InternalSwap(CallEventPayload_Endpoint* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.id_, lhs_arena,
-      &other->_impl_.id_, rhs_arena
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.destination_, lhs_arena,
-      &other->_impl_.destination_, rhs_arena
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.dialplan_, lhs_arena,
-      &other->_impl_.dialplan_, rhs_arena
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.context_, lhs_arena,
-      &other->_impl_.context_, rhs_arena
+      &_impl_.number_, lhs_arena,
+      &other->_impl_.number_, rhs_arena
   );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BlindTransferRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CallEventPayload_Endpoint::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[4]);
+      file_level_metadata_fs_2eproto[2]);
 }
 
 // ===================================================================
 
-class BlindTransferResponse::_Internal {
+class CallEventPayload_Parameters::_Internal {
  public:
-  static const ::fs::ErrorExecute& error(const BlindTransferResponse* msg);
 };
 
-const ::fs::ErrorExecute&
-BlindTransferResponse::_Internal::error(const BlindTransferResponse* msg) {
-  return *msg->_impl_.error_;
-}
-BlindTransferResponse::BlindTransferResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CallEventPayload_Parameters::CallEventPayload_Parameters(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.BlindTransferResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.CallEventPayload.Parameters)
 }
-BlindTransferResponse::BlindTransferResponse(const BlindTransferResponse& from)
+CallEventPayload_Parameters::CallEventPayload_Parameters(const CallEventPayload_Parameters& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  BlindTransferResponse* const _this = this; (void)_this;
+  CallEventPayload_Parameters* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.error_){nullptr}
+      decltype(_impl_.autoanswer_){}
+    , decltype(_impl_.video_){}
+    , decltype(_impl_.screen_){}
+    , decltype(_impl_.disablestun_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_error()) {
-    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  _impl_.autoanswer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.autoanswer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_autoanswer().empty()) {
+    _this->_impl_.autoanswer_.Set(from._internal_autoanswer(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.BlindTransferResponse)
+  ::memcpy(&_impl_.video_, &from._impl_.video_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.disablestun_) -
+    reinterpret_cast<char*>(&_impl_.video_)) + sizeof(_impl_.disablestun_));
+  // @@protoc_insertion_point(copy_constructor:fs.CallEventPayload.Parameters)
 }
 
-inline void BlindTransferResponse::SharedCtor(
+inline void CallEventPayload_Parameters::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.error_){nullptr}
+      decltype(_impl_.autoanswer_){}
+    , decltype(_impl_.video_){false}
+    , decltype(_impl_.screen_){false}
+    , decltype(_impl_.disablestun_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.autoanswer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.autoanswer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-BlindTransferResponse::~BlindTransferResponse() {
-  // @@protoc_insertion_point(destructor:fs.BlindTransferResponse)
+CallEventPayload_Parameters::~CallEventPayload_Parameters() {
+  // @@protoc_insertion_point(destructor:fs.CallEventPayload.Parameters)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2274,38 +3064,64 @@ BlindTransferResponse::~BlindTransferResponse() {
   SharedDtor();
 }
 
-inline void BlindTransferResponse::SharedDtor() {
+inline void CallEventPayload_Parameters::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.error_;
+  _impl_.autoanswer_.Destroy();
 }
 
-void BlindTransferResponse::SetCachedSize(int size) const {
+void CallEventPayload_Parameters::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void BlindTransferResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.BlindTransferResponse)
+void CallEventPayload_Parameters::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.CallEventPayload.Parameters)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
-    delete _impl_.error_;
-  }
-  _impl_.error_ = nullptr;
+  _impl_.autoanswer_.ClearToEmpty();
+  ::memset(&_impl_.video_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.disablestun_) -
+      reinterpret_cast<char*>(&_impl_.video_)) + sizeof(_impl_.disablestun_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BlindTransferResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CallEventPayload_Parameters::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .fs.ErrorExecute error = 1;
+      // bool video = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.video_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool screen = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.screen_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string autoAnswer = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_autoanswer();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Parameters.autoAnswer"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool disableStun = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.disablestun_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -2333,117 +3149,191 @@ failure:
 #undef CHK_
 }
 
-uint8_t* BlindTransferResponse::_InternalSerialize(
+uint8_t* CallEventPayload_Parameters::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.BlindTransferResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.CallEventPayload.Parameters)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .fs.ErrorExecute error = 1;
-  if (this->_internal_has_error()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::error(this),
-        _Internal::error(this).GetCachedSize(), target, stream);
+  // bool video = 1;
+  if (this->_internal_video() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_video(), target);
+  }
+
+  // bool screen = 2;
+  if (this->_internal_screen() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_screen(), target);
+  }
+
+  // string autoAnswer = 3;
+  if (!this->_internal_autoanswer().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_autoanswer().data(), static_cast<int>(this->_internal_autoanswer().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.Parameters.autoAnswer");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_autoanswer(), target);
+  }
+
+  // bool disableStun = 4;
+  if (this->_internal_disablestun() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_disablestun(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.BlindTransferResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.CallEventPayload.Parameters)
   return target;
 }
 
-size_t BlindTransferResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.BlindTransferResponse)
+size_t CallEventPayload_Parameters::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.CallEventPayload.Parameters)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .fs.ErrorExecute error = 1;
-  if (this->_internal_has_error()) {
+  // string autoAnswer = 3;
+  if (!this->_internal_autoanswer().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.error_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_autoanswer());
+  }
+
+  // bool video = 1;
+  if (this->_internal_video() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool screen = 2;
+  if (this->_internal_screen() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool disableStun = 4;
+  if (this->_internal_disablestun() != 0) {
+    total_size += 1 + 1;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlindTransferResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CallEventPayload_Parameters::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    BlindTransferResponse::MergeImpl
+    CallEventPayload_Parameters::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlindTransferResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CallEventPayload_Parameters::GetClassData() const { return &_class_data_; }
 
 
-void BlindTransferResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<BlindTransferResponse*>(&to_msg);
-  auto& from = static_cast<const BlindTransferResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BlindTransferResponse)
+void CallEventPayload_Parameters::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CallEventPayload_Parameters*>(&to_msg);
+  auto& from = static_cast<const CallEventPayload_Parameters&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.CallEventPayload.Parameters)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_error()) {
-    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
-        from._internal_error());
+  if (!from._internal_autoanswer().empty()) {
+    _this->_internal_set_autoanswer(from._internal_autoanswer());
+  }
+  if (from._internal_video() != 0) {
+    _this->_internal_set_video(from._internal_video());
+  }
+  if (from._internal_screen() != 0) {
+    _this->_internal_set_screen(from._internal_screen());
+  }
+  if (from._internal_disablestun() != 0) {
+    _this->_internal_set_disablestun(from._internal_disablestun());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BlindTransferResponse::CopyFrom(const BlindTransferResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.BlindTransferResponse)
+void CallEventPayload_Parameters::CopyFrom(const CallEventPayload_Parameters& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.CallEventPayload.Parameters)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BlindTransferResponse::IsInitialized() const {
+bool CallEventPayload_Parameters::IsInitialized() const {
   return true;
 }
 
-void BlindTransferResponse::InternalSwap(BlindTransferResponse* other) {
+void CallEventPayload_Parameters::InternalSwap(CallEventPayload_Parameters* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.error_, other->_impl_.error_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.autoanswer_, lhs_arena,
+      &other->_impl_.autoanswer_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CallEventPayload_Parameters, _impl_.disablestun_)
+      + sizeof(CallEventPayload_Parameters::_impl_.disablestun_)
+      - PROTOBUF_FIELD_OFFSET(CallEventPayload_Parameters, _impl_.video_)>(
+          reinterpret_cast<char*>(&_impl_.video_),
+          reinterpret_cast<char*>(&other->_impl_.video_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BlindTransferResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CallEventPayload_Parameters::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[5]);
+      file_level_metadata_fs_2eproto[3]);
 }
 
 // ===================================================================
 
-class SetEavesdropStateRequest::_Internal {
+class CallEventPayload_Eavesdrop::_Internal {
  public:
 };
 
-SetEavesdropStateRequest::SetEavesdropStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CallEventPayload_Eavesdrop::CallEventPayload_Eavesdrop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.SetEavesdropStateRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.CallEventPayload.Eavesdrop)
 }
-SetEavesdropStateRequest::SetEavesdropStateRequest(const SetEavesdropStateRequest& from)
+CallEventPayload_Eavesdrop::CallEventPayload_Eavesdrop(const CallEventPayload_Eavesdrop& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetEavesdropStateRequest* const _this = this; (void)_this;
+  CallEventPayload_Eavesdrop* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){}
+      decltype(_impl_.type_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.number_){}
     , decltype(_impl_.state_){}
+    , decltype(_impl_.duration_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.id_.InitDefault();
+  _impl_.type_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
+    _impl_.type_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_id().empty()) {
-    _this->_impl_.id_.Set(from._internal_id(), 
+  if (!from._internal_type().empty()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.number_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.number_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_number().empty()) {
+    _this->_impl_.number_.Set(from._internal_number(), 
       _this->GetArenaForAllocation());
   }
   _impl_.state_.InitDefault();
@@ -2454,21 +3344,33 @@ SetEavesdropStateRequest::SetEavesdropStateRequest(const SetEavesdropStateReques
     _this->_impl_.state_.Set(from._internal_state(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.SetEavesdropStateRequest)
+  _this->_impl_.duration_ = from._impl_.duration_;
+  // @@protoc_insertion_point(copy_constructor:fs.CallEventPayload.Eavesdrop)
 }
 
-inline void SetEavesdropStateRequest::SharedCtor(
+inline void CallEventPayload_Eavesdrop::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){}
+      decltype(_impl_.type_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.number_){}
     , decltype(_impl_.state_){}
+    , decltype(_impl_.duration_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.id_.InitDefault();
+  _impl_.type_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.number_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.number_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   _impl_.state_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2476,8 +3378,8 @@ inline void SetEavesdropStateRequest::SharedCtor(
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SetEavesdropStateRequest::~SetEavesdropStateRequest() {
-  // @@protoc_insertion_point(destructor:fs.SetEavesdropStateRequest)
+CallEventPayload_Eavesdrop::~CallEventPayload_Eavesdrop() {
+  // @@protoc_insertion_point(destructor:fs.CallEventPayload.Eavesdrop)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2485,50 +3387,83 @@ SetEavesdropStateRequest::~SetEavesdropStateRequest() {
   SharedDtor();
 }
 
-inline void SetEavesdropStateRequest::SharedDtor() {
+inline void CallEventPayload_Eavesdrop::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.id_.Destroy();
+  _impl_.type_.Destroy();
+  _impl_.name_.Destroy();
+  _impl_.number_.Destroy();
   _impl_.state_.Destroy();
 }
 
-void SetEavesdropStateRequest::SetCachedSize(int size) const {
+void CallEventPayload_Eavesdrop::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetEavesdropStateRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.SetEavesdropStateRequest)
+void CallEventPayload_Eavesdrop::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.CallEventPayload.Eavesdrop)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.id_.ClearToEmpty();
+  _impl_.type_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  _impl_.number_.ClearToEmpty();
   _impl_.state_.ClearToEmpty();
+  _impl_.duration_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetEavesdropStateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CallEventPayload_Eavesdrop::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string id = 1;
+      // string type = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_id();
+          auto str = _internal_mutable_type();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.SetEavesdropStateRequest.id"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Eavesdrop.type"));
         } else
           goto handle_unusual;
         continue;
-      // string state = 2;
+      // string name = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Eavesdrop.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string number = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_number();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Eavesdrop.number"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 duration = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.duration_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string state = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           auto str = _internal_mutable_state();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.SetEavesdropStateRequest.state"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Eavesdrop.state"));
         } else
           goto handle_unusual;
         continue;
@@ -2555,164 +3490,248 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetEavesdropStateRequest::_InternalSerialize(
+uint8_t* CallEventPayload_Eavesdrop::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.SetEavesdropStateRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.CallEventPayload.Eavesdrop)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
+  // string type = 1;
+  if (!this->_internal_type().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.SetEavesdropStateRequest.id");
+      "fs.CallEventPayload.Eavesdrop.type");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_id(), target);
+        1, this->_internal_type(), target);
   }
 
-  // string state = 2;
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.Eavesdrop.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  // string number = 3;
+  if (!this->_internal_number().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_number().data(), static_cast<int>(this->_internal_number().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.Eavesdrop.number");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_number(), target);
+  }
+
+  // int32 duration = 4;
+  if (this->_internal_duration() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_duration(), target);
+  }
+
+  // string state = 5;
   if (!this->_internal_state().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_state().data(), static_cast<int>(this->_internal_state().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.SetEavesdropStateRequest.state");
+      "fs.CallEventPayload.Eavesdrop.state");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_state(), target);
+        5, this->_internal_state(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.SetEavesdropStateRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.CallEventPayload.Eavesdrop)
   return target;
 }
 
-size_t SetEavesdropStateRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.SetEavesdropStateRequest)
+size_t CallEventPayload_Eavesdrop::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.CallEventPayload.Eavesdrop)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
+  // string type = 1;
+  if (!this->_internal_type().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_id());
+        this->_internal_type());
   }
 
-  // string state = 2;
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string number = 3;
+  if (!this->_internal_number().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_number());
+  }
+
+  // string state = 5;
   if (!this->_internal_state().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_state());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+  // int32 duration = 4;
+  if (this->_internal_duration() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_duration());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetEavesdropStateRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CallEventPayload_Eavesdrop::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetEavesdropStateRequest::MergeImpl
+    CallEventPayload_Eavesdrop::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetEavesdropStateRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CallEventPayload_Eavesdrop::GetClassData() const { return &_class_data_; }
 
 
-void SetEavesdropStateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetEavesdropStateRequest*>(&to_msg);
-  auto& from = static_cast<const SetEavesdropStateRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.SetEavesdropStateRequest)
+void CallEventPayload_Eavesdrop::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CallEventPayload_Eavesdrop*>(&to_msg);
+  auto& from = static_cast<const CallEventPayload_Eavesdrop&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.CallEventPayload.Eavesdrop)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_id().empty()) {
-    _this->_internal_set_id(from._internal_id());
+  if (!from._internal_type().empty()) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_number().empty()) {
+    _this->_internal_set_number(from._internal_number());
   }
   if (!from._internal_state().empty()) {
     _this->_internal_set_state(from._internal_state());
   }
+  if (from._internal_duration() != 0) {
+    _this->_internal_set_duration(from._internal_duration());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetEavesdropStateRequest::CopyFrom(const SetEavesdropStateRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.SetEavesdropStateRequest)
+void CallEventPayload_Eavesdrop::CopyFrom(const CallEventPayload_Eavesdrop& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.CallEventPayload.Eavesdrop)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetEavesdropStateRequest::IsInitialized() const {
+bool CallEventPayload_Eavesdrop::IsInitialized() const {
   return true;
 }
 
-void SetEavesdropStateRequest::InternalSwap(SetEavesdropStateRequest* other) {
+void CallEventPayload_Eavesdrop::InternalSwap(CallEventPayload_Eavesdrop* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.id_, lhs_arena,
-      &other->_impl_.id_, rhs_arena
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.number_, lhs_arena,
+      &other->_impl_.number_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.state_, lhs_arena,
       &other->_impl_.state_, rhs_arena
   );
+  swap(_impl_.duration_, other->_impl_.duration_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetEavesdropStateRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CallEventPayload_Eavesdrop::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[6]);
+      file_level_metadata_fs_2eproto[4]);
 }
 
 // ===================================================================
 
-class SetEavesdropStateResponse::_Internal {
+class CallEventPayload_Call::_Internal {
  public:
-  static const ::fs::ErrorExecute& error(const SetEavesdropStateResponse* msg);
 };
 
-const ::fs::ErrorExecute&
-SetEavesdropStateResponse::_Internal::error(const SetEavesdropStateResponse* msg) {
-  return *msg->_impl_.error_;
-}
-SetEavesdropStateResponse::SetEavesdropStateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+CallEventPayload_Call::CallEventPayload_Call(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.SetEavesdropStateResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.CallEventPayload.Call)
 }
-SetEavesdropStateResponse::SetEavesdropStateResponse(const SetEavesdropStateResponse& from)
+CallEventPayload_Call::CallEventPayload_Call(const CallEventPayload_Call& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetEavesdropStateResponse* const _this = this; (void)_this;
+  CallEventPayload_Call* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.error_){nullptr}
+      decltype(_impl_.id_){}
+    , decltype(_impl_.cc_app_id_){}
+    , decltype(_impl_.user_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_error()) {
-    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.SetEavesdropStateResponse)
+  _impl_.cc_app_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cc_app_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cc_app_id().empty()) {
+    _this->_impl_.cc_app_id_.Set(from._internal_cc_app_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.user_id_ = from._impl_.user_id_;
+  // @@protoc_insertion_point(copy_constructor:fs.CallEventPayload.Call)
 }
 
-inline void SetEavesdropStateResponse::SharedCtor(
+inline void CallEventPayload_Call::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.error_){nullptr}
+      decltype(_impl_.id_){}
+    , decltype(_impl_.cc_app_id_){}
+    , decltype(_impl_.user_id_){int64_t{0}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cc_app_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cc_app_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SetEavesdropStateResponse::~SetEavesdropStateResponse() {
-  // @@protoc_insertion_point(destructor:fs.SetEavesdropStateResponse)
+CallEventPayload_Call::~CallEventPayload_Call() {
+  // @@protoc_insertion_point(destructor:fs.CallEventPayload.Call)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2720,39 +3739,59 @@ SetEavesdropStateResponse::~SetEavesdropStateResponse() {
   SharedDtor();
 }
 
-inline void SetEavesdropStateResponse::SharedDtor() {
+inline void CallEventPayload_Call::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.error_;
+  _impl_.id_.Destroy();
+  _impl_.cc_app_id_.Destroy();
 }
 
-void SetEavesdropStateResponse::SetCachedSize(int size) const {
+void CallEventPayload_Call::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetEavesdropStateResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.SetEavesdropStateResponse)
+void CallEventPayload_Call::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.CallEventPayload.Call)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
-    delete _impl_.error_;
-  }
-  _impl_.error_ = nullptr;
+  _impl_.id_.ClearToEmpty();
+  _impl_.cc_app_id_.ClearToEmpty();
+  _impl_.user_id_ = int64_t{0};
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetEavesdropStateResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CallEventPayload_Call::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .fs.ErrorExecute error = 1;
+      // string id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Call.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 user_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.user_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string cc_app_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_cc_app_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.Call.cc_app_id"));
         } else
           goto handle_unusual;
         continue;
@@ -2779,85 +3818,159 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetEavesdropStateResponse::_InternalSerialize(
+uint8_t* CallEventPayload_Call::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.SetEavesdropStateResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.CallEventPayload.Call)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .fs.ErrorExecute error = 1;
-  if (this->_internal_has_error()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::error(this),
-        _Internal::error(this).GetCachedSize(), target, stream);
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.Call.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // int64 user_id = 2;
+  if (this->_internal_user_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_user_id(), target);
+  }
+
+  // string cc_app_id = 3;
+  if (!this->_internal_cc_app_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cc_app_id().data(), static_cast<int>(this->_internal_cc_app_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.Call.cc_app_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_cc_app_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.SetEavesdropStateResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.CallEventPayload.Call)
   return target;
 }
 
-size_t SetEavesdropStateResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.SetEavesdropStateResponse)
+size_t CallEventPayload_Call::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.CallEventPayload.Call)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .fs.ErrorExecute error = 1;
-  if (this->_internal_has_error()) {
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.error_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string cc_app_id = 3;
+  if (!this->_internal_cc_app_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cc_app_id());
+  }
+
+  // int64 user_id = 2;
+  if (this->_internal_user_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_user_id());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetEavesdropStateResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CallEventPayload_Call::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetEavesdropStateResponse::MergeImpl
+    CallEventPayload_Call::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetEavesdropStateResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CallEventPayload_Call::GetClassData() const { return &_class_data_; }
 
 
-void SetEavesdropStateResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetEavesdropStateResponse*>(&to_msg);
-  auto& from = static_cast<const SetEavesdropStateResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.SetEavesdropStateResponse)
+void CallEventPayload_Call::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CallEventPayload_Call*>(&to_msg);
+  auto& from = static_cast<const CallEventPayload_Call&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.CallEventPayload.Call)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_error()) {
-    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
-        from._internal_error());
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_cc_app_id().empty()) {
+    _this->_internal_set_cc_app_id(from._internal_cc_app_id());
+  }
+  if (from._internal_user_id() != 0) {
+    _this->_internal_set_user_id(from._internal_user_id());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetEavesdropStateResponse::CopyFrom(const SetEavesdropStateResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.SetEavesdropStateResponse)
+void CallEventPayload_Call::CopyFrom(const CallEventPayload_Call& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.CallEventPayload.Call)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetEavesdropStateResponse::IsInitialized() const {
+bool CallEventPayload_Call::IsInitialized() const {
   return true;
 }
 
-void SetEavesdropStateResponse::InternalSwap(SetEavesdropStateResponse* other) {
+void CallEventPayload_Call::InternalSwap(CallEventPayload_Call* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.error_, other->_impl_.error_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cc_app_id_, lhs_arena,
+      &other->_impl_.cc_app_id_, rhs_arena
+  );
+  swap(_impl_.user_id_, other->_impl_.user_id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetEavesdropStateResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata CallEventPayload_Call::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[5]);
+}
+
+// ===================================================================
+
+CallEventPayload_PayloadEntry_DoNotUse::CallEventPayload_PayloadEntry_DoNotUse() {}
+CallEventPayload_PayloadEntry_DoNotUse::CallEventPayload_PayloadEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void CallEventPayload_PayloadEntry_DoNotUse::MergeFrom(const CallEventPayload_PayloadEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata CallEventPayload_PayloadEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[6]);
+}
+
+// ===================================================================
+
+CallEventPayload_QueueEntry_DoNotUse::CallEventPayload_QueueEntry_DoNotUse() {}
+CallEventPayload_QueueEntry_DoNotUse::CallEventPayload_QueueEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void CallEventPayload_QueueEntry_DoNotUse::MergeFrom(const CallEventPayload_QueueEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata CallEventPayload_QueueEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
       file_level_metadata_fs_2eproto[7]);
@@ -2865,171 +3978,4671 @@ void SetEavesdropStateResponse::InternalSwap(SetEavesdropStateResponse* other) {
 
 // ===================================================================
 
-class BroadcastRequest::_Internal {
+class CallEventPayload::_Internal {
  public:
+  using HasBits = decltype(std::declval<CallEventPayload>()._impl_._has_bits_);
+  static const ::fs::CallEventPayload_Endpoint& from(const CallEventPayload* msg);
+  static const ::fs::CallEventPayload_Endpoint& to(const CallEventPayload* msg);
+  static const ::fs::CallEventPayload_Parameters& params(const CallEventPayload* msg);
+  static const ::fs::CallEventPayload_Eavesdrop& eavesdrop(const CallEventPayload* msg);
+  static void set_has_cdr(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-BroadcastRequest::BroadcastRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::fs::CallEventPayload_Endpoint&
+CallEventPayload::_Internal::from(const CallEventPayload* msg) {
+  return *msg->_impl_.from_;
+}
+const ::fs::CallEventPayload_Endpoint&
+CallEventPayload::_Internal::to(const CallEventPayload* msg) {
+  return *msg->_impl_.to_;
+}
+const ::fs::CallEventPayload_Parameters&
+CallEventPayload::_Internal::params(const CallEventPayload* msg) {
+  return *msg->_impl_.params_;
+}
+const ::fs::CallEventPayload_Eavesdrop&
+CallEventPayload::_Internal::eavesdrop(const CallEventPayload* msg) {
+  return *msg->_impl_.eavesdrop_;
+}
+CallEventPayload::CallEventPayload(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.BroadcastRequest)
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &CallEventPayload::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:fs.CallEventPayload)
 }
-BroadcastRequest::BroadcastRequest(const BroadcastRequest& from)
+CallEventPayload::CallEventPayload(const CallEventPayload& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  BroadcastRequest* const _this = this; (void)_this;
+  CallEventPayload* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){}
-    , decltype(_impl_.args_){}
-    , decltype(_impl_.leg_){}
-    , decltype(_impl_.wait_for_answer_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_.payload_)*/{}
+    , /*decltype(_impl_.queue_)*/{}
+    , decltype(_impl_.tags_){from._impl_.tags_}
+    , decltype(_impl_.schema_ids_){from._impl_.schema_ids_}
+    , /*decltype(_impl_._schema_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.amd_ai_logs_){from._impl_.amd_ai_logs_}
+    , decltype(_impl_.calls_){from._impl_.calls_}
+    , decltype(_impl_.direction_){}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.parent_id_){}
+    , decltype(_impl_.sip_id_){}
+    , decltype(_impl_.ivr_){}
+    , decltype(_impl_.bridged_id_){}
+    , decltype(_impl_.digit_){}
+    , decltype(_impl_.application_){}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.ai_result_){}
+    , decltype(_impl_.ai_error_){}
+    , decltype(_impl_.result_){}
+    , decltype(_impl_.cause_){}
+    , decltype(_impl_.amd_result_){}
+    , decltype(_impl_.amd_cause_){}
+    , decltype(_impl_.record_start_){}
+    , decltype(_impl_.record_stop_){}
+    , decltype(_impl_.transfer_to_){}
+    , decltype(_impl_.transfer_from_){}
+    , decltype(_impl_.transfer_to_agent_){}
+    , decltype(_impl_.transfer_from_attempt_){}
+    , decltype(_impl_.transfer_to_attempt_){}
+    , decltype(_impl_.talk_sec_){}
+    , decltype(_impl_.hangup_by_){}
+    , decltype(_impl_.reporting_at_){}
+    , decltype(_impl_.amd_ai_result_){}
+    , decltype(_impl_.hangup_phrase_){}
+    , decltype(_impl_.from_){nullptr}
+    , decltype(_impl_.to_){nullptr}
+    , decltype(_impl_.params_){nullptr}
+    , decltype(_impl_.eavesdrop_){nullptr}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.gateway_id_){}
+    , decltype(_impl_.contact_id_){}
+    , decltype(_impl_.hide_contact_){}
+    , decltype(_impl_.hidenumber_){}
+    , decltype(_impl_.originate_){}
+    , decltype(_impl_.cdr_){}
+    , decltype(_impl_.heartbeat_){}
+    , decltype(_impl_.grantee_id_){}
+    , decltype(_impl_.notification_hangup_){}
+    , decltype(_impl_.originate_success_){}
+    , decltype(_impl_.amd_ai_positive_){}
+    , decltype(_impl_.ai_local_){}
+    , decltype(_impl_.sip_){}
+    , decltype(_impl_.ai_partial_){}
+    , decltype(_impl_.ai_confidence_){}
+    , decltype(_impl_.ai_elapsed_ms_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.id_.InitDefault();
+  _this->_impl_.payload_.MergeFrom(from._impl_.payload_);
+  _this->_impl_.queue_.MergeFrom(from._impl_.queue_);
+  _impl_.direction_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
+    _impl_.direction_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_id().empty()) {
-    _this->_impl_.id_.Set(from._internal_id(), 
+  if (!from._internal_direction().empty()) {
+    _this->_impl_.direction_.Set(from._internal_direction(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.args_.InitDefault();
+  _impl_.destination_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.args_.Set("", GetArenaForAllocation());
+    _impl_.destination_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_args().empty()) {
-    _this->_impl_.args_.Set(from._internal_args(), 
+  if (!from._internal_destination().empty()) {
+    _this->_impl_.destination_.Set(from._internal_destination(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.leg_.InitDefault();
+  _impl_.parent_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.leg_.Set("", GetArenaForAllocation());
+    _impl_.parent_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_leg().empty()) {
-    _this->_impl_.leg_.Set(from._internal_leg(), 
+  if (!from._internal_parent_id().empty()) {
+    _this->_impl_.parent_id_.Set(from._internal_parent_id(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.wait_for_answer_ = from._impl_.wait_for_answer_;
-  // @@protoc_insertion_point(copy_constructor:fs.BroadcastRequest)
-}
-
-inline void BroadcastRequest::SharedCtor(
-    ::_pb::Arena* arena, bool is_message_owned) {
-  (void)arena;
-  (void)is_message_owned;
-  new (&_impl_) Impl_{
-      decltype(_impl_.id_){}
-    , decltype(_impl_.args_){}
-    , decltype(_impl_.leg_){}
-    , decltype(_impl_.wait_for_answer_){false}
-    , /*decltype(_impl_._cached_size_)*/{}
-  };
-  _impl_.id_.InitDefault();
+  _impl_.sip_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
+    _impl_.sip_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.args_.InitDefault();
+  if (!from._internal_sip_id().empty()) {
+    _this->_impl_.sip_id_.Set(from._internal_sip_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ivr_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.args_.Set("", GetArenaForAllocation());
+    _impl_.ivr_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.leg_.InitDefault();
+  if (!from._internal_ivr().empty()) {
+    _this->_impl_.ivr_.Set(from._internal_ivr(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.bridged_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.leg_.Set("", GetArenaForAllocation());
+    _impl_.bridged_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-}
-
-BroadcastRequest::~BroadcastRequest() {
-  // @@protoc_insertion_point(destructor:fs.BroadcastRequest)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
+  if (!from._internal_bridged_id().empty()) {
+    _this->_impl_.bridged_id_.Set(from._internal_bridged_id(), 
+      _this->GetArenaForAllocation());
   }
-  SharedDtor();
-}
+  _impl_.digit_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digit_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_digit().empty()) {
+    _this->_impl_.digit_.Set(from._internal_digit(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.application_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.application_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_application().empty()) {
+    _this->_impl_.application_.Set(from._internal_application(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_state().empty()) {
+    _this->_impl_.state_.Set(from._internal_state(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_type().empty()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ai_result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ai_result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ai_result().empty()) {
+    _this->_impl_.ai_result_.Set(from._internal_ai_result(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ai_error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ai_error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ai_error().empty()) {
+    _this->_impl_.ai_error_.Set(from._internal_ai_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_result().empty()) {
+    _this->_impl_.result_.Set(from._internal_result(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.cause_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cause_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cause().empty()) {
+    _this->_impl_.cause_.Set(from._internal_cause(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.amd_result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.amd_result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_amd_result().empty()) {
+    _this->_impl_.amd_result_.Set(from._internal_amd_result(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.amd_cause_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.amd_cause_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_amd_cause().empty()) {
+    _this->_impl_.amd_cause_.Set(from._internal_amd_cause(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.record_start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.record_start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_record_start().empty()) {
+    _this->_impl_.record_start_.Set(from._internal_record_start(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.record_stop_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.record_stop_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_record_stop().empty()) {
+    _this->_impl_.record_stop_.Set(from._internal_record_stop(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.transfer_to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transfer_to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_transfer_to().empty()) {
+    _this->_impl_.transfer_to_.Set(from._internal_transfer_to(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.transfer_from_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transfer_from_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_transfer_from().empty()) {
+    _this->_impl_.transfer_from_.Set(from._internal_transfer_from(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.transfer_to_agent_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transfer_to_agent_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_transfer_to_agent().empty()) {
+    _this->_impl_.transfer_to_agent_.Set(from._internal_transfer_to_agent(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.transfer_from_attempt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transfer_from_attempt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_transfer_from_attempt().empty()) {
+    _this->_impl_.transfer_from_attempt_.Set(from._internal_transfer_from_attempt(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.transfer_to_attempt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transfer_to_attempt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_transfer_to_attempt().empty()) {
+    _this->_impl_.transfer_to_attempt_.Set(from._internal_transfer_to_attempt(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.talk_sec_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.talk_sec_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_talk_sec().empty()) {
+    _this->_impl_.talk_sec_.Set(from._internal_talk_sec(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.hangup_by_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hangup_by_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hangup_by().empty()) {
+    _this->_impl_.hangup_by_.Set(from._internal_hangup_by(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.reporting_at_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reporting_at_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_reporting_at().empty()) {
+    _this->_impl_.reporting_at_.Set(from._internal_reporting_at(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.amd_ai_result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.amd_ai_result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_amd_ai_result().empty()) {
+    _this->_impl_.amd_ai_result_.Set(from._internal_amd_ai_result(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.hangup_phrase_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hangup_phrase_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_hangup_phrase().empty()) {
+    _this->_impl_.hangup_phrase_.Set(from._internal_hangup_phrase(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_from()) {
+    _this->_impl_.from_ = new ::fs::CallEventPayload_Endpoint(*from._impl_.from_);
+  }
+  if (from._internal_has_to()) {
+    _this->_impl_.to_ = new ::fs::CallEventPayload_Endpoint(*from._impl_.to_);
+  }
+  if (from._internal_has_params()) {
+    _this->_impl_.params_ = new ::fs::CallEventPayload_Parameters(*from._impl_.params_);
+  }
+  if (from._internal_has_eavesdrop()) {
+    _this->_impl_.eavesdrop_ = new ::fs::CallEventPayload_Eavesdrop(*from._impl_.eavesdrop_);
+  }
+  ::memcpy(&_impl_.user_id_, &from._impl_.user_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ai_elapsed_ms_) -
+    reinterpret_cast<char*>(&_impl_.user_id_)) + sizeof(_impl_.ai_elapsed_ms_));
+  // @@protoc_insertion_point(copy_constructor:fs.CallEventPayload)
+}
 
-inline void BroadcastRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.id_.Destroy();
-  _impl_.args_.Destroy();
-  _impl_.leg_.Destroy();
+inline void CallEventPayload::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_.payload_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_.queue_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.tags_){arena}
+    , decltype(_impl_.schema_ids_){arena}
+    , /*decltype(_impl_._schema_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.amd_ai_logs_){arena}
+    , decltype(_impl_.calls_){arena}
+    , decltype(_impl_.direction_){}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.parent_id_){}
+    , decltype(_impl_.sip_id_){}
+    , decltype(_impl_.ivr_){}
+    , decltype(_impl_.bridged_id_){}
+    , decltype(_impl_.digit_){}
+    , decltype(_impl_.application_){}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.ai_result_){}
+    , decltype(_impl_.ai_error_){}
+    , decltype(_impl_.result_){}
+    , decltype(_impl_.cause_){}
+    , decltype(_impl_.amd_result_){}
+    , decltype(_impl_.amd_cause_){}
+    , decltype(_impl_.record_start_){}
+    , decltype(_impl_.record_stop_){}
+    , decltype(_impl_.transfer_to_){}
+    , decltype(_impl_.transfer_from_){}
+    , decltype(_impl_.transfer_to_agent_){}
+    , decltype(_impl_.transfer_from_attempt_){}
+    , decltype(_impl_.transfer_to_attempt_){}
+    , decltype(_impl_.talk_sec_){}
+    , decltype(_impl_.hangup_by_){}
+    , decltype(_impl_.reporting_at_){}
+    , decltype(_impl_.amd_ai_result_){}
+    , decltype(_impl_.hangup_phrase_){}
+    , decltype(_impl_.from_){nullptr}
+    , decltype(_impl_.to_){nullptr}
+    , decltype(_impl_.params_){nullptr}
+    , decltype(_impl_.eavesdrop_){nullptr}
+    , decltype(_impl_.user_id_){int64_t{0}}
+    , decltype(_impl_.gateway_id_){int64_t{0}}
+    , decltype(_impl_.contact_id_){int64_t{0}}
+    , decltype(_impl_.hide_contact_){false}
+    , decltype(_impl_.hidenumber_){false}
+    , decltype(_impl_.originate_){false}
+    , decltype(_impl_.cdr_){false}
+    , decltype(_impl_.heartbeat_){0}
+    , decltype(_impl_.grantee_id_){int64_t{0}}
+    , decltype(_impl_.notification_hangup_){false}
+    , decltype(_impl_.originate_success_){false}
+    , decltype(_impl_.amd_ai_positive_){false}
+    , decltype(_impl_.ai_local_){false}
+    , decltype(_impl_.sip_){0}
+    , decltype(_impl_.ai_partial_){false}
+    , decltype(_impl_.ai_confidence_){0}
+    , decltype(_impl_.ai_elapsed_ms_){int64_t{0}}
+  };
+  _impl_.direction_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.direction_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.parent_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.parent_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sip_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sip_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ivr_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ivr_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.bridged_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bridged_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.digit_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.digit_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.application_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.application_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ai_result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ai_result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ai_error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ai_error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.cause_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cause_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.amd_result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.amd_result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.amd_cause_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.amd_cause_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.record_start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.record_start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.record_stop_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.record_stop_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.transfer_to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transfer_to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.transfer_from_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transfer_from_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.transfer_to_agent_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transfer_to_agent_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.transfer_from_attempt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transfer_from_attempt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.transfer_to_attempt_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.transfer_to_attempt_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.talk_sec_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.talk_sec_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.hangup_by_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hangup_by_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.reporting_at_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reporting_at_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.amd_ai_result_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.amd_ai_result_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.hangup_phrase_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hangup_phrase_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-void BroadcastRequest::SetCachedSize(int size) const {
+CallEventPayload::~CallEventPayload() {
+  // @@protoc_insertion_point(destructor:fs.CallEventPayload)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CallEventPayload::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.payload_.Destruct();
+  _impl_.payload_.~MapField();
+  _impl_.queue_.Destruct();
+  _impl_.queue_.~MapField();
+  _impl_.tags_.~RepeatedPtrField();
+  _impl_.schema_ids_.~RepeatedField();
+  _impl_.amd_ai_logs_.~RepeatedPtrField();
+  _impl_.calls_.~RepeatedPtrField();
+  _impl_.direction_.Destroy();
+  _impl_.destination_.Destroy();
+  _impl_.parent_id_.Destroy();
+  _impl_.sip_id_.Destroy();
+  _impl_.ivr_.Destroy();
+  _impl_.bridged_id_.Destroy();
+  _impl_.digit_.Destroy();
+  _impl_.application_.Destroy();
+  _impl_.state_.Destroy();
+  _impl_.type_.Destroy();
+  _impl_.ai_result_.Destroy();
+  _impl_.ai_error_.Destroy();
+  _impl_.result_.Destroy();
+  _impl_.cause_.Destroy();
+  _impl_.amd_result_.Destroy();
+  _impl_.amd_cause_.Destroy();
+  _impl_.record_start_.Destroy();
+  _impl_.record_stop_.Destroy();
+  _impl_.transfer_to_.Destroy();
+  _impl_.transfer_from_.Destroy();
+  _impl_.transfer_to_agent_.Destroy();
+  _impl_.transfer_from_attempt_.Destroy();
+  _impl_.transfer_to_attempt_.Destroy();
+  _impl_.talk_sec_.Destroy();
+  _impl_.hangup_by_.Destroy();
+  _impl_.reporting_at_.Destroy();
+  _impl_.amd_ai_result_.Destroy();
+  _impl_.hangup_phrase_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.from_;
+  if (this != internal_default_instance()) delete _impl_.to_;
+  if (this != internal_default_instance()) delete _impl_.params_;
+  if (this != internal_default_instance()) delete _impl_.eavesdrop_;
+}
+
+void CallEventPayload::ArenaDtor(void* object) {
+  CallEventPayload* _this = reinterpret_cast< CallEventPayload* >(object);
+  _this->_impl_.payload_.Destruct();
+  _this->_impl_.queue_.Destruct();
+}
+void CallEventPayload::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void BroadcastRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.BroadcastRequest)
+void CallEventPayload::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.CallEventPayload)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.id_.ClearToEmpty();
-  _impl_.args_.ClearToEmpty();
-  _impl_.leg_.ClearToEmpty();
-  _impl_.wait_for_answer_ = false;
+  _impl_.payload_.Clear();
+  _impl_.queue_.Clear();
+  _impl_.tags_.Clear();
+  _impl_.schema_ids_.Clear();
+  _impl_.amd_ai_logs_.Clear();
+  _impl_.calls_.Clear();
+  _impl_.direction_.ClearToEmpty();
+  _impl_.destination_.ClearToEmpty();
+  _impl_.parent_id_.ClearToEmpty();
+  _impl_.sip_id_.ClearToEmpty();
+  _impl_.ivr_.ClearToEmpty();
+  _impl_.bridged_id_.ClearToEmpty();
+  _impl_.digit_.ClearToEmpty();
+  _impl_.application_.ClearToEmpty();
+  _impl_.state_.ClearToEmpty();
+  _impl_.type_.ClearToEmpty();
+  _impl_.ai_result_.ClearToEmpty();
+  _impl_.ai_error_.ClearToEmpty();
+  _impl_.result_.ClearToEmpty();
+  _impl_.cause_.ClearToEmpty();
+  _impl_.amd_result_.ClearToEmpty();
+  _impl_.amd_cause_.ClearToEmpty();
+  _impl_.record_start_.ClearToEmpty();
+  _impl_.record_stop_.ClearToEmpty();
+  _impl_.transfer_to_.ClearToEmpty();
+  _impl_.transfer_from_.ClearToEmpty();
+  _impl_.transfer_to_agent_.ClearToEmpty();
+  _impl_.transfer_from_attempt_.ClearToEmpty();
+  _impl_.transfer_to_attempt_.ClearToEmpty();
+  _impl_.talk_sec_.ClearToEmpty();
+  _impl_.hangup_by_.ClearToEmpty();
+  _impl_.reporting_at_.ClearToEmpty();
+  _impl_.amd_ai_result_.ClearToEmpty();
+  _impl_.hangup_phrase_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.from_ != nullptr) {
+    delete _impl_.from_;
+  }
+  _impl_.from_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.to_ != nullptr) {
+    delete _impl_.to_;
+  }
+  _impl_.to_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.params_ != nullptr) {
+    delete _impl_.params_;
+  }
+  _impl_.params_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.eavesdrop_ != nullptr) {
+    delete _impl_.eavesdrop_;
+  }
+  _impl_.eavesdrop_ = nullptr;
+  ::memset(&_impl_.user_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.originate_) -
+      reinterpret_cast<char*>(&_impl_.user_id_)) + sizeof(_impl_.originate_));
+  _impl_.cdr_ = false;
+  ::memset(&_impl_.heartbeat_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ai_elapsed_ms_) -
+      reinterpret_cast<char*>(&_impl_.heartbeat_)) + sizeof(_impl_.ai_elapsed_ms_));
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BroadcastRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* CallEventPayload::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string id = 1;
+      // int64 user_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.user_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BroadcastRequest.id"));
         } else
           goto handle_unusual;
         continue;
-      // string args = 2;
+      // int64 gateway_id = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_args();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.gateway_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BroadcastRequest.args"));
         } else
           goto handle_unusual;
         continue;
-      // bool wait_for_answer = 3;
+      // int64 contact_id = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.wait_for_answer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.contact_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // string leg = 4;
+      // bool hide_contact = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_leg();
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.hide_contact_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool hideNumber = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.hidenumber_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> payload = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.payload_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string direction = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_direction();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BroadcastRequest.leg"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.direction"));
         } else
           goto handle_unusual;
         continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
+      // string destination = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_destination();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.destination"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string parent_id = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_parent_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.parent_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .fs.CallEventPayload.Endpoint from = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_from(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .fs.CallEventPayload.Endpoint to = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_to(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool originate = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.originate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 heartbeat = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.heartbeat_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string sip_id = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_sip_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.sip_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 grantee_id = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.grantee_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string ivr = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          auto str = _internal_mutable_ivr();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.ivr"));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> queue = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(&_impl_.queue_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<138>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .fs.CallEventPayload.Parameters params = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .fs.CallEventPayload.Eavesdrop eavesdrop = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr = ctx->ParseMessage(_internal_mutable_eavesdrop(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string bridged_id = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 162)) {
+          auto str = _internal_mutable_bridged_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.bridged_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string digit = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 170)) {
+          auto str = _internal_mutable_digit();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.digit"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string application = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          auto str = _internal_mutable_application();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.application"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string state = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 186)) {
+          auto str = _internal_mutable_state();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.state"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string type = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 194)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.type"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string ai_result = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 202)) {
+          auto str = _internal_mutable_ai_result();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.ai_result"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string ai_error = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 210)) {
+          auto str = _internal_mutable_ai_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.ai_error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string result = 27;
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 218)) {
+          auto str = _internal_mutable_result();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.result"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string cause = 28;
+      case 28:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 226)) {
+          auto str = _internal_mutable_cause();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.cause"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool cdr = 29;
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 232)) {
+          _Internal::set_has_cdr(&has_bits);
+          _impl_.cdr_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool notification_hangup = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 240)) {
+          _impl_.notification_hangup_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string amd_result = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 250)) {
+          auto str = _internal_mutable_amd_result();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.amd_result"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string amd_cause = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 2)) {
+          auto str = _internal_mutable_amd_cause();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.amd_cause"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string record_start = 33;
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_record_start();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.record_start"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string record_stop = 34;
+      case 34:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_record_stop();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.record_stop"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string transfer_to = 35;
+      case 35:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_transfer_to();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.transfer_to"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string transfer_from = 36;
+      case 36:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_transfer_from();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.transfer_from"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string transfer_to_agent = 37;
+      case 37:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_transfer_to_agent();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.transfer_to_agent"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string transfer_from_attempt = 38;
+      case 38:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_transfer_from_attempt();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.transfer_from_attempt"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string transfer_to_attempt = 39;
+      case 39:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_transfer_to_attempt();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.transfer_to_attempt"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string talk_sec = 40;
+      case 40:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_talk_sec();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.talk_sec"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string hangup_by = 41;
+      case 41:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_hangup_by();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.hangup_by"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string reporting_at = 42;
+      case 42:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_reporting_at();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.reporting_at"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool originate_success = 43;
+      case 43:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.originate_success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 sip = 44;
+      case 44:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.sip_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string tags = 45;
+      case 45:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_tags();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.tags"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<362>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 schema_ids = 46;
+      case 46:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_schema_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 112) {
+          _internal_add_schema_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string amd_ai_result = 47;
+      case 47:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          auto str = _internal_mutable_amd_ai_result();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.amd_ai_result"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool amd_ai_positive = 48;
+      case 48:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _impl_.amd_ai_positive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string amd_ai_logs = 49;
+      case 49:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            auto str = _internal_add_amd_ai_logs();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.amd_ai_logs"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<394>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string hangup_phrase = 50;
+      case 50:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          auto str = _internal_mutable_hangup_phrase();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.CallEventPayload.hangup_phrase"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .fs.CallEventPayload.Call calls = 51;
+      case 51:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 154)) {
+          ptr -= 2;
+          do {
+            ptr += 2;
+            ptr = ctx->ParseMessage(_internal_add_calls(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<410>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool ai_local = 52;
+      case 52:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _impl_.ai_local_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool ai_partial = 53;
+      case 53:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _impl_.ai_partial_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // float ai_confidence = 54;
+      case 54:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 181)) {
+          _impl_.ai_confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 ai_elapsed_ms = 55;
+      case 55:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
+          _impl_.ai_elapsed_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CallEventPayload::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.CallEventPayload)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 user_id = 1;
+  if (this->_internal_user_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_user_id(), target);
+  }
+
+  // int64 gateway_id = 2;
+  if (this->_internal_gateway_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_gateway_id(), target);
+  }
+
+  // int64 contact_id = 3;
+  if (this->_internal_contact_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_contact_id(), target);
+  }
+
+  // bool hide_contact = 4;
+  if (this->_internal_hide_contact() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_hide_contact(), target);
+  }
+
+  // bool hideNumber = 5;
+  if (this->_internal_hidenumber() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_hidenumber(), target);
+  }
+
+  // map<string, string> payload = 6;
+  if (!this->_internal_payload().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = CallEventPayload_PayloadEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_payload();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.CallEventPayload.PayloadEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.CallEventPayload.PayloadEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(6, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(6, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // string direction = 7;
+  if (!this->_internal_direction().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_direction().data(), static_cast<int>(this->_internal_direction().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.direction");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_direction(), target);
+  }
+
+  // string destination = 8;
+  if (!this->_internal_destination().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_destination().data(), static_cast<int>(this->_internal_destination().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.destination");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_destination(), target);
+  }
+
+  // string parent_id = 9;
+  if (!this->_internal_parent_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_parent_id().data(), static_cast<int>(this->_internal_parent_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.parent_id");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_parent_id(), target);
+  }
+
+  // .fs.CallEventPayload.Endpoint from = 10;
+  if (this->_internal_has_from()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::from(this),
+        _Internal::from(this).GetCachedSize(), target, stream);
+  }
+
+  // .fs.CallEventPayload.Endpoint to = 11;
+  if (this->_internal_has_to()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::to(this),
+        _Internal::to(this).GetCachedSize(), target, stream);
+  }
+
+  // bool originate = 12;
+  if (this->_internal_originate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(12, this->_internal_originate(), target);
+  }
+
+  // int32 heartbeat = 13;
+  if (this->_internal_heartbeat() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(13, this->_internal_heartbeat(), target);
+  }
+
+  // string sip_id = 14;
+  if (!this->_internal_sip_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_sip_id().data(), static_cast<int>(this->_internal_sip_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.sip_id");
+    target = stream->WriteStringMaybeAliased(
+        14, this->_internal_sip_id(), target);
+  }
+
+  // int64 grantee_id = 15;
+  if (this->_internal_grantee_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(15, this->_internal_grantee_id(), target);
+  }
+
+  // string ivr = 16;
+  if (!this->_internal_ivr().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ivr().data(), static_cast<int>(this->_internal_ivr().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.ivr");
+    target = stream->WriteStringMaybeAliased(
+        16, this->_internal_ivr(), target);
+  }
+
+  // map<string, string> queue = 17;
+  if (!this->_internal_queue().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = CallEventPayload_QueueEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_queue();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.CallEventPayload.QueueEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.CallEventPayload.QueueEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(17, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(17, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // .fs.CallEventPayload.Parameters params = 18;
+  if (this->_internal_has_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, _Internal::params(this),
+        _Internal::params(this).GetCachedSize(), target, stream);
+  }
+
+  // .fs.CallEventPayload.Eavesdrop eavesdrop = 19;
+  if (this->_internal_has_eavesdrop()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(19, _Internal::eavesdrop(this),
+        _Internal::eavesdrop(this).GetCachedSize(), target, stream);
+  }
+
+  // string bridged_id = 20;
+  if (!this->_internal_bridged_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_bridged_id().data(), static_cast<int>(this->_internal_bridged_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.bridged_id");
+    target = stream->WriteStringMaybeAliased(
+        20, this->_internal_bridged_id(), target);
+  }
+
+  // string digit = 21;
+  if (!this->_internal_digit().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_digit().data(), static_cast<int>(this->_internal_digit().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.digit");
+    target = stream->WriteStringMaybeAliased(
+        21, this->_internal_digit(), target);
+  }
+
+  // string application = 22;
+  if (!this->_internal_application().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_application().data(), static_cast<int>(this->_internal_application().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.application");
+    target = stream->WriteStringMaybeAliased(
+        22, this->_internal_application(), target);
+  }
+
+  // string state = 23;
+  if (!this->_internal_state().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_state().data(), static_cast<int>(this->_internal_state().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.state");
+    target = stream->WriteStringMaybeAliased(
+        23, this->_internal_state(), target);
+  }
+
+  // string type = 24;
+  if (!this->_internal_type().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_type().data(), static_cast<int>(this->_internal_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.type");
+    target = stream->WriteStringMaybeAliased(
+        24, this->_internal_type(), target);
+  }
+
+  // string ai_result = 25;
+  if (!this->_internal_ai_result().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ai_result().data(), static_cast<int>(this->_internal_ai_result().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.ai_result");
+    target = stream->WriteStringMaybeAliased(
+        25, this->_internal_ai_result(), target);
+  }
+
+  // string ai_error = 26;
+  if (!this->_internal_ai_error().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ai_error().data(), static_cast<int>(this->_internal_ai_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.ai_error");
+    target = stream->WriteStringMaybeAliased(
+        26, this->_internal_ai_error(), target);
+  }
+
+  // string result = 27;
+  if (!this->_internal_result().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_result().data(), static_cast<int>(this->_internal_result().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.result");
+    target = stream->WriteStringMaybeAliased(
+        27, this->_internal_result(), target);
+  }
+
+  // string cause = 28;
+  if (!this->_internal_cause().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cause().data(), static_cast<int>(this->_internal_cause().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.cause");
+    target = stream->WriteStringMaybeAliased(
+        28, this->_internal_cause(), target);
+  }
+
+  // optional bool cdr = 29;
+  if (_internal_has_cdr()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(29, this->_internal_cdr(), target);
+  }
+
+  // bool notification_hangup = 30;
+  if (this->_internal_notification_hangup() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(30, this->_internal_notification_hangup(), target);
+  }
+
+  // string amd_result = 31;
+  if (!this->_internal_amd_result().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_amd_result().data(), static_cast<int>(this->_internal_amd_result().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.amd_result");
+    target = stream->WriteStringMaybeAliased(
+        31, this->_internal_amd_result(), target);
+  }
+
+  // string amd_cause = 32;
+  if (!this->_internal_amd_cause().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_amd_cause().data(), static_cast<int>(this->_internal_amd_cause().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.amd_cause");
+    target = stream->WriteStringMaybeAliased(
+        32, this->_internal_amd_cause(), target);
+  }
+
+  // string record_start = 33;
+  if (!this->_internal_record_start().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_record_start().data(), static_cast<int>(this->_internal_record_start().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.record_start");
+    target = stream->WriteStringMaybeAliased(
+        33, this->_internal_record_start(), target);
+  }
+
+  // string record_stop = 34;
+  if (!this->_internal_record_stop().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_record_stop().data(), static_cast<int>(this->_internal_record_stop().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.record_stop");
+    target = stream->WriteStringMaybeAliased(
+        34, this->_internal_record_stop(), target);
+  }
+
+  // string transfer_to = 35;
+  if (!this->_internal_transfer_to().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_transfer_to().data(), static_cast<int>(this->_internal_transfer_to().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.transfer_to");
+    target = stream->WriteStringMaybeAliased(
+        35, this->_internal_transfer_to(), target);
+  }
+
+  // string transfer_from = 36;
+  if (!this->_internal_transfer_from().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_transfer_from().data(), static_cast<int>(this->_internal_transfer_from().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.transfer_from");
+    target = stream->WriteStringMaybeAliased(
+        36, this->_internal_transfer_from(), target);
+  }
+
+  // string transfer_to_agent = 37;
+  if (!this->_internal_transfer_to_agent().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_transfer_to_agent().data(), static_cast<int>(this->_internal_transfer_to_agent().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.transfer_to_agent");
+    target = stream->WriteStringMaybeAliased(
+        37, this->_internal_transfer_to_agent(), target);
+  }
+
+  // string transfer_from_attempt = 38;
+  if (!this->_internal_transfer_from_attempt().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_transfer_from_attempt().data(), static_cast<int>(this->_internal_transfer_from_attempt().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.transfer_from_attempt");
+    target = stream->WriteStringMaybeAliased(
+        38, this->_internal_transfer_from_attempt(), target);
+  }
+
+  // string transfer_to_attempt = 39;
+  if (!this->_internal_transfer_to_attempt().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_transfer_to_attempt().data(), static_cast<int>(this->_internal_transfer_to_attempt().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.transfer_to_attempt");
+    target = stream->WriteStringMaybeAliased(
+        39, this->_internal_transfer_to_attempt(), target);
+  }
+
+  // string talk_sec = 40;
+  if (!this->_internal_talk_sec().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_talk_sec().data(), static_cast<int>(this->_internal_talk_sec().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.talk_sec");
+    target = stream->WriteStringMaybeAliased(
+        40, this->_internal_talk_sec(), target);
+  }
+
+  // string hangup_by = 41;
+  if (!this->_internal_hangup_by().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_hangup_by().data(), static_cast<int>(this->_internal_hangup_by().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.hangup_by");
+    target = stream->WriteStringMaybeAliased(
+        41, this->_internal_hangup_by(), target);
+  }
+
+  // string reporting_at = 42;
+  if (!this->_internal_reporting_at().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_reporting_at().data(), static_cast<int>(this->_internal_reporting_at().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.reporting_at");
+    target = stream->WriteStringMaybeAliased(
+        42, this->_internal_reporting_at(), target);
+  }
+
+  // bool originate_success = 43;
+  if (this->_internal_originate_success() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(43, this->_internal_originate_success(), target);
+  }
+
+  // int32 sip = 44;
+  if (this->_internal_sip() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(44, this->_internal_sip(), target);
+  }
+
+  // repeated string tags = 45;
+  for (int i = 0, n = this->_internal_tags_size(); i < n; i++) {
+    const auto& s = this->_internal_tags(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.tags");
+    target = stream->WriteString(45, s, target);
+  }
+
+  // repeated int64 schema_ids = 46;
+  {
+    int byte_size = _impl_._schema_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          46, _internal_schema_ids(), byte_size, target);
+    }
+  }
+
+  // string amd_ai_result = 47;
+  if (!this->_internal_amd_ai_result().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_amd_ai_result().data(), static_cast<int>(this->_internal_amd_ai_result().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.amd_ai_result");
+    target = stream->WriteStringMaybeAliased(
+        47, this->_internal_amd_ai_result(), target);
+  }
+
+  // bool amd_ai_positive = 48;
+  if (this->_internal_amd_ai_positive() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(48, this->_internal_amd_ai_positive(), target);
+  }
+
+  // repeated string amd_ai_logs = 49;
+  for (int i = 0, n = this->_internal_amd_ai_logs_size(); i < n; i++) {
+    const auto& s = this->_internal_amd_ai_logs(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.amd_ai_logs");
+    target = stream->WriteString(49, s, target);
+  }
+
+  // string hangup_phrase = 50;
+  if (!this->_internal_hangup_phrase().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_hangup_phrase().data(), static_cast<int>(this->_internal_hangup_phrase().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.CallEventPayload.hangup_phrase");
+    target = stream->WriteStringMaybeAliased(
+        50, this->_internal_hangup_phrase(), target);
+  }
+
+  // repeated .fs.CallEventPayload.Call calls = 51;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_calls_size()); i < n; i++) {
+    const auto& repfield = this->_internal_calls(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(51, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // bool ai_local = 52;
+  if (this->_internal_ai_local() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(52, this->_internal_ai_local(), target);
+  }
+
+  // bool ai_partial = 53;
+  if (this->_internal_ai_partial() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(53, this->_internal_ai_partial(), target);
+  }
+
+  // float ai_confidence = 54;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ai_confidence = this->_internal_ai_confidence();
+  uint32_t raw_ai_confidence;
+  memcpy(&raw_ai_confidence, &tmp_ai_confidence, sizeof(tmp_ai_confidence));
+  if (raw_ai_confidence != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(54, this->_internal_ai_confidence(), target);
+  }
+
+  // int64 ai_elapsed_ms = 55;
+  if (this->_internal_ai_elapsed_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(55, this->_internal_ai_elapsed_ms(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.CallEventPayload)
+  return target;
+}
+
+size_t CallEventPayload::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.CallEventPayload)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> payload = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_payload_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_payload().begin();
+      it != this->_internal_payload().end(); ++it) {
+    total_size += CallEventPayload_PayloadEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // map<string, string> queue = 17;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_queue_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_queue().begin();
+      it != this->_internal_queue().end(); ++it) {
+    total_size += CallEventPayload_QueueEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // repeated string tags = 45;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.tags_.size());
+  for (int i = 0, n = _impl_.tags_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.tags_.Get(i));
+  }
+
+  // repeated int64 schema_ids = 46;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.schema_ids_);
+    if (data_size > 0) {
+      total_size += 2 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._schema_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated string amd_ai_logs = 49;
+  total_size += 2 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.amd_ai_logs_.size());
+  for (int i = 0, n = _impl_.amd_ai_logs_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.amd_ai_logs_.Get(i));
+  }
+
+  // repeated .fs.CallEventPayload.Call calls = 51;
+  total_size += 2UL * this->_internal_calls_size();
+  for (const auto& msg : this->_impl_.calls_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string direction = 7;
+  if (!this->_internal_direction().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_direction());
+  }
+
+  // string destination = 8;
+  if (!this->_internal_destination().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_destination());
+  }
+
+  // string parent_id = 9;
+  if (!this->_internal_parent_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_parent_id());
+  }
+
+  // string sip_id = 14;
+  if (!this->_internal_sip_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sip_id());
+  }
+
+  // string ivr = 16;
+  if (!this->_internal_ivr().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ivr());
+  }
+
+  // string bridged_id = 20;
+  if (!this->_internal_bridged_id().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_bridged_id());
+  }
+
+  // string digit = 21;
+  if (!this->_internal_digit().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_digit());
+  }
+
+  // string application = 22;
+  if (!this->_internal_application().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_application());
+  }
+
+  // string state = 23;
+  if (!this->_internal_state().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_state());
+  }
+
+  // string type = 24;
+  if (!this->_internal_type().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
+  }
+
+  // string ai_result = 25;
+  if (!this->_internal_ai_result().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ai_result());
+  }
+
+  // string ai_error = 26;
+  if (!this->_internal_ai_error().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ai_error());
+  }
+
+  // string result = 27;
+  if (!this->_internal_result().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_result());
+  }
+
+  // string cause = 28;
+  if (!this->_internal_cause().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cause());
+  }
+
+  // string amd_result = 31;
+  if (!this->_internal_amd_result().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_amd_result());
+  }
+
+  // string amd_cause = 32;
+  if (!this->_internal_amd_cause().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_amd_cause());
+  }
+
+  // string record_start = 33;
+  if (!this->_internal_record_start().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_record_start());
+  }
+
+  // string record_stop = 34;
+  if (!this->_internal_record_stop().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_record_stop());
+  }
+
+  // string transfer_to = 35;
+  if (!this->_internal_transfer_to().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_transfer_to());
+  }
+
+  // string transfer_from = 36;
+  if (!this->_internal_transfer_from().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_transfer_from());
+  }
+
+  // string transfer_to_agent = 37;
+  if (!this->_internal_transfer_to_agent().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_transfer_to_agent());
+  }
+
+  // string transfer_from_attempt = 38;
+  if (!this->_internal_transfer_from_attempt().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_transfer_from_attempt());
+  }
+
+  // string transfer_to_attempt = 39;
+  if (!this->_internal_transfer_to_attempt().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_transfer_to_attempt());
+  }
+
+  // string talk_sec = 40;
+  if (!this->_internal_talk_sec().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_talk_sec());
+  }
+
+  // string hangup_by = 41;
+  if (!this->_internal_hangup_by().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_hangup_by());
+  }
+
+  // string reporting_at = 42;
+  if (!this->_internal_reporting_at().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_reporting_at());
+  }
+
+  // string amd_ai_result = 47;
+  if (!this->_internal_amd_ai_result().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_amd_ai_result());
+  }
+
+  // string hangup_phrase = 50;
+  if (!this->_internal_hangup_phrase().empty()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_hangup_phrase());
+  }
+
+  // .fs.CallEventPayload.Endpoint from = 10;
+  if (this->_internal_has_from()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.from_);
+  }
+
+  // .fs.CallEventPayload.Endpoint to = 11;
+  if (this->_internal_has_to()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.to_);
+  }
+
+  // .fs.CallEventPayload.Parameters params = 18;
+  if (this->_internal_has_params()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.params_);
+  }
+
+  // .fs.CallEventPayload.Eavesdrop eavesdrop = 19;
+  if (this->_internal_has_eavesdrop()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.eavesdrop_);
+  }
+
+  // int64 user_id = 1;
+  if (this->_internal_user_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_user_id());
+  }
+
+  // int64 gateway_id = 2;
+  if (this->_internal_gateway_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_gateway_id());
+  }
+
+  // int64 contact_id = 3;
+  if (this->_internal_contact_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_contact_id());
+  }
+
+  // bool hide_contact = 4;
+  if (this->_internal_hide_contact() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool hideNumber = 5;
+  if (this->_internal_hidenumber() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool originate = 12;
+  if (this->_internal_originate() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // optional bool cdr = 29;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 2 + 1;
+  }
+
+  // int32 heartbeat = 13;
+  if (this->_internal_heartbeat() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_heartbeat());
+  }
+
+  // int64 grantee_id = 15;
+  if (this->_internal_grantee_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_grantee_id());
+  }
+
+  // bool notification_hangup = 30;
+  if (this->_internal_notification_hangup() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // bool originate_success = 43;
+  if (this->_internal_originate_success() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // bool amd_ai_positive = 48;
+  if (this->_internal_amd_ai_positive() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // bool ai_local = 52;
+  if (this->_internal_ai_local() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // int32 sip = 44;
+  if (this->_internal_sip() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int32Size(
+        this->_internal_sip());
+  }
+
+  // bool ai_partial = 53;
+  if (this->_internal_ai_partial() != 0) {
+    total_size += 2 + 1;
+  }
+
+  // float ai_confidence = 54;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ai_confidence = this->_internal_ai_confidence();
+  uint32_t raw_ai_confidence;
+  memcpy(&raw_ai_confidence, &tmp_ai_confidence, sizeof(tmp_ai_confidence));
+  if (raw_ai_confidence != 0) {
+    total_size += 2 + 4;
+  }
+
+  // int64 ai_elapsed_ms = 55;
+  if (this->_internal_ai_elapsed_ms() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::Int64Size(
+        this->_internal_ai_elapsed_ms());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CallEventPayload::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CallEventPayload::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CallEventPayload::GetClassData() const { return &_class_data_; }
+
+
+void CallEventPayload::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CallEventPayload*>(&to_msg);
+  auto& from = static_cast<const CallEventPayload&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.CallEventPayload)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.payload_.MergeFrom(from._impl_.payload_);
+  _this->_impl_.queue_.MergeFrom(from._impl_.queue_);
+  _this->_impl_.tags_.MergeFrom(from._impl_.tags_);
+  _this->_impl_.schema_ids_.MergeFrom(from._impl_.schema_ids_);
+  _this->_impl_.amd_ai_logs_.MergeFrom(from._impl_.amd_ai_logs_);
+  _this->_impl_.calls_.MergeFrom(from._impl_.calls_);
+  if (!from._internal_direction().empty()) {
+    _this->_internal_set_direction(from._internal_direction());
+  }
+  if (!from._internal_destination().empty()) {
+    _this->_internal_set_destination(from._internal_destination());
+  }
+  if (!from._internal_parent_id().empty()) {
+    _this->_internal_set_parent_id(from._internal_parent_id());
+  }
+  if (!from._internal_sip_id().empty()) {
+    _this->_internal_set_sip_id(from._internal_sip_id());
+  }
+  if (!from._internal_ivr().empty()) {
+    _this->_internal_set_ivr(from._internal_ivr());
+  }
+  if (!from._internal_bridged_id().empty()) {
+    _this->_internal_set_bridged_id(from._internal_bridged_id());
+  }
+  if (!from._internal_digit().empty()) {
+    _this->_internal_set_digit(from._internal_digit());
+  }
+  if (!from._internal_application().empty()) {
+    _this->_internal_set_application(from._internal_application());
+  }
+  if (!from._internal_state().empty()) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  if (!from._internal_type().empty()) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  if (!from._internal_ai_result().empty()) {
+    _this->_internal_set_ai_result(from._internal_ai_result());
+  }
+  if (!from._internal_ai_error().empty()) {
+    _this->_internal_set_ai_error(from._internal_ai_error());
+  }
+  if (!from._internal_result().empty()) {
+    _this->_internal_set_result(from._internal_result());
+  }
+  if (!from._internal_cause().empty()) {
+    _this->_internal_set_cause(from._internal_cause());
+  }
+  if (!from._internal_amd_result().empty()) {
+    _this->_internal_set_amd_result(from._internal_amd_result());
+  }
+  if (!from._internal_amd_cause().empty()) {
+    _this->_internal_set_amd_cause(from._internal_amd_cause());
+  }
+  if (!from._internal_record_start().empty()) {
+    _this->_internal_set_record_start(from._internal_record_start());
+  }
+  if (!from._internal_record_stop().empty()) {
+    _this->_internal_set_record_stop(from._internal_record_stop());
+  }
+  if (!from._internal_transfer_to().empty()) {
+    _this->_internal_set_transfer_to(from._internal_transfer_to());
+  }
+  if (!from._internal_transfer_from().empty()) {
+    _this->_internal_set_transfer_from(from._internal_transfer_from());
+  }
+  if (!from._internal_transfer_to_agent().empty()) {
+    _this->_internal_set_transfer_to_agent(from._internal_transfer_to_agent());
+  }
+  if (!from._internal_transfer_from_attempt().empty()) {
+    _this->_internal_set_transfer_from_attempt(from._internal_transfer_from_attempt());
+  }
+  if (!from._internal_transfer_to_attempt().empty()) {
+    _this->_internal_set_transfer_to_attempt(from._internal_transfer_to_attempt());
+  }
+  if (!from._internal_talk_sec().empty()) {
+    _this->_internal_set_talk_sec(from._internal_talk_sec());
+  }
+  if (!from._internal_hangup_by().empty()) {
+    _this->_internal_set_hangup_by(from._internal_hangup_by());
+  }
+  if (!from._internal_reporting_at().empty()) {
+    _this->_internal_set_reporting_at(from._internal_reporting_at());
+  }
+  if (!from._internal_amd_ai_result().empty()) {
+    _this->_internal_set_amd_ai_result(from._internal_amd_ai_result());
+  }
+  if (!from._internal_hangup_phrase().empty()) {
+    _this->_internal_set_hangup_phrase(from._internal_hangup_phrase());
+  }
+  if (from._internal_has_from()) {
+    _this->_internal_mutable_from()->::fs::CallEventPayload_Endpoint::MergeFrom(
+        from._internal_from());
+  }
+  if (from._internal_has_to()) {
+    _this->_internal_mutable_to()->::fs::CallEventPayload_Endpoint::MergeFrom(
+        from._internal_to());
+  }
+  if (from._internal_has_params()) {
+    _this->_internal_mutable_params()->::fs::CallEventPayload_Parameters::MergeFrom(
+        from._internal_params());
+  }
+  if (from._internal_has_eavesdrop()) {
+    _this->_internal_mutable_eavesdrop()->::fs::CallEventPayload_Eavesdrop::MergeFrom(
+        from._internal_eavesdrop());
+  }
+  if (from._internal_user_id() != 0) {
+    _this->_internal_set_user_id(from._internal_user_id());
+  }
+  if (from._internal_gateway_id() != 0) {
+    _this->_internal_set_gateway_id(from._internal_gateway_id());
+  }
+  if (from._internal_contact_id() != 0) {
+    _this->_internal_set_contact_id(from._internal_contact_id());
+  }
+  if (from._internal_hide_contact() != 0) {
+    _this->_internal_set_hide_contact(from._internal_hide_contact());
+  }
+  if (from._internal_hidenumber() != 0) {
+    _this->_internal_set_hidenumber(from._internal_hidenumber());
+  }
+  if (from._internal_originate() != 0) {
+    _this->_internal_set_originate(from._internal_originate());
+  }
+  if (from._internal_has_cdr()) {
+    _this->_internal_set_cdr(from._internal_cdr());
+  }
+  if (from._internal_heartbeat() != 0) {
+    _this->_internal_set_heartbeat(from._internal_heartbeat());
+  }
+  if (from._internal_grantee_id() != 0) {
+    _this->_internal_set_grantee_id(from._internal_grantee_id());
+  }
+  if (from._internal_notification_hangup() != 0) {
+    _this->_internal_set_notification_hangup(from._internal_notification_hangup());
+  }
+  if (from._internal_originate_success() != 0) {
+    _this->_internal_set_originate_success(from._internal_originate_success());
+  }
+  if (from._internal_amd_ai_positive() != 0) {
+    _this->_internal_set_amd_ai_positive(from._internal_amd_ai_positive());
+  }
+  if (from._internal_ai_local() != 0) {
+    _this->_internal_set_ai_local(from._internal_ai_local());
+  }
+  if (from._internal_sip() != 0) {
+    _this->_internal_set_sip(from._internal_sip());
+  }
+  if (from._internal_ai_partial() != 0) {
+    _this->_internal_set_ai_partial(from._internal_ai_partial());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_ai_confidence = from._internal_ai_confidence();
+  uint32_t raw_ai_confidence;
+  memcpy(&raw_ai_confidence, &tmp_ai_confidence, sizeof(tmp_ai_confidence));
+  if (raw_ai_confidence != 0) {
+    _this->_internal_set_ai_confidence(from._internal_ai_confidence());
+  }
+  if (from._internal_ai_elapsed_ms() != 0) {
+    _this->_internal_set_ai_elapsed_ms(from._internal_ai_elapsed_ms());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CallEventPayload::CopyFrom(const CallEventPayload& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.CallEventPayload)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CallEventPayload::IsInitialized() const {
+  return true;
+}
+
+void CallEventPayload::InternalSwap(CallEventPayload* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.payload_.InternalSwap(&other->_impl_.payload_);
+  _impl_.queue_.InternalSwap(&other->_impl_.queue_);
+  _impl_.tags_.InternalSwap(&other->_impl_.tags_);
+  _impl_.schema_ids_.InternalSwap(&other->_impl_.schema_ids_);
+  _impl_.amd_ai_logs_.InternalSwap(&other->_impl_.amd_ai_logs_);
+  _impl_.calls_.InternalSwap(&other->_impl_.calls_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.direction_, lhs_arena,
+      &other->_impl_.direction_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.destination_, lhs_arena,
+      &other->_impl_.destination_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.parent_id_, lhs_arena,
+      &other->_impl_.parent_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sip_id_, lhs_arena,
+      &other->_impl_.sip_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ivr_, lhs_arena,
+      &other->_impl_.ivr_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.bridged_id_, lhs_arena,
+      &other->_impl_.bridged_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.digit_, lhs_arena,
+      &other->_impl_.digit_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.application_, lhs_arena,
+      &other->_impl_.application_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.state_, lhs_arena,
+      &other->_impl_.state_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ai_result_, lhs_arena,
+      &other->_impl_.ai_result_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ai_error_, lhs_arena,
+      &other->_impl_.ai_error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.result_, lhs_arena,
+      &other->_impl_.result_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cause_, lhs_arena,
+      &other->_impl_.cause_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.amd_result_, lhs_arena,
+      &other->_impl_.amd_result_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.amd_cause_, lhs_arena,
+      &other->_impl_.amd_cause_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.record_start_, lhs_arena,
+      &other->_impl_.record_start_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.record_stop_, lhs_arena,
+      &other->_impl_.record_stop_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.transfer_to_, lhs_arena,
+      &other->_impl_.transfer_to_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.transfer_from_, lhs_arena,
+      &other->_impl_.transfer_from_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.transfer_to_agent_, lhs_arena,
+      &other->_impl_.transfer_to_agent_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.transfer_from_attempt_, lhs_arena,
+      &other->_impl_.transfer_from_attempt_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.transfer_to_attempt_, lhs_arena,
+      &other->_impl_.transfer_to_attempt_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.talk_sec_, lhs_arena,
+      &other->_impl_.talk_sec_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hangup_by_, lhs_arena,
+      &other->_impl_.hangup_by_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reporting_at_, lhs_arena,
+      &other->_impl_.reporting_at_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.amd_ai_result_, lhs_arena,
+      &other->_impl_.amd_ai_result_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hangup_phrase_, lhs_arena,
+      &other->_impl_.hangup_phrase_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CallEventPayload, _impl_.ai_elapsed_ms_)
+      + sizeof(CallEventPayload::_impl_.ai_elapsed_ms_)
+      - PROTOBUF_FIELD_OFFSET(CallEventPayload, _impl_.from_)>(
+          reinterpret_cast<char*>(&_impl_.from_),
+          reinterpret_cast<char*>(&other->_impl_.from_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CallEventPayload::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[8]);
+}
+
+// ===================================================================
+
+BreakParkRequest_VariablesEntry_DoNotUse::BreakParkRequest_VariablesEntry_DoNotUse() {}
+BreakParkRequest_VariablesEntry_DoNotUse::BreakParkRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void BreakParkRequest_VariablesEntry_DoNotUse::MergeFrom(const BreakParkRequest_VariablesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata BreakParkRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[9]);
+}
+
+// ===================================================================
+
+class BreakParkRequest::_Internal {
+ public:
+};
+
+BreakParkRequest::BreakParkRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &BreakParkRequest::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:fs.BreakParkRequest)
+}
+BreakParkRequest::BreakParkRequest(const BreakParkRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BreakParkRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.variables_)*/{}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.BreakParkRequest)
+}
+
+inline void BreakParkRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BreakParkRequest::~BreakParkRequest() {
+  // @@protoc_insertion_point(destructor:fs.BreakParkRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BreakParkRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.variables_.Destruct();
+  _impl_.variables_.~MapField();
+  _impl_.id_.Destroy();
+}
+
+void BreakParkRequest::ArenaDtor(void* object) {
+  BreakParkRequest* _this = reinterpret_cast< BreakParkRequest* >(object);
+  _this->_impl_.variables_.Destruct();
+}
+void BreakParkRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BreakParkRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.BreakParkRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.variables_.Clear();
+  _impl_.id_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BreakParkRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BreakParkRequest.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> variables = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BreakParkRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.BreakParkRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BreakParkRequest.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // map<string, string> variables = 2;
+  if (!this->_internal_variables().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = BreakParkRequest_VariablesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_variables();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.BreakParkRequest.VariablesEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.BreakParkRequest.VariablesEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.BreakParkRequest)
+  return target;
+}
+
+size_t BreakParkRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.BreakParkRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> variables = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_variables().begin();
+      it != this->_internal_variables().end(); ++it) {
+    total_size += BreakParkRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BreakParkRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BreakParkRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BreakParkRequest::GetClassData() const { return &_class_data_; }
+
+
+void BreakParkRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BreakParkRequest*>(&to_msg);
+  auto& from = static_cast<const BreakParkRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BreakParkRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BreakParkRequest::CopyFrom(const BreakParkRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.BreakParkRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BreakParkRequest::IsInitialized() const {
+  return true;
+}
+
+void BreakParkRequest::InternalSwap(BreakParkRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BreakParkRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[10]);
+}
+
+// ===================================================================
+
+class BreakParkResponse::_Internal {
+ public:
+};
+
+BreakParkResponse::BreakParkResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.BreakParkResponse)
+}
+BreakParkResponse::BreakParkResponse(const BreakParkResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BreakParkResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ok_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.ok_ = from._impl_.ok_;
+  // @@protoc_insertion_point(copy_constructor:fs.BreakParkResponse)
+}
+
+inline void BreakParkResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ok_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BreakParkResponse::~BreakParkResponse() {
+  // @@protoc_insertion_point(destructor:fs.BreakParkResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BreakParkResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void BreakParkResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BreakParkResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.BreakParkResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ok_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BreakParkResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool ok = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.ok_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BreakParkResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.BreakParkResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool ok = 1;
+  if (this->_internal_ok() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_ok(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.BreakParkResponse)
+  return target;
+}
+
+size_t BreakParkResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.BreakParkResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bool ok = 1;
+  if (this->_internal_ok() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BreakParkResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BreakParkResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BreakParkResponse::GetClassData() const { return &_class_data_; }
+
+
+void BreakParkResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BreakParkResponse*>(&to_msg);
+  auto& from = static_cast<const BreakParkResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BreakParkResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_ok() != 0) {
+    _this->_internal_set_ok(from._internal_ok());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BreakParkResponse::CopyFrom(const BreakParkResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.BreakParkResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BreakParkResponse::IsInitialized() const {
+  return true;
+}
+
+void BreakParkResponse::InternalSwap(BreakParkResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.ok_, other->_impl_.ok_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BreakParkResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[11]);
+}
+
+// ===================================================================
+
+BlindTransferRequest_VariablesEntry_DoNotUse::BlindTransferRequest_VariablesEntry_DoNotUse() {}
+BlindTransferRequest_VariablesEntry_DoNotUse::BlindTransferRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void BlindTransferRequest_VariablesEntry_DoNotUse::MergeFrom(const BlindTransferRequest_VariablesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata BlindTransferRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[12]);
+}
+
+// ===================================================================
+
+class BlindTransferRequest::_Internal {
+ public:
+};
+
+BlindTransferRequest::BlindTransferRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &BlindTransferRequest::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:fs.BlindTransferRequest)
+}
+BlindTransferRequest::BlindTransferRequest(const BlindTransferRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlindTransferRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.variables_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.dialplan_){}
+    , decltype(_impl_.context_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_destination().empty()) {
+    _this->_impl_.destination_.Set(from._internal_destination(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.dialplan_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dialplan_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_dialplan().empty()) {
+    _this->_impl_.dialplan_.Set(from._internal_dialplan(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.context_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.context_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_context().empty()) {
+    _this->_impl_.context_.Set(from._internal_context(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.BlindTransferRequest)
+}
+
+inline void BlindTransferRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.dialplan_){}
+    , decltype(_impl_.context_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.dialplan_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dialplan_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.context_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.context_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BlindTransferRequest::~BlindTransferRequest() {
+  // @@protoc_insertion_point(destructor:fs.BlindTransferRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlindTransferRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.variables_.Destruct();
+  _impl_.variables_.~MapField();
+  _impl_.id_.Destroy();
+  _impl_.destination_.Destroy();
+  _impl_.dialplan_.Destroy();
+  _impl_.context_.Destroy();
+}
+
+void BlindTransferRequest::ArenaDtor(void* object) {
+  BlindTransferRequest* _this = reinterpret_cast< BlindTransferRequest* >(object);
+  _this->_impl_.variables_.Destruct();
+}
+void BlindTransferRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlindTransferRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.BlindTransferRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.variables_.Clear();
+  _impl_.id_.ClearToEmpty();
+  _impl_.destination_.ClearToEmpty();
+  _impl_.dialplan_.ClearToEmpty();
+  _impl_.context_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BlindTransferRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BlindTransferRequest.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string destination = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_destination();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BlindTransferRequest.destination"));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> variables = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string dialplan = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_dialplan();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BlindTransferRequest.dialplan"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string context = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_context();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BlindTransferRequest.context"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlindTransferRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.BlindTransferRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BlindTransferRequest.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string destination = 2;
+  if (!this->_internal_destination().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_destination().data(), static_cast<int>(this->_internal_destination().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BlindTransferRequest.destination");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_destination(), target);
+  }
+
+  // map<string, string> variables = 3;
+  if (!this->_internal_variables().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = BlindTransferRequest_VariablesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_variables();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.BlindTransferRequest.VariablesEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.BlindTransferRequest.VariablesEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // string dialplan = 4;
+  if (!this->_internal_dialplan().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_dialplan().data(), static_cast<int>(this->_internal_dialplan().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BlindTransferRequest.dialplan");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_dialplan(), target);
+  }
+
+  // string context = 5;
+  if (!this->_internal_context().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_context().data(), static_cast<int>(this->_internal_context().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BlindTransferRequest.context");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_context(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.BlindTransferRequest)
+  return target;
+}
+
+size_t BlindTransferRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.BlindTransferRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> variables = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_variables().begin();
+      it != this->_internal_variables().end(); ++it) {
+    total_size += BlindTransferRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string destination = 2;
+  if (!this->_internal_destination().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_destination());
+  }
+
+  // string dialplan = 4;
+  if (!this->_internal_dialplan().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_dialplan());
+  }
+
+  // string context = 5;
+  if (!this->_internal_context().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_context());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlindTransferRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlindTransferRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlindTransferRequest::GetClassData() const { return &_class_data_; }
+
+
+void BlindTransferRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlindTransferRequest*>(&to_msg);
+  auto& from = static_cast<const BlindTransferRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BlindTransferRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_destination().empty()) {
+    _this->_internal_set_destination(from._internal_destination());
+  }
+  if (!from._internal_dialplan().empty()) {
+    _this->_internal_set_dialplan(from._internal_dialplan());
+  }
+  if (!from._internal_context().empty()) {
+    _this->_internal_set_context(from._internal_context());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BlindTransferRequest::CopyFrom(const BlindTransferRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.BlindTransferRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlindTransferRequest::IsInitialized() const {
+  return true;
+}
+
+void BlindTransferRequest::InternalSwap(BlindTransferRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.destination_, lhs_arena,
+      &other->_impl_.destination_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.dialplan_, lhs_arena,
+      &other->_impl_.dialplan_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.context_, lhs_arena,
+      &other->_impl_.context_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BlindTransferRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[13]);
+}
+
+// ===================================================================
+
+class BlindTransferResponse::_Internal {
+ public:
+  static const ::fs::ErrorExecute& error(const BlindTransferResponse* msg);
+};
+
+const ::fs::ErrorExecute&
+BlindTransferResponse::_Internal::error(const BlindTransferResponse* msg) {
+  return *msg->_impl_.error_;
+}
+BlindTransferResponse::BlindTransferResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.BlindTransferResponse)
+}
+BlindTransferResponse::BlindTransferResponse(const BlindTransferResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BlindTransferResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_error()) {
+    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.BlindTransferResponse)
+}
+
+inline void BlindTransferResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BlindTransferResponse::~BlindTransferResponse() {
+  // @@protoc_insertion_point(destructor:fs.BlindTransferResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BlindTransferResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.error_;
+}
+
+void BlindTransferResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BlindTransferResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.BlindTransferResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BlindTransferResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .fs.ErrorExecute error = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BlindTransferResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.BlindTransferResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .fs.ErrorExecute error = 1;
+  if (this->_internal_has_error()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.BlindTransferResponse)
+  return target;
+}
+
+size_t BlindTransferResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.BlindTransferResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .fs.ErrorExecute error = 1;
+  if (this->_internal_has_error()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.error_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BlindTransferResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BlindTransferResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BlindTransferResponse::GetClassData() const { return &_class_data_; }
+
+
+void BlindTransferResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BlindTransferResponse*>(&to_msg);
+  auto& from = static_cast<const BlindTransferResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BlindTransferResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_error()) {
+    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
+        from._internal_error());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BlindTransferResponse::CopyFrom(const BlindTransferResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.BlindTransferResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BlindTransferResponse::IsInitialized() const {
+  return true;
+}
+
+void BlindTransferResponse::InternalSwap(BlindTransferResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.error_, other->_impl_.error_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BlindTransferResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[14]);
+}
+
+// ===================================================================
+
+class SetEavesdropStateRequest::_Internal {
+ public:
+};
+
+SetEavesdropStateRequest::SetEavesdropStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.SetEavesdropStateRequest)
+}
+SetEavesdropStateRequest::SetEavesdropStateRequest(const SetEavesdropStateRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetEavesdropStateRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.state_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_state().empty()) {
+    _this->_impl_.state_.Set(from._internal_state(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.SetEavesdropStateRequest)
+}
+
+inline void SetEavesdropStateRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.state_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.state_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.state_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SetEavesdropStateRequest::~SetEavesdropStateRequest() {
+  // @@protoc_insertion_point(destructor:fs.SetEavesdropStateRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetEavesdropStateRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+  _impl_.state_.Destroy();
+}
+
+void SetEavesdropStateRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetEavesdropStateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.SetEavesdropStateRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.state_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetEavesdropStateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.SetEavesdropStateRequest.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_state();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.SetEavesdropStateRequest.state"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetEavesdropStateRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.SetEavesdropStateRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.SetEavesdropStateRequest.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string state = 2;
+  if (!this->_internal_state().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_state().data(), static_cast<int>(this->_internal_state().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.SetEavesdropStateRequest.state");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_state(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.SetEavesdropStateRequest)
+  return target;
+}
+
+size_t SetEavesdropStateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.SetEavesdropStateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string state = 2;
+  if (!this->_internal_state().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_state());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetEavesdropStateRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetEavesdropStateRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetEavesdropStateRequest::GetClassData() const { return &_class_data_; }
+
+
+void SetEavesdropStateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetEavesdropStateRequest*>(&to_msg);
+  auto& from = static_cast<const SetEavesdropStateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.SetEavesdropStateRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_state().empty()) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetEavesdropStateRequest::CopyFrom(const SetEavesdropStateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.SetEavesdropStateRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetEavesdropStateRequest::IsInitialized() const {
+  return true;
+}
+
+void SetEavesdropStateRequest::InternalSwap(SetEavesdropStateRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.state_, lhs_arena,
+      &other->_impl_.state_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetEavesdropStateRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[15]);
+}
+
+// ===================================================================
+
+class SetEavesdropStateResponse::_Internal {
+ public:
+  static const ::fs::ErrorExecute& error(const SetEavesdropStateResponse* msg);
+};
+
+const ::fs::ErrorExecute&
+SetEavesdropStateResponse::_Internal::error(const SetEavesdropStateResponse* msg) {
+  return *msg->_impl_.error_;
+}
+SetEavesdropStateResponse::SetEavesdropStateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.SetEavesdropStateResponse)
+}
+SetEavesdropStateResponse::SetEavesdropStateResponse(const SetEavesdropStateResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SetEavesdropStateResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_error()) {
+    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.SetEavesdropStateResponse)
+}
+
+inline void SetEavesdropStateResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.error_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SetEavesdropStateResponse::~SetEavesdropStateResponse() {
+  // @@protoc_insertion_point(destructor:fs.SetEavesdropStateResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SetEavesdropStateResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.error_;
+}
+
+void SetEavesdropStateResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SetEavesdropStateResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.SetEavesdropStateResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetEavesdropStateResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .fs.ErrorExecute error = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SetEavesdropStateResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.SetEavesdropStateResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .fs.ErrorExecute error = 1;
+  if (this->_internal_has_error()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.SetEavesdropStateResponse)
+  return target;
+}
+
+size_t SetEavesdropStateResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.SetEavesdropStateResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .fs.ErrorExecute error = 1;
+  if (this->_internal_has_error()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.error_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetEavesdropStateResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SetEavesdropStateResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetEavesdropStateResponse::GetClassData() const { return &_class_data_; }
+
+
+void SetEavesdropStateResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetEavesdropStateResponse*>(&to_msg);
+  auto& from = static_cast<const SetEavesdropStateResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.SetEavesdropStateResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_error()) {
+    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
+        from._internal_error());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SetEavesdropStateResponse::CopyFrom(const SetEavesdropStateResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.SetEavesdropStateResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetEavesdropStateResponse::IsInitialized() const {
+  return true;
+}
+
+void SetEavesdropStateResponse::InternalSwap(SetEavesdropStateResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.error_, other->_impl_.error_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetEavesdropStateResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[16]);
+}
+
+// ===================================================================
+
+class BroadcastRequest::_Internal {
+ public:
+};
+
+BroadcastRequest::BroadcastRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.BroadcastRequest)
+}
+BroadcastRequest::BroadcastRequest(const BroadcastRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BroadcastRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.args_){}
+    , decltype(_impl_.leg_){}
+    , decltype(_impl_.wait_for_answer_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.args_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.args_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_args().empty()) {
+    _this->_impl_.args_.Set(from._internal_args(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.leg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_leg().empty()) {
+    _this->_impl_.leg_.Set(from._internal_leg(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.wait_for_answer_ = from._impl_.wait_for_answer_;
+  // @@protoc_insertion_point(copy_constructor:fs.BroadcastRequest)
+}
+
+inline void BroadcastRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.args_){}
+    , decltype(_impl_.leg_){}
+    , decltype(_impl_.wait_for_answer_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.args_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.args_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.leg_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leg_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BroadcastRequest::~BroadcastRequest() {
+  // @@protoc_insertion_point(destructor:fs.BroadcastRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BroadcastRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+  _impl_.args_.Destroy();
+  _impl_.leg_.Destroy();
+}
+
+void BroadcastRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BroadcastRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.BroadcastRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.args_.ClearToEmpty();
+  _impl_.leg_.ClearToEmpty();
+  _impl_.wait_for_answer_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BroadcastRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BroadcastRequest.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string args = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_args();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BroadcastRequest.args"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool wait_for_answer = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.wait_for_answer_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string leg = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_leg();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BroadcastRequest.leg"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BroadcastRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.BroadcastRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BroadcastRequest.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string args = 2;
+  if (!this->_internal_args().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_args().data(), static_cast<int>(this->_internal_args().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BroadcastRequest.args");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_args(), target);
+  }
+
+  // bool wait_for_answer = 3;
+  if (this->_internal_wait_for_answer() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_wait_for_answer(), target);
+  }
+
+  // string leg = 4;
+  if (!this->_internal_leg().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_leg().data(), static_cast<int>(this->_internal_leg().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BroadcastRequest.leg");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_leg(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.BroadcastRequest)
+  return target;
+}
+
+size_t BroadcastRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.BroadcastRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string args = 2;
+  if (!this->_internal_args().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_args());
+  }
+
+  // string leg = 4;
+  if (!this->_internal_leg().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_leg());
+  }
+
+  // bool wait_for_answer = 3;
+  if (this->_internal_wait_for_answer() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BroadcastRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastRequest::GetClassData() const { return &_class_data_; }
+
+
+void BroadcastRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BroadcastRequest*>(&to_msg);
+  auto& from = static_cast<const BroadcastRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BroadcastRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_args().empty()) {
+    _this->_internal_set_args(from._internal_args());
+  }
+  if (!from._internal_leg().empty()) {
+    _this->_internal_set_leg(from._internal_leg());
+  }
+  if (from._internal_wait_for_answer() != 0) {
+    _this->_internal_set_wait_for_answer(from._internal_wait_for_answer());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BroadcastRequest::CopyFrom(const BroadcastRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.BroadcastRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BroadcastRequest::IsInitialized() const {
+  return true;
+}
+
+void BroadcastRequest::InternalSwap(BroadcastRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.args_, lhs_arena,
+      &other->_impl_.args_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.leg_, lhs_arena,
+      &other->_impl_.leg_, rhs_arena
+  );
+  swap(_impl_.wait_for_answer_, other->_impl_.wait_for_answer_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[17]);
+}
+
+// ===================================================================
+
+class BroadcastResponse::_Internal {
+ public:
+  static const ::fs::ErrorExecute& error(const BroadcastResponse* msg);
+};
+
+const ::fs::ErrorExecute&
+BroadcastResponse::_Internal::error(const BroadcastResponse* msg) {
+  return *msg->_impl_.error_;
+}
+BroadcastResponse::BroadcastResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.BroadcastResponse)
+}
+BroadcastResponse::BroadcastResponse(const BroadcastResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BroadcastResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.error_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_error()) {
+    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.BroadcastResponse)
+}
+
+inline void BroadcastResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_){}
+    , decltype(_impl_.error_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BroadcastResponse::~BroadcastResponse() {
+  // @@protoc_insertion_point(destructor:fs.BroadcastResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BroadcastResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.error_;
+}
+
+void BroadcastResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BroadcastResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.BroadcastResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BroadcastResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string data = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BroadcastResponse.data"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .fs.ErrorExecute error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BroadcastResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.BroadcastResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string data = 1;
+  if (!this->_internal_data().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_data().data(), static_cast<int>(this->_internal_data().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BroadcastResponse.data");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_data(), target);
+  }
+
+  // .fs.ErrorExecute error = 2;
+  if (this->_internal_has_error()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.BroadcastResponse)
+  return target;
+}
+
+size_t BroadcastResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.BroadcastResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string data = 1;
+  if (!this->_internal_data().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_data());
+  }
+
+  // .fs.ErrorExecute error = 2;
+  if (this->_internal_has_error()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.error_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BroadcastResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastResponse::GetClassData() const { return &_class_data_; }
+
+
+void BroadcastResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BroadcastResponse*>(&to_msg);
+  auto& from = static_cast<const BroadcastResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BroadcastResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
+  }
+  if (from._internal_has_error()) {
+    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
+        from._internal_error());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BroadcastResponse::CopyFrom(const BroadcastResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.BroadcastResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BroadcastResponse::IsInitialized() const {
+  return true;
+}
+
+void BroadcastResponse::InternalSwap(BroadcastResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  swap(_impl_.error_, other->_impl_.error_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BroadcastResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[18]);
+}
+
+// ===================================================================
+
+class ConfirmPushRequest::_Internal {
+ public:
+};
+
+ConfirmPushRequest::ConfirmPushRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.ConfirmPushRequest)
+}
+ConfirmPushRequest::ConfirmPushRequest(const ConfirmPushRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConfirmPushRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.ConfirmPushRequest)
+}
+
+inline void ConfirmPushRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ConfirmPushRequest::~ConfirmPushRequest() {
+  // @@protoc_insertion_point(destructor:fs.ConfirmPushRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConfirmPushRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+}
+
+void ConfirmPushRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConfirmPushRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.ConfirmPushRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConfirmPushRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.ConfirmPushRequest.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
 message_done:
   return ptr;
@@ -3039,9 +8652,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* BroadcastRequest::_InternalSerialize(
+uint8_t* ConfirmPushRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.BroadcastRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.ConfirmPushRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3050,47 +8663,21 @@ uint8_t* BroadcastRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BroadcastRequest.id");
+      "fs.ConfirmPushRequest.id");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_id(), target);
   }
 
-  // string args = 2;
-  if (!this->_internal_args().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_args().data(), static_cast<int>(this->_internal_args().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BroadcastRequest.args");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_args(), target);
-  }
-
-  // bool wait_for_answer = 3;
-  if (this->_internal_wait_for_answer() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_wait_for_answer(), target);
-  }
-
-  // string leg = 4;
-  if (!this->_internal_leg().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_leg().data(), static_cast<int>(this->_internal_leg().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BroadcastRequest.leg");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_leg(), target);
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.BroadcastRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.ConfirmPushRequest)
   return target;
 }
 
-size_t BroadcastRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.BroadcastRequest)
+size_t ConfirmPushRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.ConfirmPushRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -3104,39 +8691,20 @@ size_t BroadcastRequest::ByteSizeLong() const {
         this->_internal_id());
   }
 
-  // string args = 2;
-  if (!this->_internal_args().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_args());
-  }
-
-  // string leg = 4;
-  if (!this->_internal_leg().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_leg());
-  }
-
-  // bool wait_for_answer = 3;
-  if (this->_internal_wait_for_answer() != 0) {
-    total_size += 1 + 1;
-  }
-
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfirmPushRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    BroadcastRequest::MergeImpl
+    ConfirmPushRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfirmPushRequest::GetClassData() const { return &_class_data_; }
 
 
-void BroadcastRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<BroadcastRequest*>(&to_msg);
-  auto& from = static_cast<const BroadcastRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BroadcastRequest)
+void ConfirmPushRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfirmPushRequest*>(&to_msg);
+  auto& from = static_cast<const ConfirmPushRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.ConfirmPushRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -3144,30 +8712,21 @@ void BroadcastRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (!from._internal_id().empty()) {
     _this->_internal_set_id(from._internal_id());
   }
-  if (!from._internal_args().empty()) {
-    _this->_internal_set_args(from._internal_args());
-  }
-  if (!from._internal_leg().empty()) {
-    _this->_internal_set_leg(from._internal_leg());
-  }
-  if (from._internal_wait_for_answer() != 0) {
-    _this->_internal_set_wait_for_answer(from._internal_wait_for_answer());
-  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BroadcastRequest::CopyFrom(const BroadcastRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.BroadcastRequest)
+void ConfirmPushRequest::CopyFrom(const ConfirmPushRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.ConfirmPushRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BroadcastRequest::IsInitialized() const {
+bool ConfirmPushRequest::IsInitialized() const {
   return true;
 }
 
-void BroadcastRequest::InternalSwap(BroadcastRequest* other) {
+void ConfirmPushRequest::InternalSwap(ConfirmPushRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
@@ -3176,80 +8735,57 @@ void BroadcastRequest::InternalSwap(BroadcastRequest* other) {
       &_impl_.id_, lhs_arena,
       &other->_impl_.id_, rhs_arena
   );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.args_, lhs_arena,
-      &other->_impl_.args_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.leg_, lhs_arena,
-      &other->_impl_.leg_, rhs_arena
-  );
-  swap(_impl_.wait_for_answer_, other->_impl_.wait_for_answer_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BroadcastRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ConfirmPushRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[8]);
+      file_level_metadata_fs_2eproto[19]);
 }
 
 // ===================================================================
 
-class BroadcastResponse::_Internal {
+class ConfirmPushResponse::_Internal {
  public:
-  static const ::fs::ErrorExecute& error(const BroadcastResponse* msg);
+  static const ::fs::ErrorExecute& error(const ConfirmPushResponse* msg);
 };
 
 const ::fs::ErrorExecute&
-BroadcastResponse::_Internal::error(const BroadcastResponse* msg) {
+ConfirmPushResponse::_Internal::error(const ConfirmPushResponse* msg) {
   return *msg->_impl_.error_;
 }
-BroadcastResponse::BroadcastResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ConfirmPushResponse::ConfirmPushResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.BroadcastResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.ConfirmPushResponse)
 }
-BroadcastResponse::BroadcastResponse(const BroadcastResponse& from)
+ConfirmPushResponse::ConfirmPushResponse(const ConfirmPushResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  BroadcastResponse* const _this = this; (void)_this;
+  ConfirmPushResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.data_){}
-    , decltype(_impl_.error_){nullptr}
+      decltype(_impl_.error_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.data_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.data_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_data().empty()) {
-    _this->_impl_.data_.Set(from._internal_data(), 
-      _this->GetArenaForAllocation());
-  }
   if (from._internal_has_error()) {
     _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
   }
-  // @@protoc_insertion_point(copy_constructor:fs.BroadcastResponse)
+  // @@protoc_insertion_point(copy_constructor:fs.ConfirmPushResponse)
 }
 
-inline void BroadcastResponse::SharedCtor(
+inline void ConfirmPushResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.data_){}
-    , decltype(_impl_.error_){nullptr}
+      decltype(_impl_.error_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.data_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.data_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-BroadcastResponse::~BroadcastResponse() {
-  // @@protoc_insertion_point(destructor:fs.BroadcastResponse)
+ConfirmPushResponse::~ConfirmPushResponse() {
+  // @@protoc_insertion_point(destructor:fs.ConfirmPushResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3257,23 +8793,21 @@ BroadcastResponse::~BroadcastResponse() {
   SharedDtor();
 }
 
-inline void BroadcastResponse::SharedDtor() {
+inline void ConfirmPushResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.data_.Destroy();
   if (this != internal_default_instance()) delete _impl_.error_;
 }
 
-void BroadcastResponse::SetCachedSize(int size) const {
+void ConfirmPushResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void BroadcastResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.BroadcastResponse)
+void ConfirmPushResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.ConfirmPushResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.data_.ClearToEmpty();
   if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
     delete _impl_.error_;
   }
@@ -3281,25 +8815,15 @@ void BroadcastResponse::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BroadcastResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ConfirmPushResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string data = 1;
+      // .fs.ErrorExecute error = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_data();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BroadcastResponse.data"));
-        } else
-          goto handle_unusual;
-        continue;
-      // .fs.ErrorExecute error = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
           CHK_(ptr);
         } else
@@ -3326,28 +8850,18 @@ failure:
   ptr = nullptr;
   goto message_done;
 #undef CHK_
-}
-
-uint8_t* BroadcastResponse::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.BroadcastResponse)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string data = 1;
-  if (!this->_internal_data().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_data().data(), static_cast<int>(this->_internal_data().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BroadcastResponse.data");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_data(), target);
-  }
+}
 
-  // .fs.ErrorExecute error = 2;
+uint8_t* ConfirmPushResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.ConfirmPushResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .fs.ErrorExecute error = 1;
   if (this->_internal_has_error()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::error(this),
+      InternalWriteMessage(1, _Internal::error(this),
         _Internal::error(this).GetCachedSize(), target, stream);
   }
 
@@ -3355,26 +8869,19 @@ uint8_t* BroadcastResponse::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.BroadcastResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.ConfirmPushResponse)
   return target;
 }
 
-size_t BroadcastResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.BroadcastResponse)
+size_t ConfirmPushResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.ConfirmPushResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string data = 1;
-  if (!this->_internal_data().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_data());
-  }
-
-  // .fs.ErrorExecute error = 2;
+  // .fs.ErrorExecute error = 1;
   if (this->_internal_has_error()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
@@ -3384,24 +8891,21 @@ size_t BroadcastResponse::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BroadcastResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfirmPushResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    BroadcastResponse::MergeImpl
+    ConfirmPushResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BroadcastResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfirmPushResponse::GetClassData() const { return &_class_data_; }
 
 
-void BroadcastResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<BroadcastResponse*>(&to_msg);
-  auto& from = static_cast<const BroadcastResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BroadcastResponse)
+void ConfirmPushResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConfirmPushResponse*>(&to_msg);
+  auto& from = static_cast<const ConfirmPushResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.ConfirmPushResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_data().empty()) {
-    _this->_internal_set_data(from._internal_data());
-  }
   if (from._internal_has_error()) {
     _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
         from._internal_error());
@@ -3409,55 +8913,68 @@ void BroadcastResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, cons
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BroadcastResponse::CopyFrom(const BroadcastResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.BroadcastResponse)
+void ConfirmPushResponse::CopyFrom(const ConfirmPushResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.ConfirmPushResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BroadcastResponse::IsInitialized() const {
+bool ConfirmPushResponse::IsInitialized() const {
   return true;
 }
 
-void BroadcastResponse::InternalSwap(BroadcastResponse* other) {
+void ConfirmPushResponse::InternalSwap(ConfirmPushResponse* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.data_, lhs_arena,
-      &other->_impl_.data_, rhs_arena
-  );
   swap(_impl_.error_, other->_impl_.error_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BroadcastResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ConfirmPushResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[9]);
+      file_level_metadata_fs_2eproto[20]);
 }
 
 // ===================================================================
 
-class ConfirmPushRequest::_Internal {
+SetProfileVarRequest_VariablesEntry_DoNotUse::SetProfileVarRequest_VariablesEntry_DoNotUse() {}
+SetProfileVarRequest_VariablesEntry_DoNotUse::SetProfileVarRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void SetProfileVarRequest_VariablesEntry_DoNotUse::MergeFrom(const SetProfileVarRequest_VariablesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata SetProfileVarRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[21]);
+}
+
+// ===================================================================
+
+class SetProfileVarRequest::_Internal {
  public:
 };
 
-ConfirmPushRequest::ConfirmPushRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SetProfileVarRequest::SetProfileVarRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.ConfirmPushRequest)
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &SetProfileVarRequest::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:fs.SetProfileVarRequest)
 }
-ConfirmPushRequest::ConfirmPushRequest(const ConfirmPushRequest& from)
+SetProfileVarRequest::SetProfileVarRequest(const SetProfileVarRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ConfirmPushRequest* const _this = this; (void)_this;
+  SetProfileVarRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){}
+      /*decltype(_impl_.variables_)*/{}
+    , decltype(_impl_.id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
   _impl_.id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.id_.Set("", GetArenaForAllocation());
@@ -3466,15 +8983,16 @@ ConfirmPushRequest::ConfirmPushRequest(const ConfirmPushRequest& from)
     _this->_impl_.id_.Set(from._internal_id(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.ConfirmPushRequest)
+  // @@protoc_insertion_point(copy_constructor:fs.SetProfileVarRequest)
 }
 
-inline void ConfirmPushRequest::SharedCtor(
+inline void SetProfileVarRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){}
+      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.id_){}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.id_.InitDefault();
@@ -3483,35 +9001,43 @@ inline void ConfirmPushRequest::SharedCtor(
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ConfirmPushRequest::~ConfirmPushRequest() {
-  // @@protoc_insertion_point(destructor:fs.ConfirmPushRequest)
+SetProfileVarRequest::~SetProfileVarRequest() {
+  // @@protoc_insertion_point(destructor:fs.SetProfileVarRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
+    ArenaDtor(this);
     return;
   }
   SharedDtor();
 }
 
-inline void ConfirmPushRequest::SharedDtor() {
+inline void SetProfileVarRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.variables_.Destruct();
+  _impl_.variables_.~MapField();
   _impl_.id_.Destroy();
 }
 
-void ConfirmPushRequest::SetCachedSize(int size) const {
+void SetProfileVarRequest::ArenaDtor(void* object) {
+  SetProfileVarRequest* _this = reinterpret_cast< SetProfileVarRequest* >(object);
+  _this->_impl_.variables_.Destruct();
+}
+void SetProfileVarRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ConfirmPushRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.ConfirmPushRequest)
+void SetProfileVarRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.SetProfileVarRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.variables_.Clear();
   _impl_.id_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ConfirmPushRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SetProfileVarRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -3523,7 +9049,20 @@ const char* ConfirmPushRequest::_InternalParse(const char* ptr, ::_pbi::ParseCon
           auto str = _internal_mutable_id();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.ConfirmPushRequest.id"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.SetProfileVarRequest.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> variables = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -3550,9 +9089,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ConfirmPushRequest::_InternalSerialize(
+uint8_t* SetProfileVarRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.ConfirmPushRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.SetProfileVarRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3561,27 +9100,66 @@ uint8_t* ConfirmPushRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.ConfirmPushRequest.id");
+      "fs.SetProfileVarRequest.id");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_id(), target);
   }
 
+  // map<string, string> variables = 2;
+  if (!this->_internal_variables().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = SetProfileVarRequest_VariablesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_variables();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.SetProfileVarRequest.VariablesEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.SetProfileVarRequest.VariablesEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.ConfirmPushRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.SetProfileVarRequest)
   return target;
 }
 
-size_t ConfirmPushRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.ConfirmPushRequest)
+size_t SetProfileVarRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.SetProfileVarRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // map<string, string> variables = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_variables().begin();
+      it != this->_internal_variables().end(); ++it) {
+    total_size += SetProfileVarRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
   // string id = 1;
   if (!this->_internal_id().empty()) {
     total_size += 1 +
@@ -3592,98 +9170,144 @@ size_t ConfirmPushRequest::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfirmPushRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetProfileVarRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ConfirmPushRequest::MergeImpl
+    SetProfileVarRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfirmPushRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetProfileVarRequest::GetClassData() const { return &_class_data_; }
 
 
-void ConfirmPushRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ConfirmPushRequest*>(&to_msg);
-  auto& from = static_cast<const ConfirmPushRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.ConfirmPushRequest)
+void SetProfileVarRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SetProfileVarRequest*>(&to_msg);
+  auto& from = static_cast<const SetProfileVarRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.SetProfileVarRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
   if (!from._internal_id().empty()) {
     _this->_internal_set_id(from._internal_id());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ConfirmPushRequest::CopyFrom(const ConfirmPushRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.ConfirmPushRequest)
+void SetProfileVarRequest::CopyFrom(const SetProfileVarRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.SetProfileVarRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ConfirmPushRequest::IsInitialized() const {
+bool SetProfileVarRequest::IsInitialized() const {
   return true;
 }
 
-void ConfirmPushRequest::InternalSwap(ConfirmPushRequest* other) {
+void SetProfileVarRequest::InternalSwap(SetProfileVarRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.id_, lhs_arena,
       &other->_impl_.id_, rhs_arena
   );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ConfirmPushRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SetProfileVarRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[10]);
+      file_level_metadata_fs_2eproto[22]);
 }
 
 // ===================================================================
 
-class ConfirmPushResponse::_Internal {
+class SetProfileVarResponse::_Internal {
+ public:
+};
+
+SetProfileVarResponse::SetProfileVarResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:fs.SetProfileVarResponse)
+}
+SetProfileVarResponse::SetProfileVarResponse(const SetProfileVarResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  SetProfileVarResponse* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:fs.SetProfileVarResponse)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetProfileVarResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetProfileVarResponse::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetProfileVarResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[23]);
+}
+
+// ===================================================================
+
+class StopPlaybackRequest::_Internal {
  public:
-  static const ::fs::ErrorExecute& error(const ConfirmPushResponse* msg);
 };
 
-const ::fs::ErrorExecute&
-ConfirmPushResponse::_Internal::error(const ConfirmPushResponse* msg) {
-  return *msg->_impl_.error_;
-}
-ConfirmPushResponse::ConfirmPushResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+StopPlaybackRequest::StopPlaybackRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.ConfirmPushResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.StopPlaybackRequest)
 }
-ConfirmPushResponse::ConfirmPushResponse(const ConfirmPushResponse& from)
+StopPlaybackRequest::StopPlaybackRequest(const StopPlaybackRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ConfirmPushResponse* const _this = this; (void)_this;
+  StopPlaybackRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.error_){nullptr}
+      decltype(_impl_.id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_error()) {
-    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.ConfirmPushResponse)
+  // @@protoc_insertion_point(copy_constructor:fs.StopPlaybackRequest)
 }
 
-inline void ConfirmPushResponse::SharedCtor(
+inline void StopPlaybackRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.error_){nullptr}
+      decltype(_impl_.id_){}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ConfirmPushResponse::~ConfirmPushResponse() {
-  // @@protoc_insertion_point(destructor:fs.ConfirmPushResponse)
+StopPlaybackRequest::~StopPlaybackRequest() {
+  // @@protoc_insertion_point(destructor:fs.StopPlaybackRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3691,39 +9315,38 @@ ConfirmPushResponse::~ConfirmPushResponse() {
   SharedDtor();
 }
 
-inline void ConfirmPushResponse::SharedDtor() {
+inline void StopPlaybackRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.error_;
+  _impl_.id_.Destroy();
 }
 
-void ConfirmPushResponse::SetCachedSize(int size) const {
+void StopPlaybackRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ConfirmPushResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.ConfirmPushResponse)
+void StopPlaybackRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.StopPlaybackRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
-    delete _impl_.error_;
-  }
-  _impl_.error_ = nullptr;
+  _impl_.id_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ConfirmPushResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* StopPlaybackRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .fs.ErrorExecute error = 1;
+      // string id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.StopPlaybackRequest.id"));
         } else
           goto handle_unusual;
         continue;
@@ -3750,157 +9373,218 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ConfirmPushResponse::_InternalSerialize(
+uint8_t* StopPlaybackRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.ConfirmPushResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.StopPlaybackRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .fs.ErrorExecute error = 1;
-  if (this->_internal_has_error()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::error(this),
-        _Internal::error(this).GetCachedSize(), target, stream);
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.StopPlaybackRequest.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.ConfirmPushResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.StopPlaybackRequest)
   return target;
 }
 
-size_t ConfirmPushResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.ConfirmPushResponse)
+size_t StopPlaybackRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.StopPlaybackRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .fs.ErrorExecute error = 1;
-  if (this->_internal_has_error()) {
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.error_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConfirmPushResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopPlaybackRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ConfirmPushResponse::MergeImpl
+    StopPlaybackRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConfirmPushResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopPlaybackRequest::GetClassData() const { return &_class_data_; }
 
 
-void ConfirmPushResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ConfirmPushResponse*>(&to_msg);
-  auto& from = static_cast<const ConfirmPushResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.ConfirmPushResponse)
+void StopPlaybackRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StopPlaybackRequest*>(&to_msg);
+  auto& from = static_cast<const StopPlaybackRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.StopPlaybackRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_error()) {
-    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
-        from._internal_error());
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ConfirmPushResponse::CopyFrom(const ConfirmPushResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.ConfirmPushResponse)
+void StopPlaybackRequest::CopyFrom(const StopPlaybackRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.StopPlaybackRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ConfirmPushResponse::IsInitialized() const {
+bool StopPlaybackRequest::IsInitialized() const {
   return true;
 }
 
-void ConfirmPushResponse::InternalSwap(ConfirmPushResponse* other) {
+void StopPlaybackRequest::InternalSwap(StopPlaybackRequest* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.error_, other->_impl_.error_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ConfirmPushResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata StopPlaybackRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[11]);
+      file_level_metadata_fs_2eproto[24]);
 }
 
 // ===================================================================
 
-SetProfileVarRequest_VariablesEntry_DoNotUse::SetProfileVarRequest_VariablesEntry_DoNotUse() {}
-SetProfileVarRequest_VariablesEntry_DoNotUse::SetProfileVarRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+class StopPlaybackResponse::_Internal {
+ public:
+};
+
+StopPlaybackResponse::StopPlaybackResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:fs.StopPlaybackResponse)
+}
+StopPlaybackResponse::StopPlaybackResponse(const StopPlaybackResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  StopPlaybackResponse* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:fs.StopPlaybackResponse)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopPlaybackResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopPlaybackResponse::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata StopPlaybackResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[25]);
+}
+
+// ===================================================================
+
+BridgeCallRequest_VariablesEntry_DoNotUse::BridgeCallRequest_VariablesEntry_DoNotUse() {}
+BridgeCallRequest_VariablesEntry_DoNotUse::BridgeCallRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
     : SuperType(arena) {}
-void SetProfileVarRequest_VariablesEntry_DoNotUse::MergeFrom(const SetProfileVarRequest_VariablesEntry_DoNotUse& other) {
+void BridgeCallRequest_VariablesEntry_DoNotUse::MergeFrom(const BridgeCallRequest_VariablesEntry_DoNotUse& other) {
   MergeFromInternal(other);
 }
-::PROTOBUF_NAMESPACE_ID::Metadata SetProfileVarRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata BridgeCallRequest_VariablesEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[12]);
+      file_level_metadata_fs_2eproto[26]);
 }
 
 // ===================================================================
 
-class SetProfileVarRequest::_Internal {
+class BridgeCallRequest::_Internal {
  public:
 };
 
-SetProfileVarRequest::SetProfileVarRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+BridgeCallRequest::BridgeCallRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
   if (arena != nullptr && !is_message_owned) {
-    arena->OwnCustomDestructor(this, &SetProfileVarRequest::ArenaDtor);
+    arena->OwnCustomDestructor(this, &BridgeCallRequest::ArenaDtor);
   }
-  // @@protoc_insertion_point(arena_constructor:fs.SetProfileVarRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.BridgeCallRequest)
 }
-SetProfileVarRequest::SetProfileVarRequest(const SetProfileVarRequest& from)
+BridgeCallRequest::BridgeCallRequest(const BridgeCallRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SetProfileVarRequest* const _this = this; (void)_this;
+  BridgeCallRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       /*decltype(_impl_.variables_)*/{}
-    , decltype(_impl_.id_){}
+    , decltype(_impl_.leg_a_id_){}
+    , decltype(_impl_.leg_b_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  _impl_.id_.InitDefault();
+  _impl_.leg_a_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
+    _impl_.leg_a_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_id().empty()) {
-    _this->_impl_.id_.Set(from._internal_id(), 
+  if (!from._internal_leg_a_id().empty()) {
+    _this->_impl_.leg_a_id_.Set(from._internal_leg_a_id(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.SetProfileVarRequest)
+  _impl_.leg_b_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leg_b_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_leg_b_id().empty()) {
+    _this->_impl_.leg_b_id_.Set(from._internal_leg_b_id(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.BridgeCallRequest)
 }
 
-inline void SetProfileVarRequest::SharedCtor(
+inline void BridgeCallRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
-    , decltype(_impl_.id_){}
+    , decltype(_impl_.leg_a_id_){}
+    , decltype(_impl_.leg_b_id_){}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.id_.InitDefault();
+  _impl_.leg_a_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
+    _impl_.leg_a_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.leg_b_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.leg_b_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SetProfileVarRequest::~SetProfileVarRequest() {
-  // @@protoc_insertion_point(destructor:fs.SetProfileVarRequest)
+BridgeCallRequest::~BridgeCallRequest() {
+  // @@protoc_insertion_point(destructor:fs.BridgeCallRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     ArenaDtor(this);
@@ -3909,58 +9593,70 @@ SetProfileVarRequest::~SetProfileVarRequest() {
   SharedDtor();
 }
 
-inline void SetProfileVarRequest::SharedDtor() {
+inline void BridgeCallRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.variables_.Destruct();
   _impl_.variables_.~MapField();
-  _impl_.id_.Destroy();
+  _impl_.leg_a_id_.Destroy();
+  _impl_.leg_b_id_.Destroy();
 }
 
-void SetProfileVarRequest::ArenaDtor(void* object) {
-  SetProfileVarRequest* _this = reinterpret_cast< SetProfileVarRequest* >(object);
+void BridgeCallRequest::ArenaDtor(void* object) {
+  BridgeCallRequest* _this = reinterpret_cast< BridgeCallRequest* >(object);
   _this->_impl_.variables_.Destruct();
 }
-void SetProfileVarRequest::SetCachedSize(int size) const {
+void BridgeCallRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SetProfileVarRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.SetProfileVarRequest)
+void BridgeCallRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.BridgeCallRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.variables_.Clear();
-  _impl_.id_.ClearToEmpty();
+  _impl_.leg_a_id_.ClearToEmpty();
+  _impl_.leg_b_id_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SetProfileVarRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* BridgeCallRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string id = 1;
+      // string leg_a_id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_id();
+          auto str = _internal_mutable_leg_a_id();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.SetProfileVarRequest.id"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BridgeCallRequest.leg_a_id"));
         } else
           goto handle_unusual;
         continue;
-      // map<string, string> variables = 2;
+      // string leg_b_id = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_leg_b_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BridgeCallRequest.leg_b_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> variables = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
             ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -3987,47 +9683,57 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SetProfileVarRequest::_InternalSerialize(
+uint8_t* BridgeCallRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.SetProfileVarRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.BridgeCallRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
+  // string leg_a_id = 1;
+  if (!this->_internal_leg_a_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      this->_internal_leg_a_id().data(), static_cast<int>(this->_internal_leg_a_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.SetProfileVarRequest.id");
+      "fs.BridgeCallRequest.leg_a_id");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_id(), target);
+        1, this->_internal_leg_a_id(), target);
   }
 
-  // map<string, string> variables = 2;
+  // string leg_b_id = 2;
+  if (!this->_internal_leg_b_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_leg_b_id().data(), static_cast<int>(this->_internal_leg_b_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.BridgeCallRequest.leg_b_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_leg_b_id(), target);
+  }
+
+  // map<string, string> variables = 3;
   if (!this->_internal_variables().empty()) {
     using MapType = ::_pb::Map<std::string, std::string>;
-    using WireHelper = SetProfileVarRequest_VariablesEntry_DoNotUse::Funcs;
+    using WireHelper = BridgeCallRequest_VariablesEntry_DoNotUse::Funcs;
     const auto& map_field = this->_internal_variables();
     auto check_utf8 = [](const MapType::value_type& entry) {
       (void)entry;
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
         entry.first.data(), static_cast<int>(entry.first.length()),
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.SetProfileVarRequest.VariablesEntry.key");
+        "fs.BridgeCallRequest.VariablesEntry.key");
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
         entry.second.data(), static_cast<int>(entry.second.length()),
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.SetProfileVarRequest.VariablesEntry.value");
+        "fs.BridgeCallRequest.VariablesEntry.value");
     };
 
     if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
       for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
-        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
         check_utf8(entry);
       }
     } else {
       for (const auto& entry : map_field) {
-        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
         check_utf8(entry);
       }
     }
@@ -4037,175 +9743,159 @@ uint8_t* SetProfileVarRequest::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.SetProfileVarRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.BridgeCallRequest)
   return target;
 }
 
-size_t SetProfileVarRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.SetProfileVarRequest)
+size_t BridgeCallRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.BridgeCallRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // map<string, string> variables = 2;
+  // map<string, string> variables = 3;
   total_size += 1 *
       ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
   for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
       it = this->_internal_variables().begin();
       it != this->_internal_variables().end(); ++it) {
-    total_size += SetProfileVarRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+    total_size += BridgeCallRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
+  // string leg_a_id = 1;
+  if (!this->_internal_leg_a_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_id());
+        this->_internal_leg_a_id());
+  }
+
+  // string leg_b_id = 2;
+  if (!this->_internal_leg_b_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_leg_b_id());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetProfileVarRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BridgeCallRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SetProfileVarRequest::MergeImpl
+    BridgeCallRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetProfileVarRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BridgeCallRequest::GetClassData() const { return &_class_data_; }
 
 
-void SetProfileVarRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SetProfileVarRequest*>(&to_msg);
-  auto& from = static_cast<const SetProfileVarRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.SetProfileVarRequest)
+void BridgeCallRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BridgeCallRequest*>(&to_msg);
+  auto& from = static_cast<const BridgeCallRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BridgeCallRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  if (!from._internal_id().empty()) {
-    _this->_internal_set_id(from._internal_id());
+  if (!from._internal_leg_a_id().empty()) {
+    _this->_internal_set_leg_a_id(from._internal_leg_a_id());
+  }
+  if (!from._internal_leg_b_id().empty()) {
+    _this->_internal_set_leg_b_id(from._internal_leg_b_id());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SetProfileVarRequest::CopyFrom(const SetProfileVarRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.SetProfileVarRequest)
+void BridgeCallRequest::CopyFrom(const BridgeCallRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.BridgeCallRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SetProfileVarRequest::IsInitialized() const {
+bool BridgeCallRequest::IsInitialized() const {
   return true;
 }
 
-void SetProfileVarRequest::InternalSwap(SetProfileVarRequest* other) {
+void BridgeCallRequest::InternalSwap(BridgeCallRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.variables_.InternalSwap(&other->_impl_.variables_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.id_, lhs_arena,
-      &other->_impl_.id_, rhs_arena
+      &_impl_.leg_a_id_, lhs_arena,
+      &other->_impl_.leg_a_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.leg_b_id_, lhs_arena,
+      &other->_impl_.leg_b_id_, rhs_arena
   );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SetProfileVarRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata BridgeCallRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[13]);
+      file_level_metadata_fs_2eproto[27]);
 }
 
 // ===================================================================
 
-class SetProfileVarResponse::_Internal {
+class BridgeCallResponse::_Internal {
  public:
+  static const ::fs::ErrorExecute& error(const BridgeCallResponse* msg);
 };
 
-SetProfileVarResponse::SetProfileVarResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:fs.SetProfileVarResponse)
-}
-SetProfileVarResponse::SetProfileVarResponse(const SetProfileVarResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  SetProfileVarResponse* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:fs.SetProfileVarResponse)
-}
-
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SetProfileVarResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SetProfileVarResponse::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata SetProfileVarResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[14]);
+const ::fs::ErrorExecute&
+BridgeCallResponse::_Internal::error(const BridgeCallResponse* msg) {
+  return *msg->_impl_.error_;
 }
-
-// ===================================================================
-
-class StopPlaybackRequest::_Internal {
- public:
-};
-
-StopPlaybackRequest::StopPlaybackRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+BridgeCallResponse::BridgeCallResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.StopPlaybackRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.BridgeCallResponse)
 }
-StopPlaybackRequest::StopPlaybackRequest(const StopPlaybackRequest& from)
+BridgeCallResponse::BridgeCallResponse(const BridgeCallResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  StopPlaybackRequest* const _this = this; (void)_this;
+  BridgeCallResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){}
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.error_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.id_.InitDefault();
+  _impl_.uuid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
+    _impl_.uuid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_id().empty()) {
-    _this->_impl_.id_.Set(from._internal_id(), 
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.StopPlaybackRequest)
+  if (from._internal_has_error()) {
+    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.BridgeCallResponse)
 }
 
-inline void StopPlaybackRequest::SharedCtor(
+inline void BridgeCallResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){}
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.error_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.id_.InitDefault();
+  _impl_.uuid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
+    _impl_.uuid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-StopPlaybackRequest::~StopPlaybackRequest() {
-  // @@protoc_insertion_point(destructor:fs.StopPlaybackRequest)
+BridgeCallResponse::~BridgeCallResponse() {
+  // @@protoc_insertion_point(destructor:fs.BridgeCallResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4213,38 +9903,51 @@ StopPlaybackRequest::~StopPlaybackRequest() {
   SharedDtor();
 }
 
-inline void StopPlaybackRequest::SharedDtor() {
+inline void BridgeCallResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.id_.Destroy();
+  _impl_.uuid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.error_;
 }
 
-void StopPlaybackRequest::SetCachedSize(int size) const {
+void BridgeCallResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void StopPlaybackRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.StopPlaybackRequest)
+void BridgeCallResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.BridgeCallResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.id_.ClearToEmpty();
+  _impl_.uuid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* StopPlaybackRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* BridgeCallResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string id = 1;
+      // string uuid = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_id();
+          auto str = _internal_mutable_uuid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.StopPlaybackRequest.id"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.BridgeCallResponse.uuid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .fs.ErrorExecute error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -4271,290 +9974,195 @@ failure:
 #undef CHK_
 }
 
-uint8_t* StopPlaybackRequest::_InternalSerialize(
+uint8_t* BridgeCallResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.StopPlaybackRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.BridgeCallResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
+  // string uuid = 1;
+  if (!this->_internal_uuid().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.StopPlaybackRequest.id");
+      "fs.BridgeCallResponse.uuid");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_id(), target);
+        1, this->_internal_uuid(), target);
+  }
+
+  // .fs.ErrorExecute error = 2;
+  if (this->_internal_has_error()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.StopPlaybackRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.BridgeCallResponse)
   return target;
 }
 
-size_t StopPlaybackRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.StopPlaybackRequest)
+size_t BridgeCallResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.BridgeCallResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
+  // string uuid = 1;
+  if (!this->_internal_uuid().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_id());
+        this->_internal_uuid());
+  }
+
+  // .fs.ErrorExecute error = 2;
+  if (this->_internal_has_error()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.error_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopPlaybackRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BridgeCallResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    StopPlaybackRequest::MergeImpl
+    BridgeCallResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopPlaybackRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BridgeCallResponse::GetClassData() const { return &_class_data_; }
 
 
-void StopPlaybackRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<StopPlaybackRequest*>(&to_msg);
-  auto& from = static_cast<const StopPlaybackRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.StopPlaybackRequest)
+void BridgeCallResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BridgeCallResponse*>(&to_msg);
+  auto& from = static_cast<const BridgeCallResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BridgeCallResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_id().empty()) {
-    _this->_internal_set_id(from._internal_id());
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
+  }
+  if (from._internal_has_error()) {
+    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
+        from._internal_error());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void StopPlaybackRequest::CopyFrom(const StopPlaybackRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.StopPlaybackRequest)
+void BridgeCallResponse::CopyFrom(const BridgeCallResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.BridgeCallResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool StopPlaybackRequest::IsInitialized() const {
+bool BridgeCallResponse::IsInitialized() const {
   return true;
 }
 
-void StopPlaybackRequest::InternalSwap(StopPlaybackRequest* other) {
+void BridgeCallResponse::InternalSwap(BridgeCallResponse* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.id_, lhs_arena,
-      &other->_impl_.id_, rhs_arena
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
   );
+  swap(_impl_.error_, other->_impl_.error_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata StopPlaybackRequest::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[15]);
-}
-
-// ===================================================================
-
-class StopPlaybackResponse::_Internal {
- public:
-};
-
-StopPlaybackResponse::StopPlaybackResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:fs.StopPlaybackResponse)
-}
-StopPlaybackResponse::StopPlaybackResponse(const StopPlaybackResponse& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  StopPlaybackResponse* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:fs.StopPlaybackResponse)
-}
-
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopPlaybackResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopPlaybackResponse::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata StopPlaybackResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[16]);
-}
-
-// ===================================================================
-
-BridgeCallRequest_VariablesEntry_DoNotUse::BridgeCallRequest_VariablesEntry_DoNotUse() {}
-BridgeCallRequest_VariablesEntry_DoNotUse::BridgeCallRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void BridgeCallRequest_VariablesEntry_DoNotUse::MergeFrom(const BridgeCallRequest_VariablesEntry_DoNotUse& other) {
-  MergeFromInternal(other);
-}
-::PROTOBUF_NAMESPACE_ID::Metadata BridgeCallRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata BridgeCallResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[17]);
+      file_level_metadata_fs_2eproto[28]);
 }
 
 // ===================================================================
 
-class BridgeCallRequest::_Internal {
+class HoldRequest::_Internal {
  public:
 };
 
-BridgeCallRequest::BridgeCallRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+HoldRequest::HoldRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  if (arena != nullptr && !is_message_owned) {
-    arena->OwnCustomDestructor(this, &BridgeCallRequest::ArenaDtor);
-  }
-  // @@protoc_insertion_point(arena_constructor:fs.BridgeCallRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.HoldRequest)
 }
-BridgeCallRequest::BridgeCallRequest(const BridgeCallRequest& from)
+HoldRequest::HoldRequest(const HoldRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  BridgeCallRequest* const _this = this; (void)_this;
+  HoldRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{}
-    , decltype(_impl_.leg_a_id_){}
-    , decltype(_impl_.leg_b_id_){}
+      decltype(_impl_.id_){from._impl_.id_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  _impl_.leg_a_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.leg_a_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_leg_a_id().empty()) {
-    _this->_impl_.leg_a_id_.Set(from._internal_leg_a_id(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.leg_b_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.leg_b_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_leg_b_id().empty()) {
-    _this->_impl_.leg_b_id_.Set(from._internal_leg_b_id(), 
-      _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:fs.BridgeCallRequest)
+  // @@protoc_insertion_point(copy_constructor:fs.HoldRequest)
 }
 
-inline void BridgeCallRequest::SharedCtor(
+inline void HoldRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
-    , decltype(_impl_.leg_a_id_){}
-    , decltype(_impl_.leg_b_id_){}
+      decltype(_impl_.id_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.leg_a_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.leg_a_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.leg_b_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.leg_b_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-BridgeCallRequest::~BridgeCallRequest() {
-  // @@protoc_insertion_point(destructor:fs.BridgeCallRequest)
+HoldRequest::~HoldRequest() {
+  // @@protoc_insertion_point(destructor:fs.HoldRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
-    ArenaDtor(this);
     return;
   }
   SharedDtor();
 }
 
-inline void BridgeCallRequest::SharedDtor() {
+inline void HoldRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.variables_.Destruct();
-  _impl_.variables_.~MapField();
-  _impl_.leg_a_id_.Destroy();
-  _impl_.leg_b_id_.Destroy();
+  _impl_.id_.~RepeatedPtrField();
 }
 
-void BridgeCallRequest::ArenaDtor(void* object) {
-  BridgeCallRequest* _this = reinterpret_cast< BridgeCallRequest* >(object);
-  _this->_impl_.variables_.Destruct();
-}
-void BridgeCallRequest::SetCachedSize(int size) const {
+void HoldRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void BridgeCallRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.BridgeCallRequest)
+void HoldRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.HoldRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.variables_.Clear();
-  _impl_.leg_a_id_.ClearToEmpty();
-  _impl_.leg_b_id_.ClearToEmpty();
+  _impl_.id_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BridgeCallRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* HoldRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string leg_a_id = 1;
+      // repeated string id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_leg_a_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BridgeCallRequest.leg_a_id"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string leg_b_id = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_leg_b_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BridgeCallRequest.leg_b_id"));
-        } else
-          goto handle_unusual;
-        continue;
-      // map<string, string> variables = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
+            auto str = _internal_add_id();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "fs.HoldRequest.id"));
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -4581,219 +10189,126 @@ failure:
 #undef CHK_
 }
 
-uint8_t* BridgeCallRequest::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.BridgeCallRequest)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string leg_a_id = 1;
-  if (!this->_internal_leg_a_id().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_leg_a_id().data(), static_cast<int>(this->_internal_leg_a_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BridgeCallRequest.leg_a_id");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_leg_a_id(), target);
-  }
-
-  // string leg_b_id = 2;
-  if (!this->_internal_leg_b_id().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_leg_b_id().data(), static_cast<int>(this->_internal_leg_b_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BridgeCallRequest.leg_b_id");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_leg_b_id(), target);
-  }
-
-  // map<string, string> variables = 3;
-  if (!this->_internal_variables().empty()) {
-    using MapType = ::_pb::Map<std::string, std::string>;
-    using WireHelper = BridgeCallRequest_VariablesEntry_DoNotUse::Funcs;
-    const auto& map_field = this->_internal_variables();
-    auto check_utf8 = [](const MapType::value_type& entry) {
-      (void)entry;
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.first.data(), static_cast<int>(entry.first.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.BridgeCallRequest.VariablesEntry.key");
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.second.data(), static_cast<int>(entry.second.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.BridgeCallRequest.VariablesEntry.value");
-    };
+uint8_t* HoldRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.HoldRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
-      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
-        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    } else {
-      for (const auto& entry : map_field) {
-        target = WireHelper::InternalSerialize(3, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    }
+  // repeated string id = 1;
+  for (int i = 0, n = this->_internal_id_size(); i < n; i++) {
+    const auto& s = this->_internal_id(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.HoldRequest.id");
+    target = stream->WriteString(1, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.BridgeCallRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.HoldRequest)
   return target;
 }
 
-size_t BridgeCallRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.BridgeCallRequest)
+size_t HoldRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.HoldRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // map<string, string> variables = 3;
+  // repeated string id = 1;
   total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
-      it = this->_internal_variables().begin();
-      it != this->_internal_variables().end(); ++it) {
-    total_size += BridgeCallRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
-  }
-
-  // string leg_a_id = 1;
-  if (!this->_internal_leg_a_id().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_leg_a_id());
-  }
-
-  // string leg_b_id = 2;
-  if (!this->_internal_leg_b_id().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_leg_b_id());
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.id_.size());
+  for (int i = 0, n = _impl_.id_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.id_.Get(i));
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BridgeCallRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HoldRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    BridgeCallRequest::MergeImpl
+    HoldRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BridgeCallRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HoldRequest::GetClassData() const { return &_class_data_; }
 
 
-void BridgeCallRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<BridgeCallRequest*>(&to_msg);
-  auto& from = static_cast<const BridgeCallRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BridgeCallRequest)
+void HoldRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HoldRequest*>(&to_msg);
+  auto& from = static_cast<const HoldRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HoldRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  if (!from._internal_leg_a_id().empty()) {
-    _this->_internal_set_leg_a_id(from._internal_leg_a_id());
-  }
-  if (!from._internal_leg_b_id().empty()) {
-    _this->_internal_set_leg_b_id(from._internal_leg_b_id());
-  }
+  _this->_impl_.id_.MergeFrom(from._impl_.id_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BridgeCallRequest::CopyFrom(const BridgeCallRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.BridgeCallRequest)
+void HoldRequest::CopyFrom(const HoldRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.HoldRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BridgeCallRequest::IsInitialized() const {
+bool HoldRequest::IsInitialized() const {
   return true;
 }
 
-void BridgeCallRequest::InternalSwap(BridgeCallRequest* other) {
+void HoldRequest::InternalSwap(HoldRequest* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.leg_a_id_, lhs_arena,
-      &other->_impl_.leg_a_id_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.leg_b_id_, lhs_arena,
-      &other->_impl_.leg_b_id_, rhs_arena
-  );
+  _impl_.id_.InternalSwap(&other->_impl_.id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BridgeCallRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata HoldRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[18]);
+      file_level_metadata_fs_2eproto[29]);
 }
 
 // ===================================================================
 
-class BridgeCallResponse::_Internal {
+class HoldResponse::_Internal {
  public:
-  static const ::fs::ErrorExecute& error(const BridgeCallResponse* msg);
 };
 
-const ::fs::ErrorExecute&
-BridgeCallResponse::_Internal::error(const BridgeCallResponse* msg) {
-  return *msg->_impl_.error_;
-}
-BridgeCallResponse::BridgeCallResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+HoldResponse::HoldResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.BridgeCallResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.HoldResponse)
 }
-BridgeCallResponse::BridgeCallResponse(const BridgeCallResponse& from)
+HoldResponse::HoldResponse(const HoldResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  BridgeCallResponse* const _this = this; (void)_this;
+  HoldResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.uuid_){}
-    , decltype(_impl_.error_){nullptr}
+      decltype(_impl_.id_){from._impl_.id_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.uuid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.uuid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_uuid().empty()) {
-    _this->_impl_.uuid_.Set(from._internal_uuid(), 
-      _this->GetArenaForAllocation());
-  }
-  if (from._internal_has_error()) {
-    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
-  }
-  // @@protoc_insertion_point(copy_constructor:fs.BridgeCallResponse)
+  // @@protoc_insertion_point(copy_constructor:fs.HoldResponse)
 }
 
-inline void BridgeCallResponse::SharedCtor(
+inline void HoldResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.uuid_){}
-    , decltype(_impl_.error_){nullptr}
+      decltype(_impl_.id_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.uuid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.uuid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-BridgeCallResponse::~BridgeCallResponse() {
-  // @@protoc_insertion_point(destructor:fs.BridgeCallResponse)
+HoldResponse::~HoldResponse() {
+  // @@protoc_insertion_point(destructor:fs.HoldResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4801,51 +10316,43 @@ BridgeCallResponse::~BridgeCallResponse() {
   SharedDtor();
 }
 
-inline void BridgeCallResponse::SharedDtor() {
+inline void HoldResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.uuid_.Destroy();
-  if (this != internal_default_instance()) delete _impl_.error_;
+  _impl_.id_.~RepeatedPtrField();
 }
 
-void BridgeCallResponse::SetCachedSize(int size) const {
+void HoldResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void BridgeCallResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.BridgeCallResponse)
+void HoldResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.HoldResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.uuid_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
-    delete _impl_.error_;
-  }
-  _impl_.error_ = nullptr;
+  _impl_.id_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* BridgeCallResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* HoldResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string uuid = 1;
+      // repeated string id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_uuid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.BridgeCallResponse.uuid"));
-        } else
-          goto handle_unusual;
-        continue;
-      // .fs.ErrorExecute error = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_id();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "fs.HoldResponse.id"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -4872,140 +10379,115 @@ failure:
 #undef CHK_
 }
 
-uint8_t* BridgeCallResponse::_InternalSerialize(
+uint8_t* HoldResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.BridgeCallResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.HoldResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string uuid = 1;
-  if (!this->_internal_uuid().empty()) {
+  // repeated string id = 1;
+  for (int i = 0, n = this->_internal_id_size(); i < n; i++) {
+    const auto& s = this->_internal_id(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.BridgeCallResponse.uuid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_uuid(), target);
-  }
-
-  // .fs.ErrorExecute error = 2;
-  if (this->_internal_has_error()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::error(this),
-        _Internal::error(this).GetCachedSize(), target, stream);
+      "fs.HoldResponse.id");
+    target = stream->WriteString(1, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.BridgeCallResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.HoldResponse)
   return target;
 }
 
-size_t BridgeCallResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.BridgeCallResponse)
+size_t HoldResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.HoldResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string uuid = 1;
-  if (!this->_internal_uuid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_uuid());
-  }
-
-  // .fs.ErrorExecute error = 2;
-  if (this->_internal_has_error()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.error_);
+  // repeated string id = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.id_.size());
+  for (int i = 0, n = _impl_.id_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.id_.Get(i));
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BridgeCallResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HoldResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    BridgeCallResponse::MergeImpl
+    HoldResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BridgeCallResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HoldResponse::GetClassData() const { return &_class_data_; }
 
 
-void BridgeCallResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<BridgeCallResponse*>(&to_msg);
-  auto& from = static_cast<const BridgeCallResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.BridgeCallResponse)
+void HoldResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HoldResponse*>(&to_msg);
+  auto& from = static_cast<const HoldResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HoldResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_uuid().empty()) {
-    _this->_internal_set_uuid(from._internal_uuid());
-  }
-  if (from._internal_has_error()) {
-    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
-        from._internal_error());
-  }
+  (void) cached_has_bits;
+
+  _this->_impl_.id_.MergeFrom(from._impl_.id_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void BridgeCallResponse::CopyFrom(const BridgeCallResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.BridgeCallResponse)
+void HoldResponse::CopyFrom(const HoldResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.HoldResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool BridgeCallResponse::IsInitialized() const {
+bool HoldResponse::IsInitialized() const {
   return true;
 }
 
-void BridgeCallResponse::InternalSwap(BridgeCallResponse* other) {
+void HoldResponse::InternalSwap(HoldResponse* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.uuid_, lhs_arena,
-      &other->_impl_.uuid_, rhs_arena
-  );
-  swap(_impl_.error_, other->_impl_.error_);
+  _impl_.id_.InternalSwap(&other->_impl_.id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata BridgeCallResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata HoldResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[19]);
+      file_level_metadata_fs_2eproto[30]);
 }
 
 // ===================================================================
 
-class HoldRequest::_Internal {
+class UnHoldRequest::_Internal {
  public:
 };
 
-HoldRequest::HoldRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+UnHoldRequest::UnHoldRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.HoldRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.UnHoldRequest)
 }
-HoldRequest::HoldRequest(const HoldRequest& from)
+UnHoldRequest::UnHoldRequest(const UnHoldRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  HoldRequest* const _this = this; (void)_this;
+  UnHoldRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.id_){from._impl_.id_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:fs.HoldRequest)
+  // @@protoc_insertion_point(copy_constructor:fs.UnHoldRequest)
 }
 
-inline void HoldRequest::SharedCtor(
+inline void UnHoldRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -5015,8 +10497,8 @@ inline void HoldRequest::SharedCtor(
   };
 }
 
-HoldRequest::~HoldRequest() {
-  // @@protoc_insertion_point(destructor:fs.HoldRequest)
+UnHoldRequest::~UnHoldRequest() {
+  // @@protoc_insertion_point(destructor:fs.UnHoldRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5024,17 +10506,17 @@ HoldRequest::~HoldRequest() {
   SharedDtor();
 }
 
-inline void HoldRequest::SharedDtor() {
+inline void UnHoldRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.id_.~RepeatedPtrField();
 }
 
-void HoldRequest::SetCachedSize(int size) const {
+void UnHoldRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void HoldRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.HoldRequest)
+void UnHoldRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.UnHoldRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -5043,7 +10525,7 @@ void HoldRequest::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* HoldRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* UnHoldRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -5058,7 +10540,7 @@ const char* HoldRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* c
             auto str = _internal_add_id();
             ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "fs.HoldRequest.id"));
+            CHK_(::_pbi::VerifyUTF8(str, "fs.UnHoldRequest.id"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
@@ -5087,9 +10569,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* HoldRequest::_InternalSerialize(
+uint8_t* UnHoldRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.HoldRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.UnHoldRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -5099,7 +10581,7 @@ uint8_t* HoldRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.HoldRequest.id");
+      "fs.UnHoldRequest.id");
     target = stream->WriteString(1, s, target);
   }
 
@@ -5107,12 +10589,12 @@ uint8_t* HoldRequest::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.HoldRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.UnHoldRequest)
   return target;
 }
 
-size_t HoldRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.HoldRequest)
+size_t UnHoldRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.UnHoldRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -5130,17 +10612,17 @@ size_t HoldRequest::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HoldRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnHoldRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    HoldRequest::MergeImpl
+    UnHoldRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HoldRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnHoldRequest::GetClassData() const { return &_class_data_; }
 
 
-void HoldRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<HoldRequest*>(&to_msg);
-  auto& from = static_cast<const HoldRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HoldRequest)
+void UnHoldRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnHoldRequest*>(&to_msg);
+  auto& from = static_cast<const UnHoldRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.UnHoldRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -5149,53 +10631,53 @@ void HoldRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PR
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void HoldRequest::CopyFrom(const HoldRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.HoldRequest)
+void UnHoldRequest::CopyFrom(const UnHoldRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.UnHoldRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool HoldRequest::IsInitialized() const {
+bool UnHoldRequest::IsInitialized() const {
   return true;
 }
 
-void HoldRequest::InternalSwap(HoldRequest* other) {
+void UnHoldRequest::InternalSwap(UnHoldRequest* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.id_.InternalSwap(&other->_impl_.id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata HoldRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata UnHoldRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[20]);
+      file_level_metadata_fs_2eproto[31]);
 }
 
 // ===================================================================
 
-class HoldResponse::_Internal {
+class UnHoldResponse::_Internal {
  public:
 };
 
-HoldResponse::HoldResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+UnHoldResponse::UnHoldResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.HoldResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.UnHoldResponse)
 }
-HoldResponse::HoldResponse(const HoldResponse& from)
+UnHoldResponse::UnHoldResponse(const UnHoldResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  HoldResponse* const _this = this; (void)_this;
+  UnHoldResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.id_){from._impl_.id_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:fs.HoldResponse)
+  // @@protoc_insertion_point(copy_constructor:fs.UnHoldResponse)
 }
 
-inline void HoldResponse::SharedCtor(
+inline void UnHoldResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -5205,8 +10687,8 @@ inline void HoldResponse::SharedCtor(
   };
 }
 
-HoldResponse::~HoldResponse() {
-  // @@protoc_insertion_point(destructor:fs.HoldResponse)
+UnHoldResponse::~UnHoldResponse() {
+  // @@protoc_insertion_point(destructor:fs.UnHoldResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5214,17 +10696,17 @@ HoldResponse::~HoldResponse() {
   SharedDtor();
 }
 
-inline void HoldResponse::SharedDtor() {
+inline void UnHoldResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.id_.~RepeatedPtrField();
 }
 
-void HoldResponse::SetCachedSize(int size) const {
+void UnHoldResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void HoldResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.HoldResponse)
+void UnHoldResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.UnHoldResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -5233,7 +10715,7 @@ void HoldResponse::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* HoldResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* UnHoldResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -5248,7 +10730,7 @@ const char* HoldResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext*
             auto str = _internal_add_id();
             ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "fs.HoldResponse.id"));
+            CHK_(::_pbi::VerifyUTF8(str, "fs.UnHoldResponse.id"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
@@ -5277,9 +10759,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* HoldResponse::_InternalSerialize(
+uint8_t* UnHoldResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.HoldResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.UnHoldResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -5289,7 +10771,7 @@ uint8_t* HoldResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.HoldResponse.id");
+      "fs.UnHoldResponse.id");
     target = stream->WriteString(1, s, target);
   }
 
@@ -5297,12 +10779,12 @@ uint8_t* HoldResponse::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.HoldResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.UnHoldResponse)
   return target;
 }
 
-size_t HoldResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.HoldResponse)
+size_t UnHoldResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.UnHoldResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -5320,17 +10802,17 @@ size_t HoldResponse::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HoldResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnHoldResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    HoldResponse::MergeImpl
+    UnHoldResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HoldResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnHoldResponse::GetClassData() const { return &_class_data_; }
 
 
-void HoldResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<HoldResponse*>(&to_msg);
-  auto& from = static_cast<const HoldResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HoldResponse)
+void UnHoldResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UnHoldResponse*>(&to_msg);
+  auto& from = static_cast<const UnHoldResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.UnHoldResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -5339,64 +10821,78 @@ void HoldResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void HoldResponse::CopyFrom(const HoldResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.HoldResponse)
+void UnHoldResponse::CopyFrom(const UnHoldResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.UnHoldResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool HoldResponse::IsInitialized() const {
+bool UnHoldResponse::IsInitialized() const {
   return true;
 }
 
-void HoldResponse::InternalSwap(HoldResponse* other) {
+void UnHoldResponse::InternalSwap(UnHoldResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.id_.InternalSwap(&other->_impl_.id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata HoldResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata UnHoldResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[21]);
+      file_level_metadata_fs_2eproto[32]);
 }
 
 // ===================================================================
 
-class UnHoldRequest::_Internal {
+class HangupManyRequest::_Internal {
  public:
 };
 
-UnHoldRequest::UnHoldRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+HangupManyRequest::HangupManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.UnHoldRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.HangupManyRequest)
 }
-UnHoldRequest::UnHoldRequest(const UnHoldRequest& from)
+HangupManyRequest::HangupManyRequest(const HangupManyRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  UnHoldRequest* const _this = this; (void)_this;
+  HangupManyRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.id_){from._impl_.id_}
+    , decltype(_impl_.cause_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:fs.UnHoldRequest)
+  _impl_.cause_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cause_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_cause().empty()) {
+    _this->_impl_.cause_.Set(from._internal_cause(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.HangupManyRequest)
 }
 
-inline void UnHoldRequest::SharedCtor(
+inline void HangupManyRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
       decltype(_impl_.id_){arena}
+    , decltype(_impl_.cause_){}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.cause_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.cause_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-UnHoldRequest::~UnHoldRequest() {
-  // @@protoc_insertion_point(destructor:fs.UnHoldRequest)
+HangupManyRequest::~HangupManyRequest() {
+  // @@protoc_insertion_point(destructor:fs.HangupManyRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5404,26 +10900,28 @@ UnHoldRequest::~UnHoldRequest() {
   SharedDtor();
 }
 
-inline void UnHoldRequest::SharedDtor() {
+inline void HangupManyRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.id_.~RepeatedPtrField();
+  _impl_.cause_.Destroy();
 }
 
-void UnHoldRequest::SetCachedSize(int size) const {
+void HangupManyRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void UnHoldRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.UnHoldRequest)
+void HangupManyRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.HangupManyRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.id_.Clear();
+  _impl_.cause_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* UnHoldRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* HangupManyRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -5438,12 +10936,22 @@ const char* UnHoldRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext*
             auto str = _internal_add_id();
             ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "fs.UnHoldRequest.id"));
+            CHK_(::_pbi::VerifyUTF8(str, "fs.HangupManyRequest.id"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
+      // string cause = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_cause();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.HangupManyRequest.cause"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -5467,9 +10975,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* UnHoldRequest::_InternalSerialize(
+uint8_t* HangupManyRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.UnHoldRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.HangupManyRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -5479,20 +10987,30 @@ uint8_t* UnHoldRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.UnHoldRequest.id");
+      "fs.HangupManyRequest.id");
     target = stream->WriteString(1, s, target);
   }
 
+  // string cause = 2;
+  if (!this->_internal_cause().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_cause().data(), static_cast<int>(this->_internal_cause().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.HangupManyRequest.cause");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_cause(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.UnHoldRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.HangupManyRequest)
   return target;
 }
 
-size_t UnHoldRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.UnHoldRequest)
+size_t HangupManyRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.HangupManyRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -5507,75 +11025,91 @@ size_t UnHoldRequest::ByteSizeLong() const {
       _impl_.id_.Get(i));
   }
 
+  // string cause = 2;
+  if (!this->_internal_cause().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_cause());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnHoldRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HangupManyRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    UnHoldRequest::MergeImpl
+    HangupManyRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnHoldRequest::GetClassData() const { return &_class_data_; }
-
-
-void UnHoldRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<UnHoldRequest*>(&to_msg);
-  auto& from = static_cast<const UnHoldRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.UnHoldRequest)
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HangupManyRequest::GetClassData() const { return &_class_data_; }
+
+
+void HangupManyRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HangupManyRequest*>(&to_msg);
+  auto& from = static_cast<const HangupManyRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HangupManyRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   _this->_impl_.id_.MergeFrom(from._impl_.id_);
+  if (!from._internal_cause().empty()) {
+    _this->_internal_set_cause(from._internal_cause());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UnHoldRequest::CopyFrom(const UnHoldRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.UnHoldRequest)
+void HangupManyRequest::CopyFrom(const HangupManyRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.HangupManyRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UnHoldRequest::IsInitialized() const {
+bool HangupManyRequest::IsInitialized() const {
   return true;
 }
 
-void UnHoldRequest::InternalSwap(UnHoldRequest* other) {
+void HangupManyRequest::InternalSwap(HangupManyRequest* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.id_.InternalSwap(&other->_impl_.id_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.cause_, lhs_arena,
+      &other->_impl_.cause_, rhs_arena
+  );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata UnHoldRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata HangupManyRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[22]);
+      file_level_metadata_fs_2eproto[33]);
 }
 
 // ===================================================================
 
-class UnHoldResponse::_Internal {
+class HangupManyResponse::_Internal {
  public:
 };
 
-UnHoldResponse::UnHoldResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+HangupManyResponse::HangupManyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.UnHoldResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.HangupManyResponse)
 }
-UnHoldResponse::UnHoldResponse(const UnHoldResponse& from)
+HangupManyResponse::HangupManyResponse(const HangupManyResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  UnHoldResponse* const _this = this; (void)_this;
+  HangupManyResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_.id_){from._impl_.id_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:fs.UnHoldResponse)
+  // @@protoc_insertion_point(copy_constructor:fs.HangupManyResponse)
 }
 
-inline void UnHoldResponse::SharedCtor(
+inline void HangupManyResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -5585,8 +11119,8 @@ inline void UnHoldResponse::SharedCtor(
   };
 }
 
-UnHoldResponse::~UnHoldResponse() {
-  // @@protoc_insertion_point(destructor:fs.UnHoldResponse)
+HangupManyResponse::~HangupManyResponse() {
+  // @@protoc_insertion_point(destructor:fs.HangupManyResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5594,17 +11128,17 @@ UnHoldResponse::~UnHoldResponse() {
   SharedDtor();
 }
 
-inline void UnHoldResponse::SharedDtor() {
+inline void HangupManyResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.id_.~RepeatedPtrField();
 }
 
-void UnHoldResponse::SetCachedSize(int size) const {
+void HangupManyResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void UnHoldResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.UnHoldResponse)
+void HangupManyResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.HangupManyResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -5613,7 +11147,7 @@ void UnHoldResponse::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* UnHoldResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* HangupManyResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -5628,7 +11162,7 @@ const char* UnHoldResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext
             auto str = _internal_add_id();
             ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
             CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "fs.UnHoldResponse.id"));
+            CHK_(::_pbi::VerifyUTF8(str, "fs.HangupManyResponse.id"));
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
@@ -5657,9 +11191,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* UnHoldResponse::_InternalSerialize(
+uint8_t* HangupManyResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.UnHoldResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.HangupManyResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -5669,7 +11203,7 @@ uint8_t* UnHoldResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.UnHoldResponse.id");
+      "fs.HangupManyResponse.id");
     target = stream->WriteString(1, s, target);
   }
 
@@ -5677,12 +11211,12 @@ uint8_t* UnHoldResponse::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.UnHoldResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.HangupManyResponse)
   return target;
 }
 
-size_t UnHoldResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.UnHoldResponse)
+size_t HangupManyResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.HangupManyResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -5700,17 +11234,17 @@ size_t UnHoldResponse::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UnHoldResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HangupManyResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    UnHoldResponse::MergeImpl
+    HangupManyResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UnHoldResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HangupManyResponse::GetClassData() const { return &_class_data_; }
 
 
-void UnHoldResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<UnHoldResponse*>(&to_msg);
-  auto& from = static_cast<const UnHoldResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.UnHoldResponse)
+void HangupManyResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HangupManyResponse*>(&to_msg);
+  auto& from = static_cast<const HangupManyResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HangupManyResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -5719,134 +11253,194 @@ void UnHoldResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const :
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void UnHoldResponse::CopyFrom(const UnHoldResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.UnHoldResponse)
+void HangupManyResponse::CopyFrom(const HangupManyResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.HangupManyResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool UnHoldResponse::IsInitialized() const {
+bool HangupManyResponse::IsInitialized() const {
   return true;
 }
 
-void UnHoldResponse::InternalSwap(UnHoldResponse* other) {
+void HangupManyResponse::InternalSwap(HangupManyResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   _impl_.id_.InternalSwap(&other->_impl_.id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata UnHoldResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata HangupManyResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[23]);
+      file_level_metadata_fs_2eproto[34]);
 }
 
 // ===================================================================
 
-class HangupManyRequest::_Internal {
+QueueRequest_VariablesEntry_DoNotUse::QueueRequest_VariablesEntry_DoNotUse() {}
+QueueRequest_VariablesEntry_DoNotUse::QueueRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void QueueRequest_VariablesEntry_DoNotUse::MergeFrom(const QueueRequest_VariablesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata QueueRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[35]);
+}
+
+// ===================================================================
+
+class QueueRequest::_Internal {
  public:
 };
 
-HangupManyRequest::HangupManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+QueueRequest::QueueRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.HangupManyRequest)
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &QueueRequest::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:fs.QueueRequest)
 }
-HangupManyRequest::HangupManyRequest(const HangupManyRequest& from)
+QueueRequest::QueueRequest(const QueueRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  HangupManyRequest* const _this = this; (void)_this;
+  QueueRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){from._impl_.id_}
-    , decltype(_impl_.cause_){}
+      /*decltype(_impl_.variables_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.playback_file_){}
+    , decltype(_impl_.playback_args_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.cause_.InitDefault();
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  _impl_.id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.cause_.Set("", GetArenaForAllocation());
+    _impl_.id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cause().empty()) {
-    _this->_impl_.cause_.Set(from._internal_cause(), 
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.HangupManyRequest)
+  _impl_.playback_file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.playback_file_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_playback_file().empty()) {
+    _this->_impl_.playback_file_.Set(from._internal_playback_file(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.playback_args_ = from._impl_.playback_args_;
+  // @@protoc_insertion_point(copy_constructor:fs.QueueRequest)
 }
 
-inline void HangupManyRequest::SharedCtor(
+inline void QueueRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){arena}
-    , decltype(_impl_.cause_){}
+      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.playback_file_){}
+    , decltype(_impl_.playback_args_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.cause_.InitDefault();
+  _impl_.id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.cause_.Set("", GetArenaForAllocation());
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.playback_file_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.playback_file_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-HangupManyRequest::~HangupManyRequest() {
-  // @@protoc_insertion_point(destructor:fs.HangupManyRequest)
+QueueRequest::~QueueRequest() {
+  // @@protoc_insertion_point(destructor:fs.QueueRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
+    ArenaDtor(this);
     return;
   }
   SharedDtor();
 }
 
-inline void HangupManyRequest::SharedDtor() {
+inline void QueueRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.id_.~RepeatedPtrField();
-  _impl_.cause_.Destroy();
+  _impl_.variables_.Destruct();
+  _impl_.variables_.~MapField();
+  _impl_.id_.Destroy();
+  _impl_.playback_file_.Destroy();
 }
 
-void HangupManyRequest::SetCachedSize(int size) const {
+void QueueRequest::ArenaDtor(void* object) {
+  QueueRequest* _this = reinterpret_cast< QueueRequest* >(object);
+  _this->_impl_.variables_.Destruct();
+}
+void QueueRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void HangupManyRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.HangupManyRequest)
+void QueueRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.QueueRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.id_.Clear();
-  _impl_.cause_.ClearToEmpty();
+  _impl_.variables_.Clear();
+  _impl_.id_.ClearToEmpty();
+  _impl_.playback_file_.ClearToEmpty();
+  _impl_.playback_args_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* HangupManyRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* QueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated string id = 1;
+      // string id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.QueueRequest.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> variables = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
-            auto str = _internal_add_id();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
             CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "fs.HangupManyRequest.id"));
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // string cause = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cause();
+      // string playback_file = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_playback_file();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.HangupManyRequest.cause"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.QueueRequest.playback_file"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 playback_args = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.playback_args_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -5873,152 +11467,220 @@ failure:
 #undef CHK_
 }
 
-uint8_t* HangupManyRequest::_InternalSerialize(
+uint8_t* QueueRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.HangupManyRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.QueueRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated string id = 1;
-  for (int i = 0, n = this->_internal_id_size(); i < n; i++) {
-    const auto& s = this->_internal_id(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.HangupManyRequest.id");
-    target = stream->WriteString(1, s, target);
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.QueueRequest.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // map<string, string> variables = 2;
+  if (!this->_internal_variables().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = QueueRequest_VariablesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_variables();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.QueueRequest.VariablesEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.QueueRequest.VariablesEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
   }
 
-  // string cause = 2;
-  if (!this->_internal_cause().empty()) {
+  // string playback_file = 3;
+  if (!this->_internal_playback_file().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cause().data(), static_cast<int>(this->_internal_cause().length()),
+      this->_internal_playback_file().data(), static_cast<int>(this->_internal_playback_file().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.HangupManyRequest.cause");
+      "fs.QueueRequest.playback_file");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cause(), target);
+        3, this->_internal_playback_file(), target);
+  }
+
+  // int32 playback_args = 4;
+  if (this->_internal_playback_args() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_playback_args(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.HangupManyRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.QueueRequest)
   return target;
 }
 
-size_t HangupManyRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.HangupManyRequest)
+size_t QueueRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.QueueRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated string id = 1;
+  // map<string, string> variables = 2;
   total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.id_.size());
-  for (int i = 0, n = _impl_.id_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      _impl_.id_.Get(i));
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_variables().begin();
+      it != this->_internal_variables().end(); ++it) {
+    total_size += QueueRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
   }
 
-  // string cause = 2;
-  if (!this->_internal_cause().empty()) {
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cause());
+        this->_internal_id());
+  }
+
+  // string playback_file = 3;
+  if (!this->_internal_playback_file().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_playback_file());
+  }
+
+  // int32 playback_args = 4;
+  if (this->_internal_playback_args() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_playback_args());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HangupManyRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueueRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    HangupManyRequest::MergeImpl
+    QueueRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HangupManyRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueueRequest::GetClassData() const { return &_class_data_; }
 
 
-void HangupManyRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<HangupManyRequest*>(&to_msg);
-  auto& from = static_cast<const HangupManyRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HangupManyRequest)
+void QueueRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QueueRequest*>(&to_msg);
+  auto& from = static_cast<const QueueRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.QueueRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.id_.MergeFrom(from._impl_.id_);
-  if (!from._internal_cause().empty()) {
-    _this->_internal_set_cause(from._internal_cause());
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_playback_file().empty()) {
+    _this->_internal_set_playback_file(from._internal_playback_file());
+  }
+  if (from._internal_playback_args() != 0) {
+    _this->_internal_set_playback_args(from._internal_playback_args());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void HangupManyRequest::CopyFrom(const HangupManyRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.HangupManyRequest)
+void QueueRequest::CopyFrom(const QueueRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.QueueRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool HangupManyRequest::IsInitialized() const {
+bool QueueRequest::IsInitialized() const {
   return true;
 }
 
-void HangupManyRequest::InternalSwap(HangupManyRequest* other) {
+void QueueRequest::InternalSwap(QueueRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.id_.InternalSwap(&other->_impl_.id_);
+  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.cause_, lhs_arena,
-      &other->_impl_.cause_, rhs_arena
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.playback_file_, lhs_arena,
+      &other->_impl_.playback_file_, rhs_arena
   );
+  swap(_impl_.playback_args_, other->_impl_.playback_args_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata HangupManyRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata QueueRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[24]);
+      file_level_metadata_fs_2eproto[36]);
 }
 
 // ===================================================================
 
-class HangupManyResponse::_Internal {
+class QueueResponse::_Internal {
  public:
+  static const ::fs::ErrorExecute& error(const QueueResponse* msg);
 };
 
-HangupManyResponse::HangupManyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::fs::ErrorExecute&
+QueueResponse::_Internal::error(const QueueResponse* msg) {
+  return *msg->_impl_.error_;
+}
+QueueResponse::QueueResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.HangupManyResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.QueueResponse)
 }
-HangupManyResponse::HangupManyResponse(const HangupManyResponse& from)
+QueueResponse::QueueResponse(const QueueResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  HangupManyResponse* const _this = this; (void)_this;
+  QueueResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){from._impl_.id_}
+      decltype(_impl_.error_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:fs.HangupManyResponse)
+  if (from._internal_has_error()) {
+    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.QueueResponse)
 }
 
-inline void HangupManyResponse::SharedCtor(
+inline void QueueResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.id_){arena}
+      decltype(_impl_.error_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-HangupManyResponse::~HangupManyResponse() {
-  // @@protoc_insertion_point(destructor:fs.HangupManyResponse)
+QueueResponse::~QueueResponse() {
+  // @@protoc_insertion_point(destructor:fs.QueueResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -6026,43 +11688,39 @@ HangupManyResponse::~HangupManyResponse() {
   SharedDtor();
 }
 
-inline void HangupManyResponse::SharedDtor() {
+inline void QueueResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.id_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.error_;
 }
 
-void HangupManyResponse::SetCachedSize(int size) const {
+void QueueResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void HangupManyResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.HangupManyResponse)
+void QueueResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.QueueResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.id_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* HangupManyResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* QueueResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated string id = 1;
+      // .fs.ErrorExecute error = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_id();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "fs.HangupManyResponse.id"));
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -6089,256 +11747,189 @@ failure:
 #undef CHK_
 }
 
-uint8_t* HangupManyResponse::_InternalSerialize(
+uint8_t* QueueResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.HangupManyResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.QueueResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated string id = 1;
-  for (int i = 0, n = this->_internal_id_size(); i < n; i++) {
-    const auto& s = this->_internal_id(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.HangupManyResponse.id");
-    target = stream->WriteString(1, s, target);
+  // .fs.ErrorExecute error = 1;
+  if (this->_internal_has_error()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.HangupManyResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.QueueResponse)
   return target;
 }
 
-size_t HangupManyResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.HangupManyResponse)
+size_t QueueResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.QueueResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated string id = 1;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.id_.size());
-  for (int i = 0, n = _impl_.id_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      _impl_.id_.Get(i));
+  // .fs.ErrorExecute error = 1;
+  if (this->_internal_has_error()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.error_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HangupManyResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueueResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    HangupManyResponse::MergeImpl
+    QueueResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HangupManyResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueueResponse::GetClassData() const { return &_class_data_; }
 
 
-void HangupManyResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<HangupManyResponse*>(&to_msg);
-  auto& from = static_cast<const HangupManyResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HangupManyResponse)
+void QueueResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QueueResponse*>(&to_msg);
+  auto& from = static_cast<const QueueResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.QueueResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.id_.MergeFrom(from._impl_.id_);
+  if (from._internal_has_error()) {
+    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
+        from._internal_error());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void HangupManyResponse::CopyFrom(const HangupManyResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.HangupManyResponse)
+void QueueResponse::CopyFrom(const QueueResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.QueueResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool HangupManyResponse::IsInitialized() const {
+bool QueueResponse::IsInitialized() const {
   return true;
 }
 
-void HangupManyResponse::InternalSwap(HangupManyResponse* other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.id_.InternalSwap(&other->_impl_.id_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata HangupManyResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[25]);
-}
-
-// ===================================================================
-
-QueueRequest_VariablesEntry_DoNotUse::QueueRequest_VariablesEntry_DoNotUse() {}
-QueueRequest_VariablesEntry_DoNotUse::QueueRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void QueueRequest_VariablesEntry_DoNotUse::MergeFrom(const QueueRequest_VariablesEntry_DoNotUse& other) {
-  MergeFromInternal(other);
+void QueueResponse::InternalSwap(QueueResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.error_, other->_impl_.error_);
 }
-::PROTOBUF_NAMESPACE_ID::Metadata QueueRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+
+::PROTOBUF_NAMESPACE_ID::Metadata QueueResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[26]);
+      file_level_metadata_fs_2eproto[37]);
 }
 
 // ===================================================================
 
-class QueueRequest::_Internal {
+class ErrorExecute::_Internal {
  public:
 };
 
-QueueRequest::QueueRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ErrorExecute::ErrorExecute(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  if (arena != nullptr && !is_message_owned) {
-    arena->OwnCustomDestructor(this, &QueueRequest::ArenaDtor);
-  }
-  // @@protoc_insertion_point(arena_constructor:fs.QueueRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.ErrorExecute)
 }
-QueueRequest::QueueRequest(const QueueRequest& from)
+ErrorExecute::ErrorExecute(const ErrorExecute& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  QueueRequest* const _this = this; (void)_this;
+  ErrorExecute* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{}
-    , decltype(_impl_.id_){}
-    , decltype(_impl_.playback_file_){}
-    , decltype(_impl_.playback_args_){}
+      decltype(_impl_.message_){}
+    , decltype(_impl_.type_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  _impl_.id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_id().empty()) {
-    _this->_impl_.id_.Set(from._internal_id(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.playback_file_.InitDefault();
+  _impl_.message_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.playback_file_.Set("", GetArenaForAllocation());
+    _impl_.message_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_playback_file().empty()) {
-    _this->_impl_.playback_file_.Set(from._internal_playback_file(), 
+  if (!from._internal_message().empty()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.playback_args_ = from._impl_.playback_args_;
-  // @@protoc_insertion_point(copy_constructor:fs.QueueRequest)
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:fs.ErrorExecute)
 }
 
-inline void QueueRequest::SharedCtor(
+inline void ErrorExecute::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
-    , decltype(_impl_.id_){}
-    , decltype(_impl_.playback_file_){}
-    , decltype(_impl_.playback_args_){0}
+      decltype(_impl_.message_){}
+    , decltype(_impl_.type_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.playback_file_.InitDefault();
+  _impl_.message_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.playback_file_.Set("", GetArenaForAllocation());
+    _impl_.message_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-QueueRequest::~QueueRequest() {
-  // @@protoc_insertion_point(destructor:fs.QueueRequest)
+ErrorExecute::~ErrorExecute() {
+  // @@protoc_insertion_point(destructor:fs.ErrorExecute)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
-    ArenaDtor(this);
     return;
   }
   SharedDtor();
 }
 
-inline void QueueRequest::SharedDtor() {
+inline void ErrorExecute::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.variables_.Destruct();
-  _impl_.variables_.~MapField();
-  _impl_.id_.Destroy();
-  _impl_.playback_file_.Destroy();
+  _impl_.message_.Destroy();
 }
 
-void QueueRequest::ArenaDtor(void* object) {
-  QueueRequest* _this = reinterpret_cast< QueueRequest* >(object);
-  _this->_impl_.variables_.Destruct();
-}
-void QueueRequest::SetCachedSize(int size) const {
+void ErrorExecute::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void QueueRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.QueueRequest)
+void ErrorExecute::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.ErrorExecute)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.variables_.Clear();
-  _impl_.id_.ClearToEmpty();
-  _impl_.playback_file_.ClearToEmpty();
-  _impl_.playback_args_ = 0;
+  _impl_.message_.ClearToEmpty();
+  _impl_.type_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* QueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ErrorExecute::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string id = 1;
+      // string message = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_id();
+          auto str = _internal_mutable_message();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.QueueRequest.id"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.ErrorExecute.message"));
         } else
           goto handle_unusual;
         continue;
-      // map<string, string> variables = 2;
+      // .fs.ErrorExecute.Type type = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
-      // string playback_file = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_playback_file();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.QueueRequest.playback_file"));
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 playback_args = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.playback_args_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_type(static_cast<::fs::ErrorExecute_Type>(val));
         } else
           goto handle_unusual;
         continue;
@@ -6365,220 +11956,175 @@ failure:
 #undef CHK_
 }
 
-uint8_t* QueueRequest::_InternalSerialize(
+uint8_t* ErrorExecute::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.QueueRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.ErrorExecute)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.QueueRequest.id");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_id(), target);
-  }
-
-  // map<string, string> variables = 2;
-  if (!this->_internal_variables().empty()) {
-    using MapType = ::_pb::Map<std::string, std::string>;
-    using WireHelper = QueueRequest_VariablesEntry_DoNotUse::Funcs;
-    const auto& map_field = this->_internal_variables();
-    auto check_utf8 = [](const MapType::value_type& entry) {
-      (void)entry;
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.first.data(), static_cast<int>(entry.first.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.QueueRequest.VariablesEntry.key");
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.second.data(), static_cast<int>(entry.second.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.QueueRequest.VariablesEntry.value");
-    };
-
-    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
-      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
-        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    } else {
-      for (const auto& entry : map_field) {
-        target = WireHelper::InternalSerialize(2, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    }
-  }
-
-  // string playback_file = 3;
-  if (!this->_internal_playback_file().empty()) {
+  // string message = 1;
+  if (!this->_internal_message().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_playback_file().data(), static_cast<int>(this->_internal_playback_file().length()),
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.QueueRequest.playback_file");
+      "fs.ErrorExecute.message");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_playback_file(), target);
+        1, this->_internal_message(), target);
   }
 
-  // int32 playback_args = 4;
-  if (this->_internal_playback_args() != 0) {
+  // .fs.ErrorExecute.Type type = 2;
+  if (this->_internal_type() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_playback_args(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.QueueRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.ErrorExecute)
   return target;
 }
 
-size_t QueueRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.QueueRequest)
+size_t ErrorExecute::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.ErrorExecute)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // map<string, string> variables = 2;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
-      it = this->_internal_variables().begin();
-      it != this->_internal_variables().end(); ++it) {
-    total_size += QueueRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
-  }
-
-  // string id = 1;
-  if (!this->_internal_id().empty()) {
+  // string message = 1;
+  if (!this->_internal_message().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_id());
+        this->_internal_message());
   }
 
-  // string playback_file = 3;
-  if (!this->_internal_playback_file().empty()) {
+  // .fs.ErrorExecute.Type type = 2;
+  if (this->_internal_type() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_playback_file());
-  }
-
-  // int32 playback_args = 4;
-  if (this->_internal_playback_args() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_playback_args());
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueueRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ErrorExecute::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    QueueRequest::MergeImpl
+    ErrorExecute::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueueRequest::GetClassData() const { return &_class_data_; }
-
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ErrorExecute::GetClassData() const { return &_class_data_; }
 
-void QueueRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<QueueRequest*>(&to_msg);
-  auto& from = static_cast<const QueueRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.QueueRequest)
-  GOOGLE_DCHECK_NE(&from, _this);
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
 
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  if (!from._internal_id().empty()) {
-    _this->_internal_set_id(from._internal_id());
-  }
-  if (!from._internal_playback_file().empty()) {
-    _this->_internal_set_playback_file(from._internal_playback_file());
+void ErrorExecute::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ErrorExecute*>(&to_msg);
+  auto& from = static_cast<const ErrorExecute&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.ErrorExecute)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
   }
-  if (from._internal_playback_args() != 0) {
-    _this->_internal_set_playback_args(from._internal_playback_args());
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void QueueRequest::CopyFrom(const QueueRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.QueueRequest)
+void ErrorExecute::CopyFrom(const ErrorExecute& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.ErrorExecute)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool QueueRequest::IsInitialized() const {
+bool ErrorExecute::IsInitialized() const {
   return true;
 }
 
-void QueueRequest::InternalSwap(QueueRequest* other) {
+void ErrorExecute::InternalSwap(ErrorExecute* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.id_, lhs_arena,
-      &other->_impl_.id_, rhs_arena
-  );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.playback_file_, lhs_arena,
-      &other->_impl_.playback_file_, rhs_arena
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
   );
-  swap(_impl_.playback_args_, other->_impl_.playback_args_);
+  swap(_impl_.type_, other->_impl_.type_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata QueueRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ErrorExecute::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[27]);
+      file_level_metadata_fs_2eproto[38]);
 }
 
 // ===================================================================
 
-class QueueResponse::_Internal {
+class ExecuteRequest::_Internal {
  public:
-  static const ::fs::ErrorExecute& error(const QueueResponse* msg);
 };
 
-const ::fs::ErrorExecute&
-QueueResponse::_Internal::error(const QueueResponse* msg) {
-  return *msg->_impl_.error_;
-}
-QueueResponse::QueueResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+ExecuteRequest::ExecuteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.QueueResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.ExecuteRequest)
 }
-QueueResponse::QueueResponse(const QueueResponse& from)
+ExecuteRequest::ExecuteRequest(const ExecuteRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  QueueResponse* const _this = this; (void)_this;
+  ExecuteRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.error_){nullptr}
+      decltype(_impl_.command_){}
+    , decltype(_impl_.args_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_error()) {
-    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_command().empty()) {
+    _this->_impl_.command_.Set(from._internal_command(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.QueueResponse)
+  _impl_.args_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.args_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_args().empty()) {
+    _this->_impl_.args_.Set(from._internal_args(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.ExecuteRequest)
 }
 
-inline void QueueResponse::SharedCtor(
+inline void ExecuteRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.error_){nullptr}
+      decltype(_impl_.command_){}
+    , decltype(_impl_.args_){}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.command_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.command_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.args_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.args_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-QueueResponse::~QueueResponse() {
-  // @@protoc_insertion_point(destructor:fs.QueueResponse)
+ExecuteRequest::~ExecuteRequest() {
+  // @@protoc_insertion_point(destructor:fs.ExecuteRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -6586,39 +12132,50 @@ QueueResponse::~QueueResponse() {
   SharedDtor();
 }
 
-inline void QueueResponse::SharedDtor() {
+inline void ExecuteRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.error_;
+  _impl_.command_.Destroy();
+  _impl_.args_.Destroy();
 }
 
-void QueueResponse::SetCachedSize(int size) const {
+void ExecuteRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void QueueResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.QueueResponse)
+void ExecuteRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.ExecuteRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
-    delete _impl_.error_;
-  }
-  _impl_.error_ = nullptr;
+  _impl_.command_.ClearToEmpty();
+  _impl_.args_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* QueueResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ExecuteRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .fs.ErrorExecute error = 1;
+      // string command = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          auto str = _internal_mutable_command();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.ExecuteRequest.command"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string args = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_args();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.ExecuteRequest.args"));
         } else
           goto handle_unusual;
         continue;
@@ -6645,140 +12202,178 @@ failure:
 #undef CHK_
 }
 
-uint8_t* QueueResponse::_InternalSerialize(
+uint8_t* ExecuteRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.QueueResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.ExecuteRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .fs.ErrorExecute error = 1;
-  if (this->_internal_has_error()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::error(this),
-        _Internal::error(this).GetCachedSize(), target, stream);
+  // string command = 1;
+  if (!this->_internal_command().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_command().data(), static_cast<int>(this->_internal_command().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.ExecuteRequest.command");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_command(), target);
+  }
+
+  // string args = 2;
+  if (!this->_internal_args().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_args().data(), static_cast<int>(this->_internal_args().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.ExecuteRequest.args");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_args(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.QueueResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.ExecuteRequest)
   return target;
 }
 
-size_t QueueResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.QueueResponse)
+size_t ExecuteRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.ExecuteRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .fs.ErrorExecute error = 1;
-  if (this->_internal_has_error()) {
+  // string command = 1;
+  if (!this->_internal_command().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.error_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_command());
+  }
+
+  // string args = 2;
+  if (!this->_internal_args().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_args());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueueResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExecuteRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    QueueResponse::MergeImpl
+    ExecuteRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueueResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExecuteRequest::GetClassData() const { return &_class_data_; }
 
 
-void QueueResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<QueueResponse*>(&to_msg);
-  auto& from = static_cast<const QueueResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.QueueResponse)
+void ExecuteRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExecuteRequest*>(&to_msg);
+  auto& from = static_cast<const ExecuteRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.ExecuteRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_error()) {
-    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
-        from._internal_error());
+  if (!from._internal_command().empty()) {
+    _this->_internal_set_command(from._internal_command());
+  }
+  if (!from._internal_args().empty()) {
+    _this->_internal_set_args(from._internal_args());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void QueueResponse::CopyFrom(const QueueResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.QueueResponse)
+void ExecuteRequest::CopyFrom(const ExecuteRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.ExecuteRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool QueueResponse::IsInitialized() const {
+bool ExecuteRequest::IsInitialized() const {
   return true;
 }
 
-void QueueResponse::InternalSwap(QueueResponse* other) {
+void ExecuteRequest::InternalSwap(ExecuteRequest* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.error_, other->_impl_.error_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.command_, lhs_arena,
+      &other->_impl_.command_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.args_, lhs_arena,
+      &other->_impl_.args_, rhs_arena
+  );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata QueueResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ExecuteRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[28]);
+      file_level_metadata_fs_2eproto[39]);
 }
 
 // ===================================================================
 
-class ErrorExecute::_Internal {
+class ExecuteResponse::_Internal {
  public:
+  static const ::fs::ErrorExecute& error(const ExecuteResponse* msg);
 };
 
-ErrorExecute::ErrorExecute(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::fs::ErrorExecute&
+ExecuteResponse::_Internal::error(const ExecuteResponse* msg) {
+  return *msg->_impl_.error_;
+}
+ExecuteResponse::ExecuteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.ErrorExecute)
+  // @@protoc_insertion_point(arena_constructor:fs.ExecuteResponse)
 }
-ErrorExecute::ErrorExecute(const ErrorExecute& from)
+ExecuteResponse::ExecuteResponse(const ExecuteResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ErrorExecute* const _this = this; (void)_this;
+  ExecuteResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.message_){}
-    , decltype(_impl_.type_){}
+      decltype(_impl_.data_){}
+    , decltype(_impl_.error_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.message_.InitDefault();
+  _impl_.data_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.message_.Set("", GetArenaForAllocation());
+    _impl_.data_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_message().empty()) {
-    _this->_impl_.message_.Set(from._internal_message(), 
+  if (!from._internal_data().empty()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.type_ = from._impl_.type_;
-  // @@protoc_insertion_point(copy_constructor:fs.ErrorExecute)
+  if (from._internal_has_error()) {
+    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  }
+  // @@protoc_insertion_point(copy_constructor:fs.ExecuteResponse)
 }
 
-inline void ErrorExecute::SharedCtor(
+inline void ExecuteResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.message_){}
-    , decltype(_impl_.type_){0}
+      decltype(_impl_.data_){}
+    , decltype(_impl_.error_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.message_.InitDefault();
+  _impl_.data_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.message_.Set("", GetArenaForAllocation());
+    _impl_.data_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ErrorExecute::~ErrorExecute() {
-  // @@protoc_insertion_point(destructor:fs.ErrorExecute)
+ExecuteResponse::~ExecuteResponse() {
+  // @@protoc_insertion_point(destructor:fs.ExecuteResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -6786,48 +12381,51 @@ ErrorExecute::~ErrorExecute() {
   SharedDtor();
 }
 
-inline void ErrorExecute::SharedDtor() {
+inline void ExecuteResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.message_.Destroy();
+  _impl_.data_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.error_;
 }
 
-void ErrorExecute::SetCachedSize(int size) const {
+void ExecuteResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ErrorExecute::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.ErrorExecute)
+void ExecuteResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.ExecuteResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.message_.ClearToEmpty();
-  _impl_.type_ = 0;
+  _impl_.data_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ErrorExecute::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* ExecuteResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string message = 1;
+      // string data = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_message();
+          auto str = _internal_mutable_data();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.ErrorExecute.message"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.ExecuteResponse.data"));
         } else
           goto handle_unusual;
         continue;
-      // .fs.ErrorExecute.Type type = 2;
+      // .fs.ErrorExecute error = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
           CHK_(ptr);
-          _internal_set_type(static_cast<::fs::ErrorExecute_Type>(val));
         } else
           goto handle_unusual;
         continue;
@@ -6854,226 +12452,281 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ErrorExecute::_InternalSerialize(
+uint8_t* ExecuteResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.ErrorExecute)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.ExecuteResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string message = 1;
-  if (!this->_internal_message().empty()) {
+  // string data = 1;
+  if (!this->_internal_data().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      this->_internal_data().data(), static_cast<int>(this->_internal_data().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.ErrorExecute.message");
+      "fs.ExecuteResponse.data");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_message(), target);
+        1, this->_internal_data(), target);
   }
 
-  // .fs.ErrorExecute.Type type = 2;
-  if (this->_internal_type() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      2, this->_internal_type(), target);
+  // .fs.ErrorExecute error = 2;
+  if (this->_internal_has_error()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.ErrorExecute)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.ExecuteResponse)
   return target;
 }
 
-size_t ErrorExecute::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.ErrorExecute)
+size_t ExecuteResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.ExecuteResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string message = 1;
-  if (!this->_internal_message().empty()) {
+  // string data = 1;
+  if (!this->_internal_data().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_message());
+        this->_internal_data());
   }
 
-  // .fs.ErrorExecute.Type type = 2;
-  if (this->_internal_type() != 0) {
+  // .fs.ErrorExecute error = 2;
+  if (this->_internal_has_error()) {
     total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.error_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ErrorExecute::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExecuteResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ErrorExecute::MergeImpl
+    ExecuteResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ErrorExecute::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExecuteResponse::GetClassData() const { return &_class_data_; }
 
 
-void ErrorExecute::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ErrorExecute*>(&to_msg);
-  auto& from = static_cast<const ErrorExecute&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.ErrorExecute)
+void ExecuteResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ExecuteResponse*>(&to_msg);
+  auto& from = static_cast<const ExecuteResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.ExecuteResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_message().empty()) {
-    _this->_internal_set_message(from._internal_message());
+  if (!from._internal_data().empty()) {
+    _this->_internal_set_data(from._internal_data());
   }
-  if (from._internal_type() != 0) {
-    _this->_internal_set_type(from._internal_type());
+  if (from._internal_has_error()) {
+    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
+        from._internal_error());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ErrorExecute::CopyFrom(const ErrorExecute& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.ErrorExecute)
+void ExecuteResponse::CopyFrom(const ExecuteResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.ExecuteResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ErrorExecute::IsInitialized() const {
+bool ExecuteResponse::IsInitialized() const {
   return true;
 }
 
-void ErrorExecute::InternalSwap(ErrorExecute* other) {
+void ExecuteResponse::InternalSwap(ExecuteResponse* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.message_, lhs_arena,
-      &other->_impl_.message_, rhs_arena
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
   );
-  swap(_impl_.type_, other->_impl_.type_);
+  swap(_impl_.error_, other->_impl_.error_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ErrorExecute::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata ExecuteResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[29]);
+      file_level_metadata_fs_2eproto[40]);
 }
 
 // ===================================================================
 
-class ExecuteRequest::_Internal {
+HangupRequest_VariablesEntry_DoNotUse::HangupRequest_VariablesEntry_DoNotUse() {}
+HangupRequest_VariablesEntry_DoNotUse::HangupRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void HangupRequest_VariablesEntry_DoNotUse::MergeFrom(const HangupRequest_VariablesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata HangupRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[41]);
+}
+
+// ===================================================================
+
+class HangupRequest::_Internal {
  public:
 };
 
-ExecuteRequest::ExecuteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+HangupRequest::HangupRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.ExecuteRequest)
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &HangupRequest::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:fs.HangupRequest)
 }
-ExecuteRequest::ExecuteRequest(const ExecuteRequest& from)
+HangupRequest::HangupRequest(const HangupRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ExecuteRequest* const _this = this; (void)_this;
+  HangupRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.command_){}
-    , decltype(_impl_.args_){}
+      /*decltype(_impl_.variables_)*/{}
+    , decltype(_impl_.uuid_){}
+    , decltype(_impl_.cause_){}
+    , decltype(_impl_.reporting_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.command_.InitDefault();
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  _impl_.uuid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.command_.Set("", GetArenaForAllocation());
+    _impl_.uuid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_command().empty()) {
-    _this->_impl_.command_.Set(from._internal_command(), 
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.args_.InitDefault();
+  _impl_.cause_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.args_.Set("", GetArenaForAllocation());
+    _impl_.cause_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_args().empty()) {
-    _this->_impl_.args_.Set(from._internal_args(), 
+  if (!from._internal_cause().empty()) {
+    _this->_impl_.cause_.Set(from._internal_cause(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.ExecuteRequest)
+  _this->_impl_.reporting_ = from._impl_.reporting_;
+  // @@protoc_insertion_point(copy_constructor:fs.HangupRequest)
 }
 
-inline void ExecuteRequest::SharedCtor(
+inline void HangupRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.command_){}
-    , decltype(_impl_.args_){}
+      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.uuid_){}
+    , decltype(_impl_.cause_){}
+    , decltype(_impl_.reporting_){false}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.command_.InitDefault();
+  _impl_.uuid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.command_.Set("", GetArenaForAllocation());
+    _impl_.uuid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.args_.InitDefault();
+  _impl_.cause_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.args_.Set("", GetArenaForAllocation());
+    _impl_.cause_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ExecuteRequest::~ExecuteRequest() {
-  // @@protoc_insertion_point(destructor:fs.ExecuteRequest)
+HangupRequest::~HangupRequest() {
+  // @@protoc_insertion_point(destructor:fs.HangupRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
+    ArenaDtor(this);
     return;
   }
   SharedDtor();
 }
 
-inline void ExecuteRequest::SharedDtor() {
+inline void HangupRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.command_.Destroy();
-  _impl_.args_.Destroy();
+  _impl_.variables_.Destruct();
+  _impl_.variables_.~MapField();
+  _impl_.uuid_.Destroy();
+  _impl_.cause_.Destroy();
 }
 
-void ExecuteRequest::SetCachedSize(int size) const {
+void HangupRequest::ArenaDtor(void* object) {
+  HangupRequest* _this = reinterpret_cast< HangupRequest* >(object);
+  _this->_impl_.variables_.Destruct();
+}
+void HangupRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ExecuteRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.ExecuteRequest)
+void HangupRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.HangupRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.command_.ClearToEmpty();
-  _impl_.args_.ClearToEmpty();
+  _impl_.variables_.Clear();
+  _impl_.uuid_.ClearToEmpty();
+  _impl_.cause_.ClearToEmpty();
+  _impl_.reporting_ = false;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ExecuteRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* HangupRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string command = 1;
+      // string uuid = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_command();
+          auto str = _internal_mutable_uuid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.ExecuteRequest.command"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.HangupRequest.uuid"));
         } else
           goto handle_unusual;
         continue;
-      // string args = 2;
+      // string cause = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_args();
+          auto str = _internal_mutable_cause();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.ExecuteRequest.args"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.HangupRequest.cause"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool reporting = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.reporting_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> variables = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -7100,178 +12753,220 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ExecuteRequest::_InternalSerialize(
+uint8_t* HangupRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.ExecuteRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.HangupRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string command = 1;
-  if (!this->_internal_command().empty()) {
+  // string uuid = 1;
+  if (!this->_internal_uuid().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_command().data(), static_cast<int>(this->_internal_command().length()),
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.ExecuteRequest.command");
+      "fs.HangupRequest.uuid");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_command(), target);
+        1, this->_internal_uuid(), target);
   }
 
-  // string args = 2;
-  if (!this->_internal_args().empty()) {
+  // string cause = 2;
+  if (!this->_internal_cause().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_args().data(), static_cast<int>(this->_internal_args().length()),
+      this->_internal_cause().data(), static_cast<int>(this->_internal_cause().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.ExecuteRequest.args");
+      "fs.HangupRequest.cause");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_args(), target);
+        2, this->_internal_cause(), target);
+  }
+
+  // bool reporting = 3;
+  if (this->_internal_reporting() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_reporting(), target);
+  }
+
+  // map<string, string> variables = 4;
+  if (!this->_internal_variables().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = HangupRequest_VariablesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_variables();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.HangupRequest.VariablesEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.HangupRequest.VariablesEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.ExecuteRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.HangupRequest)
   return target;
 }
 
-size_t ExecuteRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.ExecuteRequest)
+size_t HangupRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.HangupRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string command = 1;
-  if (!this->_internal_command().empty()) {
+  // map<string, string> variables = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_variables().begin();
+      it != this->_internal_variables().end(); ++it) {
+    total_size += HangupRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string uuid = 1;
+  if (!this->_internal_uuid().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_command());
+        this->_internal_uuid());
   }
 
-  // string args = 2;
-  if (!this->_internal_args().empty()) {
+  // string cause = 2;
+  if (!this->_internal_cause().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_args());
+        this->_internal_cause());
+  }
+
+  // bool reporting = 3;
+  if (this->_internal_reporting() != 0) {
+    total_size += 1 + 1;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExecuteRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HangupRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ExecuteRequest::MergeImpl
+    HangupRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExecuteRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HangupRequest::GetClassData() const { return &_class_data_; }
 
 
-void ExecuteRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ExecuteRequest*>(&to_msg);
-  auto& from = static_cast<const ExecuteRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.ExecuteRequest)
+void HangupRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HangupRequest*>(&to_msg);
+  auto& from = static_cast<const HangupRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HangupRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_command().empty()) {
-    _this->_internal_set_command(from._internal_command());
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
   }
-  if (!from._internal_args().empty()) {
-    _this->_internal_set_args(from._internal_args());
+  if (!from._internal_cause().empty()) {
+    _this->_internal_set_cause(from._internal_cause());
+  }
+  if (from._internal_reporting() != 0) {
+    _this->_internal_set_reporting(from._internal_reporting());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ExecuteRequest::CopyFrom(const ExecuteRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.ExecuteRequest)
+void HangupRequest::CopyFrom(const HangupRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.HangupRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ExecuteRequest::IsInitialized() const {
+bool HangupRequest::IsInitialized() const {
   return true;
 }
 
-void ExecuteRequest::InternalSwap(ExecuteRequest* other) {
+void HangupRequest::InternalSwap(HangupRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.command_, lhs_arena,
-      &other->_impl_.command_, rhs_arena
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.args_, lhs_arena,
-      &other->_impl_.args_, rhs_arena
+      &_impl_.cause_, lhs_arena,
+      &other->_impl_.cause_, rhs_arena
   );
+  swap(_impl_.reporting_, other->_impl_.reporting_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ExecuteRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata HangupRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[30]);
+      file_level_metadata_fs_2eproto[42]);
 }
 
 // ===================================================================
 
-class ExecuteResponse::_Internal {
+class HangupResponse::_Internal {
  public:
-  static const ::fs::ErrorExecute& error(const ExecuteResponse* msg);
+  static const ::fs::ErrorExecute& error(const HangupResponse* msg);
 };
 
 const ::fs::ErrorExecute&
-ExecuteResponse::_Internal::error(const ExecuteResponse* msg) {
+HangupResponse::_Internal::error(const HangupResponse* msg) {
   return *msg->_impl_.error_;
 }
-ExecuteResponse::ExecuteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+HangupResponse::HangupResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.ExecuteResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.HangupResponse)
 }
-ExecuteResponse::ExecuteResponse(const ExecuteResponse& from)
+HangupResponse::HangupResponse(const HangupResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  ExecuteResponse* const _this = this; (void)_this;
+  HangupResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.data_){}
-    , decltype(_impl_.error_){nullptr}
+      decltype(_impl_.error_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.data_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.data_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_data().empty()) {
-    _this->_impl_.data_.Set(from._internal_data(), 
-      _this->GetArenaForAllocation());
-  }
   if (from._internal_has_error()) {
     _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
   }
-  // @@protoc_insertion_point(copy_constructor:fs.ExecuteResponse)
+  // @@protoc_insertion_point(copy_constructor:fs.HangupResponse)
 }
 
-inline void ExecuteResponse::SharedCtor(
+inline void HangupResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.data_){}
-    , decltype(_impl_.error_){nullptr}
+      decltype(_impl_.error_){nullptr}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.data_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.data_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-ExecuteResponse::~ExecuteResponse() {
-  // @@protoc_insertion_point(destructor:fs.ExecuteResponse)
+HangupResponse::~HangupResponse() {
+  // @@protoc_insertion_point(destructor:fs.HangupResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -7279,23 +12974,21 @@ ExecuteResponse::~ExecuteResponse() {
   SharedDtor();
 }
 
-inline void ExecuteResponse::SharedDtor() {
+inline void HangupResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.data_.Destroy();
   if (this != internal_default_instance()) delete _impl_.error_;
 }
 
-void ExecuteResponse::SetCachedSize(int size) const {
+void HangupResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void ExecuteResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.ExecuteResponse)
+void HangupResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.HangupResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.data_.ClearToEmpty();
   if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
     delete _impl_.error_;
   }
@@ -7303,25 +12996,15 @@ void ExecuteResponse::Clear() {
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* ExecuteResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* HangupResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string data = 1;
+      // .fs.ErrorExecute error = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_data();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.ExecuteResponse.data"));
-        } else
-          goto handle_unusual;
-        continue;
-      // .fs.ErrorExecute error = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
           CHK_(ptr);
         } else
@@ -7350,26 +13033,16 @@ failure:
 #undef CHK_
 }
 
-uint8_t* ExecuteResponse::_InternalSerialize(
+uint8_t* HangupResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.ExecuteResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.HangupResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string data = 1;
-  if (!this->_internal_data().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_data().data(), static_cast<int>(this->_internal_data().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.ExecuteResponse.data");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_data(), target);
-  }
-
-  // .fs.ErrorExecute error = 2;
+  // .fs.ErrorExecute error = 1;
   if (this->_internal_has_error()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::error(this),
+      InternalWriteMessage(1, _Internal::error(this),
         _Internal::error(this).GetCachedSize(), target, stream);
   }
 
@@ -7377,26 +13050,19 @@ uint8_t* ExecuteResponse::_InternalSerialize(
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.ExecuteResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.HangupResponse)
   return target;
 }
 
-size_t ExecuteResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.ExecuteResponse)
+size_t HangupResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.HangupResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string data = 1;
-  if (!this->_internal_data().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_data());
-  }
-
-  // .fs.ErrorExecute error = 2;
+  // .fs.ErrorExecute error = 1;
   if (this->_internal_has_error()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
@@ -7406,24 +13072,21 @@ size_t ExecuteResponse::ByteSizeLong() const {
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ExecuteResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HangupResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    ExecuteResponse::MergeImpl
+    HangupResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ExecuteResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HangupResponse::GetClassData() const { return &_class_data_; }
 
 
-void ExecuteResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<ExecuteResponse*>(&to_msg);
-  auto& from = static_cast<const ExecuteResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.ExecuteResponse)
+void HangupResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HangupResponse*>(&to_msg);
+  auto& from = static_cast<const HangupResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HangupResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_data().empty()) {
-    _this->_internal_set_data(from._internal_data());
-  }
+  (void) cached_has_bits;
+
   if (from._internal_has_error()) {
     _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
         from._internal_error());
@@ -7431,200 +13094,141 @@ void ExecuteResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void ExecuteResponse::CopyFrom(const ExecuteResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.ExecuteResponse)
+void HangupResponse::CopyFrom(const HangupResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.HangupResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool ExecuteResponse::IsInitialized() const {
+bool HangupResponse::IsInitialized() const {
   return true;
 }
 
-void ExecuteResponse::InternalSwap(ExecuteResponse* other) {
+void HangupResponse::InternalSwap(HangupResponse* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.data_, lhs_arena,
-      &other->_impl_.data_, rhs_arena
-  );
   swap(_impl_.error_, other->_impl_.error_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata ExecuteResponse::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[31]);
-}
-
-// ===================================================================
-
-HangupRequest_VariablesEntry_DoNotUse::HangupRequest_VariablesEntry_DoNotUse() {}
-HangupRequest_VariablesEntry_DoNotUse::HangupRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void HangupRequest_VariablesEntry_DoNotUse::MergeFrom(const HangupRequest_VariablesEntry_DoNotUse& other) {
-  MergeFromInternal(other);
-}
-::PROTOBUF_NAMESPACE_ID::Metadata HangupRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata HangupResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[32]);
+      file_level_metadata_fs_2eproto[43]);
 }
 
 // ===================================================================
 
-class HangupRequest::_Internal {
+class OriginateRequest_Extension::_Internal {
  public:
 };
 
-HangupRequest::HangupRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+OriginateRequest_Extension::OriginateRequest_Extension(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  if (arena != nullptr && !is_message_owned) {
-    arena->OwnCustomDestructor(this, &HangupRequest::ArenaDtor);
-  }
-  // @@protoc_insertion_point(arena_constructor:fs.HangupRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.OriginateRequest.Extension)
 }
-HangupRequest::HangupRequest(const HangupRequest& from)
+OriginateRequest_Extension::OriginateRequest_Extension(const OriginateRequest_Extension& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  HangupRequest* const _this = this; (void)_this;
+  OriginateRequest_Extension* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{}
-    , decltype(_impl_.uuid_){}
-    , decltype(_impl_.cause_){}
-    , decltype(_impl_.reporting_){}
+      decltype(_impl_.appname_){}
+    , decltype(_impl_.args_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  _impl_.uuid_.InitDefault();
+  _impl_.appname_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.uuid_.Set("", GetArenaForAllocation());
+    _impl_.appname_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_uuid().empty()) {
-    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+  if (!from._internal_appname().empty()) {
+    _this->_impl_.appname_.Set(from._internal_appname(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.cause_.InitDefault();
+  _impl_.args_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.cause_.Set("", GetArenaForAllocation());
+    _impl_.args_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cause().empty()) {
-    _this->_impl_.cause_.Set(from._internal_cause(), 
+  if (!from._internal_args().empty()) {
+    _this->_impl_.args_.Set(from._internal_args(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.reporting_ = from._impl_.reporting_;
-  // @@protoc_insertion_point(copy_constructor:fs.HangupRequest)
+  // @@protoc_insertion_point(copy_constructor:fs.OriginateRequest.Extension)
 }
 
-inline void HangupRequest::SharedCtor(
+inline void OriginateRequest_Extension::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
-    , decltype(_impl_.uuid_){}
-    , decltype(_impl_.cause_){}
-    , decltype(_impl_.reporting_){false}
+      decltype(_impl_.appname_){}
+    , decltype(_impl_.args_){}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.uuid_.InitDefault();
+  _impl_.appname_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.uuid_.Set("", GetArenaForAllocation());
+    _impl_.appname_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.cause_.InitDefault();
+  _impl_.args_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.cause_.Set("", GetArenaForAllocation());
+    _impl_.args_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-HangupRequest::~HangupRequest() {
-  // @@protoc_insertion_point(destructor:fs.HangupRequest)
+OriginateRequest_Extension::~OriginateRequest_Extension() {
+  // @@protoc_insertion_point(destructor:fs.OriginateRequest.Extension)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
-    ArenaDtor(this);
     return;
   }
   SharedDtor();
 }
 
-inline void HangupRequest::SharedDtor() {
+inline void OriginateRequest_Extension::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.variables_.Destruct();
-  _impl_.variables_.~MapField();
-  _impl_.uuid_.Destroy();
-  _impl_.cause_.Destroy();
+  _impl_.appname_.Destroy();
+  _impl_.args_.Destroy();
 }
 
-void HangupRequest::ArenaDtor(void* object) {
-  HangupRequest* _this = reinterpret_cast< HangupRequest* >(object);
-  _this->_impl_.variables_.Destruct();
-}
-void HangupRequest::SetCachedSize(int size) const {
+void OriginateRequest_Extension::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void HangupRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.HangupRequest)
+void OriginateRequest_Extension::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.OriginateRequest.Extension)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.variables_.Clear();
-  _impl_.uuid_.ClearToEmpty();
-  _impl_.cause_.ClearToEmpty();
-  _impl_.reporting_ = false;
+  _impl_.appname_.ClearToEmpty();
+  _impl_.args_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* HangupRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* OriginateRequest_Extension::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string uuid = 1;
+      // string appName = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_uuid();
+          auto str = _internal_mutable_appname();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.HangupRequest.uuid"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.Extension.appName"));
         } else
           goto handle_unusual;
         continue;
-      // string cause = 2;
+      // string args = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cause();
+          auto str = _internal_mutable_args();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.HangupRequest.cause"));
-        } else
-          goto handle_unusual;
-        continue;
-      // bool reporting = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.reporting_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // map<string, string> variables = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.Extension.args"));
         } else
           goto handle_unusual;
         continue;
@@ -7651,260 +13255,441 @@ failure:
 #undef CHK_
 }
 
-uint8_t* HangupRequest::_InternalSerialize(
+uint8_t* OriginateRequest_Extension::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.HangupRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.OriginateRequest.Extension)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string uuid = 1;
-  if (!this->_internal_uuid().empty()) {
+  // string appName = 1;
+  if (!this->_internal_appname().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      this->_internal_appname().data(), static_cast<int>(this->_internal_appname().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.HangupRequest.uuid");
+      "fs.OriginateRequest.Extension.appName");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_uuid(), target);
+        1, this->_internal_appname(), target);
   }
 
-  // string cause = 2;
-  if (!this->_internal_cause().empty()) {
+  // string args = 2;
+  if (!this->_internal_args().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cause().data(), static_cast<int>(this->_internal_cause().length()),
+      this->_internal_args().data(), static_cast<int>(this->_internal_args().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.HangupRequest.cause");
+      "fs.OriginateRequest.Extension.args");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cause(), target);
-  }
-
-  // bool reporting = 3;
-  if (this->_internal_reporting() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_reporting(), target);
-  }
-
-  // map<string, string> variables = 4;
-  if (!this->_internal_variables().empty()) {
-    using MapType = ::_pb::Map<std::string, std::string>;
-    using WireHelper = HangupRequest_VariablesEntry_DoNotUse::Funcs;
-    const auto& map_field = this->_internal_variables();
-    auto check_utf8 = [](const MapType::value_type& entry) {
-      (void)entry;
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.first.data(), static_cast<int>(entry.first.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.HangupRequest.VariablesEntry.key");
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.second.data(), static_cast<int>(entry.second.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.HangupRequest.VariablesEntry.value");
-    };
-
-    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
-      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
-        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    } else {
-      for (const auto& entry : map_field) {
-        target = WireHelper::InternalSerialize(4, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    }
+        2, this->_internal_args(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.HangupRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.OriginateRequest.Extension)
   return target;
 }
 
-size_t HangupRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.HangupRequest)
+size_t OriginateRequest_Extension::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.OriginateRequest.Extension)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // map<string, string> variables = 4;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
-      it = this->_internal_variables().begin();
-      it != this->_internal_variables().end(); ++it) {
-    total_size += HangupRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
-  }
-
-  // string uuid = 1;
-  if (!this->_internal_uuid().empty()) {
+  // string appName = 1;
+  if (!this->_internal_appname().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_uuid());
+        this->_internal_appname());
   }
 
-  // string cause = 2;
-  if (!this->_internal_cause().empty()) {
+  // string args = 2;
+  if (!this->_internal_args().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cause());
-  }
-
-  // bool reporting = 3;
-  if (this->_internal_reporting() != 0) {
-    total_size += 1 + 1;
+        this->_internal_args());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HangupRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OriginateRequest_Extension::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    HangupRequest::MergeImpl
+    OriginateRequest_Extension::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HangupRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OriginateRequest_Extension::GetClassData() const { return &_class_data_; }
 
 
-void HangupRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<HangupRequest*>(&to_msg);
-  auto& from = static_cast<const HangupRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HangupRequest)
+void OriginateRequest_Extension::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OriginateRequest_Extension*>(&to_msg);
+  auto& from = static_cast<const OriginateRequest_Extension&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.OriginateRequest.Extension)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  if (!from._internal_uuid().empty()) {
-    _this->_internal_set_uuid(from._internal_uuid());
-  }
-  if (!from._internal_cause().empty()) {
-    _this->_internal_set_cause(from._internal_cause());
+  if (!from._internal_appname().empty()) {
+    _this->_internal_set_appname(from._internal_appname());
   }
-  if (from._internal_reporting() != 0) {
-    _this->_internal_set_reporting(from._internal_reporting());
+  if (!from._internal_args().empty()) {
+    _this->_internal_set_args(from._internal_args());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void HangupRequest::CopyFrom(const HangupRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.HangupRequest)
+void OriginateRequest_Extension::CopyFrom(const OriginateRequest_Extension& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.OriginateRequest.Extension)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool HangupRequest::IsInitialized() const {
+bool OriginateRequest_Extension::IsInitialized() const {
   return true;
 }
 
-void HangupRequest::InternalSwap(HangupRequest* other) {
+void OriginateRequest_Extension::InternalSwap(OriginateRequest_Extension* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.uuid_, lhs_arena,
-      &other->_impl_.uuid_, rhs_arena
+      &_impl_.appname_, lhs_arena,
+      &other->_impl_.appname_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.cause_, lhs_arena,
-      &other->_impl_.cause_, rhs_arena
+      &_impl_.args_, lhs_arena,
+      &other->_impl_.args_, rhs_arena
   );
-  swap(_impl_.reporting_, other->_impl_.reporting_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata HangupRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata OriginateRequest_Extension::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[33]);
+      file_level_metadata_fs_2eproto[44]);
 }
 
 // ===================================================================
 
-class HangupResponse::_Internal {
+OriginateRequest_VariablesEntry_DoNotUse::OriginateRequest_VariablesEntry_DoNotUse() {}
+OriginateRequest_VariablesEntry_DoNotUse::OriginateRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void OriginateRequest_VariablesEntry_DoNotUse::MergeFrom(const OriginateRequest_VariablesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata OriginateRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[45]);
+}
+
+// ===================================================================
+
+class OriginateRequest::_Internal {
  public:
-  static const ::fs::ErrorExecute& error(const HangupResponse* msg);
 };
 
-const ::fs::ErrorExecute&
-HangupResponse::_Internal::error(const HangupResponse* msg) {
-  return *msg->_impl_.error_;
-}
-HangupResponse::HangupResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+OriginateRequest::OriginateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.HangupResponse)
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &OriginateRequest::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:fs.OriginateRequest)
 }
-HangupResponse::HangupResponse(const HangupResponse& from)
+OriginateRequest::OriginateRequest(const OriginateRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  HangupResponse* const _this = this; (void)_this;
+  OriginateRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.error_){nullptr}
+      /*decltype(_impl_.variables_)*/{}
+    , decltype(_impl_.endpoints_){from._impl_.endpoints_}
+    , decltype(_impl_.extensions_){from._impl_.extensions_}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.callernumber_){}
+    , decltype(_impl_.callername_){}
+    , decltype(_impl_.context_){}
+    , decltype(_impl_.dialplan_){}
+    , decltype(_impl_.check_id_){}
+    , decltype(_impl_.strategy_){}
+    , decltype(_impl_.timeout_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_error()) {
-    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_destination().empty()) {
+    _this->_impl_.destination_.Set(from._internal_destination(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:fs.HangupResponse)
+  _impl_.callernumber_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.callernumber_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_callernumber().empty()) {
+    _this->_impl_.callernumber_.Set(from._internal_callernumber(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.callername_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.callername_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_callername().empty()) {
+    _this->_impl_.callername_.Set(from._internal_callername(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.context_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.context_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_context().empty()) {
+    _this->_impl_.context_.Set(from._internal_context(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.dialplan_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dialplan_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_dialplan().empty()) {
+    _this->_impl_.dialplan_.Set(from._internal_dialplan(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.check_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.check_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_check_id().empty()) {
+    _this->_impl_.check_id_.Set(from._internal_check_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.strategy_, &from._impl_.strategy_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timeout_) -
+    reinterpret_cast<char*>(&_impl_.strategy_)) + sizeof(_impl_.timeout_));
+  // @@protoc_insertion_point(copy_constructor:fs.OriginateRequest)
 }
 
-inline void HangupResponse::SharedCtor(
+inline void OriginateRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.error_){nullptr}
+      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.endpoints_){arena}
+    , decltype(_impl_.extensions_){arena}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.callernumber_){}
+    , decltype(_impl_.callername_){}
+    , decltype(_impl_.context_){}
+    , decltype(_impl_.dialplan_){}
+    , decltype(_impl_.check_id_){}
+    , decltype(_impl_.strategy_){0}
+    , decltype(_impl_.timeout_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.callernumber_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.callernumber_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.callername_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.callername_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.context_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.context_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.dialplan_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.dialplan_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.check_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.check_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-HangupResponse::~HangupResponse() {
-  // @@protoc_insertion_point(destructor:fs.HangupResponse)
+OriginateRequest::~OriginateRequest() {
+  // @@protoc_insertion_point(destructor:fs.OriginateRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
+    ArenaDtor(this);
     return;
   }
   SharedDtor();
 }
 
-inline void HangupResponse::SharedDtor() {
+inline void OriginateRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete _impl_.error_;
+  _impl_.variables_.Destruct();
+  _impl_.variables_.~MapField();
+  _impl_.endpoints_.~RepeatedPtrField();
+  _impl_.extensions_.~RepeatedPtrField();
+  _impl_.destination_.Destroy();
+  _impl_.callernumber_.Destroy();
+  _impl_.callername_.Destroy();
+  _impl_.context_.Destroy();
+  _impl_.dialplan_.Destroy();
+  _impl_.check_id_.Destroy();
 }
 
-void HangupResponse::SetCachedSize(int size) const {
+void OriginateRequest::ArenaDtor(void* object) {
+  OriginateRequest* _this = reinterpret_cast< OriginateRequest* >(object);
+  _this->_impl_.variables_.Destruct();
+}
+void OriginateRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void HangupResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.HangupResponse)
+void OriginateRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.OriginateRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
-    delete _impl_.error_;
-  }
-  _impl_.error_ = nullptr;
+  _impl_.variables_.Clear();
+  _impl_.endpoints_.Clear();
+  _impl_.extensions_.Clear();
+  _impl_.destination_.ClearToEmpty();
+  _impl_.callernumber_.ClearToEmpty();
+  _impl_.callername_.ClearToEmpty();
+  _impl_.context_.ClearToEmpty();
+  _impl_.dialplan_.ClearToEmpty();
+  _impl_.check_id_.ClearToEmpty();
+  ::memset(&_impl_.strategy_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.timeout_) -
+      reinterpret_cast<char*>(&_impl_.strategy_)) + sizeof(_impl_.timeout_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* HangupResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* OriginateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .fs.ErrorExecute error = 1;
+      // map<string, string> variables = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string endpoints = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_endpoints();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.endpoints"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .fs.OriginateRequest.Strategy strategy = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_strategy(static_cast<::fs::OriginateRequest_Strategy>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string destination = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_destination();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.destination"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 timeout = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.timeout_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string callerNumber = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_callernumber();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.callerNumber"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string callerName = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_callername();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.callerName"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string context = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_context();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.context"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string dialplan = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_dialplan();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.dialplan"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .fs.OriginateRequest.Extension extensions = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_extensions(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string check_id = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_check_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.check_id"));
         } else
           goto handle_unusual;
         continue;
@@ -7931,151 +13716,391 @@ failure:
 #undef CHK_
 }
 
-uint8_t* HangupResponse::_InternalSerialize(
+uint8_t* OriginateRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.HangupResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.OriginateRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .fs.ErrorExecute error = 1;
-  if (this->_internal_has_error()) {
+  // map<string, string> variables = 1;
+  if (!this->_internal_variables().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = OriginateRequest_VariablesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_variables();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.OriginateRequest.VariablesEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "fs.OriginateRequest.VariablesEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // repeated string endpoints = 2;
+  for (int i = 0, n = this->_internal_endpoints_size(); i < n; i++) {
+    const auto& s = this->_internal_endpoints(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.OriginateRequest.endpoints");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // .fs.OriginateRequest.Strategy strategy = 3;
+  if (this->_internal_strategy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_strategy(), target);
+  }
+
+  // string destination = 4;
+  if (!this->_internal_destination().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_destination().data(), static_cast<int>(this->_internal_destination().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.OriginateRequest.destination");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_destination(), target);
+  }
+
+  // int32 timeout = 5;
+  if (this->_internal_timeout() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_timeout(), target);
+  }
+
+  // string callerNumber = 6;
+  if (!this->_internal_callernumber().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_callernumber().data(), static_cast<int>(this->_internal_callernumber().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.OriginateRequest.callerNumber");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_callernumber(), target);
+  }
+
+  // string callerName = 7;
+  if (!this->_internal_callername().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_callername().data(), static_cast<int>(this->_internal_callername().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.OriginateRequest.callerName");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_callername(), target);
+  }
+
+  // string context = 8;
+  if (!this->_internal_context().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_context().data(), static_cast<int>(this->_internal_context().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.OriginateRequest.context");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_context(), target);
+  }
+
+  // string dialplan = 9;
+  if (!this->_internal_dialplan().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_dialplan().data(), static_cast<int>(this->_internal_dialplan().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.OriginateRequest.dialplan");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_dialplan(), target);
+  }
+
+  // repeated .fs.OriginateRequest.Extension extensions = 10;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_extensions_size()); i < n; i++) {
+    const auto& repfield = this->_internal_extensions(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::error(this),
-        _Internal::error(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(10, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string check_id = 11;
+  if (!this->_internal_check_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_check_id().data(), static_cast<int>(this->_internal_check_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.OriginateRequest.check_id");
+    target = stream->WriteStringMaybeAliased(
+        11, this->_internal_check_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.OriginateRequest)
+  return target;
+}
+
+size_t OriginateRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.OriginateRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> variables = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_variables().begin();
+      it != this->_internal_variables().end(); ++it) {
+    total_size += OriginateRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // repeated string endpoints = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.endpoints_.size());
+  for (int i = 0, n = _impl_.endpoints_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.endpoints_.Get(i));
+  }
+
+  // repeated .fs.OriginateRequest.Extension extensions = 10;
+  total_size += 1UL * this->_internal_extensions_size();
+  for (const auto& msg : this->_impl_.extensions_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string destination = 4;
+  if (!this->_internal_destination().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_destination());
+  }
+
+  // string callerNumber = 6;
+  if (!this->_internal_callernumber().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_callernumber());
   }
 
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  // string callerName = 7;
+  if (!this->_internal_callername().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_callername());
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.HangupResponse)
-  return target;
-}
 
-size_t HangupResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.HangupResponse)
-  size_t total_size = 0;
+  // string context = 8;
+  if (!this->_internal_context().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_context());
+  }
 
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
+  // string dialplan = 9;
+  if (!this->_internal_dialplan().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_dialplan());
+  }
 
-  // .fs.ErrorExecute error = 1;
-  if (this->_internal_has_error()) {
+  // string check_id = 11;
+  if (!this->_internal_check_id().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.error_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_check_id());
+  }
+
+  // .fs.OriginateRequest.Strategy strategy = 3;
+  if (this->_internal_strategy() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_strategy());
+  }
+
+  // int32 timeout = 5;
+  if (this->_internal_timeout() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_timeout());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HangupResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OriginateRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    HangupResponse::MergeImpl
+    OriginateRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HangupResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OriginateRequest::GetClassData() const { return &_class_data_; }
 
 
-void HangupResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<HangupResponse*>(&to_msg);
-  auto& from = static_cast<const HangupResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.HangupResponse)
+void OriginateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OriginateRequest*>(&to_msg);
+  auto& from = static_cast<const OriginateRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.OriginateRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_error()) {
-    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
-        from._internal_error());
+  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
+  _this->_impl_.endpoints_.MergeFrom(from._impl_.endpoints_);
+  _this->_impl_.extensions_.MergeFrom(from._impl_.extensions_);
+  if (!from._internal_destination().empty()) {
+    _this->_internal_set_destination(from._internal_destination());
+  }
+  if (!from._internal_callernumber().empty()) {
+    _this->_internal_set_callernumber(from._internal_callernumber());
+  }
+  if (!from._internal_callername().empty()) {
+    _this->_internal_set_callername(from._internal_callername());
+  }
+  if (!from._internal_context().empty()) {
+    _this->_internal_set_context(from._internal_context());
+  }
+  if (!from._internal_dialplan().empty()) {
+    _this->_internal_set_dialplan(from._internal_dialplan());
+  }
+  if (!from._internal_check_id().empty()) {
+    _this->_internal_set_check_id(from._internal_check_id());
+  }
+  if (from._internal_strategy() != 0) {
+    _this->_internal_set_strategy(from._internal_strategy());
+  }
+  if (from._internal_timeout() != 0) {
+    _this->_internal_set_timeout(from._internal_timeout());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void HangupResponse::CopyFrom(const HangupResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.HangupResponse)
+void OriginateRequest::CopyFrom(const OriginateRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.OriginateRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool HangupResponse::IsInitialized() const {
+bool OriginateRequest::IsInitialized() const {
   return true;
 }
 
-void HangupResponse::InternalSwap(HangupResponse* other) {
+void OriginateRequest::InternalSwap(OriginateRequest* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.error_, other->_impl_.error_);
+  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
+  _impl_.endpoints_.InternalSwap(&other->_impl_.endpoints_);
+  _impl_.extensions_.InternalSwap(&other->_impl_.extensions_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.destination_, lhs_arena,
+      &other->_impl_.destination_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.callernumber_, lhs_arena,
+      &other->_impl_.callernumber_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.callername_, lhs_arena,
+      &other->_impl_.callername_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.context_, lhs_arena,
+      &other->_impl_.context_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.dialplan_, lhs_arena,
+      &other->_impl_.dialplan_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.check_id_, lhs_arena,
+      &other->_impl_.check_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OriginateRequest, _impl_.timeout_)
+      + sizeof(OriginateRequest::_impl_.timeout_)
+      - PROTOBUF_FIELD_OFFSET(OriginateRequest, _impl_.strategy_)>(
+          reinterpret_cast<char*>(&_impl_.strategy_),
+          reinterpret_cast<char*>(&other->_impl_.strategy_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata HangupResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata OriginateRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[34]);
+      file_level_metadata_fs_2eproto[46]);
 }
 
 // ===================================================================
 
-class OriginateRequest_Extension::_Internal {
+class OriginateResponse::_Internal {
  public:
+  static const ::fs::ErrorExecute& error(const OriginateResponse* msg);
 };
 
-OriginateRequest_Extension::OriginateRequest_Extension(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::fs::ErrorExecute&
+OriginateResponse::_Internal::error(const OriginateResponse* msg) {
+  return *msg->_impl_.error_;
+}
+OriginateResponse::OriginateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.OriginateRequest.Extension)
+  // @@protoc_insertion_point(arena_constructor:fs.OriginateResponse)
 }
-OriginateRequest_Extension::OriginateRequest_Extension(const OriginateRequest_Extension& from)
+OriginateResponse::OriginateResponse(const OriginateResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  OriginateRequest_Extension* const _this = this; (void)_this;
+  OriginateResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.appname_){}
-    , decltype(_impl_.args_){}
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.error_){nullptr}
+    , decltype(_impl_.error_code_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.appname_.InitDefault();
+  _impl_.uuid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.appname_.Set("", GetArenaForAllocation());
+    _impl_.uuid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_appname().empty()) {
-    _this->_impl_.appname_.Set(from._internal_appname(), 
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.args_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.args_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_args().empty()) {
-    _this->_impl_.args_.Set(from._internal_args(), 
-      _this->GetArenaForAllocation());
+  if (from._internal_has_error()) {
+    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
   }
-  // @@protoc_insertion_point(copy_constructor:fs.OriginateRequest.Extension)
+  _this->_impl_.error_code_ = from._impl_.error_code_;
+  // @@protoc_insertion_point(copy_constructor:fs.OriginateResponse)
 }
 
-inline void OriginateRequest_Extension::SharedCtor(
+inline void OriginateResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.appname_){}
-    , decltype(_impl_.args_){}
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.error_){nullptr}
+    , decltype(_impl_.error_code_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.appname_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.appname_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.args_.InitDefault();
+  _impl_.uuid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.args_.Set("", GetArenaForAllocation());
+    _impl_.uuid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-OriginateRequest_Extension::~OriginateRequest_Extension() {
-  // @@protoc_insertion_point(destructor:fs.OriginateRequest.Extension)
+OriginateResponse::~OriginateResponse() {
+  // @@protoc_insertion_point(destructor:fs.OriginateResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -8083,50 +14108,60 @@ OriginateRequest_Extension::~OriginateRequest_Extension() {
   SharedDtor();
 }
 
-inline void OriginateRequest_Extension::SharedDtor() {
+inline void OriginateResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.appname_.Destroy();
-  _impl_.args_.Destroy();
+  _impl_.uuid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.error_;
 }
 
-void OriginateRequest_Extension::SetCachedSize(int size) const {
+void OriginateResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void OriginateRequest_Extension::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.OriginateRequest.Extension)
+void OriginateResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.OriginateResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.appname_.ClearToEmpty();
-  _impl_.args_.ClearToEmpty();
+  _impl_.uuid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
+  _impl_.error_code_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* OriginateRequest_Extension::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* OriginateResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string appName = 1;
+      // string uuid = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_appname();
+          auto str = _internal_mutable_uuid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.Extension.appName"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateResponse.uuid"));
         } else
           goto handle_unusual;
         continue;
-      // string args = 2;
+      // .fs.ErrorExecute error = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_args();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 error_code = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.error_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.Extension.args"));
         } else
           goto handle_unusual;
         continue;
@@ -8153,441 +14188,545 @@ failure:
 #undef CHK_
 }
 
-uint8_t* OriginateRequest_Extension::_InternalSerialize(
+uint8_t* OriginateResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.OriginateRequest.Extension)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.OriginateResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string appName = 1;
-  if (!this->_internal_appname().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_appname().data(), static_cast<int>(this->_internal_appname().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.OriginateRequest.Extension.appName");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_appname(), target);
-  }
-
-  // string args = 2;
-  if (!this->_internal_args().empty()) {
+  // string uuid = 1;
+  if (!this->_internal_uuid().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_args().data(), static_cast<int>(this->_internal_args().length()),
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.OriginateRequest.Extension.args");
+      "fs.OriginateResponse.uuid");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_args(), target);
+        1, this->_internal_uuid(), target);
+  }
+
+  // .fs.ErrorExecute error = 2;
+  if (this->_internal_has_error()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 error_code = 3;
+  if (this->_internal_error_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_error_code(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.OriginateRequest.Extension)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.OriginateResponse)
   return target;
 }
 
-size_t OriginateRequest_Extension::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.OriginateRequest.Extension)
+size_t OriginateResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.OriginateResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string appName = 1;
-  if (!this->_internal_appname().empty()) {
+  // string uuid = 1;
+  if (!this->_internal_uuid().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_appname());
+        this->_internal_uuid());
   }
 
-  // string args = 2;
-  if (!this->_internal_args().empty()) {
+  // .fs.ErrorExecute error = 2;
+  if (this->_internal_has_error()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_args());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.error_);
+  }
+
+  // int32 error_code = 3;
+  if (this->_internal_error_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_error_code());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OriginateRequest_Extension::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OriginateResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    OriginateRequest_Extension::MergeImpl
+    OriginateResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OriginateRequest_Extension::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OriginateResponse::GetClassData() const { return &_class_data_; }
 
 
-void OriginateRequest_Extension::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<OriginateRequest_Extension*>(&to_msg);
-  auto& from = static_cast<const OriginateRequest_Extension&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.OriginateRequest.Extension)
+void OriginateResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OriginateResponse*>(&to_msg);
+  auto& from = static_cast<const OriginateResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.OriginateResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_appname().empty()) {
-    _this->_internal_set_appname(from._internal_appname());
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
   }
-  if (!from._internal_args().empty()) {
-    _this->_internal_set_args(from._internal_args());
+  if (from._internal_has_error()) {
+    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
+        from._internal_error());
+  }
+  if (from._internal_error_code() != 0) {
+    _this->_internal_set_error_code(from._internal_error_code());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void OriginateRequest_Extension::CopyFrom(const OriginateRequest_Extension& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.OriginateRequest.Extension)
+void OriginateResponse::CopyFrom(const OriginateResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.OriginateResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool OriginateRequest_Extension::IsInitialized() const {
+bool OriginateResponse::IsInitialized() const {
   return true;
 }
 
-void OriginateRequest_Extension::InternalSwap(OriginateRequest_Extension* other) {
+void OriginateResponse::InternalSwap(OriginateResponse* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.appname_, lhs_arena,
-      &other->_impl_.appname_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.args_, lhs_arena,
-      &other->_impl_.args_, rhs_arena
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OriginateResponse, _impl_.error_code_)
+      + sizeof(OriginateResponse::_impl_.error_code_)
+      - PROTOBUF_FIELD_OFFSET(OriginateResponse, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata OriginateRequest_Extension::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[35]);
-}
-
-// ===================================================================
-
-OriginateRequest_VariablesEntry_DoNotUse::OriginateRequest_VariablesEntry_DoNotUse() {}
-OriginateRequest_VariablesEntry_DoNotUse::OriginateRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-    : SuperType(arena) {}
-void OriginateRequest_VariablesEntry_DoNotUse::MergeFrom(const OriginateRequest_VariablesEntry_DoNotUse& other) {
-  MergeFromInternal(other);
-}
-::PROTOBUF_NAMESPACE_ID::Metadata OriginateRequest_VariablesEntry_DoNotUse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata OriginateResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[36]);
+      file_level_metadata_fs_2eproto[47]);
 }
 
 // ===================================================================
 
-class OriginateRequest::_Internal {
+class OriginateAsyncResponse::_Internal {
  public:
+  static const ::fs::ErrorExecute& error(const OriginateAsyncResponse* msg);
 };
 
-OriginateRequest::OriginateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::fs::ErrorExecute&
+OriginateAsyncResponse::_Internal::error(const OriginateAsyncResponse* msg) {
+  return *msg->_impl_.error_;
+}
+OriginateAsyncResponse::OriginateAsyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  if (arena != nullptr && !is_message_owned) {
-    arena->OwnCustomDestructor(this, &OriginateRequest::ArenaDtor);
-  }
-  // @@protoc_insertion_point(arena_constructor:fs.OriginateRequest)
+  // @@protoc_insertion_point(arena_constructor:fs.OriginateAsyncResponse)
 }
-OriginateRequest::OriginateRequest(const OriginateRequest& from)
+OriginateAsyncResponse::OriginateAsyncResponse(const OriginateAsyncResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  OriginateRequest* const _this = this; (void)_this;
+  OriginateAsyncResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{}
-    , decltype(_impl_.endpoints_){from._impl_.endpoints_}
-    , decltype(_impl_.extensions_){from._impl_.extensions_}
-    , decltype(_impl_.destination_){}
-    , decltype(_impl_.callernumber_){}
-    , decltype(_impl_.callername_){}
-    , decltype(_impl_.context_){}
-    , decltype(_impl_.dialplan_){}
-    , decltype(_impl_.check_id_){}
-    , decltype(_impl_.strategy_){}
-    , decltype(_impl_.timeout_){}
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.error_){nullptr}
+    , decltype(_impl_.state_){}
+    , decltype(_impl_.error_code_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  _impl_.destination_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.destination_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_destination().empty()) {
-    _this->_impl_.destination_.Set(from._internal_destination(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.callernumber_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.callernumber_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_callernumber().empty()) {
-    _this->_impl_.callernumber_.Set(from._internal_callernumber(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.callername_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.callername_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_callername().empty()) {
-    _this->_impl_.callername_.Set(from._internal_callername(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.context_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.context_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_context().empty()) {
-    _this->_impl_.context_.Set(from._internal_context(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.dialplan_.InitDefault();
+  _impl_.uuid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.dialplan_.Set("", GetArenaForAllocation());
+    _impl_.uuid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_dialplan().empty()) {
-    _this->_impl_.dialplan_.Set(from._internal_dialplan(), 
+  if (!from._internal_uuid().empty()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.check_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.check_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_check_id().empty()) {
-    _this->_impl_.check_id_.Set(from._internal_check_id(), 
-      _this->GetArenaForAllocation());
+  if (from._internal_has_error()) {
+    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
   }
-  ::memcpy(&_impl_.strategy_, &from._impl_.strategy_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timeout_) -
-    reinterpret_cast<char*>(&_impl_.strategy_)) + sizeof(_impl_.timeout_));
-  // @@protoc_insertion_point(copy_constructor:fs.OriginateRequest)
+  ::memcpy(&_impl_.state_, &from._impl_.state_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.error_code_) -
+    reinterpret_cast<char*>(&_impl_.state_)) + sizeof(_impl_.error_code_));
+  // @@protoc_insertion_point(copy_constructor:fs.OriginateAsyncResponse)
 }
 
-inline void OriginateRequest::SharedCtor(
+inline void OriginateAsyncResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      /*decltype(_impl_.variables_)*/{::_pbi::ArenaInitialized(), arena}
-    , decltype(_impl_.endpoints_){arena}
-    , decltype(_impl_.extensions_){arena}
-    , decltype(_impl_.destination_){}
-    , decltype(_impl_.callernumber_){}
-    , decltype(_impl_.callername_){}
-    , decltype(_impl_.context_){}
-    , decltype(_impl_.dialplan_){}
-    , decltype(_impl_.check_id_){}
-    , decltype(_impl_.strategy_){0}
-    , decltype(_impl_.timeout_){0}
+      decltype(_impl_.uuid_){}
+    , decltype(_impl_.error_){nullptr}
+    , decltype(_impl_.state_){0}
+    , decltype(_impl_.error_code_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.destination_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.destination_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.callernumber_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.callernumber_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.callername_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.callername_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.context_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.context_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.dialplan_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.dialplan_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.check_id_.InitDefault();
+  _impl_.uuid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.check_id_.Set("", GetArenaForAllocation());
+    _impl_.uuid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-OriginateRequest::~OriginateRequest() {
-  // @@protoc_insertion_point(destructor:fs.OriginateRequest)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    ArenaDtor(this);
-    return;
-  }
-  SharedDtor();
-}
-
-inline void OriginateRequest::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.variables_.Destruct();
-  _impl_.variables_.~MapField();
-  _impl_.endpoints_.~RepeatedPtrField();
-  _impl_.extensions_.~RepeatedPtrField();
-  _impl_.destination_.Destroy();
-  _impl_.callernumber_.Destroy();
-  _impl_.callername_.Destroy();
-  _impl_.context_.Destroy();
-  _impl_.dialplan_.Destroy();
-  _impl_.check_id_.Destroy();
-}
-
-void OriginateRequest::ArenaDtor(void* object) {
-  OriginateRequest* _this = reinterpret_cast< OriginateRequest* >(object);
-  _this->_impl_.variables_.Destruct();
+OriginateAsyncResponse::~OriginateAsyncResponse() {
+  // @@protoc_insertion_point(destructor:fs.OriginateAsyncResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-void OriginateRequest::SetCachedSize(int size) const {
+
+inline void OriginateAsyncResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.error_;
+}
+
+void OriginateAsyncResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void OriginateRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.OriginateRequest)
+void OriginateAsyncResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.OriginateAsyncResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.variables_.Clear();
-  _impl_.endpoints_.Clear();
-  _impl_.extensions_.Clear();
-  _impl_.destination_.ClearToEmpty();
-  _impl_.callernumber_.ClearToEmpty();
-  _impl_.callername_.ClearToEmpty();
-  _impl_.context_.ClearToEmpty();
-  _impl_.dialplan_.ClearToEmpty();
-  _impl_.check_id_.ClearToEmpty();
-  ::memset(&_impl_.strategy_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.timeout_) -
-      reinterpret_cast<char*>(&_impl_.strategy_)) + sizeof(_impl_.timeout_));
+  _impl_.uuid_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
+  ::memset(&_impl_.state_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.error_code_) -
+      reinterpret_cast<char*>(&_impl_.state_)) + sizeof(_impl_.error_code_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* OriginateRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* OriginateAsyncResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // map<string, string> variables = 1;
+      // string uuid = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(&_impl_.variables_, ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated string endpoints = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            auto str = _internal_add_endpoints();
-            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-            CHK_(ptr);
-            CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.endpoints"));
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
-      // .fs.OriginateRequest.Strategy strategy = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-          _internal_set_strategy(static_cast<::fs::OriginateRequest_Strategy>(val));
-        } else
-          goto handle_unusual;
-        continue;
-      // string destination = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_destination();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.destination"));
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 timeout = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          _impl_.timeout_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // string callerNumber = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          auto str = _internal_mutable_callernumber();
+          auto str = _internal_mutable_uuid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.callerNumber"));
+          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateAsyncResponse.uuid"));
         } else
           goto handle_unusual;
         continue;
-      // string callerName = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
-          auto str = _internal_mutable_callername();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+      // .fs.OriginateAsyncResponse.State state = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.callerName"));
+          _internal_set_state(static_cast<::fs::OriginateAsyncResponse_State>(val));
         } else
           goto handle_unusual;
         continue;
-      // string context = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
-          auto str = _internal_mutable_context();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+      // .fs.ErrorExecute error = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.context"));
         } else
           goto handle_unusual;
         continue;
-      // string dialplan = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
-          auto str = _internal_mutable_dialplan();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+      // int32 error_code = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.error_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.dialplan"));
         } else
           goto handle_unusual;
         continue;
-      // repeated .fs.OriginateRequest.Extension extensions = 10;
-      case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OriginateAsyncResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:fs.OriginateAsyncResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string uuid = 1;
+  if (!this->_internal_uuid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "fs.OriginateAsyncResponse.uuid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_uuid(), target);
+  }
+
+  // .fs.OriginateAsyncResponse.State state = 2;
+  if (this->_internal_state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_state(), target);
+  }
+
+  // .fs.ErrorExecute error = 3;
+  if (this->_internal_has_error()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::error(this),
+        _Internal::error(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 error_code = 4;
+  if (this->_internal_error_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_error_code(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.OriginateAsyncResponse)
+  return target;
+}
+
+size_t OriginateAsyncResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.OriginateAsyncResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string uuid = 1;
+  if (!this->_internal_uuid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
+  }
+
+  // .fs.ErrorExecute error = 3;
+  if (this->_internal_has_error()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.error_);
+  }
+
+  // .fs.OriginateAsyncResponse.State state = 2;
+  if (this->_internal_state() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_state());
+  }
+
+  // int32 error_code = 4;
+  if (this->_internal_error_code() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_error_code());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OriginateAsyncResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OriginateAsyncResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OriginateAsyncResponse::GetClassData() const { return &_class_data_; }
+
+
+void OriginateAsyncResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OriginateAsyncResponse*>(&to_msg);
+  auto& from = static_cast<const OriginateAsyncResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.OriginateAsyncResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_uuid().empty()) {
+    _this->_internal_set_uuid(from._internal_uuid());
+  }
+  if (from._internal_has_error()) {
+    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
+        from._internal_error());
+  }
+  if (from._internal_state() != 0) {
+    _this->_internal_set_state(from._internal_state());
+  }
+  if (from._internal_error_code() != 0) {
+    _this->_internal_set_error_code(from._internal_error_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OriginateAsyncResponse::CopyFrom(const OriginateAsyncResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.OriginateAsyncResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OriginateAsyncResponse::IsInitialized() const {
+  return true;
+}
+
+void OriginateAsyncResponse::InternalSwap(OriginateAsyncResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OriginateAsyncResponse, _impl_.error_code_)
+      + sizeof(OriginateAsyncResponse::_impl_.error_code_)
+      - PROTOBUF_FIELD_OFFSET(OriginateAsyncResponse, _impl_.error_)>(
+          reinterpret_cast<char*>(&_impl_.error_),
+          reinterpret_cast<char*>(&other->_impl_.error_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OriginateAsyncResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
+      file_level_metadata_fs_2eproto[48]);
+}
+
+// ===================================================================
+
+class OriginateBatchRequest::_Internal {
+ public:
+};
+
+OriginateBatchRequest::OriginateBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:fs.OriginateBatchRequest)
+}
+OriginateBatchRequest::OriginateBatchRequest(const OriginateBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OriginateBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.requests_){from._impl_.requests_}
+    , decltype(_impl_.concurrency_){}
+    , decltype(_impl_.rate_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.concurrency_, &from._impl_.concurrency_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.rate_) -
+    reinterpret_cast<char*>(&_impl_.concurrency_)) + sizeof(_impl_.rate_));
+  // @@protoc_insertion_point(copy_constructor:fs.OriginateBatchRequest)
+}
+
+inline void OriginateBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.requests_){arena}
+    , decltype(_impl_.concurrency_){0}
+    , decltype(_impl_.rate_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+OriginateBatchRequest::~OriginateBatchRequest() {
+  // @@protoc_insertion_point(destructor:fs.OriginateBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OriginateBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.requests_.~RepeatedPtrField();
+}
+
+void OriginateBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OriginateBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.OriginateBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.requests_.Clear();
+  ::memset(&_impl_.concurrency_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.rate_) -
+      reinterpret_cast<char*>(&_impl_.concurrency_)) + sizeof(_impl_.rate_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OriginateBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .fs.OriginateRequest requests = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_extensions(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_requests(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // string check_id = 11;
-      case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
-          auto str = _internal_mutable_check_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+      // int32 concurrency = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.concurrency_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 rate = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.rate_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateRequest.check_id"));
         } else
           goto handle_unusual;
         continue;
@@ -8614,391 +14753,168 @@ failure:
 #undef CHK_
 }
 
-uint8_t* OriginateRequest::_InternalSerialize(
+uint8_t* OriginateBatchRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.OriginateRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.OriginateBatchRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // map<string, string> variables = 1;
-  if (!this->_internal_variables().empty()) {
-    using MapType = ::_pb::Map<std::string, std::string>;
-    using WireHelper = OriginateRequest_VariablesEntry_DoNotUse::Funcs;
-    const auto& map_field = this->_internal_variables();
-    auto check_utf8 = [](const MapType::value_type& entry) {
-      (void)entry;
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.first.data(), static_cast<int>(entry.first.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.OriginateRequest.VariablesEntry.key");
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-        entry.second.data(), static_cast<int>(entry.second.length()),
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-        "fs.OriginateRequest.VariablesEntry.value");
-    };
-
-    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
-      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
-        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    } else {
-      for (const auto& entry : map_field) {
-        target = WireHelper::InternalSerialize(1, entry.first, entry.second, target, stream);
-        check_utf8(entry);
-      }
-    }
-  }
-
-  // repeated string endpoints = 2;
-  for (int i = 0, n = this->_internal_endpoints_size(); i < n; i++) {
-    const auto& s = this->_internal_endpoints(i);
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      s.data(), static_cast<int>(s.length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.OriginateRequest.endpoints");
-    target = stream->WriteString(2, s, target);
-  }
-
-  // .fs.OriginateRequest.Strategy strategy = 3;
-  if (this->_internal_strategy() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteEnumToArray(
-      3, this->_internal_strategy(), target);
-  }
-
-  // string destination = 4;
-  if (!this->_internal_destination().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_destination().data(), static_cast<int>(this->_internal_destination().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.OriginateRequest.destination");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_destination(), target);
-  }
-
-  // int32 timeout = 5;
-  if (this->_internal_timeout() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_timeout(), target);
-  }
-
-  // string callerNumber = 6;
-  if (!this->_internal_callernumber().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_callernumber().data(), static_cast<int>(this->_internal_callernumber().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.OriginateRequest.callerNumber");
-    target = stream->WriteStringMaybeAliased(
-        6, this->_internal_callernumber(), target);
-  }
-
-  // string callerName = 7;
-  if (!this->_internal_callername().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_callername().data(), static_cast<int>(this->_internal_callername().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.OriginateRequest.callerName");
-    target = stream->WriteStringMaybeAliased(
-        7, this->_internal_callername(), target);
-  }
-
-  // string context = 8;
-  if (!this->_internal_context().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_context().data(), static_cast<int>(this->_internal_context().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.OriginateRequest.context");
-    target = stream->WriteStringMaybeAliased(
-        8, this->_internal_context(), target);
-  }
-
-  // string dialplan = 9;
-  if (!this->_internal_dialplan().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_dialplan().data(), static_cast<int>(this->_internal_dialplan().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.OriginateRequest.dialplan");
-    target = stream->WriteStringMaybeAliased(
-        9, this->_internal_dialplan(), target);
-  }
-
-  // repeated .fs.OriginateRequest.Extension extensions = 10;
+  // repeated .fs.OriginateRequest requests = 1;
   for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_extensions_size()); i < n; i++) {
-    const auto& repfield = this->_internal_extensions(i);
+      n = static_cast<unsigned>(this->_internal_requests_size()); i < n; i++) {
+    const auto& repfield = this->_internal_requests(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(10, repfield, repfield.GetCachedSize(), target, stream);
-  }
-
-  // string check_id = 11;
-  if (!this->_internal_check_id().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_check_id().data(), static_cast<int>(this->_internal_check_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.OriginateRequest.check_id");
-    target = stream->WriteStringMaybeAliased(
-        11, this->_internal_check_id(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.OriginateRequest)
-  return target;
-}
-
-size_t OriginateRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.OriginateRequest)
-  size_t total_size = 0;
-
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // map<string, string> variables = 1;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_variables_size());
-  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
-      it = this->_internal_variables().begin();
-      it != this->_internal_variables().end(); ++it) {
-    total_size += OriginateRequest_VariablesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
-  }
-
-  // repeated string endpoints = 2;
-  total_size += 1 *
-      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.endpoints_.size());
-  for (int i = 0, n = _impl_.endpoints_.size(); i < n; i++) {
-    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-      _impl_.endpoints_.Get(i));
-  }
-
-  // repeated .fs.OriginateRequest.Extension extensions = 10;
-  total_size += 1UL * this->_internal_extensions_size();
-  for (const auto& msg : this->_impl_.extensions_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // string destination = 4;
-  if (!this->_internal_destination().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_destination());
-  }
-
-  // string callerNumber = 6;
-  if (!this->_internal_callernumber().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_callernumber());
-  }
-
-  // string callerName = 7;
-  if (!this->_internal_callername().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_callername());
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // string context = 8;
-  if (!this->_internal_context().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_context());
+  // int32 concurrency = 2;
+  if (this->_internal_concurrency() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_concurrency(), target);
   }
 
-  // string dialplan = 9;
-  if (!this->_internal_dialplan().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_dialplan());
+  // int32 rate = 3;
+  if (this->_internal_rate() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_rate(), target);
   }
 
-  // string check_id = 11;
-  if (!this->_internal_check_id().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_check_id());
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:fs.OriginateBatchRequest)
+  return target;
+}
 
-  // .fs.OriginateRequest.Strategy strategy = 3;
-  if (this->_internal_strategy() != 0) {
-    total_size += 1 +
-      ::_pbi::WireFormatLite::EnumSize(this->_internal_strategy());
+size_t OriginateBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.OriginateBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .fs.OriginateRequest requests = 1;
+  total_size += 1UL * this->_internal_requests_size();
+  for (const auto& msg : this->_impl_.requests_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // int32 timeout = 5;
-  if (this->_internal_timeout() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_timeout());
+  // int32 concurrency = 2;
+  if (this->_internal_concurrency() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_concurrency());
+  }
+
+  // int32 rate = 3;
+  if (this->_internal_rate() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_rate());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OriginateRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OriginateBatchRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    OriginateRequest::MergeImpl
+    OriginateBatchRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OriginateRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OriginateBatchRequest::GetClassData() const { return &_class_data_; }
 
 
-void OriginateRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<OriginateRequest*>(&to_msg);
-  auto& from = static_cast<const OriginateRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.OriginateRequest)
+void OriginateBatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OriginateBatchRequest*>(&to_msg);
+  auto& from = static_cast<const OriginateBatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.OriginateBatchRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.variables_.MergeFrom(from._impl_.variables_);
-  _this->_impl_.endpoints_.MergeFrom(from._impl_.endpoints_);
-  _this->_impl_.extensions_.MergeFrom(from._impl_.extensions_);
-  if (!from._internal_destination().empty()) {
-    _this->_internal_set_destination(from._internal_destination());
-  }
-  if (!from._internal_callernumber().empty()) {
-    _this->_internal_set_callernumber(from._internal_callernumber());
+  _this->_impl_.requests_.MergeFrom(from._impl_.requests_);
+  if (from._internal_concurrency() != 0) {
+    _this->_internal_set_concurrency(from._internal_concurrency());
   }
-  if (!from._internal_callername().empty()) {
-    _this->_internal_set_callername(from._internal_callername());
-  }
-  if (!from._internal_context().empty()) {
-    _this->_internal_set_context(from._internal_context());
-  }
-  if (!from._internal_dialplan().empty()) {
-    _this->_internal_set_dialplan(from._internal_dialplan());
-  }
-  if (!from._internal_check_id().empty()) {
-    _this->_internal_set_check_id(from._internal_check_id());
-  }
-  if (from._internal_strategy() != 0) {
-    _this->_internal_set_strategy(from._internal_strategy());
-  }
-  if (from._internal_timeout() != 0) {
-    _this->_internal_set_timeout(from._internal_timeout());
+  if (from._internal_rate() != 0) {
+    _this->_internal_set_rate(from._internal_rate());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void OriginateRequest::CopyFrom(const OriginateRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.OriginateRequest)
+void OriginateBatchRequest::CopyFrom(const OriginateBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.OriginateBatchRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool OriginateRequest::IsInitialized() const {
+bool OriginateBatchRequest::IsInitialized() const {
   return true;
 }
 
-void OriginateRequest::InternalSwap(OriginateRequest* other) {
+void OriginateBatchRequest::InternalSwap(OriginateBatchRequest* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.variables_.InternalSwap(&other->_impl_.variables_);
-  _impl_.endpoints_.InternalSwap(&other->_impl_.endpoints_);
-  _impl_.extensions_.InternalSwap(&other->_impl_.extensions_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.destination_, lhs_arena,
-      &other->_impl_.destination_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.callernumber_, lhs_arena,
-      &other->_impl_.callernumber_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.callername_, lhs_arena,
-      &other->_impl_.callername_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.context_, lhs_arena,
-      &other->_impl_.context_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.dialplan_, lhs_arena,
-      &other->_impl_.dialplan_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.check_id_, lhs_arena,
-      &other->_impl_.check_id_, rhs_arena
-  );
+  _impl_.requests_.InternalSwap(&other->_impl_.requests_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(OriginateRequest, _impl_.timeout_)
-      + sizeof(OriginateRequest::_impl_.timeout_)
-      - PROTOBUF_FIELD_OFFSET(OriginateRequest, _impl_.strategy_)>(
-          reinterpret_cast<char*>(&_impl_.strategy_),
-          reinterpret_cast<char*>(&other->_impl_.strategy_));
+      PROTOBUF_FIELD_OFFSET(OriginateBatchRequest, _impl_.rate_)
+      + sizeof(OriginateBatchRequest::_impl_.rate_)
+      - PROTOBUF_FIELD_OFFSET(OriginateBatchRequest, _impl_.concurrency_)>(
+          reinterpret_cast<char*>(&_impl_.concurrency_),
+          reinterpret_cast<char*>(&other->_impl_.concurrency_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata OriginateRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata OriginateBatchRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[37]);
+      file_level_metadata_fs_2eproto[49]);
 }
 
 // ===================================================================
 
-class OriginateResponse::_Internal {
+class OriginateBatchResponse::_Internal {
  public:
-  static const ::fs::ErrorExecute& error(const OriginateResponse* msg);
+  static const ::fs::OriginateResponse& result(const OriginateBatchResponse* msg);
 };
 
-const ::fs::ErrorExecute&
-OriginateResponse::_Internal::error(const OriginateResponse* msg) {
-  return *msg->_impl_.error_;
+const ::fs::OriginateResponse&
+OriginateBatchResponse::_Internal::result(const OriginateBatchResponse* msg) {
+  return *msg->_impl_.result_;
 }
-OriginateResponse::OriginateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+OriginateBatchResponse::OriginateBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:fs.OriginateResponse)
+  // @@protoc_insertion_point(arena_constructor:fs.OriginateBatchResponse)
 }
-OriginateResponse::OriginateResponse(const OriginateResponse& from)
+OriginateBatchResponse::OriginateBatchResponse(const OriginateBatchResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  OriginateResponse* const _this = this; (void)_this;
+  OriginateBatchResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.uuid_){}
-    , decltype(_impl_.error_){nullptr}
-    , decltype(_impl_.error_code_){}
+      decltype(_impl_.result_){nullptr}
+    , decltype(_impl_.index_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.uuid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.uuid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_uuid().empty()) {
-    _this->_impl_.uuid_.Set(from._internal_uuid(), 
-      _this->GetArenaForAllocation());
+  if (from._internal_has_result()) {
+    _this->_impl_.result_ = new ::fs::OriginateResponse(*from._impl_.result_);
   }
-  if (from._internal_has_error()) {
-    _this->_impl_.error_ = new ::fs::ErrorExecute(*from._impl_.error_);
-  }
-  _this->_impl_.error_code_ = from._impl_.error_code_;
-  // @@protoc_insertion_point(copy_constructor:fs.OriginateResponse)
+  _this->_impl_.index_ = from._impl_.index_;
+  // @@protoc_insertion_point(copy_constructor:fs.OriginateBatchResponse)
 }
 
-inline void OriginateResponse::SharedCtor(
+inline void OriginateBatchResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.uuid_){}
-    , decltype(_impl_.error_){nullptr}
-    , decltype(_impl_.error_code_){0}
+      decltype(_impl_.result_){nullptr}
+    , decltype(_impl_.index_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.uuid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.uuid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-OriginateResponse::~OriginateResponse() {
-  // @@protoc_insertion_point(destructor:fs.OriginateResponse)
+OriginateBatchResponse::~OriginateBatchResponse() {
+  // @@protoc_insertion_point(destructor:fs.OriginateBatchResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -9006,59 +14922,47 @@ OriginateResponse::~OriginateResponse() {
   SharedDtor();
 }
 
-inline void OriginateResponse::SharedDtor() {
+inline void OriginateBatchResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.uuid_.Destroy();
-  if (this != internal_default_instance()) delete _impl_.error_;
+  if (this != internal_default_instance()) delete _impl_.result_;
 }
 
-void OriginateResponse::SetCachedSize(int size) const {
+void OriginateBatchResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void OriginateResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:fs.OriginateResponse)
+void OriginateBatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:fs.OriginateBatchResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.uuid_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
-    delete _impl_.error_;
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
   }
-  _impl_.error_ = nullptr;
-  _impl_.error_code_ = 0;
+  _impl_.result_ = nullptr;
+  _impl_.index_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* OriginateResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* OriginateBatchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string uuid = 1;
+      // int32 index = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_uuid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "fs.OriginateResponse.uuid"));
         } else
           goto handle_unusual;
         continue;
-      // .fs.ErrorExecute error = 2;
+      // .fs.OriginateResponse result = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_error(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int32 error_code = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.error_code_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -9086,133 +14990,107 @@ failure:
 #undef CHK_
 }
 
-uint8_t* OriginateResponse::_InternalSerialize(
+uint8_t* OriginateBatchResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:fs.OriginateResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:fs.OriginateBatchResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string uuid = 1;
-  if (!this->_internal_uuid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_uuid().data(), static_cast<int>(this->_internal_uuid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "fs.OriginateResponse.uuid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_uuid(), target);
+  // int32 index = 1;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_index(), target);
   }
 
-  // .fs.ErrorExecute error = 2;
-  if (this->_internal_has_error()) {
+  // .fs.OriginateResponse result = 2;
+  if (this->_internal_has_result()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::error(this),
-        _Internal::error(this).GetCachedSize(), target, stream);
-  }
-
-  // int32 error_code = 3;
-  if (this->_internal_error_code() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_error_code(), target);
+      InternalWriteMessage(2, _Internal::result(this),
+        _Internal::result(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:fs.OriginateResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:fs.OriginateBatchResponse)
   return target;
 }
 
-size_t OriginateResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:fs.OriginateResponse)
+size_t OriginateBatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:fs.OriginateBatchResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string uuid = 1;
-  if (!this->_internal_uuid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_uuid());
-  }
-
-  // .fs.ErrorExecute error = 2;
-  if (this->_internal_has_error()) {
+  // .fs.OriginateResponse result = 2;
+  if (this->_internal_has_result()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.error_);
+        *_impl_.result_);
   }
 
-  // int32 error_code = 3;
-  if (this->_internal_error_code() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_error_code());
+  // int32 index = 1;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_index());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OriginateResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OriginateBatchResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    OriginateResponse::MergeImpl
+    OriginateBatchResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OriginateResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OriginateBatchResponse::GetClassData() const { return &_class_data_; }
 
 
-void OriginateResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<OriginateResponse*>(&to_msg);
-  auto& from = static_cast<const OriginateResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:fs.OriginateResponse)
+void OriginateBatchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OriginateBatchResponse*>(&to_msg);
+  auto& from = static_cast<const OriginateBatchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:fs.OriginateBatchResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_uuid().empty()) {
-    _this->_internal_set_uuid(from._internal_uuid());
-  }
-  if (from._internal_has_error()) {
-    _this->_internal_mutable_error()->::fs::ErrorExecute::MergeFrom(
-        from._internal_error());
+  if (from._internal_has_result()) {
+    _this->_internal_mutable_result()->::fs::OriginateResponse::MergeFrom(
+        from._internal_result());
   }
-  if (from._internal_error_code() != 0) {
-    _this->_internal_set_error_code(from._internal_error_code());
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void OriginateResponse::CopyFrom(const OriginateResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:fs.OriginateResponse)
+void OriginateBatchResponse::CopyFrom(const OriginateBatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:fs.OriginateBatchResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool OriginateResponse::IsInitialized() const {
+bool OriginateBatchResponse::IsInitialized() const {
   return true;
 }
 
-void OriginateResponse::InternalSwap(OriginateResponse* other) {
+void OriginateBatchResponse::InternalSwap(OriginateBatchResponse* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.uuid_, lhs_arena,
-      &other->_impl_.uuid_, rhs_arena
-  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(OriginateResponse, _impl_.error_code_)
-      + sizeof(OriginateResponse::_impl_.error_code_)
-      - PROTOBUF_FIELD_OFFSET(OriginateResponse, _impl_.error_)>(
-          reinterpret_cast<char*>(&_impl_.error_),
-          reinterpret_cast<char*>(&other->_impl_.error_));
+      PROTOBUF_FIELD_OFFSET(OriginateBatchResponse, _impl_.index_)
+      + sizeof(OriginateBatchResponse::_impl_.index_)
+      - PROTOBUF_FIELD_OFFSET(OriginateBatchResponse, _impl_.result_)>(
+          reinterpret_cast<char*>(&_impl_.result_),
+          reinterpret_cast<char*>(&other->_impl_.result_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata OriginateResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata OriginateBatchResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[38]);
+      file_level_metadata_fs_2eproto[50]);
 }
 
 // ===================================================================
@@ -9515,7 +15393,7 @@ void BridgeRequest::InternalSwap(BridgeRequest* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata BridgeRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[39]);
+      file_level_metadata_fs_2eproto[51]);
 }
 
 // ===================================================================
@@ -9760,7 +15638,7 @@ void BridgeResponse::InternalSwap(BridgeResponse* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata BridgeResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[40]);
+      file_level_metadata_fs_2eproto[52]);
 }
 
 // ===================================================================
@@ -9774,7 +15652,7 @@ void SetVariablesRequest_VariablesEntry_DoNotUse::MergeFrom(const SetVariablesRe
 ::PROTOBUF_NAMESPACE_ID::Metadata SetVariablesRequest_VariablesEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[41]);
+      file_level_metadata_fs_2eproto[53]);
 }
 
 // ===================================================================
@@ -10045,7 +15923,7 @@ void SetVariablesRequest::InternalSwap(SetVariablesRequest* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SetVariablesRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[42]);
+      file_level_metadata_fs_2eproto[54]);
 }
 
 // ===================================================================
@@ -10238,7 +16116,7 @@ void SetVariablesResponse::InternalSwap(SetVariablesResponse* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SetVariablesResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[43]);
+      file_level_metadata_fs_2eproto[55]);
 }
 
 // ===================================================================
@@ -10252,7 +16130,7 @@ void HangupMatchingVarsReqeust_VariablesEntry_DoNotUse::MergeFrom(const HangupMa
 ::PROTOBUF_NAMESPACE_ID::Metadata HangupMatchingVarsReqeust_VariablesEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[44]);
+      file_level_metadata_fs_2eproto[56]);
 }
 
 // ===================================================================
@@ -10523,7 +16401,7 @@ void HangupMatchingVarsReqeust::InternalSwap(HangupMatchingVarsReqeust* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata HangupMatchingVarsReqeust::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[45]);
+      file_level_metadata_fs_2eproto[57]);
 }
 
 // ===================================================================
@@ -10701,12 +16579,48 @@ void HangupMatchingVarsResponse::InternalSwap(HangupMatchingVarsResponse* other)
 ::PROTOBUF_NAMESPACE_ID::Metadata HangupMatchingVarsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_fs_2eproto_getter, &descriptor_table_fs_2eproto_once,
-      file_level_metadata_fs_2eproto[46]);
+      file_level_metadata_fs_2eproto[58]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace fs
 PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::fs::SubscribeCallEventsRequest*
+Arena::CreateMaybeMessage< ::fs::SubscribeCallEventsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::SubscribeCallEventsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::CallEvent*
+Arena::CreateMaybeMessage< ::fs::CallEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::CallEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::CallEventPayload_Endpoint*
+Arena::CreateMaybeMessage< ::fs::CallEventPayload_Endpoint >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::CallEventPayload_Endpoint >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::CallEventPayload_Parameters*
+Arena::CreateMaybeMessage< ::fs::CallEventPayload_Parameters >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::CallEventPayload_Parameters >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::CallEventPayload_Eavesdrop*
+Arena::CreateMaybeMessage< ::fs::CallEventPayload_Eavesdrop >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::CallEventPayload_Eavesdrop >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::CallEventPayload_Call*
+Arena::CreateMaybeMessage< ::fs::CallEventPayload_Call >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::CallEventPayload_Call >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::CallEventPayload_PayloadEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::fs::CallEventPayload_PayloadEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::CallEventPayload_PayloadEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::CallEventPayload_QueueEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::fs::CallEventPayload_QueueEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::CallEventPayload_QueueEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::CallEventPayload*
+Arena::CreateMaybeMessage< ::fs::CallEventPayload >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::CallEventPayload >(arena);
+}
 template<> PROTOBUF_NOINLINE ::fs::BreakParkRequest_VariablesEntry_DoNotUse*
 Arena::CreateMaybeMessage< ::fs::BreakParkRequest_VariablesEntry_DoNotUse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::fs::BreakParkRequest_VariablesEntry_DoNotUse >(arena);
@@ -10863,6 +16777,18 @@ template<> PROTOBUF_NOINLINE ::fs::OriginateResponse*
 Arena::CreateMaybeMessage< ::fs::OriginateResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::fs::OriginateResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::fs::OriginateAsyncResponse*
+Arena::CreateMaybeMessage< ::fs::OriginateAsyncResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::OriginateAsyncResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::OriginateBatchRequest*
+Arena::CreateMaybeMessage< ::fs::OriginateBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::OriginateBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::fs::OriginateBatchResponse*
+Arena::CreateMaybeMessage< ::fs::OriginateBatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::fs::OriginateBatchResponse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::fs::BridgeRequest*
 Arena::CreateMaybeMessage< ::fs::BridgeRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::fs::BridgeRequest >(arena);
@@ -89,6 +89,30 @@ extern BroadcastRequestDefaultTypeInternal _BroadcastRequest_default_instance_;
 class BroadcastResponse;
 struct BroadcastResponseDefaultTypeInternal;
 extern BroadcastResponseDefaultTypeInternal _BroadcastResponse_default_instance_;
+class CallEvent;
+struct CallEventDefaultTypeInternal;
+extern CallEventDefaultTypeInternal _CallEvent_default_instance_;
+class CallEventPayload;
+struct CallEventPayloadDefaultTypeInternal;
+extern CallEventPayloadDefaultTypeInternal _CallEventPayload_default_instance_;
+class CallEventPayload_Call;
+struct CallEventPayload_CallDefaultTypeInternal;
+extern CallEventPayload_CallDefaultTypeInternal _CallEventPayload_Call_default_instance_;
+class CallEventPayload_Eavesdrop;
+struct CallEventPayload_EavesdropDefaultTypeInternal;
+extern CallEventPayload_EavesdropDefaultTypeInternal _CallEventPayload_Eavesdrop_default_instance_;
+class CallEventPayload_Endpoint;
+struct CallEventPayload_EndpointDefaultTypeInternal;
+extern CallEventPayload_EndpointDefaultTypeInternal _CallEventPayload_Endpoint_default_instance_;
+class CallEventPayload_Parameters;
+struct CallEventPayload_ParametersDefaultTypeInternal;
+extern CallEventPayload_ParametersDefaultTypeInternal _CallEventPayload_Parameters_default_instance_;
+class CallEventPayload_PayloadEntry_DoNotUse;
+struct CallEventPayload_PayloadEntry_DoNotUseDefaultTypeInternal;
+extern CallEventPayload_PayloadEntry_DoNotUseDefaultTypeInternal _CallEventPayload_PayloadEntry_DoNotUse_default_instance_;
+class CallEventPayload_QueueEntry_DoNotUse;
+struct CallEventPayload_QueueEntry_DoNotUseDefaultTypeInternal;
+extern CallEventPayload_QueueEntry_DoNotUseDefaultTypeInternal _CallEventPayload_QueueEntry_DoNotUse_default_instance_;
 class ConfirmPushRequest;
 struct ConfirmPushRequestDefaultTypeInternal;
 extern ConfirmPushRequestDefaultTypeInternal _ConfirmPushRequest_default_instance_;
@@ -134,6 +158,15 @@ extern HoldRequestDefaultTypeInternal _HoldRequest_default_instance_;
 class HoldResponse;
 struct HoldResponseDefaultTypeInternal;
 extern HoldResponseDefaultTypeInternal _HoldResponse_default_instance_;
+class OriginateAsyncResponse;
+struct OriginateAsyncResponseDefaultTypeInternal;
+extern OriginateAsyncResponseDefaultTypeInternal _OriginateAsyncResponse_default_instance_;
+class OriginateBatchRequest;
+struct OriginateBatchRequestDefaultTypeInternal;
+extern OriginateBatchRequestDefaultTypeInternal _OriginateBatchRequest_default_instance_;
+class OriginateBatchResponse;
+struct OriginateBatchResponseDefaultTypeInternal;
+extern OriginateBatchResponseDefaultTypeInternal _OriginateBatchResponse_default_instance_;
 class OriginateRequest;
 struct OriginateRequestDefaultTypeInternal;
 extern OriginateRequestDefaultTypeInternal _OriginateRequest_default_instance_;
@@ -185,6 +218,9 @@ extern StopPlaybackRequestDefaultTypeInternal _StopPlaybackRequest_default_insta
 class StopPlaybackResponse;
 struct StopPlaybackResponseDefaultTypeInternal;
 extern StopPlaybackResponseDefaultTypeInternal _StopPlaybackResponse_default_instance_;
+class SubscribeCallEventsRequest;
+struct SubscribeCallEventsRequestDefaultTypeInternal;
+extern SubscribeCallEventsRequestDefaultTypeInternal _SubscribeCallEventsRequest_default_instance_;
 class UnHoldRequest;
 struct UnHoldRequestDefaultTypeInternal;
 extern UnHoldRequestDefaultTypeInternal _UnHoldRequest_default_instance_;
@@ -206,6 +242,14 @@ template<> ::fs::BridgeRequest* Arena::CreateMaybeMessage<::fs::BridgeRequest>(A
 template<> ::fs::BridgeResponse* Arena::CreateMaybeMessage<::fs::BridgeResponse>(Arena*);
 template<> ::fs::BroadcastRequest* Arena::CreateMaybeMessage<::fs::BroadcastRequest>(Arena*);
 template<> ::fs::BroadcastResponse* Arena::CreateMaybeMessage<::fs::BroadcastResponse>(Arena*);
+template<> ::fs::CallEvent* Arena::CreateMaybeMessage<::fs::CallEvent>(Arena*);
+template<> ::fs::CallEventPayload* Arena::CreateMaybeMessage<::fs::CallEventPayload>(Arena*);
+template<> ::fs::CallEventPayload_Call* Arena::CreateMaybeMessage<::fs::CallEventPayload_Call>(Arena*);
+template<> ::fs::CallEventPayload_Eavesdrop* Arena::CreateMaybeMessage<::fs::CallEventPayload_Eavesdrop>(Arena*);
+template<> ::fs::CallEventPayload_Endpoint* Arena::CreateMaybeMessage<::fs::CallEventPayload_Endpoint>(Arena*);
+template<> ::fs::CallEventPayload_Parameters* Arena::CreateMaybeMessage<::fs::CallEventPayload_Parameters>(Arena*);
+template<> ::fs::CallEventPayload_PayloadEntry_DoNotUse* Arena::CreateMaybeMessage<::fs::CallEventPayload_PayloadEntry_DoNotUse>(Arena*);
+template<> ::fs::CallEventPayload_QueueEntry_DoNotUse* Arena::CreateMaybeMessage<::fs::CallEventPayload_QueueEntry_DoNotUse>(Arena*);
 template<> ::fs::ConfirmPushRequest* Arena::CreateMaybeMessage<::fs::ConfirmPushRequest>(Arena*);
 template<> ::fs::ConfirmPushResponse* Arena::CreateMaybeMessage<::fs::ConfirmPushResponse>(Arena*);
 template<> ::fs::ErrorExecute* Arena::CreateMaybeMessage<::fs::ErrorExecute>(Arena*);
@@ -221,6 +265,9 @@ template<> ::fs::HangupRequest_VariablesEntry_DoNotUse* Arena::CreateMaybeMessag
 template<> ::fs::HangupResponse* Arena::CreateMaybeMessage<::fs::HangupResponse>(Arena*);
 template<> ::fs::HoldRequest* Arena::CreateMaybeMessage<::fs::HoldRequest>(Arena*);
 template<> ::fs::HoldResponse* Arena::CreateMaybeMessage<::fs::HoldResponse>(Arena*);
+template<> ::fs::OriginateAsyncResponse* Arena::CreateMaybeMessage<::fs::OriginateAsyncResponse>(Arena*);
+template<> ::fs::OriginateBatchRequest* Arena::CreateMaybeMessage<::fs::OriginateBatchRequest>(Arena*);
+template<> ::fs::OriginateBatchResponse* Arena::CreateMaybeMessage<::fs::OriginateBatchResponse>(Arena*);
 template<> ::fs::OriginateRequest* Arena::CreateMaybeMessage<::fs::OriginateRequest>(Arena*);
 template<> ::fs::OriginateRequest_Extension* Arena::CreateMaybeMessage<::fs::OriginateRequest_Extension>(Arena*);
 template<> ::fs::OriginateRequest_VariablesEntry_DoNotUse* Arena::CreateMaybeMessage<::fs::OriginateRequest_VariablesEntry_DoNotUse>(Arena*);
@@ -238,6 +285,7 @@ template<> ::fs::SetVariablesRequest_VariablesEntry_DoNotUse* Arena::CreateMaybe
 template<> ::fs::SetVariablesResponse* Arena::CreateMaybeMessage<::fs::SetVariablesResponse>(Arena*);
 template<> ::fs::StopPlaybackRequest* Arena::CreateMaybeMessage<::fs::StopPlaybackRequest>(Arena*);
 template<> ::fs::StopPlaybackResponse* Arena::CreateMaybeMessage<::fs::StopPlaybackResponse>(Arena*);
+template<> ::fs::SubscribeCallEventsRequest* Arena::CreateMaybeMessage<::fs::SubscribeCallEventsRequest>(Arena*);
 template<> ::fs::UnHoldRequest* Arena::CreateMaybeMessage<::fs::UnHoldRequest>(Arena*);
 template<> ::fs::UnHoldResponse* Arena::CreateMaybeMessage<::fs::UnHoldResponse>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -293,54 +341,54 @@ inline bool OriginateRequest_Strategy_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<OriginateRequest_Strategy>(
     OriginateRequest_Strategy_descriptor(), name, value);
 }
-// ===================================================================
-
-class BreakParkRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BreakParkRequest_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
-public:
-  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BreakParkRequest_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
-  BreakParkRequest_VariablesEntry_DoNotUse();
-  explicit PROTOBUF_CONSTEXPR BreakParkRequest_VariablesEntry_DoNotUse(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-  explicit BreakParkRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  void MergeFrom(const BreakParkRequest_VariablesEntry_DoNotUse& other);
-  static const BreakParkRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const BreakParkRequest_VariablesEntry_DoNotUse*>(&_BreakParkRequest_VariablesEntry_DoNotUse_default_instance_); }
-  static bool ValidateKey(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BreakParkRequest.VariablesEntry.key");
- }
-  static bool ValidateValue(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BreakParkRequest.VariablesEntry.value");
- }
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  friend struct ::TableStruct_fs_2eproto;
+enum OriginateAsyncResponse_State : int {
+  OriginateAsyncResponse_State_CREATED = 0,
+  OriginateAsyncResponse_State_RINGING = 1,
+  OriginateAsyncResponse_State_EARLY_MEDIA = 2,
+  OriginateAsyncResponse_State_ANSWERED = 3,
+  OriginateAsyncResponse_State_FAILED = 4,
+  OriginateAsyncResponse_State_OriginateAsyncResponse_State_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  OriginateAsyncResponse_State_OriginateAsyncResponse_State_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
+bool OriginateAsyncResponse_State_IsValid(int value);
+constexpr OriginateAsyncResponse_State OriginateAsyncResponse_State_State_MIN = OriginateAsyncResponse_State_CREATED;
+constexpr OriginateAsyncResponse_State OriginateAsyncResponse_State_State_MAX = OriginateAsyncResponse_State_FAILED;
+constexpr int OriginateAsyncResponse_State_State_ARRAYSIZE = OriginateAsyncResponse_State_State_MAX + 1;
 
-// -------------------------------------------------------------------
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* OriginateAsyncResponse_State_descriptor();
+template<typename T>
+inline const std::string& OriginateAsyncResponse_State_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, OriginateAsyncResponse_State>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function OriginateAsyncResponse_State_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    OriginateAsyncResponse_State_descriptor(), enum_t_value);
+}
+inline bool OriginateAsyncResponse_State_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, OriginateAsyncResponse_State* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<OriginateAsyncResponse_State>(
+    OriginateAsyncResponse_State_descriptor(), name, value);
+}
+// ===================================================================
 
-class BreakParkRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BreakParkRequest) */ {
+class SubscribeCallEventsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SubscribeCallEventsRequest) */ {
  public:
-  inline BreakParkRequest() : BreakParkRequest(nullptr) {}
-  ~BreakParkRequest() override;
-  explicit PROTOBUF_CONSTEXPR BreakParkRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SubscribeCallEventsRequest() : SubscribeCallEventsRequest(nullptr) {}
+  ~SubscribeCallEventsRequest() override;
+  explicit PROTOBUF_CONSTEXPR SubscribeCallEventsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BreakParkRequest(const BreakParkRequest& from);
-  BreakParkRequest(BreakParkRequest&& from) noexcept
-    : BreakParkRequest() {
+  SubscribeCallEventsRequest(const SubscribeCallEventsRequest& from);
+  SubscribeCallEventsRequest(SubscribeCallEventsRequest&& from) noexcept
+    : SubscribeCallEventsRequest() {
     *this = ::std::move(from);
   }
 
-  inline BreakParkRequest& operator=(const BreakParkRequest& from) {
+  inline SubscribeCallEventsRequest& operator=(const SubscribeCallEventsRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BreakParkRequest& operator=(BreakParkRequest&& from) noexcept {
+  inline SubscribeCallEventsRequest& operator=(SubscribeCallEventsRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -363,20 +411,20 @@ class BreakParkRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const BreakParkRequest& default_instance() {
+  static const SubscribeCallEventsRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BreakParkRequest* internal_default_instance() {
-    return reinterpret_cast<const BreakParkRequest*>(
-               &_BreakParkRequest_default_instance_);
+  static inline const SubscribeCallEventsRequest* internal_default_instance() {
+    return reinterpret_cast<const SubscribeCallEventsRequest*>(
+               &_SubscribeCallEventsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    0;
 
-  friend void swap(BreakParkRequest& a, BreakParkRequest& b) {
+  friend void swap(SubscribeCallEventsRequest& a, SubscribeCallEventsRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(BreakParkRequest* other) {
+  inline void Swap(SubscribeCallEventsRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -389,7 +437,7 @@ class BreakParkRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BreakParkRequest* other) {
+  void UnsafeArenaSwap(SubscribeCallEventsRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -397,14 +445,14 @@ class BreakParkRequest final :
 
   // implements Message ----------------------------------------------
 
-  BreakParkRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BreakParkRequest>(arena);
+  SubscribeCallEventsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubscribeCallEventsRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const BreakParkRequest& from);
+  void CopyFrom(const SubscribeCallEventsRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const BreakParkRequest& from) {
-    BreakParkRequest::MergeImpl(*this, from);
+  void MergeFrom( const SubscribeCallEventsRequest& from) {
+    SubscribeCallEventsRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -422,18 +470,16 @@ class BreakParkRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BreakParkRequest* other);
+  void InternalSwap(SubscribeCallEventsRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.BreakParkRequest";
+    return "fs.SubscribeCallEventsRequest";
   }
   protected:
-  explicit BreakParkRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SubscribeCallEventsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -443,45 +489,46 @@ class BreakParkRequest final :
 
   // nested types ----------------------------------------------------
 
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kVariablesFieldNumber = 2,
-    kIdFieldNumber = 1,
+    kEventsFieldNumber = 1,
+    kDomainIdFieldNumber = 2,
   };
-  // map<string, string> variables = 2;
-  int variables_size() const;
+  // repeated string events = 1;
+  int events_size() const;
   private:
-  int _internal_variables_size() const;
+  int _internal_events_size() const;
   public:
-  void clear_variables();
+  void clear_events();
+  const std::string& events(int index) const;
+  std::string* mutable_events(int index);
+  void set_events(int index, const std::string& value);
+  void set_events(int index, std::string&& value);
+  void set_events(int index, const char* value);
+  void set_events(int index, const char* value, size_t size);
+  std::string* add_events();
+  void add_events(const std::string& value);
+  void add_events(std::string&& value);
+  void add_events(const char* value);
+  void add_events(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& events() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_events();
   private:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      _internal_variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      _internal_mutable_variables();
+  const std::string& _internal_events(int index) const;
+  std::string* _internal_add_events();
   public:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      mutable_variables();
 
-  // string id = 1;
-  void clear_id();
-  const std::string& id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_id();
-  PROTOBUF_NODISCARD std::string* release_id();
-  void set_allocated_id(std::string* id);
+  // int64 domain_id = 2;
+  void clear_domain_id();
+  int64_t domain_id() const;
+  void set_domain_id(int64_t value);
   private:
-  const std::string& _internal_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
-  std::string* _internal_mutable_id();
+  int64_t _internal_domain_id() const;
+  void _internal_set_domain_id(int64_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.BreakParkRequest)
+  // @@protoc_insertion_point(class_scope:fs.SubscribeCallEventsRequest)
  private:
   class _Internal;
 
@@ -489,12 +536,8 @@ class BreakParkRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-        BreakParkRequest_VariablesEntry_DoNotUse,
-        std::string, std::string,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> events_;
+    int64_t domain_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -502,24 +545,24 @@ class BreakParkRequest final :
 };
 // -------------------------------------------------------------------
 
-class BreakParkResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BreakParkResponse) */ {
+class CallEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.CallEvent) */ {
  public:
-  inline BreakParkResponse() : BreakParkResponse(nullptr) {}
-  ~BreakParkResponse() override;
-  explicit PROTOBUF_CONSTEXPR BreakParkResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline CallEvent() : CallEvent(nullptr) {}
+  ~CallEvent() override;
+  explicit PROTOBUF_CONSTEXPR CallEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BreakParkResponse(const BreakParkResponse& from);
-  BreakParkResponse(BreakParkResponse&& from) noexcept
-    : BreakParkResponse() {
+  CallEvent(const CallEvent& from);
+  CallEvent(CallEvent&& from) noexcept
+    : CallEvent() {
     *this = ::std::move(from);
   }
 
-  inline BreakParkResponse& operator=(const BreakParkResponse& from) {
+  inline CallEvent& operator=(const CallEvent& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BreakParkResponse& operator=(BreakParkResponse&& from) noexcept {
+  inline CallEvent& operator=(CallEvent&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -542,20 +585,20 @@ class BreakParkResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const BreakParkResponse& default_instance() {
+  static const CallEvent& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BreakParkResponse* internal_default_instance() {
-    return reinterpret_cast<const BreakParkResponse*>(
-               &_BreakParkResponse_default_instance_);
+  static inline const CallEvent* internal_default_instance() {
+    return reinterpret_cast<const CallEvent*>(
+               &_CallEvent_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    1;
 
-  friend void swap(BreakParkResponse& a, BreakParkResponse& b) {
+  friend void swap(CallEvent& a, CallEvent& b) {
     a.Swap(&b);
   }
-  inline void Swap(BreakParkResponse* other) {
+  inline void Swap(CallEvent* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -568,7 +611,7 @@ class BreakParkResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BreakParkResponse* other) {
+  void UnsafeArenaSwap(CallEvent* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -576,14 +619,14 @@ class BreakParkResponse final :
 
   // implements Message ----------------------------------------------
 
-  BreakParkResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BreakParkResponse>(arena);
+  CallEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CallEvent>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const BreakParkResponse& from);
+  void CopyFrom(const CallEvent& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const BreakParkResponse& from) {
-    BreakParkResponse::MergeImpl(*this, from);
+  void MergeFrom( const CallEvent& from) {
+    CallEvent::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -601,15 +644,15 @@ class BreakParkResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BreakParkResponse* other);
+  void InternalSwap(CallEvent* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.BreakParkResponse";
+    return "fs.CallEvent";
   }
   protected:
-  explicit BreakParkResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit CallEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -623,18 +666,132 @@ class BreakParkResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kOkFieldNumber = 1,
+    kEventFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kAppIdFieldNumber = 3,
+    kCcAppIdFieldNumber = 6,
+    kDataFieldNumber = 8,
+    kPayloadFieldNumber = 9,
+    kDomainIdFieldNumber = 4,
+    kUserIdFieldNumber = 5,
+    kTimestampFieldNumber = 7,
   };
-  // bool ok = 1;
-  void clear_ok();
-  bool ok() const;
-  void set_ok(bool value);
+  // string event = 1;
+  void clear_event();
+  const std::string& event() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_event();
+  PROTOBUF_NODISCARD std::string* release_event();
+  void set_allocated_event(std::string* event);
   private:
-  bool _internal_ok() const;
-  void _internal_set_ok(bool value);
+  const std::string& _internal_event() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event(const std::string& value);
+  std::string* _internal_mutable_event();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.BreakParkResponse)
+  // string id = 2;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string app_id = 3;
+  void clear_app_id();
+  const std::string& app_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_app_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_app_id();
+  PROTOBUF_NODISCARD std::string* release_app_id();
+  void set_allocated_app_id(std::string* app_id);
+  private:
+  const std::string& _internal_app_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_app_id(const std::string& value);
+  std::string* _internal_mutable_app_id();
+  public:
+
+  // string cc_app_id = 6;
+  void clear_cc_app_id();
+  const std::string& cc_app_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cc_app_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cc_app_id();
+  PROTOBUF_NODISCARD std::string* release_cc_app_id();
+  void set_allocated_cc_app_id(std::string* cc_app_id);
+  private:
+  const std::string& _internal_cc_app_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cc_app_id(const std::string& value);
+  std::string* _internal_mutable_cc_app_id();
+  public:
+
+  // string data = 8;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // .fs.CallEventPayload payload = 9;
+  bool has_payload() const;
+  private:
+  bool _internal_has_payload() const;
+  public:
+  void clear_payload();
+  const ::fs::CallEventPayload& payload() const;
+  PROTOBUF_NODISCARD ::fs::CallEventPayload* release_payload();
+  ::fs::CallEventPayload* mutable_payload();
+  void set_allocated_payload(::fs::CallEventPayload* payload);
+  private:
+  const ::fs::CallEventPayload& _internal_payload() const;
+  ::fs::CallEventPayload* _internal_mutable_payload();
+  public:
+  void unsafe_arena_set_allocated_payload(
+      ::fs::CallEventPayload* payload);
+  ::fs::CallEventPayload* unsafe_arena_release_payload();
+
+  // int64 domain_id = 4;
+  void clear_domain_id();
+  int64_t domain_id() const;
+  void set_domain_id(int64_t value);
+  private:
+  int64_t _internal_domain_id() const;
+  void _internal_set_domain_id(int64_t value);
+  public:
+
+  // int64 user_id = 5;
+  void clear_user_id();
+  int64_t user_id() const;
+  void set_user_id(int64_t value);
+  private:
+  int64_t _internal_user_id() const;
+  void _internal_set_user_id(int64_t value);
+  public:
+
+  // int64 timestamp = 7;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.CallEvent)
  private:
   class _Internal;
 
@@ -642,7 +799,15 @@ class BreakParkResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    bool ok_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr app_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cc_app_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::fs::CallEventPayload* payload_;
+    int64_t domain_id_;
+    int64_t user_id_;
+    int64_t timestamp_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -650,52 +815,24 @@ class BreakParkResponse final :
 };
 // -------------------------------------------------------------------
 
-class BlindTransferRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BlindTransferRequest_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
-public:
-  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BlindTransferRequest_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
-  BlindTransferRequest_VariablesEntry_DoNotUse();
-  explicit PROTOBUF_CONSTEXPR BlindTransferRequest_VariablesEntry_DoNotUse(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-  explicit BlindTransferRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  void MergeFrom(const BlindTransferRequest_VariablesEntry_DoNotUse& other);
-  static const BlindTransferRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const BlindTransferRequest_VariablesEntry_DoNotUse*>(&_BlindTransferRequest_VariablesEntry_DoNotUse_default_instance_); }
-  static bool ValidateKey(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BlindTransferRequest.VariablesEntry.key");
- }
-  static bool ValidateValue(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BlindTransferRequest.VariablesEntry.value");
- }
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  friend struct ::TableStruct_fs_2eproto;
-};
-
-// -------------------------------------------------------------------
-
-class BlindTransferRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BlindTransferRequest) */ {
+class CallEventPayload_Endpoint final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.CallEventPayload.Endpoint) */ {
  public:
-  inline BlindTransferRequest() : BlindTransferRequest(nullptr) {}
-  ~BlindTransferRequest() override;
-  explicit PROTOBUF_CONSTEXPR BlindTransferRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline CallEventPayload_Endpoint() : CallEventPayload_Endpoint(nullptr) {}
+  ~CallEventPayload_Endpoint() override;
+  explicit PROTOBUF_CONSTEXPR CallEventPayload_Endpoint(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BlindTransferRequest(const BlindTransferRequest& from);
-  BlindTransferRequest(BlindTransferRequest&& from) noexcept
-    : BlindTransferRequest() {
+  CallEventPayload_Endpoint(const CallEventPayload_Endpoint& from);
+  CallEventPayload_Endpoint(CallEventPayload_Endpoint&& from) noexcept
+    : CallEventPayload_Endpoint() {
     *this = ::std::move(from);
   }
 
-  inline BlindTransferRequest& operator=(const BlindTransferRequest& from) {
+  inline CallEventPayload_Endpoint& operator=(const CallEventPayload_Endpoint& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BlindTransferRequest& operator=(BlindTransferRequest&& from) noexcept {
+  inline CallEventPayload_Endpoint& operator=(CallEventPayload_Endpoint&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -718,20 +855,20 @@ class BlindTransferRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const BlindTransferRequest& default_instance() {
+  static const CallEventPayload_Endpoint& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BlindTransferRequest* internal_default_instance() {
-    return reinterpret_cast<const BlindTransferRequest*>(
-               &_BlindTransferRequest_default_instance_);
+  static inline const CallEventPayload_Endpoint* internal_default_instance() {
+    return reinterpret_cast<const CallEventPayload_Endpoint*>(
+               &_CallEventPayload_Endpoint_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    2;
 
-  friend void swap(BlindTransferRequest& a, BlindTransferRequest& b) {
+  friend void swap(CallEventPayload_Endpoint& a, CallEventPayload_Endpoint& b) {
     a.Swap(&b);
   }
-  inline void Swap(BlindTransferRequest* other) {
+  inline void Swap(CallEventPayload_Endpoint* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -744,7 +881,7 @@ class BlindTransferRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BlindTransferRequest* other) {
+  void UnsafeArenaSwap(CallEventPayload_Endpoint* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -752,14 +889,14 @@ class BlindTransferRequest final :
 
   // implements Message ----------------------------------------------
 
-  BlindTransferRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BlindTransferRequest>(arena);
+  CallEventPayload_Endpoint* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CallEventPayload_Endpoint>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const BlindTransferRequest& from);
+  void CopyFrom(const CallEventPayload_Endpoint& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const BlindTransferRequest& from) {
-    BlindTransferRequest::MergeImpl(*this, from);
+  void MergeFrom( const CallEventPayload_Endpoint& from) {
+    CallEventPayload_Endpoint::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -777,18 +914,16 @@ class BlindTransferRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BlindTransferRequest* other);
+  void InternalSwap(CallEventPayload_Endpoint* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.BlindTransferRequest";
+    return "fs.CallEventPayload.Endpoint";
   }
   protected:
-  explicit BlindTransferRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit CallEventPayload_Endpoint(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -798,34 +933,29 @@ class BlindTransferRequest final :
 
   // nested types ----------------------------------------------------
 
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kVariablesFieldNumber = 3,
-    kIdFieldNumber = 1,
-    kDestinationFieldNumber = 2,
-    kDialplanFieldNumber = 4,
-    kContextFieldNumber = 5,
+    kTypeFieldNumber = 1,
+    kIdFieldNumber = 2,
+    kNameFieldNumber = 3,
+    kNumberFieldNumber = 4,
   };
-  // map<string, string> variables = 3;
-  int variables_size() const;
-  private:
-  int _internal_variables_size() const;
-  public:
-  void clear_variables();
+  // string type = 1;
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
   private:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      _internal_variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      _internal_mutable_variables();
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
   public:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      mutable_variables();
 
-  // string id = 1;
+  // string id = 2;
   void clear_id();
   const std::string& id() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -839,49 +969,35 @@ class BlindTransferRequest final :
   std::string* _internal_mutable_id();
   public:
 
-  // string destination = 2;
-  void clear_destination();
-  const std::string& destination() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_destination(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_destination();
-  PROTOBUF_NODISCARD std::string* release_destination();
-  void set_allocated_destination(std::string* destination);
-  private:
-  const std::string& _internal_destination() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
-  std::string* _internal_mutable_destination();
-  public:
-
-  // string dialplan = 4;
-  void clear_dialplan();
-  const std::string& dialplan() const;
+  // string name = 3;
+  void clear_name();
+  const std::string& name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_dialplan(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_dialplan();
-  PROTOBUF_NODISCARD std::string* release_dialplan();
-  void set_allocated_dialplan(std::string* dialplan);
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
   private:
-  const std::string& _internal_dialplan() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dialplan(const std::string& value);
-  std::string* _internal_mutable_dialplan();
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
   public:
 
-  // string context = 5;
-  void clear_context();
-  const std::string& context() const;
+  // string number = 4;
+  void clear_number();
+  const std::string& number() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_context(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_context();
-  PROTOBUF_NODISCARD std::string* release_context();
-  void set_allocated_context(std::string* context);
+  void set_number(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_number();
+  PROTOBUF_NODISCARD std::string* release_number();
+  void set_allocated_number(std::string* number);
   private:
-  const std::string& _internal_context() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_context(const std::string& value);
-  std::string* _internal_mutable_context();
+  const std::string& _internal_number() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_number(const std::string& value);
+  std::string* _internal_mutable_number();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.BlindTransferRequest)
+  // @@protoc_insertion_point(class_scope:fs.CallEventPayload.Endpoint)
  private:
   class _Internal;
 
@@ -889,15 +1005,10 @@ class BlindTransferRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-        BlindTransferRequest_VariablesEntry_DoNotUse,
-        std::string, std::string,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dialplan_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr context_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr number_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -905,24 +1016,24 @@ class BlindTransferRequest final :
 };
 // -------------------------------------------------------------------
 
-class BlindTransferResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BlindTransferResponse) */ {
+class CallEventPayload_Parameters final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.CallEventPayload.Parameters) */ {
  public:
-  inline BlindTransferResponse() : BlindTransferResponse(nullptr) {}
-  ~BlindTransferResponse() override;
-  explicit PROTOBUF_CONSTEXPR BlindTransferResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline CallEventPayload_Parameters() : CallEventPayload_Parameters(nullptr) {}
+  ~CallEventPayload_Parameters() override;
+  explicit PROTOBUF_CONSTEXPR CallEventPayload_Parameters(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BlindTransferResponse(const BlindTransferResponse& from);
-  BlindTransferResponse(BlindTransferResponse&& from) noexcept
-    : BlindTransferResponse() {
+  CallEventPayload_Parameters(const CallEventPayload_Parameters& from);
+  CallEventPayload_Parameters(CallEventPayload_Parameters&& from) noexcept
+    : CallEventPayload_Parameters() {
     *this = ::std::move(from);
   }
 
-  inline BlindTransferResponse& operator=(const BlindTransferResponse& from) {
+  inline CallEventPayload_Parameters& operator=(const CallEventPayload_Parameters& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BlindTransferResponse& operator=(BlindTransferResponse&& from) noexcept {
+  inline CallEventPayload_Parameters& operator=(CallEventPayload_Parameters&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -945,20 +1056,20 @@ class BlindTransferResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const BlindTransferResponse& default_instance() {
+  static const CallEventPayload_Parameters& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BlindTransferResponse* internal_default_instance() {
-    return reinterpret_cast<const BlindTransferResponse*>(
-               &_BlindTransferResponse_default_instance_);
+  static inline const CallEventPayload_Parameters* internal_default_instance() {
+    return reinterpret_cast<const CallEventPayload_Parameters*>(
+               &_CallEventPayload_Parameters_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    3;
 
-  friend void swap(BlindTransferResponse& a, BlindTransferResponse& b) {
+  friend void swap(CallEventPayload_Parameters& a, CallEventPayload_Parameters& b) {
     a.Swap(&b);
   }
-  inline void Swap(BlindTransferResponse* other) {
+  inline void Swap(CallEventPayload_Parameters* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -971,7 +1082,7 @@ class BlindTransferResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BlindTransferResponse* other) {
+  void UnsafeArenaSwap(CallEventPayload_Parameters* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -979,14 +1090,14 @@ class BlindTransferResponse final :
 
   // implements Message ----------------------------------------------
 
-  BlindTransferResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BlindTransferResponse>(arena);
+  CallEventPayload_Parameters* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CallEventPayload_Parameters>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const BlindTransferResponse& from);
+  void CopyFrom(const CallEventPayload_Parameters& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const BlindTransferResponse& from) {
-    BlindTransferResponse::MergeImpl(*this, from);
+  void MergeFrom( const CallEventPayload_Parameters& from) {
+    CallEventPayload_Parameters::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1004,15 +1115,15 @@ class BlindTransferResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BlindTransferResponse* other);
+  void InternalSwap(CallEventPayload_Parameters* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.BlindTransferResponse";
+    return "fs.CallEventPayload.Parameters";
   }
   protected:
-  explicit BlindTransferResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit CallEventPayload_Parameters(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1026,27 +1137,53 @@ class BlindTransferResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kErrorFieldNumber = 1,
+    kAutoAnswerFieldNumber = 3,
+    kVideoFieldNumber = 1,
+    kScreenFieldNumber = 2,
+    kDisableStunFieldNumber = 4,
   };
-  // .fs.ErrorExecute error = 1;
-  bool has_error() const;
+  // string autoAnswer = 3;
+  void clear_autoanswer();
+  const std::string& autoanswer() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_autoanswer(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_autoanswer();
+  PROTOBUF_NODISCARD std::string* release_autoanswer();
+  void set_allocated_autoanswer(std::string* autoanswer);
   private:
-  bool _internal_has_error() const;
+  const std::string& _internal_autoanswer() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_autoanswer(const std::string& value);
+  std::string* _internal_mutable_autoanswer();
   public:
-  void clear_error();
-  const ::fs::ErrorExecute& error() const;
-  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
-  ::fs::ErrorExecute* mutable_error();
-  void set_allocated_error(::fs::ErrorExecute* error);
+
+  // bool video = 1;
+  void clear_video();
+  bool video() const;
+  void set_video(bool value);
   private:
-  const ::fs::ErrorExecute& _internal_error() const;
-  ::fs::ErrorExecute* _internal_mutable_error();
+  bool _internal_video() const;
+  void _internal_set_video(bool value);
   public:
-  void unsafe_arena_set_allocated_error(
-      ::fs::ErrorExecute* error);
-  ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.BlindTransferResponse)
+  // bool screen = 2;
+  void clear_screen();
+  bool screen() const;
+  void set_screen(bool value);
+  private:
+  bool _internal_screen() const;
+  void _internal_set_screen(bool value);
+  public:
+
+  // bool disableStun = 4;
+  void clear_disablestun();
+  bool disablestun() const;
+  void set_disablestun(bool value);
+  private:
+  bool _internal_disablestun() const;
+  void _internal_set_disablestun(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.CallEventPayload.Parameters)
  private:
   class _Internal;
 
@@ -1054,7 +1191,10 @@ class BlindTransferResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::fs::ErrorExecute* error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr autoanswer_;
+    bool video_;
+    bool screen_;
+    bool disablestun_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1062,24 +1202,24 @@ class BlindTransferResponse final :
 };
 // -------------------------------------------------------------------
 
-class SetEavesdropStateRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SetEavesdropStateRequest) */ {
+class CallEventPayload_Eavesdrop final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.CallEventPayload.Eavesdrop) */ {
  public:
-  inline SetEavesdropStateRequest() : SetEavesdropStateRequest(nullptr) {}
-  ~SetEavesdropStateRequest() override;
-  explicit PROTOBUF_CONSTEXPR SetEavesdropStateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline CallEventPayload_Eavesdrop() : CallEventPayload_Eavesdrop(nullptr) {}
+  ~CallEventPayload_Eavesdrop() override;
+  explicit PROTOBUF_CONSTEXPR CallEventPayload_Eavesdrop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetEavesdropStateRequest(const SetEavesdropStateRequest& from);
-  SetEavesdropStateRequest(SetEavesdropStateRequest&& from) noexcept
-    : SetEavesdropStateRequest() {
+  CallEventPayload_Eavesdrop(const CallEventPayload_Eavesdrop& from);
+  CallEventPayload_Eavesdrop(CallEventPayload_Eavesdrop&& from) noexcept
+    : CallEventPayload_Eavesdrop() {
     *this = ::std::move(from);
   }
 
-  inline SetEavesdropStateRequest& operator=(const SetEavesdropStateRequest& from) {
+  inline CallEventPayload_Eavesdrop& operator=(const CallEventPayload_Eavesdrop& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetEavesdropStateRequest& operator=(SetEavesdropStateRequest&& from) noexcept {
+  inline CallEventPayload_Eavesdrop& operator=(CallEventPayload_Eavesdrop&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1102,20 +1242,20 @@ class SetEavesdropStateRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetEavesdropStateRequest& default_instance() {
+  static const CallEventPayload_Eavesdrop& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetEavesdropStateRequest* internal_default_instance() {
-    return reinterpret_cast<const SetEavesdropStateRequest*>(
-               &_SetEavesdropStateRequest_default_instance_);
+  static inline const CallEventPayload_Eavesdrop* internal_default_instance() {
+    return reinterpret_cast<const CallEventPayload_Eavesdrop*>(
+               &_CallEventPayload_Eavesdrop_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    4;
 
-  friend void swap(SetEavesdropStateRequest& a, SetEavesdropStateRequest& b) {
+  friend void swap(CallEventPayload_Eavesdrop& a, CallEventPayload_Eavesdrop& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetEavesdropStateRequest* other) {
+  inline void Swap(CallEventPayload_Eavesdrop* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1128,7 +1268,7 @@ class SetEavesdropStateRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetEavesdropStateRequest* other) {
+  void UnsafeArenaSwap(CallEventPayload_Eavesdrop* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1136,14 +1276,14 @@ class SetEavesdropStateRequest final :
 
   // implements Message ----------------------------------------------
 
-  SetEavesdropStateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetEavesdropStateRequest>(arena);
+  CallEventPayload_Eavesdrop* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CallEventPayload_Eavesdrop>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetEavesdropStateRequest& from);
+  void CopyFrom(const CallEventPayload_Eavesdrop& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetEavesdropStateRequest& from) {
-    SetEavesdropStateRequest::MergeImpl(*this, from);
+  void MergeFrom( const CallEventPayload_Eavesdrop& from) {
+    CallEventPayload_Eavesdrop::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1161,15 +1301,15 @@ class SetEavesdropStateRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetEavesdropStateRequest* other);
+  void InternalSwap(CallEventPayload_Eavesdrop* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.SetEavesdropStateRequest";
+    return "fs.CallEventPayload.Eavesdrop";
   }
   protected:
-  explicit SetEavesdropStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit CallEventPayload_Eavesdrop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1183,24 +1323,55 @@ class SetEavesdropStateRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kIdFieldNumber = 1,
-    kStateFieldNumber = 2,
+    kTypeFieldNumber = 1,
+    kNameFieldNumber = 2,
+    kNumberFieldNumber = 3,
+    kStateFieldNumber = 5,
+    kDurationFieldNumber = 4,
   };
-  // string id = 1;
-  void clear_id();
-  const std::string& id() const;
+  // string type = 1;
+  void clear_type();
+  const std::string& type() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_id();
-  PROTOBUF_NODISCARD std::string* release_id();
-  void set_allocated_id(std::string* id);
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
   private:
-  const std::string& _internal_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
-  std::string* _internal_mutable_id();
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
   public:
 
-  // string state = 2;
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string number = 3;
+  void clear_number();
+  const std::string& number() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_number(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_number();
+  PROTOBUF_NODISCARD std::string* release_number();
+  void set_allocated_number(std::string* number);
+  private:
+  const std::string& _internal_number() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_number(const std::string& value);
+  std::string* _internal_mutable_number();
+  public:
+
+  // string state = 5;
   void clear_state();
   const std::string& state() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -1214,7 +1385,16 @@ class SetEavesdropStateRequest final :
   std::string* _internal_mutable_state();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.SetEavesdropStateRequest)
+  // int32 duration = 4;
+  void clear_duration();
+  int32_t duration() const;
+  void set_duration(int32_t value);
+  private:
+  int32_t _internal_duration() const;
+  void _internal_set_duration(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.CallEventPayload.Eavesdrop)
  private:
   class _Internal;
 
@@ -1222,8 +1402,11 @@ class SetEavesdropStateRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr number_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr state_;
+    int32_t duration_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1231,24 +1414,24 @@ class SetEavesdropStateRequest final :
 };
 // -------------------------------------------------------------------
 
-class SetEavesdropStateResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SetEavesdropStateResponse) */ {
+class CallEventPayload_Call final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.CallEventPayload.Call) */ {
  public:
-  inline SetEavesdropStateResponse() : SetEavesdropStateResponse(nullptr) {}
-  ~SetEavesdropStateResponse() override;
-  explicit PROTOBUF_CONSTEXPR SetEavesdropStateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline CallEventPayload_Call() : CallEventPayload_Call(nullptr) {}
+  ~CallEventPayload_Call() override;
+  explicit PROTOBUF_CONSTEXPR CallEventPayload_Call(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetEavesdropStateResponse(const SetEavesdropStateResponse& from);
-  SetEavesdropStateResponse(SetEavesdropStateResponse&& from) noexcept
-    : SetEavesdropStateResponse() {
+  CallEventPayload_Call(const CallEventPayload_Call& from);
+  CallEventPayload_Call(CallEventPayload_Call&& from) noexcept
+    : CallEventPayload_Call() {
     *this = ::std::move(from);
   }
 
-  inline SetEavesdropStateResponse& operator=(const SetEavesdropStateResponse& from) {
+  inline CallEventPayload_Call& operator=(const CallEventPayload_Call& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetEavesdropStateResponse& operator=(SetEavesdropStateResponse&& from) noexcept {
+  inline CallEventPayload_Call& operator=(CallEventPayload_Call&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1271,20 +1454,20 @@ class SetEavesdropStateResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetEavesdropStateResponse& default_instance() {
+  static const CallEventPayload_Call& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetEavesdropStateResponse* internal_default_instance() {
-    return reinterpret_cast<const SetEavesdropStateResponse*>(
-               &_SetEavesdropStateResponse_default_instance_);
+  static inline const CallEventPayload_Call* internal_default_instance() {
+    return reinterpret_cast<const CallEventPayload_Call*>(
+               &_CallEventPayload_Call_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    5;
 
-  friend void swap(SetEavesdropStateResponse& a, SetEavesdropStateResponse& b) {
+  friend void swap(CallEventPayload_Call& a, CallEventPayload_Call& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetEavesdropStateResponse* other) {
+  inline void Swap(CallEventPayload_Call* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1297,7 +1480,7 @@ class SetEavesdropStateResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetEavesdropStateResponse* other) {
+  void UnsafeArenaSwap(CallEventPayload_Call* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1305,14 +1488,14 @@ class SetEavesdropStateResponse final :
 
   // implements Message ----------------------------------------------
 
-  SetEavesdropStateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetEavesdropStateResponse>(arena);
+  CallEventPayload_Call* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CallEventPayload_Call>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetEavesdropStateResponse& from);
+  void CopyFrom(const CallEventPayload_Call& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetEavesdropStateResponse& from) {
-    SetEavesdropStateResponse::MergeImpl(*this, from);
+  void MergeFrom( const CallEventPayload_Call& from) {
+    CallEventPayload_Call::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1330,15 +1513,15 @@ class SetEavesdropStateResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetEavesdropStateResponse* other);
+  void InternalSwap(CallEventPayload_Call* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.SetEavesdropStateResponse";
+    return "fs.CallEventPayload.Call";
   }
   protected:
-  explicit SetEavesdropStateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit CallEventPayload_Call(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1352,27 +1535,48 @@ class SetEavesdropStateResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kErrorFieldNumber = 1,
+    kIdFieldNumber = 1,
+    kCcAppIdFieldNumber = 3,
+    kUserIdFieldNumber = 2,
   };
-  // .fs.ErrorExecute error = 1;
-  bool has_error() const;
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
   private:
-  bool _internal_has_error() const;
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
   public:
-  void clear_error();
-  const ::fs::ErrorExecute& error() const;
-  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
-  ::fs::ErrorExecute* mutable_error();
-  void set_allocated_error(::fs::ErrorExecute* error);
+
+  // string cc_app_id = 3;
+  void clear_cc_app_id();
+  const std::string& cc_app_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cc_app_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cc_app_id();
+  PROTOBUF_NODISCARD std::string* release_cc_app_id();
+  void set_allocated_cc_app_id(std::string* cc_app_id);
   private:
-  const ::fs::ErrorExecute& _internal_error() const;
-  ::fs::ErrorExecute* _internal_mutable_error();
+  const std::string& _internal_cc_app_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cc_app_id(const std::string& value);
+  std::string* _internal_mutable_cc_app_id();
   public:
-  void unsafe_arena_set_allocated_error(
-      ::fs::ErrorExecute* error);
-  ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.SetEavesdropStateResponse)
+  // int64 user_id = 2;
+  void clear_user_id();
+  int64_t user_id() const;
+  void set_user_id(int64_t value);
+  private:
+  int64_t _internal_user_id() const;
+  void _internal_set_user_id(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.CallEventPayload.Call)
  private:
   class _Internal;
 
@@ -1380,7 +1584,9 @@ class SetEavesdropStateResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::fs::ErrorExecute* error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cc_app_id_;
+    int64_t user_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1388,24 +1594,80 @@ class SetEavesdropStateResponse final :
 };
 // -------------------------------------------------------------------
 
-class BroadcastRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BroadcastRequest) */ {
+class CallEventPayload_PayloadEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<CallEventPayload_PayloadEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<CallEventPayload_PayloadEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  CallEventPayload_PayloadEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR CallEventPayload_PayloadEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit CallEventPayload_PayloadEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const CallEventPayload_PayloadEntry_DoNotUse& other);
+  static const CallEventPayload_PayloadEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const CallEventPayload_PayloadEntry_DoNotUse*>(&_CallEventPayload_PayloadEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.CallEventPayload.PayloadEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.CallEventPayload.PayloadEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_fs_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class CallEventPayload_QueueEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<CallEventPayload_QueueEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<CallEventPayload_QueueEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  CallEventPayload_QueueEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR CallEventPayload_QueueEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit CallEventPayload_QueueEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const CallEventPayload_QueueEntry_DoNotUse& other);
+  static const CallEventPayload_QueueEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const CallEventPayload_QueueEntry_DoNotUse*>(&_CallEventPayload_QueueEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.CallEventPayload.QueueEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.CallEventPayload.QueueEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_fs_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class CallEventPayload final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.CallEventPayload) */ {
  public:
-  inline BroadcastRequest() : BroadcastRequest(nullptr) {}
-  ~BroadcastRequest() override;
-  explicit PROTOBUF_CONSTEXPR BroadcastRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline CallEventPayload() : CallEventPayload(nullptr) {}
+  ~CallEventPayload() override;
+  explicit PROTOBUF_CONSTEXPR CallEventPayload(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BroadcastRequest(const BroadcastRequest& from);
-  BroadcastRequest(BroadcastRequest&& from) noexcept
-    : BroadcastRequest() {
+  CallEventPayload(const CallEventPayload& from);
+  CallEventPayload(CallEventPayload&& from) noexcept
+    : CallEventPayload() {
     *this = ::std::move(from);
   }
 
-  inline BroadcastRequest& operator=(const BroadcastRequest& from) {
+  inline CallEventPayload& operator=(const CallEventPayload& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BroadcastRequest& operator=(BroadcastRequest&& from) noexcept {
+  inline CallEventPayload& operator=(CallEventPayload&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1428,20 +1690,20 @@ class BroadcastRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const BroadcastRequest& default_instance() {
+  static const CallEventPayload& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BroadcastRequest* internal_default_instance() {
-    return reinterpret_cast<const BroadcastRequest*>(
-               &_BroadcastRequest_default_instance_);
+  static inline const CallEventPayload* internal_default_instance() {
+    return reinterpret_cast<const CallEventPayload*>(
+               &_CallEventPayload_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     8;
 
-  friend void swap(BroadcastRequest& a, BroadcastRequest& b) {
+  friend void swap(CallEventPayload& a, CallEventPayload& b) {
     a.Swap(&b);
   }
-  inline void Swap(BroadcastRequest* other) {
+  inline void Swap(CallEventPayload* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1454,7 +1716,7 @@ class BroadcastRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BroadcastRequest* other) {
+  void UnsafeArenaSwap(CallEventPayload* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1462,14 +1724,14 @@ class BroadcastRequest final :
 
   // implements Message ----------------------------------------------
 
-  BroadcastRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BroadcastRequest>(arena);
+  CallEventPayload* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CallEventPayload>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const BroadcastRequest& from);
+  void CopyFrom(const CallEventPayload& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const BroadcastRequest& from) {
-    BroadcastRequest::MergeImpl(*this, from);
+  void MergeFrom( const CallEventPayload& from) {
+    CallEventPayload::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1487,16 +1749,18 @@ class BroadcastRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BroadcastRequest* other);
+  void InternalSwap(CallEventPayload* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.BroadcastRequest";
+    return "fs.CallEventPayload";
   }
   protected:
-  explicit BroadcastRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit CallEventPayload(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -1506,241 +1770,814 @@ class BroadcastRequest final :
 
   // nested types ----------------------------------------------------
 
+  typedef CallEventPayload_Endpoint Endpoint;
+  typedef CallEventPayload_Parameters Parameters;
+  typedef CallEventPayload_Eavesdrop Eavesdrop;
+  typedef CallEventPayload_Call Call;
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kIdFieldNumber = 1,
-    kArgsFieldNumber = 2,
-    kLegFieldNumber = 4,
-    kWaitForAnswerFieldNumber = 3,
+    kPayloadFieldNumber = 6,
+    kQueueFieldNumber = 17,
+    kTagsFieldNumber = 45,
+    kSchemaIdsFieldNumber = 46,
+    kAmdAiLogsFieldNumber = 49,
+    kCallsFieldNumber = 51,
+    kDirectionFieldNumber = 7,
+    kDestinationFieldNumber = 8,
+    kParentIdFieldNumber = 9,
+    kSipIdFieldNumber = 14,
+    kIvrFieldNumber = 16,
+    kBridgedIdFieldNumber = 20,
+    kDigitFieldNumber = 21,
+    kApplicationFieldNumber = 22,
+    kStateFieldNumber = 23,
+    kTypeFieldNumber = 24,
+    kAiResultFieldNumber = 25,
+    kAiErrorFieldNumber = 26,
+    kResultFieldNumber = 27,
+    kCauseFieldNumber = 28,
+    kAmdResultFieldNumber = 31,
+    kAmdCauseFieldNumber = 32,
+    kRecordStartFieldNumber = 33,
+    kRecordStopFieldNumber = 34,
+    kTransferToFieldNumber = 35,
+    kTransferFromFieldNumber = 36,
+    kTransferToAgentFieldNumber = 37,
+    kTransferFromAttemptFieldNumber = 38,
+    kTransferToAttemptFieldNumber = 39,
+    kTalkSecFieldNumber = 40,
+    kHangupByFieldNumber = 41,
+    kReportingAtFieldNumber = 42,
+    kAmdAiResultFieldNumber = 47,
+    kHangupPhraseFieldNumber = 50,
+    kFromFieldNumber = 10,
+    kToFieldNumber = 11,
+    kParamsFieldNumber = 18,
+    kEavesdropFieldNumber = 19,
+    kUserIdFieldNumber = 1,
+    kGatewayIdFieldNumber = 2,
+    kContactIdFieldNumber = 3,
+    kHideContactFieldNumber = 4,
+    kHideNumberFieldNumber = 5,
+    kOriginateFieldNumber = 12,
+    kCdrFieldNumber = 29,
+    kHeartbeatFieldNumber = 13,
+    kGranteeIdFieldNumber = 15,
+    kNotificationHangupFieldNumber = 30,
+    kOriginateSuccessFieldNumber = 43,
+    kAmdAiPositiveFieldNumber = 48,
+    kAiLocalFieldNumber = 52,
+    kSipFieldNumber = 44,
+    kAiPartialFieldNumber = 53,
+    kAiConfidenceFieldNumber = 54,
+    kAiElapsedMsFieldNumber = 55,
   };
-  // string id = 1;
-  void clear_id();
-  const std::string& id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_id();
-  PROTOBUF_NODISCARD std::string* release_id();
-  void set_allocated_id(std::string* id);
+  // map<string, string> payload = 6;
+  int payload_size() const;
   private:
-  const std::string& _internal_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
-  std::string* _internal_mutable_id();
+  int _internal_payload_size() const;
   public:
-
-  // string args = 2;
-  void clear_args();
-  const std::string& args() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_args(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_args();
-  PROTOBUF_NODISCARD std::string* release_args();
-  void set_allocated_args(std::string* args);
+  void clear_payload();
   private:
-  const std::string& _internal_args() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_args(const std::string& value);
-  std::string* _internal_mutable_args();
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_payload() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_payload();
   public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      payload() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_payload();
 
-  // string leg = 4;
-  void clear_leg();
-  const std::string& leg() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_leg(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_leg();
-  PROTOBUF_NODISCARD std::string* release_leg();
-  void set_allocated_leg(std::string* leg);
+  // map<string, string> queue = 17;
+  int queue_size() const;
   private:
-  const std::string& _internal_leg() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg(const std::string& value);
-  std::string* _internal_mutable_leg();
+  int _internal_queue_size() const;
+  public:
+  void clear_queue();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_queue() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_queue();
   public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      queue() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_queue();
 
-  // bool wait_for_answer = 3;
-  void clear_wait_for_answer();
-  bool wait_for_answer() const;
-  void set_wait_for_answer(bool value);
+  // repeated string tags = 45;
+  int tags_size() const;
   private:
-  bool _internal_wait_for_answer() const;
-  void _internal_set_wait_for_answer(bool value);
+  int _internal_tags_size() const;
+  public:
+  void clear_tags();
+  const std::string& tags(int index) const;
+  std::string* mutable_tags(int index);
+  void set_tags(int index, const std::string& value);
+  void set_tags(int index, std::string&& value);
+  void set_tags(int index, const char* value);
+  void set_tags(int index, const char* value, size_t size);
+  std::string* add_tags();
+  void add_tags(const std::string& value);
+  void add_tags(std::string&& value);
+  void add_tags(const char* value);
+  void add_tags(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& tags() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_tags();
+  private:
+  const std::string& _internal_tags(int index) const;
+  std::string* _internal_add_tags();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.BroadcastRequest)
- private:
-  class _Internal;
+  // repeated int64 schema_ids = 46;
+  int schema_ids_size() const;
+  private:
+  int _internal_schema_ids_size() const;
+  public:
+  void clear_schema_ids();
+  private:
+  int64_t _internal_schema_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_schema_ids() const;
+  void _internal_add_schema_ids(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_schema_ids();
+  public:
+  int64_t schema_ids(int index) const;
+  void set_schema_ids(int index, int64_t value);
+  void add_schema_ids(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      schema_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_schema_ids();
+
+  // repeated string amd_ai_logs = 49;
+  int amd_ai_logs_size() const;
+  private:
+  int _internal_amd_ai_logs_size() const;
+  public:
+  void clear_amd_ai_logs();
+  const std::string& amd_ai_logs(int index) const;
+  std::string* mutable_amd_ai_logs(int index);
+  void set_amd_ai_logs(int index, const std::string& value);
+  void set_amd_ai_logs(int index, std::string&& value);
+  void set_amd_ai_logs(int index, const char* value);
+  void set_amd_ai_logs(int index, const char* value, size_t size);
+  std::string* add_amd_ai_logs();
+  void add_amd_ai_logs(const std::string& value);
+  void add_amd_ai_logs(std::string&& value);
+  void add_amd_ai_logs(const char* value);
+  void add_amd_ai_logs(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& amd_ai_logs() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_amd_ai_logs();
+  private:
+  const std::string& _internal_amd_ai_logs(int index) const;
+  std::string* _internal_add_amd_ai_logs();
+  public:
 
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr args_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_;
-    bool wait_for_answer_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  };
-  union { Impl_ _impl_; };
-  friend struct ::TableStruct_fs_2eproto;
-};
-// -------------------------------------------------------------------
+  // repeated .fs.CallEventPayload.Call calls = 51;
+  int calls_size() const;
+  private:
+  int _internal_calls_size() const;
+  public:
+  void clear_calls();
+  ::fs::CallEventPayload_Call* mutable_calls(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::CallEventPayload_Call >*
+      mutable_calls();
+  private:
+  const ::fs::CallEventPayload_Call& _internal_calls(int index) const;
+  ::fs::CallEventPayload_Call* _internal_add_calls();
+  public:
+  const ::fs::CallEventPayload_Call& calls(int index) const;
+  ::fs::CallEventPayload_Call* add_calls();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::CallEventPayload_Call >&
+      calls() const;
+
+  // string direction = 7;
+  void clear_direction();
+  const std::string& direction() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_direction(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_direction();
+  PROTOBUF_NODISCARD std::string* release_direction();
+  void set_allocated_direction(std::string* direction);
+  private:
+  const std::string& _internal_direction() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_direction(const std::string& value);
+  std::string* _internal_mutable_direction();
+  public:
 
-class BroadcastResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BroadcastResponse) */ {
- public:
-  inline BroadcastResponse() : BroadcastResponse(nullptr) {}
-  ~BroadcastResponse() override;
-  explicit PROTOBUF_CONSTEXPR BroadcastResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  // string destination = 8;
+  void clear_destination();
+  const std::string& destination() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_destination(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_destination();
+  PROTOBUF_NODISCARD std::string* release_destination();
+  void set_allocated_destination(std::string* destination);
+  private:
+  const std::string& _internal_destination() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
+  std::string* _internal_mutable_destination();
+  public:
 
-  BroadcastResponse(const BroadcastResponse& from);
-  BroadcastResponse(BroadcastResponse&& from) noexcept
-    : BroadcastResponse() {
-    *this = ::std::move(from);
-  }
+  // string parent_id = 9;
+  void clear_parent_id();
+  const std::string& parent_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_parent_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_parent_id();
+  PROTOBUF_NODISCARD std::string* release_parent_id();
+  void set_allocated_parent_id(std::string* parent_id);
+  private:
+  const std::string& _internal_parent_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_parent_id(const std::string& value);
+  std::string* _internal_mutable_parent_id();
+  public:
 
-  inline BroadcastResponse& operator=(const BroadcastResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline BroadcastResponse& operator=(BroadcastResponse&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
+  // string sip_id = 14;
+  void clear_sip_id();
+  const std::string& sip_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sip_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sip_id();
+  PROTOBUF_NODISCARD std::string* release_sip_id();
+  void set_allocated_sip_id(std::string* sip_id);
+  private:
+  const std::string& _internal_sip_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sip_id(const std::string& value);
+  std::string* _internal_mutable_sip_id();
+  public:
 
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const BroadcastResponse& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const BroadcastResponse* internal_default_instance() {
-    return reinterpret_cast<const BroadcastResponse*>(
-               &_BroadcastResponse_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    9;
+  // string ivr = 16;
+  void clear_ivr();
+  const std::string& ivr() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ivr(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ivr();
+  PROTOBUF_NODISCARD std::string* release_ivr();
+  void set_allocated_ivr(std::string* ivr);
+  private:
+  const std::string& _internal_ivr() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ivr(const std::string& value);
+  std::string* _internal_mutable_ivr();
+  public:
 
-  friend void swap(BroadcastResponse& a, BroadcastResponse& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(BroadcastResponse* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(BroadcastResponse* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
+  // string bridged_id = 20;
+  void clear_bridged_id();
+  const std::string& bridged_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bridged_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bridged_id();
+  PROTOBUF_NODISCARD std::string* release_bridged_id();
+  void set_allocated_bridged_id(std::string* bridged_id);
+  private:
+  const std::string& _internal_bridged_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bridged_id(const std::string& value);
+  std::string* _internal_mutable_bridged_id();
+  public:
 
-  // implements Message ----------------------------------------------
+  // string digit = 21;
+  void clear_digit();
+  const std::string& digit() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_digit(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_digit();
+  PROTOBUF_NODISCARD std::string* release_digit();
+  void set_allocated_digit(std::string* digit);
+  private:
+  const std::string& _internal_digit() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_digit(const std::string& value);
+  std::string* _internal_mutable_digit();
+  public:
 
-  BroadcastResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BroadcastResponse>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const BroadcastResponse& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const BroadcastResponse& from) {
-    BroadcastResponse::MergeImpl(*this, from);
-  }
+  // string application = 22;
+  void clear_application();
+  const std::string& application() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_application(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_application();
+  PROTOBUF_NODISCARD std::string* release_application();
+  void set_allocated_application(std::string* application);
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  const std::string& _internal_application() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_application(const std::string& value);
+  std::string* _internal_mutable_application();
   public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
 
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+  // string state = 23;
+  void clear_state();
+  const std::string& state() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_state(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_state();
+  PROTOBUF_NODISCARD std::string* release_state();
+  void set_allocated_state(std::string* state);
+  private:
+  const std::string& _internal_state() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_state(const std::string& value);
+  std::string* _internal_mutable_state();
+  public:
 
+  // string type = 24;
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
   private:
-  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(BroadcastResponse* other);
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
 
+  // string ai_result = 25;
+  void clear_ai_result();
+  const std::string& ai_result() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ai_result(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ai_result();
+  PROTOBUF_NODISCARD std::string* release_ai_result();
+  void set_allocated_ai_result(std::string* ai_result);
   private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.BroadcastResponse";
-  }
-  protected:
-  explicit BroadcastResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
+  const std::string& _internal_ai_result() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ai_result(const std::string& value);
+  std::string* _internal_mutable_ai_result();
   public:
 
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+  // string ai_error = 26;
+  void clear_ai_error();
+  const std::string& ai_error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ai_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ai_error();
+  PROTOBUF_NODISCARD std::string* release_ai_error();
+  void set_allocated_ai_error(std::string* ai_error);
+  private:
+  const std::string& _internal_ai_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ai_error(const std::string& value);
+  std::string* _internal_mutable_ai_error();
+  public:
 
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  // string result = 27;
+  void clear_result();
+  const std::string& result() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_result(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_result();
+  PROTOBUF_NODISCARD std::string* release_result();
+  void set_allocated_result(std::string* result);
+  private:
+  const std::string& _internal_result() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_result(const std::string& value);
+  std::string* _internal_mutable_result();
+  public:
 
-  // nested types ----------------------------------------------------
+  // string cause = 28;
+  void clear_cause();
+  const std::string& cause() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cause(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cause();
+  PROTOBUF_NODISCARD std::string* release_cause();
+  void set_allocated_cause(std::string* cause);
+  private:
+  const std::string& _internal_cause() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cause(const std::string& value);
+  std::string* _internal_mutable_cause();
+  public:
 
-  // accessors -------------------------------------------------------
+  // string amd_result = 31;
+  void clear_amd_result();
+  const std::string& amd_result() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_amd_result(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_amd_result();
+  PROTOBUF_NODISCARD std::string* release_amd_result();
+  void set_allocated_amd_result(std::string* amd_result);
+  private:
+  const std::string& _internal_amd_result() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_amd_result(const std::string& value);
+  std::string* _internal_mutable_amd_result();
+  public:
 
-  enum : int {
-    kDataFieldNumber = 1,
-    kErrorFieldNumber = 2,
-  };
-  // string data = 1;
-  void clear_data();
-  const std::string& data() const;
+  // string amd_cause = 32;
+  void clear_amd_cause();
+  const std::string& amd_cause() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_data(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_data();
-  PROTOBUF_NODISCARD std::string* release_data();
-  void set_allocated_data(std::string* data);
+  void set_amd_cause(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_amd_cause();
+  PROTOBUF_NODISCARD std::string* release_amd_cause();
+  void set_allocated_amd_cause(std::string* amd_cause);
   private:
-  const std::string& _internal_data() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
-  std::string* _internal_mutable_data();
+  const std::string& _internal_amd_cause() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_amd_cause(const std::string& value);
+  std::string* _internal_mutable_amd_cause();
   public:
 
-  // .fs.ErrorExecute error = 2;
-  bool has_error() const;
+  // string record_start = 33;
+  void clear_record_start();
+  const std::string& record_start() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_record_start(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_record_start();
+  PROTOBUF_NODISCARD std::string* release_record_start();
+  void set_allocated_record_start(std::string* record_start);
   private:
-  bool _internal_has_error() const;
+  const std::string& _internal_record_start() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_record_start(const std::string& value);
+  std::string* _internal_mutable_record_start();
   public:
-  void clear_error();
-  const ::fs::ErrorExecute& error() const;
-  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
-  ::fs::ErrorExecute* mutable_error();
-  void set_allocated_error(::fs::ErrorExecute* error);
+
+  // string record_stop = 34;
+  void clear_record_stop();
+  const std::string& record_stop() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_record_stop(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_record_stop();
+  PROTOBUF_NODISCARD std::string* release_record_stop();
+  void set_allocated_record_stop(std::string* record_stop);
   private:
-  const ::fs::ErrorExecute& _internal_error() const;
-  ::fs::ErrorExecute* _internal_mutable_error();
+  const std::string& _internal_record_stop() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_record_stop(const std::string& value);
+  std::string* _internal_mutable_record_stop();
   public:
-  void unsafe_arena_set_allocated_error(
-      ::fs::ErrorExecute* error);
-  ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.BroadcastResponse)
+  // string transfer_to = 35;
+  void clear_transfer_to();
+  const std::string& transfer_to() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_transfer_to(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_transfer_to();
+  PROTOBUF_NODISCARD std::string* release_transfer_to();
+  void set_allocated_transfer_to(std::string* transfer_to);
+  private:
+  const std::string& _internal_transfer_to() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_transfer_to(const std::string& value);
+  std::string* _internal_mutable_transfer_to();
+  public:
+
+  // string transfer_from = 36;
+  void clear_transfer_from();
+  const std::string& transfer_from() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_transfer_from(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_transfer_from();
+  PROTOBUF_NODISCARD std::string* release_transfer_from();
+  void set_allocated_transfer_from(std::string* transfer_from);
+  private:
+  const std::string& _internal_transfer_from() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_transfer_from(const std::string& value);
+  std::string* _internal_mutable_transfer_from();
+  public:
+
+  // string transfer_to_agent = 37;
+  void clear_transfer_to_agent();
+  const std::string& transfer_to_agent() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_transfer_to_agent(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_transfer_to_agent();
+  PROTOBUF_NODISCARD std::string* release_transfer_to_agent();
+  void set_allocated_transfer_to_agent(std::string* transfer_to_agent);
+  private:
+  const std::string& _internal_transfer_to_agent() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_transfer_to_agent(const std::string& value);
+  std::string* _internal_mutable_transfer_to_agent();
+  public:
+
+  // string transfer_from_attempt = 38;
+  void clear_transfer_from_attempt();
+  const std::string& transfer_from_attempt() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_transfer_from_attempt(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_transfer_from_attempt();
+  PROTOBUF_NODISCARD std::string* release_transfer_from_attempt();
+  void set_allocated_transfer_from_attempt(std::string* transfer_from_attempt);
+  private:
+  const std::string& _internal_transfer_from_attempt() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_transfer_from_attempt(const std::string& value);
+  std::string* _internal_mutable_transfer_from_attempt();
+  public:
+
+  // string transfer_to_attempt = 39;
+  void clear_transfer_to_attempt();
+  const std::string& transfer_to_attempt() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_transfer_to_attempt(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_transfer_to_attempt();
+  PROTOBUF_NODISCARD std::string* release_transfer_to_attempt();
+  void set_allocated_transfer_to_attempt(std::string* transfer_to_attempt);
+  private:
+  const std::string& _internal_transfer_to_attempt() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_transfer_to_attempt(const std::string& value);
+  std::string* _internal_mutable_transfer_to_attempt();
+  public:
+
+  // string talk_sec = 40;
+  void clear_talk_sec();
+  const std::string& talk_sec() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_talk_sec(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_talk_sec();
+  PROTOBUF_NODISCARD std::string* release_talk_sec();
+  void set_allocated_talk_sec(std::string* talk_sec);
+  private:
+  const std::string& _internal_talk_sec() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_talk_sec(const std::string& value);
+  std::string* _internal_mutable_talk_sec();
+  public:
+
+  // string hangup_by = 41;
+  void clear_hangup_by();
+  const std::string& hangup_by() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hangup_by(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hangup_by();
+  PROTOBUF_NODISCARD std::string* release_hangup_by();
+  void set_allocated_hangup_by(std::string* hangup_by);
+  private:
+  const std::string& _internal_hangup_by() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hangup_by(const std::string& value);
+  std::string* _internal_mutable_hangup_by();
+  public:
+
+  // string reporting_at = 42;
+  void clear_reporting_at();
+  const std::string& reporting_at() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reporting_at(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reporting_at();
+  PROTOBUF_NODISCARD std::string* release_reporting_at();
+  void set_allocated_reporting_at(std::string* reporting_at);
+  private:
+  const std::string& _internal_reporting_at() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reporting_at(const std::string& value);
+  std::string* _internal_mutable_reporting_at();
+  public:
+
+  // string amd_ai_result = 47;
+  void clear_amd_ai_result();
+  const std::string& amd_ai_result() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_amd_ai_result(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_amd_ai_result();
+  PROTOBUF_NODISCARD std::string* release_amd_ai_result();
+  void set_allocated_amd_ai_result(std::string* amd_ai_result);
+  private:
+  const std::string& _internal_amd_ai_result() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_amd_ai_result(const std::string& value);
+  std::string* _internal_mutable_amd_ai_result();
+  public:
+
+  // string hangup_phrase = 50;
+  void clear_hangup_phrase();
+  const std::string& hangup_phrase() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hangup_phrase(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hangup_phrase();
+  PROTOBUF_NODISCARD std::string* release_hangup_phrase();
+  void set_allocated_hangup_phrase(std::string* hangup_phrase);
+  private:
+  const std::string& _internal_hangup_phrase() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hangup_phrase(const std::string& value);
+  std::string* _internal_mutable_hangup_phrase();
+  public:
+
+  // .fs.CallEventPayload.Endpoint from = 10;
+  bool has_from() const;
+  private:
+  bool _internal_has_from() const;
+  public:
+  void clear_from();
+  const ::fs::CallEventPayload_Endpoint& from() const;
+  PROTOBUF_NODISCARD ::fs::CallEventPayload_Endpoint* release_from();
+  ::fs::CallEventPayload_Endpoint* mutable_from();
+  void set_allocated_from(::fs::CallEventPayload_Endpoint* from);
+  private:
+  const ::fs::CallEventPayload_Endpoint& _internal_from() const;
+  ::fs::CallEventPayload_Endpoint* _internal_mutable_from();
+  public:
+  void unsafe_arena_set_allocated_from(
+      ::fs::CallEventPayload_Endpoint* from);
+  ::fs::CallEventPayload_Endpoint* unsafe_arena_release_from();
+
+  // .fs.CallEventPayload.Endpoint to = 11;
+  bool has_to() const;
+  private:
+  bool _internal_has_to() const;
+  public:
+  void clear_to();
+  const ::fs::CallEventPayload_Endpoint& to() const;
+  PROTOBUF_NODISCARD ::fs::CallEventPayload_Endpoint* release_to();
+  ::fs::CallEventPayload_Endpoint* mutable_to();
+  void set_allocated_to(::fs::CallEventPayload_Endpoint* to);
+  private:
+  const ::fs::CallEventPayload_Endpoint& _internal_to() const;
+  ::fs::CallEventPayload_Endpoint* _internal_mutable_to();
+  public:
+  void unsafe_arena_set_allocated_to(
+      ::fs::CallEventPayload_Endpoint* to);
+  ::fs::CallEventPayload_Endpoint* unsafe_arena_release_to();
+
+  // .fs.CallEventPayload.Parameters params = 18;
+  bool has_params() const;
+  private:
+  bool _internal_has_params() const;
+  public:
+  void clear_params();
+  const ::fs::CallEventPayload_Parameters& params() const;
+  PROTOBUF_NODISCARD ::fs::CallEventPayload_Parameters* release_params();
+  ::fs::CallEventPayload_Parameters* mutable_params();
+  void set_allocated_params(::fs::CallEventPayload_Parameters* params);
+  private:
+  const ::fs::CallEventPayload_Parameters& _internal_params() const;
+  ::fs::CallEventPayload_Parameters* _internal_mutable_params();
+  public:
+  void unsafe_arena_set_allocated_params(
+      ::fs::CallEventPayload_Parameters* params);
+  ::fs::CallEventPayload_Parameters* unsafe_arena_release_params();
+
+  // .fs.CallEventPayload.Eavesdrop eavesdrop = 19;
+  bool has_eavesdrop() const;
+  private:
+  bool _internal_has_eavesdrop() const;
+  public:
+  void clear_eavesdrop();
+  const ::fs::CallEventPayload_Eavesdrop& eavesdrop() const;
+  PROTOBUF_NODISCARD ::fs::CallEventPayload_Eavesdrop* release_eavesdrop();
+  ::fs::CallEventPayload_Eavesdrop* mutable_eavesdrop();
+  void set_allocated_eavesdrop(::fs::CallEventPayload_Eavesdrop* eavesdrop);
+  private:
+  const ::fs::CallEventPayload_Eavesdrop& _internal_eavesdrop() const;
+  ::fs::CallEventPayload_Eavesdrop* _internal_mutable_eavesdrop();
+  public:
+  void unsafe_arena_set_allocated_eavesdrop(
+      ::fs::CallEventPayload_Eavesdrop* eavesdrop);
+  ::fs::CallEventPayload_Eavesdrop* unsafe_arena_release_eavesdrop();
+
+  // int64 user_id = 1;
+  void clear_user_id();
+  int64_t user_id() const;
+  void set_user_id(int64_t value);
+  private:
+  int64_t _internal_user_id() const;
+  void _internal_set_user_id(int64_t value);
+  public:
+
+  // int64 gateway_id = 2;
+  void clear_gateway_id();
+  int64_t gateway_id() const;
+  void set_gateway_id(int64_t value);
+  private:
+  int64_t _internal_gateway_id() const;
+  void _internal_set_gateway_id(int64_t value);
+  public:
+
+  // int64 contact_id = 3;
+  void clear_contact_id();
+  int64_t contact_id() const;
+  void set_contact_id(int64_t value);
+  private:
+  int64_t _internal_contact_id() const;
+  void _internal_set_contact_id(int64_t value);
+  public:
+
+  // bool hide_contact = 4;
+  void clear_hide_contact();
+  bool hide_contact() const;
+  void set_hide_contact(bool value);
+  private:
+  bool _internal_hide_contact() const;
+  void _internal_set_hide_contact(bool value);
+  public:
+
+  // bool hideNumber = 5;
+  void clear_hidenumber();
+  bool hidenumber() const;
+  void set_hidenumber(bool value);
+  private:
+  bool _internal_hidenumber() const;
+  void _internal_set_hidenumber(bool value);
+  public:
+
+  // bool originate = 12;
+  void clear_originate();
+  bool originate() const;
+  void set_originate(bool value);
+  private:
+  bool _internal_originate() const;
+  void _internal_set_originate(bool value);
+  public:
+
+  // optional bool cdr = 29;
+  bool has_cdr() const;
+  private:
+  bool _internal_has_cdr() const;
+  public:
+  void clear_cdr();
+  bool cdr() const;
+  void set_cdr(bool value);
+  private:
+  bool _internal_cdr() const;
+  void _internal_set_cdr(bool value);
+  public:
+
+  // int32 heartbeat = 13;
+  void clear_heartbeat();
+  int32_t heartbeat() const;
+  void set_heartbeat(int32_t value);
+  private:
+  int32_t _internal_heartbeat() const;
+  void _internal_set_heartbeat(int32_t value);
+  public:
+
+  // int64 grantee_id = 15;
+  void clear_grantee_id();
+  int64_t grantee_id() const;
+  void set_grantee_id(int64_t value);
+  private:
+  int64_t _internal_grantee_id() const;
+  void _internal_set_grantee_id(int64_t value);
+  public:
+
+  // bool notification_hangup = 30;
+  void clear_notification_hangup();
+  bool notification_hangup() const;
+  void set_notification_hangup(bool value);
+  private:
+  bool _internal_notification_hangup() const;
+  void _internal_set_notification_hangup(bool value);
+  public:
+
+  // bool originate_success = 43;
+  void clear_originate_success();
+  bool originate_success() const;
+  void set_originate_success(bool value);
+  private:
+  bool _internal_originate_success() const;
+  void _internal_set_originate_success(bool value);
+  public:
+
+  // bool amd_ai_positive = 48;
+  void clear_amd_ai_positive();
+  bool amd_ai_positive() const;
+  void set_amd_ai_positive(bool value);
+  private:
+  bool _internal_amd_ai_positive() const;
+  void _internal_set_amd_ai_positive(bool value);
+  public:
+
+  // bool ai_local = 52;
+  void clear_ai_local();
+  bool ai_local() const;
+  void set_ai_local(bool value);
+  private:
+  bool _internal_ai_local() const;
+  void _internal_set_ai_local(bool value);
+  public:
+
+  // int32 sip = 44;
+  void clear_sip();
+  int32_t sip() const;
+  void set_sip(int32_t value);
+  private:
+  int32_t _internal_sip() const;
+  void _internal_set_sip(int32_t value);
+  public:
+
+  // bool ai_partial = 53;
+  void clear_ai_partial();
+  bool ai_partial() const;
+  void set_ai_partial(bool value);
+  private:
+  bool _internal_ai_partial() const;
+  void _internal_set_ai_partial(bool value);
+  public:
+
+  // float ai_confidence = 54;
+  void clear_ai_confidence();
+  float ai_confidence() const;
+  void set_ai_confidence(float value);
+  private:
+  float _internal_ai_confidence() const;
+  void _internal_set_ai_confidence(float value);
+  public:
+
+  // int64 ai_elapsed_ms = 55;
+  void clear_ai_elapsed_ms();
+  int64_t ai_elapsed_ms() const;
+  void set_ai_elapsed_ms(int64_t value);
+  private:
+  int64_t _internal_ai_elapsed_ms() const;
+  void _internal_set_ai_elapsed_ms(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.CallEventPayload)
  private:
   class _Internal;
 
@@ -1748,33 +2585,124 @@ class BroadcastResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-    ::fs::ErrorExecute* error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        CallEventPayload_PayloadEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> payload_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        CallEventPayload_QueueEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> queue_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> tags_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > schema_ids_;
+    mutable std::atomic<int> _schema_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> amd_ai_logs_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::CallEventPayload_Call > calls_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr direction_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr parent_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sip_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ivr_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bridged_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr digit_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr application_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr state_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ai_result_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ai_error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cause_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr amd_result_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr amd_cause_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr record_start_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr record_stop_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr transfer_to_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr transfer_from_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr transfer_to_agent_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr transfer_from_attempt_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr transfer_to_attempt_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr talk_sec_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hangup_by_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reporting_at_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr amd_ai_result_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hangup_phrase_;
+    ::fs::CallEventPayload_Endpoint* from_;
+    ::fs::CallEventPayload_Endpoint* to_;
+    ::fs::CallEventPayload_Parameters* params_;
+    ::fs::CallEventPayload_Eavesdrop* eavesdrop_;
+    int64_t user_id_;
+    int64_t gateway_id_;
+    int64_t contact_id_;
+    bool hide_contact_;
+    bool hidenumber_;
+    bool originate_;
+    bool cdr_;
+    int32_t heartbeat_;
+    int64_t grantee_id_;
+    bool notification_hangup_;
+    bool originate_success_;
+    bool amd_ai_positive_;
+    bool ai_local_;
+    int32_t sip_;
+    bool ai_partial_;
+    float ai_confidence_;
+    int64_t ai_elapsed_ms_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_fs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConfirmPushRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.ConfirmPushRequest) */ {
+class BreakParkRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BreakParkRequest_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BreakParkRequest_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  BreakParkRequest_VariablesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR BreakParkRequest_VariablesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit BreakParkRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const BreakParkRequest_VariablesEntry_DoNotUse& other);
+  static const BreakParkRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const BreakParkRequest_VariablesEntry_DoNotUse*>(&_BreakParkRequest_VariablesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BreakParkRequest.VariablesEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BreakParkRequest.VariablesEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_fs_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class BreakParkRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BreakParkRequest) */ {
  public:
-  inline ConfirmPushRequest() : ConfirmPushRequest(nullptr) {}
-  ~ConfirmPushRequest() override;
-  explicit PROTOBUF_CONSTEXPR ConfirmPushRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BreakParkRequest() : BreakParkRequest(nullptr) {}
+  ~BreakParkRequest() override;
+  explicit PROTOBUF_CONSTEXPR BreakParkRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ConfirmPushRequest(const ConfirmPushRequest& from);
-  ConfirmPushRequest(ConfirmPushRequest&& from) noexcept
-    : ConfirmPushRequest() {
+  BreakParkRequest(const BreakParkRequest& from);
+  BreakParkRequest(BreakParkRequest&& from) noexcept
+    : BreakParkRequest() {
     *this = ::std::move(from);
   }
 
-  inline ConfirmPushRequest& operator=(const ConfirmPushRequest& from) {
+  inline BreakParkRequest& operator=(const BreakParkRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ConfirmPushRequest& operator=(ConfirmPushRequest&& from) noexcept {
+  inline BreakParkRequest& operator=(BreakParkRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1797,20 +2725,20 @@ class ConfirmPushRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ConfirmPushRequest& default_instance() {
+  static const BreakParkRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ConfirmPushRequest* internal_default_instance() {
-    return reinterpret_cast<const ConfirmPushRequest*>(
-               &_ConfirmPushRequest_default_instance_);
+  static inline const BreakParkRequest* internal_default_instance() {
+    return reinterpret_cast<const BreakParkRequest*>(
+               &_BreakParkRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  friend void swap(ConfirmPushRequest& a, ConfirmPushRequest& b) {
+  friend void swap(BreakParkRequest& a, BreakParkRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ConfirmPushRequest* other) {
+  inline void Swap(BreakParkRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1823,7 +2751,7 @@ class ConfirmPushRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ConfirmPushRequest* other) {
+  void UnsafeArenaSwap(BreakParkRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1831,14 +2759,14 @@ class ConfirmPushRequest final :
 
   // implements Message ----------------------------------------------
 
-  ConfirmPushRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ConfirmPushRequest>(arena);
+  BreakParkRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BreakParkRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ConfirmPushRequest& from);
+  void CopyFrom(const BreakParkRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ConfirmPushRequest& from) {
-    ConfirmPushRequest::MergeImpl(*this, from);
+  void MergeFrom( const BreakParkRequest& from) {
+    BreakParkRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1856,16 +2784,18 @@ class ConfirmPushRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ConfirmPushRequest* other);
+  void InternalSwap(BreakParkRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.ConfirmPushRequest";
+    return "fs.BreakParkRequest";
   }
   protected:
-  explicit ConfirmPushRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BreakParkRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -1875,14 +2805,33 @@ class ConfirmPushRequest final :
 
   // nested types ----------------------------------------------------
 
+
   // accessors -------------------------------------------------------
 
   enum : int {
+    kVariablesFieldNumber = 2,
     kIdFieldNumber = 1,
   };
-  // string id = 1;
-  void clear_id();
-  const std::string& id() const;
+  // map<string, string> variables = 2;
+  int variables_size() const;
+  private:
+  int _internal_variables_size() const;
+  public:
+  void clear_variables();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_variables();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_variables();
+
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
   void set_id(ArgT0&& arg0, ArgT... args);
   std::string* mutable_id();
@@ -1894,7 +2843,7 @@ class ConfirmPushRequest final :
   std::string* _internal_mutable_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.ConfirmPushRequest)
+  // @@protoc_insertion_point(class_scope:fs.BreakParkRequest)
  private:
   class _Internal;
 
@@ -1902,6 +2851,11 @@ class ConfirmPushRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        BreakParkRequest_VariablesEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -1910,24 +2864,24 @@ class ConfirmPushRequest final :
 };
 // -------------------------------------------------------------------
 
-class ConfirmPushResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.ConfirmPushResponse) */ {
+class BreakParkResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BreakParkResponse) */ {
  public:
-  inline ConfirmPushResponse() : ConfirmPushResponse(nullptr) {}
-  ~ConfirmPushResponse() override;
-  explicit PROTOBUF_CONSTEXPR ConfirmPushResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BreakParkResponse() : BreakParkResponse(nullptr) {}
+  ~BreakParkResponse() override;
+  explicit PROTOBUF_CONSTEXPR BreakParkResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ConfirmPushResponse(const ConfirmPushResponse& from);
-  ConfirmPushResponse(ConfirmPushResponse&& from) noexcept
-    : ConfirmPushResponse() {
+  BreakParkResponse(const BreakParkResponse& from);
+  BreakParkResponse(BreakParkResponse&& from) noexcept
+    : BreakParkResponse() {
     *this = ::std::move(from);
   }
 
-  inline ConfirmPushResponse& operator=(const ConfirmPushResponse& from) {
+  inline BreakParkResponse& operator=(const BreakParkResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ConfirmPushResponse& operator=(ConfirmPushResponse&& from) noexcept {
+  inline BreakParkResponse& operator=(BreakParkResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1950,20 +2904,20 @@ class ConfirmPushResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ConfirmPushResponse& default_instance() {
+  static const BreakParkResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ConfirmPushResponse* internal_default_instance() {
-    return reinterpret_cast<const ConfirmPushResponse*>(
-               &_ConfirmPushResponse_default_instance_);
+  static inline const BreakParkResponse* internal_default_instance() {
+    return reinterpret_cast<const BreakParkResponse*>(
+               &_BreakParkResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  friend void swap(ConfirmPushResponse& a, ConfirmPushResponse& b) {
+  friend void swap(BreakParkResponse& a, BreakParkResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(ConfirmPushResponse* other) {
+  inline void Swap(BreakParkResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1976,7 +2930,7 @@ class ConfirmPushResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ConfirmPushResponse* other) {
+  void UnsafeArenaSwap(BreakParkResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1984,14 +2938,14 @@ class ConfirmPushResponse final :
 
   // implements Message ----------------------------------------------
 
-  ConfirmPushResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ConfirmPushResponse>(arena);
+  BreakParkResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BreakParkResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ConfirmPushResponse& from);
+  void CopyFrom(const BreakParkResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ConfirmPushResponse& from) {
-    ConfirmPushResponse::MergeImpl(*this, from);
+  void MergeFrom( const BreakParkResponse& from) {
+    BreakParkResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2009,15 +2963,15 @@ class ConfirmPushResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ConfirmPushResponse* other);
+  void InternalSwap(BreakParkResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.ConfirmPushResponse";
+    return "fs.BreakParkResponse";
   }
   protected:
-  explicit ConfirmPushResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BreakParkResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2031,27 +2985,18 @@ class ConfirmPushResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kErrorFieldNumber = 1,
+    kOkFieldNumber = 1,
   };
-  // .fs.ErrorExecute error = 1;
-  bool has_error() const;
-  private:
-  bool _internal_has_error() const;
-  public:
-  void clear_error();
-  const ::fs::ErrorExecute& error() const;
-  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
-  ::fs::ErrorExecute* mutable_error();
-  void set_allocated_error(::fs::ErrorExecute* error);
+  // bool ok = 1;
+  void clear_ok();
+  bool ok() const;
+  void set_ok(bool value);
   private:
-  const ::fs::ErrorExecute& _internal_error() const;
-  ::fs::ErrorExecute* _internal_mutable_error();
+  bool _internal_ok() const;
+  void _internal_set_ok(bool value);
   public:
-  void unsafe_arena_set_allocated_error(
-      ::fs::ErrorExecute* error);
-  ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.ConfirmPushResponse)
+  // @@protoc_insertion_point(class_scope:fs.BreakParkResponse)
  private:
   class _Internal;
 
@@ -2059,7 +3004,7 @@ class ConfirmPushResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::fs::ErrorExecute* error_;
+    bool ok_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2067,26 +3012,26 @@ class ConfirmPushResponse final :
 };
 // -------------------------------------------------------------------
 
-class SetProfileVarRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SetProfileVarRequest_VariablesEntry_DoNotUse, 
+class BlindTransferRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BlindTransferRequest_VariablesEntry_DoNotUse, 
     std::string, std::string,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
 public:
-  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SetProfileVarRequest_VariablesEntry_DoNotUse, 
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BlindTransferRequest_VariablesEntry_DoNotUse, 
     std::string, std::string,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
-  SetProfileVarRequest_VariablesEntry_DoNotUse();
-  explicit PROTOBUF_CONSTEXPR SetProfileVarRequest_VariablesEntry_DoNotUse(
+  BlindTransferRequest_VariablesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR BlindTransferRequest_VariablesEntry_DoNotUse(
       ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-  explicit SetProfileVarRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  void MergeFrom(const SetProfileVarRequest_VariablesEntry_DoNotUse& other);
-  static const SetProfileVarRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const SetProfileVarRequest_VariablesEntry_DoNotUse*>(&_SetProfileVarRequest_VariablesEntry_DoNotUse_default_instance_); }
+  explicit BlindTransferRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const BlindTransferRequest_VariablesEntry_DoNotUse& other);
+  static const BlindTransferRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const BlindTransferRequest_VariablesEntry_DoNotUse*>(&_BlindTransferRequest_VariablesEntry_DoNotUse_default_instance_); }
   static bool ValidateKey(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.SetProfileVarRequest.VariablesEntry.key");
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BlindTransferRequest.VariablesEntry.key");
  }
   static bool ValidateValue(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.SetProfileVarRequest.VariablesEntry.value");
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BlindTransferRequest.VariablesEntry.value");
  }
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
@@ -2095,24 +3040,24 @@ public:
 
 // -------------------------------------------------------------------
 
-class SetProfileVarRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SetProfileVarRequest) */ {
+class BlindTransferRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BlindTransferRequest) */ {
  public:
-  inline SetProfileVarRequest() : SetProfileVarRequest(nullptr) {}
-  ~SetProfileVarRequest() override;
-  explicit PROTOBUF_CONSTEXPR SetProfileVarRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BlindTransferRequest() : BlindTransferRequest(nullptr) {}
+  ~BlindTransferRequest() override;
+  explicit PROTOBUF_CONSTEXPR BlindTransferRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetProfileVarRequest(const SetProfileVarRequest& from);
-  SetProfileVarRequest(SetProfileVarRequest&& from) noexcept
-    : SetProfileVarRequest() {
+  BlindTransferRequest(const BlindTransferRequest& from);
+  BlindTransferRequest(BlindTransferRequest&& from) noexcept
+    : BlindTransferRequest() {
     *this = ::std::move(from);
   }
 
-  inline SetProfileVarRequest& operator=(const SetProfileVarRequest& from) {
+  inline BlindTransferRequest& operator=(const BlindTransferRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetProfileVarRequest& operator=(SetProfileVarRequest&& from) noexcept {
+  inline BlindTransferRequest& operator=(BlindTransferRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2135,20 +3080,20 @@ class SetProfileVarRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetProfileVarRequest& default_instance() {
+  static const BlindTransferRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetProfileVarRequest* internal_default_instance() {
-    return reinterpret_cast<const SetProfileVarRequest*>(
-               &_SetProfileVarRequest_default_instance_);
+  static inline const BlindTransferRequest* internal_default_instance() {
+    return reinterpret_cast<const BlindTransferRequest*>(
+               &_BlindTransferRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     13;
 
-  friend void swap(SetProfileVarRequest& a, SetProfileVarRequest& b) {
+  friend void swap(BlindTransferRequest& a, BlindTransferRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetProfileVarRequest* other) {
+  inline void Swap(BlindTransferRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2161,7 +3106,7 @@ class SetProfileVarRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetProfileVarRequest* other) {
+  void UnsafeArenaSwap(BlindTransferRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2169,14 +3114,14 @@ class SetProfileVarRequest final :
 
   // implements Message ----------------------------------------------
 
-  SetProfileVarRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetProfileVarRequest>(arena);
+  BlindTransferRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlindTransferRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetProfileVarRequest& from);
+  void CopyFrom(const BlindTransferRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetProfileVarRequest& from) {
-    SetProfileVarRequest::MergeImpl(*this, from);
+  void MergeFrom( const BlindTransferRequest& from) {
+    BlindTransferRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2194,15 +3139,15 @@ class SetProfileVarRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetProfileVarRequest* other);
+  void InternalSwap(BlindTransferRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.SetProfileVarRequest";
+    return "fs.BlindTransferRequest";
   }
   protected:
-  explicit SetProfileVarRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BlindTransferRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -2219,10 +3164,13 @@ class SetProfileVarRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kVariablesFieldNumber = 2,
+    kVariablesFieldNumber = 3,
     kIdFieldNumber = 1,
+    kDestinationFieldNumber = 2,
+    kDialplanFieldNumber = 4,
+    kContextFieldNumber = 5,
   };
-  // map<string, string> variables = 2;
+  // map<string, string> variables = 3;
   int variables_size() const;
   private:
   int _internal_variables_size() const;
@@ -2253,7 +3201,49 @@ class SetProfileVarRequest final :
   std::string* _internal_mutable_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.SetProfileVarRequest)
+  // string destination = 2;
+  void clear_destination();
+  const std::string& destination() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_destination(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_destination();
+  PROTOBUF_NODISCARD std::string* release_destination();
+  void set_allocated_destination(std::string* destination);
+  private:
+  const std::string& _internal_destination() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
+  std::string* _internal_mutable_destination();
+  public:
+
+  // string dialplan = 4;
+  void clear_dialplan();
+  const std::string& dialplan() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_dialplan(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_dialplan();
+  PROTOBUF_NODISCARD std::string* release_dialplan();
+  void set_allocated_dialplan(std::string* dialplan);
+  private:
+  const std::string& _internal_dialplan() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dialplan(const std::string& value);
+  std::string* _internal_mutable_dialplan();
+  public:
+
+  // string context = 5;
+  void clear_context();
+  const std::string& context() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_context(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_context();
+  PROTOBUF_NODISCARD std::string* release_context();
+  void set_allocated_context(std::string* context);
+  private:
+  const std::string& _internal_context() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_context(const std::string& value);
+  std::string* _internal_mutable_context();
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.BlindTransferRequest)
  private:
   class _Internal;
 
@@ -2262,11 +3252,14 @@ class SetProfileVarRequest final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-        SetProfileVarRequest_VariablesEntry_DoNotUse,
+        BlindTransferRequest_VariablesEntry_DoNotUse,
         std::string, std::string,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dialplan_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr context_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2274,23 +3267,24 @@ class SetProfileVarRequest final :
 };
 // -------------------------------------------------------------------
 
-class SetProfileVarResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:fs.SetProfileVarResponse) */ {
+class BlindTransferResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BlindTransferResponse) */ {
  public:
-  inline SetProfileVarResponse() : SetProfileVarResponse(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR SetProfileVarResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BlindTransferResponse() : BlindTransferResponse(nullptr) {}
+  ~BlindTransferResponse() override;
+  explicit PROTOBUF_CONSTEXPR BlindTransferResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetProfileVarResponse(const SetProfileVarResponse& from);
-  SetProfileVarResponse(SetProfileVarResponse&& from) noexcept
-    : SetProfileVarResponse() {
+  BlindTransferResponse(const BlindTransferResponse& from);
+  BlindTransferResponse(BlindTransferResponse&& from) noexcept
+    : BlindTransferResponse() {
     *this = ::std::move(from);
   }
 
-  inline SetProfileVarResponse& operator=(const SetProfileVarResponse& from) {
+  inline BlindTransferResponse& operator=(const BlindTransferResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetProfileVarResponse& operator=(SetProfileVarResponse&& from) noexcept {
+  inline BlindTransferResponse& operator=(BlindTransferResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2313,20 +3307,20 @@ class SetProfileVarResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetProfileVarResponse& default_instance() {
+  static const BlindTransferResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetProfileVarResponse* internal_default_instance() {
-    return reinterpret_cast<const SetProfileVarResponse*>(
-               &_SetProfileVarResponse_default_instance_);
+  static inline const BlindTransferResponse* internal_default_instance() {
+    return reinterpret_cast<const BlindTransferResponse*>(
+               &_BlindTransferResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  friend void swap(SetProfileVarResponse& a, SetProfileVarResponse& b) {
+  friend void swap(BlindTransferResponse& a, BlindTransferResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetProfileVarResponse* other) {
+  inline void Swap(BlindTransferResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2339,7 +3333,7 @@ class SetProfileVarResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetProfileVarResponse* other) {
+  void UnsafeArenaSwap(BlindTransferResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2347,26 +3341,40 @@ class SetProfileVarResponse final :
 
   // implements Message ----------------------------------------------
 
-  SetProfileVarResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetProfileVarResponse>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const SetProfileVarResponse& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  BlindTransferResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BlindTransferResponse>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const SetProfileVarResponse& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BlindTransferResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BlindTransferResponse& from) {
+    BlindTransferResponse::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BlindTransferResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.SetProfileVarResponse";
+    return "fs.BlindTransferResponse";
   }
   protected:
-  explicit SetProfileVarResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BlindTransferResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2379,7 +3387,28 @@ class SetProfileVarResponse final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:fs.SetProfileVarResponse)
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // .fs.ErrorExecute error = 1;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const ::fs::ErrorExecute& error() const;
+  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
+  ::fs::ErrorExecute* mutable_error();
+  void set_allocated_error(::fs::ErrorExecute* error);
+  private:
+  const ::fs::ErrorExecute& _internal_error() const;
+  ::fs::ErrorExecute* _internal_mutable_error();
+  public:
+  void unsafe_arena_set_allocated_error(
+      ::fs::ErrorExecute* error);
+  ::fs::ErrorExecute* unsafe_arena_release_error();
+
+  // @@protoc_insertion_point(class_scope:fs.BlindTransferResponse)
  private:
   class _Internal;
 
@@ -2387,29 +3416,32 @@ class SetProfileVarResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::fs::ErrorExecute* error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_fs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class StopPlaybackRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.StopPlaybackRequest) */ {
+class SetEavesdropStateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SetEavesdropStateRequest) */ {
  public:
-  inline StopPlaybackRequest() : StopPlaybackRequest(nullptr) {}
-  ~StopPlaybackRequest() override;
-  explicit PROTOBUF_CONSTEXPR StopPlaybackRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetEavesdropStateRequest() : SetEavesdropStateRequest(nullptr) {}
+  ~SetEavesdropStateRequest() override;
+  explicit PROTOBUF_CONSTEXPR SetEavesdropStateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  StopPlaybackRequest(const StopPlaybackRequest& from);
-  StopPlaybackRequest(StopPlaybackRequest&& from) noexcept
-    : StopPlaybackRequest() {
+  SetEavesdropStateRequest(const SetEavesdropStateRequest& from);
+  SetEavesdropStateRequest(SetEavesdropStateRequest&& from) noexcept
+    : SetEavesdropStateRequest() {
     *this = ::std::move(from);
   }
 
-  inline StopPlaybackRequest& operator=(const StopPlaybackRequest& from) {
+  inline SetEavesdropStateRequest& operator=(const SetEavesdropStateRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline StopPlaybackRequest& operator=(StopPlaybackRequest&& from) noexcept {
+  inline SetEavesdropStateRequest& operator=(SetEavesdropStateRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2432,20 +3464,20 @@ class StopPlaybackRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const StopPlaybackRequest& default_instance() {
+  static const SetEavesdropStateRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const StopPlaybackRequest* internal_default_instance() {
-    return reinterpret_cast<const StopPlaybackRequest*>(
-               &_StopPlaybackRequest_default_instance_);
+  static inline const SetEavesdropStateRequest* internal_default_instance() {
+    return reinterpret_cast<const SetEavesdropStateRequest*>(
+               &_SetEavesdropStateRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     15;
 
-  friend void swap(StopPlaybackRequest& a, StopPlaybackRequest& b) {
+  friend void swap(SetEavesdropStateRequest& a, SetEavesdropStateRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(StopPlaybackRequest* other) {
+  inline void Swap(SetEavesdropStateRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2458,7 +3490,7 @@ class StopPlaybackRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(StopPlaybackRequest* other) {
+  void UnsafeArenaSwap(SetEavesdropStateRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2466,14 +3498,14 @@ class StopPlaybackRequest final :
 
   // implements Message ----------------------------------------------
 
-  StopPlaybackRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<StopPlaybackRequest>(arena);
+  SetEavesdropStateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetEavesdropStateRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const StopPlaybackRequest& from);
+  void CopyFrom(const SetEavesdropStateRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const StopPlaybackRequest& from) {
-    StopPlaybackRequest::MergeImpl(*this, from);
+  void MergeFrom( const SetEavesdropStateRequest& from) {
+    SetEavesdropStateRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2491,15 +3523,15 @@ class StopPlaybackRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(StopPlaybackRequest* other);
+  void InternalSwap(SetEavesdropStateRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.StopPlaybackRequest";
+    return "fs.SetEavesdropStateRequest";
   }
   protected:
-  explicit StopPlaybackRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetEavesdropStateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2514,6 +3546,7 @@ class StopPlaybackRequest final :
 
   enum : int {
     kIdFieldNumber = 1,
+    kStateFieldNumber = 2,
   };
   // string id = 1;
   void clear_id();
@@ -2529,7 +3562,21 @@ class StopPlaybackRequest final :
   std::string* _internal_mutable_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.StopPlaybackRequest)
+  // string state = 2;
+  void clear_state();
+  const std::string& state() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_state(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_state();
+  PROTOBUF_NODISCARD std::string* release_state();
+  void set_allocated_state(std::string* state);
+  private:
+  const std::string& _internal_state() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_state(const std::string& value);
+  std::string* _internal_mutable_state();
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.SetEavesdropStateRequest)
  private:
   class _Internal;
 
@@ -2538,6 +3585,7 @@ class StopPlaybackRequest final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr state_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2545,23 +3593,24 @@ class StopPlaybackRequest final :
 };
 // -------------------------------------------------------------------
 
-class StopPlaybackResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:fs.StopPlaybackResponse) */ {
+class SetEavesdropStateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SetEavesdropStateResponse) */ {
  public:
-  inline StopPlaybackResponse() : StopPlaybackResponse(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR StopPlaybackResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetEavesdropStateResponse() : SetEavesdropStateResponse(nullptr) {}
+  ~SetEavesdropStateResponse() override;
+  explicit PROTOBUF_CONSTEXPR SetEavesdropStateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  StopPlaybackResponse(const StopPlaybackResponse& from);
-  StopPlaybackResponse(StopPlaybackResponse&& from) noexcept
-    : StopPlaybackResponse() {
+  SetEavesdropStateResponse(const SetEavesdropStateResponse& from);
+  SetEavesdropStateResponse(SetEavesdropStateResponse&& from) noexcept
+    : SetEavesdropStateResponse() {
     *this = ::std::move(from);
   }
 
-  inline StopPlaybackResponse& operator=(const StopPlaybackResponse& from) {
+  inline SetEavesdropStateResponse& operator=(const SetEavesdropStateResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline StopPlaybackResponse& operator=(StopPlaybackResponse&& from) noexcept {
+  inline SetEavesdropStateResponse& operator=(SetEavesdropStateResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2584,20 +3633,20 @@ class StopPlaybackResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const StopPlaybackResponse& default_instance() {
+  static const SetEavesdropStateResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const StopPlaybackResponse* internal_default_instance() {
-    return reinterpret_cast<const StopPlaybackResponse*>(
-               &_StopPlaybackResponse_default_instance_);
+  static inline const SetEavesdropStateResponse* internal_default_instance() {
+    return reinterpret_cast<const SetEavesdropStateResponse*>(
+               &_SetEavesdropStateResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     16;
 
-  friend void swap(StopPlaybackResponse& a, StopPlaybackResponse& b) {
+  friend void swap(SetEavesdropStateResponse& a, SetEavesdropStateResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(StopPlaybackResponse* other) {
+  inline void Swap(SetEavesdropStateResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2610,7 +3659,7 @@ class StopPlaybackResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(StopPlaybackResponse* other) {
+  void UnsafeArenaSwap(SetEavesdropStateResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2618,26 +3667,40 @@ class StopPlaybackResponse final :
 
   // implements Message ----------------------------------------------
 
-  StopPlaybackResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<StopPlaybackResponse>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const StopPlaybackResponse& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  SetEavesdropStateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetEavesdropStateResponse>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const StopPlaybackResponse& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetEavesdropStateResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetEavesdropStateResponse& from) {
+    SetEavesdropStateResponse::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetEavesdropStateResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.StopPlaybackResponse";
+    return "fs.SetEavesdropStateResponse";
   }
   protected:
-  explicit StopPlaybackResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetEavesdropStateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2650,7 +3713,28 @@ class StopPlaybackResponse final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:fs.StopPlaybackResponse)
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // .fs.ErrorExecute error = 1;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const ::fs::ErrorExecute& error() const;
+  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
+  ::fs::ErrorExecute* mutable_error();
+  void set_allocated_error(::fs::ErrorExecute* error);
+  private:
+  const ::fs::ErrorExecute& _internal_error() const;
+  ::fs::ErrorExecute* _internal_mutable_error();
+  public:
+  void unsafe_arena_set_allocated_error(
+      ::fs::ErrorExecute* error);
+  ::fs::ErrorExecute* unsafe_arena_release_error();
+
+  // @@protoc_insertion_point(class_scope:fs.SetEavesdropStateResponse)
  private:
   class _Internal;
 
@@ -2658,57 +3742,32 @@ class StopPlaybackResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::fs::ErrorExecute* error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_fs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BridgeCallRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BridgeCallRequest_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
-public:
-  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BridgeCallRequest_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
-  BridgeCallRequest_VariablesEntry_DoNotUse();
-  explicit PROTOBUF_CONSTEXPR BridgeCallRequest_VariablesEntry_DoNotUse(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-  explicit BridgeCallRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  void MergeFrom(const BridgeCallRequest_VariablesEntry_DoNotUse& other);
-  static const BridgeCallRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const BridgeCallRequest_VariablesEntry_DoNotUse*>(&_BridgeCallRequest_VariablesEntry_DoNotUse_default_instance_); }
-  static bool ValidateKey(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BridgeCallRequest.VariablesEntry.key");
- }
-  static bool ValidateValue(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BridgeCallRequest.VariablesEntry.value");
- }
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  friend struct ::TableStruct_fs_2eproto;
-};
-
-// -------------------------------------------------------------------
-
-class BridgeCallRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BridgeCallRequest) */ {
+class BroadcastRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BroadcastRequest) */ {
  public:
-  inline BridgeCallRequest() : BridgeCallRequest(nullptr) {}
-  ~BridgeCallRequest() override;
-  explicit PROTOBUF_CONSTEXPR BridgeCallRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BroadcastRequest() : BroadcastRequest(nullptr) {}
+  ~BroadcastRequest() override;
+  explicit PROTOBUF_CONSTEXPR BroadcastRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BridgeCallRequest(const BridgeCallRequest& from);
-  BridgeCallRequest(BridgeCallRequest&& from) noexcept
-    : BridgeCallRequest() {
+  BroadcastRequest(const BroadcastRequest& from);
+  BroadcastRequest(BroadcastRequest&& from) noexcept
+    : BroadcastRequest() {
     *this = ::std::move(from);
   }
 
-  inline BridgeCallRequest& operator=(const BridgeCallRequest& from) {
+  inline BroadcastRequest& operator=(const BroadcastRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BridgeCallRequest& operator=(BridgeCallRequest&& from) noexcept {
+  inline BroadcastRequest& operator=(BroadcastRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2731,20 +3790,20 @@ class BridgeCallRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const BridgeCallRequest& default_instance() {
+  static const BroadcastRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BridgeCallRequest* internal_default_instance() {
-    return reinterpret_cast<const BridgeCallRequest*>(
-               &_BridgeCallRequest_default_instance_);
+  static inline const BroadcastRequest* internal_default_instance() {
+    return reinterpret_cast<const BroadcastRequest*>(
+               &_BroadcastRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    18;
+    17;
 
-  friend void swap(BridgeCallRequest& a, BridgeCallRequest& b) {
+  friend void swap(BroadcastRequest& a, BroadcastRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(BridgeCallRequest* other) {
+  inline void Swap(BroadcastRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2757,7 +3816,7 @@ class BridgeCallRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BridgeCallRequest* other) {
+  void UnsafeArenaSwap(BroadcastRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2765,14 +3824,14 @@ class BridgeCallRequest final :
 
   // implements Message ----------------------------------------------
 
-  BridgeCallRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BridgeCallRequest>(arena);
+  BroadcastRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BroadcastRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const BridgeCallRequest& from);
+  void CopyFrom(const BroadcastRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const BridgeCallRequest& from) {
-    BridgeCallRequest::MergeImpl(*this, from);
+  void MergeFrom( const BroadcastRequest& from) {
+    BroadcastRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2790,18 +3849,16 @@ class BridgeCallRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BridgeCallRequest* other);
+  void InternalSwap(BroadcastRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.BridgeCallRequest";
+    return "fs.BroadcastRequest";
   }
   protected:
-  explicit BridgeCallRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BroadcastRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -2811,60 +3868,66 @@ class BridgeCallRequest final :
 
   // nested types ----------------------------------------------------
 
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kVariablesFieldNumber = 3,
-    kLegAIdFieldNumber = 1,
-    kLegBIdFieldNumber = 2,
+    kIdFieldNumber = 1,
+    kArgsFieldNumber = 2,
+    kLegFieldNumber = 4,
+    kWaitForAnswerFieldNumber = 3,
   };
-  // map<string, string> variables = 3;
-  int variables_size() const;
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
   private:
-  int _internal_variables_size() const;
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
   public:
-  void clear_variables();
+
+  // string args = 2;
+  void clear_args();
+  const std::string& args() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_args(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_args();
+  PROTOBUF_NODISCARD std::string* release_args();
+  void set_allocated_args(std::string* args);
   private:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      _internal_variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      _internal_mutable_variables();
+  const std::string& _internal_args() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_args(const std::string& value);
+  std::string* _internal_mutable_args();
   public:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      mutable_variables();
 
-  // string leg_a_id = 1;
-  void clear_leg_a_id();
-  const std::string& leg_a_id() const;
+  // string leg = 4;
+  void clear_leg();
+  const std::string& leg() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_leg_a_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_leg_a_id();
-  PROTOBUF_NODISCARD std::string* release_leg_a_id();
-  void set_allocated_leg_a_id(std::string* leg_a_id);
+  void set_leg(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leg();
+  PROTOBUF_NODISCARD std::string* release_leg();
+  void set_allocated_leg(std::string* leg);
   private:
-  const std::string& _internal_leg_a_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg_a_id(const std::string& value);
-  std::string* _internal_mutable_leg_a_id();
+  const std::string& _internal_leg() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg(const std::string& value);
+  std::string* _internal_mutable_leg();
   public:
 
-  // string leg_b_id = 2;
-  void clear_leg_b_id();
-  const std::string& leg_b_id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_leg_b_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_leg_b_id();
-  PROTOBUF_NODISCARD std::string* release_leg_b_id();
-  void set_allocated_leg_b_id(std::string* leg_b_id);
+  // bool wait_for_answer = 3;
+  void clear_wait_for_answer();
+  bool wait_for_answer() const;
+  void set_wait_for_answer(bool value);
   private:
-  const std::string& _internal_leg_b_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg_b_id(const std::string& value);
-  std::string* _internal_mutable_leg_b_id();
+  bool _internal_wait_for_answer() const;
+  void _internal_set_wait_for_answer(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.BridgeCallRequest)
+  // @@protoc_insertion_point(class_scope:fs.BroadcastRequest)
  private:
   class _Internal;
 
@@ -2872,13 +3935,10 @@ class BridgeCallRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-        BridgeCallRequest_VariablesEntry_DoNotUse,
-        std::string, std::string,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_a_id_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_b_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr args_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_;
+    bool wait_for_answer_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2886,24 +3946,24 @@ class BridgeCallRequest final :
 };
 // -------------------------------------------------------------------
 
-class BridgeCallResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BridgeCallResponse) */ {
+class BroadcastResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BroadcastResponse) */ {
  public:
-  inline BridgeCallResponse() : BridgeCallResponse(nullptr) {}
-  ~BridgeCallResponse() override;
-  explicit PROTOBUF_CONSTEXPR BridgeCallResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BroadcastResponse() : BroadcastResponse(nullptr) {}
+  ~BroadcastResponse() override;
+  explicit PROTOBUF_CONSTEXPR BroadcastResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BridgeCallResponse(const BridgeCallResponse& from);
-  BridgeCallResponse(BridgeCallResponse&& from) noexcept
-    : BridgeCallResponse() {
+  BroadcastResponse(const BroadcastResponse& from);
+  BroadcastResponse(BroadcastResponse&& from) noexcept
+    : BroadcastResponse() {
     *this = ::std::move(from);
   }
 
-  inline BridgeCallResponse& operator=(const BridgeCallResponse& from) {
+  inline BroadcastResponse& operator=(const BroadcastResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BridgeCallResponse& operator=(BridgeCallResponse&& from) noexcept {
+  inline BroadcastResponse& operator=(BroadcastResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2926,20 +3986,20 @@ class BridgeCallResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const BridgeCallResponse& default_instance() {
+  static const BroadcastResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BridgeCallResponse* internal_default_instance() {
-    return reinterpret_cast<const BridgeCallResponse*>(
-               &_BridgeCallResponse_default_instance_);
+  static inline const BroadcastResponse* internal_default_instance() {
+    return reinterpret_cast<const BroadcastResponse*>(
+               &_BroadcastResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    19;
+    18;
 
-  friend void swap(BridgeCallResponse& a, BridgeCallResponse& b) {
+  friend void swap(BroadcastResponse& a, BroadcastResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(BridgeCallResponse* other) {
+  inline void Swap(BroadcastResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2952,7 +4012,7 @@ class BridgeCallResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BridgeCallResponse* other) {
+  void UnsafeArenaSwap(BroadcastResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2960,14 +4020,14 @@ class BridgeCallResponse final :
 
   // implements Message ----------------------------------------------
 
-  BridgeCallResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BridgeCallResponse>(arena);
+  BroadcastResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BroadcastResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const BridgeCallResponse& from);
+  void CopyFrom(const BroadcastResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const BridgeCallResponse& from) {
-    BridgeCallResponse::MergeImpl(*this, from);
+  void MergeFrom( const BroadcastResponse& from) {
+    BroadcastResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2985,15 +4045,15 @@ class BridgeCallResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BridgeCallResponse* other);
+  void InternalSwap(BroadcastResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.BridgeCallResponse";
+    return "fs.BroadcastResponse";
   }
   protected:
-  explicit BridgeCallResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BroadcastResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3007,21 +4067,21 @@ class BridgeCallResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUuidFieldNumber = 1,
+    kDataFieldNumber = 1,
     kErrorFieldNumber = 2,
   };
-  // string uuid = 1;
-  void clear_uuid();
-  const std::string& uuid() const;
+  // string data = 1;
+  void clear_data();
+  const std::string& data() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_uuid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_uuid();
-  PROTOBUF_NODISCARD std::string* release_uuid();
-  void set_allocated_uuid(std::string* uuid);
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
   private:
-  const std::string& _internal_uuid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
-  std::string* _internal_mutable_uuid();
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
   public:
 
   // .fs.ErrorExecute error = 2;
@@ -3042,7 +4102,7 @@ class BridgeCallResponse final :
       ::fs::ErrorExecute* error);
   ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.BridgeCallResponse)
+  // @@protoc_insertion_point(class_scope:fs.BroadcastResponse)
  private:
   class _Internal;
 
@@ -3050,7 +4110,7 @@ class BridgeCallResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
     ::fs::ErrorExecute* error_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -3059,24 +4119,24 @@ class BridgeCallResponse final :
 };
 // -------------------------------------------------------------------
 
-class HoldRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HoldRequest) */ {
+class ConfirmPushRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.ConfirmPushRequest) */ {
  public:
-  inline HoldRequest() : HoldRequest(nullptr) {}
-  ~HoldRequest() override;
-  explicit PROTOBUF_CONSTEXPR HoldRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ConfirmPushRequest() : ConfirmPushRequest(nullptr) {}
+  ~ConfirmPushRequest() override;
+  explicit PROTOBUF_CONSTEXPR ConfirmPushRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  HoldRequest(const HoldRequest& from);
-  HoldRequest(HoldRequest&& from) noexcept
-    : HoldRequest() {
+  ConfirmPushRequest(const ConfirmPushRequest& from);
+  ConfirmPushRequest(ConfirmPushRequest&& from) noexcept
+    : ConfirmPushRequest() {
     *this = ::std::move(from);
   }
 
-  inline HoldRequest& operator=(const HoldRequest& from) {
+  inline ConfirmPushRequest& operator=(const ConfirmPushRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline HoldRequest& operator=(HoldRequest&& from) noexcept {
+  inline ConfirmPushRequest& operator=(ConfirmPushRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3099,20 +4159,20 @@ class HoldRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const HoldRequest& default_instance() {
+  static const ConfirmPushRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const HoldRequest* internal_default_instance() {
-    return reinterpret_cast<const HoldRequest*>(
-               &_HoldRequest_default_instance_);
+  static inline const ConfirmPushRequest* internal_default_instance() {
+    return reinterpret_cast<const ConfirmPushRequest*>(
+               &_ConfirmPushRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    20;
+    19;
 
-  friend void swap(HoldRequest& a, HoldRequest& b) {
+  friend void swap(ConfirmPushRequest& a, ConfirmPushRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(HoldRequest* other) {
+  inline void Swap(ConfirmPushRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3125,7 +4185,7 @@ class HoldRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(HoldRequest* other) {
+  void UnsafeArenaSwap(ConfirmPushRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3133,14 +4193,14 @@ class HoldRequest final :
 
   // implements Message ----------------------------------------------
 
-  HoldRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<HoldRequest>(arena);
+  ConfirmPushRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfirmPushRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const HoldRequest& from);
+  void CopyFrom(const ConfirmPushRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const HoldRequest& from) {
-    HoldRequest::MergeImpl(*this, from);
+  void MergeFrom( const ConfirmPushRequest& from) {
+    ConfirmPushRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3158,15 +4218,15 @@ class HoldRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(HoldRequest* other);
+  void InternalSwap(ConfirmPushRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.HoldRequest";
+    return "fs.ConfirmPushRequest";
   }
   protected:
-  explicit HoldRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ConfirmPushRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3182,31 +4242,21 @@ class HoldRequest final :
   enum : int {
     kIdFieldNumber = 1,
   };
-  // repeated string id = 1;
-  int id_size() const;
-  private:
-  int _internal_id_size() const;
-  public:
+  // string id = 1;
   void clear_id();
-  const std::string& id(int index) const;
-  std::string* mutable_id(int index);
-  void set_id(int index, const std::string& value);
-  void set_id(int index, std::string&& value);
-  void set_id(int index, const char* value);
-  void set_id(int index, const char* value, size_t size);
-  std::string* add_id();
-  void add_id(const std::string& value);
-  void add_id(std::string&& value);
-  void add_id(const char* value);
-  void add_id(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
   private:
-  const std::string& _internal_id(int index) const;
-  std::string* _internal_add_id();
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.HoldRequest)
+  // @@protoc_insertion_point(class_scope:fs.ConfirmPushRequest)
  private:
   class _Internal;
 
@@ -3214,7 +4264,7 @@ class HoldRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3222,24 +4272,24 @@ class HoldRequest final :
 };
 // -------------------------------------------------------------------
 
-class HoldResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HoldResponse) */ {
+class ConfirmPushResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.ConfirmPushResponse) */ {
  public:
-  inline HoldResponse() : HoldResponse(nullptr) {}
-  ~HoldResponse() override;
-  explicit PROTOBUF_CONSTEXPR HoldResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ConfirmPushResponse() : ConfirmPushResponse(nullptr) {}
+  ~ConfirmPushResponse() override;
+  explicit PROTOBUF_CONSTEXPR ConfirmPushResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  HoldResponse(const HoldResponse& from);
-  HoldResponse(HoldResponse&& from) noexcept
-    : HoldResponse() {
+  ConfirmPushResponse(const ConfirmPushResponse& from);
+  ConfirmPushResponse(ConfirmPushResponse&& from) noexcept
+    : ConfirmPushResponse() {
     *this = ::std::move(from);
   }
 
-  inline HoldResponse& operator=(const HoldResponse& from) {
+  inline ConfirmPushResponse& operator=(const ConfirmPushResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline HoldResponse& operator=(HoldResponse&& from) noexcept {
+  inline ConfirmPushResponse& operator=(ConfirmPushResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3262,20 +4312,20 @@ class HoldResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const HoldResponse& default_instance() {
+  static const ConfirmPushResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const HoldResponse* internal_default_instance() {
-    return reinterpret_cast<const HoldResponse*>(
-               &_HoldResponse_default_instance_);
+  static inline const ConfirmPushResponse* internal_default_instance() {
+    return reinterpret_cast<const ConfirmPushResponse*>(
+               &_ConfirmPushResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    21;
+    20;
 
-  friend void swap(HoldResponse& a, HoldResponse& b) {
+  friend void swap(ConfirmPushResponse& a, ConfirmPushResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(HoldResponse* other) {
+  inline void Swap(ConfirmPushResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3288,7 +4338,7 @@ class HoldResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(HoldResponse* other) {
+  void UnsafeArenaSwap(ConfirmPushResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3296,14 +4346,14 @@ class HoldResponse final :
 
   // implements Message ----------------------------------------------
 
-  HoldResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<HoldResponse>(arena);
+  ConfirmPushResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfirmPushResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const HoldResponse& from);
+  void CopyFrom(const ConfirmPushResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const HoldResponse& from) {
-    HoldResponse::MergeImpl(*this, from);
+  void MergeFrom( const ConfirmPushResponse& from) {
+    ConfirmPushResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3321,15 +4371,15 @@ class HoldResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(HoldResponse* other);
+  void InternalSwap(ConfirmPushResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.HoldResponse";
+    return "fs.ConfirmPushResponse";
   }
   protected:
-  explicit HoldResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ConfirmPushResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3343,33 +4393,27 @@ class HoldResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kIdFieldNumber = 1,
+    kErrorFieldNumber = 1,
   };
-  // repeated string id = 1;
-  int id_size() const;
+  // .fs.ErrorExecute error = 1;
+  bool has_error() const;
   private:
-  int _internal_id_size() const;
+  bool _internal_has_error() const;
   public:
-  void clear_id();
-  const std::string& id(int index) const;
-  std::string* mutable_id(int index);
-  void set_id(int index, const std::string& value);
-  void set_id(int index, std::string&& value);
-  void set_id(int index, const char* value);
-  void set_id(int index, const char* value, size_t size);
-  std::string* add_id();
-  void add_id(const std::string& value);
-  void add_id(std::string&& value);
-  void add_id(const char* value);
-  void add_id(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
+  void clear_error();
+  const ::fs::ErrorExecute& error() const;
+  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
+  ::fs::ErrorExecute* mutable_error();
+  void set_allocated_error(::fs::ErrorExecute* error);
   private:
-  const std::string& _internal_id(int index) const;
-  std::string* _internal_add_id();
+  const ::fs::ErrorExecute& _internal_error() const;
+  ::fs::ErrorExecute* _internal_mutable_error();
   public:
+  void unsafe_arena_set_allocated_error(
+      ::fs::ErrorExecute* error);
+  ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.HoldResponse)
+  // @@protoc_insertion_point(class_scope:fs.ConfirmPushResponse)
  private:
   class _Internal;
 
@@ -3377,7 +4421,7 @@ class HoldResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
+    ::fs::ErrorExecute* error_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3385,24 +4429,52 @@ class HoldResponse final :
 };
 // -------------------------------------------------------------------
 
-class UnHoldRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.UnHoldRequest) */ {
+class SetProfileVarRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SetProfileVarRequest_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SetProfileVarRequest_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  SetProfileVarRequest_VariablesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR SetProfileVarRequest_VariablesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit SetProfileVarRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const SetProfileVarRequest_VariablesEntry_DoNotUse& other);
+  static const SetProfileVarRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const SetProfileVarRequest_VariablesEntry_DoNotUse*>(&_SetProfileVarRequest_VariablesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.SetProfileVarRequest.VariablesEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.SetProfileVarRequest.VariablesEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_fs_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class SetProfileVarRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SetProfileVarRequest) */ {
  public:
-  inline UnHoldRequest() : UnHoldRequest(nullptr) {}
-  ~UnHoldRequest() override;
-  explicit PROTOBUF_CONSTEXPR UnHoldRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetProfileVarRequest() : SetProfileVarRequest(nullptr) {}
+  ~SetProfileVarRequest() override;
+  explicit PROTOBUF_CONSTEXPR SetProfileVarRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UnHoldRequest(const UnHoldRequest& from);
-  UnHoldRequest(UnHoldRequest&& from) noexcept
-    : UnHoldRequest() {
+  SetProfileVarRequest(const SetProfileVarRequest& from);
+  SetProfileVarRequest(SetProfileVarRequest&& from) noexcept
+    : SetProfileVarRequest() {
     *this = ::std::move(from);
   }
 
-  inline UnHoldRequest& operator=(const UnHoldRequest& from) {
+  inline SetProfileVarRequest& operator=(const SetProfileVarRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline UnHoldRequest& operator=(UnHoldRequest&& from) noexcept {
+  inline SetProfileVarRequest& operator=(SetProfileVarRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3425,20 +4497,20 @@ class UnHoldRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const UnHoldRequest& default_instance() {
+  static const SetProfileVarRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const UnHoldRequest* internal_default_instance() {
-    return reinterpret_cast<const UnHoldRequest*>(
-               &_UnHoldRequest_default_instance_);
+  static inline const SetProfileVarRequest* internal_default_instance() {
+    return reinterpret_cast<const SetProfileVarRequest*>(
+               &_SetProfileVarRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     22;
 
-  friend void swap(UnHoldRequest& a, UnHoldRequest& b) {
+  friend void swap(SetProfileVarRequest& a, SetProfileVarRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(UnHoldRequest* other) {
+  inline void Swap(SetProfileVarRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3451,7 +4523,7 @@ class UnHoldRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(UnHoldRequest* other) {
+  void UnsafeArenaSwap(SetProfileVarRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3459,14 +4531,14 @@ class UnHoldRequest final :
 
   // implements Message ----------------------------------------------
 
-  UnHoldRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<UnHoldRequest>(arena);
+  SetProfileVarRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetProfileVarRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const UnHoldRequest& from);
+  void CopyFrom(const SetProfileVarRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const UnHoldRequest& from) {
-    UnHoldRequest::MergeImpl(*this, from);
+  void MergeFrom( const SetProfileVarRequest& from) {
+    SetProfileVarRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3484,16 +4556,18 @@ class UnHoldRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(UnHoldRequest* other);
+  void InternalSwap(SetProfileVarRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.UnHoldRequest";
+    return "fs.SetProfileVarRequest";
   }
   protected:
-  explicit UnHoldRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetProfileVarRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -3503,36 +4577,45 @@ class UnHoldRequest final :
 
   // nested types ----------------------------------------------------
 
+
   // accessors -------------------------------------------------------
 
   enum : int {
+    kVariablesFieldNumber = 2,
     kIdFieldNumber = 1,
   };
-  // repeated string id = 1;
-  int id_size() const;
+  // map<string, string> variables = 2;
+  int variables_size() const;
   private:
-  int _internal_id_size() const;
+  int _internal_variables_size() const;
   public:
-  void clear_id();
-  const std::string& id(int index) const;
-  std::string* mutable_id(int index);
-  void set_id(int index, const std::string& value);
-  void set_id(int index, std::string&& value);
-  void set_id(int index, const char* value);
-  void set_id(int index, const char* value, size_t size);
-  std::string* add_id();
-  void add_id(const std::string& value);
-  void add_id(std::string&& value);
-  void add_id(const char* value);
-  void add_id(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
+  void clear_variables();
   private:
-  const std::string& _internal_id(int index) const;
-  std::string* _internal_add_id();
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_variables();
   public:
-
-  // @@protoc_insertion_point(class_scope:fs.UnHoldRequest)
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_variables();
+
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.SetProfileVarRequest)
  private:
   class _Internal;
 
@@ -3540,7 +4623,12 @@ class UnHoldRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        SetProfileVarRequest_VariablesEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3548,24 +4636,23 @@ class UnHoldRequest final :
 };
 // -------------------------------------------------------------------
 
-class UnHoldResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.UnHoldResponse) */ {
+class SetProfileVarResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:fs.SetProfileVarResponse) */ {
  public:
-  inline UnHoldResponse() : UnHoldResponse(nullptr) {}
-  ~UnHoldResponse() override;
-  explicit PROTOBUF_CONSTEXPR UnHoldResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline SetProfileVarResponse() : SetProfileVarResponse(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR SetProfileVarResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  UnHoldResponse(const UnHoldResponse& from);
-  UnHoldResponse(UnHoldResponse&& from) noexcept
-    : UnHoldResponse() {
+  SetProfileVarResponse(const SetProfileVarResponse& from);
+  SetProfileVarResponse(SetProfileVarResponse&& from) noexcept
+    : SetProfileVarResponse() {
     *this = ::std::move(from);
   }
 
-  inline UnHoldResponse& operator=(const UnHoldResponse& from) {
+  inline SetProfileVarResponse& operator=(const SetProfileVarResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline UnHoldResponse& operator=(UnHoldResponse&& from) noexcept {
+  inline SetProfileVarResponse& operator=(SetProfileVarResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3588,20 +4675,20 @@ class UnHoldResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const UnHoldResponse& default_instance() {
+  static const SetProfileVarResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const UnHoldResponse* internal_default_instance() {
-    return reinterpret_cast<const UnHoldResponse*>(
-               &_UnHoldResponse_default_instance_);
+  static inline const SetProfileVarResponse* internal_default_instance() {
+    return reinterpret_cast<const SetProfileVarResponse*>(
+               &_SetProfileVarResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     23;
 
-  friend void swap(UnHoldResponse& a, UnHoldResponse& b) {
+  friend void swap(SetProfileVarResponse& a, SetProfileVarResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(UnHoldResponse* other) {
+  inline void Swap(SetProfileVarResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3614,7 +4701,7 @@ class UnHoldResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(UnHoldResponse* other) {
+  void UnsafeArenaSwap(SetProfileVarResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3622,40 +4709,26 @@ class UnHoldResponse final :
 
   // implements Message ----------------------------------------------
 
-  UnHoldResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<UnHoldResponse>(arena);
+  SetProfileVarResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetProfileVarResponse>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const UnHoldResponse& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const UnHoldResponse& from) {
-    UnHoldResponse::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const SetProfileVarResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const SetProfileVarResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(UnHoldResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.UnHoldResponse";
+    return "fs.SetProfileVarResponse";
   }
   protected:
-  explicit UnHoldResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit SetProfileVarResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3668,34 +4741,7 @@ class UnHoldResponse final :
 
   // accessors -------------------------------------------------------
 
-  enum : int {
-    kIdFieldNumber = 1,
-  };
-  // repeated string id = 1;
-  int id_size() const;
-  private:
-  int _internal_id_size() const;
-  public:
-  void clear_id();
-  const std::string& id(int index) const;
-  std::string* mutable_id(int index);
-  void set_id(int index, const std::string& value);
-  void set_id(int index, std::string&& value);
-  void set_id(int index, const char* value);
-  void set_id(int index, const char* value, size_t size);
-  std::string* add_id();
-  void add_id(const std::string& value);
-  void add_id(std::string&& value);
-  void add_id(const char* value);
-  void add_id(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
-  private:
-  const std::string& _internal_id(int index) const;
-  std::string* _internal_add_id();
-  public:
-
-  // @@protoc_insertion_point(class_scope:fs.UnHoldResponse)
+  // @@protoc_insertion_point(class_scope:fs.SetProfileVarResponse)
  private:
   class _Internal;
 
@@ -3703,32 +4749,29 @@ class UnHoldResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
-  union { Impl_ _impl_; };
   friend struct ::TableStruct_fs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class HangupManyRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupManyRequest) */ {
+class StopPlaybackRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.StopPlaybackRequest) */ {
  public:
-  inline HangupManyRequest() : HangupManyRequest(nullptr) {}
-  ~HangupManyRequest() override;
-  explicit PROTOBUF_CONSTEXPR HangupManyRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline StopPlaybackRequest() : StopPlaybackRequest(nullptr) {}
+  ~StopPlaybackRequest() override;
+  explicit PROTOBUF_CONSTEXPR StopPlaybackRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  HangupManyRequest(const HangupManyRequest& from);
-  HangupManyRequest(HangupManyRequest&& from) noexcept
-    : HangupManyRequest() {
+  StopPlaybackRequest(const StopPlaybackRequest& from);
+  StopPlaybackRequest(StopPlaybackRequest&& from) noexcept
+    : StopPlaybackRequest() {
     *this = ::std::move(from);
   }
 
-  inline HangupManyRequest& operator=(const HangupManyRequest& from) {
+  inline StopPlaybackRequest& operator=(const StopPlaybackRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline HangupManyRequest& operator=(HangupManyRequest&& from) noexcept {
+  inline StopPlaybackRequest& operator=(StopPlaybackRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3751,20 +4794,20 @@ class HangupManyRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const HangupManyRequest& default_instance() {
+  static const StopPlaybackRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const HangupManyRequest* internal_default_instance() {
-    return reinterpret_cast<const HangupManyRequest*>(
-               &_HangupManyRequest_default_instance_);
+  static inline const StopPlaybackRequest* internal_default_instance() {
+    return reinterpret_cast<const StopPlaybackRequest*>(
+               &_StopPlaybackRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     24;
 
-  friend void swap(HangupManyRequest& a, HangupManyRequest& b) {
+  friend void swap(StopPlaybackRequest& a, StopPlaybackRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(HangupManyRequest* other) {
+  inline void Swap(StopPlaybackRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3777,7 +4820,7 @@ class HangupManyRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(HangupManyRequest* other) {
+  void UnsafeArenaSwap(StopPlaybackRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3785,14 +4828,14 @@ class HangupManyRequest final :
 
   // implements Message ----------------------------------------------
 
-  HangupManyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<HangupManyRequest>(arena);
+  StopPlaybackRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StopPlaybackRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const HangupManyRequest& from);
+  void CopyFrom(const StopPlaybackRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const HangupManyRequest& from) {
-    HangupManyRequest::MergeImpl(*this, from);
+  void MergeFrom( const StopPlaybackRequest& from) {
+    StopPlaybackRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -3810,15 +4853,15 @@ class HangupManyRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(HangupManyRequest* other);
+  void InternalSwap(StopPlaybackRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.HangupManyRequest";
+    return "fs.StopPlaybackRequest";
   }
   protected:
-  explicit HangupManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit StopPlaybackRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -3833,47 +4876,22 @@ class HangupManyRequest final :
 
   enum : int {
     kIdFieldNumber = 1,
-    kCauseFieldNumber = 2,
   };
-  // repeated string id = 1;
-  int id_size() const;
-  private:
-  int _internal_id_size() const;
-  public:
+  // string id = 1;
   void clear_id();
-  const std::string& id(int index) const;
-  std::string* mutable_id(int index);
-  void set_id(int index, const std::string& value);
-  void set_id(int index, std::string&& value);
-  void set_id(int index, const char* value);
-  void set_id(int index, const char* value, size_t size);
-  std::string* add_id();
-  void add_id(const std::string& value);
-  void add_id(std::string&& value);
-  void add_id(const char* value);
-  void add_id(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
-  private:
-  const std::string& _internal_id(int index) const;
-  std::string* _internal_add_id();
-  public:
-
-  // string cause = 2;
-  void clear_cause();
-  const std::string& cause() const;
+  const std::string& id() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cause(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cause();
-  PROTOBUF_NODISCARD std::string* release_cause();
-  void set_allocated_cause(std::string* cause);
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
   private:
-  const std::string& _internal_cause() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cause(const std::string& value);
-  std::string* _internal_mutable_cause();
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.HangupManyRequest)
+  // @@protoc_insertion_point(class_scope:fs.StopPlaybackRequest)
  private:
   class _Internal;
 
@@ -3881,8 +4899,7 @@ class HangupManyRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cause_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -3890,24 +4907,23 @@ class HangupManyRequest final :
 };
 // -------------------------------------------------------------------
 
-class HangupManyResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupManyResponse) */ {
+class StopPlaybackResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:fs.StopPlaybackResponse) */ {
  public:
-  inline HangupManyResponse() : HangupManyResponse(nullptr) {}
-  ~HangupManyResponse() override;
-  explicit PROTOBUF_CONSTEXPR HangupManyResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline StopPlaybackResponse() : StopPlaybackResponse(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR StopPlaybackResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  HangupManyResponse(const HangupManyResponse& from);
-  HangupManyResponse(HangupManyResponse&& from) noexcept
-    : HangupManyResponse() {
+  StopPlaybackResponse(const StopPlaybackResponse& from);
+  StopPlaybackResponse(StopPlaybackResponse&& from) noexcept
+    : StopPlaybackResponse() {
     *this = ::std::move(from);
   }
 
-  inline HangupManyResponse& operator=(const HangupManyResponse& from) {
+  inline StopPlaybackResponse& operator=(const StopPlaybackResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline HangupManyResponse& operator=(HangupManyResponse&& from) noexcept {
+  inline StopPlaybackResponse& operator=(StopPlaybackResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -3930,20 +4946,20 @@ class HangupManyResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const HangupManyResponse& default_instance() {
+  static const StopPlaybackResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const HangupManyResponse* internal_default_instance() {
-    return reinterpret_cast<const HangupManyResponse*>(
-               &_HangupManyResponse_default_instance_);
+  static inline const StopPlaybackResponse* internal_default_instance() {
+    return reinterpret_cast<const StopPlaybackResponse*>(
+               &_StopPlaybackResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     25;
 
-  friend void swap(HangupManyResponse& a, HangupManyResponse& b) {
+  friend void swap(StopPlaybackResponse& a, StopPlaybackResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(HangupManyResponse* other) {
+  inline void Swap(StopPlaybackResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -3956,7 +4972,7 @@ class HangupManyResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(HangupManyResponse* other) {
+  void UnsafeArenaSwap(StopPlaybackResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -3964,40 +4980,26 @@ class HangupManyResponse final :
 
   // implements Message ----------------------------------------------
 
-  HangupManyResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<HangupManyResponse>(arena);
+  StopPlaybackResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StopPlaybackResponse>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const HangupManyResponse& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const HangupManyResponse& from) {
-    HangupManyResponse::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const StopPlaybackResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const StopPlaybackResponse& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
-
-  private:
-  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(HangupManyResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.HangupManyResponse";
+    return "fs.StopPlaybackResponse";
   }
   protected:
-  explicit HangupManyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit StopPlaybackResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4010,34 +5012,7 @@ class HangupManyResponse final :
 
   // accessors -------------------------------------------------------
 
-  enum : int {
-    kIdFieldNumber = 1,
-  };
-  // repeated string id = 1;
-  int id_size() const;
-  private:
-  int _internal_id_size() const;
-  public:
-  void clear_id();
-  const std::string& id(int index) const;
-  std::string* mutable_id(int index);
-  void set_id(int index, const std::string& value);
-  void set_id(int index, std::string&& value);
-  void set_id(int index, const char* value);
-  void set_id(int index, const char* value, size_t size);
-  std::string* add_id();
-  void add_id(const std::string& value);
-  void add_id(std::string&& value);
-  void add_id(const char* value);
-  void add_id(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
-  private:
-  const std::string& _internal_id(int index) const;
-  std::string* _internal_add_id();
-  public:
-
-  // @@protoc_insertion_point(class_scope:fs.HangupManyResponse)
+  // @@protoc_insertion_point(class_scope:fs.StopPlaybackResponse)
  private:
   class _Internal;
 
@@ -4045,34 +5020,31 @@ class HangupManyResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
-  union { Impl_ _impl_; };
   friend struct ::TableStruct_fs_2eproto;
 };
 // -------------------------------------------------------------------
 
-class QueueRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<QueueRequest_VariablesEntry_DoNotUse, 
+class BridgeCallRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BridgeCallRequest_VariablesEntry_DoNotUse, 
     std::string, std::string,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
 public:
-  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<QueueRequest_VariablesEntry_DoNotUse, 
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BridgeCallRequest_VariablesEntry_DoNotUse, 
     std::string, std::string,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
-  QueueRequest_VariablesEntry_DoNotUse();
-  explicit PROTOBUF_CONSTEXPR QueueRequest_VariablesEntry_DoNotUse(
+  BridgeCallRequest_VariablesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR BridgeCallRequest_VariablesEntry_DoNotUse(
       ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-  explicit QueueRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  void MergeFrom(const QueueRequest_VariablesEntry_DoNotUse& other);
-  static const QueueRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const QueueRequest_VariablesEntry_DoNotUse*>(&_QueueRequest_VariablesEntry_DoNotUse_default_instance_); }
+  explicit BridgeCallRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const BridgeCallRequest_VariablesEntry_DoNotUse& other);
+  static const BridgeCallRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const BridgeCallRequest_VariablesEntry_DoNotUse*>(&_BridgeCallRequest_VariablesEntry_DoNotUse_default_instance_); }
   static bool ValidateKey(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.QueueRequest.VariablesEntry.key");
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BridgeCallRequest.VariablesEntry.key");
  }
   static bool ValidateValue(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.QueueRequest.VariablesEntry.value");
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.BridgeCallRequest.VariablesEntry.value");
  }
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
@@ -4081,24 +5053,24 @@ public:
 
 // -------------------------------------------------------------------
 
-class QueueRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.QueueRequest) */ {
+class BridgeCallRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BridgeCallRequest) */ {
  public:
-  inline QueueRequest() : QueueRequest(nullptr) {}
-  ~QueueRequest() override;
-  explicit PROTOBUF_CONSTEXPR QueueRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BridgeCallRequest() : BridgeCallRequest(nullptr) {}
+  ~BridgeCallRequest() override;
+  explicit PROTOBUF_CONSTEXPR BridgeCallRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  QueueRequest(const QueueRequest& from);
-  QueueRequest(QueueRequest&& from) noexcept
-    : QueueRequest() {
+  BridgeCallRequest(const BridgeCallRequest& from);
+  BridgeCallRequest(BridgeCallRequest&& from) noexcept
+    : BridgeCallRequest() {
     *this = ::std::move(from);
   }
 
-  inline QueueRequest& operator=(const QueueRequest& from) {
+  inline BridgeCallRequest& operator=(const BridgeCallRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline QueueRequest& operator=(QueueRequest&& from) noexcept {
+  inline BridgeCallRequest& operator=(BridgeCallRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4121,20 +5093,20 @@ class QueueRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const QueueRequest& default_instance() {
+  static const BridgeCallRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const QueueRequest* internal_default_instance() {
-    return reinterpret_cast<const QueueRequest*>(
-               &_QueueRequest_default_instance_);
+  static inline const BridgeCallRequest* internal_default_instance() {
+    return reinterpret_cast<const BridgeCallRequest*>(
+               &_BridgeCallRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     27;
 
-  friend void swap(QueueRequest& a, QueueRequest& b) {
+  friend void swap(BridgeCallRequest& a, BridgeCallRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(QueueRequest* other) {
+  inline void Swap(BridgeCallRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4147,7 +5119,7 @@ class QueueRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(QueueRequest* other) {
+  void UnsafeArenaSwap(BridgeCallRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4155,14 +5127,14 @@ class QueueRequest final :
 
   // implements Message ----------------------------------------------
 
-  QueueRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<QueueRequest>(arena);
+  BridgeCallRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BridgeCallRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const QueueRequest& from);
+  void CopyFrom(const BridgeCallRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const QueueRequest& from) {
-    QueueRequest::MergeImpl(*this, from);
+  void MergeFrom( const BridgeCallRequest& from) {
+    BridgeCallRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4180,15 +5152,15 @@ class QueueRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(QueueRequest* other);
+  void InternalSwap(BridgeCallRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.QueueRequest";
+    return "fs.BridgeCallRequest";
   }
   protected:
-  explicit QueueRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BridgeCallRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -4205,12 +5177,11 @@ class QueueRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kVariablesFieldNumber = 2,
-    kIdFieldNumber = 1,
-    kPlaybackFileFieldNumber = 3,
-    kPlaybackArgsFieldNumber = 4,
+    kVariablesFieldNumber = 3,
+    kLegAIdFieldNumber = 1,
+    kLegBIdFieldNumber = 2,
   };
-  // map<string, string> variables = 2;
+  // map<string, string> variables = 3;
   int variables_size() const;
   private:
   int _internal_variables_size() const;
@@ -4227,44 +5198,35 @@ class QueueRequest final :
   ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
       mutable_variables();
 
-  // string id = 1;
-  void clear_id();
-  const std::string& id() const;
+  // string leg_a_id = 1;
+  void clear_leg_a_id();
+  const std::string& leg_a_id() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_id();
-  PROTOBUF_NODISCARD std::string* release_id();
-  void set_allocated_id(std::string* id);
+  void set_leg_a_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leg_a_id();
+  PROTOBUF_NODISCARD std::string* release_leg_a_id();
+  void set_allocated_leg_a_id(std::string* leg_a_id);
   private:
-  const std::string& _internal_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
-  std::string* _internal_mutable_id();
+  const std::string& _internal_leg_a_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg_a_id(const std::string& value);
+  std::string* _internal_mutable_leg_a_id();
   public:
 
-  // string playback_file = 3;
-  void clear_playback_file();
-  const std::string& playback_file() const;
+  // string leg_b_id = 2;
+  void clear_leg_b_id();
+  const std::string& leg_b_id() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_playback_file(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_playback_file();
-  PROTOBUF_NODISCARD std::string* release_playback_file();
-  void set_allocated_playback_file(std::string* playback_file);
-  private:
-  const std::string& _internal_playback_file() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_playback_file(const std::string& value);
-  std::string* _internal_mutable_playback_file();
-  public:
-
-  // int32 playback_args = 4;
-  void clear_playback_args();
-  int32_t playback_args() const;
-  void set_playback_args(int32_t value);
+  void set_leg_b_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leg_b_id();
+  PROTOBUF_NODISCARD std::string* release_leg_b_id();
+  void set_allocated_leg_b_id(std::string* leg_b_id);
   private:
-  int32_t _internal_playback_args() const;
-  void _internal_set_playback_args(int32_t value);
+  const std::string& _internal_leg_b_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg_b_id(const std::string& value);
+  std::string* _internal_mutable_leg_b_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.QueueRequest)
+  // @@protoc_insertion_point(class_scope:fs.BridgeCallRequest)
  private:
   class _Internal;
 
@@ -4273,13 +5235,12 @@ class QueueRequest final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-        QueueRequest_VariablesEntry_DoNotUse,
+        BridgeCallRequest_VariablesEntry_DoNotUse,
         std::string, std::string,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr playback_file_;
-    int32_t playback_args_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_a_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_b_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4287,24 +5248,24 @@ class QueueRequest final :
 };
 // -------------------------------------------------------------------
 
-class QueueResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.QueueResponse) */ {
+class BridgeCallResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BridgeCallResponse) */ {
  public:
-  inline QueueResponse() : QueueResponse(nullptr) {}
-  ~QueueResponse() override;
-  explicit PROTOBUF_CONSTEXPR QueueResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BridgeCallResponse() : BridgeCallResponse(nullptr) {}
+  ~BridgeCallResponse() override;
+  explicit PROTOBUF_CONSTEXPR BridgeCallResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  QueueResponse(const QueueResponse& from);
-  QueueResponse(QueueResponse&& from) noexcept
-    : QueueResponse() {
+  BridgeCallResponse(const BridgeCallResponse& from);
+  BridgeCallResponse(BridgeCallResponse&& from) noexcept
+    : BridgeCallResponse() {
     *this = ::std::move(from);
   }
 
-  inline QueueResponse& operator=(const QueueResponse& from) {
+  inline BridgeCallResponse& operator=(const BridgeCallResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline QueueResponse& operator=(QueueResponse&& from) noexcept {
+  inline BridgeCallResponse& operator=(BridgeCallResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4327,20 +5288,20 @@ class QueueResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const QueueResponse& default_instance() {
+  static const BridgeCallResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const QueueResponse* internal_default_instance() {
-    return reinterpret_cast<const QueueResponse*>(
-               &_QueueResponse_default_instance_);
+  static inline const BridgeCallResponse* internal_default_instance() {
+    return reinterpret_cast<const BridgeCallResponse*>(
+               &_BridgeCallResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     28;
 
-  friend void swap(QueueResponse& a, QueueResponse& b) {
+  friend void swap(BridgeCallResponse& a, BridgeCallResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(QueueResponse* other) {
+  inline void Swap(BridgeCallResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4353,7 +5314,7 @@ class QueueResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(QueueResponse* other) {
+  void UnsafeArenaSwap(BridgeCallResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4361,14 +5322,14 @@ class QueueResponse final :
 
   // implements Message ----------------------------------------------
 
-  QueueResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<QueueResponse>(arena);
+  BridgeCallResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BridgeCallResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const QueueResponse& from);
+  void CopyFrom(const BridgeCallResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const QueueResponse& from) {
-    QueueResponse::MergeImpl(*this, from);
+  void MergeFrom( const BridgeCallResponse& from) {
+    BridgeCallResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4386,15 +5347,15 @@ class QueueResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(QueueResponse* other);
+  void InternalSwap(BridgeCallResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.QueueResponse";
+    return "fs.BridgeCallResponse";
   }
   protected:
-  explicit QueueResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BridgeCallResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4408,9 +5369,24 @@ class QueueResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kErrorFieldNumber = 1,
+    kUuidFieldNumber = 1,
+    kErrorFieldNumber = 2,
   };
-  // .fs.ErrorExecute error = 1;
+  // string uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // .fs.ErrorExecute error = 2;
   bool has_error() const;
   private:
   bool _internal_has_error() const;
@@ -4428,7 +5404,7 @@ class QueueResponse final :
       ::fs::ErrorExecute* error);
   ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.QueueResponse)
+  // @@protoc_insertion_point(class_scope:fs.BridgeCallResponse)
  private:
   class _Internal;
 
@@ -4436,6 +5412,7 @@ class QueueResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
     ::fs::ErrorExecute* error_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
@@ -4444,24 +5421,24 @@ class QueueResponse final :
 };
 // -------------------------------------------------------------------
 
-class ErrorExecute final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.ErrorExecute) */ {
+class HoldRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HoldRequest) */ {
  public:
-  inline ErrorExecute() : ErrorExecute(nullptr) {}
-  ~ErrorExecute() override;
-  explicit PROTOBUF_CONSTEXPR ErrorExecute(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline HoldRequest() : HoldRequest(nullptr) {}
+  ~HoldRequest() override;
+  explicit PROTOBUF_CONSTEXPR HoldRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ErrorExecute(const ErrorExecute& from);
-  ErrorExecute(ErrorExecute&& from) noexcept
-    : ErrorExecute() {
+  HoldRequest(const HoldRequest& from);
+  HoldRequest(HoldRequest&& from) noexcept
+    : HoldRequest() {
     *this = ::std::move(from);
   }
 
-  inline ErrorExecute& operator=(const ErrorExecute& from) {
+  inline HoldRequest& operator=(const HoldRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ErrorExecute& operator=(ErrorExecute&& from) noexcept {
+  inline HoldRequest& operator=(HoldRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4484,20 +5461,20 @@ class ErrorExecute final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ErrorExecute& default_instance() {
+  static const HoldRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ErrorExecute* internal_default_instance() {
-    return reinterpret_cast<const ErrorExecute*>(
-               &_ErrorExecute_default_instance_);
+  static inline const HoldRequest* internal_default_instance() {
+    return reinterpret_cast<const HoldRequest*>(
+               &_HoldRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     29;
 
-  friend void swap(ErrorExecute& a, ErrorExecute& b) {
+  friend void swap(HoldRequest& a, HoldRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ErrorExecute* other) {
+  inline void Swap(HoldRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4510,7 +5487,7 @@ class ErrorExecute final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ErrorExecute* other) {
+  void UnsafeArenaSwap(HoldRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4518,14 +5495,14 @@ class ErrorExecute final :
 
   // implements Message ----------------------------------------------
 
-  ErrorExecute* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ErrorExecute>(arena);
+  HoldRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HoldRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ErrorExecute& from);
+  void CopyFrom(const HoldRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ErrorExecute& from) {
-    ErrorExecute::MergeImpl(*this, from);
+  void MergeFrom( const HoldRequest& from) {
+    HoldRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4543,15 +5520,15 @@ class ErrorExecute final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ErrorExecute* other);
+  void InternalSwap(HoldRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.ErrorExecute";
+    return "fs.HoldRequest";
   }
   protected:
-  explicit ErrorExecute(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit HoldRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4562,66 +5539,36 @@ class ErrorExecute final :
 
   // nested types ----------------------------------------------------
 
-  typedef ErrorExecute_Type Type;
-  static constexpr Type ERROR =
-    ErrorExecute_Type_ERROR;
-  static constexpr Type USAGE =
-    ErrorExecute_Type_USAGE;
-  static inline bool Type_IsValid(int value) {
-    return ErrorExecute_Type_IsValid(value);
-  }
-  static constexpr Type Type_MIN =
-    ErrorExecute_Type_Type_MIN;
-  static constexpr Type Type_MAX =
-    ErrorExecute_Type_Type_MAX;
-  static constexpr int Type_ARRAYSIZE =
-    ErrorExecute_Type_Type_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  Type_descriptor() {
-    return ErrorExecute_Type_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& Type_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, Type>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function Type_Name.");
-    return ErrorExecute_Type_Name(enum_t_value);
-  }
-  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      Type* value) {
-    return ErrorExecute_Type_Parse(name, value);
-  }
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageFieldNumber = 1,
-    kTypeFieldNumber = 2,
+    kIdFieldNumber = 1,
   };
-  // string message = 1;
-  void clear_message();
-  const std::string& message() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_message(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_message();
-  PROTOBUF_NODISCARD std::string* release_message();
-  void set_allocated_message(std::string* message);
+  // repeated string id = 1;
+  int id_size() const;
   private:
-  const std::string& _internal_message() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
-  std::string* _internal_mutable_message();
+  int _internal_id_size() const;
   public:
-
-  // .fs.ErrorExecute.Type type = 2;
-  void clear_type();
-  ::fs::ErrorExecute_Type type() const;
-  void set_type(::fs::ErrorExecute_Type value);
+  void clear_id();
+  const std::string& id(int index) const;
+  std::string* mutable_id(int index);
+  void set_id(int index, const std::string& value);
+  void set_id(int index, std::string&& value);
+  void set_id(int index, const char* value);
+  void set_id(int index, const char* value, size_t size);
+  std::string* add_id();
+  void add_id(const std::string& value);
+  void add_id(std::string&& value);
+  void add_id(const char* value);
+  void add_id(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
   private:
-  ::fs::ErrorExecute_Type _internal_type() const;
-  void _internal_set_type(::fs::ErrorExecute_Type value);
+  const std::string& _internal_id(int index) const;
+  std::string* _internal_add_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.ErrorExecute)
+  // @@protoc_insertion_point(class_scope:fs.HoldRequest)
  private:
   class _Internal;
 
@@ -4629,8 +5576,7 @@ class ErrorExecute final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
-    int type_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4638,24 +5584,24 @@ class ErrorExecute final :
 };
 // -------------------------------------------------------------------
 
-class ExecuteRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.ExecuteRequest) */ {
+class HoldResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HoldResponse) */ {
  public:
-  inline ExecuteRequest() : ExecuteRequest(nullptr) {}
-  ~ExecuteRequest() override;
-  explicit PROTOBUF_CONSTEXPR ExecuteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline HoldResponse() : HoldResponse(nullptr) {}
+  ~HoldResponse() override;
+  explicit PROTOBUF_CONSTEXPR HoldResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  ExecuteRequest(const ExecuteRequest& from);
-  ExecuteRequest(ExecuteRequest&& from) noexcept
-    : ExecuteRequest() {
+  HoldResponse(const HoldResponse& from);
+  HoldResponse(HoldResponse&& from) noexcept
+    : HoldResponse() {
     *this = ::std::move(from);
   }
 
-  inline ExecuteRequest& operator=(const ExecuteRequest& from) {
+  inline HoldResponse& operator=(const HoldResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ExecuteRequest& operator=(ExecuteRequest&& from) noexcept {
+  inline HoldResponse& operator=(HoldResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4678,20 +5624,20 @@ class ExecuteRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ExecuteRequest& default_instance() {
+  static const HoldResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ExecuteRequest* internal_default_instance() {
-    return reinterpret_cast<const ExecuteRequest*>(
-               &_ExecuteRequest_default_instance_);
+  static inline const HoldResponse* internal_default_instance() {
+    return reinterpret_cast<const HoldResponse*>(
+               &_HoldResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     30;
 
-  friend void swap(ExecuteRequest& a, ExecuteRequest& b) {
+  friend void swap(HoldResponse& a, HoldResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(ExecuteRequest* other) {
+  inline void Swap(HoldResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4704,7 +5650,7 @@ class ExecuteRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ExecuteRequest* other) {
+  void UnsafeArenaSwap(HoldResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4712,14 +5658,14 @@ class ExecuteRequest final :
 
   // implements Message ----------------------------------------------
 
-  ExecuteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ExecuteRequest>(arena);
+  HoldResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HoldResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ExecuteRequest& from);
+  void CopyFrom(const HoldResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ExecuteRequest& from) {
-    ExecuteRequest::MergeImpl(*this, from);
+  void MergeFrom( const HoldResponse& from) {
+    HoldResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4737,15 +5683,15 @@ class ExecuteRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ExecuteRequest* other);
+  void InternalSwap(HoldResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.ExecuteRequest";
+    return "fs.HoldResponse";
   }
   protected:
-  explicit ExecuteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit HoldResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4759,38 +5705,33 @@ class ExecuteRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kCommandFieldNumber = 1,
-    kArgsFieldNumber = 2,
+    kIdFieldNumber = 1,
   };
-  // string command = 1;
-  void clear_command();
-  const std::string& command() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_command(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_command();
-  PROTOBUF_NODISCARD std::string* release_command();
-  void set_allocated_command(std::string* command);
+  // repeated string id = 1;
+  int id_size() const;
   private:
-  const std::string& _internal_command() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
-  std::string* _internal_mutable_command();
+  int _internal_id_size() const;
   public:
-
-  // string args = 2;
-  void clear_args();
-  const std::string& args() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_args(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_args();
-  PROTOBUF_NODISCARD std::string* release_args();
-  void set_allocated_args(std::string* args);
+  void clear_id();
+  const std::string& id(int index) const;
+  std::string* mutable_id(int index);
+  void set_id(int index, const std::string& value);
+  void set_id(int index, std::string&& value);
+  void set_id(int index, const char* value);
+  void set_id(int index, const char* value, size_t size);
+  std::string* add_id();
+  void add_id(const std::string& value);
+  void add_id(std::string&& value);
+  void add_id(const char* value);
+  void add_id(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
   private:
-  const std::string& _internal_args() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_args(const std::string& value);
-  std::string* _internal_mutable_args();
+  const std::string& _internal_id(int index) const;
+  std::string* _internal_add_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.ExecuteRequest)
+  // @@protoc_insertion_point(class_scope:fs.HoldResponse)
  private:
   class _Internal;
 
@@ -4798,8 +5739,7 @@ class ExecuteRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr args_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4807,24 +5747,24 @@ class ExecuteRequest final :
 };
 // -------------------------------------------------------------------
 
-class ExecuteResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.ExecuteResponse) */ {
+class UnHoldRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.UnHoldRequest) */ {
  public:
-  inline ExecuteResponse() : ExecuteResponse(nullptr) {}
-  ~ExecuteResponse() override;
-  explicit PROTOBUF_CONSTEXPR ExecuteResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  ExecuteResponse(const ExecuteResponse& from);
-  ExecuteResponse(ExecuteResponse&& from) noexcept
-    : ExecuteResponse() {
+  inline UnHoldRequest() : UnHoldRequest(nullptr) {}
+  ~UnHoldRequest() override;
+  explicit PROTOBUF_CONSTEXPR UnHoldRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UnHoldRequest(const UnHoldRequest& from);
+  UnHoldRequest(UnHoldRequest&& from) noexcept
+    : UnHoldRequest() {
     *this = ::std::move(from);
   }
 
-  inline ExecuteResponse& operator=(const ExecuteResponse& from) {
+  inline UnHoldRequest& operator=(const UnHoldRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline ExecuteResponse& operator=(ExecuteResponse&& from) noexcept {
+  inline UnHoldRequest& operator=(UnHoldRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -4847,20 +5787,20 @@ class ExecuteResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const ExecuteResponse& default_instance() {
+  static const UnHoldRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const ExecuteResponse* internal_default_instance() {
-    return reinterpret_cast<const ExecuteResponse*>(
-               &_ExecuteResponse_default_instance_);
+  static inline const UnHoldRequest* internal_default_instance() {
+    return reinterpret_cast<const UnHoldRequest*>(
+               &_UnHoldRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     31;
 
-  friend void swap(ExecuteResponse& a, ExecuteResponse& b) {
+  friend void swap(UnHoldRequest& a, UnHoldRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(ExecuteResponse* other) {
+  inline void Swap(UnHoldRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -4873,7 +5813,7 @@ class ExecuteResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(ExecuteResponse* other) {
+  void UnsafeArenaSwap(UnHoldRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -4881,14 +5821,14 @@ class ExecuteResponse final :
 
   // implements Message ----------------------------------------------
 
-  ExecuteResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<ExecuteResponse>(arena);
+  UnHoldRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnHoldRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const ExecuteResponse& from);
+  void CopyFrom(const UnHoldRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const ExecuteResponse& from) {
-    ExecuteResponse::MergeImpl(*this, from);
+  void MergeFrom( const UnHoldRequest& from) {
+    UnHoldRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -4906,15 +5846,15 @@ class ExecuteResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(ExecuteResponse* other);
+  void InternalSwap(UnHoldRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.ExecuteResponse";
+    return "fs.UnHoldRequest";
   }
   protected:
-  explicit ExecuteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit UnHoldRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -4928,42 +5868,33 @@ class ExecuteResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDataFieldNumber = 1,
-    kErrorFieldNumber = 2,
+    kIdFieldNumber = 1,
   };
-  // string data = 1;
-  void clear_data();
-  const std::string& data() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_data(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_data();
-  PROTOBUF_NODISCARD std::string* release_data();
-  void set_allocated_data(std::string* data);
-  private:
-  const std::string& _internal_data() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
-  std::string* _internal_mutable_data();
-  public:
-
-  // .fs.ErrorExecute error = 2;
-  bool has_error() const;
+  // repeated string id = 1;
+  int id_size() const;
   private:
-  bool _internal_has_error() const;
+  int _internal_id_size() const;
   public:
-  void clear_error();
-  const ::fs::ErrorExecute& error() const;
-  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
-  ::fs::ErrorExecute* mutable_error();
-  void set_allocated_error(::fs::ErrorExecute* error);
+  void clear_id();
+  const std::string& id(int index) const;
+  std::string* mutable_id(int index);
+  void set_id(int index, const std::string& value);
+  void set_id(int index, std::string&& value);
+  void set_id(int index, const char* value);
+  void set_id(int index, const char* value, size_t size);
+  std::string* add_id();
+  void add_id(const std::string& value);
+  void add_id(std::string&& value);
+  void add_id(const char* value);
+  void add_id(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
   private:
-  const ::fs::ErrorExecute& _internal_error() const;
-  ::fs::ErrorExecute* _internal_mutable_error();
+  const std::string& _internal_id(int index) const;
+  std::string* _internal_add_id();
   public:
-  void unsafe_arena_set_allocated_error(
-      ::fs::ErrorExecute* error);
-  ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.ExecuteResponse)
+  // @@protoc_insertion_point(class_scope:fs.UnHoldRequest)
  private:
   class _Internal;
 
@@ -4971,8 +5902,7 @@ class ExecuteResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
-    ::fs::ErrorExecute* error_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -4980,52 +5910,24 @@ class ExecuteResponse final :
 };
 // -------------------------------------------------------------------
 
-class HangupRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HangupRequest_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
-public:
-  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HangupRequest_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
-  HangupRequest_VariablesEntry_DoNotUse();
-  explicit PROTOBUF_CONSTEXPR HangupRequest_VariablesEntry_DoNotUse(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-  explicit HangupRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  void MergeFrom(const HangupRequest_VariablesEntry_DoNotUse& other);
-  static const HangupRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const HangupRequest_VariablesEntry_DoNotUse*>(&_HangupRequest_VariablesEntry_DoNotUse_default_instance_); }
-  static bool ValidateKey(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.HangupRequest.VariablesEntry.key");
- }
-  static bool ValidateValue(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.HangupRequest.VariablesEntry.value");
- }
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  friend struct ::TableStruct_fs_2eproto;
-};
-
-// -------------------------------------------------------------------
-
-class HangupRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupRequest) */ {
+class UnHoldResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.UnHoldResponse) */ {
  public:
-  inline HangupRequest() : HangupRequest(nullptr) {}
-  ~HangupRequest() override;
-  explicit PROTOBUF_CONSTEXPR HangupRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline UnHoldResponse() : UnHoldResponse(nullptr) {}
+  ~UnHoldResponse() override;
+  explicit PROTOBUF_CONSTEXPR UnHoldResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  HangupRequest(const HangupRequest& from);
-  HangupRequest(HangupRequest&& from) noexcept
-    : HangupRequest() {
+  UnHoldResponse(const UnHoldResponse& from);
+  UnHoldResponse(UnHoldResponse&& from) noexcept
+    : UnHoldResponse() {
     *this = ::std::move(from);
   }
 
-  inline HangupRequest& operator=(const HangupRequest& from) {
+  inline UnHoldResponse& operator=(const UnHoldResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline HangupRequest& operator=(HangupRequest&& from) noexcept {
+  inline UnHoldResponse& operator=(UnHoldResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5048,20 +5950,20 @@ class HangupRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const HangupRequest& default_instance() {
+  static const UnHoldResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const HangupRequest* internal_default_instance() {
-    return reinterpret_cast<const HangupRequest*>(
-               &_HangupRequest_default_instance_);
+  static inline const UnHoldResponse* internal_default_instance() {
+    return reinterpret_cast<const UnHoldResponse*>(
+               &_UnHoldResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    33;
+    32;
 
-  friend void swap(HangupRequest& a, HangupRequest& b) {
+  friend void swap(UnHoldResponse& a, UnHoldResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(HangupRequest* other) {
+  inline void Swap(UnHoldResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5074,7 +5976,7 @@ class HangupRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(HangupRequest* other) {
+  void UnsafeArenaSwap(UnHoldResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5082,14 +5984,14 @@ class HangupRequest final :
 
   // implements Message ----------------------------------------------
 
-  HangupRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<HangupRequest>(arena);
+  UnHoldResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UnHoldResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const HangupRequest& from);
+  void CopyFrom(const UnHoldResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const HangupRequest& from) {
-    HangupRequest::MergeImpl(*this, from);
+  void MergeFrom( const UnHoldResponse& from) {
+    UnHoldResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -5107,18 +6009,16 @@ class HangupRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(HangupRequest* other);
+  void InternalSwap(UnHoldResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.HangupRequest";
+    return "fs.UnHoldResponse";
   }
   protected:
-  explicit HangupRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit UnHoldResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -5128,70 +6028,36 @@ class HangupRequest final :
 
   // nested types ----------------------------------------------------
 
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kVariablesFieldNumber = 4,
-    kUuidFieldNumber = 1,
-    kCauseFieldNumber = 2,
-    kReportingFieldNumber = 3,
+    kIdFieldNumber = 1,
   };
-  // map<string, string> variables = 4;
-  int variables_size() const;
-  private:
-  int _internal_variables_size() const;
-  public:
-  void clear_variables();
-  private:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      _internal_variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      _internal_mutable_variables();
-  public:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      mutable_variables();
-
-  // string uuid = 1;
-  void clear_uuid();
-  const std::string& uuid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_uuid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_uuid();
-  PROTOBUF_NODISCARD std::string* release_uuid();
-  void set_allocated_uuid(std::string* uuid);
-  private:
-  const std::string& _internal_uuid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
-  std::string* _internal_mutable_uuid();
-  public:
-
-  // string cause = 2;
-  void clear_cause();
-  const std::string& cause() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cause(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cause();
-  PROTOBUF_NODISCARD std::string* release_cause();
-  void set_allocated_cause(std::string* cause);
+  // repeated string id = 1;
+  int id_size() const;
   private:
-  const std::string& _internal_cause() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cause(const std::string& value);
-  std::string* _internal_mutable_cause();
+  int _internal_id_size() const;
   public:
-
-  // bool reporting = 3;
-  void clear_reporting();
-  bool reporting() const;
-  void set_reporting(bool value);
+  void clear_id();
+  const std::string& id(int index) const;
+  std::string* mutable_id(int index);
+  void set_id(int index, const std::string& value);
+  void set_id(int index, std::string&& value);
+  void set_id(int index, const char* value);
+  void set_id(int index, const char* value, size_t size);
+  std::string* add_id();
+  void add_id(const std::string& value);
+  void add_id(std::string&& value);
+  void add_id(const char* value);
+  void add_id(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
   private:
-  bool _internal_reporting() const;
-  void _internal_set_reporting(bool value);
+  const std::string& _internal_id(int index) const;
+  std::string* _internal_add_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.HangupRequest)
+  // @@protoc_insertion_point(class_scope:fs.UnHoldResponse)
  private:
   class _Internal;
 
@@ -5199,14 +6065,7 @@ class HangupRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-        HangupRequest_VariablesEntry_DoNotUse,
-        std::string, std::string,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cause_;
-    bool reporting_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -5214,24 +6073,24 @@ class HangupRequest final :
 };
 // -------------------------------------------------------------------
 
-class HangupResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupResponse) */ {
+class HangupManyRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupManyRequest) */ {
  public:
-  inline HangupResponse() : HangupResponse(nullptr) {}
-  ~HangupResponse() override;
-  explicit PROTOBUF_CONSTEXPR HangupResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline HangupManyRequest() : HangupManyRequest(nullptr) {}
+  ~HangupManyRequest() override;
+  explicit PROTOBUF_CONSTEXPR HangupManyRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  HangupResponse(const HangupResponse& from);
-  HangupResponse(HangupResponse&& from) noexcept
-    : HangupResponse() {
+  HangupManyRequest(const HangupManyRequest& from);
+  HangupManyRequest(HangupManyRequest&& from) noexcept
+    : HangupManyRequest() {
     *this = ::std::move(from);
   }
 
-  inline HangupResponse& operator=(const HangupResponse& from) {
+  inline HangupManyRequest& operator=(const HangupManyRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline HangupResponse& operator=(HangupResponse&& from) noexcept {
+  inline HangupManyRequest& operator=(HangupManyRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5254,20 +6113,20 @@ class HangupResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const HangupResponse& default_instance() {
+  static const HangupManyRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const HangupResponse* internal_default_instance() {
-    return reinterpret_cast<const HangupResponse*>(
-               &_HangupResponse_default_instance_);
+  static inline const HangupManyRequest* internal_default_instance() {
+    return reinterpret_cast<const HangupManyRequest*>(
+               &_HangupManyRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    34;
+    33;
 
-  friend void swap(HangupResponse& a, HangupResponse& b) {
+  friend void swap(HangupManyRequest& a, HangupManyRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(HangupResponse* other) {
+  inline void Swap(HangupManyRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5280,7 +6139,7 @@ class HangupResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(HangupResponse* other) {
+  void UnsafeArenaSwap(HangupManyRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5288,14 +6147,14 @@ class HangupResponse final :
 
   // implements Message ----------------------------------------------
 
-  HangupResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<HangupResponse>(arena);
+  HangupManyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HangupManyRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const HangupResponse& from);
+  void CopyFrom(const HangupManyRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const HangupResponse& from) {
-    HangupResponse::MergeImpl(*this, from);
+  void MergeFrom( const HangupManyRequest& from) {
+    HangupManyRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -5313,15 +6172,15 @@ class HangupResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(HangupResponse* other);
+  void InternalSwap(HangupManyRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.HangupResponse";
+    return "fs.HangupManyRequest";
   }
   protected:
-  explicit HangupResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit HangupManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -5335,27 +6194,48 @@ class HangupResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kErrorFieldNumber = 1,
+    kIdFieldNumber = 1,
+    kCauseFieldNumber = 2,
   };
-  // .fs.ErrorExecute error = 1;
-  bool has_error() const;
+  // repeated string id = 1;
+  int id_size() const;
   private:
-  bool _internal_has_error() const;
+  int _internal_id_size() const;
   public:
-  void clear_error();
-  const ::fs::ErrorExecute& error() const;
-  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
-  ::fs::ErrorExecute* mutable_error();
-  void set_allocated_error(::fs::ErrorExecute* error);
+  void clear_id();
+  const std::string& id(int index) const;
+  std::string* mutable_id(int index);
+  void set_id(int index, const std::string& value);
+  void set_id(int index, std::string&& value);
+  void set_id(int index, const char* value);
+  void set_id(int index, const char* value, size_t size);
+  std::string* add_id();
+  void add_id(const std::string& value);
+  void add_id(std::string&& value);
+  void add_id(const char* value);
+  void add_id(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
   private:
-  const ::fs::ErrorExecute& _internal_error() const;
-  ::fs::ErrorExecute* _internal_mutable_error();
+  const std::string& _internal_id(int index) const;
+  std::string* _internal_add_id();
   public:
-  void unsafe_arena_set_allocated_error(
-      ::fs::ErrorExecute* error);
-  ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.HangupResponse)
+  // string cause = 2;
+  void clear_cause();
+  const std::string& cause() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cause(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cause();
+  PROTOBUF_NODISCARD std::string* release_cause();
+  void set_allocated_cause(std::string* cause);
+  private:
+  const std::string& _internal_cause() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cause(const std::string& value);
+  std::string* _internal_mutable_cause();
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.HangupManyRequest)
  private:
   class _Internal;
 
@@ -5363,7 +6243,8 @@ class HangupResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::fs::ErrorExecute* error_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cause_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -5371,24 +6252,24 @@ class HangupResponse final :
 };
 // -------------------------------------------------------------------
 
-class OriginateRequest_Extension final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.OriginateRequest.Extension) */ {
+class HangupManyResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupManyResponse) */ {
  public:
-  inline OriginateRequest_Extension() : OriginateRequest_Extension(nullptr) {}
-  ~OriginateRequest_Extension() override;
-  explicit PROTOBUF_CONSTEXPR OriginateRequest_Extension(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline HangupManyResponse() : HangupManyResponse(nullptr) {}
+  ~HangupManyResponse() override;
+  explicit PROTOBUF_CONSTEXPR HangupManyResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  OriginateRequest_Extension(const OriginateRequest_Extension& from);
-  OriginateRequest_Extension(OriginateRequest_Extension&& from) noexcept
-    : OriginateRequest_Extension() {
+  HangupManyResponse(const HangupManyResponse& from);
+  HangupManyResponse(HangupManyResponse&& from) noexcept
+    : HangupManyResponse() {
     *this = ::std::move(from);
   }
 
-  inline OriginateRequest_Extension& operator=(const OriginateRequest_Extension& from) {
+  inline HangupManyResponse& operator=(const HangupManyResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline OriginateRequest_Extension& operator=(OriginateRequest_Extension&& from) noexcept {
+  inline HangupManyResponse& operator=(HangupManyResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5411,20 +6292,20 @@ class OriginateRequest_Extension final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const OriginateRequest_Extension& default_instance() {
+  static const HangupManyResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const OriginateRequest_Extension* internal_default_instance() {
-    return reinterpret_cast<const OriginateRequest_Extension*>(
-               &_OriginateRequest_Extension_default_instance_);
+  static inline const HangupManyResponse* internal_default_instance() {
+    return reinterpret_cast<const HangupManyResponse*>(
+               &_HangupManyResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    35;
+    34;
 
-  friend void swap(OriginateRequest_Extension& a, OriginateRequest_Extension& b) {
+  friend void swap(HangupManyResponse& a, HangupManyResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(OriginateRequest_Extension* other) {
+  inline void Swap(HangupManyResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5437,7 +6318,7 @@ class OriginateRequest_Extension final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(OriginateRequest_Extension* other) {
+  void UnsafeArenaSwap(HangupManyResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5445,14 +6326,14 @@ class OriginateRequest_Extension final :
 
   // implements Message ----------------------------------------------
 
-  OriginateRequest_Extension* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<OriginateRequest_Extension>(arena);
+  HangupManyResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HangupManyResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const OriginateRequest_Extension& from);
+  void CopyFrom(const HangupManyResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const OriginateRequest_Extension& from) {
-    OriginateRequest_Extension::MergeImpl(*this, from);
+  void MergeFrom( const HangupManyResponse& from) {
+    HangupManyResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -5470,15 +6351,15 @@ class OriginateRequest_Extension final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(OriginateRequest_Extension* other);
+  void InternalSwap(HangupManyResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.OriginateRequest.Extension";
+    return "fs.HangupManyResponse";
   }
   protected:
-  explicit OriginateRequest_Extension(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit HangupManyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -5492,38 +6373,33 @@ class OriginateRequest_Extension final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kAppNameFieldNumber = 1,
-    kArgsFieldNumber = 2,
+    kIdFieldNumber = 1,
   };
-  // string appName = 1;
-  void clear_appname();
-  const std::string& appname() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_appname(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_appname();
-  PROTOBUF_NODISCARD std::string* release_appname();
-  void set_allocated_appname(std::string* appname);
+  // repeated string id = 1;
+  int id_size() const;
   private:
-  const std::string& _internal_appname() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_appname(const std::string& value);
-  std::string* _internal_mutable_appname();
+  int _internal_id_size() const;
   public:
-
-  // string args = 2;
-  void clear_args();
-  const std::string& args() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_args(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_args();
-  PROTOBUF_NODISCARD std::string* release_args();
-  void set_allocated_args(std::string* args);
+  void clear_id();
+  const std::string& id(int index) const;
+  std::string* mutable_id(int index);
+  void set_id(int index, const std::string& value);
+  void set_id(int index, std::string&& value);
+  void set_id(int index, const char* value);
+  void set_id(int index, const char* value, size_t size);
+  std::string* add_id();
+  void add_id(const std::string& value);
+  void add_id(std::string&& value);
+  void add_id(const char* value);
+  void add_id(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_id();
   private:
-  const std::string& _internal_args() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_args(const std::string& value);
-  std::string* _internal_mutable_args();
+  const std::string& _internal_id(int index) const;
+  std::string* _internal_add_id();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.OriginateRequest.Extension)
+  // @@protoc_insertion_point(class_scope:fs.HangupManyResponse)
  private:
   class _Internal;
 
@@ -5531,8 +6407,7 @@ class OriginateRequest_Extension final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr appname_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr args_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -5540,26 +6415,26 @@ class OriginateRequest_Extension final :
 };
 // -------------------------------------------------------------------
 
-class OriginateRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<OriginateRequest_VariablesEntry_DoNotUse, 
+class QueueRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<QueueRequest_VariablesEntry_DoNotUse, 
     std::string, std::string,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
 public:
-  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<OriginateRequest_VariablesEntry_DoNotUse, 
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<QueueRequest_VariablesEntry_DoNotUse, 
     std::string, std::string,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
-  OriginateRequest_VariablesEntry_DoNotUse();
-  explicit PROTOBUF_CONSTEXPR OriginateRequest_VariablesEntry_DoNotUse(
+  QueueRequest_VariablesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR QueueRequest_VariablesEntry_DoNotUse(
       ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-  explicit OriginateRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  void MergeFrom(const OriginateRequest_VariablesEntry_DoNotUse& other);
-  static const OriginateRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const OriginateRequest_VariablesEntry_DoNotUse*>(&_OriginateRequest_VariablesEntry_DoNotUse_default_instance_); }
+  explicit QueueRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const QueueRequest_VariablesEntry_DoNotUse& other);
+  static const QueueRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const QueueRequest_VariablesEntry_DoNotUse*>(&_QueueRequest_VariablesEntry_DoNotUse_default_instance_); }
   static bool ValidateKey(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.OriginateRequest.VariablesEntry.key");
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.QueueRequest.VariablesEntry.key");
  }
   static bool ValidateValue(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.OriginateRequest.VariablesEntry.value");
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.QueueRequest.VariablesEntry.value");
  }
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
   ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
@@ -5568,24 +6443,24 @@ public:
 
 // -------------------------------------------------------------------
 
-class OriginateRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.OriginateRequest) */ {
+class QueueRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.QueueRequest) */ {
  public:
-  inline OriginateRequest() : OriginateRequest(nullptr) {}
-  ~OriginateRequest() override;
-  explicit PROTOBUF_CONSTEXPR OriginateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline QueueRequest() : QueueRequest(nullptr) {}
+  ~QueueRequest() override;
+  explicit PROTOBUF_CONSTEXPR QueueRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  OriginateRequest(const OriginateRequest& from);
-  OriginateRequest(OriginateRequest&& from) noexcept
-    : OriginateRequest() {
+  QueueRequest(const QueueRequest& from);
+  QueueRequest(QueueRequest&& from) noexcept
+    : QueueRequest() {
     *this = ::std::move(from);
   }
 
-  inline OriginateRequest& operator=(const OriginateRequest& from) {
+  inline QueueRequest& operator=(const QueueRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline OriginateRequest& operator=(OriginateRequest&& from) noexcept {
+  inline QueueRequest& operator=(QueueRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5608,20 +6483,20 @@ class OriginateRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const OriginateRequest& default_instance() {
+  static const QueueRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const OriginateRequest* internal_default_instance() {
-    return reinterpret_cast<const OriginateRequest*>(
-               &_OriginateRequest_default_instance_);
+  static inline const QueueRequest* internal_default_instance() {
+    return reinterpret_cast<const QueueRequest*>(
+               &_QueueRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    37;
+    36;
 
-  friend void swap(OriginateRequest& a, OriginateRequest& b) {
+  friend void swap(QueueRequest& a, QueueRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(OriginateRequest* other) {
+  inline void Swap(QueueRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5634,7 +6509,7 @@ class OriginateRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(OriginateRequest* other) {
+  void UnsafeArenaSwap(QueueRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -5642,14 +6517,14 @@ class OriginateRequest final :
 
   // implements Message ----------------------------------------------
 
-  OriginateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<OriginateRequest>(arena);
+  QueueRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueueRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const OriginateRequest& from);
+  void CopyFrom(const QueueRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const OriginateRequest& from) {
-    OriginateRequest::MergeImpl(*this, from);
+  void MergeFrom( const QueueRequest& from) {
+    QueueRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -5667,15 +6542,15 @@ class OriginateRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(OriginateRequest* other);
+  void InternalSwap(QueueRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.OriginateRequest";
+    return "fs.QueueRequest";
   }
   protected:
-  explicit OriginateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit QueueRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   private:
   static void ArenaDtor(void* object);
@@ -5688,54 +6563,16 @@ class OriginateRequest final :
 
   // nested types ----------------------------------------------------
 
-  typedef OriginateRequest_Extension Extension;
-
-  typedef OriginateRequest_Strategy Strategy;
-  static constexpr Strategy FAILOVER =
-    OriginateRequest_Strategy_FAILOVER;
-  static constexpr Strategy MULTIPLE =
-    OriginateRequest_Strategy_MULTIPLE;
-  static inline bool Strategy_IsValid(int value) {
-    return OriginateRequest_Strategy_IsValid(value);
-  }
-  static constexpr Strategy Strategy_MIN =
-    OriginateRequest_Strategy_Strategy_MIN;
-  static constexpr Strategy Strategy_MAX =
-    OriginateRequest_Strategy_Strategy_MAX;
-  static constexpr int Strategy_ARRAYSIZE =
-    OriginateRequest_Strategy_Strategy_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  Strategy_descriptor() {
-    return OriginateRequest_Strategy_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& Strategy_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, Strategy>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function Strategy_Name.");
-    return OriginateRequest_Strategy_Name(enum_t_value);
-  }
-  static inline bool Strategy_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
-      Strategy* value) {
-    return OriginateRequest_Strategy_Parse(name, value);
-  }
 
   // accessors -------------------------------------------------------
 
   enum : int {
-    kVariablesFieldNumber = 1,
-    kEndpointsFieldNumber = 2,
-    kExtensionsFieldNumber = 10,
-    kDestinationFieldNumber = 4,
-    kCallerNumberFieldNumber = 6,
-    kCallerNameFieldNumber = 7,
-    kContextFieldNumber = 8,
-    kDialplanFieldNumber = 9,
-    kCheckIdFieldNumber = 11,
-    kStrategyFieldNumber = 3,
-    kTimeoutFieldNumber = 5,
+    kVariablesFieldNumber = 2,
+    kIdFieldNumber = 1,
+    kPlaybackFileFieldNumber = 3,
+    kPlaybackArgsFieldNumber = 4,
   };
-  // map<string, string> variables = 1;
+  // map<string, string> variables = 2;
   int variables_size() const;
   private:
   int _internal_variables_size() const;
@@ -5752,151 +6589,44 @@ class OriginateRequest final :
   ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
       mutable_variables();
 
-  // repeated string endpoints = 2;
-  int endpoints_size() const;
-  private:
-  int _internal_endpoints_size() const;
-  public:
-  void clear_endpoints();
-  const std::string& endpoints(int index) const;
-  std::string* mutable_endpoints(int index);
-  void set_endpoints(int index, const std::string& value);
-  void set_endpoints(int index, std::string&& value);
-  void set_endpoints(int index, const char* value);
-  void set_endpoints(int index, const char* value, size_t size);
-  std::string* add_endpoints();
-  void add_endpoints(const std::string& value);
-  void add_endpoints(std::string&& value);
-  void add_endpoints(const char* value);
-  void add_endpoints(const char* value, size_t size);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& endpoints() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_endpoints();
-  private:
-  const std::string& _internal_endpoints(int index) const;
-  std::string* _internal_add_endpoints();
-  public:
-
-  // repeated .fs.OriginateRequest.Extension extensions = 10;
-  int extensions_size() const;
-  private:
-  int _internal_extensions_size() const;
-  public:
-  void clear_extensions();
-  ::fs::OriginateRequest_Extension* mutable_extensions(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest_Extension >*
-      mutable_extensions();
-  private:
-  const ::fs::OriginateRequest_Extension& _internal_extensions(int index) const;
-  ::fs::OriginateRequest_Extension* _internal_add_extensions();
-  public:
-  const ::fs::OriginateRequest_Extension& extensions(int index) const;
-  ::fs::OriginateRequest_Extension* add_extensions();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest_Extension >&
-      extensions() const;
-
-  // string destination = 4;
-  void clear_destination();
-  const std::string& destination() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_destination(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_destination();
-  PROTOBUF_NODISCARD std::string* release_destination();
-  void set_allocated_destination(std::string* destination);
-  private:
-  const std::string& _internal_destination() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
-  std::string* _internal_mutable_destination();
-  public:
-
-  // string callerNumber = 6;
-  void clear_callernumber();
-  const std::string& callernumber() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_callernumber(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_callernumber();
-  PROTOBUF_NODISCARD std::string* release_callernumber();
-  void set_allocated_callernumber(std::string* callernumber);
-  private:
-  const std::string& _internal_callernumber() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_callernumber(const std::string& value);
-  std::string* _internal_mutable_callernumber();
-  public:
-
-  // string callerName = 7;
-  void clear_callername();
-  const std::string& callername() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_callername(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_callername();
-  PROTOBUF_NODISCARD std::string* release_callername();
-  void set_allocated_callername(std::string* callername);
-  private:
-  const std::string& _internal_callername() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_callername(const std::string& value);
-  std::string* _internal_mutable_callername();
-  public:
-
-  // string context = 8;
-  void clear_context();
-  const std::string& context() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_context(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_context();
-  PROTOBUF_NODISCARD std::string* release_context();
-  void set_allocated_context(std::string* context);
-  private:
-  const std::string& _internal_context() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_context(const std::string& value);
-  std::string* _internal_mutable_context();
-  public:
-
-  // string dialplan = 9;
-  void clear_dialplan();
-  const std::string& dialplan() const;
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_dialplan(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_dialplan();
-  PROTOBUF_NODISCARD std::string* release_dialplan();
-  void set_allocated_dialplan(std::string* dialplan);
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
   private:
-  const std::string& _internal_dialplan() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dialplan(const std::string& value);
-  std::string* _internal_mutable_dialplan();
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
   public:
 
-  // string check_id = 11;
-  void clear_check_id();
-  const std::string& check_id() const;
+  // string playback_file = 3;
+  void clear_playback_file();
+  const std::string& playback_file() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_check_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_check_id();
-  PROTOBUF_NODISCARD std::string* release_check_id();
-  void set_allocated_check_id(std::string* check_id);
-  private:
-  const std::string& _internal_check_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_check_id(const std::string& value);
-  std::string* _internal_mutable_check_id();
-  public:
-
-  // .fs.OriginateRequest.Strategy strategy = 3;
-  void clear_strategy();
-  ::fs::OriginateRequest_Strategy strategy() const;
-  void set_strategy(::fs::OriginateRequest_Strategy value);
+  void set_playback_file(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_playback_file();
+  PROTOBUF_NODISCARD std::string* release_playback_file();
+  void set_allocated_playback_file(std::string* playback_file);
   private:
-  ::fs::OriginateRequest_Strategy _internal_strategy() const;
-  void _internal_set_strategy(::fs::OriginateRequest_Strategy value);
+  const std::string& _internal_playback_file() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_playback_file(const std::string& value);
+  std::string* _internal_mutable_playback_file();
   public:
 
-  // int32 timeout = 5;
-  void clear_timeout();
-  int32_t timeout() const;
-  void set_timeout(int32_t value);
+  // int32 playback_args = 4;
+  void clear_playback_args();
+  int32_t playback_args() const;
+  void set_playback_args(int32_t value);
   private:
-  int32_t _internal_timeout() const;
-  void _internal_set_timeout(int32_t value);
+  int32_t _internal_playback_args() const;
+  void _internal_set_playback_args(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.OriginateRequest)
+  // @@protoc_insertion_point(class_scope:fs.QueueRequest)
  private:
   class _Internal;
 
@@ -5905,20 +6635,13 @@ class OriginateRequest final :
   typedef void DestructorSkippable_;
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-        OriginateRequest_VariablesEntry_DoNotUse,
+        QueueRequest_VariablesEntry_DoNotUse,
         std::string, std::string,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
         ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> endpoints_;
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest_Extension > extensions_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr callernumber_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr callername_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr context_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dialplan_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr check_id_;
-    int strategy_;
-    int32_t timeout_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr playback_file_;
+    int32_t playback_args_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -5926,24 +6649,24 @@ class OriginateRequest final :
 };
 // -------------------------------------------------------------------
 
-class OriginateResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.OriginateResponse) */ {
+class QueueResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.QueueResponse) */ {
  public:
-  inline OriginateResponse() : OriginateResponse(nullptr) {}
-  ~OriginateResponse() override;
-  explicit PROTOBUF_CONSTEXPR OriginateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline QueueResponse() : QueueResponse(nullptr) {}
+  ~QueueResponse() override;
+  explicit PROTOBUF_CONSTEXPR QueueResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  OriginateResponse(const OriginateResponse& from);
-  OriginateResponse(OriginateResponse&& from) noexcept
-    : OriginateResponse() {
+  QueueResponse(const QueueResponse& from);
+  QueueResponse(QueueResponse&& from) noexcept
+    : QueueResponse() {
     *this = ::std::move(from);
   }
 
-  inline OriginateResponse& operator=(const OriginateResponse& from) {
+  inline QueueResponse& operator=(const QueueResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline OriginateResponse& operator=(OriginateResponse&& from) noexcept {
+  inline QueueResponse& operator=(QueueResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -5966,20 +6689,20 @@ class OriginateResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const OriginateResponse& default_instance() {
+  static const QueueResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const OriginateResponse* internal_default_instance() {
-    return reinterpret_cast<const OriginateResponse*>(
-               &_OriginateResponse_default_instance_);
+  static inline const QueueResponse* internal_default_instance() {
+    return reinterpret_cast<const QueueResponse*>(
+               &_QueueResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    38;
+    37;
 
-  friend void swap(OriginateResponse& a, OriginateResponse& b) {
+  friend void swap(QueueResponse& a, QueueResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(OriginateResponse* other) {
+  inline void Swap(QueueResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -5992,7 +6715,7 @@ class OriginateResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(OriginateResponse* other) {
+  void UnsafeArenaSwap(QueueResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6000,14 +6723,14 @@ class OriginateResponse final :
 
   // implements Message ----------------------------------------------
 
-  OriginateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<OriginateResponse>(arena);
+  QueueResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueueResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const OriginateResponse& from);
+  void CopyFrom(const QueueResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const OriginateResponse& from) {
-    OriginateResponse::MergeImpl(*this, from);
+  void MergeFrom( const QueueResponse& from) {
+    QueueResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6025,15 +6748,15 @@ class OriginateResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(OriginateResponse* other);
+  void InternalSwap(QueueResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.OriginateResponse";
+    return "fs.QueueResponse";
   }
   protected:
-  explicit OriginateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit QueueResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -6047,25 +6770,9 @@ class OriginateResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUuidFieldNumber = 1,
-    kErrorFieldNumber = 2,
-    kErrorCodeFieldNumber = 3,
+    kErrorFieldNumber = 1,
   };
-  // string uuid = 1;
-  void clear_uuid();
-  const std::string& uuid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_uuid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_uuid();
-  PROTOBUF_NODISCARD std::string* release_uuid();
-  void set_allocated_uuid(std::string* uuid);
-  private:
-  const std::string& _internal_uuid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
-  std::string* _internal_mutable_uuid();
-  public:
-
-  // .fs.ErrorExecute error = 2;
+  // .fs.ErrorExecute error = 1;
   bool has_error() const;
   private:
   bool _internal_has_error() const;
@@ -6083,16 +6790,7 @@ class OriginateResponse final :
       ::fs::ErrorExecute* error);
   ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // int32 error_code = 3;
-  void clear_error_code();
-  int32_t error_code() const;
-  void set_error_code(int32_t value);
-  private:
-  int32_t _internal_error_code() const;
-  void _internal_set_error_code(int32_t value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:fs.OriginateResponse)
+  // @@protoc_insertion_point(class_scope:fs.QueueResponse)
  private:
   class _Internal;
 
@@ -6100,9 +6798,7 @@ class OriginateResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
     ::fs::ErrorExecute* error_;
-    int32_t error_code_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -6110,24 +6806,24 @@ class OriginateResponse final :
 };
 // -------------------------------------------------------------------
 
-class BridgeRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BridgeRequest) */ {
+class ErrorExecute final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.ErrorExecute) */ {
  public:
-  inline BridgeRequest() : BridgeRequest(nullptr) {}
-  ~BridgeRequest() override;
-  explicit PROTOBUF_CONSTEXPR BridgeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ErrorExecute() : ErrorExecute(nullptr) {}
+  ~ErrorExecute() override;
+  explicit PROTOBUF_CONSTEXPR ErrorExecute(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BridgeRequest(const BridgeRequest& from);
-  BridgeRequest(BridgeRequest&& from) noexcept
-    : BridgeRequest() {
+  ErrorExecute(const ErrorExecute& from);
+  ErrorExecute(ErrorExecute&& from) noexcept
+    : ErrorExecute() {
     *this = ::std::move(from);
   }
 
-  inline BridgeRequest& operator=(const BridgeRequest& from) {
+  inline ErrorExecute& operator=(const ErrorExecute& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BridgeRequest& operator=(BridgeRequest&& from) noexcept {
+  inline ErrorExecute& operator=(ErrorExecute&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6150,20 +6846,20 @@ class BridgeRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const BridgeRequest& default_instance() {
+  static const ErrorExecute& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BridgeRequest* internal_default_instance() {
-    return reinterpret_cast<const BridgeRequest*>(
-               &_BridgeRequest_default_instance_);
+  static inline const ErrorExecute* internal_default_instance() {
+    return reinterpret_cast<const ErrorExecute*>(
+               &_ErrorExecute_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    39;
+    38;
 
-  friend void swap(BridgeRequest& a, BridgeRequest& b) {
+  friend void swap(ErrorExecute& a, ErrorExecute& b) {
     a.Swap(&b);
   }
-  inline void Swap(BridgeRequest* other) {
+  inline void Swap(ErrorExecute* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6176,7 +6872,7 @@ class BridgeRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BridgeRequest* other) {
+  void UnsafeArenaSwap(ErrorExecute* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6184,14 +6880,14 @@ class BridgeRequest final :
 
   // implements Message ----------------------------------------------
 
-  BridgeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BridgeRequest>(arena);
+  ErrorExecute* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ErrorExecute>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const BridgeRequest& from);
+  void CopyFrom(const ErrorExecute& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const BridgeRequest& from) {
-    BridgeRequest::MergeImpl(*this, from);
+  void MergeFrom( const ErrorExecute& from) {
+    ErrorExecute::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6209,15 +6905,15 @@ class BridgeRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BridgeRequest* other);
+  void InternalSwap(ErrorExecute* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.BridgeRequest";
+    return "fs.ErrorExecute";
   }
   protected:
-  explicit BridgeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ErrorExecute(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -6228,56 +6924,66 @@ class BridgeRequest final :
 
   // nested types ----------------------------------------------------
 
+  typedef ErrorExecute_Type Type;
+  static constexpr Type ERROR =
+    ErrorExecute_Type_ERROR;
+  static constexpr Type USAGE =
+    ErrorExecute_Type_USAGE;
+  static inline bool Type_IsValid(int value) {
+    return ErrorExecute_Type_IsValid(value);
+  }
+  static constexpr Type Type_MIN =
+    ErrorExecute_Type_Type_MIN;
+  static constexpr Type Type_MAX =
+    ErrorExecute_Type_Type_MAX;
+  static constexpr int Type_ARRAYSIZE =
+    ErrorExecute_Type_Type_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Type_descriptor() {
+    return ErrorExecute_Type_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return ErrorExecute_Type_Name(enum_t_value);
+  }
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Type* value) {
+    return ErrorExecute_Type_Parse(name, value);
+  }
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kLegAIdFieldNumber = 1,
-    kLegBIdFieldNumber = 2,
-    kLegBReserveIdFieldNumber = 3,
+    kMessageFieldNumber = 1,
+    kTypeFieldNumber = 2,
   };
-  // string leg_a_id = 1;
-  void clear_leg_a_id();
-  const std::string& leg_a_id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_leg_a_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_leg_a_id();
-  PROTOBUF_NODISCARD std::string* release_leg_a_id();
-  void set_allocated_leg_a_id(std::string* leg_a_id);
-  private:
-  const std::string& _internal_leg_a_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg_a_id(const std::string& value);
-  std::string* _internal_mutable_leg_a_id();
-  public:
-
-  // string leg_b_id = 2;
-  void clear_leg_b_id();
-  const std::string& leg_b_id() const;
+  // string message = 1;
+  void clear_message();
+  const std::string& message() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_leg_b_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_leg_b_id();
-  PROTOBUF_NODISCARD std::string* release_leg_b_id();
-  void set_allocated_leg_b_id(std::string* leg_b_id);
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
   private:
-  const std::string& _internal_leg_b_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg_b_id(const std::string& value);
-  std::string* _internal_mutable_leg_b_id();
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
   public:
 
-  // string leg_b_reserve_id = 3;
-  void clear_leg_b_reserve_id();
-  const std::string& leg_b_reserve_id() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_leg_b_reserve_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_leg_b_reserve_id();
-  PROTOBUF_NODISCARD std::string* release_leg_b_reserve_id();
-  void set_allocated_leg_b_reserve_id(std::string* leg_b_reserve_id);
+  // .fs.ErrorExecute.Type type = 2;
+  void clear_type();
+  ::fs::ErrorExecute_Type type() const;
+  void set_type(::fs::ErrorExecute_Type value);
   private:
-  const std::string& _internal_leg_b_reserve_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg_b_reserve_id(const std::string& value);
-  std::string* _internal_mutable_leg_b_reserve_id();
+  ::fs::ErrorExecute_Type _internal_type() const;
+  void _internal_set_type(::fs::ErrorExecute_Type value);
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.BridgeRequest)
+  // @@protoc_insertion_point(class_scope:fs.ErrorExecute)
  private:
   class _Internal;
 
@@ -6285,9 +6991,8 @@ class BridgeRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_a_id_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_b_id_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_b_reserve_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    int type_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -6295,24 +7000,24 @@ class BridgeRequest final :
 };
 // -------------------------------------------------------------------
 
-class BridgeResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BridgeResponse) */ {
+class ExecuteRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.ExecuteRequest) */ {
  public:
-  inline BridgeResponse() : BridgeResponse(nullptr) {}
-  ~BridgeResponse() override;
-  explicit PROTOBUF_CONSTEXPR BridgeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ExecuteRequest() : ExecuteRequest(nullptr) {}
+  ~ExecuteRequest() override;
+  explicit PROTOBUF_CONSTEXPR ExecuteRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  BridgeResponse(const BridgeResponse& from);
-  BridgeResponse(BridgeResponse&& from) noexcept
-    : BridgeResponse() {
+  ExecuteRequest(const ExecuteRequest& from);
+  ExecuteRequest(ExecuteRequest&& from) noexcept
+    : ExecuteRequest() {
     *this = ::std::move(from);
   }
 
-  inline BridgeResponse& operator=(const BridgeResponse& from) {
+  inline ExecuteRequest& operator=(const ExecuteRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline BridgeResponse& operator=(BridgeResponse&& from) noexcept {
+  inline ExecuteRequest& operator=(ExecuteRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6335,20 +7040,20 @@ class BridgeResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const BridgeResponse& default_instance() {
+  static const ExecuteRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const BridgeResponse* internal_default_instance() {
-    return reinterpret_cast<const BridgeResponse*>(
-               &_BridgeResponse_default_instance_);
+  static inline const ExecuteRequest* internal_default_instance() {
+    return reinterpret_cast<const ExecuteRequest*>(
+               &_ExecuteRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    40;
+    39;
 
-  friend void swap(BridgeResponse& a, BridgeResponse& b) {
+  friend void swap(ExecuteRequest& a, ExecuteRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(BridgeResponse* other) {
+  inline void Swap(ExecuteRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6361,7 +7066,7 @@ class BridgeResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(BridgeResponse* other) {
+  void UnsafeArenaSwap(ExecuteRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6369,14 +7074,14 @@ class BridgeResponse final :
 
   // implements Message ----------------------------------------------
 
-  BridgeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<BridgeResponse>(arena);
+  ExecuteRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExecuteRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const BridgeResponse& from);
+  void CopyFrom(const ExecuteRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const BridgeResponse& from) {
-    BridgeResponse::MergeImpl(*this, from);
+  void MergeFrom( const ExecuteRequest& from) {
+    ExecuteRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6394,15 +7099,15 @@ class BridgeResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(BridgeResponse* other);
+  void InternalSwap(ExecuteRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.BridgeResponse";
+    return "fs.ExecuteRequest";
   }
   protected:
-  explicit BridgeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ExecuteRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -6416,42 +7121,38 @@ class BridgeResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kUuidFieldNumber = 1,
-    kErrorFieldNumber = 2,
+    kCommandFieldNumber = 1,
+    kArgsFieldNumber = 2,
   };
-  // string uuid = 1;
-  void clear_uuid();
-  const std::string& uuid() const;
+  // string command = 1;
+  void clear_command();
+  const std::string& command() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_uuid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_uuid();
-  PROTOBUF_NODISCARD std::string* release_uuid();
-  void set_allocated_uuid(std::string* uuid);
+  void set_command(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_command();
+  PROTOBUF_NODISCARD std::string* release_command();
+  void set_allocated_command(std::string* command);
   private:
-  const std::string& _internal_uuid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
-  std::string* _internal_mutable_uuid();
+  const std::string& _internal_command() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_command(const std::string& value);
+  std::string* _internal_mutable_command();
   public:
 
-  // .fs.ErrorExecute error = 2;
-  bool has_error() const;
-  private:
-  bool _internal_has_error() const;
-  public:
-  void clear_error();
-  const ::fs::ErrorExecute& error() const;
-  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
-  ::fs::ErrorExecute* mutable_error();
-  void set_allocated_error(::fs::ErrorExecute* error);
+  // string args = 2;
+  void clear_args();
+  const std::string& args() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_args(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_args();
+  PROTOBUF_NODISCARD std::string* release_args();
+  void set_allocated_args(std::string* args);
   private:
-  const ::fs::ErrorExecute& _internal_error() const;
-  ::fs::ErrorExecute* _internal_mutable_error();
+  const std::string& _internal_args() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_args(const std::string& value);
+  std::string* _internal_mutable_args();
   public:
-  void unsafe_arena_set_allocated_error(
-      ::fs::ErrorExecute* error);
-  ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.BridgeResponse)
+  // @@protoc_insertion_point(class_scope:fs.ExecuteRequest)
  private:
   class _Internal;
 
@@ -6459,8 +7160,8 @@ class BridgeResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
-    ::fs::ErrorExecute* error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr command_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr args_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -6468,52 +7169,24 @@ class BridgeResponse final :
 };
 // -------------------------------------------------------------------
 
-class SetVariablesRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SetVariablesRequest_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
-public:
-  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SetVariablesRequest_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
-  SetVariablesRequest_VariablesEntry_DoNotUse();
-  explicit PROTOBUF_CONSTEXPR SetVariablesRequest_VariablesEntry_DoNotUse(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-  explicit SetVariablesRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  void MergeFrom(const SetVariablesRequest_VariablesEntry_DoNotUse& other);
-  static const SetVariablesRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const SetVariablesRequest_VariablesEntry_DoNotUse*>(&_SetVariablesRequest_VariablesEntry_DoNotUse_default_instance_); }
-  static bool ValidateKey(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.SetVariablesRequest.VariablesEntry.key");
- }
-  static bool ValidateValue(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.SetVariablesRequest.VariablesEntry.value");
- }
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  friend struct ::TableStruct_fs_2eproto;
-};
-
-// -------------------------------------------------------------------
-
-class SetVariablesRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SetVariablesRequest) */ {
+class ExecuteResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.ExecuteResponse) */ {
  public:
-  inline SetVariablesRequest() : SetVariablesRequest(nullptr) {}
-  ~SetVariablesRequest() override;
-  explicit PROTOBUF_CONSTEXPR SetVariablesRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ExecuteResponse() : ExecuteResponse(nullptr) {}
+  ~ExecuteResponse() override;
+  explicit PROTOBUF_CONSTEXPR ExecuteResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SetVariablesRequest(const SetVariablesRequest& from);
-  SetVariablesRequest(SetVariablesRequest&& from) noexcept
-    : SetVariablesRequest() {
+  ExecuteResponse(const ExecuteResponse& from);
+  ExecuteResponse(ExecuteResponse&& from) noexcept
+    : ExecuteResponse() {
     *this = ::std::move(from);
   }
 
-  inline SetVariablesRequest& operator=(const SetVariablesRequest& from) {
+  inline ExecuteResponse& operator=(const ExecuteResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetVariablesRequest& operator=(SetVariablesRequest&& from) noexcept {
+  inline ExecuteResponse& operator=(ExecuteResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6536,20 +7209,20 @@ class SetVariablesRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetVariablesRequest& default_instance() {
+  static const ExecuteResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetVariablesRequest* internal_default_instance() {
-    return reinterpret_cast<const SetVariablesRequest*>(
-               &_SetVariablesRequest_default_instance_);
+  static inline const ExecuteResponse* internal_default_instance() {
+    return reinterpret_cast<const ExecuteResponse*>(
+               &_ExecuteResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    42;
+    40;
 
-  friend void swap(SetVariablesRequest& a, SetVariablesRequest& b) {
+  friend void swap(ExecuteResponse& a, ExecuteResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetVariablesRequest* other) {
+  inline void Swap(ExecuteResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6562,7 +7235,7 @@ class SetVariablesRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetVariablesRequest* other) {
+  void UnsafeArenaSwap(ExecuteResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6570,14 +7243,14 @@ class SetVariablesRequest final :
 
   // implements Message ----------------------------------------------
 
-  SetVariablesRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetVariablesRequest>(arena);
+  ExecuteResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ExecuteResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetVariablesRequest& from);
+  void CopyFrom(const ExecuteResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetVariablesRequest& from) {
-    SetVariablesRequest::MergeImpl(*this, from);
+  void MergeFrom( const ExecuteResponse& from) {
+    ExecuteResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6595,18 +7268,16 @@ class SetVariablesRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetVariablesRequest* other);
+  void InternalSwap(ExecuteResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.SetVariablesRequest";
+    return "fs.ExecuteResponse";
   }
   protected:
-  explicit SetVariablesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ExecuteResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -6616,45 +7287,45 @@ class SetVariablesRequest final :
 
   // nested types ----------------------------------------------------
 
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kVariablesFieldNumber = 2,
-    kUuidFieldNumber = 1,
+    kDataFieldNumber = 1,
+    kErrorFieldNumber = 2,
   };
-  // map<string, string> variables = 2;
-  int variables_size() const;
+  // string data = 1;
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
   private:
-  int _internal_variables_size() const;
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
   public:
-  void clear_variables();
+
+  // .fs.ErrorExecute error = 2;
+  bool has_error() const;
   private:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      _internal_variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      _internal_mutable_variables();
+  bool _internal_has_error() const;
   public:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      mutable_variables();
-
-  // string uuid = 1;
-  void clear_uuid();
-  const std::string& uuid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_uuid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_uuid();
-  PROTOBUF_NODISCARD std::string* release_uuid();
-  void set_allocated_uuid(std::string* uuid);
+  void clear_error();
+  const ::fs::ErrorExecute& error() const;
+  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
+  ::fs::ErrorExecute* mutable_error();
+  void set_allocated_error(::fs::ErrorExecute* error);
   private:
-  const std::string& _internal_uuid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
-  std::string* _internal_mutable_uuid();
+  const ::fs::ErrorExecute& _internal_error() const;
+  ::fs::ErrorExecute* _internal_mutable_error();
   public:
+  void unsafe_arena_set_allocated_error(
+      ::fs::ErrorExecute* error);
+  ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.SetVariablesRequest)
+  // @@protoc_insertion_point(class_scope:fs.ExecuteResponse)
  private:
   class _Internal;
 
@@ -6662,12 +7333,8 @@ class SetVariablesRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-        SetVariablesRequest_VariablesEntry_DoNotUse,
-        std::string, std::string,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    ::fs::ErrorExecute* error_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -6675,24 +7342,52 @@ class SetVariablesRequest final :
 };
 // -------------------------------------------------------------------
 
-class SetVariablesResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SetVariablesResponse) */ {
- public:
-  inline SetVariablesResponse() : SetVariablesResponse(nullptr) {}
-  ~SetVariablesResponse() override;
-  explicit PROTOBUF_CONSTEXPR SetVariablesResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+class HangupRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HangupRequest_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HangupRequest_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  HangupRequest_VariablesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR HangupRequest_VariablesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit HangupRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const HangupRequest_VariablesEntry_DoNotUse& other);
+  static const HangupRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const HangupRequest_VariablesEntry_DoNotUse*>(&_HangupRequest_VariablesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.HangupRequest.VariablesEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.HangupRequest.VariablesEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_fs_2eproto;
+};
 
-  SetVariablesResponse(const SetVariablesResponse& from);
-  SetVariablesResponse(SetVariablesResponse&& from) noexcept
-    : SetVariablesResponse() {
+// -------------------------------------------------------------------
+
+class HangupRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupRequest) */ {
+ public:
+  inline HangupRequest() : HangupRequest(nullptr) {}
+  ~HangupRequest() override;
+  explicit PROTOBUF_CONSTEXPR HangupRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HangupRequest(const HangupRequest& from);
+  HangupRequest(HangupRequest&& from) noexcept
+    : HangupRequest() {
     *this = ::std::move(from);
   }
 
-  inline SetVariablesResponse& operator=(const SetVariablesResponse& from) {
+  inline HangupRequest& operator=(const HangupRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SetVariablesResponse& operator=(SetVariablesResponse&& from) noexcept {
+  inline HangupRequest& operator=(HangupRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6715,20 +7410,20 @@ class SetVariablesResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SetVariablesResponse& default_instance() {
+  static const HangupRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SetVariablesResponse* internal_default_instance() {
-    return reinterpret_cast<const SetVariablesResponse*>(
-               &_SetVariablesResponse_default_instance_);
+  static inline const HangupRequest* internal_default_instance() {
+    return reinterpret_cast<const HangupRequest*>(
+               &_HangupRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    43;
+    42;
 
-  friend void swap(SetVariablesResponse& a, SetVariablesResponse& b) {
+  friend void swap(HangupRequest& a, HangupRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(SetVariablesResponse* other) {
+  inline void Swap(HangupRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6741,7 +7436,7 @@ class SetVariablesResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SetVariablesResponse* other) {
+  void UnsafeArenaSwap(HangupRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6749,14 +7444,14 @@ class SetVariablesResponse final :
 
   // implements Message ----------------------------------------------
 
-  SetVariablesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SetVariablesResponse>(arena);
+  HangupRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HangupRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SetVariablesResponse& from);
+  void CopyFrom(const HangupRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SetVariablesResponse& from) {
-    SetVariablesResponse::MergeImpl(*this, from);
+  void MergeFrom( const HangupRequest& from) {
+    HangupRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6774,16 +7469,18 @@ class SetVariablesResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SetVariablesResponse* other);
+  void InternalSwap(HangupRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.SetVariablesResponse";
+    return "fs.HangupRequest";
   }
   protected:
-  explicit SetVariablesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit HangupRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -6793,30 +7490,70 @@ class SetVariablesResponse final :
 
   // nested types ----------------------------------------------------
 
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kErrorFieldNumber = 1,
+    kVariablesFieldNumber = 4,
+    kUuidFieldNumber = 1,
+    kCauseFieldNumber = 2,
+    kReportingFieldNumber = 3,
   };
-  // .fs.ErrorExecute error = 1;
-  bool has_error() const;
+  // map<string, string> variables = 4;
+  int variables_size() const;
   private:
-  bool _internal_has_error() const;
+  int _internal_variables_size() const;
   public:
-  void clear_error();
-  const ::fs::ErrorExecute& error() const;
-  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
-  ::fs::ErrorExecute* mutable_error();
-  void set_allocated_error(::fs::ErrorExecute* error);
+  void clear_variables();
   private:
-  const ::fs::ErrorExecute& _internal_error() const;
-  ::fs::ErrorExecute* _internal_mutable_error();
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_variables();
   public:
-  void unsafe_arena_set_allocated_error(
-      ::fs::ErrorExecute* error);
-  ::fs::ErrorExecute* unsafe_arena_release_error();
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_variables();
 
-  // @@protoc_insertion_point(class_scope:fs.SetVariablesResponse)
+  // string uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // string cause = 2;
+  void clear_cause();
+  const std::string& cause() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cause(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cause();
+  PROTOBUF_NODISCARD std::string* release_cause();
+  void set_allocated_cause(std::string* cause);
+  private:
+  const std::string& _internal_cause() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cause(const std::string& value);
+  std::string* _internal_mutable_cause();
+  public:
+
+  // bool reporting = 3;
+  void clear_reporting();
+  bool reporting() const;
+  void set_reporting(bool value);
+  private:
+  bool _internal_reporting() const;
+  void _internal_set_reporting(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.HangupRequest)
  private:
   class _Internal;
 
@@ -6824,7 +7561,14 @@ class SetVariablesResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::fs::ErrorExecute* error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        HangupRequest_VariablesEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cause_;
+    bool reporting_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -6832,52 +7576,24 @@ class SetVariablesResponse final :
 };
 // -------------------------------------------------------------------
 
-class HangupMatchingVarsReqeust_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HangupMatchingVarsReqeust_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
-public:
-  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HangupMatchingVarsReqeust_VariablesEntry_DoNotUse, 
-    std::string, std::string,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
-  HangupMatchingVarsReqeust_VariablesEntry_DoNotUse();
-  explicit PROTOBUF_CONSTEXPR HangupMatchingVarsReqeust_VariablesEntry_DoNotUse(
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-  explicit HangupMatchingVarsReqeust_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  void MergeFrom(const HangupMatchingVarsReqeust_VariablesEntry_DoNotUse& other);
-  static const HangupMatchingVarsReqeust_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const HangupMatchingVarsReqeust_VariablesEntry_DoNotUse*>(&_HangupMatchingVarsReqeust_VariablesEntry_DoNotUse_default_instance_); }
-  static bool ValidateKey(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.HangupMatchingVarsReqeust.VariablesEntry.key");
- }
-  static bool ValidateValue(std::string* s) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.HangupMatchingVarsReqeust.VariablesEntry.value");
- }
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  friend struct ::TableStruct_fs_2eproto;
-};
-
-// -------------------------------------------------------------------
-
-class HangupMatchingVarsReqeust final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupMatchingVarsReqeust) */ {
+class HangupResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupResponse) */ {
  public:
-  inline HangupMatchingVarsReqeust() : HangupMatchingVarsReqeust(nullptr) {}
-  ~HangupMatchingVarsReqeust() override;
-  explicit PROTOBUF_CONSTEXPR HangupMatchingVarsReqeust(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline HangupResponse() : HangupResponse(nullptr) {}
+  ~HangupResponse() override;
+  explicit PROTOBUF_CONSTEXPR HangupResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  HangupMatchingVarsReqeust(const HangupMatchingVarsReqeust& from);
-  HangupMatchingVarsReqeust(HangupMatchingVarsReqeust&& from) noexcept
-    : HangupMatchingVarsReqeust() {
+  HangupResponse(const HangupResponse& from);
+  HangupResponse(HangupResponse&& from) noexcept
+    : HangupResponse() {
     *this = ::std::move(from);
   }
 
-  inline HangupMatchingVarsReqeust& operator=(const HangupMatchingVarsReqeust& from) {
+  inline HangupResponse& operator=(const HangupResponse& from) {
     CopyFrom(from);
     return *this;
   }
-  inline HangupMatchingVarsReqeust& operator=(HangupMatchingVarsReqeust&& from) noexcept {
+  inline HangupResponse& operator=(HangupResponse&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -6900,20 +7616,20 @@ class HangupMatchingVarsReqeust final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const HangupMatchingVarsReqeust& default_instance() {
+  static const HangupResponse& default_instance() {
     return *internal_default_instance();
   }
-  static inline const HangupMatchingVarsReqeust* internal_default_instance() {
-    return reinterpret_cast<const HangupMatchingVarsReqeust*>(
-               &_HangupMatchingVarsReqeust_default_instance_);
+  static inline const HangupResponse* internal_default_instance() {
+    return reinterpret_cast<const HangupResponse*>(
+               &_HangupResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    45;
+    43;
 
-  friend void swap(HangupMatchingVarsReqeust& a, HangupMatchingVarsReqeust& b) {
+  friend void swap(HangupResponse& a, HangupResponse& b) {
     a.Swap(&b);
   }
-  inline void Swap(HangupMatchingVarsReqeust* other) {
+  inline void Swap(HangupResponse* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -6926,7 +7642,7 @@ class HangupMatchingVarsReqeust final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(HangupMatchingVarsReqeust* other) {
+  void UnsafeArenaSwap(HangupResponse* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -6934,14 +7650,14 @@ class HangupMatchingVarsReqeust final :
 
   // implements Message ----------------------------------------------
 
-  HangupMatchingVarsReqeust* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<HangupMatchingVarsReqeust>(arena);
+  HangupResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HangupResponse>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const HangupMatchingVarsReqeust& from);
+  void CopyFrom(const HangupResponse& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const HangupMatchingVarsReqeust& from) {
-    HangupMatchingVarsReqeust::MergeImpl(*this, from);
+  void MergeFrom( const HangupResponse& from) {
+    HangupResponse::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -6959,18 +7675,16 @@ class HangupMatchingVarsReqeust final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(HangupMatchingVarsReqeust* other);
+  void InternalSwap(HangupResponse* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.HangupMatchingVarsReqeust";
+    return "fs.HangupResponse";
   }
   protected:
-  explicit HangupMatchingVarsReqeust(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit HangupResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
-  private:
-  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -6980,45 +7694,30 @@ class HangupMatchingVarsReqeust final :
 
   // nested types ----------------------------------------------------
 
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kVariablesFieldNumber = 2,
-    kCauseFieldNumber = 1,
+    kErrorFieldNumber = 1,
   };
-  // map<string, string> variables = 2;
-  int variables_size() const;
-  private:
-  int _internal_variables_size() const;
-  public:
-  void clear_variables();
+  // .fs.ErrorExecute error = 1;
+  bool has_error() const;
   private:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      _internal_variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      _internal_mutable_variables();
+  bool _internal_has_error() const;
   public:
-  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-      variables() const;
-  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-      mutable_variables();
-
-  // string cause = 1;
-  void clear_cause();
-  const std::string& cause() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cause(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cause();
-  PROTOBUF_NODISCARD std::string* release_cause();
-  void set_allocated_cause(std::string* cause);
+  void clear_error();
+  const ::fs::ErrorExecute& error() const;
+  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
+  ::fs::ErrorExecute* mutable_error();
+  void set_allocated_error(::fs::ErrorExecute* error);
   private:
-  const std::string& _internal_cause() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cause(const std::string& value);
-  std::string* _internal_mutable_cause();
+  const ::fs::ErrorExecute& _internal_error() const;
+  ::fs::ErrorExecute* _internal_mutable_error();
   public:
+  void unsafe_arena_set_allocated_error(
+      ::fs::ErrorExecute* error);
+  ::fs::ErrorExecute* unsafe_arena_release_error();
 
-  // @@protoc_insertion_point(class_scope:fs.HangupMatchingVarsReqeust)
+  // @@protoc_insertion_point(class_scope:fs.HangupResponse)
  private:
   class _Internal;
 
@@ -7026,12 +7725,7 @@ class HangupMatchingVarsReqeust final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-        HangupMatchingVarsReqeust_VariablesEntry_DoNotUse,
-        std::string, std::string,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cause_;
+    ::fs::ErrorExecute* error_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -7039,24 +7733,24 @@ class HangupMatchingVarsReqeust final :
 };
 // -------------------------------------------------------------------
 
-class HangupMatchingVarsResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupMatchingVarsResponse) */ {
+class OriginateRequest_Extension final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.OriginateRequest.Extension) */ {
  public:
-  inline HangupMatchingVarsResponse() : HangupMatchingVarsResponse(nullptr) {}
-  ~HangupMatchingVarsResponse() override;
-  explicit PROTOBUF_CONSTEXPR HangupMatchingVarsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline OriginateRequest_Extension() : OriginateRequest_Extension(nullptr) {}
+  ~OriginateRequest_Extension() override;
+  explicit PROTOBUF_CONSTEXPR OriginateRequest_Extension(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  HangupMatchingVarsResponse(const HangupMatchingVarsResponse& from);
-  HangupMatchingVarsResponse(HangupMatchingVarsResponse&& from) noexcept
-    : HangupMatchingVarsResponse() {
+  OriginateRequest_Extension(const OriginateRequest_Extension& from);
+  OriginateRequest_Extension(OriginateRequest_Extension&& from) noexcept
+    : OriginateRequest_Extension() {
     *this = ::std::move(from);
   }
 
-  inline HangupMatchingVarsResponse& operator=(const HangupMatchingVarsResponse& from) {
+  inline OriginateRequest_Extension& operator=(const OriginateRequest_Extension& from) {
     CopyFrom(from);
     return *this;
   }
-  inline HangupMatchingVarsResponse& operator=(HangupMatchingVarsResponse&& from) noexcept {
+  inline OriginateRequest_Extension& operator=(OriginateRequest_Extension&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -7079,20 +7773,20 @@ class HangupMatchingVarsResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const HangupMatchingVarsResponse& default_instance() {
+  static const OriginateRequest_Extension& default_instance() {
     return *internal_default_instance();
   }
-  static inline const HangupMatchingVarsResponse* internal_default_instance() {
-    return reinterpret_cast<const HangupMatchingVarsResponse*>(
-               &_HangupMatchingVarsResponse_default_instance_);
+  static inline const OriginateRequest_Extension* internal_default_instance() {
+    return reinterpret_cast<const OriginateRequest_Extension*>(
+               &_OriginateRequest_Extension_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    46;
+    44;
 
-  friend void swap(HangupMatchingVarsResponse& a, HangupMatchingVarsResponse& b) {
+  friend void swap(OriginateRequest_Extension& a, OriginateRequest_Extension& b) {
     a.Swap(&b);
   }
-  inline void Swap(HangupMatchingVarsResponse* other) {
+  inline void Swap(OriginateRequest_Extension* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -7105,7 +7799,7 @@ class HangupMatchingVarsResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(HangupMatchingVarsResponse* other) {
+  void UnsafeArenaSwap(OriginateRequest_Extension* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -7113,14 +7807,14 @@ class HangupMatchingVarsResponse final :
 
   // implements Message ----------------------------------------------
 
-  HangupMatchingVarsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<HangupMatchingVarsResponse>(arena);
+  OriginateRequest_Extension* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OriginateRequest_Extension>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const HangupMatchingVarsResponse& from);
+  void CopyFrom(const OriginateRequest_Extension& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const HangupMatchingVarsResponse& from) {
-    HangupMatchingVarsResponse::MergeImpl(*this, from);
+  void MergeFrom( const OriginateRequest_Extension& from) {
+    OriginateRequest_Extension::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -7138,15 +7832,15 @@ class HangupMatchingVarsResponse final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(HangupMatchingVarsResponse* other);
+  void InternalSwap(OriginateRequest_Extension* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "fs.HangupMatchingVarsResponse";
+    return "fs.OriginateRequest.Extension";
   }
   protected:
-  explicit HangupMatchingVarsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit OriginateRequest_Extension(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -7160,18 +7854,38 @@ class HangupMatchingVarsResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kCountFieldNumber = 1,
+    kAppNameFieldNumber = 1,
+    kArgsFieldNumber = 2,
   };
-  // int32 count = 1;
-  void clear_count();
-  int32_t count() const;
-  void set_count(int32_t value);
+  // string appName = 1;
+  void clear_appname();
+  const std::string& appname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_appname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_appname();
+  PROTOBUF_NODISCARD std::string* release_appname();
+  void set_allocated_appname(std::string* appname);
   private:
-  int32_t _internal_count() const;
-  void _internal_set_count(int32_t value);
+  const std::string& _internal_appname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_appname(const std::string& value);
+  std::string* _internal_mutable_appname();
   public:
 
-  // @@protoc_insertion_point(class_scope:fs.HangupMatchingVarsResponse)
+  // string args = 2;
+  void clear_args();
+  const std::string& args() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_args(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_args();
+  PROTOBUF_NODISCARD std::string* release_args();
+  void set_allocated_args(std::string* args);
+  private:
+  const std::string& _internal_args() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_args(const std::string& value);
+  std::string* _internal_mutable_args();
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.OriginateRequest.Extension)
  private:
   class _Internal;
 
@@ -7179,21 +7893,5827 @@ class HangupMatchingVarsResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t count_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr appname_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr args_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_fs_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
+
+class OriginateRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<OriginateRequest_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<OriginateRequest_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  OriginateRequest_VariablesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR OriginateRequest_VariablesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit OriginateRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const OriginateRequest_VariablesEntry_DoNotUse& other);
+  static const OriginateRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const OriginateRequest_VariablesEntry_DoNotUse*>(&_OriginateRequest_VariablesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.OriginateRequest.VariablesEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.OriginateRequest.VariablesEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_fs_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class OriginateRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.OriginateRequest) */ {
+ public:
+  inline OriginateRequest() : OriginateRequest(nullptr) {}
+  ~OriginateRequest() override;
+  explicit PROTOBUF_CONSTEXPR OriginateRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OriginateRequest(const OriginateRequest& from);
+  OriginateRequest(OriginateRequest&& from) noexcept
+    : OriginateRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline OriginateRequest& operator=(const OriginateRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OriginateRequest& operator=(OriginateRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OriginateRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OriginateRequest* internal_default_instance() {
+    return reinterpret_cast<const OriginateRequest*>(
+               &_OriginateRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    46;
+
+  friend void swap(OriginateRequest& a, OriginateRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OriginateRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OriginateRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OriginateRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OriginateRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OriginateRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OriginateRequest& from) {
+    OriginateRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OriginateRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.OriginateRequest";
+  }
+  protected:
+  explicit OriginateRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef OriginateRequest_Extension Extension;
+
+  typedef OriginateRequest_Strategy Strategy;
+  static constexpr Strategy FAILOVER =
+    OriginateRequest_Strategy_FAILOVER;
+  static constexpr Strategy MULTIPLE =
+    OriginateRequest_Strategy_MULTIPLE;
+  static inline bool Strategy_IsValid(int value) {
+    return OriginateRequest_Strategy_IsValid(value);
+  }
+  static constexpr Strategy Strategy_MIN =
+    OriginateRequest_Strategy_Strategy_MIN;
+  static constexpr Strategy Strategy_MAX =
+    OriginateRequest_Strategy_Strategy_MAX;
+  static constexpr int Strategy_ARRAYSIZE =
+    OriginateRequest_Strategy_Strategy_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Strategy_descriptor() {
+    return OriginateRequest_Strategy_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Strategy_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Strategy>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Strategy_Name.");
+    return OriginateRequest_Strategy_Name(enum_t_value);
+  }
+  static inline bool Strategy_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Strategy* value) {
+    return OriginateRequest_Strategy_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVariablesFieldNumber = 1,
+    kEndpointsFieldNumber = 2,
+    kExtensionsFieldNumber = 10,
+    kDestinationFieldNumber = 4,
+    kCallerNumberFieldNumber = 6,
+    kCallerNameFieldNumber = 7,
+    kContextFieldNumber = 8,
+    kDialplanFieldNumber = 9,
+    kCheckIdFieldNumber = 11,
+    kStrategyFieldNumber = 3,
+    kTimeoutFieldNumber = 5,
+  };
+  // map<string, string> variables = 1;
+  int variables_size() const;
+  private:
+  int _internal_variables_size() const;
+  public:
+  void clear_variables();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_variables();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_variables();
+
+  // repeated string endpoints = 2;
+  int endpoints_size() const;
+  private:
+  int _internal_endpoints_size() const;
+  public:
+  void clear_endpoints();
+  const std::string& endpoints(int index) const;
+  std::string* mutable_endpoints(int index);
+  void set_endpoints(int index, const std::string& value);
+  void set_endpoints(int index, std::string&& value);
+  void set_endpoints(int index, const char* value);
+  void set_endpoints(int index, const char* value, size_t size);
+  std::string* add_endpoints();
+  void add_endpoints(const std::string& value);
+  void add_endpoints(std::string&& value);
+  void add_endpoints(const char* value);
+  void add_endpoints(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& endpoints() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_endpoints();
+  private:
+  const std::string& _internal_endpoints(int index) const;
+  std::string* _internal_add_endpoints();
+  public:
+
+  // repeated .fs.OriginateRequest.Extension extensions = 10;
+  int extensions_size() const;
+  private:
+  int _internal_extensions_size() const;
+  public:
+  void clear_extensions();
+  ::fs::OriginateRequest_Extension* mutable_extensions(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest_Extension >*
+      mutable_extensions();
+  private:
+  const ::fs::OriginateRequest_Extension& _internal_extensions(int index) const;
+  ::fs::OriginateRequest_Extension* _internal_add_extensions();
+  public:
+  const ::fs::OriginateRequest_Extension& extensions(int index) const;
+  ::fs::OriginateRequest_Extension* add_extensions();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest_Extension >&
+      extensions() const;
+
+  // string destination = 4;
+  void clear_destination();
+  const std::string& destination() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_destination(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_destination();
+  PROTOBUF_NODISCARD std::string* release_destination();
+  void set_allocated_destination(std::string* destination);
+  private:
+  const std::string& _internal_destination() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
+  std::string* _internal_mutable_destination();
+  public:
+
+  // string callerNumber = 6;
+  void clear_callernumber();
+  const std::string& callernumber() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_callernumber(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_callernumber();
+  PROTOBUF_NODISCARD std::string* release_callernumber();
+  void set_allocated_callernumber(std::string* callernumber);
+  private:
+  const std::string& _internal_callernumber() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_callernumber(const std::string& value);
+  std::string* _internal_mutable_callernumber();
+  public:
+
+  // string callerName = 7;
+  void clear_callername();
+  const std::string& callername() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_callername(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_callername();
+  PROTOBUF_NODISCARD std::string* release_callername();
+  void set_allocated_callername(std::string* callername);
+  private:
+  const std::string& _internal_callername() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_callername(const std::string& value);
+  std::string* _internal_mutable_callername();
+  public:
+
+  // string context = 8;
+  void clear_context();
+  const std::string& context() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_context(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_context();
+  PROTOBUF_NODISCARD std::string* release_context();
+  void set_allocated_context(std::string* context);
+  private:
+  const std::string& _internal_context() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_context(const std::string& value);
+  std::string* _internal_mutable_context();
+  public:
+
+  // string dialplan = 9;
+  void clear_dialplan();
+  const std::string& dialplan() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_dialplan(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_dialplan();
+  PROTOBUF_NODISCARD std::string* release_dialplan();
+  void set_allocated_dialplan(std::string* dialplan);
+  private:
+  const std::string& _internal_dialplan() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_dialplan(const std::string& value);
+  std::string* _internal_mutable_dialplan();
+  public:
+
+  // string check_id = 11;
+  void clear_check_id();
+  const std::string& check_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_check_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_check_id();
+  PROTOBUF_NODISCARD std::string* release_check_id();
+  void set_allocated_check_id(std::string* check_id);
+  private:
+  const std::string& _internal_check_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_check_id(const std::string& value);
+  std::string* _internal_mutable_check_id();
+  public:
+
+  // .fs.OriginateRequest.Strategy strategy = 3;
+  void clear_strategy();
+  ::fs::OriginateRequest_Strategy strategy() const;
+  void set_strategy(::fs::OriginateRequest_Strategy value);
+  private:
+  ::fs::OriginateRequest_Strategy _internal_strategy() const;
+  void _internal_set_strategy(::fs::OriginateRequest_Strategy value);
+  public:
+
+  // int32 timeout = 5;
+  void clear_timeout();
+  int32_t timeout() const;
+  void set_timeout(int32_t value);
+  private:
+  int32_t _internal_timeout() const;
+  void _internal_set_timeout(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.OriginateRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        OriginateRequest_VariablesEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> endpoints_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest_Extension > extensions_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr callernumber_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr callername_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr context_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr dialplan_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr check_id_;
+    int strategy_;
+    int32_t timeout_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OriginateResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.OriginateResponse) */ {
+ public:
+  inline OriginateResponse() : OriginateResponse(nullptr) {}
+  ~OriginateResponse() override;
+  explicit PROTOBUF_CONSTEXPR OriginateResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OriginateResponse(const OriginateResponse& from);
+  OriginateResponse(OriginateResponse&& from) noexcept
+    : OriginateResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline OriginateResponse& operator=(const OriginateResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OriginateResponse& operator=(OriginateResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OriginateResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OriginateResponse* internal_default_instance() {
+    return reinterpret_cast<const OriginateResponse*>(
+               &_OriginateResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    47;
+
+  friend void swap(OriginateResponse& a, OriginateResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OriginateResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OriginateResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OriginateResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OriginateResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OriginateResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OriginateResponse& from) {
+    OriginateResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OriginateResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.OriginateResponse";
+  }
+  protected:
+  explicit OriginateResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kErrorFieldNumber = 2,
+    kErrorCodeFieldNumber = 3,
+  };
+  // string uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // .fs.ErrorExecute error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const ::fs::ErrorExecute& error() const;
+  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
+  ::fs::ErrorExecute* mutable_error();
+  void set_allocated_error(::fs::ErrorExecute* error);
+  private:
+  const ::fs::ErrorExecute& _internal_error() const;
+  ::fs::ErrorExecute* _internal_mutable_error();
+  public:
+  void unsafe_arena_set_allocated_error(
+      ::fs::ErrorExecute* error);
+  ::fs::ErrorExecute* unsafe_arena_release_error();
+
+  // int32 error_code = 3;
+  void clear_error_code();
+  int32_t error_code() const;
+  void set_error_code(int32_t value);
+  private:
+  int32_t _internal_error_code() const;
+  void _internal_set_error_code(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.OriginateResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::fs::ErrorExecute* error_;
+    int32_t error_code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OriginateAsyncResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.OriginateAsyncResponse) */ {
+ public:
+  inline OriginateAsyncResponse() : OriginateAsyncResponse(nullptr) {}
+  ~OriginateAsyncResponse() override;
+  explicit PROTOBUF_CONSTEXPR OriginateAsyncResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OriginateAsyncResponse(const OriginateAsyncResponse& from);
+  OriginateAsyncResponse(OriginateAsyncResponse&& from) noexcept
+    : OriginateAsyncResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline OriginateAsyncResponse& operator=(const OriginateAsyncResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OriginateAsyncResponse& operator=(OriginateAsyncResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OriginateAsyncResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OriginateAsyncResponse* internal_default_instance() {
+    return reinterpret_cast<const OriginateAsyncResponse*>(
+               &_OriginateAsyncResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    48;
+
+  friend void swap(OriginateAsyncResponse& a, OriginateAsyncResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OriginateAsyncResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OriginateAsyncResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OriginateAsyncResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OriginateAsyncResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OriginateAsyncResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OriginateAsyncResponse& from) {
+    OriginateAsyncResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OriginateAsyncResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.OriginateAsyncResponse";
+  }
+  protected:
+  explicit OriginateAsyncResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef OriginateAsyncResponse_State State;
+  static constexpr State CREATED =
+    OriginateAsyncResponse_State_CREATED;
+  static constexpr State RINGING =
+    OriginateAsyncResponse_State_RINGING;
+  static constexpr State EARLY_MEDIA =
+    OriginateAsyncResponse_State_EARLY_MEDIA;
+  static constexpr State ANSWERED =
+    OriginateAsyncResponse_State_ANSWERED;
+  static constexpr State FAILED =
+    OriginateAsyncResponse_State_FAILED;
+  static inline bool State_IsValid(int value) {
+    return OriginateAsyncResponse_State_IsValid(value);
+  }
+  static constexpr State State_MIN =
+    OriginateAsyncResponse_State_State_MIN;
+  static constexpr State State_MAX =
+    OriginateAsyncResponse_State_State_MAX;
+  static constexpr int State_ARRAYSIZE =
+    OriginateAsyncResponse_State_State_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  State_descriptor() {
+    return OriginateAsyncResponse_State_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& State_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, State>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function State_Name.");
+    return OriginateAsyncResponse_State_Name(enum_t_value);
+  }
+  static inline bool State_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      State* value) {
+    return OriginateAsyncResponse_State_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kErrorFieldNumber = 3,
+    kStateFieldNumber = 2,
+    kErrorCodeFieldNumber = 4,
+  };
+  // string uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // .fs.ErrorExecute error = 3;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const ::fs::ErrorExecute& error() const;
+  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
+  ::fs::ErrorExecute* mutable_error();
+  void set_allocated_error(::fs::ErrorExecute* error);
+  private:
+  const ::fs::ErrorExecute& _internal_error() const;
+  ::fs::ErrorExecute* _internal_mutable_error();
+  public:
+  void unsafe_arena_set_allocated_error(
+      ::fs::ErrorExecute* error);
+  ::fs::ErrorExecute* unsafe_arena_release_error();
+
+  // .fs.OriginateAsyncResponse.State state = 2;
+  void clear_state();
+  ::fs::OriginateAsyncResponse_State state() const;
+  void set_state(::fs::OriginateAsyncResponse_State value);
+  private:
+  ::fs::OriginateAsyncResponse_State _internal_state() const;
+  void _internal_set_state(::fs::OriginateAsyncResponse_State value);
+  public:
+
+  // int32 error_code = 4;
+  void clear_error_code();
+  int32_t error_code() const;
+  void set_error_code(int32_t value);
+  private:
+  int32_t _internal_error_code() const;
+  void _internal_set_error_code(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.OriginateAsyncResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::fs::ErrorExecute* error_;
+    int state_;
+    int32_t error_code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OriginateBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.OriginateBatchRequest) */ {
+ public:
+  inline OriginateBatchRequest() : OriginateBatchRequest(nullptr) {}
+  ~OriginateBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR OriginateBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OriginateBatchRequest(const OriginateBatchRequest& from);
+  OriginateBatchRequest(OriginateBatchRequest&& from) noexcept
+    : OriginateBatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline OriginateBatchRequest& operator=(const OriginateBatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OriginateBatchRequest& operator=(OriginateBatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OriginateBatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OriginateBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const OriginateBatchRequest*>(
+               &_OriginateBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    49;
+
+  friend void swap(OriginateBatchRequest& a, OriginateBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OriginateBatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OriginateBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OriginateBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OriginateBatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OriginateBatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OriginateBatchRequest& from) {
+    OriginateBatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OriginateBatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.OriginateBatchRequest";
+  }
+  protected:
+  explicit OriginateBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestsFieldNumber = 1,
+    kConcurrencyFieldNumber = 2,
+    kRateFieldNumber = 3,
+  };
+  // repeated .fs.OriginateRequest requests = 1;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  ::fs::OriginateRequest* mutable_requests(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest >*
+      mutable_requests();
+  private:
+  const ::fs::OriginateRequest& _internal_requests(int index) const;
+  ::fs::OriginateRequest* _internal_add_requests();
+  public:
+  const ::fs::OriginateRequest& requests(int index) const;
+  ::fs::OriginateRequest* add_requests();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest >&
+      requests() const;
+
+  // int32 concurrency = 2;
+  void clear_concurrency();
+  int32_t concurrency() const;
+  void set_concurrency(int32_t value);
+  private:
+  int32_t _internal_concurrency() const;
+  void _internal_set_concurrency(int32_t value);
+  public:
+
+  // int32 rate = 3;
+  void clear_rate();
+  int32_t rate() const;
+  void set_rate(int32_t value);
+  private:
+  int32_t _internal_rate() const;
+  void _internal_set_rate(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.OriginateBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest > requests_;
+    int32_t concurrency_;
+    int32_t rate_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OriginateBatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.OriginateBatchResponse) */ {
+ public:
+  inline OriginateBatchResponse() : OriginateBatchResponse(nullptr) {}
+  ~OriginateBatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR OriginateBatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OriginateBatchResponse(const OriginateBatchResponse& from);
+  OriginateBatchResponse(OriginateBatchResponse&& from) noexcept
+    : OriginateBatchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline OriginateBatchResponse& operator=(const OriginateBatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OriginateBatchResponse& operator=(OriginateBatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OriginateBatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OriginateBatchResponse* internal_default_instance() {
+    return reinterpret_cast<const OriginateBatchResponse*>(
+               &_OriginateBatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    50;
+
+  friend void swap(OriginateBatchResponse& a, OriginateBatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OriginateBatchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OriginateBatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OriginateBatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OriginateBatchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OriginateBatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OriginateBatchResponse& from) {
+    OriginateBatchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OriginateBatchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.OriginateBatchResponse";
+  }
+  protected:
+  explicit OriginateBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultFieldNumber = 2,
+    kIndexFieldNumber = 1,
+  };
+  // .fs.OriginateResponse result = 2;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const ::fs::OriginateResponse& result() const;
+  PROTOBUF_NODISCARD ::fs::OriginateResponse* release_result();
+  ::fs::OriginateResponse* mutable_result();
+  void set_allocated_result(::fs::OriginateResponse* result);
+  private:
+  const ::fs::OriginateResponse& _internal_result() const;
+  ::fs::OriginateResponse* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::fs::OriginateResponse* result);
+  ::fs::OriginateResponse* unsafe_arena_release_result();
+
+  // int32 index = 1;
+  void clear_index();
+  int32_t index() const;
+  void set_index(int32_t value);
+  private:
+  int32_t _internal_index() const;
+  void _internal_set_index(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.OriginateBatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::fs::OriginateResponse* result_;
+    int32_t index_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BridgeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BridgeRequest) */ {
+ public:
+  inline BridgeRequest() : BridgeRequest(nullptr) {}
+  ~BridgeRequest() override;
+  explicit PROTOBUF_CONSTEXPR BridgeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BridgeRequest(const BridgeRequest& from);
+  BridgeRequest(BridgeRequest&& from) noexcept
+    : BridgeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline BridgeRequest& operator=(const BridgeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BridgeRequest& operator=(BridgeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BridgeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BridgeRequest* internal_default_instance() {
+    return reinterpret_cast<const BridgeRequest*>(
+               &_BridgeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    51;
+
+  friend void swap(BridgeRequest& a, BridgeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BridgeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BridgeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BridgeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BridgeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BridgeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BridgeRequest& from) {
+    BridgeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BridgeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.BridgeRequest";
+  }
+  protected:
+  explicit BridgeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLegAIdFieldNumber = 1,
+    kLegBIdFieldNumber = 2,
+    kLegBReserveIdFieldNumber = 3,
+  };
+  // string leg_a_id = 1;
+  void clear_leg_a_id();
+  const std::string& leg_a_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leg_a_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leg_a_id();
+  PROTOBUF_NODISCARD std::string* release_leg_a_id();
+  void set_allocated_leg_a_id(std::string* leg_a_id);
+  private:
+  const std::string& _internal_leg_a_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg_a_id(const std::string& value);
+  std::string* _internal_mutable_leg_a_id();
+  public:
+
+  // string leg_b_id = 2;
+  void clear_leg_b_id();
+  const std::string& leg_b_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leg_b_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leg_b_id();
+  PROTOBUF_NODISCARD std::string* release_leg_b_id();
+  void set_allocated_leg_b_id(std::string* leg_b_id);
+  private:
+  const std::string& _internal_leg_b_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg_b_id(const std::string& value);
+  std::string* _internal_mutable_leg_b_id();
+  public:
+
+  // string leg_b_reserve_id = 3;
+  void clear_leg_b_reserve_id();
+  const std::string& leg_b_reserve_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_leg_b_reserve_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_leg_b_reserve_id();
+  PROTOBUF_NODISCARD std::string* release_leg_b_reserve_id();
+  void set_allocated_leg_b_reserve_id(std::string* leg_b_reserve_id);
+  private:
+  const std::string& _internal_leg_b_reserve_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_leg_b_reserve_id(const std::string& value);
+  std::string* _internal_mutable_leg_b_reserve_id();
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.BridgeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_a_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_b_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr leg_b_reserve_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BridgeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.BridgeResponse) */ {
+ public:
+  inline BridgeResponse() : BridgeResponse(nullptr) {}
+  ~BridgeResponse() override;
+  explicit PROTOBUF_CONSTEXPR BridgeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BridgeResponse(const BridgeResponse& from);
+  BridgeResponse(BridgeResponse&& from) noexcept
+    : BridgeResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline BridgeResponse& operator=(const BridgeResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BridgeResponse& operator=(BridgeResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BridgeResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BridgeResponse* internal_default_instance() {
+    return reinterpret_cast<const BridgeResponse*>(
+               &_BridgeResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    52;
+
+  friend void swap(BridgeResponse& a, BridgeResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BridgeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BridgeResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BridgeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BridgeResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BridgeResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BridgeResponse& from) {
+    BridgeResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BridgeResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.BridgeResponse";
+  }
+  protected:
+  explicit BridgeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUuidFieldNumber = 1,
+    kErrorFieldNumber = 2,
+  };
+  // string uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // .fs.ErrorExecute error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const ::fs::ErrorExecute& error() const;
+  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
+  ::fs::ErrorExecute* mutable_error();
+  void set_allocated_error(::fs::ErrorExecute* error);
+  private:
+  const ::fs::ErrorExecute& _internal_error() const;
+  ::fs::ErrorExecute* _internal_mutable_error();
+  public:
+  void unsafe_arena_set_allocated_error(
+      ::fs::ErrorExecute* error);
+  ::fs::ErrorExecute* unsafe_arena_release_error();
+
+  // @@protoc_insertion_point(class_scope:fs.BridgeResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::fs::ErrorExecute* error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetVariablesRequest_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SetVariablesRequest_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SetVariablesRequest_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  SetVariablesRequest_VariablesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR SetVariablesRequest_VariablesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit SetVariablesRequest_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const SetVariablesRequest_VariablesEntry_DoNotUse& other);
+  static const SetVariablesRequest_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const SetVariablesRequest_VariablesEntry_DoNotUse*>(&_SetVariablesRequest_VariablesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.SetVariablesRequest.VariablesEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.SetVariablesRequest.VariablesEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_fs_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class SetVariablesRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SetVariablesRequest) */ {
+ public:
+  inline SetVariablesRequest() : SetVariablesRequest(nullptr) {}
+  ~SetVariablesRequest() override;
+  explicit PROTOBUF_CONSTEXPR SetVariablesRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetVariablesRequest(const SetVariablesRequest& from);
+  SetVariablesRequest(SetVariablesRequest&& from) noexcept
+    : SetVariablesRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SetVariablesRequest& operator=(const SetVariablesRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetVariablesRequest& operator=(SetVariablesRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetVariablesRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetVariablesRequest* internal_default_instance() {
+    return reinterpret_cast<const SetVariablesRequest*>(
+               &_SetVariablesRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    54;
+
+  friend void swap(SetVariablesRequest& a, SetVariablesRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetVariablesRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetVariablesRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetVariablesRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetVariablesRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetVariablesRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetVariablesRequest& from) {
+    SetVariablesRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetVariablesRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.SetVariablesRequest";
+  }
+  protected:
+  explicit SetVariablesRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVariablesFieldNumber = 2,
+    kUuidFieldNumber = 1,
+  };
+  // map<string, string> variables = 2;
+  int variables_size() const;
+  private:
+  int _internal_variables_size() const;
+  public:
+  void clear_variables();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_variables();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_variables();
+
+  // string uuid = 1;
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.SetVariablesRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        SetVariablesRequest_VariablesEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetVariablesResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.SetVariablesResponse) */ {
+ public:
+  inline SetVariablesResponse() : SetVariablesResponse(nullptr) {}
+  ~SetVariablesResponse() override;
+  explicit PROTOBUF_CONSTEXPR SetVariablesResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SetVariablesResponse(const SetVariablesResponse& from);
+  SetVariablesResponse(SetVariablesResponse&& from) noexcept
+    : SetVariablesResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SetVariablesResponse& operator=(const SetVariablesResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetVariablesResponse& operator=(SetVariablesResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SetVariablesResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SetVariablesResponse* internal_default_instance() {
+    return reinterpret_cast<const SetVariablesResponse*>(
+               &_SetVariablesResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    55;
+
+  friend void swap(SetVariablesResponse& a, SetVariablesResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetVariablesResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetVariablesResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SetVariablesResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SetVariablesResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SetVariablesResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SetVariablesResponse& from) {
+    SetVariablesResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetVariablesResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.SetVariablesResponse";
+  }
+  protected:
+  explicit SetVariablesResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 1,
+  };
+  // .fs.ErrorExecute error = 1;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const ::fs::ErrorExecute& error() const;
+  PROTOBUF_NODISCARD ::fs::ErrorExecute* release_error();
+  ::fs::ErrorExecute* mutable_error();
+  void set_allocated_error(::fs::ErrorExecute* error);
+  private:
+  const ::fs::ErrorExecute& _internal_error() const;
+  ::fs::ErrorExecute* _internal_mutable_error();
+  public:
+  void unsafe_arena_set_allocated_error(
+      ::fs::ErrorExecute* error);
+  ::fs::ErrorExecute* unsafe_arena_release_error();
+
+  // @@protoc_insertion_point(class_scope:fs.SetVariablesResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::fs::ErrorExecute* error_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HangupMatchingVarsReqeust_VariablesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HangupMatchingVarsReqeust_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<HangupMatchingVarsReqeust_VariablesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  HangupMatchingVarsReqeust_VariablesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR HangupMatchingVarsReqeust_VariablesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit HangupMatchingVarsReqeust_VariablesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const HangupMatchingVarsReqeust_VariablesEntry_DoNotUse& other);
+  static const HangupMatchingVarsReqeust_VariablesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const HangupMatchingVarsReqeust_VariablesEntry_DoNotUse*>(&_HangupMatchingVarsReqeust_VariablesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.HangupMatchingVarsReqeust.VariablesEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "fs.HangupMatchingVarsReqeust.VariablesEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_fs_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class HangupMatchingVarsReqeust final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupMatchingVarsReqeust) */ {
+ public:
+  inline HangupMatchingVarsReqeust() : HangupMatchingVarsReqeust(nullptr) {}
+  ~HangupMatchingVarsReqeust() override;
+  explicit PROTOBUF_CONSTEXPR HangupMatchingVarsReqeust(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HangupMatchingVarsReqeust(const HangupMatchingVarsReqeust& from);
+  HangupMatchingVarsReqeust(HangupMatchingVarsReqeust&& from) noexcept
+    : HangupMatchingVarsReqeust() {
+    *this = ::std::move(from);
+  }
+
+  inline HangupMatchingVarsReqeust& operator=(const HangupMatchingVarsReqeust& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HangupMatchingVarsReqeust& operator=(HangupMatchingVarsReqeust&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HangupMatchingVarsReqeust& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HangupMatchingVarsReqeust* internal_default_instance() {
+    return reinterpret_cast<const HangupMatchingVarsReqeust*>(
+               &_HangupMatchingVarsReqeust_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    57;
+
+  friend void swap(HangupMatchingVarsReqeust& a, HangupMatchingVarsReqeust& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HangupMatchingVarsReqeust* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HangupMatchingVarsReqeust* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HangupMatchingVarsReqeust* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HangupMatchingVarsReqeust>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HangupMatchingVarsReqeust& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HangupMatchingVarsReqeust& from) {
+    HangupMatchingVarsReqeust::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HangupMatchingVarsReqeust* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.HangupMatchingVarsReqeust";
+  }
+  protected:
+  explicit HangupMatchingVarsReqeust(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVariablesFieldNumber = 2,
+    kCauseFieldNumber = 1,
+  };
+  // map<string, string> variables = 2;
+  int variables_size() const;
+  private:
+  int _internal_variables_size() const;
+  public:
+  void clear_variables();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_variables();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      variables() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_variables();
+
+  // string cause = 1;
+  void clear_cause();
+  const std::string& cause() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_cause(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_cause();
+  PROTOBUF_NODISCARD std::string* release_cause();
+  void set_allocated_cause(std::string* cause);
+  private:
+  const std::string& _internal_cause() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cause(const std::string& value);
+  std::string* _internal_mutable_cause();
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.HangupMatchingVarsReqeust)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        HangupMatchingVarsReqeust_VariablesEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> variables_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cause_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HangupMatchingVarsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:fs.HangupMatchingVarsResponse) */ {
+ public:
+  inline HangupMatchingVarsResponse() : HangupMatchingVarsResponse(nullptr) {}
+  ~HangupMatchingVarsResponse() override;
+  explicit PROTOBUF_CONSTEXPR HangupMatchingVarsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HangupMatchingVarsResponse(const HangupMatchingVarsResponse& from);
+  HangupMatchingVarsResponse(HangupMatchingVarsResponse&& from) noexcept
+    : HangupMatchingVarsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline HangupMatchingVarsResponse& operator=(const HangupMatchingVarsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HangupMatchingVarsResponse& operator=(HangupMatchingVarsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const HangupMatchingVarsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HangupMatchingVarsResponse* internal_default_instance() {
+    return reinterpret_cast<const HangupMatchingVarsResponse*>(
+               &_HangupMatchingVarsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    58;
+
+  friend void swap(HangupMatchingVarsResponse& a, HangupMatchingVarsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HangupMatchingVarsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HangupMatchingVarsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HangupMatchingVarsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HangupMatchingVarsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const HangupMatchingVarsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const HangupMatchingVarsResponse& from) {
+    HangupMatchingVarsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(HangupMatchingVarsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "fs.HangupMatchingVarsResponse";
+  }
+  protected:
+  explicit HangupMatchingVarsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountFieldNumber = 1,
+  };
+  // int32 count = 1;
+  void clear_count();
+  int32_t count() const;
+  void set_count(int32_t value);
+  private:
+  int32_t _internal_count() const;
+  void _internal_set_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:fs.HangupMatchingVarsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_fs_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SubscribeCallEventsRequest
+
+// repeated string events = 1;
+inline int SubscribeCallEventsRequest::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int SubscribeCallEventsRequest::events_size() const {
+  return _internal_events_size();
+}
+inline void SubscribeCallEventsRequest::clear_events() {
+  _impl_.events_.Clear();
+}
+inline std::string* SubscribeCallEventsRequest::add_events() {
+  std::string* _s = _internal_add_events();
+  // @@protoc_insertion_point(field_add_mutable:fs.SubscribeCallEventsRequest.events)
+  return _s;
+}
+inline const std::string& SubscribeCallEventsRequest::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const std::string& SubscribeCallEventsRequest::events(int index) const {
+  // @@protoc_insertion_point(field_get:fs.SubscribeCallEventsRequest.events)
+  return _internal_events(index);
+}
+inline std::string* SubscribeCallEventsRequest::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:fs.SubscribeCallEventsRequest.events)
+  return _impl_.events_.Mutable(index);
+}
+inline void SubscribeCallEventsRequest::set_events(int index, const std::string& value) {
+  _impl_.events_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:fs.SubscribeCallEventsRequest.events)
+}
+inline void SubscribeCallEventsRequest::set_events(int index, std::string&& value) {
+  _impl_.events_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:fs.SubscribeCallEventsRequest.events)
+}
+inline void SubscribeCallEventsRequest::set_events(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.events_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:fs.SubscribeCallEventsRequest.events)
+}
+inline void SubscribeCallEventsRequest::set_events(int index, const char* value, size_t size) {
+  _impl_.events_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:fs.SubscribeCallEventsRequest.events)
+}
+inline std::string* SubscribeCallEventsRequest::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline void SubscribeCallEventsRequest::add_events(const std::string& value) {
+  _impl_.events_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:fs.SubscribeCallEventsRequest.events)
+}
+inline void SubscribeCallEventsRequest::add_events(std::string&& value) {
+  _impl_.events_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:fs.SubscribeCallEventsRequest.events)
+}
+inline void SubscribeCallEventsRequest::add_events(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.events_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:fs.SubscribeCallEventsRequest.events)
+}
+inline void SubscribeCallEventsRequest::add_events(const char* value, size_t size) {
+  _impl_.events_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:fs.SubscribeCallEventsRequest.events)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SubscribeCallEventsRequest::events() const {
+  // @@protoc_insertion_point(field_list:fs.SubscribeCallEventsRequest.events)
+  return _impl_.events_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SubscribeCallEventsRequest::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:fs.SubscribeCallEventsRequest.events)
+  return &_impl_.events_;
+}
+
+// int64 domain_id = 2;
+inline void SubscribeCallEventsRequest::clear_domain_id() {
+  _impl_.domain_id_ = int64_t{0};
+}
+inline int64_t SubscribeCallEventsRequest::_internal_domain_id() const {
+  return _impl_.domain_id_;
+}
+inline int64_t SubscribeCallEventsRequest::domain_id() const {
+  // @@protoc_insertion_point(field_get:fs.SubscribeCallEventsRequest.domain_id)
+  return _internal_domain_id();
+}
+inline void SubscribeCallEventsRequest::_internal_set_domain_id(int64_t value) {
+  
+  _impl_.domain_id_ = value;
+}
+inline void SubscribeCallEventsRequest::set_domain_id(int64_t value) {
+  _internal_set_domain_id(value);
+  // @@protoc_insertion_point(field_set:fs.SubscribeCallEventsRequest.domain_id)
+}
+
+// -------------------------------------------------------------------
+
+// CallEvent
+
+// string event = 1;
+inline void CallEvent::clear_event() {
+  _impl_.event_.ClearToEmpty();
+}
+inline const std::string& CallEvent::event() const {
+  // @@protoc_insertion_point(field_get:fs.CallEvent.event)
+  return _internal_event();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEvent::set_event(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.event_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEvent.event)
+}
+inline std::string* CallEvent::mutable_event() {
+  std::string* _s = _internal_mutable_event();
+  // @@protoc_insertion_point(field_mutable:fs.CallEvent.event)
+  return _s;
+}
+inline const std::string& CallEvent::_internal_event() const {
+  return _impl_.event_.Get();
+}
+inline void CallEvent::_internal_set_event(const std::string& value) {
+  
+  _impl_.event_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEvent::_internal_mutable_event() {
+  
+  return _impl_.event_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEvent::release_event() {
+  // @@protoc_insertion_point(field_release:fs.CallEvent.event)
+  return _impl_.event_.Release();
+}
+inline void CallEvent::set_allocated_event(std::string* event) {
+  if (event != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.event_.SetAllocated(event, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_.IsDefault()) {
+    _impl_.event_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEvent.event)
+}
+
+// string id = 2;
+inline void CallEvent::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& CallEvent::id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEvent.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEvent::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEvent.id)
+}
+inline std::string* CallEvent::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:fs.CallEvent.id)
+  return _s;
+}
+inline const std::string& CallEvent::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void CallEvent::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEvent::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEvent::release_id() {
+  // @@protoc_insertion_point(field_release:fs.CallEvent.id)
+  return _impl_.id_.Release();
+}
+inline void CallEvent::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEvent.id)
+}
+
+// string app_id = 3;
+inline void CallEvent::clear_app_id() {
+  _impl_.app_id_.ClearToEmpty();
+}
+inline const std::string& CallEvent::app_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEvent.app_id)
+  return _internal_app_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEvent::set_app_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.app_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEvent.app_id)
+}
+inline std::string* CallEvent::mutable_app_id() {
+  std::string* _s = _internal_mutable_app_id();
+  // @@protoc_insertion_point(field_mutable:fs.CallEvent.app_id)
+  return _s;
+}
+inline const std::string& CallEvent::_internal_app_id() const {
+  return _impl_.app_id_.Get();
+}
+inline void CallEvent::_internal_set_app_id(const std::string& value) {
+  
+  _impl_.app_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEvent::_internal_mutable_app_id() {
+  
+  return _impl_.app_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEvent::release_app_id() {
+  // @@protoc_insertion_point(field_release:fs.CallEvent.app_id)
+  return _impl_.app_id_.Release();
+}
+inline void CallEvent::set_allocated_app_id(std::string* app_id) {
+  if (app_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.app_id_.SetAllocated(app_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.app_id_.IsDefault()) {
+    _impl_.app_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEvent.app_id)
+}
+
+// int64 domain_id = 4;
+inline void CallEvent::clear_domain_id() {
+  _impl_.domain_id_ = int64_t{0};
+}
+inline int64_t CallEvent::_internal_domain_id() const {
+  return _impl_.domain_id_;
+}
+inline int64_t CallEvent::domain_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEvent.domain_id)
+  return _internal_domain_id();
+}
+inline void CallEvent::_internal_set_domain_id(int64_t value) {
+  
+  _impl_.domain_id_ = value;
+}
+inline void CallEvent::set_domain_id(int64_t value) {
+  _internal_set_domain_id(value);
+  // @@protoc_insertion_point(field_set:fs.CallEvent.domain_id)
+}
+
+// int64 user_id = 5;
+inline void CallEvent::clear_user_id() {
+  _impl_.user_id_ = int64_t{0};
+}
+inline int64_t CallEvent::_internal_user_id() const {
+  return _impl_.user_id_;
+}
+inline int64_t CallEvent::user_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEvent.user_id)
+  return _internal_user_id();
+}
+inline void CallEvent::_internal_set_user_id(int64_t value) {
+  
+  _impl_.user_id_ = value;
+}
+inline void CallEvent::set_user_id(int64_t value) {
+  _internal_set_user_id(value);
+  // @@protoc_insertion_point(field_set:fs.CallEvent.user_id)
+}
+
+// string cc_app_id = 6;
+inline void CallEvent::clear_cc_app_id() {
+  _impl_.cc_app_id_.ClearToEmpty();
+}
+inline const std::string& CallEvent::cc_app_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEvent.cc_app_id)
+  return _internal_cc_app_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEvent::set_cc_app_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cc_app_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEvent.cc_app_id)
+}
+inline std::string* CallEvent::mutable_cc_app_id() {
+  std::string* _s = _internal_mutable_cc_app_id();
+  // @@protoc_insertion_point(field_mutable:fs.CallEvent.cc_app_id)
+  return _s;
+}
+inline const std::string& CallEvent::_internal_cc_app_id() const {
+  return _impl_.cc_app_id_.Get();
+}
+inline void CallEvent::_internal_set_cc_app_id(const std::string& value) {
+  
+  _impl_.cc_app_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEvent::_internal_mutable_cc_app_id() {
+  
+  return _impl_.cc_app_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEvent::release_cc_app_id() {
+  // @@protoc_insertion_point(field_release:fs.CallEvent.cc_app_id)
+  return _impl_.cc_app_id_.Release();
+}
+inline void CallEvent::set_allocated_cc_app_id(std::string* cc_app_id) {
+  if (cc_app_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cc_app_id_.SetAllocated(cc_app_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cc_app_id_.IsDefault()) {
+    _impl_.cc_app_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEvent.cc_app_id)
+}
+
+// int64 timestamp = 7;
+inline void CallEvent::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t CallEvent::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t CallEvent::timestamp() const {
+  // @@protoc_insertion_point(field_get:fs.CallEvent.timestamp)
+  return _internal_timestamp();
+}
+inline void CallEvent::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void CallEvent::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:fs.CallEvent.timestamp)
+}
+
+// string data = 8;
+inline void CallEvent::clear_data() {
+  _impl_.data_.ClearToEmpty();
+}
+inline const std::string& CallEvent::data() const {
+  // @@protoc_insertion_point(field_get:fs.CallEvent.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEvent::set_data(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.data_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEvent.data)
+}
+inline std::string* CallEvent::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:fs.CallEvent.data)
+  return _s;
+}
+inline const std::string& CallEvent::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void CallEvent::_internal_set_data(const std::string& value) {
+  
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEvent::_internal_mutable_data() {
+  
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEvent::release_data() {
+  // @@protoc_insertion_point(field_release:fs.CallEvent.data)
+  return _impl_.data_.Release();
+}
+inline void CallEvent::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEvent.data)
+}
+
+// .fs.CallEventPayload payload = 9;
+inline bool CallEvent::_internal_has_payload() const {
+  return this != internal_default_instance() && _impl_.payload_ != nullptr;
+}
+inline bool CallEvent::has_payload() const {
+  return _internal_has_payload();
+}
+inline void CallEvent::clear_payload() {
+  if (GetArenaForAllocation() == nullptr && _impl_.payload_ != nullptr) {
+    delete _impl_.payload_;
+  }
+  _impl_.payload_ = nullptr;
+}
+inline const ::fs::CallEventPayload& CallEvent::_internal_payload() const {
+  const ::fs::CallEventPayload* p = _impl_.payload_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fs::CallEventPayload&>(
+      ::fs::_CallEventPayload_default_instance_);
+}
+inline const ::fs::CallEventPayload& CallEvent::payload() const {
+  // @@protoc_insertion_point(field_get:fs.CallEvent.payload)
+  return _internal_payload();
+}
+inline void CallEvent::unsafe_arena_set_allocated_payload(
+    ::fs::CallEventPayload* payload) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.payload_);
+  }
+  _impl_.payload_ = payload;
+  if (payload) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fs.CallEvent.payload)
+}
+inline ::fs::CallEventPayload* CallEvent::release_payload() {
+  
+  ::fs::CallEventPayload* temp = _impl_.payload_;
+  _impl_.payload_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fs::CallEventPayload* CallEvent::unsafe_arena_release_payload() {
+  // @@protoc_insertion_point(field_release:fs.CallEvent.payload)
+  
+  ::fs::CallEventPayload* temp = _impl_.payload_;
+  _impl_.payload_ = nullptr;
+  return temp;
+}
+inline ::fs::CallEventPayload* CallEvent::_internal_mutable_payload() {
+  
+  if (_impl_.payload_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fs::CallEventPayload>(GetArenaForAllocation());
+    _impl_.payload_ = p;
+  }
+  return _impl_.payload_;
+}
+inline ::fs::CallEventPayload* CallEvent::mutable_payload() {
+  ::fs::CallEventPayload* _msg = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:fs.CallEvent.payload)
+  return _msg;
+}
+inline void CallEvent::set_allocated_payload(::fs::CallEventPayload* payload) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.payload_;
+  }
+  if (payload) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(payload);
+    if (message_arena != submessage_arena) {
+      payload = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, payload, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.payload_ = payload;
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEvent.payload)
+}
+
+// -------------------------------------------------------------------
+
+// CallEventPayload_Endpoint
+
+// string type = 1;
+inline void CallEventPayload_Endpoint::clear_type() {
+  _impl_.type_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Endpoint::type() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Endpoint.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Endpoint::set_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Endpoint.type)
+}
+inline std::string* CallEventPayload_Endpoint::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Endpoint.type)
+  return _s;
+}
+inline const std::string& CallEventPayload_Endpoint::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void CallEventPayload_Endpoint::_internal_set_type(const std::string& value) {
+  
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Endpoint::_internal_mutable_type() {
+  
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Endpoint::release_type() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Endpoint.type)
+  return _impl_.type_.Release();
+}
+inline void CallEventPayload_Endpoint::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Endpoint.type)
+}
+
+// string id = 2;
+inline void CallEventPayload_Endpoint::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Endpoint::id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Endpoint.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Endpoint::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Endpoint.id)
+}
+inline std::string* CallEventPayload_Endpoint::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Endpoint.id)
+  return _s;
+}
+inline const std::string& CallEventPayload_Endpoint::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void CallEventPayload_Endpoint::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Endpoint::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Endpoint::release_id() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Endpoint.id)
+  return _impl_.id_.Release();
+}
+inline void CallEventPayload_Endpoint::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Endpoint.id)
+}
+
+// string name = 3;
+inline void CallEventPayload_Endpoint::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Endpoint::name() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Endpoint.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Endpoint::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Endpoint.name)
+}
+inline std::string* CallEventPayload_Endpoint::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Endpoint.name)
+  return _s;
+}
+inline const std::string& CallEventPayload_Endpoint::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CallEventPayload_Endpoint::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Endpoint::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Endpoint::release_name() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Endpoint.name)
+  return _impl_.name_.Release();
+}
+inline void CallEventPayload_Endpoint::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Endpoint.name)
+}
+
+// string number = 4;
+inline void CallEventPayload_Endpoint::clear_number() {
+  _impl_.number_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Endpoint::number() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Endpoint.number)
+  return _internal_number();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Endpoint::set_number(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.number_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Endpoint.number)
+}
+inline std::string* CallEventPayload_Endpoint::mutable_number() {
+  std::string* _s = _internal_mutable_number();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Endpoint.number)
+  return _s;
+}
+inline const std::string& CallEventPayload_Endpoint::_internal_number() const {
+  return _impl_.number_.Get();
+}
+inline void CallEventPayload_Endpoint::_internal_set_number(const std::string& value) {
+  
+  _impl_.number_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Endpoint::_internal_mutable_number() {
+  
+  return _impl_.number_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Endpoint::release_number() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Endpoint.number)
+  return _impl_.number_.Release();
+}
+inline void CallEventPayload_Endpoint::set_allocated_number(std::string* number) {
+  if (number != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.number_.SetAllocated(number, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.number_.IsDefault()) {
+    _impl_.number_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Endpoint.number)
+}
+
+// -------------------------------------------------------------------
+
+// CallEventPayload_Parameters
+
+// bool video = 1;
+inline void CallEventPayload_Parameters::clear_video() {
+  _impl_.video_ = false;
+}
+inline bool CallEventPayload_Parameters::_internal_video() const {
+  return _impl_.video_;
+}
+inline bool CallEventPayload_Parameters::video() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Parameters.video)
+  return _internal_video();
+}
+inline void CallEventPayload_Parameters::_internal_set_video(bool value) {
+  
+  _impl_.video_ = value;
+}
+inline void CallEventPayload_Parameters::set_video(bool value) {
+  _internal_set_video(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Parameters.video)
+}
+
+// bool screen = 2;
+inline void CallEventPayload_Parameters::clear_screen() {
+  _impl_.screen_ = false;
+}
+inline bool CallEventPayload_Parameters::_internal_screen() const {
+  return _impl_.screen_;
+}
+inline bool CallEventPayload_Parameters::screen() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Parameters.screen)
+  return _internal_screen();
+}
+inline void CallEventPayload_Parameters::_internal_set_screen(bool value) {
+  
+  _impl_.screen_ = value;
+}
+inline void CallEventPayload_Parameters::set_screen(bool value) {
+  _internal_set_screen(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Parameters.screen)
+}
+
+// string autoAnswer = 3;
+inline void CallEventPayload_Parameters::clear_autoanswer() {
+  _impl_.autoanswer_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Parameters::autoanswer() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Parameters.autoAnswer)
+  return _internal_autoanswer();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Parameters::set_autoanswer(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.autoanswer_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Parameters.autoAnswer)
+}
+inline std::string* CallEventPayload_Parameters::mutable_autoanswer() {
+  std::string* _s = _internal_mutable_autoanswer();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Parameters.autoAnswer)
+  return _s;
+}
+inline const std::string& CallEventPayload_Parameters::_internal_autoanswer() const {
+  return _impl_.autoanswer_.Get();
+}
+inline void CallEventPayload_Parameters::_internal_set_autoanswer(const std::string& value) {
+  
+  _impl_.autoanswer_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Parameters::_internal_mutable_autoanswer() {
+  
+  return _impl_.autoanswer_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Parameters::release_autoanswer() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Parameters.autoAnswer)
+  return _impl_.autoanswer_.Release();
+}
+inline void CallEventPayload_Parameters::set_allocated_autoanswer(std::string* autoanswer) {
+  if (autoanswer != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.autoanswer_.SetAllocated(autoanswer, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.autoanswer_.IsDefault()) {
+    _impl_.autoanswer_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Parameters.autoAnswer)
+}
+
+// bool disableStun = 4;
+inline void CallEventPayload_Parameters::clear_disablestun() {
+  _impl_.disablestun_ = false;
+}
+inline bool CallEventPayload_Parameters::_internal_disablestun() const {
+  return _impl_.disablestun_;
+}
+inline bool CallEventPayload_Parameters::disablestun() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Parameters.disableStun)
+  return _internal_disablestun();
+}
+inline void CallEventPayload_Parameters::_internal_set_disablestun(bool value) {
+  
+  _impl_.disablestun_ = value;
+}
+inline void CallEventPayload_Parameters::set_disablestun(bool value) {
+  _internal_set_disablestun(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Parameters.disableStun)
+}
+
+// -------------------------------------------------------------------
+
+// CallEventPayload_Eavesdrop
+
+// string type = 1;
+inline void CallEventPayload_Eavesdrop::clear_type() {
+  _impl_.type_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Eavesdrop::type() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Eavesdrop.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Eavesdrop::set_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Eavesdrop.type)
+}
+inline std::string* CallEventPayload_Eavesdrop::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Eavesdrop.type)
+  return _s;
+}
+inline const std::string& CallEventPayload_Eavesdrop::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void CallEventPayload_Eavesdrop::_internal_set_type(const std::string& value) {
+  
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Eavesdrop::_internal_mutable_type() {
+  
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Eavesdrop::release_type() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Eavesdrop.type)
+  return _impl_.type_.Release();
+}
+inline void CallEventPayload_Eavesdrop::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Eavesdrop.type)
+}
+
+// string name = 2;
+inline void CallEventPayload_Eavesdrop::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Eavesdrop::name() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Eavesdrop.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Eavesdrop::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Eavesdrop.name)
+}
+inline std::string* CallEventPayload_Eavesdrop::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Eavesdrop.name)
+  return _s;
+}
+inline const std::string& CallEventPayload_Eavesdrop::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CallEventPayload_Eavesdrop::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Eavesdrop::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Eavesdrop::release_name() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Eavesdrop.name)
+  return _impl_.name_.Release();
+}
+inline void CallEventPayload_Eavesdrop::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Eavesdrop.name)
+}
+
+// string number = 3;
+inline void CallEventPayload_Eavesdrop::clear_number() {
+  _impl_.number_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Eavesdrop::number() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Eavesdrop.number)
+  return _internal_number();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Eavesdrop::set_number(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.number_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Eavesdrop.number)
+}
+inline std::string* CallEventPayload_Eavesdrop::mutable_number() {
+  std::string* _s = _internal_mutable_number();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Eavesdrop.number)
+  return _s;
+}
+inline const std::string& CallEventPayload_Eavesdrop::_internal_number() const {
+  return _impl_.number_.Get();
+}
+inline void CallEventPayload_Eavesdrop::_internal_set_number(const std::string& value) {
+  
+  _impl_.number_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Eavesdrop::_internal_mutable_number() {
+  
+  return _impl_.number_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Eavesdrop::release_number() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Eavesdrop.number)
+  return _impl_.number_.Release();
+}
+inline void CallEventPayload_Eavesdrop::set_allocated_number(std::string* number) {
+  if (number != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.number_.SetAllocated(number, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.number_.IsDefault()) {
+    _impl_.number_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Eavesdrop.number)
+}
+
+// int32 duration = 4;
+inline void CallEventPayload_Eavesdrop::clear_duration() {
+  _impl_.duration_ = 0;
+}
+inline int32_t CallEventPayload_Eavesdrop::_internal_duration() const {
+  return _impl_.duration_;
+}
+inline int32_t CallEventPayload_Eavesdrop::duration() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Eavesdrop.duration)
+  return _internal_duration();
+}
+inline void CallEventPayload_Eavesdrop::_internal_set_duration(int32_t value) {
+  
+  _impl_.duration_ = value;
+}
+inline void CallEventPayload_Eavesdrop::set_duration(int32_t value) {
+  _internal_set_duration(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Eavesdrop.duration)
+}
+
+// string state = 5;
+inline void CallEventPayload_Eavesdrop::clear_state() {
+  _impl_.state_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Eavesdrop::state() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Eavesdrop.state)
+  return _internal_state();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Eavesdrop::set_state(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.state_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Eavesdrop.state)
+}
+inline std::string* CallEventPayload_Eavesdrop::mutable_state() {
+  std::string* _s = _internal_mutable_state();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Eavesdrop.state)
+  return _s;
+}
+inline const std::string& CallEventPayload_Eavesdrop::_internal_state() const {
+  return _impl_.state_.Get();
+}
+inline void CallEventPayload_Eavesdrop::_internal_set_state(const std::string& value) {
+  
+  _impl_.state_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Eavesdrop::_internal_mutable_state() {
+  
+  return _impl_.state_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Eavesdrop::release_state() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Eavesdrop.state)
+  return _impl_.state_.Release();
+}
+inline void CallEventPayload_Eavesdrop::set_allocated_state(std::string* state) {
+  if (state != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.state_.SetAllocated(state, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.state_.IsDefault()) {
+    _impl_.state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Eavesdrop.state)
+}
+
+// -------------------------------------------------------------------
+
+// CallEventPayload_Call
+
+// string id = 1;
+inline void CallEventPayload_Call::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Call::id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Call.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Call::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Call.id)
+}
+inline std::string* CallEventPayload_Call::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Call.id)
+  return _s;
+}
+inline const std::string& CallEventPayload_Call::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void CallEventPayload_Call::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Call::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Call::release_id() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Call.id)
+  return _impl_.id_.Release();
+}
+inline void CallEventPayload_Call::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Call.id)
+}
+
+// int64 user_id = 2;
+inline void CallEventPayload_Call::clear_user_id() {
+  _impl_.user_id_ = int64_t{0};
+}
+inline int64_t CallEventPayload_Call::_internal_user_id() const {
+  return _impl_.user_id_;
+}
+inline int64_t CallEventPayload_Call::user_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Call.user_id)
+  return _internal_user_id();
+}
+inline void CallEventPayload_Call::_internal_set_user_id(int64_t value) {
+  
+  _impl_.user_id_ = value;
+}
+inline void CallEventPayload_Call::set_user_id(int64_t value) {
+  _internal_set_user_id(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Call.user_id)
+}
+
+// string cc_app_id = 3;
+inline void CallEventPayload_Call::clear_cc_app_id() {
+  _impl_.cc_app_id_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload_Call::cc_app_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.Call.cc_app_id)
+  return _internal_cc_app_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload_Call::set_cc_app_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cc_app_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.Call.cc_app_id)
+}
+inline std::string* CallEventPayload_Call::mutable_cc_app_id() {
+  std::string* _s = _internal_mutable_cc_app_id();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.Call.cc_app_id)
+  return _s;
+}
+inline const std::string& CallEventPayload_Call::_internal_cc_app_id() const {
+  return _impl_.cc_app_id_.Get();
+}
+inline void CallEventPayload_Call::_internal_set_cc_app_id(const std::string& value) {
+  
+  _impl_.cc_app_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Call::_internal_mutable_cc_app_id() {
+  
+  return _impl_.cc_app_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload_Call::release_cc_app_id() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.Call.cc_app_id)
+  return _impl_.cc_app_id_.Release();
+}
+inline void CallEventPayload_Call::set_allocated_cc_app_id(std::string* cc_app_id) {
+  if (cc_app_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cc_app_id_.SetAllocated(cc_app_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cc_app_id_.IsDefault()) {
+    _impl_.cc_app_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.Call.cc_app_id)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// CallEventPayload
+
+// int64 user_id = 1;
+inline void CallEventPayload::clear_user_id() {
+  _impl_.user_id_ = int64_t{0};
+}
+inline int64_t CallEventPayload::_internal_user_id() const {
+  return _impl_.user_id_;
+}
+inline int64_t CallEventPayload::user_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.user_id)
+  return _internal_user_id();
+}
+inline void CallEventPayload::_internal_set_user_id(int64_t value) {
+  
+  _impl_.user_id_ = value;
+}
+inline void CallEventPayload::set_user_id(int64_t value) {
+  _internal_set_user_id(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.user_id)
+}
+
+// int64 gateway_id = 2;
+inline void CallEventPayload::clear_gateway_id() {
+  _impl_.gateway_id_ = int64_t{0};
+}
+inline int64_t CallEventPayload::_internal_gateway_id() const {
+  return _impl_.gateway_id_;
+}
+inline int64_t CallEventPayload::gateway_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.gateway_id)
+  return _internal_gateway_id();
+}
+inline void CallEventPayload::_internal_set_gateway_id(int64_t value) {
+  
+  _impl_.gateway_id_ = value;
+}
+inline void CallEventPayload::set_gateway_id(int64_t value) {
+  _internal_set_gateway_id(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.gateway_id)
+}
+
+// int64 contact_id = 3;
+inline void CallEventPayload::clear_contact_id() {
+  _impl_.contact_id_ = int64_t{0};
+}
+inline int64_t CallEventPayload::_internal_contact_id() const {
+  return _impl_.contact_id_;
+}
+inline int64_t CallEventPayload::contact_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.contact_id)
+  return _internal_contact_id();
+}
+inline void CallEventPayload::_internal_set_contact_id(int64_t value) {
+  
+  _impl_.contact_id_ = value;
+}
+inline void CallEventPayload::set_contact_id(int64_t value) {
+  _internal_set_contact_id(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.contact_id)
+}
+
+// bool hide_contact = 4;
+inline void CallEventPayload::clear_hide_contact() {
+  _impl_.hide_contact_ = false;
+}
+inline bool CallEventPayload::_internal_hide_contact() const {
+  return _impl_.hide_contact_;
+}
+inline bool CallEventPayload::hide_contact() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.hide_contact)
+  return _internal_hide_contact();
+}
+inline void CallEventPayload::_internal_set_hide_contact(bool value) {
+  
+  _impl_.hide_contact_ = value;
+}
+inline void CallEventPayload::set_hide_contact(bool value) {
+  _internal_set_hide_contact(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.hide_contact)
+}
+
+// bool hideNumber = 5;
+inline void CallEventPayload::clear_hidenumber() {
+  _impl_.hidenumber_ = false;
+}
+inline bool CallEventPayload::_internal_hidenumber() const {
+  return _impl_.hidenumber_;
+}
+inline bool CallEventPayload::hidenumber() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.hideNumber)
+  return _internal_hidenumber();
+}
+inline void CallEventPayload::_internal_set_hidenumber(bool value) {
+  
+  _impl_.hidenumber_ = value;
+}
+inline void CallEventPayload::set_hidenumber(bool value) {
+  _internal_set_hidenumber(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.hideNumber)
+}
+
+// map<string, string> payload = 6;
+inline int CallEventPayload::_internal_payload_size() const {
+  return _impl_.payload_.size();
+}
+inline int CallEventPayload::payload_size() const {
+  return _internal_payload_size();
+}
+inline void CallEventPayload::clear_payload() {
+  _impl_.payload_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+CallEventPayload::_internal_payload() const {
+  return _impl_.payload_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+CallEventPayload::payload() const {
+  // @@protoc_insertion_point(field_map:fs.CallEventPayload.payload)
+  return _internal_payload();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+CallEventPayload::_internal_mutable_payload() {
+  return _impl_.payload_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+CallEventPayload::mutable_payload() {
+  // @@protoc_insertion_point(field_mutable_map:fs.CallEventPayload.payload)
+  return _internal_mutable_payload();
+}
+
+// string direction = 7;
+inline void CallEventPayload::clear_direction() {
+  _impl_.direction_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::direction() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.direction)
+  return _internal_direction();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_direction(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.direction_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.direction)
+}
+inline std::string* CallEventPayload::mutable_direction() {
+  std::string* _s = _internal_mutable_direction();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.direction)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_direction() const {
+  return _impl_.direction_.Get();
+}
+inline void CallEventPayload::_internal_set_direction(const std::string& value) {
+  
+  _impl_.direction_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_direction() {
+  
+  return _impl_.direction_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_direction() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.direction)
+  return _impl_.direction_.Release();
+}
+inline void CallEventPayload::set_allocated_direction(std::string* direction) {
+  if (direction != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.direction_.SetAllocated(direction, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.direction_.IsDefault()) {
+    _impl_.direction_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.direction)
+}
+
+// string destination = 8;
+inline void CallEventPayload::clear_destination() {
+  _impl_.destination_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::destination() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.destination)
+  return _internal_destination();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_destination(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.destination_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.destination)
+}
+inline std::string* CallEventPayload::mutable_destination() {
+  std::string* _s = _internal_mutable_destination();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.destination)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_destination() const {
+  return _impl_.destination_.Get();
+}
+inline void CallEventPayload::_internal_set_destination(const std::string& value) {
+  
+  _impl_.destination_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_destination() {
+  
+  return _impl_.destination_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_destination() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.destination)
+  return _impl_.destination_.Release();
+}
+inline void CallEventPayload::set_allocated_destination(std::string* destination) {
+  if (destination != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.destination_.SetAllocated(destination, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.destination)
+}
+
+// string parent_id = 9;
+inline void CallEventPayload::clear_parent_id() {
+  _impl_.parent_id_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::parent_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.parent_id)
+  return _internal_parent_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_parent_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.parent_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.parent_id)
+}
+inline std::string* CallEventPayload::mutable_parent_id() {
+  std::string* _s = _internal_mutable_parent_id();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.parent_id)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_parent_id() const {
+  return _impl_.parent_id_.Get();
+}
+inline void CallEventPayload::_internal_set_parent_id(const std::string& value) {
+  
+  _impl_.parent_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_parent_id() {
+  
+  return _impl_.parent_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_parent_id() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.parent_id)
+  return _impl_.parent_id_.Release();
+}
+inline void CallEventPayload::set_allocated_parent_id(std::string* parent_id) {
+  if (parent_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.parent_id_.SetAllocated(parent_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.parent_id_.IsDefault()) {
+    _impl_.parent_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.parent_id)
+}
+
+// .fs.CallEventPayload.Endpoint from = 10;
+inline bool CallEventPayload::_internal_has_from() const {
+  return this != internal_default_instance() && _impl_.from_ != nullptr;
+}
+inline bool CallEventPayload::has_from() const {
+  return _internal_has_from();
+}
+inline void CallEventPayload::clear_from() {
+  if (GetArenaForAllocation() == nullptr && _impl_.from_ != nullptr) {
+    delete _impl_.from_;
+  }
+  _impl_.from_ = nullptr;
+}
+inline const ::fs::CallEventPayload_Endpoint& CallEventPayload::_internal_from() const {
+  const ::fs::CallEventPayload_Endpoint* p = _impl_.from_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fs::CallEventPayload_Endpoint&>(
+      ::fs::_CallEventPayload_Endpoint_default_instance_);
+}
+inline const ::fs::CallEventPayload_Endpoint& CallEventPayload::from() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.from)
+  return _internal_from();
+}
+inline void CallEventPayload::unsafe_arena_set_allocated_from(
+    ::fs::CallEventPayload_Endpoint* from) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.from_);
+  }
+  _impl_.from_ = from;
+  if (from) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fs.CallEventPayload.from)
+}
+inline ::fs::CallEventPayload_Endpoint* CallEventPayload::release_from() {
+  
+  ::fs::CallEventPayload_Endpoint* temp = _impl_.from_;
+  _impl_.from_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fs::CallEventPayload_Endpoint* CallEventPayload::unsafe_arena_release_from() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.from)
+  
+  ::fs::CallEventPayload_Endpoint* temp = _impl_.from_;
+  _impl_.from_ = nullptr;
+  return temp;
+}
+inline ::fs::CallEventPayload_Endpoint* CallEventPayload::_internal_mutable_from() {
+  
+  if (_impl_.from_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fs::CallEventPayload_Endpoint>(GetArenaForAllocation());
+    _impl_.from_ = p;
+  }
+  return _impl_.from_;
+}
+inline ::fs::CallEventPayload_Endpoint* CallEventPayload::mutable_from() {
+  ::fs::CallEventPayload_Endpoint* _msg = _internal_mutable_from();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.from)
+  return _msg;
+}
+inline void CallEventPayload::set_allocated_from(::fs::CallEventPayload_Endpoint* from) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.from_;
+  }
+  if (from) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(from);
+    if (message_arena != submessage_arena) {
+      from = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, from, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.from_ = from;
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.from)
+}
+
+// .fs.CallEventPayload.Endpoint to = 11;
+inline bool CallEventPayload::_internal_has_to() const {
+  return this != internal_default_instance() && _impl_.to_ != nullptr;
+}
+inline bool CallEventPayload::has_to() const {
+  return _internal_has_to();
+}
+inline void CallEventPayload::clear_to() {
+  if (GetArenaForAllocation() == nullptr && _impl_.to_ != nullptr) {
+    delete _impl_.to_;
+  }
+  _impl_.to_ = nullptr;
+}
+inline const ::fs::CallEventPayload_Endpoint& CallEventPayload::_internal_to() const {
+  const ::fs::CallEventPayload_Endpoint* p = _impl_.to_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fs::CallEventPayload_Endpoint&>(
+      ::fs::_CallEventPayload_Endpoint_default_instance_);
+}
+inline const ::fs::CallEventPayload_Endpoint& CallEventPayload::to() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.to)
+  return _internal_to();
+}
+inline void CallEventPayload::unsafe_arena_set_allocated_to(
+    ::fs::CallEventPayload_Endpoint* to) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.to_);
+  }
+  _impl_.to_ = to;
+  if (to) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fs.CallEventPayload.to)
+}
+inline ::fs::CallEventPayload_Endpoint* CallEventPayload::release_to() {
+  
+  ::fs::CallEventPayload_Endpoint* temp = _impl_.to_;
+  _impl_.to_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fs::CallEventPayload_Endpoint* CallEventPayload::unsafe_arena_release_to() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.to)
+  
+  ::fs::CallEventPayload_Endpoint* temp = _impl_.to_;
+  _impl_.to_ = nullptr;
+  return temp;
+}
+inline ::fs::CallEventPayload_Endpoint* CallEventPayload::_internal_mutable_to() {
+  
+  if (_impl_.to_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fs::CallEventPayload_Endpoint>(GetArenaForAllocation());
+    _impl_.to_ = p;
+  }
+  return _impl_.to_;
+}
+inline ::fs::CallEventPayload_Endpoint* CallEventPayload::mutable_to() {
+  ::fs::CallEventPayload_Endpoint* _msg = _internal_mutable_to();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.to)
+  return _msg;
+}
+inline void CallEventPayload::set_allocated_to(::fs::CallEventPayload_Endpoint* to) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.to_;
+  }
+  if (to) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(to);
+    if (message_arena != submessage_arena) {
+      to = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, to, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.to_ = to;
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.to)
+}
+
+// bool originate = 12;
+inline void CallEventPayload::clear_originate() {
+  _impl_.originate_ = false;
+}
+inline bool CallEventPayload::_internal_originate() const {
+  return _impl_.originate_;
+}
+inline bool CallEventPayload::originate() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.originate)
+  return _internal_originate();
+}
+inline void CallEventPayload::_internal_set_originate(bool value) {
+  
+  _impl_.originate_ = value;
+}
+inline void CallEventPayload::set_originate(bool value) {
+  _internal_set_originate(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.originate)
+}
+
+// int32 heartbeat = 13;
+inline void CallEventPayload::clear_heartbeat() {
+  _impl_.heartbeat_ = 0;
+}
+inline int32_t CallEventPayload::_internal_heartbeat() const {
+  return _impl_.heartbeat_;
+}
+inline int32_t CallEventPayload::heartbeat() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.heartbeat)
+  return _internal_heartbeat();
+}
+inline void CallEventPayload::_internal_set_heartbeat(int32_t value) {
+  
+  _impl_.heartbeat_ = value;
+}
+inline void CallEventPayload::set_heartbeat(int32_t value) {
+  _internal_set_heartbeat(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.heartbeat)
+}
+
+// string sip_id = 14;
+inline void CallEventPayload::clear_sip_id() {
+  _impl_.sip_id_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::sip_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.sip_id)
+  return _internal_sip_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_sip_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sip_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.sip_id)
+}
+inline std::string* CallEventPayload::mutable_sip_id() {
+  std::string* _s = _internal_mutable_sip_id();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.sip_id)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_sip_id() const {
+  return _impl_.sip_id_.Get();
+}
+inline void CallEventPayload::_internal_set_sip_id(const std::string& value) {
+  
+  _impl_.sip_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_sip_id() {
+  
+  return _impl_.sip_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_sip_id() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.sip_id)
+  return _impl_.sip_id_.Release();
+}
+inline void CallEventPayload::set_allocated_sip_id(std::string* sip_id) {
+  if (sip_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sip_id_.SetAllocated(sip_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sip_id_.IsDefault()) {
+    _impl_.sip_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.sip_id)
+}
+
+// int64 grantee_id = 15;
+inline void CallEventPayload::clear_grantee_id() {
+  _impl_.grantee_id_ = int64_t{0};
+}
+inline int64_t CallEventPayload::_internal_grantee_id() const {
+  return _impl_.grantee_id_;
+}
+inline int64_t CallEventPayload::grantee_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.grantee_id)
+  return _internal_grantee_id();
+}
+inline void CallEventPayload::_internal_set_grantee_id(int64_t value) {
+  
+  _impl_.grantee_id_ = value;
+}
+inline void CallEventPayload::set_grantee_id(int64_t value) {
+  _internal_set_grantee_id(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.grantee_id)
+}
+
+// string ivr = 16;
+inline void CallEventPayload::clear_ivr() {
+  _impl_.ivr_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::ivr() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.ivr)
+  return _internal_ivr();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_ivr(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ivr_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.ivr)
+}
+inline std::string* CallEventPayload::mutable_ivr() {
+  std::string* _s = _internal_mutable_ivr();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.ivr)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_ivr() const {
+  return _impl_.ivr_.Get();
+}
+inline void CallEventPayload::_internal_set_ivr(const std::string& value) {
+  
+  _impl_.ivr_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_ivr() {
+  
+  return _impl_.ivr_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_ivr() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.ivr)
+  return _impl_.ivr_.Release();
+}
+inline void CallEventPayload::set_allocated_ivr(std::string* ivr) {
+  if (ivr != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.ivr_.SetAllocated(ivr, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ivr_.IsDefault()) {
+    _impl_.ivr_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.ivr)
+}
+
+// map<string, string> queue = 17;
+inline int CallEventPayload::_internal_queue_size() const {
+  return _impl_.queue_.size();
+}
+inline int CallEventPayload::queue_size() const {
+  return _internal_queue_size();
+}
+inline void CallEventPayload::clear_queue() {
+  _impl_.queue_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+CallEventPayload::_internal_queue() const {
+  return _impl_.queue_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+CallEventPayload::queue() const {
+  // @@protoc_insertion_point(field_map:fs.CallEventPayload.queue)
+  return _internal_queue();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+CallEventPayload::_internal_mutable_queue() {
+  return _impl_.queue_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+CallEventPayload::mutable_queue() {
+  // @@protoc_insertion_point(field_mutable_map:fs.CallEventPayload.queue)
+  return _internal_mutable_queue();
+}
+
+// .fs.CallEventPayload.Parameters params = 18;
+inline bool CallEventPayload::_internal_has_params() const {
+  return this != internal_default_instance() && _impl_.params_ != nullptr;
+}
+inline bool CallEventPayload::has_params() const {
+  return _internal_has_params();
+}
+inline void CallEventPayload::clear_params() {
+  if (GetArenaForAllocation() == nullptr && _impl_.params_ != nullptr) {
+    delete _impl_.params_;
+  }
+  _impl_.params_ = nullptr;
+}
+inline const ::fs::CallEventPayload_Parameters& CallEventPayload::_internal_params() const {
+  const ::fs::CallEventPayload_Parameters* p = _impl_.params_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fs::CallEventPayload_Parameters&>(
+      ::fs::_CallEventPayload_Parameters_default_instance_);
+}
+inline const ::fs::CallEventPayload_Parameters& CallEventPayload::params() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.params)
+  return _internal_params();
+}
+inline void CallEventPayload::unsafe_arena_set_allocated_params(
+    ::fs::CallEventPayload_Parameters* params) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.params_);
+  }
+  _impl_.params_ = params;
+  if (params) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fs.CallEventPayload.params)
+}
+inline ::fs::CallEventPayload_Parameters* CallEventPayload::release_params() {
+  
+  ::fs::CallEventPayload_Parameters* temp = _impl_.params_;
+  _impl_.params_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fs::CallEventPayload_Parameters* CallEventPayload::unsafe_arena_release_params() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.params)
+  
+  ::fs::CallEventPayload_Parameters* temp = _impl_.params_;
+  _impl_.params_ = nullptr;
+  return temp;
+}
+inline ::fs::CallEventPayload_Parameters* CallEventPayload::_internal_mutable_params() {
+  
+  if (_impl_.params_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fs::CallEventPayload_Parameters>(GetArenaForAllocation());
+    _impl_.params_ = p;
+  }
+  return _impl_.params_;
+}
+inline ::fs::CallEventPayload_Parameters* CallEventPayload::mutable_params() {
+  ::fs::CallEventPayload_Parameters* _msg = _internal_mutable_params();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.params)
+  return _msg;
+}
+inline void CallEventPayload::set_allocated_params(::fs::CallEventPayload_Parameters* params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.params_;
+  }
+  if (params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(params);
+    if (message_arena != submessage_arena) {
+      params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, params, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.params_ = params;
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.params)
+}
+
+// .fs.CallEventPayload.Eavesdrop eavesdrop = 19;
+inline bool CallEventPayload::_internal_has_eavesdrop() const {
+  return this != internal_default_instance() && _impl_.eavesdrop_ != nullptr;
+}
+inline bool CallEventPayload::has_eavesdrop() const {
+  return _internal_has_eavesdrop();
+}
+inline void CallEventPayload::clear_eavesdrop() {
+  if (GetArenaForAllocation() == nullptr && _impl_.eavesdrop_ != nullptr) {
+    delete _impl_.eavesdrop_;
+  }
+  _impl_.eavesdrop_ = nullptr;
+}
+inline const ::fs::CallEventPayload_Eavesdrop& CallEventPayload::_internal_eavesdrop() const {
+  const ::fs::CallEventPayload_Eavesdrop* p = _impl_.eavesdrop_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fs::CallEventPayload_Eavesdrop&>(
+      ::fs::_CallEventPayload_Eavesdrop_default_instance_);
+}
+inline const ::fs::CallEventPayload_Eavesdrop& CallEventPayload::eavesdrop() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.eavesdrop)
+  return _internal_eavesdrop();
+}
+inline void CallEventPayload::unsafe_arena_set_allocated_eavesdrop(
+    ::fs::CallEventPayload_Eavesdrop* eavesdrop) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.eavesdrop_);
+  }
+  _impl_.eavesdrop_ = eavesdrop;
+  if (eavesdrop) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fs.CallEventPayload.eavesdrop)
+}
+inline ::fs::CallEventPayload_Eavesdrop* CallEventPayload::release_eavesdrop() {
+  
+  ::fs::CallEventPayload_Eavesdrop* temp = _impl_.eavesdrop_;
+  _impl_.eavesdrop_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fs::CallEventPayload_Eavesdrop* CallEventPayload::unsafe_arena_release_eavesdrop() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.eavesdrop)
+  
+  ::fs::CallEventPayload_Eavesdrop* temp = _impl_.eavesdrop_;
+  _impl_.eavesdrop_ = nullptr;
+  return temp;
+}
+inline ::fs::CallEventPayload_Eavesdrop* CallEventPayload::_internal_mutable_eavesdrop() {
+  
+  if (_impl_.eavesdrop_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fs::CallEventPayload_Eavesdrop>(GetArenaForAllocation());
+    _impl_.eavesdrop_ = p;
+  }
+  return _impl_.eavesdrop_;
+}
+inline ::fs::CallEventPayload_Eavesdrop* CallEventPayload::mutable_eavesdrop() {
+  ::fs::CallEventPayload_Eavesdrop* _msg = _internal_mutable_eavesdrop();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.eavesdrop)
+  return _msg;
+}
+inline void CallEventPayload::set_allocated_eavesdrop(::fs::CallEventPayload_Eavesdrop* eavesdrop) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.eavesdrop_;
+  }
+  if (eavesdrop) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(eavesdrop);
+    if (message_arena != submessage_arena) {
+      eavesdrop = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, eavesdrop, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.eavesdrop_ = eavesdrop;
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.eavesdrop)
+}
+
+// string bridged_id = 20;
+inline void CallEventPayload::clear_bridged_id() {
+  _impl_.bridged_id_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::bridged_id() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.bridged_id)
+  return _internal_bridged_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_bridged_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.bridged_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.bridged_id)
+}
+inline std::string* CallEventPayload::mutable_bridged_id() {
+  std::string* _s = _internal_mutable_bridged_id();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.bridged_id)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_bridged_id() const {
+  return _impl_.bridged_id_.Get();
+}
+inline void CallEventPayload::_internal_set_bridged_id(const std::string& value) {
+  
+  _impl_.bridged_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_bridged_id() {
+  
+  return _impl_.bridged_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_bridged_id() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.bridged_id)
+  return _impl_.bridged_id_.Release();
+}
+inline void CallEventPayload::set_allocated_bridged_id(std::string* bridged_id) {
+  if (bridged_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.bridged_id_.SetAllocated(bridged_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bridged_id_.IsDefault()) {
+    _impl_.bridged_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.bridged_id)
+}
+
+// string digit = 21;
+inline void CallEventPayload::clear_digit() {
+  _impl_.digit_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::digit() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.digit)
+  return _internal_digit();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_digit(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.digit_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.digit)
+}
+inline std::string* CallEventPayload::mutable_digit() {
+  std::string* _s = _internal_mutable_digit();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.digit)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_digit() const {
+  return _impl_.digit_.Get();
+}
+inline void CallEventPayload::_internal_set_digit(const std::string& value) {
+  
+  _impl_.digit_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_digit() {
+  
+  return _impl_.digit_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_digit() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.digit)
+  return _impl_.digit_.Release();
+}
+inline void CallEventPayload::set_allocated_digit(std::string* digit) {
+  if (digit != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.digit_.SetAllocated(digit, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.digit_.IsDefault()) {
+    _impl_.digit_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.digit)
+}
+
+// string application = 22;
+inline void CallEventPayload::clear_application() {
+  _impl_.application_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::application() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.application)
+  return _internal_application();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_application(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.application_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.application)
+}
+inline std::string* CallEventPayload::mutable_application() {
+  std::string* _s = _internal_mutable_application();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.application)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_application() const {
+  return _impl_.application_.Get();
+}
+inline void CallEventPayload::_internal_set_application(const std::string& value) {
+  
+  _impl_.application_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_application() {
+  
+  return _impl_.application_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_application() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.application)
+  return _impl_.application_.Release();
+}
+inline void CallEventPayload::set_allocated_application(std::string* application) {
+  if (application != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.application_.SetAllocated(application, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.application_.IsDefault()) {
+    _impl_.application_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.application)
+}
+
+// string state = 23;
+inline void CallEventPayload::clear_state() {
+  _impl_.state_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::state() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.state)
+  return _internal_state();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_state(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.state_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.state)
+}
+inline std::string* CallEventPayload::mutable_state() {
+  std::string* _s = _internal_mutable_state();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.state)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_state() const {
+  return _impl_.state_.Get();
+}
+inline void CallEventPayload::_internal_set_state(const std::string& value) {
+  
+  _impl_.state_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_state() {
+  
+  return _impl_.state_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_state() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.state)
+  return _impl_.state_.Release();
+}
+inline void CallEventPayload::set_allocated_state(std::string* state) {
+  if (state != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.state_.SetAllocated(state, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.state_.IsDefault()) {
+    _impl_.state_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.state)
+}
+
+// string type = 24;
+inline void CallEventPayload::clear_type() {
+  _impl_.type_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::type() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.type)
+}
+inline std::string* CallEventPayload::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.type)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void CallEventPayload::_internal_set_type(const std::string& value) {
+  
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_type() {
+  
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_type() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.type)
+  return _impl_.type_.Release();
+}
+inline void CallEventPayload::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.type)
+}
+
+// string ai_result = 25;
+inline void CallEventPayload::clear_ai_result() {
+  _impl_.ai_result_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::ai_result() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.ai_result)
+  return _internal_ai_result();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_ai_result(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ai_result_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.ai_result)
+}
+inline std::string* CallEventPayload::mutable_ai_result() {
+  std::string* _s = _internal_mutable_ai_result();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.ai_result)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_ai_result() const {
+  return _impl_.ai_result_.Get();
+}
+inline void CallEventPayload::_internal_set_ai_result(const std::string& value) {
+  
+  _impl_.ai_result_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_ai_result() {
+  
+  return _impl_.ai_result_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_ai_result() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.ai_result)
+  return _impl_.ai_result_.Release();
+}
+inline void CallEventPayload::set_allocated_ai_result(std::string* ai_result) {
+  if (ai_result != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.ai_result_.SetAllocated(ai_result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ai_result_.IsDefault()) {
+    _impl_.ai_result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.ai_result)
+}
+
+// string ai_error = 26;
+inline void CallEventPayload::clear_ai_error() {
+  _impl_.ai_error_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::ai_error() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.ai_error)
+  return _internal_ai_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_ai_error(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ai_error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.ai_error)
+}
+inline std::string* CallEventPayload::mutable_ai_error() {
+  std::string* _s = _internal_mutable_ai_error();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.ai_error)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_ai_error() const {
+  return _impl_.ai_error_.Get();
+}
+inline void CallEventPayload::_internal_set_ai_error(const std::string& value) {
+  
+  _impl_.ai_error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_ai_error() {
+  
+  return _impl_.ai_error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_ai_error() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.ai_error)
+  return _impl_.ai_error_.Release();
+}
+inline void CallEventPayload::set_allocated_ai_error(std::string* ai_error) {
+  if (ai_error != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.ai_error_.SetAllocated(ai_error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ai_error_.IsDefault()) {
+    _impl_.ai_error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.ai_error)
+}
+
+// string result = 27;
+inline void CallEventPayload::clear_result() {
+  _impl_.result_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::result() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.result)
+  return _internal_result();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_result(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.result_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.result)
+}
+inline std::string* CallEventPayload::mutable_result() {
+  std::string* _s = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.result)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_result() const {
+  return _impl_.result_.Get();
+}
+inline void CallEventPayload::_internal_set_result(const std::string& value) {
+  
+  _impl_.result_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_result() {
+  
+  return _impl_.result_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_result() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.result)
+  return _impl_.result_.Release();
+}
+inline void CallEventPayload::set_allocated_result(std::string* result) {
+  if (result != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.result_.SetAllocated(result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.result_.IsDefault()) {
+    _impl_.result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.result)
+}
+
+// string cause = 28;
+inline void CallEventPayload::clear_cause() {
+  _impl_.cause_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::cause() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.cause)
+  return _internal_cause();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_cause(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.cause_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.cause)
+}
+inline std::string* CallEventPayload::mutable_cause() {
+  std::string* _s = _internal_mutable_cause();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.cause)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_cause() const {
+  return _impl_.cause_.Get();
+}
+inline void CallEventPayload::_internal_set_cause(const std::string& value) {
+  
+  _impl_.cause_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_cause() {
+  
+  return _impl_.cause_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_cause() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.cause)
+  return _impl_.cause_.Release();
+}
+inline void CallEventPayload::set_allocated_cause(std::string* cause) {
+  if (cause != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.cause_.SetAllocated(cause, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.cause_.IsDefault()) {
+    _impl_.cause_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.cause)
+}
+
+// optional bool cdr = 29;
+inline bool CallEventPayload::_internal_has_cdr() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CallEventPayload::has_cdr() const {
+  return _internal_has_cdr();
+}
+inline void CallEventPayload::clear_cdr() {
+  _impl_.cdr_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool CallEventPayload::_internal_cdr() const {
+  return _impl_.cdr_;
+}
+inline bool CallEventPayload::cdr() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.cdr)
+  return _internal_cdr();
+}
+inline void CallEventPayload::_internal_set_cdr(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.cdr_ = value;
+}
+inline void CallEventPayload::set_cdr(bool value) {
+  _internal_set_cdr(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.cdr)
+}
+
+// bool notification_hangup = 30;
+inline void CallEventPayload::clear_notification_hangup() {
+  _impl_.notification_hangup_ = false;
+}
+inline bool CallEventPayload::_internal_notification_hangup() const {
+  return _impl_.notification_hangup_;
+}
+inline bool CallEventPayload::notification_hangup() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.notification_hangup)
+  return _internal_notification_hangup();
+}
+inline void CallEventPayload::_internal_set_notification_hangup(bool value) {
+  
+  _impl_.notification_hangup_ = value;
+}
+inline void CallEventPayload::set_notification_hangup(bool value) {
+  _internal_set_notification_hangup(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.notification_hangup)
+}
+
+// string amd_result = 31;
+inline void CallEventPayload::clear_amd_result() {
+  _impl_.amd_result_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::amd_result() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.amd_result)
+  return _internal_amd_result();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_amd_result(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.amd_result_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.amd_result)
+}
+inline std::string* CallEventPayload::mutable_amd_result() {
+  std::string* _s = _internal_mutable_amd_result();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.amd_result)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_amd_result() const {
+  return _impl_.amd_result_.Get();
+}
+inline void CallEventPayload::_internal_set_amd_result(const std::string& value) {
+  
+  _impl_.amd_result_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_amd_result() {
+  
+  return _impl_.amd_result_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_amd_result() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.amd_result)
+  return _impl_.amd_result_.Release();
+}
+inline void CallEventPayload::set_allocated_amd_result(std::string* amd_result) {
+  if (amd_result != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.amd_result_.SetAllocated(amd_result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.amd_result_.IsDefault()) {
+    _impl_.amd_result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.amd_result)
+}
+
+// string amd_cause = 32;
+inline void CallEventPayload::clear_amd_cause() {
+  _impl_.amd_cause_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::amd_cause() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.amd_cause)
+  return _internal_amd_cause();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_amd_cause(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.amd_cause_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.amd_cause)
+}
+inline std::string* CallEventPayload::mutable_amd_cause() {
+  std::string* _s = _internal_mutable_amd_cause();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.amd_cause)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_amd_cause() const {
+  return _impl_.amd_cause_.Get();
+}
+inline void CallEventPayload::_internal_set_amd_cause(const std::string& value) {
+  
+  _impl_.amd_cause_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_amd_cause() {
+  
+  return _impl_.amd_cause_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_amd_cause() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.amd_cause)
+  return _impl_.amd_cause_.Release();
+}
+inline void CallEventPayload::set_allocated_amd_cause(std::string* amd_cause) {
+  if (amd_cause != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.amd_cause_.SetAllocated(amd_cause, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.amd_cause_.IsDefault()) {
+    _impl_.amd_cause_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.amd_cause)
+}
+
+// string record_start = 33;
+inline void CallEventPayload::clear_record_start() {
+  _impl_.record_start_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::record_start() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.record_start)
+  return _internal_record_start();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_record_start(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.record_start_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.record_start)
+}
+inline std::string* CallEventPayload::mutable_record_start() {
+  std::string* _s = _internal_mutable_record_start();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.record_start)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_record_start() const {
+  return _impl_.record_start_.Get();
+}
+inline void CallEventPayload::_internal_set_record_start(const std::string& value) {
+  
+  _impl_.record_start_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_record_start() {
+  
+  return _impl_.record_start_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_record_start() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.record_start)
+  return _impl_.record_start_.Release();
+}
+inline void CallEventPayload::set_allocated_record_start(std::string* record_start) {
+  if (record_start != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.record_start_.SetAllocated(record_start, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.record_start_.IsDefault()) {
+    _impl_.record_start_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.record_start)
+}
+
+// string record_stop = 34;
+inline void CallEventPayload::clear_record_stop() {
+  _impl_.record_stop_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::record_stop() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.record_stop)
+  return _internal_record_stop();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_record_stop(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.record_stop_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.record_stop)
+}
+inline std::string* CallEventPayload::mutable_record_stop() {
+  std::string* _s = _internal_mutable_record_stop();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.record_stop)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_record_stop() const {
+  return _impl_.record_stop_.Get();
+}
+inline void CallEventPayload::_internal_set_record_stop(const std::string& value) {
+  
+  _impl_.record_stop_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_record_stop() {
+  
+  return _impl_.record_stop_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_record_stop() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.record_stop)
+  return _impl_.record_stop_.Release();
+}
+inline void CallEventPayload::set_allocated_record_stop(std::string* record_stop) {
+  if (record_stop != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.record_stop_.SetAllocated(record_stop, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.record_stop_.IsDefault()) {
+    _impl_.record_stop_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.record_stop)
+}
+
+// string transfer_to = 35;
+inline void CallEventPayload::clear_transfer_to() {
+  _impl_.transfer_to_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::transfer_to() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.transfer_to)
+  return _internal_transfer_to();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_transfer_to(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.transfer_to_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.transfer_to)
+}
+inline std::string* CallEventPayload::mutable_transfer_to() {
+  std::string* _s = _internal_mutable_transfer_to();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.transfer_to)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_transfer_to() const {
+  return _impl_.transfer_to_.Get();
+}
+inline void CallEventPayload::_internal_set_transfer_to(const std::string& value) {
+  
+  _impl_.transfer_to_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_transfer_to() {
+  
+  return _impl_.transfer_to_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_transfer_to() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.transfer_to)
+  return _impl_.transfer_to_.Release();
+}
+inline void CallEventPayload::set_allocated_transfer_to(std::string* transfer_to) {
+  if (transfer_to != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.transfer_to_.SetAllocated(transfer_to, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.transfer_to_.IsDefault()) {
+    _impl_.transfer_to_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.transfer_to)
+}
+
+// string transfer_from = 36;
+inline void CallEventPayload::clear_transfer_from() {
+  _impl_.transfer_from_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::transfer_from() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.transfer_from)
+  return _internal_transfer_from();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_transfer_from(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.transfer_from_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.transfer_from)
+}
+inline std::string* CallEventPayload::mutable_transfer_from() {
+  std::string* _s = _internal_mutable_transfer_from();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.transfer_from)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_transfer_from() const {
+  return _impl_.transfer_from_.Get();
+}
+inline void CallEventPayload::_internal_set_transfer_from(const std::string& value) {
+  
+  _impl_.transfer_from_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_transfer_from() {
+  
+  return _impl_.transfer_from_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_transfer_from() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.transfer_from)
+  return _impl_.transfer_from_.Release();
+}
+inline void CallEventPayload::set_allocated_transfer_from(std::string* transfer_from) {
+  if (transfer_from != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.transfer_from_.SetAllocated(transfer_from, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.transfer_from_.IsDefault()) {
+    _impl_.transfer_from_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.transfer_from)
+}
+
+// string transfer_to_agent = 37;
+inline void CallEventPayload::clear_transfer_to_agent() {
+  _impl_.transfer_to_agent_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::transfer_to_agent() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.transfer_to_agent)
+  return _internal_transfer_to_agent();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_transfer_to_agent(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.transfer_to_agent_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.transfer_to_agent)
+}
+inline std::string* CallEventPayload::mutable_transfer_to_agent() {
+  std::string* _s = _internal_mutable_transfer_to_agent();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.transfer_to_agent)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_transfer_to_agent() const {
+  return _impl_.transfer_to_agent_.Get();
+}
+inline void CallEventPayload::_internal_set_transfer_to_agent(const std::string& value) {
+  
+  _impl_.transfer_to_agent_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_transfer_to_agent() {
+  
+  return _impl_.transfer_to_agent_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_transfer_to_agent() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.transfer_to_agent)
+  return _impl_.transfer_to_agent_.Release();
+}
+inline void CallEventPayload::set_allocated_transfer_to_agent(std::string* transfer_to_agent) {
+  if (transfer_to_agent != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.transfer_to_agent_.SetAllocated(transfer_to_agent, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.transfer_to_agent_.IsDefault()) {
+    _impl_.transfer_to_agent_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.transfer_to_agent)
+}
+
+// string transfer_from_attempt = 38;
+inline void CallEventPayload::clear_transfer_from_attempt() {
+  _impl_.transfer_from_attempt_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::transfer_from_attempt() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.transfer_from_attempt)
+  return _internal_transfer_from_attempt();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_transfer_from_attempt(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.transfer_from_attempt_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.transfer_from_attempt)
+}
+inline std::string* CallEventPayload::mutable_transfer_from_attempt() {
+  std::string* _s = _internal_mutable_transfer_from_attempt();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.transfer_from_attempt)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_transfer_from_attempt() const {
+  return _impl_.transfer_from_attempt_.Get();
+}
+inline void CallEventPayload::_internal_set_transfer_from_attempt(const std::string& value) {
+  
+  _impl_.transfer_from_attempt_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_transfer_from_attempt() {
+  
+  return _impl_.transfer_from_attempt_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_transfer_from_attempt() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.transfer_from_attempt)
+  return _impl_.transfer_from_attempt_.Release();
+}
+inline void CallEventPayload::set_allocated_transfer_from_attempt(std::string* transfer_from_attempt) {
+  if (transfer_from_attempt != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.transfer_from_attempt_.SetAllocated(transfer_from_attempt, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.transfer_from_attempt_.IsDefault()) {
+    _impl_.transfer_from_attempt_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.transfer_from_attempt)
+}
+
+// string transfer_to_attempt = 39;
+inline void CallEventPayload::clear_transfer_to_attempt() {
+  _impl_.transfer_to_attempt_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::transfer_to_attempt() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.transfer_to_attempt)
+  return _internal_transfer_to_attempt();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_transfer_to_attempt(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.transfer_to_attempt_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.transfer_to_attempt)
+}
+inline std::string* CallEventPayload::mutable_transfer_to_attempt() {
+  std::string* _s = _internal_mutable_transfer_to_attempt();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.transfer_to_attempt)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_transfer_to_attempt() const {
+  return _impl_.transfer_to_attempt_.Get();
+}
+inline void CallEventPayload::_internal_set_transfer_to_attempt(const std::string& value) {
+  
+  _impl_.transfer_to_attempt_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_transfer_to_attempt() {
+  
+  return _impl_.transfer_to_attempt_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_transfer_to_attempt() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.transfer_to_attempt)
+  return _impl_.transfer_to_attempt_.Release();
+}
+inline void CallEventPayload::set_allocated_transfer_to_attempt(std::string* transfer_to_attempt) {
+  if (transfer_to_attempt != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.transfer_to_attempt_.SetAllocated(transfer_to_attempt, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.transfer_to_attempt_.IsDefault()) {
+    _impl_.transfer_to_attempt_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.transfer_to_attempt)
+}
+
+// string talk_sec = 40;
+inline void CallEventPayload::clear_talk_sec() {
+  _impl_.talk_sec_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::talk_sec() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.talk_sec)
+  return _internal_talk_sec();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_talk_sec(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.talk_sec_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.talk_sec)
+}
+inline std::string* CallEventPayload::mutable_talk_sec() {
+  std::string* _s = _internal_mutable_talk_sec();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.talk_sec)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_talk_sec() const {
+  return _impl_.talk_sec_.Get();
+}
+inline void CallEventPayload::_internal_set_talk_sec(const std::string& value) {
+  
+  _impl_.talk_sec_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_talk_sec() {
+  
+  return _impl_.talk_sec_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_talk_sec() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.talk_sec)
+  return _impl_.talk_sec_.Release();
+}
+inline void CallEventPayload::set_allocated_talk_sec(std::string* talk_sec) {
+  if (talk_sec != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.talk_sec_.SetAllocated(talk_sec, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.talk_sec_.IsDefault()) {
+    _impl_.talk_sec_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.talk_sec)
+}
+
+// string hangup_by = 41;
+inline void CallEventPayload::clear_hangup_by() {
+  _impl_.hangup_by_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::hangup_by() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.hangup_by)
+  return _internal_hangup_by();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_hangup_by(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hangup_by_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.hangup_by)
+}
+inline std::string* CallEventPayload::mutable_hangup_by() {
+  std::string* _s = _internal_mutable_hangup_by();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.hangup_by)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_hangup_by() const {
+  return _impl_.hangup_by_.Get();
+}
+inline void CallEventPayload::_internal_set_hangup_by(const std::string& value) {
+  
+  _impl_.hangup_by_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_hangup_by() {
+  
+  return _impl_.hangup_by_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_hangup_by() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.hangup_by)
+  return _impl_.hangup_by_.Release();
+}
+inline void CallEventPayload::set_allocated_hangup_by(std::string* hangup_by) {
+  if (hangup_by != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.hangup_by_.SetAllocated(hangup_by, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hangup_by_.IsDefault()) {
+    _impl_.hangup_by_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.hangup_by)
+}
+
+// string reporting_at = 42;
+inline void CallEventPayload::clear_reporting_at() {
+  _impl_.reporting_at_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::reporting_at() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.reporting_at)
+  return _internal_reporting_at();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_reporting_at(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.reporting_at_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.reporting_at)
+}
+inline std::string* CallEventPayload::mutable_reporting_at() {
+  std::string* _s = _internal_mutable_reporting_at();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.reporting_at)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_reporting_at() const {
+  return _impl_.reporting_at_.Get();
+}
+inline void CallEventPayload::_internal_set_reporting_at(const std::string& value) {
+  
+  _impl_.reporting_at_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_reporting_at() {
+  
+  return _impl_.reporting_at_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_reporting_at() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.reporting_at)
+  return _impl_.reporting_at_.Release();
+}
+inline void CallEventPayload::set_allocated_reporting_at(std::string* reporting_at) {
+  if (reporting_at != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.reporting_at_.SetAllocated(reporting_at, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reporting_at_.IsDefault()) {
+    _impl_.reporting_at_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.reporting_at)
+}
+
+// bool originate_success = 43;
+inline void CallEventPayload::clear_originate_success() {
+  _impl_.originate_success_ = false;
+}
+inline bool CallEventPayload::_internal_originate_success() const {
+  return _impl_.originate_success_;
+}
+inline bool CallEventPayload::originate_success() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.originate_success)
+  return _internal_originate_success();
+}
+inline void CallEventPayload::_internal_set_originate_success(bool value) {
+  
+  _impl_.originate_success_ = value;
+}
+inline void CallEventPayload::set_originate_success(bool value) {
+  _internal_set_originate_success(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.originate_success)
+}
+
+// int32 sip = 44;
+inline void CallEventPayload::clear_sip() {
+  _impl_.sip_ = 0;
+}
+inline int32_t CallEventPayload::_internal_sip() const {
+  return _impl_.sip_;
+}
+inline int32_t CallEventPayload::sip() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.sip)
+  return _internal_sip();
+}
+inline void CallEventPayload::_internal_set_sip(int32_t value) {
+  
+  _impl_.sip_ = value;
+}
+inline void CallEventPayload::set_sip(int32_t value) {
+  _internal_set_sip(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.sip)
+}
+
+// repeated string tags = 45;
+inline int CallEventPayload::_internal_tags_size() const {
+  return _impl_.tags_.size();
+}
+inline int CallEventPayload::tags_size() const {
+  return _internal_tags_size();
+}
+inline void CallEventPayload::clear_tags() {
+  _impl_.tags_.Clear();
+}
+inline std::string* CallEventPayload::add_tags() {
+  std::string* _s = _internal_add_tags();
+  // @@protoc_insertion_point(field_add_mutable:fs.CallEventPayload.tags)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_tags(int index) const {
+  return _impl_.tags_.Get(index);
+}
+inline const std::string& CallEventPayload::tags(int index) const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.tags)
+  return _internal_tags(index);
+}
+inline std::string* CallEventPayload::mutable_tags(int index) {
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.tags)
+  return _impl_.tags_.Mutable(index);
+}
+inline void CallEventPayload::set_tags(int index, const std::string& value) {
+  _impl_.tags_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.tags)
+}
+inline void CallEventPayload::set_tags(int index, std::string&& value) {
+  _impl_.tags_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.tags)
+}
+inline void CallEventPayload::set_tags(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.tags_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:fs.CallEventPayload.tags)
+}
+inline void CallEventPayload::set_tags(int index, const char* value, size_t size) {
+  _impl_.tags_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:fs.CallEventPayload.tags)
+}
+inline std::string* CallEventPayload::_internal_add_tags() {
+  return _impl_.tags_.Add();
+}
+inline void CallEventPayload::add_tags(const std::string& value) {
+  _impl_.tags_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:fs.CallEventPayload.tags)
+}
+inline void CallEventPayload::add_tags(std::string&& value) {
+  _impl_.tags_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:fs.CallEventPayload.tags)
+}
+inline void CallEventPayload::add_tags(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.tags_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:fs.CallEventPayload.tags)
+}
+inline void CallEventPayload::add_tags(const char* value, size_t size) {
+  _impl_.tags_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:fs.CallEventPayload.tags)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CallEventPayload::tags() const {
+  // @@protoc_insertion_point(field_list:fs.CallEventPayload.tags)
+  return _impl_.tags_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CallEventPayload::mutable_tags() {
+  // @@protoc_insertion_point(field_mutable_list:fs.CallEventPayload.tags)
+  return &_impl_.tags_;
+}
+
+// repeated int64 schema_ids = 46;
+inline int CallEventPayload::_internal_schema_ids_size() const {
+  return _impl_.schema_ids_.size();
+}
+inline int CallEventPayload::schema_ids_size() const {
+  return _internal_schema_ids_size();
+}
+inline void CallEventPayload::clear_schema_ids() {
+  _impl_.schema_ids_.Clear();
+}
+inline int64_t CallEventPayload::_internal_schema_ids(int index) const {
+  return _impl_.schema_ids_.Get(index);
+}
+inline int64_t CallEventPayload::schema_ids(int index) const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.schema_ids)
+  return _internal_schema_ids(index);
+}
+inline void CallEventPayload::set_schema_ids(int index, int64_t value) {
+  _impl_.schema_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.schema_ids)
+}
+inline void CallEventPayload::_internal_add_schema_ids(int64_t value) {
+  _impl_.schema_ids_.Add(value);
+}
+inline void CallEventPayload::add_schema_ids(int64_t value) {
+  _internal_add_schema_ids(value);
+  // @@protoc_insertion_point(field_add:fs.CallEventPayload.schema_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+CallEventPayload::_internal_schema_ids() const {
+  return _impl_.schema_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+CallEventPayload::schema_ids() const {
+  // @@protoc_insertion_point(field_list:fs.CallEventPayload.schema_ids)
+  return _internal_schema_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+CallEventPayload::_internal_mutable_schema_ids() {
+  return &_impl_.schema_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+CallEventPayload::mutable_schema_ids() {
+  // @@protoc_insertion_point(field_mutable_list:fs.CallEventPayload.schema_ids)
+  return _internal_mutable_schema_ids();
+}
+
+// string amd_ai_result = 47;
+inline void CallEventPayload::clear_amd_ai_result() {
+  _impl_.amd_ai_result_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::amd_ai_result() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.amd_ai_result)
+  return _internal_amd_ai_result();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_amd_ai_result(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.amd_ai_result_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.amd_ai_result)
+}
+inline std::string* CallEventPayload::mutable_amd_ai_result() {
+  std::string* _s = _internal_mutable_amd_ai_result();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.amd_ai_result)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_amd_ai_result() const {
+  return _impl_.amd_ai_result_.Get();
+}
+inline void CallEventPayload::_internal_set_amd_ai_result(const std::string& value) {
+  
+  _impl_.amd_ai_result_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_amd_ai_result() {
+  
+  return _impl_.amd_ai_result_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_amd_ai_result() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.amd_ai_result)
+  return _impl_.amd_ai_result_.Release();
+}
+inline void CallEventPayload::set_allocated_amd_ai_result(std::string* amd_ai_result) {
+  if (amd_ai_result != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.amd_ai_result_.SetAllocated(amd_ai_result, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.amd_ai_result_.IsDefault()) {
+    _impl_.amd_ai_result_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.amd_ai_result)
+}
+
+// bool amd_ai_positive = 48;
+inline void CallEventPayload::clear_amd_ai_positive() {
+  _impl_.amd_ai_positive_ = false;
+}
+inline bool CallEventPayload::_internal_amd_ai_positive() const {
+  return _impl_.amd_ai_positive_;
+}
+inline bool CallEventPayload::amd_ai_positive() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.amd_ai_positive)
+  return _internal_amd_ai_positive();
+}
+inline void CallEventPayload::_internal_set_amd_ai_positive(bool value) {
+  
+  _impl_.amd_ai_positive_ = value;
+}
+inline void CallEventPayload::set_amd_ai_positive(bool value) {
+  _internal_set_amd_ai_positive(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.amd_ai_positive)
+}
+
+// repeated string amd_ai_logs = 49;
+inline int CallEventPayload::_internal_amd_ai_logs_size() const {
+  return _impl_.amd_ai_logs_.size();
+}
+inline int CallEventPayload::amd_ai_logs_size() const {
+  return _internal_amd_ai_logs_size();
+}
+inline void CallEventPayload::clear_amd_ai_logs() {
+  _impl_.amd_ai_logs_.Clear();
+}
+inline std::string* CallEventPayload::add_amd_ai_logs() {
+  std::string* _s = _internal_add_amd_ai_logs();
+  // @@protoc_insertion_point(field_add_mutable:fs.CallEventPayload.amd_ai_logs)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_amd_ai_logs(int index) const {
+  return _impl_.amd_ai_logs_.Get(index);
+}
+inline const std::string& CallEventPayload::amd_ai_logs(int index) const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.amd_ai_logs)
+  return _internal_amd_ai_logs(index);
+}
+inline std::string* CallEventPayload::mutable_amd_ai_logs(int index) {
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.amd_ai_logs)
+  return _impl_.amd_ai_logs_.Mutable(index);
+}
+inline void CallEventPayload::set_amd_ai_logs(int index, const std::string& value) {
+  _impl_.amd_ai_logs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.amd_ai_logs)
+}
+inline void CallEventPayload::set_amd_ai_logs(int index, std::string&& value) {
+  _impl_.amd_ai_logs_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.amd_ai_logs)
+}
+inline void CallEventPayload::set_amd_ai_logs(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.amd_ai_logs_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:fs.CallEventPayload.amd_ai_logs)
+}
+inline void CallEventPayload::set_amd_ai_logs(int index, const char* value, size_t size) {
+  _impl_.amd_ai_logs_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:fs.CallEventPayload.amd_ai_logs)
+}
+inline std::string* CallEventPayload::_internal_add_amd_ai_logs() {
+  return _impl_.amd_ai_logs_.Add();
+}
+inline void CallEventPayload::add_amd_ai_logs(const std::string& value) {
+  _impl_.amd_ai_logs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:fs.CallEventPayload.amd_ai_logs)
+}
+inline void CallEventPayload::add_amd_ai_logs(std::string&& value) {
+  _impl_.amd_ai_logs_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:fs.CallEventPayload.amd_ai_logs)
+}
+inline void CallEventPayload::add_amd_ai_logs(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.amd_ai_logs_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:fs.CallEventPayload.amd_ai_logs)
+}
+inline void CallEventPayload::add_amd_ai_logs(const char* value, size_t size) {
+  _impl_.amd_ai_logs_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:fs.CallEventPayload.amd_ai_logs)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+CallEventPayload::amd_ai_logs() const {
+  // @@protoc_insertion_point(field_list:fs.CallEventPayload.amd_ai_logs)
+  return _impl_.amd_ai_logs_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+CallEventPayload::mutable_amd_ai_logs() {
+  // @@protoc_insertion_point(field_mutable_list:fs.CallEventPayload.amd_ai_logs)
+  return &_impl_.amd_ai_logs_;
+}
+
+// string hangup_phrase = 50;
+inline void CallEventPayload::clear_hangup_phrase() {
+  _impl_.hangup_phrase_.ClearToEmpty();
+}
+inline const std::string& CallEventPayload::hangup_phrase() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.hangup_phrase)
+  return _internal_hangup_phrase();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CallEventPayload::set_hangup_phrase(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.hangup_phrase_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.hangup_phrase)
+}
+inline std::string* CallEventPayload::mutable_hangup_phrase() {
+  std::string* _s = _internal_mutable_hangup_phrase();
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.hangup_phrase)
+  return _s;
+}
+inline const std::string& CallEventPayload::_internal_hangup_phrase() const {
+  return _impl_.hangup_phrase_.Get();
+}
+inline void CallEventPayload::_internal_set_hangup_phrase(const std::string& value) {
+  
+  _impl_.hangup_phrase_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::_internal_mutable_hangup_phrase() {
+  
+  return _impl_.hangup_phrase_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CallEventPayload::release_hangup_phrase() {
+  // @@protoc_insertion_point(field_release:fs.CallEventPayload.hangup_phrase)
+  return _impl_.hangup_phrase_.Release();
+}
+inline void CallEventPayload::set_allocated_hangup_phrase(std::string* hangup_phrase) {
+  if (hangup_phrase != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.hangup_phrase_.SetAllocated(hangup_phrase, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hangup_phrase_.IsDefault()) {
+    _impl_.hangup_phrase_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.CallEventPayload.hangup_phrase)
+}
+
+// repeated .fs.CallEventPayload.Call calls = 51;
+inline int CallEventPayload::_internal_calls_size() const {
+  return _impl_.calls_.size();
+}
+inline int CallEventPayload::calls_size() const {
+  return _internal_calls_size();
+}
+inline void CallEventPayload::clear_calls() {
+  _impl_.calls_.Clear();
+}
+inline ::fs::CallEventPayload_Call* CallEventPayload::mutable_calls(int index) {
+  // @@protoc_insertion_point(field_mutable:fs.CallEventPayload.calls)
+  return _impl_.calls_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::CallEventPayload_Call >*
+CallEventPayload::mutable_calls() {
+  // @@protoc_insertion_point(field_mutable_list:fs.CallEventPayload.calls)
+  return &_impl_.calls_;
+}
+inline const ::fs::CallEventPayload_Call& CallEventPayload::_internal_calls(int index) const {
+  return _impl_.calls_.Get(index);
+}
+inline const ::fs::CallEventPayload_Call& CallEventPayload::calls(int index) const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.calls)
+  return _internal_calls(index);
+}
+inline ::fs::CallEventPayload_Call* CallEventPayload::_internal_add_calls() {
+  return _impl_.calls_.Add();
+}
+inline ::fs::CallEventPayload_Call* CallEventPayload::add_calls() {
+  ::fs::CallEventPayload_Call* _add = _internal_add_calls();
+  // @@protoc_insertion_point(field_add:fs.CallEventPayload.calls)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::CallEventPayload_Call >&
+CallEventPayload::calls() const {
+  // @@protoc_insertion_point(field_list:fs.CallEventPayload.calls)
+  return _impl_.calls_;
+}
+
+// bool ai_local = 52;
+inline void CallEventPayload::clear_ai_local() {
+  _impl_.ai_local_ = false;
+}
+inline bool CallEventPayload::_internal_ai_local() const {
+  return _impl_.ai_local_;
+}
+inline bool CallEventPayload::ai_local() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.ai_local)
+  return _internal_ai_local();
+}
+inline void CallEventPayload::_internal_set_ai_local(bool value) {
+  
+  _impl_.ai_local_ = value;
+}
+inline void CallEventPayload::set_ai_local(bool value) {
+  _internal_set_ai_local(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.ai_local)
+}
+
+// bool ai_partial = 53;
+inline void CallEventPayload::clear_ai_partial() {
+  _impl_.ai_partial_ = false;
+}
+inline bool CallEventPayload::_internal_ai_partial() const {
+  return _impl_.ai_partial_;
+}
+inline bool CallEventPayload::ai_partial() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.ai_partial)
+  return _internal_ai_partial();
+}
+inline void CallEventPayload::_internal_set_ai_partial(bool value) {
+  
+  _impl_.ai_partial_ = value;
+}
+inline void CallEventPayload::set_ai_partial(bool value) {
+  _internal_set_ai_partial(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.ai_partial)
+}
+
+// float ai_confidence = 54;
+inline void CallEventPayload::clear_ai_confidence() {
+  _impl_.ai_confidence_ = 0;
+}
+inline float CallEventPayload::_internal_ai_confidence() const {
+  return _impl_.ai_confidence_;
+}
+inline float CallEventPayload::ai_confidence() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.ai_confidence)
+  return _internal_ai_confidence();
+}
+inline void CallEventPayload::_internal_set_ai_confidence(float value) {
+  
+  _impl_.ai_confidence_ = value;
+}
+inline void CallEventPayload::set_ai_confidence(float value) {
+  _internal_set_ai_confidence(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.ai_confidence)
+}
 
+// int64 ai_elapsed_ms = 55;
+inline void CallEventPayload::clear_ai_elapsed_ms() {
+  _impl_.ai_elapsed_ms_ = int64_t{0};
+}
+inline int64_t CallEventPayload::_internal_ai_elapsed_ms() const {
+  return _impl_.ai_elapsed_ms_;
+}
+inline int64_t CallEventPayload::ai_elapsed_ms() const {
+  // @@protoc_insertion_point(field_get:fs.CallEventPayload.ai_elapsed_ms)
+  return _internal_ai_elapsed_ms();
+}
+inline void CallEventPayload::_internal_set_ai_elapsed_ms(int64_t value) {
+  
+  _impl_.ai_elapsed_ms_ = value;
+}
+inline void CallEventPayload::set_ai_elapsed_ms(int64_t value) {
+  _internal_set_ai_elapsed_ms(value);
+  // @@protoc_insertion_point(field_set:fs.CallEventPayload.ai_elapsed_ms)
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 // BreakParkRequest
@@ -10824,6 +17344,388 @@ inline void OriginateResponse::set_error_code(int32_t value) {
 
 // -------------------------------------------------------------------
 
+// OriginateAsyncResponse
+
+// string uuid = 1;
+inline void OriginateAsyncResponse::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+}
+inline const std::string& OriginateAsyncResponse::uuid() const {
+  // @@protoc_insertion_point(field_get:fs.OriginateAsyncResponse.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OriginateAsyncResponse::set_uuid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:fs.OriginateAsyncResponse.uuid)
+}
+inline std::string* OriginateAsyncResponse::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:fs.OriginateAsyncResponse.uuid)
+  return _s;
+}
+inline const std::string& OriginateAsyncResponse::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void OriginateAsyncResponse::_internal_set_uuid(const std::string& value) {
+  
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OriginateAsyncResponse::_internal_mutable_uuid() {
+  
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OriginateAsyncResponse::release_uuid() {
+  // @@protoc_insertion_point(field_release:fs.OriginateAsyncResponse.uuid)
+  return _impl_.uuid_.Release();
+}
+inline void OriginateAsyncResponse::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:fs.OriginateAsyncResponse.uuid)
+}
+
+// .fs.OriginateAsyncResponse.State state = 2;
+inline void OriginateAsyncResponse::clear_state() {
+  _impl_.state_ = 0;
+}
+inline ::fs::OriginateAsyncResponse_State OriginateAsyncResponse::_internal_state() const {
+  return static_cast< ::fs::OriginateAsyncResponse_State >(_impl_.state_);
+}
+inline ::fs::OriginateAsyncResponse_State OriginateAsyncResponse::state() const {
+  // @@protoc_insertion_point(field_get:fs.OriginateAsyncResponse.state)
+  return _internal_state();
+}
+inline void OriginateAsyncResponse::_internal_set_state(::fs::OriginateAsyncResponse_State value) {
+  
+  _impl_.state_ = value;
+}
+inline void OriginateAsyncResponse::set_state(::fs::OriginateAsyncResponse_State value) {
+  _internal_set_state(value);
+  // @@protoc_insertion_point(field_set:fs.OriginateAsyncResponse.state)
+}
+
+// .fs.ErrorExecute error = 3;
+inline bool OriginateAsyncResponse::_internal_has_error() const {
+  return this != internal_default_instance() && _impl_.error_ != nullptr;
+}
+inline bool OriginateAsyncResponse::has_error() const {
+  return _internal_has_error();
+}
+inline void OriginateAsyncResponse::clear_error() {
+  if (GetArenaForAllocation() == nullptr && _impl_.error_ != nullptr) {
+    delete _impl_.error_;
+  }
+  _impl_.error_ = nullptr;
+}
+inline const ::fs::ErrorExecute& OriginateAsyncResponse::_internal_error() const {
+  const ::fs::ErrorExecute* p = _impl_.error_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fs::ErrorExecute&>(
+      ::fs::_ErrorExecute_default_instance_);
+}
+inline const ::fs::ErrorExecute& OriginateAsyncResponse::error() const {
+  // @@protoc_insertion_point(field_get:fs.OriginateAsyncResponse.error)
+  return _internal_error();
+}
+inline void OriginateAsyncResponse::unsafe_arena_set_allocated_error(
+    ::fs::ErrorExecute* error) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.error_);
+  }
+  _impl_.error_ = error;
+  if (error) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fs.OriginateAsyncResponse.error)
+}
+inline ::fs::ErrorExecute* OriginateAsyncResponse::release_error() {
+  
+  ::fs::ErrorExecute* temp = _impl_.error_;
+  _impl_.error_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fs::ErrorExecute* OriginateAsyncResponse::unsafe_arena_release_error() {
+  // @@protoc_insertion_point(field_release:fs.OriginateAsyncResponse.error)
+  
+  ::fs::ErrorExecute* temp = _impl_.error_;
+  _impl_.error_ = nullptr;
+  return temp;
+}
+inline ::fs::ErrorExecute* OriginateAsyncResponse::_internal_mutable_error() {
+  
+  if (_impl_.error_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fs::ErrorExecute>(GetArenaForAllocation());
+    _impl_.error_ = p;
+  }
+  return _impl_.error_;
+}
+inline ::fs::ErrorExecute* OriginateAsyncResponse::mutable_error() {
+  ::fs::ErrorExecute* _msg = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:fs.OriginateAsyncResponse.error)
+  return _msg;
+}
+inline void OriginateAsyncResponse::set_allocated_error(::fs::ErrorExecute* error) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.error_;
+  }
+  if (error) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(error);
+    if (message_arena != submessage_arena) {
+      error = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, error, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.error_ = error;
+  // @@protoc_insertion_point(field_set_allocated:fs.OriginateAsyncResponse.error)
+}
+
+// int32 error_code = 4;
+inline void OriginateAsyncResponse::clear_error_code() {
+  _impl_.error_code_ = 0;
+}
+inline int32_t OriginateAsyncResponse::_internal_error_code() const {
+  return _impl_.error_code_;
+}
+inline int32_t OriginateAsyncResponse::error_code() const {
+  // @@protoc_insertion_point(field_get:fs.OriginateAsyncResponse.error_code)
+  return _internal_error_code();
+}
+inline void OriginateAsyncResponse::_internal_set_error_code(int32_t value) {
+  
+  _impl_.error_code_ = value;
+}
+inline void OriginateAsyncResponse::set_error_code(int32_t value) {
+  _internal_set_error_code(value);
+  // @@protoc_insertion_point(field_set:fs.OriginateAsyncResponse.error_code)
+}
+
+// -------------------------------------------------------------------
+
+// OriginateBatchRequest
+
+// repeated .fs.OriginateRequest requests = 1;
+inline int OriginateBatchRequest::_internal_requests_size() const {
+  return _impl_.requests_.size();
+}
+inline int OriginateBatchRequest::requests_size() const {
+  return _internal_requests_size();
+}
+inline void OriginateBatchRequest::clear_requests() {
+  _impl_.requests_.Clear();
+}
+inline ::fs::OriginateRequest* OriginateBatchRequest::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:fs.OriginateBatchRequest.requests)
+  return _impl_.requests_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest >*
+OriginateBatchRequest::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:fs.OriginateBatchRequest.requests)
+  return &_impl_.requests_;
+}
+inline const ::fs::OriginateRequest& OriginateBatchRequest::_internal_requests(int index) const {
+  return _impl_.requests_.Get(index);
+}
+inline const ::fs::OriginateRequest& OriginateBatchRequest::requests(int index) const {
+  // @@protoc_insertion_point(field_get:fs.OriginateBatchRequest.requests)
+  return _internal_requests(index);
+}
+inline ::fs::OriginateRequest* OriginateBatchRequest::_internal_add_requests() {
+  return _impl_.requests_.Add();
+}
+inline ::fs::OriginateRequest* OriginateBatchRequest::add_requests() {
+  ::fs::OriginateRequest* _add = _internal_add_requests();
+  // @@protoc_insertion_point(field_add:fs.OriginateBatchRequest.requests)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::fs::OriginateRequest >&
+OriginateBatchRequest::requests() const {
+  // @@protoc_insertion_point(field_list:fs.OriginateBatchRequest.requests)
+  return _impl_.requests_;
+}
+
+// int32 concurrency = 2;
+inline void OriginateBatchRequest::clear_concurrency() {
+  _impl_.concurrency_ = 0;
+}
+inline int32_t OriginateBatchRequest::_internal_concurrency() const {
+  return _impl_.concurrency_;
+}
+inline int32_t OriginateBatchRequest::concurrency() const {
+  // @@protoc_insertion_point(field_get:fs.OriginateBatchRequest.concurrency)
+  return _internal_concurrency();
+}
+inline void OriginateBatchRequest::_internal_set_concurrency(int32_t value) {
+  
+  _impl_.concurrency_ = value;
+}
+inline void OriginateBatchRequest::set_concurrency(int32_t value) {
+  _internal_set_concurrency(value);
+  // @@protoc_insertion_point(field_set:fs.OriginateBatchRequest.concurrency)
+}
+
+// int32 rate = 3;
+inline void OriginateBatchRequest::clear_rate() {
+  _impl_.rate_ = 0;
+}
+inline int32_t OriginateBatchRequest::_internal_rate() const {
+  return _impl_.rate_;
+}
+inline int32_t OriginateBatchRequest::rate() const {
+  // @@protoc_insertion_point(field_get:fs.OriginateBatchRequest.rate)
+  return _internal_rate();
+}
+inline void OriginateBatchRequest::_internal_set_rate(int32_t value) {
+  
+  _impl_.rate_ = value;
+}
+inline void OriginateBatchRequest::set_rate(int32_t value) {
+  _internal_set_rate(value);
+  // @@protoc_insertion_point(field_set:fs.OriginateBatchRequest.rate)
+}
+
+// -------------------------------------------------------------------
+
+// OriginateBatchResponse
+
+// int32 index = 1;
+inline void OriginateBatchResponse::clear_index() {
+  _impl_.index_ = 0;
+}
+inline int32_t OriginateBatchResponse::_internal_index() const {
+  return _impl_.index_;
+}
+inline int32_t OriginateBatchResponse::index() const {
+  // @@protoc_insertion_point(field_get:fs.OriginateBatchResponse.index)
+  return _internal_index();
+}
+inline void OriginateBatchResponse::_internal_set_index(int32_t value) {
+  
+  _impl_.index_ = value;
+}
+inline void OriginateBatchResponse::set_index(int32_t value) {
+  _internal_set_index(value);
+  // @@protoc_insertion_point(field_set:fs.OriginateBatchResponse.index)
+}
+
+// .fs.OriginateResponse result = 2;
+inline bool OriginateBatchResponse::_internal_has_result() const {
+  return this != internal_default_instance() && _impl_.result_ != nullptr;
+}
+inline bool OriginateBatchResponse::has_result() const {
+  return _internal_has_result();
+}
+inline void OriginateBatchResponse::clear_result() {
+  if (GetArenaForAllocation() == nullptr && _impl_.result_ != nullptr) {
+    delete _impl_.result_;
+  }
+  _impl_.result_ = nullptr;
+}
+inline const ::fs::OriginateResponse& OriginateBatchResponse::_internal_result() const {
+  const ::fs::OriginateResponse* p = _impl_.result_;
+  return p != nullptr ? *p : reinterpret_cast<const ::fs::OriginateResponse&>(
+      ::fs::_OriginateResponse_default_instance_);
+}
+inline const ::fs::OriginateResponse& OriginateBatchResponse::result() const {
+  // @@protoc_insertion_point(field_get:fs.OriginateBatchResponse.result)
+  return _internal_result();
+}
+inline void OriginateBatchResponse::unsafe_arena_set_allocated_result(
+    ::fs::OriginateResponse* result) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.result_);
+  }
+  _impl_.result_ = result;
+  if (result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:fs.OriginateBatchResponse.result)
+}
+inline ::fs::OriginateResponse* OriginateBatchResponse::release_result() {
+  
+  ::fs::OriginateResponse* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::fs::OriginateResponse* OriginateBatchResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:fs.OriginateBatchResponse.result)
+  
+  ::fs::OriginateResponse* temp = _impl_.result_;
+  _impl_.result_ = nullptr;
+  return temp;
+}
+inline ::fs::OriginateResponse* OriginateBatchResponse::_internal_mutable_result() {
+  
+  if (_impl_.result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::fs::OriginateResponse>(GetArenaForAllocation());
+    _impl_.result_ = p;
+  }
+  return _impl_.result_;
+}
+inline ::fs::OriginateResponse* OriginateBatchResponse::mutable_result() {
+  ::fs::OriginateResponse* _msg = _internal_mutable_result();
+  // @@protoc_insertion_point(field_mutable:fs.OriginateBatchResponse.result)
+  return _msg;
+}
+inline void OriginateBatchResponse::set_allocated_result(::fs::OriginateResponse* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:fs.OriginateBatchResponse.result)
+}
+
+// -------------------------------------------------------------------
+
 // BridgeRequest
 
 // string leg_a_id = 1;
@@ -11503,6 +18405,30 @@ inline void HangupMatchingVarsResponse::set_count(int32_t value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -11520,6 +18446,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::fs::OriginateRequest_Strategy>() {
   return ::fs::OriginateRequest_Strategy_descriptor();
 }
+template <> struct is_proto_enum< ::fs::OriginateAsyncResponse_State> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::fs::OriginateAsyncResponse_State>() {
+  return ::fs::OriginateAsyncResponse_State_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -40,7 +40,12 @@ struct StreamPCMRequest_MetadataDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StreamPCMRequest_MetadataDefaultTypeInternal _StreamPCMRequest_Metadata_default_instance_;
 PROTOBUF_CONSTEXPR StreamPCMRequest::StreamPCMRequest(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.vad_)*/0
+    /*decltype(_impl_.vads_)*/{}
+  , /*decltype(_impl_._vads_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.energies_)*/{}
+  , /*decltype(_impl_._energies_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.vad_)*/0
+  , /*decltype(_impl_.energy_)*/0
   , /*decltype(_impl_.data_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_._oneof_case_)*/{}} {}
@@ -57,6 +62,7 @@ PROTOBUF_CONSTEXPR StreamPCMResponse::StreamPCMResponse(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.results_)*/{}
   , /*decltype(_impl_.result_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.confidence_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct StreamPCMResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR StreamPCMResponseDefaultTypeInternal()
@@ -93,6 +99,9 @@ const uint32_t TableStruct_stream_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ::_pbi::kInvalidFieldOffsetTag,
   ::_pbi::kInvalidFieldOffsetTag,
   PROTOBUF_FIELD_OFFSET(::amd::StreamPCMRequest, _impl_.vad_),
+  PROTOBUF_FIELD_OFFSET(::amd::StreamPCMRequest, _impl_.vads_),
+  PROTOBUF_FIELD_OFFSET(::amd::StreamPCMRequest, _impl_.energy_),
+  PROTOBUF_FIELD_OFFSET(::amd::StreamPCMRequest, _impl_.energies_),
   PROTOBUF_FIELD_OFFSET(::amd::StreamPCMRequest, _impl_.data_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::amd::StreamPCMResponse, _internal_metadata_),
@@ -102,11 +111,12 @@ const uint32_t TableStruct_stream_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::amd::StreamPCMResponse, _impl_.result_),
   PROTOBUF_FIELD_OFFSET(::amd::StreamPCMResponse, _impl_.results_),
+  PROTOBUF_FIELD_OFFSET(::amd::StreamPCMResponse, _impl_.confidence_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::amd::StreamPCMRequest_Metadata)},
   { 11, -1, -1, sizeof(::amd::StreamPCMRequest)},
-  { 21, -1, -1, sizeof(::amd::StreamPCMResponse)},
+  { 24, -1, -1, sizeof(::amd::StreamPCMResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -116,21 +126,23 @@ static const ::_pb::Message* const file_default_instances[] = {
 };
 
 const char descriptor_table_protodef_stream_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\014stream.proto\022\003amd\"\317\001\n\020StreamPCMRequest"
+  "\n\014stream.proto\022\003amd\"\377\001\n\020StreamPCMRequest"
   "\0222\n\010metadata\030\001 \001(\0132\036.amd.StreamPCMReques"
   "t.MetadataH\000\022\017\n\005chunk\030\002 \001(\014H\000\022\013\n\003vad\030\003 \001"
-  "(\005\032a\n\010Metadata\022\021\n\tdomain_id\030\001 \001(\003\022\014\n\004nam"
-  "e\030\002 \001(\t\022\021\n\tmime_type\030\003 \001(\t\022\014\n\004uuid\030\004 \001(\t"
-  "\022\023\n\013sample_rate\030\005 \001(\005B\006\n\004data\"4\n\021StreamP"
-  "CMResponse\022\016\n\006result\030\001 \001(\t\022\017\n\007results\030\002 "
-  "\003(\t*3\n\020UploadStatusCode\022\013\n\007Unknown\020\000\022\006\n\002"
-  "Ok\020\001\022\n\n\006Failed\020\0022G\n\003Api\022@\n\tStreamPCM\022\025.a"
-  "md.StreamPCMRequest\032\026.amd.StreamPCMRespo"
-  "nse\"\000(\0010\001b\006proto3"
+  "(\005\022\014\n\004vads\030\004 \003(\005\022\016\n\006energy\030\005 \001(\005\022\020\n\010ener"
+  "gies\030\006 \003(\005\032a\n\010Metadata\022\021\n\tdomain_id\030\001 \001("
+  "\003\022\014\n\004name\030\002 \001(\t\022\021\n\tmime_type\030\003 \001(\t\022\014\n\004uu"
+  "id\030\004 \001(\t\022\023\n\013sample_rate\030\005 \001(\005B\006\n\004data\"H\n"
+  "\021StreamPCMResponse\022\016\n\006result\030\001 \001(\t\022\017\n\007re"
+  "sults\030\002 \003(\t\022\022\n\nconfidence\030\003 \001(\002*3\n\020Uploa"
+  "dStatusCode\022\013\n\007Unknown\020\000\022\006\n\002Ok\020\001\022\n\n\006Fail"
+  "ed\020\0022G\n\003Api\022@\n\tStreamPCM\022\025.amd.StreamPCM"
+  "Request\032\026.amd.StreamPCMResponse\"\000(\0010\001b\006p"
+  "roto3"
   ;
 static ::_pbi::once_flag descriptor_table_stream_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_stream_2eproto = {
-    false, false, 417, descriptor_table_protodef_stream_2eproto,
+    false, false, 485, descriptor_table_protodef_stream_2eproto,
     "stream.proto",
     &descriptor_table_stream_2eproto_once, nullptr, 0, 3,
     schemas, file_default_instances, TableStruct_stream_2eproto::offsets,
@@ -559,13 +571,20 @@ StreamPCMRequest::StreamPCMRequest(const StreamPCMRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   StreamPCMRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.vad_){}
+      decltype(_impl_.vads_){from._impl_.vads_}
+    , /*decltype(_impl_._vads_cached_byte_size_)*/{0}
+    , decltype(_impl_.energies_){from._impl_.energies_}
+    , /*decltype(_impl_._energies_cached_byte_size_)*/{0}
+    , decltype(_impl_.vad_){}
+    , decltype(_impl_.energy_){}
     , decltype(_impl_.data_){}
     , /*decltype(_impl_._cached_size_)*/{}
     , /*decltype(_impl_._oneof_case_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.vad_ = from._impl_.vad_;
+  ::memcpy(&_impl_.vad_, &from._impl_.vad_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.energy_) -
+    reinterpret_cast<char*>(&_impl_.vad_)) + sizeof(_impl_.energy_));
   clear_has_data();
   switch (from.data_case()) {
     case kMetadata: {
@@ -589,7 +608,12 @@ inline void StreamPCMRequest::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.vad_){0}
+      decltype(_impl_.vads_){arena}
+    , /*decltype(_impl_._vads_cached_byte_size_)*/{0}
+    , decltype(_impl_.energies_){arena}
+    , /*decltype(_impl_._energies_cached_byte_size_)*/{0}
+    , decltype(_impl_.vad_){0}
+    , decltype(_impl_.energy_){0}
     , decltype(_impl_.data_){}
     , /*decltype(_impl_._cached_size_)*/{}
     , /*decltype(_impl_._oneof_case_)*/{}
@@ -608,6 +632,8 @@ StreamPCMRequest::~StreamPCMRequest() {
 
 inline void StreamPCMRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.vads_.~RepeatedField();
+  _impl_.energies_.~RepeatedField();
   if (has_data()) {
     clear_data();
   }
@@ -644,7 +670,11 @@ void StreamPCMRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.vad_ = 0;
+  _impl_.vads_.Clear();
+  _impl_.energies_.Clear();
+  ::memset(&_impl_.vad_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.energy_) -
+      reinterpret_cast<char*>(&_impl_.vad_)) + sizeof(_impl_.energy_));
   clear_data();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -680,6 +710,36 @@ const char* StreamPCMRequest::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
+      // repeated int32 vads = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_vads(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_vads(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 energy = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.energy_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 energies = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_energies(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_energies(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -728,6 +788,30 @@ uint8_t* StreamPCMRequest::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_vad(), target);
   }
 
+  // repeated int32 vads = 4;
+  {
+    int byte_size = _impl_._vads_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          4, _internal_vads(), byte_size, target);
+    }
+  }
+
+  // int32 energy = 5;
+  if (this->_internal_energy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_energy(), target);
+  }
+
+  // repeated int32 energies = 6;
+  {
+    int byte_size = _impl_._energies_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          6, _internal_energies(), byte_size, target);
+    }
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -744,11 +828,44 @@ size_t StreamPCMRequest::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated int32 vads = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.vads_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._vads_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 energies = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.energies_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._energies_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
   // int32 vad = 3;
   if (this->_internal_vad() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_vad());
   }
 
+  // int32 energy = 5;
+  if (this->_internal_energy() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_energy());
+  }
+
   switch (data_case()) {
     // .amd.StreamPCMRequest.Metadata metadata = 1;
     case kMetadata: {
@@ -786,9 +903,14 @@ void StreamPCMRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_impl_.vads_.MergeFrom(from._impl_.vads_);
+  _this->_impl_.energies_.MergeFrom(from._impl_.energies_);
   if (from._internal_vad() != 0) {
     _this->_internal_set_vad(from._internal_vad());
   }
+  if (from._internal_energy() != 0) {
+    _this->_internal_set_energy(from._internal_energy());
+  }
   switch (from.data_case()) {
     case kMetadata: {
       _this->_internal_mutable_metadata()->::amd::StreamPCMRequest_Metadata::MergeFrom(
@@ -820,7 +942,14 @@ bool StreamPCMRequest::IsInitialized() const {
 void StreamPCMRequest::InternalSwap(StreamPCMRequest* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_.vad_, other->_impl_.vad_);
+  _impl_.vads_.InternalSwap(&other->_impl_.vads_);
+  _impl_.energies_.InternalSwap(&other->_impl_.energies_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StreamPCMRequest, _impl_.energy_)
+      + sizeof(StreamPCMRequest::_impl_.energy_)
+      - PROTOBUF_FIELD_OFFSET(StreamPCMRequest, _impl_.vad_)>(
+          reinterpret_cast<char*>(&_impl_.vad_),
+          reinterpret_cast<char*>(&other->_impl_.vad_));
   swap(_impl_.data_, other->_impl_.data_);
   swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
 }
@@ -849,6 +978,7 @@ StreamPCMResponse::StreamPCMResponse(const StreamPCMResponse& from)
   new (&_impl_) Impl_{
       decltype(_impl_.results_){from._impl_.results_}
     , decltype(_impl_.result_){}
+    , decltype(_impl_.confidence_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -860,6 +990,7 @@ StreamPCMResponse::StreamPCMResponse(const StreamPCMResponse& from)
     _this->_impl_.result_.Set(from._internal_result(), 
       _this->GetArenaForAllocation());
   }
+  _this->_impl_.confidence_ = from._impl_.confidence_;
   // @@protoc_insertion_point(copy_constructor:amd.StreamPCMResponse)
 }
 
@@ -870,6 +1001,7 @@ inline void StreamPCMResponse::SharedCtor(
   new (&_impl_) Impl_{
       decltype(_impl_.results_){arena}
     , decltype(_impl_.result_){}
+    , decltype(_impl_.confidence_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.result_.InitDefault();
@@ -905,6 +1037,7 @@ void StreamPCMResponse::Clear() {
 
   _impl_.results_.Clear();
   _impl_.result_.ClearToEmpty();
+  _impl_.confidence_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -939,6 +1072,14 @@ const char* StreamPCMResponse::_InternalParse(const char* ptr, ::_pbi::ParseCont
         } else
           goto handle_unusual;
         continue;
+      // float confidence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 29)) {
+          _impl_.confidence_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -988,6 +1129,16 @@ uint8_t* StreamPCMResponse::_InternalSerialize(
     target = stream->WriteString(2, s, target);
   }
 
+  // float confidence = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(3, this->_internal_confidence(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1019,6 +1170,15 @@ size_t StreamPCMResponse::ByteSizeLong() const {
         this->_internal_result());
   }
 
+  // float confidence = 3;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = this->_internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
+    total_size += 1 + 4;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1041,6 +1201,13 @@ void StreamPCMResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, cons
   if (!from._internal_result().empty()) {
     _this->_internal_set_result(from._internal_result());
   }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_confidence = from._internal_confidence();
+  uint32_t raw_confidence;
+  memcpy(&raw_confidence, &tmp_confidence, sizeof(tmp_confidence));
+  if (raw_confidence != 0) {
+    _this->_internal_set_confidence(from._internal_confidence());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1065,6 +1232,7 @@ void StreamPCMResponse::InternalSwap(StreamPCMResponse* other) {
       &_impl_.result_, lhs_arena,
       &other->_impl_.result_, rhs_arena
   );
+  swap(_impl_.confidence_, other->_impl_.confidence_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata StreamPCMResponse::GetMetadata() const {
@@ -427,10 +427,57 @@ class StreamPCMRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kVadsFieldNumber = 4,
+    kEnergiesFieldNumber = 6,
     kVadFieldNumber = 3,
+    kEnergyFieldNumber = 5,
     kMetadataFieldNumber = 1,
     kChunkFieldNumber = 2,
   };
+  // repeated int32 vads = 4;
+  int vads_size() const;
+  private:
+  int _internal_vads_size() const;
+  public:
+  void clear_vads();
+  private:
+  int32_t _internal_vads(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_vads() const;
+  void _internal_add_vads(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_vads();
+  public:
+  int32_t vads(int index) const;
+  void set_vads(int index, int32_t value);
+  void add_vads(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      vads() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_vads();
+
+  // repeated int32 energies = 6;
+  int energies_size() const;
+  private:
+  int _internal_energies_size() const;
+  public:
+  void clear_energies();
+  private:
+  int32_t _internal_energies(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_energies() const;
+  void _internal_add_energies(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_energies();
+  public:
+  int32_t energies(int index) const;
+  void set_energies(int index, int32_t value);
+  void add_energies(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      energies() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_energies();
+
   // int32 vad = 3;
   void clear_vad();
   int32_t vad() const;
@@ -440,6 +487,15 @@ class StreamPCMRequest final :
   void _internal_set_vad(int32_t value);
   public:
 
+  // int32 energy = 5;
+  void clear_energy();
+  int32_t energy() const;
+  void set_energy(int32_t value);
+  private:
+  int32_t _internal_energy() const;
+  void _internal_set_energy(int32_t value);
+  public:
+
   // .amd.StreamPCMRequest.Metadata metadata = 1;
   bool has_metadata() const;
   private:
@@ -491,7 +547,12 @@ class StreamPCMRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > vads_;
+    mutable std::atomic<int> _vads_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > energies_;
+    mutable std::atomic<int> _energies_cached_byte_size_;
     int32_t vad_;
+    int32_t energy_;
     union DataUnion {
       constexpr DataUnion() : _constinit_{} {}
         ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
@@ -630,6 +691,7 @@ class StreamPCMResponse final :
   enum : int {
     kResultsFieldNumber = 2,
     kResultFieldNumber = 1,
+    kConfidenceFieldNumber = 3,
   };
   // repeated string results = 2;
   int results_size() const;
@@ -669,6 +731,15 @@ class StreamPCMResponse final :
   std::string* _internal_mutable_result();
   public:
 
+  // float confidence = 3;
+  void clear_confidence();
+  float confidence() const;
+  void set_confidence(float value);
+  private:
+  float _internal_confidence() const;
+  void _internal_set_confidence(float value);
+  public:
+
   // @@protoc_insertion_point(class_scope:amd.StreamPCMResponse)
  private:
   class _Internal;
@@ -679,6 +750,7 @@ class StreamPCMResponse final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> results_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr result_;
+    float confidence_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1060,6 +1132,120 @@ inline void StreamPCMRequest::set_vad(int32_t value) {
   // @@protoc_insertion_point(field_set:amd.StreamPCMRequest.vad)
 }
 
+// repeated int32 vads = 4;
+inline int StreamPCMRequest::_internal_vads_size() const {
+  return _impl_.vads_.size();
+}
+inline int StreamPCMRequest::vads_size() const {
+  return _internal_vads_size();
+}
+inline void StreamPCMRequest::clear_vads() {
+  _impl_.vads_.Clear();
+}
+inline int32_t StreamPCMRequest::_internal_vads(int index) const {
+  return _impl_.vads_.Get(index);
+}
+inline int32_t StreamPCMRequest::vads(int index) const {
+  // @@protoc_insertion_point(field_get:amd.StreamPCMRequest.vads)
+  return _internal_vads(index);
+}
+inline void StreamPCMRequest::set_vads(int index, int32_t value) {
+  _impl_.vads_.Set(index, value);
+  // @@protoc_insertion_point(field_set:amd.StreamPCMRequest.vads)
+}
+inline void StreamPCMRequest::_internal_add_vads(int32_t value) {
+  _impl_.vads_.Add(value);
+}
+inline void StreamPCMRequest::add_vads(int32_t value) {
+  _internal_add_vads(value);
+  // @@protoc_insertion_point(field_add:amd.StreamPCMRequest.vads)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+StreamPCMRequest::_internal_vads() const {
+  return _impl_.vads_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+StreamPCMRequest::vads() const {
+  // @@protoc_insertion_point(field_list:amd.StreamPCMRequest.vads)
+  return _internal_vads();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+StreamPCMRequest::_internal_mutable_vads() {
+  return &_impl_.vads_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+StreamPCMRequest::mutable_vads() {
+  // @@protoc_insertion_point(field_mutable_list:amd.StreamPCMRequest.vads)
+  return _internal_mutable_vads();
+}
+
+// int32 energy = 5;
+inline void StreamPCMRequest::clear_energy() {
+  _impl_.energy_ = 0;
+}
+inline int32_t StreamPCMRequest::_internal_energy() const {
+  return _impl_.energy_;
+}
+inline int32_t StreamPCMRequest::energy() const {
+  // @@protoc_insertion_point(field_get:amd.StreamPCMRequest.energy)
+  return _internal_energy();
+}
+inline void StreamPCMRequest::_internal_set_energy(int32_t value) {
+  
+  _impl_.energy_ = value;
+}
+inline void StreamPCMRequest::set_energy(int32_t value) {
+  _internal_set_energy(value);
+  // @@protoc_insertion_point(field_set:amd.StreamPCMRequest.energy)
+}
+
+// repeated int32 energies = 6;
+inline int StreamPCMRequest::_internal_energies_size() const {
+  return _impl_.energies_.size();
+}
+inline int StreamPCMRequest::energies_size() const {
+  return _internal_energies_size();
+}
+inline void StreamPCMRequest::clear_energies() {
+  _impl_.energies_.Clear();
+}
+inline int32_t StreamPCMRequest::_internal_energies(int index) const {
+  return _impl_.energies_.Get(index);
+}
+inline int32_t StreamPCMRequest::energies(int index) const {
+  // @@protoc_insertion_point(field_get:amd.StreamPCMRequest.energies)
+  return _internal_energies(index);
+}
+inline void StreamPCMRequest::set_energies(int index, int32_t value) {
+  _impl_.energies_.Set(index, value);
+  // @@protoc_insertion_point(field_set:amd.StreamPCMRequest.energies)
+}
+inline void StreamPCMRequest::_internal_add_energies(int32_t value) {
+  _impl_.energies_.Add(value);
+}
+inline void StreamPCMRequest::add_energies(int32_t value) {
+  _internal_add_energies(value);
+  // @@protoc_insertion_point(field_add:amd.StreamPCMRequest.energies)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+StreamPCMRequest::_internal_energies() const {
+  return _impl_.energies_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+StreamPCMRequest::energies() const {
+  // @@protoc_insertion_point(field_list:amd.StreamPCMRequest.energies)
+  return _internal_energies();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+StreamPCMRequest::_internal_mutable_energies() {
+  return &_impl_.energies_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+StreamPCMRequest::mutable_energies() {
+  // @@protoc_insertion_point(field_mutable_list:amd.StreamPCMRequest.energies)
+  return _internal_mutable_energies();
+}
+
 inline bool StreamPCMRequest::has_data() const {
   return data_case() != DATA_NOT_SET;
 }
@@ -1198,6 +1384,26 @@ StreamPCMResponse::mutable_results() {
   return &_impl_.results_;
 }
 
+// float confidence = 3;
+inline void StreamPCMResponse::clear_confidence() {
+  _impl_.confidence_ = 0;
+}
+inline float StreamPCMResponse::_internal_confidence() const {
+  return _impl_.confidence_;
+}
+inline float StreamPCMResponse::confidence() const {
+  // @@protoc_insertion_point(field_get:amd.StreamPCMResponse.confidence)
+  return _internal_confidence();
+}
+inline void StreamPCMResponse::_internal_set_confidence(float value) {
+  
+  _impl_.confidence_ = value;
+}
+inline void StreamPCMResponse::set_confidence(float value) {
+  _internal_set_confidence(value);
+  // @@protoc_insertion_point(field_set:amd.StreamPCMResponse.confidence)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -12,6 +12,8 @@
 #include <grpcpp/client_context.h>
 #include <grpcpp/create_channel.h>
 #include <numeric>
+#include <fstream>
+#include <iterator>
 #include "generated/fs.grpc.pb.h"
 #include "generated/stream.grpc.pb.h"
 
@@ -37,8 +39,8 @@ using grpc::StatusCode;
 
 namespace mod_grpc {
 
-    Status ApiServiceImpl::Originate(ServerContext *ctx, const fs::OriginateRequest *request,
-                                     fs::OriginateResponse *reply) {
+    // uuid is preset as origination_uuid of the new channel when not null
+    static Status originate(const fs::OriginateRequest *request, const char *uuid, fs::OriginateResponse *reply) {
         switch_channel_t *caller_channel;
         switch_event_t *var_event = NULL;
         switch_core_session_t *caller_session = nullptr;
@@ -90,6 +92,9 @@ namespace mod_grpc {
             return Status(StatusCode::INTERNAL, msg);
         }
         switch_event_add_header_string(var_event, SWITCH_STACK_BOTTOM, "wbt_originate", "true");
+        if (uuid) {
+            switch_event_add_header_string(var_event, SWITCH_STACK_BOTTOM, "origination_uuid", uuid);
+        }
         if (request->variables_size() > 0) {
             for (const auto &kv: request->variables()) {
                 switch_event_add_header_string(var_event, SWITCH_STACK_BOTTOM, kv.first.c_str(), kv.second.c_str());
@@ -170,6 +175,212 @@ namespace mod_grpc {
         return Status::OK;
     }
 
+    Status ApiServiceImpl::Originate(ServerContext *ctx, const fs::OriginateRequest *request,
+                                     fs::OriginateResponse *reply) {
+        return originate(request, nullptr, reply);
+    }
+
+    std::mutex OriginateAsyncCall::calls_mutex_;
+    std::unordered_map<std::string, OriginateAsyncCall *> OriginateAsyncCall::calls_;
+
+    OriginateAsyncCall::OriginateAsyncCall(fs::Api::AsyncService *service, ServerCompletionQueue *cq,
+                                           std::atomic<int> *detached)
+            : ServerStreamCall(service, cq, &fs::Api::AsyncService::RequestOriginateAsync), detached_(detached),
+              preset_uuid_(false) {
+    }
+
+    void OriginateAsyncCall::Spawn() {
+        (new OriginateAsyncCall(service_, cq_, detached_))->Arm();
+    }
+
+    void OriginateAsyncCall::OnRequest() {
+        auto it = req_.variables().find("origination_uuid");
+        if (it != req_.variables().end() && !it->second.empty()) {
+            uuid_ = it->second;
+            preset_uuid_ = true;
+        } else {
+            char buf[SWITCH_UUID_FORMATTED_LENGTH + 1];
+            uuid_ = switch_uuid_str(buf, sizeof(buf));
+        }
+
+        fs::OriginateAsyncResponse msg;
+        msg.set_uuid(uuid_);
+        msg.set_state(fs::OriginateAsyncResponse_State_CREATED);
+        Send(msg);
+
+        {
+            std::lock_guard<std::mutex> lock(calls_mutex_);
+            calls_[uuid_] = this;
+        }
+
+        auto td = (switch_thread_data_t *) calloc(1, sizeof(switch_thread_data_t));
+        ++(*detached_);
+        td->func = OriginateAsyncCall::run;
+        td->obj = this;
+        td->alloc = 1;
+        switch_thread_pool_launch_thread(&td);
+    }
+
+    void *SWITCH_THREAD_FUNC OriginateAsyncCall::run(switch_thread_t *thread, void *obj) {
+        auto call = static_cast<OriginateAsyncCall *>(obj);
+        auto detached = call->detached_;
+        fs::OriginateResponse reply;
+        fs::OriginateAsyncResponse msg;
+        Status status;
+
+        status = originate(&call->req_, call->preset_uuid_ ? nullptr : call->uuid_.c_str(), &reply);
+
+        {
+            std::lock_guard<std::mutex> lock(calls_mutex_);
+            calls_.erase(call->uuid_);
+        }
+
+        msg.set_uuid(call->uuid_);
+        if (reply.has_error()) {
+            msg.set_state(fs::OriginateAsyncResponse_State_FAILED);
+            *msg.mutable_error() = reply.error();
+            msg.set_error_code(reply.error_code());
+        } else {
+            msg.set_state(fs::OriginateAsyncResponse_State_ANSWERED);
+        }
+
+        if (status.ok()) {
+            call->Send(msg);
+        }
+        call->Close(status);
+        --(*detached);
+        return nullptr;
+    }
+
+    OriginateBatchCall::OriginateBatchCall(fs::Api::AsyncService *service, ServerCompletionQueue *cq,
+                                           std::atomic<int> *detached, std::atomic<int> *active, int max_concurrency)
+            : ServerStreamCall(service, cq, &fs::Api::AsyncService::RequestOriginateBatch), detached_(detached),
+              active_(active), max_concurrency_(max_concurrency), next_(0), workers_(0), interval_(0), next_time_(0) {
+    }
+
+    void OriginateBatchCall::Spawn() {
+        (new OriginateBatchCall(service_, cq_, detached_, active_, max_concurrency_))->Arm();
+    }
+
+    void OriginateBatchCall::OnRequest() {
+        int count = req_.requests_size();
+        int concurrency = max_concurrency_;
+
+        if (!count) {
+            Close(Status(StatusCode::INVALID_ARGUMENT, "requests is required"));
+            return;
+        }
+
+        if (req_.concurrency() > 0 && req_.concurrency() < concurrency) {
+            concurrency = req_.concurrency();
+        }
+        if (concurrency > count) {
+            concurrency = count;
+        }
+        if (req_.rate() > 0) {
+            interval_ = 1000000 / req_.rate();
+        }
+
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "originate batch: %d calls, %d workers, rate %d\n",
+                          count, concurrency, req_.rate());
+
+        workers_ = concurrency;
+        for (int i = 0; i < concurrency; ++i) {
+            auto td = (switch_thread_data_t *) calloc(1, sizeof(switch_thread_data_t));
+            ++(*detached_);
+            td->func = OriginateBatchCall::run;
+            td->obj = this;
+            td->alloc = 1;
+            switch_thread_pool_launch_thread(&td);
+        }
+    }
+
+    void OriginateBatchCall::waitRate() {
+        switch_time_t wait = 0;
+        if (!interval_) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(rate_mutex_);
+            auto now = switch_micro_time_now();
+            if (next_time_ < now) {
+                next_time_ = now;
+            }
+            wait = next_time_ - now;
+            next_time_ += interval_;
+        }
+
+        if (wait > 0) {
+            switch_yield(wait);
+        }
+    }
+
+    // a slot of the server wide limit, false if the call was cancelled while waiting
+    bool OriginateBatchCall::acquireSlot() {
+        while (!Cancelled()) {
+            int active = active_->load();
+            if (active >= max_concurrency_) {
+                switch_yield(ORIGINATE_BATCH_SLOT_WAIT_US);
+            } else if (active_->compare_exchange_weak(active, active + 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void *SWITCH_THREAD_FUNC OriginateBatchCall::run(switch_thread_t *thread, void *obj) {
+        auto call = static_cast<OriginateBatchCall *>(obj);
+        auto detached = call->detached_;
+        int idx;
+
+        while (call->next_ < call->req_.requests_size() && call->acquireSlot()) {
+            if ((idx = call->next_++) >= call->req_.requests_size()) {
+                --(*call->active_);
+                break;
+            }
+
+            fs::OriginateBatchResponse msg;
+            call->waitRate();
+            msg.set_index(idx);
+            auto status = originate(&call->req_.requests(idx), nullptr, msg.mutable_result());
+            if (!status.ok()) {
+                msg.mutable_result()->mutable_error()->set_type(fs::ErrorExecute_Type_ERROR);
+                msg.mutable_result()->mutable_error()->set_message(status.error_message());
+            }
+            --(*call->active_);
+            call->Send(msg);
+        }
+
+        if (--call->workers_ == 0) {
+            call->Close(Status::OK);
+        }
+        --(*detached);
+        return nullptr;
+    }
+
+    void OriginateAsyncCall::handle_progress_event(switch_event_t *event) {
+        const char *uuid = switch_event_get_header(event, "Unique-ID");
+        if (!uuid) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(calls_mutex_);
+        auto it = calls_.find(uuid);
+        if (it == calls_.end()) {
+            return;
+        }
+
+        fs::OriginateAsyncResponse msg;
+        msg.set_uuid(uuid);
+        if (event->event_id == SWITCH_EVENT_CHANNEL_PROGRESS_MEDIA) {
+            msg.set_state(fs::OriginateAsyncResponse_State_EARLY_MEDIA);
+        } else {
+            msg.set_state(fs::OriginateAsyncResponse_State_RINGING);
+        }
+        it->second->Send(msg);
+    }
+
     Status ApiServiceImpl::Execute(ServerContext *context, const fs::ExecuteRequest *request,
                                    fs::ExecuteResponse *reply) {
         switch_stream_handle_t stream = {0};
@@ -591,12 +802,14 @@ namespace mod_grpc {
             return Status::OK;
         }
 
+        if (server_->Callbacks()->Confirm(request->id())) {
+            return Status::OK;
+        }
+
+        // the call doesn't wait (yet or any more)
         switch_core_session_t *session;
         session = switch_core_session_locate(request->id().c_str());
         if (session) {
-            switch_channel_t *channel = switch_core_session_get_channel(session);
-            //todo fixme CF_SLA_INTERCEPT -> CF_DEVICES_CHANGED
-            switch_channel_set_flag(channel, CF_SLA_INTERCEPT);
             switch_core_session_rwunlock(session);
         } else {
             reply->mutable_error()->set_type(fs::ErrorExecute_Type_ERROR);
@@ -762,6 +975,15 @@ namespace mod_grpc {
         return Status::OK;
     }
 
+    static void readFile(const std::string &name, std::string &out) {
+        std::ifstream file(name, std::ios::binary);
+        if (!file) {
+            switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING, "Can't read %s\n", name.c_str());
+            return;
+        }
+        out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
     ServerImpl::ServerImpl(Config config_) {
         if (!config_.grpc_host) {
             char ipV4_[80];
@@ -769,10 +991,17 @@ namespace mod_grpc {
             config_.grpc_host = std::string(ipV4_).c_str();
         }
         server_address_ = std::string(config_.grpc_host) + ":" + std::to_string(config_.grpc_port);
+        cq_count_ = config_.grpc_cq_count > 0 ? config_.grpc_cq_count : 1;
+        cq_threads_ = config_.grpc_cq_threads > 0 ? config_.grpc_cq_threads : 1;
+        batch_concurrency_ = config_.originate_batch_concurrency > 0 ? config_.originate_batch_concurrency : 1;
+        batch_active_ = 0;
+        detached_calls_ = 0;
 
         if (config_.consul_address) {
             cluster_ = new Cluster(config_.consul_address, config_.grpc_host, config_.grpc_port,
-                                   config_.consul_tts_sec, config_.consul_deregister_critical_tts_sec);
+                                   config_.consul_tts_sec, config_.consul_deregister_critical_tts_sec,
+                                   config_.event_workers, config_.event_queue_size,
+                                   config_.event_heartbeat_batch_ms, config_.event_dtmf_window_ms);
         }
 
         this->push_wait_callback = config_.push_wait_callback;
@@ -798,55 +1027,158 @@ namespace mod_grpc {
         this->push_apn_enabled = config_.push_apn_enabled && !this->push_apn_cert_file.empty() && !this->push_apn_key_pass.empty()
                 && !this->push_apn_key_file.empty() && !this->push_apn_topic.empty();
 
+        this->push_timeout_ms = config_.push_timeout_ms;
+        this->push_keepalive_sec = config_.push_keepalive_sec;
+        this->push_fcm_provider = -1;
+        this->push_apn_provider = -1;
+        this->push_fcm_body_.reset(new PushTemplate(PUSH_FCM_TEMPLATE, int(this->push_wait_callback / 1000) + 2));
+        this->push_apn_body_.reset(new PushTemplate(PUSH_APN_TEMPLATE, 0));
+        this->push_dead_tokens_.reset(new PushTokenCache(config_.push_dead_tokens > 0 ? config_.push_dead_tokens : 0,
+                                                         config_.push_dead_token_ttl_sec));
+        if (this->push_fcm_enabled || this->push_apn_enabled) {
+            this->pushDispatcher_.reset(new PushDispatcher(config_.push_connections, this->push_keepalive_sec));
+            if (this->push_fcm_enabled) {
+                this->push_fcm_provider = this->pushDispatcher_->AddProvider("FCM", this->push_fcm_uri,
+                                                                             [this](CURL *cli) { setupFCM(cli); });
+            }
+            if (this->push_apn_enabled) {
+                // a reconnect does not read the files again
+                readFile(this->push_apn_cert_file, this->push_apn_cert);
+                readFile(this->push_apn_key_file, this->push_apn_key);
+                this->push_apn_provider = this->pushDispatcher_->AddProvider("APN", this->push_apn_uri,
+                                                                             [this](CURL *cli) { setupAPN(cli); });
+            }
+            this->pushDispatcher_->Start();
+        }
+
         this->auto_answer_delay = config_.auto_answer_delay;
         this->allowAMDAi = false;
         if (config_.amd_ai_address) {
             auto amd_ai_address = std::string(config_.amd_ai_address);
             if (!amd_ai_address.empty() && amd_ai_address.size() > 5) {
-                this->amdAiChannel_ = grpc::CreateChannel(amd_ai_address, grpc::InsecureChannelCredentials());
-                this->allowAMDAi = true;
-                this->amdClient_.reset(new AMDClient(this->amdAiChannel_));
+                this->amdClient_.reset(new AMDClient(config_.amd_ai_address, config_.amd_ai_channels,
+                                                     config_.amd_ai_eject_sec, config_.amd_ai_threads,
+                                                     config_.amd_ai_buffer_frames,
+                                                     config_.amd_ai_overflow && strcmp(config_.amd_ai_overflow, "abort") == 0,
+                                                     config_.amd_ai_aggregate_ms, config_.amd_ai_warm_streams));
+                this->allowAMDAi = this->amdClient_->Endpoints() > 0;
                 switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_NOTICE, "Connect to AMD AI %s\n",
                                   amd_ai_address.c_str());
             }
         }
     }
 
-    std::shared_ptr<grpc::Channel> ServerImpl::AMDAiChannel() {
-        return amdAiChannel_;
-    }
-
     bool ServerImpl::AllowAMDAi() const {
         return allowAMDAi;
     }
 
+    void ServerImpl::AMDStats(std::string &out) {
+        if (amdClient_) {
+            amdClient_->Stats(out);
+        }
+    }
+
+    // the channel thread waits in wbt_send_hook, the hangup comes from the signalling thread
+    static void push_hangup_event(switch_event_t *event) {
+        const char *uuid = switch_event_get_header(event, "Unique-ID");
+        if (uuid && server_) {
+            server_->Callbacks()->Hangup(uuid);
+        }
+    }
+
     void ServerImpl::Run() {
         initServer();
-        thread_ = std::thread([&]() {
-            switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_NOTICE, "Server listening on %s\n",
-                              server_address_.c_str());
-            server_->Wait();
-            switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_NOTICE, "Server shutdown\n");
-        });
+        if (this->pushDispatcher_ && this->push_wait_callback > 0) {
+            switch_event_bind(GRPC_PUSH_CALLBACK, SWITCH_EVENT_CHANNEL_HANGUP, nullptr, push_hangup_event, nullptr);
+        }
+        switch_event_bind(GRPC_ORIGINATE_PROGRESS, SWITCH_EVENT_CHANNEL_PROGRESS, nullptr,
+                          OriginateAsyncCall::handle_progress_event, nullptr);
+        switch_event_bind(GRPC_ORIGINATE_PROGRESS, SWITCH_EVENT_CHANNEL_PROGRESS_MEDIA, nullptr,
+                          OriginateAsyncCall::handle_progress_event, nullptr);
+        switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_NOTICE, "Server listening on %s (queues: %d, threads: %d)\n",
+                          server_address_.c_str(), cq_count_, cq_threads_);
+
+        for (auto &cq : cqs_) {
+            auto q = cq.get();
+            requestCall(q, &fs::Api::AsyncService::RequestOriginate, &ApiServiceImpl::Originate, true);
+            requestCall(q, &fs::Api::AsyncService::RequestExecute, &ApiServiceImpl::Execute, true);
+            requestCall(q, &fs::Api::AsyncService::RequestSetVariables, &ApiServiceImpl::SetVariables, false);
+            requestCall(q, &fs::Api::AsyncService::RequestBridge, &ApiServiceImpl::Bridge, true);
+            requestCall(q, &fs::Api::AsyncService::RequestBridgeCall, &ApiServiceImpl::BridgeCall, false);
+            requestCall(q, &fs::Api::AsyncService::RequestStopPlayback, &ApiServiceImpl::StopPlayback, false);
+            requestCall(q, &fs::Api::AsyncService::RequestHangup, &ApiServiceImpl::Hangup, false);
+            requestCall(q, &fs::Api::AsyncService::RequestHangupMatchingVars, &ApiServiceImpl::HangupMatchingVars, false);
+            requestCall(q, &fs::Api::AsyncService::RequestQueue, &ApiServiceImpl::Queue, false);
+            requestCall(q, &fs::Api::AsyncService::RequestHangupMany, &ApiServiceImpl::HangupMany, false);
+            requestCall(q, &fs::Api::AsyncService::RequestHold, &ApiServiceImpl::Hold, false);
+            requestCall(q, &fs::Api::AsyncService::RequestUnHold, &ApiServiceImpl::UnHold, false);
+            requestCall(q, &fs::Api::AsyncService::RequestSetProfileVar, &ApiServiceImpl::SetProfileVar, false);
+            requestCall(q, &fs::Api::AsyncService::RequestConfirmPush, &ApiServiceImpl::ConfirmPush, false);
+            requestCall(q, &fs::Api::AsyncService::RequestBroadcast, &ApiServiceImpl::Broadcast, true);
+            requestCall(q, &fs::Api::AsyncService::RequestSetEavesdropState, &ApiServiceImpl::SetEavesdropState, false);
+            requestCall(q, &fs::Api::AsyncService::RequestBlindTransfer, &ApiServiceImpl::BlindTransfer, false);
+            requestCall(q, &fs::Api::AsyncService::RequestBreakPark, &ApiServiceImpl::BreakPark, false);
+            (new OriginateAsyncCall(&service_, q, &detached_calls_))->Arm();
+            (new OriginateBatchCall(&service_, q, &detached_calls_, &batch_active_, batch_concurrency_))->Arm();
+            (new CallEventStream(&service_, q))->Arm();
+
+            for (int i = 0; i < cq_threads_; ++i) {
+                pollers_.emplace_back(&ServerImpl::HandleRpcs, this, q);
+            }
+        }
+    }
+
+    template<class Req, class Resp>
+    void ServerImpl::requestCall(ServerCompletionQueue *cq, typename UnaryCall<Req, Resp>::RequestMethod request,
+                                 Status (ApiServiceImpl::*handler)(ServerContext *, const Req *, Resp *),
+                                 bool detached) {
+        new UnaryCall<Req, Resp>(&service_, cq, &api_, request, handler, detached ? &detached_calls_ : nullptr);
+    }
+
+    void ServerImpl::HandleRpcs(ServerCompletionQueue *cq) {
+        void *tag;
+        bool ok;
+        while (cq->Next(&tag, &ok)) {
+            static_cast<CallData *>(tag)->Proceed(ok);
+        }
     }
 
     void ServerImpl::Shutdown() {
+        switch_event_unbind_callback(OriginateAsyncCall::handle_progress_event);
+        switch_event_unbind_callback(push_hangup_event);
+        CallEventStream::CloseAll();
 
         if (server_) {
-            server_->Shutdown();
+            // calls still in flight after the deadline are cancelled
+            server_->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(SERVER_SHUTDOWN_TIMEOUT_SEC));
         }
 
-        if (thread_.joinable()) {
-            thread_.join();
+        // detached handlers still own a responder on the queue
+        while (detached_calls_ > 0) {
+            switch_yield(10000);
         }
 
-        if (amdAiChannel_ && amdAiChannel_->GetState(false) != GRPC_CHANNEL_SHUTDOWN) {
-            amdAiChannel_.reset();
+        for (auto &cq : cqs_) {
+            cq->Shutdown();
         }
+
+        for (auto &t : pollers_) {
+            if (t.joinable()) {
+                t.join();
+            }
+        }
+        pollers_.clear();
+
+        for (auto &cq : cqs_) {
+            HandleRpcs(cq.get());
+        }
+
         amdClient_.reset();
+        pushDispatcher_.reset();
 
         delete cluster_;
         server_.reset();
+        cqs_.clear();
     }
 
     void ServerImpl::initServer() {
@@ -854,8 +1186,11 @@ namespace mod_grpc {
         // Listen on the given address without any authentication mechanism.
         builder.AddListeningPort(server_address_, grpc::InsecureServerCredentials());
         // Register "service" as the instance through which we'll communicate with
-        // clients. In this case it corresponds to an *synchronous* service.
-        builder.RegisterService(&api_);
+        // clients. In this case it corresponds to an *asynchronous* service.
+        builder.RegisterService(&service_);
+        for (int i = 0; i < cq_count_; ++i) {
+            cqs_.emplace_back(builder.AddCompletionQueue());
+        }
         // Finally assemble the server.
         server_ = builder.BuildAndStart();
 
@@ -897,6 +1232,27 @@ namespace mod_grpc {
                         &config.grpc_port,
                         (void *) 50051,
                         nullptr, nullptr, "GRPC server port"),
+                SWITCH_CONFIG_ITEM(
+                        "grpc_cq_count",
+                        SWITCH_CONFIG_INT,
+                        0,
+                        &config.grpc_cq_count,
+                        (void *) 2,
+                        nullptr, nullptr, "GRPC server completion queues"),
+                SWITCH_CONFIG_ITEM(
+                        "grpc_cq_threads",
+                        SWITCH_CONFIG_INT,
+                        0,
+                        &config.grpc_cq_threads,
+                        (void *) 2,
+                        nullptr, nullptr, "GRPC poller threads per completion queue"),
+                SWITCH_CONFIG_ITEM(
+                        "originate_batch_concurrency",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.originate_batch_concurrency,
+                        (void *) 20,
+                        nullptr, nullptr, "Max parallel originates of all OriginateBatch calls"),
                 SWITCH_CONFIG_ITEM(
                         "consul_address",
                         SWITCH_CONFIG_STRING,
@@ -910,7 +1266,56 @@ namespace mod_grpc {
                         CONFIG_RELOADABLE,
                         &config.amd_ai_address,
                         nullptr,
-                        nullptr, "amd_ai_address", "AMD stream AI address"),
+                        nullptr, "amd_ai_address", "AMD stream AI addresses, comma separated"),
+                SWITCH_CONFIG_ITEM(
+                        "amd_ai_channels",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.amd_ai_channels,
+                        (void *) 1,
+                        nullptr, nullptr, "AMD stream connections of each address"),
+                SWITCH_CONFIG_ITEM(
+                        "amd_ai_eject_sec",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.amd_ai_eject_sec,
+                        (void *) AMD_ENDPOINT_EJECT_SEC,
+                        nullptr, nullptr, "AMD stream address is skipped after a failure, sec. 0 - never"),
+                SWITCH_CONFIG_ITEM(
+                        "amd_ai_threads",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.amd_ai_threads,
+                        (void *) 2,
+                        nullptr, nullptr, "AMD stream completion queue threads"),
+                SWITCH_CONFIG_ITEM(
+                        "amd_ai_buffer_frames",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.amd_ai_buffer_frames,
+                        (void *) 50,
+                        nullptr, nullptr, "AMD stream audio buffer of a call, frames"),
+                SWITCH_CONFIG_ITEM(
+                        "amd_ai_overflow",
+                        SWITCH_CONFIG_STRING,
+                        CONFIG_RELOADABLE,
+                        &config.amd_ai_overflow,
+                        "drop_oldest",
+                        nullptr, "drop_oldest|abort", "AMD stream policy of the full audio buffer"),
+                SWITCH_CONFIG_ITEM(
+                        "amd_ai_aggregate_ms",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.amd_ai_aggregate_ms,
+                        0,
+                        nullptr, nullptr, "AMD stream audio of one message, ms. 0 - message per frame"),
+                SWITCH_CONFIG_ITEM(
+                        "amd_ai_warm_streams",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.amd_ai_warm_streams,
+                        0,
+                        nullptr, nullptr, "AMD streams opened in advance. 0 - open on wbt_amd"),
                 SWITCH_CONFIG_ITEM(
                         "auto_answer_delay",
                         SWITCH_CONFIG_INT,
@@ -932,6 +1337,41 @@ namespace mod_grpc {
                         &config.heartbeat,
                         0,
                         nullptr, "heartbeat", "Enable Media Heartbeat"),
+                SWITCH_CONFIG_ITEM(
+                        "event_workers",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.event_workers,
+                        (void *) 4,
+                        nullptr, nullptr, "Call event worker threads, 0 - process in the event thread"),
+                SWITCH_CONFIG_ITEM(
+                        "event_queue_size",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.event_queue_size,
+                        (void *) 10000,
+                        nullptr, nullptr, "Call event queue size"),
+                SWITCH_CONFIG_ITEM(
+                        "event_heartbeat_batch_ms",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.event_heartbeat_batch_ms,
+                        0,
+                        nullptr, nullptr, "Join heartbeats into heartbeat_batch events, 0 - disabled"),
+                SWITCH_CONFIG_ITEM(
+                        "event_dtmf_window_ms",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.event_dtmf_window_ms,
+                        0,
+                        nullptr, nullptr, "Join DTMF digits of a call within the window, 0 - disabled"),
+                SWITCH_CONFIG_ITEM(
+                        "call_event_format",
+                        SWITCH_CONFIG_STRING,
+                        0,
+                        &config.call_event_format,
+                        "json",
+                        nullptr, "json|protobuf", "Format of WEBITEL_CALL data"),
                 SWITCH_CONFIG_ITEM(
                         "push_fcm_enabled",
                         SWITCH_CONFIG_BOOL,
@@ -960,6 +1400,41 @@ namespace mod_grpc {
                         &config.push_apn_enabled,
                         0,
                         nullptr, "push_apn_enabled", "Enable APN"),
+                SWITCH_CONFIG_ITEM(
+                        "push_timeout_ms",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.push_timeout_ms,
+                        (void *) 5000,
+                        nullptr, nullptr, "wbt_send_hook waits for the first accepted push, ms"),
+                SWITCH_CONFIG_ITEM(
+                        "push_connections",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.push_connections,
+                        (void *) 1,
+                        nullptr, nullptr, "HTTP/2 connections of each push provider"),
+                SWITCH_CONFIG_ITEM(
+                        "push_keepalive_sec",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.push_keepalive_sec,
+                        (void *) 30,
+                        nullptr, nullptr, "Idle push connection is probed every N sec. 0 - only connect"),
+                SWITCH_CONFIG_ITEM(
+                        "push_dead_tokens",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.push_dead_tokens,
+                        (void *) 10000,
+                        nullptr, nullptr, "Max device tokens rejected by the providers. 0 - disable"),
+                SWITCH_CONFIG_ITEM(
+                        "push_dead_token_ttl_sec",
+                        SWITCH_CONFIG_INT,
+                        CONFIG_RELOADABLE,
+                        &config.push_dead_token_ttl_sec,
+                        (void *) 86400,
+                        nullptr, nullptr, "Rejected device token is skipped for N sec"),
                 SWITCH_CONFIG_ITEM(
                         "push_apn_uri",
                         SWITCH_CONFIG_STRING,
@@ -1006,9 +1481,19 @@ namespace mod_grpc {
         return config;
     }
 
-    std::string toJson(const PushData *data) {
-        return "{\"type\":\"call\", \"call_id\":\"" + data->call_id + "\",\"from_number\":\"" + data->from_number + "\",\"from_name\":\"" + data->from_name +
-         "\",\"direction\":\"" + data->direction + "\",\"auto_answer\":" + std::to_string(data->auto_answer) + "}";
+    static void split_str(const std::string& str, const std::string& delimiter, std::vector<std::string> &out, bool skip_empty = false) {
+        size_t pos = 0;
+        std::string s = str;
+        while ((pos = s.find(delimiter)) != std::string::npos) {
+            if (!skip_empty || pos) {
+                out.push_back(s.substr(0, pos));
+            }
+            s.erase(0, pos + delimiter.length());
+        }
+
+        if (!skip_empty || !s.empty()) {
+            out.push_back(s);
+        }
     }
 
     static size_t writeCallback(char *contents, size_t size, size_t nmemb, void *userp) {
@@ -1016,123 +1501,196 @@ namespace mod_grpc {
         return size * nmemb;
     }
 
-    long ServerImpl::SendPushAPN(const char *devices, const PushData *data) {
+    // connection options, a request and a keepalive probe share the connection only if they are equal
+    void ServerImpl::setupConnection(CURL *cli) {
+        /* HTTP/2 please */
+        curl_easy_setopt(cli, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
+        curl_easy_setopt(cli, CURLOPT_TCP_KEEPALIVE, 1L);
+#if LIBCURL_VERSION_NUM >= 0x074100
+        if (this->push_keepalive_sec > 0) {
+            curl_easy_setopt(cli, CURLOPT_MAXAGE_CONN, (long) this->push_keepalive_sec * 2);
+        }
+#endif
+    }
+
+    void ServerImpl::setupFCM(CURL *cli) {
+        setupConnection(cli);
+    }
+
+    void ServerImpl::setupAPN(CURL *cli) {
+        setupConnection(cli);
+
+        /* cert is stored PEM coded in file... */
+        curl_easy_setopt(cli, CURLOPT_SSLCERTTYPE, "DER");
+        curl_easy_setopt(cli, CURLOPT_SSLKEYTYPE, "PEM");
+        curl_easy_setopt(cli, CURLOPT_KEYPASSWD, this->push_apn_key_pass.c_str());
+
+#if LIBCURL_VERSION_NUM >= 0x074700
+        if (!this->push_apn_cert.empty() && !this->push_apn_key.empty()) {
+            struct curl_blob cert = {(void *) this->push_apn_cert.data(), this->push_apn_cert.size(), CURL_BLOB_NOCOPY};
+            struct curl_blob key = {(void *) this->push_apn_key.data(), this->push_apn_key.size(), CURL_BLOB_NOCOPY};
+            curl_easy_setopt(cli, CURLOPT_SSLCERT_BLOB, &cert);
+            curl_easy_setopt(cli, CURLOPT_SSLKEY_BLOB, &key);
+        } else
+#endif
+        {
+            /* set the cert for client authentication */
+            curl_easy_setopt(cli, CURLOPT_SSLCERT, this->push_apn_cert_file.c_str());
+            /* set the file with the certs vaildating the server */
+            curl_easy_setopt(cli, CURLOPT_SSLKEY, this->push_apn_key_file.c_str());
+        }
+
+        /* disconnect if we cannot validate server's cert */
+        curl_easy_setopt(cli, CURLOPT_SSL_VERIFYPEER, 1L);
+    }
+
+    void ServerImpl::SendPushAPN(const char *devices, const PushData *data, const std::shared_ptr<PushWait> &wait) {
         switch_CURL  *cli = switch_curl_easy_init();
-        long response_code = -1;
 
         if (cli) {
-            switch_CURLcode res;
-            switch_curl_slist_t *headers = nullptr;
+            auto req = new PushRequest;
+            req->easy = cli;
+            req->name = "APN " + std::string(devices);
+            req->wait = wait;
+            req->provider = this->push_apn_provider;
+            req->devices.emplace_back(devices);
+            auto call_id = data->call_id;
+            req->done = [this, call_id](const PushRequest *r, long code) { pushAnswer(r, code, "APN", call_id); };
 
             switch_curl_easy_setopt(cli, CURLOPT_URL,  (this->push_apn_uri + "/" + std::string(devices)).c_str());
-            headers = switch_curl_slist_append(headers, "Content-Type: application/json");
-            headers = switch_curl_slist_append(headers, this->push_apn_topic.c_str());
-            headers = switch_curl_slist_append(headers, (std::string("apns-expiration: ") +
+            req->headers = switch_curl_slist_append(req->headers, "Content-Type: application/json");
+            req->headers = switch_curl_slist_append(req->headers, this->push_apn_topic.c_str());
+            req->headers = switch_curl_slist_append(req->headers, (std::string("apns-expiration: ") +
                 std::to_string((long)((unixTimestamp() + this->push_wait_callback + 2000) / 1000))
             ).c_str());
 
-            switch_curl_easy_setopt(cli, CURLOPT_HTTPHEADER, headers);
-
-            std::string body = "{"
-                               "\"aps\":" + toJson(data) + ","
-                               "\"priority\":10}";
-
-            /* HTTP/2 please */
-            curl_easy_setopt(cli, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2_0);
-
-            /* cert is stored PEM coded in file... */
-            curl_easy_setopt(cli, CURLOPT_SSLCERTTYPE, "DER");
+            switch_curl_easy_setopt(cli, CURLOPT_HTTPHEADER, req->headers);
 
-            /* set the cert for client authentication */
-            curl_easy_setopt(cli, CURLOPT_SSLCERT, this->push_apn_cert_file.c_str());
-
-            curl_easy_setopt(cli, CURLOPT_SSLKEYTYPE, "PEM");
-            curl_easy_setopt(cli, CURLOPT_KEYPASSWD, this->push_apn_key_pass.c_str());
-            /* set the file with the certs vaildating the server */
-            curl_easy_setopt(cli, CURLOPT_SSLKEY, this->push_apn_key_file.c_str());
+            push_apn_body_->Render(data, devices, req->body);
 
-            /* disconnect if we cannot validate server's cert */
-            curl_easy_setopt(cli, CURLOPT_SSL_VERIFYPEER, 1L);
+            setupAPN(cli);
 
             #ifdef DEBUG_CURL
             switch_curl_easy_setopt(cli, CURLOPT_VERBOSE, 1L);
             #endif
             switch_curl_easy_setopt(cli, CURLOPT_CUSTOMREQUEST, "POST");
 
-            switch_curl_easy_setopt(cli, CURLOPT_POSTFIELDS, body.c_str());
-
-#ifdef DEBUG_CURL
-            std::string readBuffer;
+            switch_curl_easy_setopt(cli, CURLOPT_POSTFIELDS, req->body.c_str());
+            switch_curl_easy_setopt(cli, CURLOPT_TIMEOUT_MS, (long) this->push_timeout_ms);
             switch_curl_easy_setopt(cli, CURLOPT_WRITEFUNCTION, writeCallback);
-            switch_curl_easy_setopt(cli, CURLOPT_WRITEDATA, &readBuffer);
+            switch_curl_easy_setopt(cli, CURLOPT_WRITEDATA, (void *) &req->response);
 
+#ifdef DEBUG_CURL
             switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING,
-                              "body\n%s\n", body.c_str());
+                              "body\n%s\n", req->body.c_str());
 #endif
 
-            res = switch_curl_easy_perform(cli);
-            if(res == CURLE_OK) {
-                curl_easy_getinfo(cli, CURLINFO_RESPONSE_CODE, &response_code);
-            }
-
-//            switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING,
-//                              "response (%s)\n%s\n",(this->push_apn_uri + "/" + std::string(devices)).c_str(), readBuffer.c_str());
-
-            switch_curl_easy_cleanup(cli);
-            switch_curl_slist_free_all(headers);
+            pushDispatcher_->Send(req);
         };
-
-
-        return response_code;
-    }
-
-    std::string ReplaceAll(std::string str, const std::string& from, const std::string& to) {
-        size_t start_pos = 0;
-        while((start_pos = str.find(from, start_pos)) != std::string::npos) {
-            str.replace(start_pos, from.length(), to);
-            start_pos += to.length(); // Handles case where 'to' is a substring of 'from'
-        }
-        return str;
     }
 
-    long ServerImpl::SendPushFCM(const char *devices, const PushData *data) {
+    void ServerImpl::SendPushFCM(const char *devices, const PushData *data, const std::shared_ptr<PushWait> &wait) {
         switch_CURL  *cli = switch_curl_easy_init();
-        long response_code = -1;
 
         if (cli) {
-            switch_CURLcode res;
-            switch_curl_slist_t *headers = nullptr;
+            auto req = new PushRequest;
+            req->easy = cli;
+            req->name = "FCM " + std::string(data->call_id);
+            req->wait = wait;
+            req->provider = this->push_fcm_provider;
+            // same tokens as the rendered registration_ids, results are matched by index
+            split_str(devices, "::", req->devices, true);
+            auto call_id = data->call_id;
+            req->done = [this, call_id](const PushRequest *r, long code) { pushAnswer(r, code, "FCM", call_id); };
+
+            setupFCM(cli);
             switch_curl_easy_setopt(cli, CURLOPT_URL,  this->push_fcm_uri.c_str());
-            headers = switch_curl_slist_append(headers, "Content-Type: application/json");
-            headers = switch_curl_slist_append(headers, this->push_fcm_auth.c_str());
-            switch_curl_easy_setopt(cli, CURLOPT_HTTPHEADER, headers);
+            req->headers = switch_curl_slist_append(req->headers, "Content-Type: application/json");
+            req->headers = switch_curl_slist_append(req->headers, this->push_fcm_auth.c_str());
+            switch_curl_easy_setopt(cli, CURLOPT_HTTPHEADER, req->headers);
 
-            std::string body = "{"
-                               "\"time_to_live\":" + std::to_string(int(this->push_wait_callback / 1000) + 2) + ","
-                               "\"data\":" + toJson(data) + ","
-                               "\"registration_ids\":[\"" + ReplaceAll(devices, "::", "\",\"") + "\"],"
-                                                                                   "\"priority\":10}";
+            push_fcm_body_->Render(data, devices, req->body);
 
-//#ifdef DEBUG_CURL
+            #ifdef DEBUG_CURL
             switch_curl_easy_setopt(cli, CURLOPT_VERBOSE, 1L);
-//#endif
+            #endif
             switch_curl_easy_setopt(cli, CURLOPT_CUSTOMREQUEST, "POST");
 
+            switch_curl_easy_setopt(cli, CURLOPT_POSTFIELDS, req->body.c_str());
+            switch_curl_easy_setopt(cli, CURLOPT_TIMEOUT_MS, (long) this->push_timeout_ms);
+            switch_curl_easy_setopt(cli, CURLOPT_WRITEFUNCTION, writeCallback);
+            switch_curl_easy_setopt(cli, CURLOPT_WRITEDATA, (void *) &req->response);
+
+#ifdef DEBUG_CURL
             switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_WARNING,
-                              "body\n%s\n", body.c_str());
+                              "body\n%s\n", req->body.c_str());
+#endif
+
+            pushDispatcher_->Send(req);
+        };
+    }
+
+    // APN answers 410 or 400 BadDeviceToken for a device, FCM reports the results of all registration_ids
+    void ServerImpl::pushAnswer(const PushRequest *req, long code, const char *provider, const std::string &call_id) {
+        std::vector<std::pair<std::string, std::string>> dead;
+        cJSON *json = nullptr;
+
+        if (code < 0 || (code != 200 && code != 400 && code != 410) || req->devices.empty()) {
+            return;
+        }
+        if (!req->response.empty()) {
+            json = cJSON_Parse(req->response.c_str());
+        }
 
-            switch_curl_easy_setopt(cli, CURLOPT_POSTFIELDS, body.c_str());
+        if (strcmp(provider, "APN") == 0) {
+            auto reason = json ? cJSON_GetObjectItem(json, "reason") : nullptr;
+            const char *r = reason && reason->valuestring ? reason->valuestring : "";
+            if (code == 410 || (code == 400 && strcmp(r, "BadDeviceToken") == 0)) {
+                dead.emplace_back(req->devices[0], code == 410 && !*r ? "Unregistered" : r);
+            }
+        } else if (code == 200 && json) {
+            auto results = cJSON_GetObjectItem(json, "results");
+            int size = results ? cJSON_GetArraySize(results) : 0;
+            for (int i = 0; i < size && i < (int) req->devices.size(); i++) {
+                auto error = cJSON_GetObjectItem(cJSON_GetArrayItem(results, i), "error");
+                if (error && error->valuestring && (strcmp(error->valuestring, "NotRegistered") == 0 ||
+                                                    strcmp(error->valuestring, "InvalidRegistration") == 0)) {
+                    dead.emplace_back(req->devices[i], error->valuestring);
+                }
+            }
+        }
+        if (json) {
+            cJSON_Delete(json);
+        }
 
-            res = switch_curl_easy_perform(cli);
-            if(res == CURLE_OK) {
-                curl_easy_getinfo(cli, CURLINFO_RESPONSE_CODE, &response_code);
+        for (auto &d : dead) {
+            switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_NOTICE, "push %s %s: invalid token %s (%s)\n", provider,
+                              call_id.c_str(), d.first.c_str(), d.second.c_str());
+            if (!push_dead_tokens_->Add(d.first)) {
+                continue;
+            }
+            switch_event_t *event;
+            if (switch_event_create_subclass(&event, SWITCH_EVENT_CUSTOM, PUSH_INVALID_TOKEN_EVENT_NAME) != SWITCH_STATUS_SUCCESS) {
+                continue;
             }
+            switch_event_add_header_string(event, SWITCH_STACK_BOTTOM, "Push-Provider", provider);
+            switch_event_add_header_string(event, SWITCH_STACK_BOTTOM, "Push-Token", d.first.c_str());
+            switch_event_add_header_string(event, SWITCH_STACK_BOTTOM, "Push-Reason", d.second.c_str());
+            switch_event_add_header_string(event, SWITCH_STACK_BOTTOM, "Unique-ID", call_id.c_str());
+            switch_event_fire(&event);
+        }
+    }
 
-            switch_curl_easy_cleanup(cli);
-            switch_curl_slist_free_all(headers);
-        };
+    bool ServerImpl::DeadPushToken(const std::string &token) {
+        return push_dead_tokens_->Dead(token);
+    }
+
+    PushCallbacks *ServerImpl::Callbacks() {
+        return &this->push_callbacks_;
+    }
 
-        return response_code;
+    int ServerImpl::PushTimeout() const {
+        return this->push_timeout_ms;
     }
 
     bool ServerImpl::UseFCM() const {
@@ -1151,19 +1709,9 @@ namespace mod_grpc {
         return this->auto_answer_delay;
     }
 
-    AsyncClientCall* ServerImpl::AsyncStreamPCMA(int64_t  domain_id, const char *uuid, const char *name, int32_t rate) {
-        return amdClient_->Stream(domain_id, uuid, name, rate);
-    }
-
-    static void split_str(const std::string& str, const std::string& delimiter, std::vector<std::string> &out) {
-        size_t pos = 0;
-        std::string s = str;
-        while ((pos = s.find(delimiter)) != std::string::npos) {
-            out.push_back(s.substr(0, pos));
-            s.erase(0, pos + delimiter.length());
-        }
-
-        out.push_back(s);
+    AsyncClientCall* ServerImpl::AsyncStreamPCMA(int64_t  domain_id, const char *uuid, const char *name, int32_t rate,
+                                                 const char *mime_type, int sample_bytes, bool continuous) {
+        return amdClient_->Stream(domain_id, uuid, name, rate, mime_type, sample_bytes, continuous);
     }
 
     static switch_status_t wbt_tweaks_on_reporting(switch_core_session_t *session) {
@@ -1295,21 +1843,30 @@ namespace mod_grpc {
                     if (var) {
                         auto tmp = atoi(var);
                         if (tmp) {
-                            ud->vad = switch_vad_init((int) ud->read_impl.actual_samples_per_second, 1);
                             ud->stop_vad_on_answer =
                                     switch_true(switch_channel_get_variable(ud->channel, "wbt_ai_vad_stop_on_answer")) == 1;
-                            switch_vad_set_param(ud->vad, "thresh", tmp);
-                            switch_log_printf(
-                                    SWITCH_CHANNEL_SESSION_LOG(ud->session),
-                                    SWITCH_LOG_DEBUG,
-                                    "amd use vad thresh %d \n", tmp);
+                            var = switch_channel_get_variable(ud->channel, "wbt_ai_vad_engine");
+                            if (var && !strcasecmp(var, "energy")) {
+                                ud->energy_vad = new EnergyVad((int) ud->read_impl.actual_samples_per_second, tmp);
+                                switch_log_printf(
+                                        SWITCH_CHANNEL_SESSION_LOG(ud->session),
+                                        SWITCH_LOG_DEBUG,
+                                        "amd use energy vad thresh %d \n", tmp);
+                            } else {
+                                ud->vad = switch_vad_init((int) ud->read_impl.actual_samples_per_second, 1);
+                                switch_vad_set_param(ud->vad, "thresh", tmp);
+                                switch_log_printf(
+                                        SWITCH_CHANNEL_SESSION_LOG(ud->session),
+                                        SWITCH_LOG_DEBUG,
+                                        "amd use vad thresh %d \n", tmp);
 
-                            if ((var = switch_channel_get_variable(ud->channel, "wbt_ai_vad_debug"))) {
-                                tmp = atoi(var);
-                                if (tmp < 0) tmp = 0;
+                                if ((var = switch_channel_get_variable(ud->channel, "wbt_ai_vad_debug"))) {
+                                    tmp = atoi(var);
+                                    if (tmp < 0) tmp = 0;
 
-                                switch_vad_set_param(ud->vad, "debug", tmp);
-                            };
+                                    switch_vad_set_param(ud->vad, "debug", tmp);
+                                };
+                            }
                         }
                         var = switch_channel_get_variable(ud->channel, "wbt_vad_max_silence_sec");
                         if (var) {
@@ -1325,13 +1882,29 @@ namespace mod_grpc {
 
                     }
 
-                    if (ud->read_impl.actual_samples_per_second != MODEL_RATE) {
+                    // local decisions after the answer, off by default
+                    {
+                        auto silence_ms = (var = switch_channel_get_variable(ud->channel, "wbt_ai_local_silence_ms")) ? atoi(var) : 0;
+                        auto beep_ms = (var = switch_channel_get_variable(ud->channel, "wbt_ai_local_beep_ms")) ? atoi(var) : 0;
+                        auto fax = switch_true(switch_channel_get_variable(ud->channel, "wbt_ai_local_fax")) == 1;
+                        if (silence_ms > 0 || beep_ms > 0 || fax) {
+                            var = switch_channel_get_variable(ud->channel, "wbt_ai_vad_threshold");
+                            ud->prefilter = new AmdPrefilter(var ? atoi(var) : 0, silence_ms, fax, beep_ms);
+                            switch_log_printf(
+                                    SWITCH_CHANNEL_SESSION_LOG(ud->session),
+                                    SWITCH_LOG_DEBUG,
+                                    "amd use local silence %d ms, beep %d ms, fax %d \n", silence_ms, beep_ms, fax);
+                        }
+                    }
+
+                    ud->resampler = nullptr;
+                    // integer ratio (16k, 48k) goes to the FIR decimator, the rest to speex
+                    ud->decimator = Decimator::create(ud->read_impl.actual_samples_per_second, MODEL_RATE);
+                    if (!ud->decimator && ud->read_impl.actual_samples_per_second != MODEL_RATE) {
                         switch_resample_create(&ud->resampler,
                                                ud->read_impl.actual_samples_per_second,
                                                MODEL_RATE,
                                                320, SWITCH_RESAMPLE_QUALITY, 1);
-                    } else {
-                        ud->resampler = nullptr;
                     }
                 } catch (...) {
                     switch_log_printf(
@@ -1349,22 +1922,57 @@ namespace mod_grpc {
                     if (ud->resampler) {
                         switch_resample_destroy(&ud->resampler);
                     }
-
+                    delete ud->decimator;
+                    ud->decimator = nullptr;
+                    delete ud->prefilter;
+                    ud->prefilter = nullptr;
+
+                    if (!ud->local_result.empty() || !ud->early_result.empty()) {
+                        // the model answer is not needed
+                        ud->client_->context.TryCancel();
+                    }
                     ud->client_->Finish();
 
+                    switch_channel_set_variable_printf(ud->channel, WBT_AMD_AI_FRAMES, "%lu", (unsigned long) ud->client_->Frames());
+                    switch_channel_set_variable_printf(ud->channel, WBT_AMD_AI_DROPPED, "%lu", (unsigned long) ud->client_->Dropped());
+                    if (ud->client_->Aborted()) {
+                        switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(ud->session), SWITCH_LOG_WARNING, "AMD stream is too slow, abort\n");
+                        switch_channel_set_variable(ud->channel, WBT_AMD_AI_ERROR, "ai_backpressure");
+                    }
+
                     std::string amd_result;
                     std::vector<std::string> amd_results(ud->client_->reply.results().begin(), ud->client_->reply.results().end());
 
                     bool skip_hangup = false;
 
-                    if (ud->client_->reply.result().empty()) {
+                    // confidence and elapsed are of the final result: the early partial keeps its own,
+                    // the model reply sets them, a result without the model clears the partial ones
+                    if (!ud->local_result.empty()) {
+                        amd_result = ud->local_result;
+                        amd_results.assign(1, amd_result);
+                        switch_channel_set_variable(ud->channel, WBT_AMD_AI_LOCAL, "true");
+                        switch_channel_set_variable(ud->channel, WBT_AMD_AI_CONFIDENCE, nullptr);
+                        switch_channel_set_variable(ud->channel, WBT_AMD_AI_ELAPSED_MS, nullptr);
+                    } else if (!ud->early_result.empty()) {
+                        amd_result = ud->early_result;
+                    } else if (ud->client_->reply.result().empty()) {
                         amd_result = "undefined";
-                        if (ud->vad && switch_channel_test_flag(ud->channel, CF_ANSWERED)) {
+                        if ((ud->vad || ud->energy_vad) && switch_channel_test_flag(ud->channel, CF_ANSWERED)) {
                             amd_result = "silence";
                         }
+                        switch_channel_set_variable(ud->channel, WBT_AMD_AI_CONFIDENCE, nullptr);
+                        switch_channel_set_variable(ud->channel, WBT_AMD_AI_ELAPSED_MS, nullptr);
 //                        switch_channel_set_variable(ud->channel, "execute_on_answer", NULL); // TODO
                     } else {
                         amd_result = ud->client_->reply.result();
+                        if (ud->client_->reply.confidence() > 0) {
+                            switch_channel_set_variable_printf(ud->channel, WBT_AMD_AI_CONFIDENCE, "%.3f",
+                                                               ud->client_->reply.confidence());
+                        } else {
+                            switch_channel_set_variable(ud->channel, WBT_AMD_AI_CONFIDENCE, nullptr);
+                        }
+                        switch_channel_set_variable_printf(ud->channel, WBT_AMD_AI_ELAPSED_MS, "%ld",
+                                                           (long) ud->client_->reply_elapsed_ms);
                     }
 
                     for (auto &l : ud->positive) {
@@ -1378,8 +1986,10 @@ namespace mod_grpc {
                     if (ud->vad) {
                         switch_vad_destroy(&ud->vad);
                     }
+                    delete ud->energy_vad;
 
                     switch_channel_set_variable(ud->channel, WBT_AMD_AI, amd_result.c_str());
+                    switch_channel_set_variable(ud->channel, WBT_AMD_AI_PARTIAL, nullptr);
                     for (auto &r : amd_results) {
                         switch_channel_add_variable_var_check(ud->channel, WBT_AMD_AI_LOG, r.c_str(), SWITCH_FALSE, SWITCH_STACK_PUSH);
                     }
@@ -1438,22 +2048,33 @@ namespace mod_grpc {
                     };
 
                     switch_vad_state_t vad_state = SWITCH_VAD_STATE_ERROR;
+                    int32_t energy = 0;
 
-                    if (ud->vad) {
+                    if (ud->vad || ud->energy_vad) {
                         if (!ud->answered) {
                             ud->answered = switch_channel_test_flag(ud->channel, CF_ANSWERED) ;
                         }
                         if (ud->stop_vad_on_answer && ud->answered) {
-                            switch_vad_destroy(&ud->vad);
-                            ud->vad = nullptr;
+                            if (ud->vad) {
+                                switch_vad_destroy(&ud->vad);
+                                ud->vad = nullptr;
+                            }
+                            delete ud->energy_vad;
+                            ud->energy_vad = nullptr;
                         } else {
-                            vad_state = SWITCH_VAD_STATE_NONE;
-                            vad_state = switch_vad_process(ud->vad, (int16_t *) read_frame.data,
-                                                           read_frame.datalen / 2);
+                            if (ud->energy_vad) {
+                                vad_state = ud->energy_vad->process((int16_t *) read_frame.data, read_frame.datalen / 2);
+                                energy = ud->energy_vad->energy();
+                            } else {
+                                vad_state = switch_vad_process(ud->vad, (int16_t *) read_frame.data,
+                                                               read_frame.datalen / 2);
+                            }
                             if (vad_state == SWITCH_VAD_STATE_STOP_TALKING) {
                                 switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(ud->session), SWITCH_LOG_DEBUG, "amd vad reset: %s\n",
                                                   switch_vad_state2str(vad_state));
-                                switch_vad_reset(ud->vad);
+                                if (ud->vad) {
+                                    switch_vad_reset(ud->vad);
+                                }
                             }
 
                             if (ud->max_silence_sec) {
@@ -1470,15 +2091,61 @@ namespace mod_grpc {
                         }
                     }
 
-                    if (ud->resampler) {
-                        uint8_t resample_data[SWITCH_RECOMMENDED_BUFFER_SIZE];
-                        auto data = (int16_t *) read_frame.data;
-                        switch_resample_process(ud->resampler, data, (int) read_frame.datalen / 2);
-                        auto linear_len = ud->resampler->to_len * 2;
-                        memcpy(resample_data, ud->resampler->to, linear_len);
-                        ud->client_->Write(resample_data, linear_len, vad_state);
+                    auto linear = (int16_t *) read_frame.data;
+                    size_t samples = read_frame.datalen / 2;
+                    // the prefilter and the encoder read the decimated frame here, Write copies it into the ring
+                    int16_t decimated[SWITCH_RECOMMENDED_BUFFER_SIZE / 2 + 1];
+                    if (ud->decimator) {
+                        if (samples > SWITCH_RECOMMENDED_BUFFER_SIZE) {
+                            samples = SWITCH_RECOMMENDED_BUFFER_SIZE;
+                        }
+                        samples = ud->decimator->process(linear, samples, decimated);
+                        linear = decimated;
+                    } else if (ud->resampler) {
+                        switch_resample_process(ud->resampler, linear, (int) samples);
+                        linear = ud->resampler->to;
+                        samples = ud->resampler->to_len;
+                    }
+
+                    if (ud->prefilter && switch_channel_test_flag(ud->channel, CF_ANSWERED)) {
+                        auto label = ud->prefilter->process(linear, samples);
+                        if (label) {
+                            switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(ud->session), SWITCH_LOG_DEBUG, "amd local result: %s\n", label);
+                            ud->local_result = label;
+                            return SWITCH_FALSE;
+                        }
+                    }
+
+                    if (ud->encode) {
+                        uint8_t encoded[SWITCH_RECOMMENDED_BUFFER_SIZE];
+                        if (samples > sizeof(encoded)) {
+                            samples = sizeof(encoded);
+                        }
+                        ud->encode(linear, encoded, samples);
+                        ud->client_->Write(encoded, samples, vad_state, energy);
                     } else {
-                        ud->client_->Write(read_frame.data, read_frame.datalen, vad_state);
+                        ud->client_->Write(linear, samples * 2, vad_state, energy);
+                    }
+
+                    if (!ud->decision.empty()) {
+                        ud->client_->TakePartials(ud->partials);
+                        for (auto &p : ud->partials) {
+                            switch_channel_set_variable(ud->channel, WBT_AMD_AI, p.label.c_str());
+                            switch_channel_set_variable(ud->channel, WBT_AMD_AI_PARTIAL, "true");
+                            switch_channel_set_variable_printf(ud->channel, WBT_AMD_AI_CONFIDENCE, "%.3f", p.confidence);
+                            switch_channel_set_variable_printf(ud->channel, WBT_AMD_AI_ELAPSED_MS, "%ld", (long) p.elapsed_ms);
+                            amd_fire_event(ud->channel);
+
+                            for (auto &rule : ud->decision) {
+                                if ((rule.first == "*" || rule.first == p.label) && p.confidence >= rule.second) {
+                                    switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(ud->session), SWITCH_LOG_DEBUG,
+                                                      "amd early result: %s [%.3f] after %ld ms\n", p.label.c_str(),
+                                                      p.confidence, (long) p.elapsed_ms);
+                                    ud->early_result = p.label;
+                                    return SWITCH_FALSE;
+                                }
+                            }
+                        }
                     }
 
                     if (ud->client_->Finished()) {
@@ -1542,10 +2209,31 @@ namespace mod_grpc {
 
         ud = new Stream;
         ud->session = session;
+        ud->decimator = nullptr;
+        ud->prefilter = nullptr;
         ud->channel = channel;
         ud->positive = std::move(positive_labels);
-        ud->client_ = server_->AsyncStreamPCMA(domain_id, switch_channel_get_uuid(channel), switch_channel_get_uuid(channel), MODEL_RATE);
+        // pcma or pcmu, 16 bit linear by default (sent with the legacy audio/pcma type)
+        tmp = switch_channel_get_variable(channel, "wbt_ai_codec");
+        ud->encode = g711_encoder(tmp);
+        // human:0.8,machine:0.9 - every response is read and sent as amd::info, the first match decides
+        tmp = switch_channel_get_variable(channel, "wbt_ai_decision");
+        if (!zstr(tmp)) {
+            std::vector<std::string> rules;
+            split_str(tmp, ",", rules);
+            for (auto &r : rules) {
+                auto pos = r.find(':');
+                auto label = r.substr(0, pos);
+                if (!label.empty()) {
+                    ud->decision.emplace_back(label, pos == std::string::npos ? 0.0f : (float) atof(r.c_str() + pos + 1));
+                }
+            }
+        }
+        ud->client_ = server_->AsyncStreamPCMA(domain_id, switch_channel_get_uuid(channel), switch_channel_get_uuid(channel), MODEL_RATE,
+                                               ud->encode == ulaw_encode ? G711_MIME_PCMU : G711_MIME_PCMA, ud->encode ? 1 : 2,
+                                               !ud->decision.empty());
         ud->vad = nullptr;
+        ud->energy_vad = nullptr;
         ud->max_silence_sec = 0;
         ud->silence_ms = 0;
 
@@ -1595,36 +2283,59 @@ namespace mod_grpc {
         switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "checking tweaks for %s\n", uuid);
         const char *wbt_push_fcm = switch_channel_get_variable(channel, "wbt_push_fcm");
         const char *wbt_push_apn = switch_channel_get_variable(channel, "wbt_push_apn");
-        int send = 0;
+        bool send = false;
         auto pData = get_push_body(uuid, channel, server_->AutoAnswerDelayTime());
+        // all pushes go at once, the first accepted one is enough
+        auto wait = std::make_shared<PushWait>();
+        bool queued = false;
+        std::shared_ptr<PushCallbacks::Waiter> callback;
+        if (server_->PushWaitCallback() > 0) {
+            callback = server_->Callbacks()->Add(uuid);
+        }
 
         if (wbt_push_fcm && server_->UseFCM()) {
-            switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "start request FCM %s\n", uuid);
-            auto res = server_->SendPushFCM(wbt_push_fcm, pData);
-            switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "stop request FCM %s [%ld]\n", uuid, res);
-            if (res == 200) {
-                send++;
+            std::vector <std::string> out;
+            std::string devices;
+            split_str(wbt_push_fcm, "::", out, true);
+            for (const auto &token: out) {
+                if (server_->DeadPushToken(token)) {
+                    switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "skip FCM %s invalid token %s\n", uuid, token.c_str());
+                    continue;
+                }
+                devices += devices.empty() ? token : "::" + token;
+            }
+            if (!devices.empty()) {
+                switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "start request FCM %s\n", uuid);
+                server_->SendPushFCM(devices.c_str(), pData, wait);
+                queued = true;
             }
         }
         if (wbt_push_apn && server_->UseAPN()) {
             std::vector <std::string> out;
-            split_str(wbt_push_apn, "::", out);
+            split_str(wbt_push_apn, "::", out, true);
             switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "start APN request %s tokens[%s]\n", uuid, wbt_push_apn);
             for (const auto &token: out) {
-                switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "start APN request %s\n", uuid);
-                auto res = server_->SendPushAPN(token.c_str(), pData);
-                switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "stop APN request %s [%ld]\n", uuid, res);
-                if (res == 200) {
-                    send++;
+                if (server_->DeadPushToken(token)) {
+                    switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "skip APN %s invalid token %s\n", uuid, token.c_str());
+                    continue;
                 }
+                server_->SendPushAPN(token.c_str(), pData, wait);
+                queued = true;
             }
         }
 
-        if (send && server_->PushWaitCallback() > 0) {
+        if (queued) {
+            send = wait->Wait(server_->PushTimeout());
+            switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "push %s accepted: %d\n", uuid, send);
+        }
+
+        if (send && callback && !switch_channel_down(channel)) {
             switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "start wait callback %s [%d]\n", uuid, server_->PushWaitCallback());
-            switch_channel_wait_for_flag(channel, CF_SLA_INTERCEPT, SWITCH_TRUE, server_->PushWaitCallback(), NULL); //10s
-            switch_channel_clear_flag(channel, CF_SLA_INTERCEPT);
-            switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "stop wait callback %s\n", uuid);
+            auto confirmed = PushCallbacks::Wait(callback, server_->PushWaitCallback());
+            switch_log_printf(SWITCH_CHANNEL_SESSION_LOG(session), SWITCH_LOG_DEBUG, "stop wait callback %s confirmed: %d\n", uuid, confirmed);
+        }
+        if (callback) {
+            server_->Callbacks()->Remove(uuid, callback);
         }
         delete pData;
     }
@@ -1684,6 +2395,15 @@ namespace mod_grpc {
         return SWITCH_STATUS_SUCCESS;
     }
 
+    SWITCH_STANDARD_API(amd_stats_api_function) {
+        std::string out;
+        if (server_) {
+            server_->AMDStats(out);
+        }
+        stream->write_function(stream, "%s", out.empty() ? "AMD AI disabled\n" : out.c_str());
+        return SWITCH_STATUS_SUCCESS;
+    }
+
     SWITCH_MODULE_LOAD_FUNCTION(mod_grpc_load) {
         try {
             *module_interface = switch_loadable_module_create_module_interface(pool, modname);
@@ -1696,8 +2416,13 @@ namespace mod_grpc {
                 wbt_state_handlers.on_init = wbt_tweaks_on_init;
                 switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "Use session heartbeat, %d seconds\n", heartbeat_interval);
             }
+            if (config.call_event_format && !strcasecmp(config.call_event_format, DATA_FORMAT_PROTOBUF)) {
+                BaseCallEvent::setProtobufFormat(true);
+                switch_log_printf(SWITCH_CHANNEL_LOG, SWITCH_LOG_DEBUG, "Use protobuf call event payload\n");
+            }
             switch_core_add_state_handler(&wbt_state_handlers);
             SWITCH_ADD_API(api_interface, "wbt_version", "Show build version", version_api_function, "");
+            SWITCH_ADD_API(api_interface, "wbt_amd_stats", "Show AMD AI streams", amd_stats_api_function, "");
             SWITCH_ADD_APP(app_interface, "wbt_queue", "wbt_queue", "wbt_queue", wbr_queue_function, "", SAF_NONE);
             SWITCH_ADD_APP(app_interface, "wbt_send_hook", "wbt_send_hook", "wbt_send_hook", wbr_send_hook_function, "", SAF_NONE | SAF_SUPPORT_NOMEDIA);
             SWITCH_ADD_APP(app_interface, "wbt_blind_transfer", "wbt_blind_transfer", "wbt_blind_transfer",
@@ -1714,6 +2439,7 @@ namespace mod_grpc {
                     SAF_NONE);
 
             switch_event_reserve_subclass("SWITCH_EVENT_CUSTOM::" EVENT_NAME);
+            switch_event_reserve_subclass(PUSH_INVALID_TOKEN_EVENT_NAME);
 
             server_ = new ServerImpl(config);
 
@@ -1738,6 +2464,7 @@ namespace mod_grpc {
     SWITCH_MODULE_SHUTDOWN_FUNCTION(mod_grpc_shutdown) {
         try {
             switch_event_free_subclass("SWITCH_EVENT_CUSTOM::" EVENT_NAME);
+            switch_event_free_subclass(PUSH_INVALID_TOKEN_EVENT_NAME);
             switch_core_remove_state_handler(&wbt_state_handlers);
             server_->Shutdown();
             delete server_;
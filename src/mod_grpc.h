@@ -6,6 +6,7 @@ extern "C" {
 }
 
 #include <thread>
+#include <unordered_map>
 
 #include <grpcpp/grpcpp.h>
 #include <grpc/support/log.h>
@@ -14,8 +15,21 @@ extern "C" {
 #include "generated/stream.grpc.pb.h"
 #include "Cluster.h"
 #include "amd_client.h"
+#include "g711.h"
+#include "resampler.h"
+#include "vad.h"
+#include "amd_prefilter.h"
+#include "async_server.h"
+#include "PushDispatcher.h"
+#include "PushTemplate.h"
+#include "PushTokenCache.h"
 
 #define GRPC_SUCCESS_ORIGINATE "grpc_originate_success"
+#define GRPC_ORIGINATE_PROGRESS "mod_grpc_originate"
+#define GRPC_PUSH_CALLBACK "mod_grpc_push_callback"
+#define PUSH_INVALID_TOKEN_EVENT_NAME "push::invalid_token"
+#define SERVER_SHUTDOWN_TIMEOUT_SEC 5
+#define ORIGINATE_BATCH_SLOT_WAIT_US 10000
 
 #ifndef MOD_BUILD_VERSION
 #define MOD_BUILD_VERSION "DEV"
@@ -36,10 +50,19 @@ namespace mod_grpc {
         switch_core_session_t *session;
         switch_channel_t *channel;
         switch_audio_resampler_t *resampler;
+        Decimator *decimator;
+        AmdPrefilter *prefilter;
+        std::string local_result;
+        // wbt_ai_decision: label (* - any) and minimal confidence of an early result
+        std::vector<std::pair<std::string, float>> decision;
+        std::string early_result;
+        std::vector<AMDPartial> partials;
         switch_codec_implementation_t read_impl;
         std::vector<std::string> positive;
         AsyncClientCall* client_;
+        g711_encode_t encode;
         switch_vad_t *vad;
+        EnergyVad *energy_vad;
         bool stop_vad_on_answer;
         int max_silence_sec;
         int silence_ms;
@@ -71,69 +94,108 @@ namespace mod_grpc {
     static inline void fire_event(switch_channel_t *channel, const char *name);
 
     // Logic and data behind the server's behavior.
-    class ApiServiceImpl final : public fs::Api::Service {
-    private:
+    // Handlers are dispatched from the completion queues of ServerImpl.
+    class ApiServiceImpl final {
+    public:
         Status Originate(ServerContext* context, const fs::OriginateRequest* request,
-                         fs::OriginateResponse* reply) override;
+                         fs::OriginateResponse* reply);
 
         Status Execute(ServerContext* context, const fs::ExecuteRequest* request,
-                        fs::ExecuteResponse* reply) override;
+                        fs::ExecuteResponse* reply);
 
         Status SetVariables(ServerContext* context, const fs::SetVariablesRequest* request,
-                            fs::SetVariablesResponse* reply) override;
+                            fs::SetVariablesResponse* reply);
 
         Status Bridge(ServerContext* context, const fs::BridgeRequest* request,
-                      fs::BridgeResponse* reply) override;
+                      fs::BridgeResponse* reply);
 
         Status BridgeCall(ServerContext* context, const fs::BridgeCallRequest* request,
-                      fs::BridgeCallResponse* reply) override;
+                      fs::BridgeCallResponse* reply);
 
         Status StopPlayback(ServerContext* context, const fs::StopPlaybackRequest* request,
-                      fs::StopPlaybackResponse* reply) override;
+                      fs::StopPlaybackResponse* reply);
 
         Status Hangup(ServerContext* context, const fs::HangupRequest* request,
-                        fs::HangupResponse* reply) override;
+                        fs::HangupResponse* reply);
 
         Status HangupMatchingVars(ServerContext* context, const fs::HangupMatchingVarsReqeust* request,
-                                  fs::HangupMatchingVarsResponse* reply) override;
+                                  fs::HangupMatchingVarsResponse* reply);
 
         Status Queue(ServerContext* context, const fs::QueueRequest* request,
-                                  fs::QueueResponse* reply) override;
+                                  fs::QueueResponse* reply);
 
         Status HangupMany(ServerContext* context, const fs::HangupManyRequest* request,
-                      fs::HangupManyResponse* reply) override;
+                      fs::HangupManyResponse* reply);
 
         Status Hold(ServerContext* context, const fs::HoldRequest* request,
-                      fs::HoldResponse* reply) override;
+                      fs::HoldResponse* reply);
 
         Status UnHold(ServerContext* context, const fs::UnHoldRequest* request,
-                      fs::UnHoldResponse* reply) override;
+                      fs::UnHoldResponse* reply);
 
         Status SetProfileVar(ServerContext* context, const fs::SetProfileVarRequest* request,
-                      fs::SetProfileVarResponse* reply) override;
+                      fs::SetProfileVarResponse* reply);
 
         Status ConfirmPush(ServerContext* context, const fs::ConfirmPushRequest* request,
-                           fs::ConfirmPushResponse* reply) override;
+                           fs::ConfirmPushResponse* reply);
 
         Status Broadcast(ServerContext* context, const fs::BroadcastRequest* request,
-                           fs::BroadcastResponse* reply) override;
+                           fs::BroadcastResponse* reply);
 
         Status SetEavesdropState(::grpc::ServerContext* context, const ::fs::SetEavesdropStateRequest* request,
-                                 ::fs::SetEavesdropStateResponse* reply) override;
+                                 ::fs::SetEavesdropStateResponse* reply);
 
-        Status BlindTransfer(::grpc::ServerContext* context, const ::fs::BlindTransferRequest* request, ::fs::BlindTransferResponse* response) override;
+        Status BlindTransfer(::grpc::ServerContext* context, const ::fs::BlindTransferRequest* request, ::fs::BlindTransferResponse* response);
 
-        Status BreakPark(::grpc::ServerContext* context, const ::fs::BreakParkRequest* request, ::fs::BreakParkResponse* response) override;
+        Status BreakPark(::grpc::ServerContext* context, const ::fs::BreakParkRequest* request, ::fs::BreakParkResponse* response);
 
     };
 
-    struct PushData {
-        std::string call_id;
-        std::string from_number;
-        std::string from_name;
-        std::string direction;
-        int auto_answer;
-        int delay;
+    // OriginateAsync: replies with the new uuid, then streams the progress of the call
+    class OriginateAsyncCall final : public ServerStreamCall<fs::OriginateRequest, fs::OriginateAsyncResponse> {
+    public:
+        OriginateAsyncCall(fs::Api::AsyncService *service, ServerCompletionQueue *cq, std::atomic<int> *detached);
+        static void handle_progress_event(switch_event_t *event);
+
+    protected:
+        void Spawn() override;
+        void OnRequest() override;
+
+    private:
+        static void *SWITCH_THREAD_FUNC run(switch_thread_t *thread, void *obj);
+
+        static std::mutex calls_mutex_;
+        static std::unordered_map<std::string, OriginateAsyncCall *> calls_;
+        std::atomic<int> *detached_;
+        std::string uuid_;
+        bool preset_uuid_;
+    };
+
+    // OriginateBatch: runs the requests on pool threads with a rate limit, streams a result per request.
+    // Parallel originates of all batches are capped by one server wide counter
+    class OriginateBatchCall final : public ServerStreamCall<fs::OriginateBatchRequest, fs::OriginateBatchResponse> {
+    public:
+        OriginateBatchCall(fs::Api::AsyncService *service, ServerCompletionQueue *cq, std::atomic<int> *detached,
+                           std::atomic<int> *active, int max_concurrency);
+
+    protected:
+        void Spawn() override;
+        void OnRequest() override;
+
+    private:
+        static void *SWITCH_THREAD_FUNC run(switch_thread_t *thread, void *obj);
+        void waitRate();
+        bool acquireSlot();
+
+        std::atomic<int> *detached_;
+        // originates in progress of all batches
+        std::atomic<int> *active_;
+        int max_concurrency_;
+        std::atomic<int> next_;
+        std::atomic<int> workers_;
+        switch_time_t interval_;
+        std::mutex rate_mutex_;
+        switch_time_t next_time_;
     };
 
     struct Config {
@@ -141,9 +203,24 @@ namespace mod_grpc {
         int consul_tts_sec;
         int consul_deregister_critical_tts_sec;
         char const *amd_ai_address;
+        int amd_ai_channels;
+        int amd_ai_eject_sec;
+        int amd_ai_threads;
+        int amd_ai_buffer_frames;
+        char const *amd_ai_overflow;
+        int amd_ai_aggregate_ms;
+        int amd_ai_warm_streams;
         char const *grpc_host;
         int grpc_port;
+        int grpc_cq_count;
+        int grpc_cq_threads;
+        int originate_batch_concurrency;
         int heartbeat;
+        char const *call_event_format;
+        int event_workers;
+        int event_queue_size;
+        int event_heartbeat_batch_ms;
+        int event_dtmf_window_ms;
 
         int auto_answer_delay;
 
@@ -153,6 +230,11 @@ namespace mod_grpc {
         char const *push_fcm_uri;
 
         int push_apn_enabled;
+        int push_timeout_ms;
+        int push_connections;
+        int push_keepalive_sec;
+        int push_dead_tokens;
+        int push_dead_token_ttl_sec;
         char const *push_apn_uri;
         char const *push_apn_cert_file;
         char const *push_apn_key_file;
@@ -168,26 +250,44 @@ namespace mod_grpc {
         ~ServerImpl() = default;
         void Run();
         void Shutdown();
-        std::shared_ptr<grpc::Channel> AMDAiChannel();
         bool AllowAMDAi() const;
+        void AMDStats(std::string &out);
 
         int PushWaitCallback() const;
         int AutoAnswerDelayTime() const;
-        long SendPushFCM(const char *devices, const PushData *data);
-        long SendPushAPN(const char *devices, const PushData *data);
+        void SendPushFCM(const char *devices, const PushData *data, const std::shared_ptr<PushWait> &wait);
+        void SendPushAPN(const char *devices, const PushData *data, const std::shared_ptr<PushWait> &wait);
+        int PushTimeout() const;
+        void setupConnection(CURL *cli);
+        void setupFCM(CURL *cli);
+        void setupAPN(CURL *cli);
+        // skips the tokens rejected by the providers
+        bool DeadPushToken(const std::string &token);
+        PushCallbacks *Callbacks();
         bool UseFCM() const;
         bool UseAPN() const;
-        AsyncClientCall* AsyncStreamPCMA(int64_t  domain_id, const char *uuid, const char *name, int32_t rate);
+        AsyncClientCall* AsyncStreamPCMA(int64_t  domain_id, const char *uuid, const char *name, int32_t rate,
+                                         const char *mime_type, int sample_bytes, bool continuous);
     private:
         void initServer();
+        void pushAnswer(const PushRequest *req, long code, const char *provider, const std::string &call_id);
+        void HandleRpcs(ServerCompletionQueue *cq);
+        template<class Req, class Resp>
+        void requestCall(ServerCompletionQueue *cq, typename UnaryCall<Req, Resp>::RequestMethod request,
+                         Status (ApiServiceImpl::*handler)(ServerContext *, const Req *, Resp *), bool detached);
         std::unique_ptr<Server> server_;
+        fs::Api::AsyncService service_;
         ApiServiceImpl api_;
         Cluster *cluster_;
         std::string server_address_;
-        std::thread thread_;
-        std::shared_ptr<grpc::Channel> amdAiChannel_;
+        std::vector<std::unique_ptr<ServerCompletionQueue>> cqs_;
+        std::vector<std::thread> pollers_;
+        int cq_count_;
+        int cq_threads_;
+        int batch_concurrency_;
+        std::atomic<int> batch_active_;
+        std::atomic<int> detached_calls_;
         bool allowAMDAi;
-        grpc::CompletionQueue cq_;
         int push_wait_callback;
         bool push_fcm_enabled;
         std::string push_fcm_auth;
@@ -199,6 +299,19 @@ namespace mod_grpc {
         std::string push_apn_cert_file;
         std::string push_apn_key_file;
         std::string push_apn_key_pass;
+        // loaded once for all connections
+        std::string push_apn_cert;
+        std::string push_apn_key;
+        int push_timeout_ms;
+        int push_keepalive_sec;
+        int push_fcm_provider;
+        int push_apn_provider;
+        // compiled at load, time_to_live depends on push_wait_callback
+        std::unique_ptr<PushTemplate> push_fcm_body_;
+        std::unique_ptr<PushTemplate> push_apn_body_;
+        std::unique_ptr<PushTokenCache> push_dead_tokens_;
+        PushCallbacks push_callbacks_;
+        std::unique_ptr<PushDispatcher> pushDispatcher_;
         int auto_answer_delay;
         std::unique_ptr<AMDClient> amdClient_;
     };
@@ -0,0 +1,133 @@
+//
+// Created by root on 17.10.26.
+//
+
+#include "resampler.h"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define DECIMATOR_X86 1
+#endif
+
+namespace mod_grpc {
+
+    static int32_t dot_scalar(const int16_t *x, const int16_t *h, size_t taps) {
+        int32_t sum = 0;
+        for (size_t i = 0; i < taps; i++) {
+            sum += static_cast<int32_t>(x[i]) * h[i];
+        }
+        return sum;
+    }
+
+#ifdef DECIMATOR_X86
+    // taps is a multiple of 16
+
+    static int32_t dot_sse2(const int16_t *x, const int16_t *h, size_t taps) {
+        __m128i acc = _mm_setzero_si128();
+        for (size_t i = 0; i < taps; i += 8) {
+            auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(x + i));
+            auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(h + i));
+            acc = _mm_add_epi32(acc, _mm_madd_epi16(a, b));
+        }
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(acc);
+    }
+
+    __attribute__((target("avx2")))
+    static int32_t dot_avx2(const int16_t *x, const int16_t *h, size_t taps) {
+        __m256i acc = _mm256_setzero_si256();
+        for (size_t i = 0; i < taps; i += 16) {
+            auto a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x + i));
+            auto b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(h + i));
+            acc = _mm256_add_epi32(acc, _mm256_madd_epi16(a, b));
+        }
+        __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+        sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(sum);
+    }
+#endif
+
+    Decimator::dot_t Decimator::select(Kernel kernel) {
+        switch (kernel) {
+            case KERNEL_SCALAR:
+                return dot_scalar;
+#ifdef DECIMATOR_X86
+            case KERNEL_SSE2:
+                return __builtin_cpu_supports("sse2") ? dot_sse2 : nullptr;
+            case KERNEL_AVX2:
+                return __builtin_cpu_supports("avx2") ? dot_avx2 : nullptr;
+            case KERNEL_AUTO:
+                return __builtin_cpu_supports("avx2") ? dot_avx2 : dot_sse2;
+#else
+            case KERNEL_AUTO:
+                return dot_scalar;
+#endif
+            default:
+                return nullptr;
+        }
+    }
+
+    Decimator *Decimator::create(int from_rate, int to_rate, Kernel kernel) {
+        if (to_rate <= 0 || from_rate <= to_rate || from_rate % to_rate) {
+            return nullptr;
+        }
+        auto factor = from_rate / to_rate;
+        if (factor > DECIMATOR_MAX_FACTOR) {
+            return nullptr;
+        }
+        auto dot = select(kernel);
+        if (!dot) {
+            return nullptr;
+        }
+        return new Decimator(factor, dot);
+    }
+
+    Decimator::Decimator(int factor, dot_t dot) : factor_(factor), taps_(static_cast<size_t>(factor * DECIMATOR_TAPS_PER_FACTOR)),
+                                                  coeffs_(taps_), buf_(taps_ - 1, 0), phase_(0), dot_(dot) {
+        // cutoff at 0.45 of the output rate, Blackman window
+        const double fc = 0.45 / factor;
+        const double center = (taps_ - 1) / 2.0;
+        std::vector<double> h(taps_);
+        double total = 0;
+        for (size_t i = 0; i < taps_; i++) {
+            double t = i - center;
+            double sinc = 2 * fc * (t == 0 ? 1.0 : sin(2 * M_PI * fc * t) / (2 * M_PI * fc * t));
+            double w = 0.42 - 0.5 * cos(2 * M_PI * i / (taps_ - 1)) + 0.08 * cos(4 * M_PI * i / (taps_ - 1));
+            h[i] = sinc * w;
+            total += h[i];
+        }
+
+        // unity gain in Q15, the rounding error goes to the middle taps
+        int32_t sum = 0;
+        for (size_t i = 0; i < taps_; i++) {
+            coeffs_[i] = static_cast<int16_t>(lrint(h[i] / total * 32768.0));
+            sum += coeffs_[i];
+        }
+        coeffs_[taps_ / 2] += static_cast<int16_t>(32768 - sum);
+    }
+
+    size_t Decimator::process(const int16_t *in, size_t samples, int16_t *out) {
+        auto history = taps_ - 1;
+        buf_.resize(history + samples);
+        memcpy(buf_.data() + history, in, samples * sizeof(int16_t));
+
+        size_t count = 0;
+        size_t pos = phase_;
+        for (; pos < samples; pos += factor_) {
+            // window ends at the input sample pos
+            int32_t acc = dot_(buf_.data() + pos, coeffs_.data(), taps_);
+            acc = (acc + (1 << 14)) >> 15;
+            out[count++] = static_cast<int16_t>(acc > 32767 ? 32767 : (acc < -32768 ? -32768 : acc));
+        }
+        phase_ = pos - samples;
+
+        memmove(buf_.data(), buf_.data() + samples, history * sizeof(int16_t));
+        buf_.resize(history);
+        return count;
+    }
+}
@@ -0,0 +1,53 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_RESAMPLER_H
+#define MOD_GRPC_RESAMPLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#define DECIMATOR_MAX_FACTOR 6
+#define DECIMATOR_TAPS_PER_FACTOR 16
+
+namespace mod_grpc {
+
+    // Integer ratio down sampler (16k -> 8k, 48k -> 8k): windowed sinc low pass FIR in Q15,
+    // evaluated only at the kept samples. AVX2/SSE2 kernels are selected at runtime, all kernels give the same output.
+    class Decimator {
+    public:
+        // dot product of the filter, AUTO is the widest the CPU has
+        enum Kernel {
+            KERNEL_AUTO,
+            KERNEL_SCALAR,
+            KERNEL_SSE2,
+            KERNEL_AVX2
+        };
+
+        // nullptr if from_rate is not a multiple of to_rate up to DECIMATOR_MAX_FACTOR
+        // or the kernel is not supported
+        static Decimator *create(int from_rate, int to_rate, Kernel kernel = KERNEL_AUTO);
+
+        // returns the number of samples in out, out holds at least samples / factor + 1
+        size_t process(const int16_t *in, size_t samples, int16_t *out);
+
+    private:
+        typedef int32_t (*dot_t)(const int16_t *x, const int16_t *h, size_t taps);
+
+        Decimator(int factor, dot_t dot);
+        // nullptr if the CPU has no such kernel
+        static dot_t select(Kernel kernel);
+
+        int factor_;
+        size_t taps_;
+        std::vector<int16_t> coeffs_;
+        // taps - 1 samples of the previous frames and the current frame
+        std::vector<int16_t> buf_;
+        size_t phase_;
+        dot_t dot_;
+    };
+}
+
+#endif //MOD_GRPC_RESAMPLER_H
@@ -6,8 +6,34 @@
 #define MOD_GRPC_UTILS_H
 
 #include <switch.h>
+#include <cstring>
+#include <string>
 
 namespace mod_grpc {
+    // Non owning view of a NUL terminated string (C++14 has no std::string_view).
+    // Built only from C strings, so c_str() is always terminated.
+    class StrView {
+    public:
+        StrView() : data_(""), size_(0) {}
+        StrView(const char *s) : data_(s ? s : ""), size_(s ? strlen(s) : 0) {}
+        StrView(const std::string &s) : data_(s.c_str()), size_(s.size()) {}
+
+        inline const char *c_str() const { return data_; }
+        inline const char *data() const { return data_; }
+        inline size_t size() const { return size_; }
+        inline bool empty() const { return size_ == 0; }
+        inline std::string str() const { return std::string(data_, size_); }
+
+        inline bool operator==(const char *s) const { return strcmp(data_, s) == 0; }
+        inline bool operator!=(const char *s) const { return strcmp(data_, s) != 0; }
+        inline bool operator==(const StrView &s) const { return size_ == s.size_ && memcmp(data_, s.data_, size_) == 0; }
+        inline bool operator!=(const StrView &s) const { return !(*this == s); }
+
+    private:
+        const char *data_;
+        size_t size_;
+    };
+
     static long int unixTimestamp() {
         switch_time_t ts = switch_micro_time_now();
         return static_cast<long int> (ts/1000);
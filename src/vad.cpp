@@ -0,0 +1,93 @@
+//
+// Created by root on 17.10.26.
+//
+
+#include "vad.h"
+
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <emmintrin.h>
+#define ENERGY_VAD_SSE2 1
+#endif
+
+namespace mod_grpc {
+
+    void frame_stats(const int16_t *data, size_t samples, uint32_t *rms, uint32_t *crossings) {
+        uint64_t sum = 0;
+        uint32_t zc = 0;
+        size_t i = 0;
+
+#ifdef ENERGY_VAD_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        __m128i acc = _mm_setzero_si128();
+        // the next sample of the block is needed for the crossings
+        for (; i + 9 <= samples; i += 8) {
+            auto a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+            auto b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i + 1));
+            // a pair of squares fits into uint32
+            auto sq = _mm_madd_epi16(a, a);
+            acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(sq, zero));
+            acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(sq, zero));
+            auto changed = _mm_xor_si128(_mm_cmplt_epi16(a, zero), _mm_cmplt_epi16(b, zero));
+            zc += static_cast<uint32_t>(__builtin_popcount(_mm_movemask_epi8(changed))) / 2;
+        }
+        uint64_t lanes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+        sum = lanes[0] + lanes[1];
+#endif
+
+        for (; i < samples; i++) {
+            sum += static_cast<uint64_t>(static_cast<int32_t>(data[i]) * data[i]);
+            if (i + 1 < samples && ((data[i] < 0) != (data[i + 1] < 0))) {
+                zc++;
+            }
+        }
+
+        *rms = samples ? static_cast<uint32_t>(sqrt(static_cast<double>(sum) / samples)) : 0;
+        *crossings = zc;
+    }
+
+    EnergyVad::EnergyVad(int rate, int threshold) : rate_(rate > 0 ? rate : 8000),
+                                                     high_(static_cast<uint32_t>(threshold > 0 ? threshold : 0)),
+                                                     low_(high_ * ENERGY_VAD_HYSTERESIS_PCT / 100), talking_(false),
+                                                     voice_ms_(0), silence_ms_(0), energy_(0) {
+    }
+
+    switch_vad_state_t EnergyVad::process(const int16_t *data, size_t samples) {
+        uint32_t rms, crossings;
+        frame_stats(data, samples, &rms, &crossings);
+        energy_ = static_cast<int32_t>(rms);
+
+        auto frame_ms = static_cast<int>(samples * 1000 / rate_);
+        bool voice = rms >= (talking_ ? low_ : high_);
+        // quiet noise is not a voice, a loud one is
+        if (voice && rms < 2 * high_ && crossings * 100 > samples * ENERGY_VAD_NOISE_ZCR_PCT) {
+            voice = false;
+        }
+
+        if (voice) {
+            silence_ms_ = 0;
+            voice_ms_ += frame_ms;
+        } else {
+            voice_ms_ = 0;
+            silence_ms_ += frame_ms;
+        }
+
+        if (!talking_) {
+            if (voice_ms_ >= ENERGY_VAD_VOICE_MS) {
+                talking_ = true;
+                return SWITCH_VAD_STATE_START_TALKING;
+            }
+            return SWITCH_VAD_STATE_NONE;
+        }
+
+        if (silence_ms_ >= ENERGY_VAD_SILENCE_MS) {
+            talking_ = false;
+            voice_ms_ = 0;
+            silence_ms_ = 0;
+            return SWITCH_VAD_STATE_STOP_TALKING;
+        }
+        return SWITCH_VAD_STATE_TALKING;
+    }
+}
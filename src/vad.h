@@ -0,0 +1,52 @@
+//
+// Created by root on 17.10.26.
+//
+
+#ifndef MOD_GRPC_VAD_H
+#define MOD_GRPC_VAD_H
+
+extern "C" {
+#include <switch.h>
+}
+
+#include <cstddef>
+#include <cstdint>
+
+// same timings as the switch_vad defaults
+#define ENERGY_VAD_VOICE_MS 200
+#define ENERGY_VAD_SILENCE_MS 500
+// talking continues down to 3/4 of the threshold
+#define ENERGY_VAD_HYSTERESIS_PCT 75
+// broadband noise crosses zero on more than 40% of the samples
+#define ENERGY_VAD_NOISE_ZCR_PCT 40
+
+namespace mod_grpc {
+
+    // RMS and zero crossings of a frame, SSE2 on x86
+    void frame_stats(const int16_t *data, size_t samples, uint32_t *rms, uint32_t *crossings);
+
+    // Energy / zero crossing VAD with the states of switch_vad: START_TALKING and STOP_TALKING
+    // are reported once, NONE is silence. The threshold is on the frame RMS like the switch_vad "thresh".
+    class EnergyVad {
+    public:
+        EnergyVad(int rate, int threshold);
+
+        switch_vad_state_t process(const int16_t *data, size_t samples);
+
+        // RMS of the last frame
+        inline int32_t energy() const {
+            return energy_;
+        }
+
+    private:
+        int rate_;
+        uint32_t high_;
+        uint32_t low_;
+        bool talking_;
+        int voice_ms_;
+        int silence_ms_;
+        int32_t energy_;
+    };
+}
+
+#endif //MOD_GRPC_VAD_H
@@ -0,0 +1,423 @@
+//
+// Created by root on 17.10.26.
+//
+
+// WEBITEL_CALL json of the streaming writer against cJSON_PrintUnformatted of libfreeswitch,
+// the expected trees are built the way the cJSON builders did
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "Call.h"
+
+static int failed = 0;
+
+#define CHECK_EQ(name, got, want) check_eq(name, got, want, __LINE__)
+
+static void check_eq(const std::string &name, const std::string &got, const std::string &want, int line) {
+    if (got != want) {
+        failed++;
+        fprintf(stderr, "%s:%d %s\n  got:  %s\n  want: %s\n", __FILE__, line, name.c_str(), got.c_str(), want.c_str());
+    }
+}
+
+static std::string print(cJSON *j) {
+    char *b = cJSON_PrintUnformatted(j);
+    std::string s(b ? b : "");
+    free(b);
+    cJSON_Delete(j);
+    return s;
+}
+
+// cJSON_PrintUnformatted of the output parsed back, the same string when the output is what cJSON prints
+static std::string reprint(const std::string &json) {
+    auto j = cJSON_Parse(json.c_str());
+    return j ? print(j) : std::string("<invalid json>");
+}
+
+template <CallActions A> class Probe : public CallEvent<A> {
+public:
+    explicit Probe(switch_event_t *e) : CallEvent<A>(e) {}
+
+    std::string json() {
+        return this->body_->finish();
+    }
+};
+
+static void add(switch_event_t *e, const char *name, const char *val) {
+    switch_event_add_header_string(e, SWITCH_STACK_BOTTOM, name, val);
+}
+
+static void addCommon(switch_event_t *e) {
+    add(e, "Event-Name", "CHANNEL_HANGUP_COMPLETE");
+    add(e, "Core-UUID", "0b2e6e2c-61a1-4c8f-9e0a-4a5e1f0f6f11");
+    add(e, "FreeSWITCH-Hostname", "fs-1");
+    add(e, "FreeSWITCH-Switchname", "node-1");
+    add(e, "FreeSWITCH-IPv4", "10.0.0.5");
+    add(e, "Unique-ID", "2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10");
+    add(e, "Call-Direction", "outbound");
+    add(e, "Channel-State", "CS_EXECUTE");
+    add(e, "Caller-Caller-ID-Name", "Oleh \"Oleg\" Kovalenko");
+    add(e, "Caller-Caller-ID-Number", "1001");
+    add(e, "Caller-Callee-ID-Name", "Outbound Call");
+    add(e, "Caller-Callee-ID-Number", "+380441234567");
+    add(e, "Caller-Destination-Number", "%2B380441234567");
+    add(e, "variable_sip_h_X-Webitel-Domain-Id", "1");
+    add(e, "variable_sip_h_X-Webitel-User-Id", "42");
+    add(e, "variable_sip_h_X-Webitel-Direction", "internal");
+    add(e, "variable_usr_note", "line1\nline2\t\"quoted\" back\\slash \x01\x1f end");
+    add(e, "variable_usr_city", "\xd0\x9a\xd0\xb8\xd1\x97\xd0\xb2");
+    add(e, "variable_usr_empty", "");
+    add(e, "variable_usr_list", "ARRAY::one|:t\"wo|:th\\ree");
+}
+
+static switch_event_t *ringingEvent() {
+    switch_event_t *e;
+    switch_event_create(&e, SWITCH_EVENT_CHANNEL_CREATE);
+    addCommon(e);
+    add(e, "variable_sip_h_X-Webitel-Display-Direction", "outbound");
+    add(e, "variable_sip_h_X-Webitel-Uuid", "sip-4b8f");
+    add(e, "variable_effective_callee_id_number", "%2B380%2044%20123");
+    add(e, "variable_effective_caller_id_number", "1001");
+    add(e, "variable_effective_caller_id_name", "Agent \\ \"One\"");
+    add(e, "variable_wbt_to_type", "dest");
+    add(e, "variable_wbt_to_id", "");
+    add(e, "variable_wbt_to_name", "Client\x7f");
+    add(e, "variable_wbt_to_number", "+38044123");
+    add(e, "variable_wbt_grantee_id", "7");
+    add(e, "variable_wbt_hide_number", "true");
+    add(e, "variable_wbt_originate", "true");
+    add(e, "variable_wbt_heartbeat", "30");
+    add(e, "variable_wbt_hide_contact", "true");
+    add(e, "variable_wbt_contact_id", "1001");
+    add(e, "variable_wbt_video", "true");
+    add(e, "variable_wbt_auto_answer", "1");
+    add(e, "variable_cc_app_id", "cc-1");
+    add(e, "variable_cc_queue_id", "5");
+    add(e, "variable_cc_queue_name", "Sales \"EU\"");
+    add(e, "variable_cc_attempt_id", "123456789");
+    add(e, "variable_usr_wbt_ivr_log", "[{\"action\":\"set\",\"ts\":1.5e10,\"v\":\"a\\\"b\"},"
+                                       "{\"n\":-0.25,\"x\":[1,2,{\"d\":{\"e\":{\"f\":{\"g\":{\"h\":{\"i\":{\"j\":1e-7}}}}}}}]}]");
+    return e;
+}
+
+static switch_event_t *bridgeEvent() {
+    switch_event_t *e;
+    switch_event_create(&e, SWITCH_EVENT_CHANNEL_BRIDGE);
+    addCommon(e);
+    add(e, "Call-Direction", "inbound");
+    add(e, "variable_signal_bond", "2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10");
+    add(e, "Other-Leg-Unique-ID", "9a1c2e4f-0000-4000-8000-000000000001");
+    add(e, "variable_wbt_hide_number", "true");
+    add(e, "variable_wbt_contact_id", "-17");
+    return e;
+}
+
+static switch_event_t *hangupEvent() {
+    switch_event_t *e;
+    switch_event_create(&e, SWITCH_EVENT_CHANNEL_HANGUP_COMPLETE);
+    addCommon(e);
+    add(e, "variable_wbt_parent_id", "1e3f8a6c-1111-4222-8333-944455556666");
+    add(e, "variable_hangup_cause", "USER_BUSY");
+    add(e, "variable_proto_specific_hangup_cause", "sip:486");
+    add(e, "variable_sip_hangup_disposition", "recv_bye");
+    add(e, "variable_sip_hangup_phrase", "Busy \"Here\"");
+    add(e, "variable_cc_reporting_at", "1700000000123");
+    add(e, "variable_process_cdr", "false");
+    add(e, "variable_wbt_notification_hangup", "true");
+    add(e, "variable_amd_result", "HUMAN");
+    add(e, "variable_amd_cause", "INITIALSILENCE");
+    add(e, "variable_record_seconds", "12");
+    add(e, "variable_wbt_start_record", "1700000000");
+    add(e, "variable_wbt_stop_record", "1700000012");
+    add(e, "variable_wbt_transfer_to", "b4c1");
+    add(e, "variable_wbt_transfer_from_attempt", "77");
+    add(e, "variable_wbt_talk_sec", "11");
+    add(e, "variable_wbt_amd_ai", "machine");
+    add(e, "variable_wbt_amd_ai_positive", "true");
+    add(e, "variable_wbt_amd_ai_log", "ARRAY::human|:machine|:machine");
+    add(e, "variable_wbt_tags", "ARRAY::vip|:\"quoted\"|:new\nline");
+    add(e, "variable_wbt_schema_ids", "ARRAY::1|:22|:1.5|:10000000000|:-3|:0");
+    for (int i = 0; i < 200; i++) {
+        char name[64];
+        snprintf(name, sizeof(name), "variable_sip_h_X-Extra-%d", i);
+        add(e, name, "filler");
+    }
+    return e;
+}
+
+static switch_event_t *amdEvent() {
+    switch_event_t *e;
+    switch_event_create(&e, SWITCH_EVENT_CUSTOM);
+    addCommon(e);
+    add(e, "variable_wbt_amd_ai", "MACHINE \xe2\x80\x94 voicemail");
+    add(e, "variable_wbt_amd_ai_local", "true");
+    add(e, "variable_wbt_amd_ai_partial", "false");
+    add(e, "variable_wbt_amd_ai_confidence", "0.873046875");
+    add(e, "variable_wbt_amd_ai_elapsed_ms", "1250");
+    add(e, "variable_amd_result", "MACHINE");
+    return e;
+}
+
+// The cJSON tree the builders made before the writer, for the fixtures above.
+// The want strings are printed at run time by cJSON_PrintUnformatted of the linked libfreeswitch.
+
+static void addStr(cJSON *j, const char *name, const char *val) {
+    cJSON_AddItemToObject(j, name, cJSON_CreateString(val));
+}
+
+static void addNum(cJSON *j, const char *name, double val) {
+    cJSON_AddItemToObject(j, name, cJSON_CreateNumber(val));
+}
+
+static void addBool(cJSON *j, const char *name, bool val) {
+    cJSON_AddItemToObject(j, name, cJSON_CreateBool(val));
+}
+
+static void addEndpoint(cJSON *j, const char *name, const char *type, const char *number, const char *n, const char *id) {
+    auto ep = cJSON_CreateObject();
+    addStr(ep, "type", type);
+    addStr(ep, "number", number);
+    addStr(ep, "name", n);
+    addStr(ep, "id", id);
+    cJSON_AddItemToObject(j, name, ep);
+}
+
+static void addStrArray(cJSON *j, const char *name, const std::vector<const char *> &vals) {
+    auto a = cJSON_CreateArray();
+    for (auto v : vals) {
+        cJSON_AddItemToArray(a, cJSON_CreateString(v));
+    }
+    cJSON_AddItemToObject(j, name, a);
+}
+
+// variable_usr_ of addCommon
+static cJSON *userPayload() {
+    auto p = cJSON_CreateObject();
+    addStr(p, "note", "line1\nline2\t\"quoted\" back\\slash \x01\x1f end");
+    addStr(p, "city", "\xd0\x9a\xd0\xb8\xd1\x97\xd0\xb2");
+    addStr(p, "empty", "");
+    addStrArray(p, "list", {"one", "t\"wo", "th\\ree"});
+    return p;
+}
+
+static std::string ringingWant(switch_event_t *e) {
+    auto ivr = switch_event_get_header(e, "variable_usr_wbt_ivr_log");
+    auto j = cJSON_CreateObject();
+    addNum(j, "user_id", 42);
+    addStr(j, "sip_id", "sip-4b8f");
+    addNum(j, "grantee_id", 7);
+    addBool(j, "hideNumber", true);
+    addBool(j, "originate", true);
+    addNum(j, "heartbeat", 30);
+    addStr(j, "direction", "outbound");
+    addStr(j, "destination", "+380 44 123");
+    addEndpoint(j, "from", "", "", "", "");
+    addEndpoint(j, "to", "dest", "+38044123", "Client\x7f", "");
+    addBool(j, "hide_contact", true);
+    addNum(j, "contact_id", 1001);
+    auto p = userPayload();
+    addStr(p, "wbt_ivr_log", ivr);
+    cJSON_AddItemToObject(j, "payload", p);
+    cJSON_AddItemToObject(j, "ivr", cJSON_Parse(ivr));
+    auto q = cJSON_CreateObject();
+    addStr(q, "app_id", "cc-1");
+    addStr(q, "queue_id", "5");
+    addStr(q, "queue_name", "Sales \"EU\"");
+    addStr(q, "attempt_id", "123456789");
+    cJSON_AddItemToObject(j, "queue", q);
+    auto params = cJSON_CreateObject();
+    addBool(params, "video", true);
+    addBool(params, "screen", false);
+    addStr(params, "autoAnswer", "1");
+    addBool(params, "disableStun", false);
+    cJSON_AddItemToObject(j, "params", params);
+    return print(j);
+}
+
+static std::string bridgeWant() {
+    auto j = cJSON_CreateObject();
+    addNum(j, "user_id", 42);
+    addNum(j, "contact_id", -17);
+    cJSON_AddItemToObject(j, "payload", userPayload());
+    addBool(j, "hideNumber", true);
+    addEndpoint(j, "to", "", "1001", "Oleh \"Oleg\" Kovalenko", "");
+    addStr(j, "direction", "inbound");
+    addStr(j, "bridged_id", "2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10");
+    return print(j);
+}
+
+static std::string hangupWant() {
+    auto j = cJSON_CreateObject();
+    addNum(j, "user_id", 42);
+    addBool(j, "cdr", false);
+    addBool(j, "notification_hangup", true);
+    addStr(j, "amd_result", "HUMAN");
+    addStr(j, "amd_cause", "INITIALSILENCE");
+    addStr(j, "record_start", "1700000000");
+    addStr(j, "record_stop", "1700000012");
+    addStr(j, "transfer_to", "b4c1");
+    addStr(j, "transfer_from_attempt", "77");
+    addStr(j, "talk_sec", "11");
+    addStr(j, "hangup_by", "B");
+    addStr(j, "reporting_at", "1700000000123");
+    cJSON_AddItemToObject(j, "payload", userPayload());
+    addStr(j, "cause", "USER_BUSY");
+    addBool(j, "originate_success", false);
+    addNum(j, "sip", 486);
+    addStrArray(j, "tags", {"vip", "\"quoted\"", "new\nline"});
+    auto ids = cJSON_CreateArray();
+    for (auto id : {1.0, 22.0, 1.5, 10000000000.0, -3.0, 0.0}) {
+        cJSON_AddItemToArray(ids, cJSON_CreateNumber(id));
+    }
+    cJSON_AddItemToObject(j, "schema_ids", ids);
+    addStr(j, "amd_ai_result", "machine");
+    addBool(j, "amd_ai_positive", true);
+    addStrArray(j, "amd_ai_logs", {"human", "machine", "machine"});
+    addStr(j, "hangup_phrase", "Busy \"Here\"");
+    return print(j);
+}
+
+static std::string amdWant() {
+    auto j = cJSON_CreateObject();
+    addNum(j, "user_id", 42);
+    addStr(j, "ai_result", "MACHINE \xe2\x80\x94 voicemail");
+    addStr(j, "ai_local", "true");
+    addStr(j, "ai_partial", "false");
+    addNum(j, "ai_confidence", 0.873046875);
+    addNum(j, "ai_elapsed_ms", 1250);
+    addStr(j, "result", "MACHINE");
+    return print(j);
+}
+
+static void testStrings() {
+    std::string all;
+    for (int c = 1; c < 128; c++) {
+        all.push_back((char) c);
+    }
+    const char *values[] = {"", "plain", "\"quoted\"", "back\\slash\\", "\xd0\x9a\xd0\xb8\xd1\x97\xd0\xb2 \xf0\x9f\x93\x9e", "\x7f\xff", all.c_str()};
+
+    for (auto val : values) {
+        mod_grpc::JsonWriter w;
+        w.addString(val, val);
+        auto j = cJSON_CreateObject();
+        cJSON_AddItemToObject(j, val, cJSON_CreateString(val));
+        CHECK_EQ(std::string("string ") + val, w.finish(), print(j));
+    }
+}
+
+static void testNumbers() {
+    const double values[] = {0, -0.0, 1, -1, 42, 2147483647.0, -2147483648.0, 2147483648.0, 10000000000.0, 1e60, 1e61,
+                             0.5, -0.25, 1.5, 123.456, 1e-7, 1e-6, 1e9, 1e9 + 0.5, 1e10 + 0.5, 3.14159265358979};
+
+    for (auto val : values) {
+        mod_grpc::JsonWriter w;
+        w.addNumber("n", val);
+        auto j = cJSON_CreateObject();
+        cJSON_AddItemToObject(j, "n", cJSON_CreateNumber(val));
+        CHECK_EQ("number " + std::to_string(val), w.finish(), print(j));
+    }
+}
+
+static void testNesting() {
+    // deeper than any builder goes, every level has a member before the nested container
+    mod_grpc::JsonWriter w;
+    auto root = cJSON_CreateObject();
+    auto j = root;
+    bool array = false;
+    for (int i = 0; i < 40; i++) {
+        auto key = "k" + std::to_string(i);
+        auto child = i % 2 ? cJSON_CreateArray() : cJSON_CreateObject();
+        if (array) {
+            cJSON_AddItemToArray(j, cJSON_CreateBool(i % 3 == 0));
+            cJSON_AddItemToArray(j, child);
+        } else {
+            cJSON_AddItemToObject(j, "before", cJSON_CreateBool(i % 3 == 0));
+            cJSON_AddItemToObject(j, key.c_str(), child);
+        }
+        w.addBool(array ? nullptr : "before", i % 3 == 0);
+        if (i % 2) {
+            w.beginArray(array ? nullptr : key.c_str());
+        } else {
+            w.beginObject(array ? nullptr : key.c_str());
+        }
+        j = child;
+        array = i % 2;
+    }
+    w.addString(nullptr, "leaf");
+    cJSON_AddItemToArray(j, cJSON_CreateString("leaf"));
+
+    CHECK_EQ("nesting", w.finish(), print(root));
+}
+
+static void testEmpty() {
+    mod_grpc::JsonWriter w;
+    auto j = cJSON_CreateObject();
+    w.beginObject("o");
+    w.endObject();
+    cJSON_AddItemToObject(j, "o", cJSON_CreateObject());
+    w.beginArray("a");
+    w.endArray();
+    cJSON_AddItemToObject(j, "a", cJSON_CreateArray());
+    w.beginArray("nested");
+    w.beginArray(nullptr);
+    w.endArray();
+    w.beginObject(nullptr);
+    w.endObject();
+    w.endArray();
+    auto nested = cJSON_CreateArray();
+    cJSON_AddItemToArray(nested, cJSON_CreateArray());
+    cJSON_AddItemToArray(nested, cJSON_CreateObject());
+    cJSON_AddItemToObject(j, "nested", nested);
+    addStr(j, "after", "");
+
+    w.addString("after", "");
+    CHECK_EQ("empty containers", w.finish(), print(j));
+}
+
+static void testEvent(const char *name, const std::string &got, const std::string &want) {
+    CHECK_EQ(name, got, want);
+    CHECK_EQ(std::string(name) + " reprint", reprint(got), got);
+}
+
+int main() {
+    testStrings();
+    testNumbers();
+    testNesting();
+    testEmpty();
+
+    auto e = ringingEvent();
+    {
+        Probe<Ringing> ev(e);
+        testEvent("ringing", ev.json(), ringingWant(e));
+    }
+    switch_event_destroy(&e);
+
+    e = bridgeEvent();
+    {
+        Probe<Bridge> ev(e);
+        testEvent("bridge", ev.json(), bridgeWant());
+    }
+    switch_event_destroy(&e);
+
+    e = hangupEvent();
+    {
+        Probe<Hangup> ev(e);
+        testEvent("hangup", ev.json(), hangupWant());
+    }
+    switch_event_destroy(&e);
+
+    e = amdEvent();
+    {
+        Probe<AMD> ev(e);
+        testEvent("amd", ev.json(), amdWant());
+    }
+    switch_event_destroy(&e);
+
+    if (failed) {
+        fprintf(stderr, "%d checks failed\n", failed);
+        return 1;
+    }
+    printf("ok\n");
+    return 0;
+}
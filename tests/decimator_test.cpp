@@ -0,0 +1,156 @@
+//
+// Created by root on 17.10.26.
+//
+
+// SNR of the FIR decimator and of the speex resampler it replaced for 16k and 48k -> 8k
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include "resampler.h"
+
+extern "C" {
+#include <switch.h>
+}
+
+#define OUT_RATE 8000
+#define SECONDS 2
+// 20 ms frames as the media bug reads them
+#define FRAME_MS 20
+// the decimator must keep this much of a voice band signal
+#define DECIMATOR_MIN_SNR 50.0
+// and may not be worse than speex by more than this
+#define SPEEX_MAX_LOSS 3.0
+
+static int failed = 0;
+
+struct Tone {
+    double freq;
+    double amp;
+};
+
+// voice band, all of them are kept at 8k
+static const Tone tones[] = {{300, 6000}, {700, 5000}, {1100, 4000}, {1700, 3000}, {2300, 2000}};
+// above 4k, must not come back as an alias
+static const Tone alias = {6100, 3000};
+
+static std::vector<int16_t> input(int rate) {
+    std::vector<int16_t> in(static_cast<size_t>(rate * SECONDS));
+    for (size_t i = 0; i < in.size(); i++) {
+        double t = static_cast<double>(i) / rate;
+        double v = alias.amp * sin(2 * M_PI * alias.freq * t);
+        for (auto &tone : tones) {
+            v += tone.amp * sin(2 * M_PI * tone.freq * t);
+        }
+        in[i] = static_cast<int16_t>(lrint(v));
+    }
+    return in;
+}
+
+// against the kept tones only, the output delay is searched in steps of a quarter of an input sample
+static double snr(const std::vector<int16_t> &out, int rate) {
+    // filters settle in the first 50 ms
+    const size_t skip = OUT_RATE / 20;
+    double best = -1000;
+    for (double delay = 0; delay < 256; delay += 0.25) {
+        double signal = 0, noise = 0;
+        for (size_t k = skip; k < out.size(); k++) {
+            double t = (static_cast<double>(k) * rate / OUT_RATE - delay) / rate;
+            double ref = 0;
+            for (auto &tone : tones) {
+                ref += tone.amp * sin(2 * M_PI * tone.freq * t);
+            }
+            signal += ref * ref;
+            noise += (out[k] - ref) * (out[k] - ref);
+        }
+        auto db = 10 * log10(signal / (noise > 0 ? noise : 1e-9));
+        if (db > best) {
+            best = db;
+        }
+    }
+    return best;
+}
+
+// empty if the CPU has no such kernel
+static std::vector<int16_t> decimate(const std::vector<int16_t> &in, int rate,
+                                     mod_grpc::Decimator::Kernel kernel = mod_grpc::Decimator::KERNEL_AUTO) {
+    std::unique_ptr<mod_grpc::Decimator> d(mod_grpc::Decimator::create(rate, OUT_RATE, kernel));
+    if (!d) {
+        return std::vector<int16_t>();
+    }
+    const size_t frame = static_cast<size_t>(rate * FRAME_MS / 1000);
+    std::vector<int16_t> out, tmp(frame / (rate / OUT_RATE) + 1);
+    for (size_t pos = 0; pos + frame <= in.size(); pos += frame) {
+        auto n = d->process(in.data() + pos, frame, tmp.data());
+        out.insert(out.end(), tmp.begin(), tmp.begin() + n);
+    }
+    return out;
+}
+
+// empty if there is no speex
+static std::vector<int16_t> resample(const std::vector<int16_t> &in, int rate) {
+    std::vector<int16_t> out;
+    switch_audio_resampler_t *r = nullptr;
+    const size_t frame = static_cast<size_t>(rate * FRAME_MS / 1000);
+    if (switch_resample_create(&r, rate, OUT_RATE, static_cast<uint32_t>(frame), SWITCH_RESAMPLE_QUALITY, 1) != SWITCH_STATUS_SUCCESS || !r) {
+        return out;
+    }
+    std::vector<int16_t> buf(frame);
+    for (size_t pos = 0; pos + frame <= in.size(); pos += frame) {
+        buf.assign(in.begin() + pos, in.begin() + pos + frame);
+        switch_resample_process(r, buf.data(), static_cast<uint32_t>(frame));
+        out.insert(out.end(), r->to, r->to + r->to_len);
+    }
+    switch_resample_destroy(&r);
+    return out;
+}
+
+static void testRate(int rate) {
+    auto in = input(rate);
+    auto decimated = decimate(in, rate);
+    if (decimated.size() != in.size() * OUT_RATE / rate) {
+        failed++;
+        fprintf(stderr, "%d: %zu samples, want %zu\n", rate, decimated.size(), in.size() * OUT_RATE / rate);
+    }
+    // SIMD kernels sum in another order, Q15 products in int32 give the same result
+    for (auto kernel : {mod_grpc::Decimator::KERNEL_SCALAR, mod_grpc::Decimator::KERNEL_SSE2,
+                        mod_grpc::Decimator::KERNEL_AVX2}) {
+        auto other = decimate(in, rate, kernel);
+        if (!other.empty() && other != decimated) {
+            failed++;
+            fprintf(stderr, "%d: kernel %d output differs\n", rate, kernel);
+        }
+    }
+
+    auto fir = snr(decimated, rate);
+    printf("%d -> %d decimator SNR %.1f dB\n", rate, OUT_RATE, fir);
+    if (fir < DECIMATOR_MIN_SNR) {
+        failed++;
+        fprintf(stderr, "%d: decimator SNR %.1f dB is below %.1f dB\n", rate, fir, DECIMATOR_MIN_SNR);
+    }
+
+    auto resampled = resample(in, rate);
+    if (resampled.empty()) {
+        printf("%d -> %d speex is not available\n", rate, OUT_RATE);
+        return;
+    }
+    auto speex = snr(resampled, rate);
+    printf("%d -> %d speex SNR %.1f dB\n", rate, OUT_RATE, speex);
+    if (fir < speex - SPEEX_MAX_LOSS) {
+        failed++;
+        fprintf(stderr, "%d: decimator SNR %.1f dB, speex %.1f dB\n", rate, fir, speex);
+    }
+}
+
+int main() {
+    testRate(16000);
+    testRate(48000);
+
+    if (failed) {
+        fprintf(stderr, "%d checks failed\n", failed);
+        return 1;
+    }
+    printf("ok\n");
+    return 0;
+}
@@ -0,0 +1,101 @@
+//
+// Created by root on 17.10.26.
+//
+
+// push bodies of the compiled templates
+
+#include <cstdio>
+#include <string>
+#include "PushTemplate.h"
+
+using mod_grpc::PushData;
+using mod_grpc::PushTemplate;
+
+static int failed = 0;
+
+#define CHECK_EQ(name, got, want) check_eq(name, got, want, __LINE__)
+
+static void check_eq(const std::string &name, const std::string &got, const std::string &want, int line) {
+    if (got != want) {
+        failed++;
+        fprintf(stderr, "%s:%d %s\n  got:  %s\n  want: %s\n", __FILE__, line, name.c_str(), got.c_str(), want.c_str());
+    }
+}
+
+static std::string render(const PushTemplate &tpl, const PushData &data, const char *devices) {
+    std::string out;
+    tpl.Render(&data, devices, out);
+    return out;
+}
+
+static PushData pushData() {
+    PushData data;
+    data.call_id = "2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10";
+    data.from_number = "1001";
+    data.from_name = "Oleh \"Oleg\" \\ Kovalenko\t\x01";
+    data.direction = "inbound";
+    data.auto_answer = 1;
+    data.delay = 0;
+    return data;
+}
+
+static void testEscape() {
+    PushTemplate tpl(PUSH_APN_TEMPLATE, 30);
+    CHECK_EQ("apn", render(tpl, pushData(), "token"),
+             "{\"aps\":{\"type\":\"call\", \"call_id\":\"2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10\",\"from_number\":\"1001\","
+             "\"from_name\":\"Oleh \\\"Oleg\\\" \\\\ Kovalenko\\t\\u0001\",\"direction\":\"inbound\",\"auto_answer\":1},"
+             "\"priority\":10}");
+
+    auto data = pushData();
+    data.from_name = std::string("\b\f\n\r\x1f\x7f") + "\xd0\x9a\xd0\xb8\xd1\x97\xd0\xb2";
+    data.from_number.clear();
+    CHECK_EQ("control chars", render(PushTemplate("${from_number}${from_name}", 0), data, nullptr),
+             "\"\"\"\\b\\f\\n\\r\\u001f\x7f\xd0\x9a\xd0\xb8\xd1\x97\xd0\xb2\"");
+}
+
+static void testDevices() {
+    PushTemplate tpl("[${devices}]", 0);
+    auto data = pushData();
+    const struct {
+        const char *devices;
+        const char *want;
+    } cases[] = {
+            {nullptr,              "[]"},
+            {"",                   "[]"},
+            {"a",                  "[\"a\"]"},
+            {"a::b",               "[\"a\",\"b\"]"},
+            {"a::",                "[\"a\"]"},
+            {"::a",                "[\"a\"]"},
+            {"::",                 "[]"},
+            {"a::::b::",           "[\"a\",\"b\"]"},
+            {"a:b::c:",            "[\"a:b\",\"c:\"]"},
+            {"a\"b::c\\d::e\nf",   "[\"a\\\"b\",\"c\\\\d\",\"e\\nf\"]"},
+    };
+    for (auto &c : cases) {
+        CHECK_EQ(std::string("devices ") + (c.devices ? c.devices : "null"), render(tpl, data, c.devices), c.want);
+    }
+}
+
+static void testTemplate() {
+    PushTemplate fcm(PUSH_FCM_TEMPLATE, 62);
+    CHECK_EQ("fcm", render(fcm, pushData(), "t1::t2"),
+             "{\"time_to_live\":62,\"data\":{\"type\":\"call\", \"call_id\":\"2f0d5a3e-7c61-4d7e-8a45-0e8a1c3b9d10\","
+             "\"from_number\":\"1001\",\"from_name\":\"Oleh \\\"Oleg\\\" \\\\ Kovalenko\\t\\u0001\",\"direction\":\"inbound\","
+             "\"auto_answer\":1},\"registration_ids\":[\"t1\",\"t2\"],\"priority\":10}");
+
+    // unknown and unterminated placeholders are kept as is
+    CHECK_EQ("placeholders", render(PushTemplate("${x}${call_id", 0), pushData(), nullptr), "${x}${call_id");
+}
+
+int main() {
+    testEscape();
+    testDevices();
+    testTemplate();
+
+    if (failed) {
+        fprintf(stderr, "%d checks failed\n", failed);
+        return 1;
+    }
+    printf("ok\n");
+    return 0;
+}